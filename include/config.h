@@ -55,6 +55,64 @@
     #define TOUCH_IRQ CONFIG_TOUCH_IRQ
     
     #define FLOW_METER_PIN CONFIG_FLOW_METER_PIN
+    #ifdef CONFIG_FLOW_TAP_COUNT
+        #define FLOW_TAP_COUNT CONFIG_FLOW_TAP_COUNT
+    #else
+        #define FLOW_TAP_COUNT 1
+    #endif
+    #ifdef CONFIG_FLOW_METER_PIN_2
+        #define FLOW_METER_PIN_2 CONFIG_FLOW_METER_PIN_2
+    #else
+        #define FLOW_METER_PIN_2 -1
+    #endif
+    #ifdef CONFIG_FLOW_METER_PIN_3
+        #define FLOW_METER_PIN_3 CONFIG_FLOW_METER_PIN_3
+    #else
+        #define FLOW_METER_PIN_3 -1
+    #endif
+    #ifdef CONFIG_FLOW_METER_PIN_4
+        #define FLOW_METER_PIN_4 CONFIG_FLOW_METER_PIN_4
+    #else
+        #define FLOW_METER_PIN_4 -1
+    #endif
+    #ifdef CONFIG_FLOW_METER_BACKEND_PCNT
+        #define FLOW_METER_USE_PCNT 1
+    #else
+        #define FLOW_METER_USE_PCNT 0
+    #endif
+    #ifdef CONFIG_FLOW_METER_GLITCH_FILTER_NS
+        #define FLOW_METER_GLITCH_FILTER_NS CONFIG_FLOW_METER_GLITCH_FILTER_NS
+    #else
+        #define FLOW_METER_GLITCH_FILTER_NS 1000
+    #endif
+    #ifdef CONFIG_FLOW_SAMPLING_TASK
+        #define FLOW_SAMPLING_TASK_ENABLED 1
+        #define FLOW_SAMPLING_PERIOD_MS CONFIG_FLOW_SAMPLING_PERIOD_MS
+        #define FLOW_SAMPLING_TASK_PRIORITY CONFIG_FLOW_SAMPLING_TASK_PRIORITY
+        #define FLOW_SAMPLING_TASK_CORE CONFIG_FLOW_SAMPLING_TASK_CORE
+        #define FLOW_SAMPLING_TASK_STACK_SIZE CONFIG_FLOW_SAMPLING_TASK_STACK_SIZE
+    #else
+        #define FLOW_SAMPLING_TASK_ENABLED 0
+        #define FLOW_SAMPLING_PERIOD_MS 50
+        #define FLOW_SAMPLING_TASK_PRIORITY 10
+        #define FLOW_SAMPLING_TASK_CORE 1
+        #define FLOW_SAMPLING_TASK_STACK_SIZE 3072
+    #endif
+    #ifdef CONFIG_FLOW_RATE_FAST_WINDOW_MS
+        #define FLOW_RATE_FAST_WINDOW_MS CONFIG_FLOW_RATE_FAST_WINDOW_MS
+    #else
+        #define FLOW_RATE_FAST_WINDOW_MS 100
+    #endif
+    #ifdef CONFIG_FLOW_RATE_EWMA_TAU_MS
+        #define FLOW_RATE_EWMA_TAU_MS CONFIG_FLOW_RATE_EWMA_TAU_MS
+    #else
+        #define FLOW_RATE_EWMA_TAU_MS 250
+    #endif
+    #ifdef CONFIG_FLOW_RATE_STOP_TIMEOUT_MS
+        #define FLOW_RATE_STOP_TIMEOUT_MS CONFIG_FLOW_RATE_STOP_TIMEOUT_MS
+    #else
+        #define FLOW_RATE_STOP_TIMEOUT_MS 500
+    #endif
     
     #define LED_R_PIN CONFIG_LED_R_PIN
     #define LED_G_PIN CONFIG_LED_G_PIN
@@ -67,6 +125,88 @@
     #define DISPLAY_HEIGHT CONFIG_DISPLAY_HEIGHT
     #define DISPLAY_ROTATION CONFIG_DISPLAY_ROTATION
     #define TOUCH_THRESHOLD CONFIG_TOUCH_THRESHOLD
+    #ifdef CONFIG_TOUCH_BACKEND_SPI
+        #define TOUCH_USE_SPI_HOST 1
+    #else
+        #define TOUCH_USE_SPI_HOST 0
+    #endif
+    #ifdef CONFIG_TOUCH_SPI_CLOCK_HZ
+        #define TOUCH_SPI_CLOCK_HZ CONFIG_TOUCH_SPI_CLOCK_HZ
+    #else
+        #define TOUCH_SPI_CLOCK_HZ 2000000
+    #endif
+    #ifdef CONFIG_TOUCH_OVERSAMPLE
+        #define TOUCH_OVERSAMPLE CONFIG_TOUCH_OVERSAMPLE
+    #else
+        #define TOUCH_OVERSAMPLE 5
+    #endif
+    #ifdef CONFIG_TOUCH_MAX_SPREAD
+        #define TOUCH_MAX_SPREAD CONFIG_TOUCH_MAX_SPREAD
+    #else
+        #define TOUCH_MAX_SPREAD 80
+    #endif
+    #ifdef CONFIG_DISPLAY_REFRESH_FAST_MS
+        #define DISPLAY_REFRESH_FAST_MS CONFIG_DISPLAY_REFRESH_FAST_MS
+    #else
+        #define DISPLAY_REFRESH_FAST_MS 20
+    #endif
+    #ifdef CONFIG_DISPLAY_REFRESH_IDLE_MS
+        #define DISPLAY_REFRESH_IDLE_MS CONFIG_DISPLAY_REFRESH_IDLE_MS
+    #else
+        #define DISPLAY_REFRESH_IDLE_MS 100
+    #endif
+    #ifdef CONFIG_DISPLAY_REFRESH_HOLD_MS
+        #define DISPLAY_REFRESH_HOLD_MS CONFIG_DISPLAY_REFRESH_HOLD_MS
+    #else
+        #define DISPLAY_REFRESH_HOLD_MS 1000
+    #endif
+    #ifdef CONFIG_SPLASH_STREAM
+        #define SPLASH_STREAM_ENABLED 1
+    #else
+        #define SPLASH_STREAM_ENABLED 0
+    #endif
+    #ifdef CONFIG_ASSET_PARTITION
+        #define ASSET_PARTITION_ENABLED 1
+    #else
+        #define ASSET_PARTITION_ENABLED 0
+    #endif
+    #ifdef CONFIG_ASSET_BUILTIN_LOGO
+        #define ASSET_BUILTIN_LOGO_ENABLED 1
+    #else
+        #define ASSET_BUILTIN_LOGO_ENABLED 0
+    #endif
+    #ifdef CONFIG_IMAGE_CACHE_BUDGET_KB
+        #define IMAGE_CACHE_BUDGET_KB CONFIG_IMAGE_CACHE_BUDGET_KB
+    #else
+        #define IMAGE_CACHE_BUDGET_KB 256
+    #endif
+    #ifdef CONFIG_LVGL_POOL
+        #define LVGL_POOL_ENABLED 1
+        #define LVGL_POOL_KB CONFIG_LVGL_POOL_KB
+    #else
+        #define LVGL_POOL_ENABLED 0
+        #define LVGL_POOL_KB 0
+    #endif
+    #ifdef CONFIG_LVGL_POOL_PSRAM_MIN_BYTES
+        #define LVGL_POOL_PSRAM_MIN_BYTES CONFIG_LVGL_POOL_PSRAM_MIN_BYTES
+    #else
+        #define LVGL_POOL_PSRAM_MIN_BYTES 0
+    #endif
+    #ifdef CONFIG_QR_SESSION_NONCE
+        #define QR_SESSION_NONCE_ENABLED 1
+    #else
+        #define QR_SESSION_NONCE_ENABLED 0
+    #endif
+    
+    #ifdef CONFIG_DISPLAY_POWER
+        #define DISPLAY_POWER_ENABLED 1
+        #define DISPLAY_BACKLIGHT_LEVEL CONFIG_DISPLAY_BACKLIGHT_LEVEL
+        #define DISPLAY_DIM_LEVEL CONFIG_DISPLAY_DIM_LEVEL
+        #define DISPLAY_DIM_TIMEOUT_SEC CONFIG_DISPLAY_DIM_TIMEOUT_SEC
+        #define DISPLAY_SLEEP_TIMEOUT_SEC CONFIG_DISPLAY_SLEEP_TIMEOUT_SEC
+    #else
+        #define DISPLAY_POWER_ENABLED 0
+    #endif
     
     #define SERIAL_BAUD CONFIG_SERIAL_BAUD
     
@@ -78,6 +218,13 @@
     // Code will check CONFIG_WIFI_SSID at runtime to decide which to use
     // Note: CONFIG_WIFI_SSID is a string config from KConfig, available via sdkconfig.h
     #define WIFI_RECONNECT_DELAY CONFIG_WIFI_RECONNECT_DELAY
+    #ifdef CONFIG_WIFI_FAST_RECONNECT
+        #define WIFI_FAST_RECONNECT_ENABLED 1
+        #define WIFI_LEASE_REUSE_SEC CONFIG_WIFI_LEASE_REUSE_SEC
+    #else
+        #define WIFI_FAST_RECONNECT_ENABLED 0
+        #define WIFI_LEASE_REUSE_SEC 0
+    #endif
     #define USE_IMPROV_WIFI CONFIG_USE_IMPROV_WIFI
     #ifdef CONFIG_IMPROV_START_BY_DEFAULT
         #define IMPROV_START_BY_DEFAULT CONFIG_IMPROV_START_BY_DEFAULT
@@ -89,6 +236,11 @@
     #else
         #define IMPROV_WIFI_TIMEOUT_MS 300000  // Default: 5 minutes
     #endif
+    #ifdef CONFIG_IMPROV_RELEASE_BLE_MEMORY
+        #define IMPROV_RELEASE_BLE_MEMORY_ENABLED 1
+    #else
+        #define IMPROV_RELEASE_BLE_MEMORY_ENABLED 0
+    #endif
     #define USE_SAVED_CREDENTIALS CONFIG_USE_SAVED_CREDENTIALS
     
     // MQTT Configuration
@@ -97,16 +249,139 @@
     // Code will check CONFIG_MQTT_SERVER at runtime to decide which to use
     #define MQTT_SERVER_KCONFIG CONFIG_MQTT_SERVER
     #define MQTT_PORT CONFIG_MQTT_PORT
+    #ifdef CONFIG_MQTT_USE_TLS
+        #define MQTT_USE_TLS 1
+    #else
+        #define MQTT_USE_TLS 0
+    #endif
     #define MQTT_CLIENT_ID_PREFIX CONFIG_MQTT_CLIENT_ID_PREFIX
     #define MQTT_TOPIC_PREFIX CONFIG_MQTT_TOPIC_PREFIX
     #define MQTT_RECONNECT_DELAY CONFIG_MQTT_RECONNECT_DELAY
+    #define MQTT_RECONNECT_MAX_DELAY CONFIG_MQTT_RECONNECT_MAX_DELAY
     #define MQTT_KEEPALIVE CONFIG_MQTT_KEEPALIVE
+    #define MQTT_MAX_MESSAGE_SIZE CONFIG_MQTT_MAX_MESSAGE_SIZE
+    
+    #ifdef CONFIG_OTA_UPDATES
+        #define OTA_UPDATES_ENABLED 1
+        #ifdef CONFIG_OTA_ALLOW_HTTP
+            #define OTA_ALLOW_HTTP 1
+        #else
+            #define OTA_ALLOW_HTTP 0
+        #endif
+        #define OTA_HEALTHY_SEC CONFIG_OTA_HEALTHY_SEC
+        #define OTA_ROLLBACK_TIMEOUT_SEC CONFIG_OTA_ROLLBACK_TIMEOUT_SEC
+    #else
+        #define OTA_UPDATES_ENABLED 0
+        #define OTA_ALLOW_HTTP 0
+        #define OTA_HEALTHY_SEC 60
+        #define OTA_ROLLBACK_TIMEOUT_SEC 600
+    #endif
+    
+    #ifdef CONFIG_MAIN_LOOP_IDLE_MS
+        #define MAIN_LOOP_IDLE_MS CONFIG_MAIN_LOOP_IDLE_MS
+    #else
+        #define MAIN_LOOP_IDLE_MS 250
+    #endif
+    #ifdef CONFIG_POWER_MANAGEMENT
+        #define POWER_MANAGEMENT_ENABLED 1
+        #define POWER_MAX_CPU_MHZ CONFIG_POWER_MAX_CPU_MHZ
+        #define POWER_MIN_CPU_MHZ CONFIG_POWER_MIN_CPU_MHZ
+        #define POWER_WIFI_LISTEN_INTERVAL CONFIG_POWER_WIFI_LISTEN_INTERVAL
+        #ifdef CONFIG_POWER_LIGHT_SLEEP
+            #define POWER_LIGHT_SLEEP_ENABLED 1
+        #else
+            #define POWER_LIGHT_SLEEP_ENABLED 0
+        #endif
+    #else
+        #define POWER_MANAGEMENT_ENABLED 0
+        #define POWER_LIGHT_SLEEP_ENABLED 0
+    #endif
+    #ifdef CONFIG_MAIN_LOOP_TASK_PRIORITY
+        #define MAIN_LOOP_TASK_PRIORITY CONFIG_MAIN_LOOP_TASK_PRIORITY
+        #define MAIN_LOOP_TASK_CORE CONFIG_MAIN_LOOP_TASK_CORE
+        #define MAIN_LOOP_TASK_STACK_SIZE CONFIG_MAIN_LOOP_TASK_STACK_SIZE
+        #define NETWORK_TASK_PRIORITY CONFIG_NETWORK_TASK_PRIORITY
+        #define NETWORK_TASK_CORE CONFIG_NETWORK_TASK_CORE
+        #define NETWORK_TASK_STACK_SIZE CONFIG_NETWORK_TASK_STACK_SIZE
+        #define BACKGROUND_TASK_CORE CONFIG_BACKGROUND_TASK_CORE
+    #else
+        #define MAIN_LOOP_TASK_PRIORITY 5
+        #define MAIN_LOOP_TASK_CORE 0
+        #define MAIN_LOOP_TASK_STACK_SIZE 8192
+        #define NETWORK_TASK_PRIORITY 4
+        #define NETWORK_TASK_CORE 0
+        #define NETWORK_TASK_STACK_SIZE 6144
+        #define BACKGROUND_TASK_CORE 0
+    #endif
+    #ifdef CONFIG_UI_TASK_PRIORITY
+        #define UI_TASK_PRIORITY CONFIG_UI_TASK_PRIORITY
+        #define UI_TASK_CORE CONFIG_UI_TASK_CORE
+        #define UI_TASK_STACK_SIZE CONFIG_UI_TASK_STACK_SIZE
+        #define UI_QUEUE_LENGTH CONFIG_UI_QUEUE_LENGTH
+    #else
+        #define UI_TASK_PRIORITY 6
+        #define UI_TASK_CORE 1
+        #define UI_TASK_STACK_SIZE 8192
+        #define UI_QUEUE_LENGTH 8
+    #endif
     
     #define ENABLE_WATCHDOG CONFIG_ENABLE_WATCHDOG
     #define WATCHDOG_TIMEOUT_SEC CONFIG_WATCHDOG_TIMEOUT_SEC
     #define MAX_CONSECUTIVE_ERRORS CONFIG_MAX_CONSECUTIVE_ERRORS
     #define ERROR_RESET_DELAY_MS CONFIG_ERROR_RESET_DELAY_MS
     
+    // Diagnostics
+    #ifdef CONFIG_PERF_MONITOR
+        #define PERF_MONITOR_ENABLED 1
+        #define PERF_REPORT_INTERVAL_SEC CONFIG_PERF_REPORT_INTERVAL_SEC
+    #else
+        #define PERF_MONITOR_ENABLED 0
+        #define PERF_REPORT_INTERVAL_SEC 0
+    #endif
+    #ifdef CONFIG_BOOT_PROFILE
+        #define BOOT_PROFILE_ENABLED 1
+        #define BOOT_PROFILE_HISTORY CONFIG_BOOT_PROFILE_HISTORY
+    #else
+        #define BOOT_PROFILE_ENABLED 0
+        #define BOOT_PROFILE_HISTORY 0
+    #endif
+    #ifdef CONFIG_HEALTH_MONITOR
+        #define HEALTH_MONITOR_ENABLED 1
+        #define HEALTH_MONITOR_INTERVAL_SEC CONFIG_HEALTH_MONITOR_INTERVAL_SEC
+        #define HEALTH_MONITOR_DELTA_BYTES CONFIG_HEALTH_MONITOR_DELTA_BYTES
+        #define HEALTH_MONITOR_FULL_EVERY CONFIG_HEALTH_MONITOR_FULL_EVERY
+    #else
+        #define HEALTH_MONITOR_ENABLED 0
+        #define HEALTH_MONITOR_INTERVAL_SEC 60
+        #define HEALTH_MONITOR_DELTA_BYTES 512
+        #define HEALTH_MONITOR_FULL_EVERY 60
+    #endif
+    #ifdef CONFIG_LOG_SINK
+        #define LOG_SINK_ENABLED 1
+        #define LOG_SINK_BUFFER_SIZE CONFIG_LOG_SINK_BUFFER_SIZE
+    #else
+        #define LOG_SINK_ENABLED 0
+    #endif
+    #ifdef CONFIG_LOG_RING
+        #define LOG_RING_ENABLED 1
+        #define LOG_RING_SIZE CONFIG_LOG_RING_SIZE
+        #define LOG_RING_LEVEL CONFIG_LOG_RING_LEVEL
+    #else
+        #define LOG_RING_ENABLED 0
+    #endif
+    #ifdef CONFIG_LOG_HOT_PATH
+        #define LOG_HOT_PATH_ENABLED 1
+    #else
+        #define LOG_HOT_PATH_ENABLED 0
+    #endif
+    #ifdef CONFIG_PULSE_TRACE
+        #define PULSE_TRACE_ENABLED 1
+        #define PULSE_TRACE_BUFFER_SIZE CONFIG_PULSE_TRACE_BUFFER_SIZE
+    #else
+        #define PULSE_TRACE_ENABLED 0
+        #define PULSE_TRACE_BUFFER_SIZE 0
+    #endif
+    
     // Development Options
     #ifdef CONFIG_DEBUG_QR_TAP_TO_POUR
         #define DEBUG_QR_TAP_TO_POUR CONFIG_DEBUG_QR_TAP_TO_POUR
@@ -138,6 +413,52 @@
     #else
         #define FINISHED_SCREEN_TIMEOUT_SEC 5  // Default fallback
     #endif
+    #ifdef CONFIG_POUR_VALVE_ENABLED
+        #define POUR_VALVE_ENABLED 1
+        #define POUR_VALVE_PIN CONFIG_POUR_VALVE_PIN
+        #ifdef CONFIG_POUR_VALVE_ACTIVE_HIGH
+            #define POUR_VALVE_ACTIVE_HIGH 1
+        #else
+            #define POUR_VALVE_ACTIVE_HIGH 0
+        #endif
+        #define POUR_STOP_LATENCY_DEFAULT_MS CONFIG_POUR_STOP_LATENCY_DEFAULT_MS
+    #else
+        #define POUR_VALVE_ENABLED 0
+        #define POUR_VALVE_PIN 27
+        #define POUR_VALVE_ACTIVE_HIGH 1
+        #define POUR_STOP_LATENCY_DEFAULT_MS 80
+    #endif
+    #ifdef CONFIG_POUR_VALVE_PIN_2
+        #define POUR_VALVE_PIN_2 CONFIG_POUR_VALVE_PIN_2
+    #else
+        #define POUR_VALVE_PIN_2 -1
+    #endif
+    #ifdef CONFIG_POUR_VALVE_PIN_3
+        #define POUR_VALVE_PIN_3 CONFIG_POUR_VALVE_PIN_3
+    #else
+        #define POUR_VALVE_PIN_3 -1
+    #endif
+    #ifdef CONFIG_POUR_VALVE_PIN_4
+        #define POUR_VALVE_PIN_4 CONFIG_POUR_VALVE_PIN_4
+    #else
+        #define POUR_VALVE_PIN_4 -1
+    #endif
+    #ifdef CONFIG_POUR_TELEMETRY
+        #define POUR_TELEMETRY_ENABLED 1
+        #define POUR_TELEMETRY_SAMPLE_MS CONFIG_POUR_TELEMETRY_SAMPLE_MS
+        #define POUR_TELEMETRY_BATCH_SEC CONFIG_POUR_TELEMETRY_BATCH_SEC
+    #else
+        #define POUR_TELEMETRY_ENABLED 0
+        #define POUR_TELEMETRY_SAMPLE_MS 250
+        #define POUR_TELEMETRY_BATCH_SEC 5
+    #endif
+    #ifdef CONFIG_FLOW_STATS
+        #define FLOW_STATS_ENABLED 1
+        #define FLOW_STATS_WINDOW_SEC CONFIG_FLOW_STATS_WINDOW_SEC
+    #else
+        #define FLOW_STATS_ENABLED 0
+        #define FLOW_STATS_WINDOW_SEC 900
+    #endif
     
     
 #else
@@ -165,6 +486,26 @@
 
     // Touch settings
     #define TOUCH_THRESHOLD 100  // Adjust based on your touch controller (lower = more sensitive)
+    #define TOUCH_USE_SPI_HOST 1  // 1 = XPT2046 on SPI3 (VSPI) host with DMA, 0 = bit-banged GPIO
+    #define TOUCH_SPI_CLOCK_HZ 2000000  // XPT2046 SPI clock (max 2.5MHz)
+    #define TOUCH_OVERSAMPLE 5    // X/Y conversions per sample (trimmed mean / median)
+    #define TOUCH_MAX_SPREAD 80   // Max raw spread within a burst before the sample is rejected
+    #define DISPLAY_REFRESH_FAST_MS 20     // LVGL refresh period while touching, pouring or animating
+    #define DISPLAY_REFRESH_IDLE_MS 100    // Refresh period on idle screens
+    #define DISPLAY_REFRESH_HOLD_MS 1000   // Keep the fast period this long after activity
+    #define SPLASH_STREAM_ENABLED 1    // Stream splash logo to the panel in bands, bypassing LVGL
+    #define IMAGE_CACHE_BUDGET_KB 256  // Decoded RLE image cache (PSRAM when available)
+    #define ASSET_PARTITION_ENABLED 1  // Logo/splash images from the "assets" partition bundle
+    #define ASSET_BUILTIN_LOGO_ENABLED 0  // Compiled-in logo fallback when the partition has no bundle
+    #define LVGL_POOL_ENABLED 1        // Size-class pool for LVGL allocations ("lvmem" serial command)
+    #define LVGL_POOL_KB 32            // LVGL pool arena (internal RAM)
+    #define LVGL_POOL_PSRAM_MIN_BYTES 0  // LVGL allocations this large go to PSRAM (0 = never)
+    #define QR_SESSION_NONCE_ENABLED 0   // Fresh nonce in the payment URL per session
+    #define DISPLAY_POWER_ENABLED 1      // LEDC backlight, idle dimming and panel sleep
+    #define DISPLAY_BACKLIGHT_LEVEL 100  // Backlight level when active (%)
+    #define DISPLAY_DIM_LEVEL 20         // Backlight level when dimmed (%)
+    #define DISPLAY_DIM_TIMEOUT_SEC 120  // Dim after this long without activity (0 = never)
+    #define DISPLAY_SLEEP_TIMEOUT_SEC 1800  // Panel sleep after this long (0 = never)
 
     // Serial settings
     #define SERIAL_BAUD 115200
@@ -175,8 +516,24 @@
 
     // WiFi Configuration
     #define WIFI_RECONNECT_DELAY 5000          // Delay between reconnection attempts (ms)
+    #define WIFI_FAST_RECONNECT_ENABLED 1      // Reconnect to the cached BSSID/channel without a scan
+    #define WIFI_LEASE_REUSE_SEC 3600          // Reuse the cached DHCP lease for this long (0 = always DHCP)
 
     // Error Recovery Configuration
+    #define MAIN_LOOP_IDLE_MS 250              // Max main loop / UI task sleep between events (ms)
+    #define MAIN_LOOP_TASK_PRIORITY 5          // Main loop task priority
+    #define MAIN_LOOP_TASK_CORE 0              // Core the main loop is pinned to (with the network stack)
+    #define MAIN_LOOP_TASK_STACK_SIZE 8192     // Main loop task stack size (bytes)
+    #define NETWORK_TASK_PRIORITY 4            // WiFi manager / boot network task priority
+    #define NETWORK_TASK_CORE 0                // Core of the WiFi manager / boot network tasks
+    #define NETWORK_TASK_STACK_SIZE 6144       // WiFi manager / boot network task stack size (bytes)
+    #define BACKGROUND_TASK_CORE 0             // Core of log output, health, pour log upload and QR encoding
+    #define UI_TASK_PRIORITY 6                 // UI (LVGL) task priority (main loop runs at 5)
+    #define UI_TASK_CORE 1                     // Core the UI task is pinned to
+    #define UI_TASK_STACK_SIZE 8192            // UI task stack size (bytes)
+    #define UI_QUEUE_LENGTH 8                  // UI command queue depth
+    #define POWER_MANAGEMENT_ENABLED 0         // DFS, automatic light sleep and WiFi modem sleep
+    #define POWER_LIGHT_SLEEP_ENABLED 0        // Light sleep once the display sleeps
     #define ENABLE_WATCHDOG 1                  // Enable ESP32 watchdog timer (1=enabled, 0=disabled)
     #define WATCHDOG_TIMEOUT_SEC 60            // Watchdog timeout in seconds (reset if not fed)
     #define MAX_CONSECUTIVE_ERRORS 10         // Maximum consecutive errors before reset
@@ -184,24 +541,48 @@
 
     // MQTT Configuration
     #define MQTT_PORT 1883                     // MQTT port (1883 for non-TLS, 8883 for TLS)
+    #define MQTT_USE_TLS 0                     // mqtts:// with TLS session resumption (set port 8883)
     #define MQTT_CLIENT_ID_PREFIX "precisionpour" // Prefix for MQTT client ID
     #define MQTT_TOPIC_PREFIX "precisionpour"     // Prefix for MQTT topics
-    #define MQTT_RECONNECT_DELAY 5000            // Delay between MQTT reconnection attempts (ms)
+    #define MQTT_RECONNECT_DELAY 5000            // First MQTT reconnection backoff, doubles per failure (ms)
+    #define MQTT_RECONNECT_MAX_DELAY 60000       // MQTT reconnection backoff limit (ms)
     // MQTT_KEEPALIVE: Undefine library default (15) and set our own (60 seconds)
     #ifdef MQTT_KEEPALIVE
     #undef MQTT_KEEPALIVE
     #endif
     #define MQTT_KEEPALIVE 60                    // MQTT keepalive interval (seconds)
+    #define MQTT_MAX_MESSAGE_SIZE 8192           // Largest inbound payload, reassembled from fragments (bytes)
+
+    // OTA Updates
+    #define OTA_UPDATES_ENABLED 1              // Firmware updates on commands/ota into the inactive app slot
+    #define OTA_ALLOW_HTTP 0                   // Accept plain http:// image URLs (bench testing only)
+    #define OTA_HEALTHY_SEC 60                 // Mark a new image valid after this long with MQTT up (seconds)
+    #define OTA_ROLLBACK_TIMEOUT_SEC 600       // Roll back a new image not healthy by then (seconds)
 
     // Flow meter pin (YF-S201 Hall Effect Flow Sensor)
     // Changed from GPIO25 to GPIO26 to avoid conflict with TOUCH_SCLK
     // GPIO26 is interrupt-capable and available (was Audio DAC, can be repurposed)
     #define FLOW_METER_PIN 26  // GPIO pin for flow meter interrupt
+    #define FLOW_TAP_COUNT 1       // Taps served by this controller (1-4), one flow meter and valve each
+    #define FLOW_METER_PIN_2 34    // Tap 2 flow meter (used when FLOW_TAP_COUNT >= 2)
+    #define FLOW_METER_PIN_3 35    // Tap 3 flow meter (used when FLOW_TAP_COUNT >= 3)
+    #define FLOW_METER_PIN_4 5     // Tap 4 flow meter (used when FLOW_TAP_COUNT >= 4)
+    #define FLOW_METER_USE_PCNT 1  // 1 = count pulses with PCNT peripheral, 0 = GPIO interrupt with software debounce
+    #define FLOW_METER_GLITCH_FILTER_NS 1000  // PCNT glitch filter width in ns (0 = disabled, max ~12700)
+    #define FLOW_SAMPLING_TASK_ENABLED 1  // 1 = sample flow in a dedicated task, 0 = sample from flow_meter_update() in main loop
+    #define FLOW_SAMPLING_PERIOD_MS 50    // Sampling task period (ms)
+    #define FLOW_SAMPLING_TASK_PRIORITY 10  // Sampling task priority (main loop runs at 5)
+    #define FLOW_SAMPLING_TASK_CORE 1      // Core the sampling task is pinned to
+    #define FLOW_SAMPLING_TASK_STACK_SIZE 3072  // Sampling task stack size (bytes)
+    #define FLOW_RATE_FAST_WINDOW_MS 100   // Pulse span used for the fast flow rate estimate (ms)
+    #define FLOW_RATE_EWMA_TAU_MS 250      // Time constant of the smoothed flow rate (ms)
+    #define FLOW_RATE_STOP_TIMEOUT_MS 500  // No pulse for this long = flow stopped (ms)
 
     // WiFi Provisioning Configuration
     #define USE_IMPROV_WIFI 0  // Set to 1 to enable Improv WiFi BLE provisioning, 0 to disable (Arduino: edit this file)
     #define IMPROV_START_BY_DEFAULT 0  // Set to 1 to start Improv by default, 0 to start only on connection failure (Arduino: edit this file)
     #define IMPROV_WIFI_TIMEOUT_MS 300000  // 5 minutes timeout for Improv WiFi provisioning (Arduino: edit this file)
+    #define IMPROV_RELEASE_BLE_MEMORY_ENABLED 1  // Free BLE memory once WiFi is up or provisioning times out (Arduino: edit this file)
     #define USE_SAVED_CREDENTIALS 1  // Set to 1 to use saved credentials from EEPROM, 0 to always use secrets.h
 
     // Cost configuration (for pouring mode)
@@ -215,6 +596,38 @@
     // Finished screen timeout
     #define FINISHED_SCREEN_TIMEOUT_SEC 5  // Default timeout in seconds before returning to QR code screen
 
+    // Pour valve (solenoid) configuration
+    #define POUR_VALVE_ENABLED 1             // Set to 1 to drive a valve, 0 if no valve is fitted
+    #define POUR_VALVE_PIN 27                // GPIO27 (SPI peripheral CS, free when no SPI device is fitted)
+    #define POUR_VALVE_ACTIVE_HIGH 1         // 1 = HIGH opens the valve, 0 = LOW opens the valve
+    #define POUR_VALVE_PIN_2 18              // Tap 2 valve (used when FLOW_TAP_COUNT >= 2)
+    #define POUR_VALVE_PIN_3 19              // Tap 3 valve (used when FLOW_TAP_COUNT >= 3)
+    #define POUR_VALVE_PIN_4 23              // Tap 4 valve (used when FLOW_TAP_COUNT >= 4)
+    #define POUR_STOP_LATENCY_DEFAULT_MS 80  // Initial valve stop latency before learning (ms)
+    #define POUR_TELEMETRY_ENABLED 1         // Batched pour telemetry (telemetry/pour, telemetry/pour_summary)
+    #define POUR_TELEMETRY_SAMPLE_MS 250     // Pour telemetry sample period (ms)
+    #define POUR_TELEMETRY_BATCH_SEC 5       // One telemetry message per this many seconds of pour
+    #define FLOW_STATS_ENABLED 1             // Per-tap flow analytics windows (telemetry/flow_stats)
+    #define FLOW_STATS_WINDOW_SEC 900        // Flow analytics window length (seconds)
+
+    // Diagnostics
+    #define PERF_MONITOR_ENABLED 1       // Frame timing profiler ("perf" serial command, telemetry/perf topic)
+    #define PERF_REPORT_INTERVAL_SEC 0   // Periodic profiler report interval in seconds (0 = on request only)
+    #define BOOT_PROFILE_ENABLED 1       // Boot phase profiler (telemetry/boot topic)
+    #define BOOT_PROFILE_HISTORY 8       // Past boots kept in NVS
+    #define HEALTH_MONITOR_ENABLED 1     // Heap/stack watermarks ("health" serial command, telemetry/health topic)
+    #define HEALTH_MONITOR_INTERVAL_SEC 60   // Health sample interval (seconds)
+    #define HEALTH_MONITOR_DELTA_BYTES 512   // Heap change before it is re-sent (bytes)
+    #define HEALTH_MONITOR_FULL_EVERY 60     // Full snapshot after this many delta reports
+    #define LOG_SINK_ENABLED 1           // Log through a ring buffer drained by a low-priority task
+    #define LOG_SINK_BUFFER_SIZE 8192    // Log ring buffer size (bytes)
+    #define LOG_RING_ENABLED 1           // Binary log ring in RTC memory (commands/logs, "logs" serial command)
+    #define LOG_RING_SIZE 3072           // Log ring size (bytes of RTC slow memory)
+    #define LOG_RING_LEVEL 3             // Record up to this level (1=E, 2=W, 3=I, 4=D, 5=V)
+    #define LOG_HOT_PATH_ENABLED 1       // Per-message / per-pour detail logging (ESP_LOGI_HOT)
+    #define PULSE_TRACE_ENABLED 1        // Flow pulse trace capture (commands/trace, "trace" serial command)
+    #define PULSE_TRACE_BUFFER_SIZE 8192 // Pulse trace buffer (bytes of internal RAM, 2-3 per edge)
+
     // Development Options
     #define DEBUG_QR_TAP_TO_POUR 0  // Set to 1 to enable QR code tap to pour for debugging
     #define DEBUG_POURING_TAP_TO_FINISHED 0  // Set to 1 to enable pouring screen tap to finished for debugging
@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Board Profile
+ * 
+ * Panel geometry, rotation, pins and default touch calibration of the board
+ * the firmware is built for, as one constexpr object the display and touch
+ * drivers read instead of the loose config.h values. Everything derived from
+ * it (MADCTL, the default touch matrix, which GPIO register a pin lives in)
+ * is worked out by the compiler, so pin writes in the drivers become single
+ * GPIO.out_w1ts / out_w1tc stores and a second hardware revision is another
+ * profile rather than runtime branches.
+ * 
+ * Pins, geometry and rotation come from Kconfig (config.h); the touch range
+ * below is the ESP32-32E 2.8" board's. Another board revision changes those,
+ * the drivers stay as they are.
+ */
+
+#ifndef BOARD_PROFILE_H
+#define BOARD_PROFILE_H
+
+#include "config.h"
+
+#include <stdint.h>
+
+// ILI9341 MADCTL bits
+#define BOARD_MADCTL_MY  0x80  // Row address order
+#define BOARD_MADCTL_MX  0x40  // Column address order
+#define BOARD_MADCTL_MV  0x20  // Row/column exchange
+#define BOARD_MADCTL_BGR 0x08  // BGR colour order
+
+// Default calibration: raw XPT2046 range (0-4095) covering the panel, used
+// until a 3-point calibration is stored in NVS
+#define BOARD_TOUCH_X_MIN 100
+#define BOARD_TOUCH_X_MAX 4000
+#define BOARD_TOUCH_Y_MIN 100
+#define BOARD_TOUCH_Y_MAX 4000
+
+typedef struct {
+    // Panel
+    uint16_t width;
+    uint16_t height;
+    uint8_t rotation;      // 0=portrait, 1=landscape (USB right), 2=portrait, 3=landscape (USB left)
+    bool bgr;              // Panel wired for BGR colour order
+    
+    // LCD SPI bus and control pins
+    int8_t tft_mosi;
+    int8_t tft_miso;
+    int8_t tft_sclk;
+    int8_t tft_cs;
+    int8_t tft_dc;
+    int8_t tft_rst;
+    int8_t tft_bl;
+    
+    // Touch SPI bus and PENIRQ (-1 = no IRQ pin)
+    int8_t touch_sclk;
+    int8_t touch_mosi;
+    int8_t touch_miso;
+    int8_t touch_cs;
+    int8_t touch_irq;
+    
+    // Raw touch range for the default calibration
+    uint16_t touch_x_min;
+    uint16_t touch_x_max;
+    uint16_t touch_y_min;
+    uint16_t touch_y_max;
+} board_profile_t;
+
+static constexpr board_profile_t BOARD = {
+    DISPLAY_WIDTH, DISPLAY_HEIGHT, DISPLAY_ROTATION, true,
+    TFT_MOSI, TFT_MISO, TFT_SCLK, TFT_CS, TFT_DC, TFT_RST, TFT_BL,
+    TOUCH_SCLK, TOUCH_MOSI, TOUCH_MISO, TOUCH_CS, TOUCH_IRQ,
+    BOARD_TOUCH_X_MIN, BOARD_TOUCH_X_MAX, BOARD_TOUCH_Y_MIN, BOARD_TOUCH_Y_MAX,
+};
+
+static_assert(BOARD.rotation <= 3, "DISPLAY_ROTATION must be 0-3");
+static_assert(BOARD.touch_x_max > BOARD.touch_x_min && BOARD.touch_y_max > BOARD.touch_y_min,
+              "Touch calibration range is empty");
+
+/**
+ * MADCTL for the profile's rotation
+ * The panel is driven at a fixed width x height, so the portrait rotations
+ * keep the landscape scan (as the TFT_eSPI setup this replaced did)
+ */
+static constexpr uint8_t board_madctl(const board_profile_t& b) {
+    return (uint8_t)((b.rotation == 3 ? (BOARD_MADCTL_MX | BOARD_MADCTL_MY | BOARD_MADCTL_MV) : BOARD_MADCTL_MV) |
+                     (b.bgr ? BOARD_MADCTL_BGR : 0));
+}
+
+// Input-only pins on the ESP32 (no pull-ups, no output)
+static constexpr bool board_pin_input_only(int pin) {
+    return pin >= 34 && pin <= 39;
+}
+
+#endif // BOARD_PROFILE_H
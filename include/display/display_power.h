@@ -0,0 +1,65 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Display Power Management
+ * 
+ * LEDC PWM backlight with idle dimming and panel sleep.
+ * 
+ * - Active: backlight at DISPLAY_BACKLIGHT_LEVEL
+ * - Dimmed: after DISPLAY_DIM_TIMEOUT_SEC without activity, faded down to
+ *   DISPLAY_DIM_LEVEL
+ * - Asleep: after DISPLAY_SLEEP_TIMEOUT_SEC the backlight is off, the panel is
+ *   in SLPIN (GRAM kept) and the UI task stops rendering
+ * 
+ * Activity is a touch or a screen change command (e.g. a paid MQTT command);
+ * the display never dims during a pour. A timeout of 0 disables that step.
+ * Call everything from the UI task. Compiles to stubs with
+ * DISPLAY_POWER_ENABLED 0 (backlight driven full on by GPIO).
+ */
+
+#ifndef DISPLAY_POWER_H
+#define DISPLAY_POWER_H
+
+#include "config.h"
+
+#if DISPLAY_POWER_ENABLED
+
+/**
+ * Take over TFT_BL with LEDC PWM at full brightness
+ */
+void display_power_init();
+
+/**
+ * Report user activity: restores full brightness, wakes the panel if asleep
+ * @return false if the display was asleep (the waking touch should be ignored)
+ */
+bool display_power_activity();
+
+/**
+ * Apply the inactivity timeouts (call every UI task pass)
+ * @param hold_awake Treat as activity (e.g. a pour is running)
+ * @return true if the display is awake and should be rendered
+ */
+bool display_power_update(bool hold_awake);
+
+/**
+ * True while the panel is asleep
+ */
+bool display_power_is_asleep();
+
+#else
+
+static inline void display_power_init() {}
+static inline bool display_power_activity() { return true; }
+static inline bool display_power_update(bool hold_awake) { (void)hold_awake; return true; }
+static inline bool display_power_is_asleep() { return false; }
+
+#endif // DISPLAY_POWER_ENABLED
+
+#endif // DISPLAY_POWER_H
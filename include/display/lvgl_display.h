@@ -18,13 +18,11 @@
 #include "config.h"
 #include <lvgl.h>
 
-// Display buffer size (adjust based on available RAM)
-// Using 1/10 of screen size for double buffering
-// LVGL draw buffer size (partial rendering).
-// Larger buffers improve responsiveness; we keep single buffering to limit DRAM.
-// Larger buffer for better responsiveness (still partial rendering).
-// Note: We keep single buffering in the driver to control DRAM usage.
-#define LVGL_BUFFER_SIZE (DISPLAY_WIDTH * DISPLAY_HEIGHT / 6)
+// LVGL draw buffer size per buffer (partial rendering).
+// Two buffers are allocated from DMA-capable RAM so LVGL renders into one while
+// the other is flushed; 1/10 of the screen each keeps the total close to the
+// previous single 1/6 buffer.
+#define LVGL_BUFFER_SIZE (DISPLAY_WIDTH * DISPLAY_HEIGHT / 10)
 
 /**
  * Initialize LVGL display driver
@@ -32,6 +30,38 @@
  */
 void lvgl_display_init();
 
+/**
+ * Put the panel to sleep (SLPIN) or wake it (SLPOUT)
+ * Blocks for the panel's settle time (120ms on wake). Don't render while asleep.
+ */
+void lvgl_display_set_sleep(bool sleep);
+
+/**
+ * Refresh at the fast rate for the next DISPLAY_REFRESH_HOLD_MS
+ * Call on touch, pour progress and screen changes (UI task)
+ */
+void lvgl_display_boost();
+
+/**
+ * Apply the adaptive refresh period, and pause the LVGL refresh timer while
+ * nothing needs redrawing
+ * Call after lv_timer_handler() so an idle UI doesn't wake every refresh period
+ */
+void lvgl_display_pause_if_idle();
+
+/**
+ * Draw an image straight to the panel, bypassing LVGL
+ * Decodes in bands of a few lines into small DMA buffers, so peak memory is a
+ * couple of scanlines instead of the whole decoded image.
+ * The area is overwritten by LVGL if it is invalidated later.
+ * @param img Image descriptor (RGB565 in panel byte order)
+ * @param is_compressed Flag indicating if image is RLE-compressed (from header define)
+ * @param x Left edge on screen
+ * @param y Top edge on screen
+ * @return true if the whole image was sent
+ */
+bool lvgl_display_stream_image(const lv_img_dsc_t *img, int is_compressed, lv_coord_t x, lv_coord_t y);
+
 /**
  * LVGL display flush callback
  * Called by LVGL to update the display (LVGL v8 API)
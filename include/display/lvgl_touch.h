@@ -18,6 +18,12 @@
 #include <lvgl.h>
 #include "config.h"
 
+// Touch point (raw XPT2046 units or display pixels)
+typedef struct {
+    int16_t x;
+    int16_t y;
+} touch_point_t;
+
 /**
  * Initialize LVGL touch input
  * Call this after initializing the touch controller
@@ -30,6 +36,12 @@ void lvgl_touch_init();
  */
 void lvgl_touch_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data);
 
+/**
+ * Resume touch polling after a PENIRQ edge (APP_EVENT_TOUCH)
+ * The read callback pauses its LVGL timer while the panel is idle
+ */
+void lvgl_touch_wake();
+
 /**
  * Update touch state (call from touch ISR or main loop)
  * Use this helper function if reading touch in your main loop
@@ -42,4 +54,24 @@ void update_touch_state(int16_t x, int16_t y, bool pressed);
  */
 bool get_touch_state(int16_t *x, int16_t *y);
 
+/**
+ * Read one filtered raw touch sample (ui/touch_cal_screen.h, UI task)
+ * @param raw Receives raw XPT2046 coordinates (0-4095)
+ * @return true if the panel is pressed and the sample is stable
+ */
+bool lvgl_touch_read_raw(touch_point_t *raw);
+
+/**
+ * Compute the 3-point affine calibration, apply it and store it in NVS (UI task)
+ * @param display Three display targets (pixels), not collinear
+ * @param raw Raw samples taken while touching each target
+ * @return true on success
+ */
+bool lvgl_touch_set_calibration(const touch_point_t display[3], const touch_point_t raw[3]);
+
+/**
+ * Restore the default calibration and erase the stored one (UI task)
+ */
+void lvgl_touch_reset_calibration();
+
 #endif // LVGL_TOUCH_H
@@ -0,0 +1,55 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * RGB565 Byte Swap
+ * 
+ * Header-only swap from LVGL native endian to the ILI9341 wire order
+ * (MSB first), used by the flush path when LV_COLOR_16_SWAP is 0. No platform
+ * dependencies so it can also be benchmarked on the host.
+ */
+
+#ifndef PIXEL_SWAP_H
+#define PIXEL_SWAP_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * Byte-swap count RGB565 pixels from src to dst
+ */
+static inline void pixel_swap_rgb565(uint16_t *dst, const uint16_t *src, size_t count) {
+    size_t i = 0;
+    
+    // Align input to 4 bytes so the bulk of the work runs on 32-bit words
+    if ((((uintptr_t)src) & 0x3) != 0 && count > 0) {
+        const uint16_t p = src[0];
+        dst[0] = (uint16_t)(((p & 0x00FF) << 8) | ((p & 0xFF00) >> 8));
+        i = 1;
+    }
+    
+    // Output stays aligned only if input was aligned from the start
+    if (i == 0) {
+        const size_t pairs = count / 2;
+        const uint32_t *in32 = (const uint32_t *)src;
+        uint32_t *out32 = (uint32_t *)dst;
+        for (size_t j = 0; j < pairs; j++) {
+            const uint32_t v = in32[j];
+            out32[j] = ((v & 0x00FF00FFu) << 8) | ((v & 0xFF00FF00u) >> 8);
+        }
+        i = pairs * 2;
+    }
+    
+    // Remaining pixels (odd tail or unaligned output)
+    for (; i < count; i++) {
+        const uint16_t p = src[i];
+        dst[i] = (uint16_t)(((p & 0x00FF) << 8) | ((p & 0xFF00) >> 8));
+    }
+}
+
+#endif // PIXEL_SWAP_H
@@ -0,0 +1,42 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Flow Calibration
+ * 
+ * Calibration pour workflow for a tap's K-factor curve (flow/k_factor.h),
+ * driven over MQTT on <prefix>/<chip_id>/commands/calibrate:
+ * 
+ *   {"action":"start","tap":0,"max_ml":1000}  free pour into a measuring jug
+ *   {"action":"finish","tap":0,"ml":982}      measured volume once it has stopped
+ *   {"action":"cancel","tap":0}               stop without adding a point
+ *   {"action":"clear","tap":0}                drop the curve (flat calibration)
+ *   {"action":"get","tap":0}                  report the curve
+ * 
+ * "finish" adds a point of K = pulses / litres at the pour's average
+ * frequency (pulses over the time with flow). Repeating the pour at a few
+ * flow rates builds the curve, which is applied at once and persisted
+ * through the config store.
+ */
+
+#ifndef FLOW_CALIBRATION_H
+#define FLOW_CALIBRATION_H
+
+#include <ArduinoJson.h>
+#include <stddef.h>
+
+#define FLOW_CALIBRATION_MIN_PULSES 100  // Shortest pour that makes a usable point (~0.2 L)
+
+/**
+ * Handle a calibrate command (any task)
+ * @param reply JSON result and the tap's curve, for telemetry/calibration
+ * @return Length of the reply, 0 if it did not fit
+ */
+size_t flow_calibration_command(JsonObjectConst cmd, char* reply, size_t size);
+
+#endif // FLOW_CALIBRATION_H
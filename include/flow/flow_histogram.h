@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Log-Bucketed Histogram
+ * 
+ * Header-only fixed-memory histogram used by the flow analytics
+ * (flow/flow_stats.h), with no platform dependencies so it can also be unit
+ * tested.
+ * 
+ * Buckets split every power of two into FLOW_HIST_SUB_BUCKETS equal parts
+ * (4-6, 6-8, 8-12, 12-16, ... with 2 per octave), so the relative
+ * resolution is the same for a trickle and a full-bore pour:
+ * - values below FLOW_HIST_SUB_BUCKETS * 2 have a bucket each
+ * - values past the last bucket are counted in it (sum keeps their real value)
+ * - flow_hist_bucket_lower() gives a bucket's lower bound for decoders
+ * 
+ * flow_hist_encode() writes only the non-empty buckets:
+ *   u8 bucket count N, then N times: u8 bucket, varint count (LEB128)
+ *   varint sum of the values
+ */
+
+#ifndef FLOW_HISTOGRAM_H
+#define FLOW_HISTOGRAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define FLOW_HIST_SUB_BITS 1                          // log2 of the sub-buckets per octave
+#define FLOW_HIST_SUB_BUCKETS (1U << FLOW_HIST_SUB_BITS)
+#define FLOW_HIST_BUCKETS 40                          // Up to ~2^20 (17 min in ms, 1 M mL/min)
+#define FLOW_HIST_ENCODED_MAX (1 + FLOW_HIST_BUCKETS * 6 + 10)
+
+typedef struct {
+    uint32_t buckets[FLOW_HIST_BUCKETS];
+    uint64_t sum;
+} flow_hist_t;
+
+// Bucket for a value
+static inline uint32_t flow_hist_bucket(uint32_t value) {
+    if (value < FLOW_HIST_SUB_BUCKETS * 2) {
+        return value;
+    }
+    uint32_t octave = 31 - (uint32_t)__builtin_clz(value);
+    uint32_t sub = (value >> (octave - FLOW_HIST_SUB_BITS)) & (FLOW_HIST_SUB_BUCKETS - 1);
+    uint32_t bucket = (octave - FLOW_HIST_SUB_BITS + 1) * FLOW_HIST_SUB_BUCKETS + sub;
+    return bucket < FLOW_HIST_BUCKETS ? bucket : FLOW_HIST_BUCKETS - 1;
+}
+
+// Smallest value in a bucket (the decoder's view of the bucket bounds)
+static inline uint32_t flow_hist_bucket_lower(uint32_t bucket) {
+    if (bucket < FLOW_HIST_SUB_BUCKETS * 2) {
+        return bucket;
+    }
+    uint32_t octave = bucket / FLOW_HIST_SUB_BUCKETS + FLOW_HIST_SUB_BITS - 1;
+    uint32_t sub = bucket & (FLOW_HIST_SUB_BUCKETS - 1);
+    return (1U << octave) + (sub << (octave - FLOW_HIST_SUB_BITS));
+}
+
+static inline void flow_hist_add(flow_hist_t* h, uint32_t value) {
+    h->buckets[flow_hist_bucket(value)]++;
+    h->sum += value;
+}
+
+static inline uint32_t flow_hist_count(const flow_hist_t* h) {
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < FLOW_HIST_BUCKETS; i++) {
+        count += h->buckets[i];
+    }
+    return count;
+}
+
+// Append an unsigned LEB128 varint, returns the bytes written
+static inline size_t flow_hist_put_varint(uint8_t* out, uint64_t value) {
+    size_t len = 0;
+    do {
+        uint8_t bits = value & 0x7F;
+        value >>= 7;
+        out[len++] = value ? (bits | 0x80) : bits;
+    } while (value);
+    return len;
+}
+
+// Write the non-empty buckets and the sum (out needs FLOW_HIST_ENCODED_MAX bytes), returns the length
+static inline size_t flow_hist_encode(const flow_hist_t* h, uint8_t* out) {
+    size_t len = 1;
+    uint8_t used = 0;
+    for (uint32_t i = 0; i < FLOW_HIST_BUCKETS; i++) {
+        if (h->buckets[i] == 0) {
+            continue;
+        }
+        out[len++] = (uint8_t)i;
+        len += flow_hist_put_varint(out + len, h->buckets[i]);
+        used++;
+    }
+    out[0] = used;
+    len += flow_hist_put_varint(out + len, h->sum);
+    return len;
+}
+
+#endif // FLOW_HISTOGRAM_H
@@ -9,7 +9,8 @@
 /**
  * Flow Meter Manager
  * 
- * Handles YF-S201 Hall Effect Flow Sensor reading and calculations
+ * Handles YF-S201 Hall Effect Flow Sensor reading and calculations for up to
+ * four taps (FLOW_TAP_COUNT), each with its own pin, counter and calibration
  * 
  * Specifications:
  * - Flow Rate Range: 1 to 30 liters per minute
@@ -44,22 +45,105 @@
     #include <stdint.h>
 #endif
 
-// Flow meter initialization
+#include "flow/k_factor.h"
+
+// Consistent view of one tap's flow meter, published by the sampling task
+typedef struct {
+    uint64_t pulses;              // Pulse count since last reset
+    uint64_t volume_ul;           // Volume in micro-litres since last reset (exact, from pulses and calibration)
+    float flow_rate_lpm;          // Flow rate in L/min (1 second window)
+    float total_volume_liters;    // Volume in liters since last reset (display only)
+    uint64_t timestamp_ms;        // Time the snapshot was taken (ms since boot)
+    float flow_rate_fast_lpm;     // Instantaneous flow rate from inter-pulse timing
+    float pulse_rate_fast_hz;     // Pulse frequency behind flow_rate_fast_lpm (before calibration)
+    float flow_rate_smoothed_lpm; // EWMA-smoothed fast flow rate
+    uint32_t sequence;            // Increments on every publish - unchanged means same sample
+} flow_meter_snapshot_t;
+
+// All functions below address one tap (0 .. FLOW_TAP_COUNT - 1); an invalid tap
+// reads as zero and is otherwise ignored
+
+// Flow meter initialization for every tap (starts the sampling task if enabled)
 void flow_meter_init();
 
-// Flow meter update (call in main loop)
+// Flow meter update for every tap (call in main loop - no-op while the sampling task is running)
 void flow_meter_update();
 
+// Get a consistent snapshot of pulses, rate, volume and timestamp (never blocks)
+void flow_meter_get_snapshot(uint8_t tap, flow_meter_snapshot_t* out);
+
 // Get current flow rate in liters per minute
-float flow_meter_get_flow_rate_lpm();
+float flow_meter_get_flow_rate_lpm(uint8_t tap);
+
+// Get instantaneous flow rate in L/min (~FLOW_RATE_FAST_WINDOW_MS of pulses, drops to 0 on stop)
+float flow_meter_get_flow_rate_fast(uint8_t tap);
+
+// Get the pulse frequency (Hz) the instantaneous flow rate was computed from - independent of K
+float flow_meter_get_pulse_rate_fast(uint8_t tap);
 
-// Get total volume in liters (since last reset)
-float flow_meter_get_total_volume_liters();
+// Get EWMA-smoothed flow rate in L/min (time constant FLOW_RATE_EWMA_TAU_MS)
+float flow_meter_get_flow_rate_smoothed(uint8_t tap);
+
+// Get total volume in micro-litres (since last reset) - use this for billing
+uint64_t flow_meter_get_total_volume_ul(uint8_t tap);
+
+// Get total volume in liters (since last reset) - display only
+float flow_meter_get_total_volume_liters(uint8_t tap);
 
 // Reset total volume counter
-void flow_meter_reset_volume();
+void flow_meter_reset_volume(uint8_t tap);
 
 // Get pulse count (for debugging)
-uint64_t flow_meter_get_pulse_count();
+uint64_t flow_meter_get_pulse_count(uint8_t tap);
+
+// Set the tap's calibration (K-factor, default POUR_PULSES_PER_LITER) - change between pours
+void flow_meter_set_calibration(uint8_t tap, uint32_t pulses_per_liter);
+
+// Get the tap's calibration in pulses per litre
+uint32_t flow_meter_get_calibration(uint8_t tap);
+
+// Set the tap's K-factor curve (count 0 = flat calibration only) - change between pours
+// Invalid tables (see k_factor_valid()) are ignored; persisting it is up to the caller
+void flow_meter_set_k_table(uint8_t tap, const k_factor_table_t* table);
+
+// Get the tap's K-factor curve
+void flow_meter_get_k_table(uint8_t tap, k_factor_table_t* out);
+
+// Millilitres -> pulses on this tap (rounds up, for cut-off targets)
+// With a curve this uses its smallest K, so no flow rate pours more than ml
+uint64_t flow_meter_ml_to_pulses(uint8_t tap, uint32_t ml);
+
+// Pulses -> micro-litres on this tap (rounds down, for billing from a bare count)
+// With a curve this uses its largest K; live volume comes from the snapshot instead
+uint64_t flow_meter_pulses_to_ul(uint8_t tap, uint64_t pulses);
+
+// Start counting pulses and time with flow for a calibration pour (restarts a running capture)
+// Unaffected by flow_meter_reset_volume()
+void flow_meter_calibration_begin(uint8_t tap);
+
+// Stop the capture and read it
+// @return false if no capture was running
+bool flow_meter_calibration_end(uint8_t tap, uint64_t* pulses, uint64_t* flow_ms);
+
+// Cut-off callback - runs in ISR context (IRAM, no floats, no blocking) in the counting path
+typedef void (*flow_meter_cutoff_cb_t)(uint8_t tap, uint64_t pulses);
+
+// Arm a one-shot callback for when the tap's pulse count reaches `pulses` (NULL callback disarms)
+// ISR backend checks on every pulse; PCNT backend uses a hardware watch point
+// Re-arming with a new threshold replaces the previous one for that tap
+void flow_meter_set_cutoff(uint8_t tap, uint64_t pulses, flow_meter_cutoff_cb_t callback);
+
+// Sample callback - runs on the sampling task after each sample that changed a tap's pulse count
+typedef void (*flow_meter_sample_cb_t)(uint8_t tap, uint64_t pulses, uint64_t timestamp_ms);
+
+// Set the sample callback (NULL to clear, one callback for all taps)
+void flow_meter_set_sample_callback(flow_meter_sample_cb_t callback);
+
+// Edge hook - runs in ISR context (IRAM) on every rising edge, before the debounce
+typedef void (*flow_meter_edge_cb_t)(uint8_t tap, uint32_t time_us);
+
+// Report the tap's raw edges with their time (low 32 bits of esp_timer) for pulse traces (NULL stops)
+// ISR backend calls it from the pulse interrupt; PCNT backend adds a GPIO edge interrupt while it is set
+void flow_meter_set_edge_hook(uint8_t tap, flow_meter_edge_cb_t callback);
 
 #endif // FLOW_METER_H
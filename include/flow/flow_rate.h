@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Flow Rate Estimation Core
+ * 
+ * Header-only inter-pulse rate estimate used by flow_meter.cpp, with no
+ * platform dependencies so it can also be unit tested and benchmarked.
+ * 
+ * - The pulse ring holds the low 32 bits of time and count per stamp - only
+ *   differences are used, so wrap-around is harmless
+ * - flow_rate_select_span() picks the newest stamps spanning at least the
+ *   window (call it under the lock that protects the ring)
+ * - flow_rate_span_hz() turns that span into a pulse frequency, capped by the
+ *   quiet time since the last pulse so a slowing flow is seen at once
+ */
+
+#ifndef FLOW_RATE_H
+#define FLOW_RATE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define FLOW_PULSE_RING_SIZE 32   // Pulse timestamp ring entries (power of 2, ~140ms at 30 L/min)
+#define FLOW_PULSE_RING_MASK (FLOW_PULSE_RING_SIZE - 1)
+
+typedef struct {
+    uint32_t time_us;
+    uint32_t count;
+} pulse_stamp_t;
+
+typedef struct {
+    pulse_stamp_t newest;
+    pulse_stamp_t oldest;
+    bool have_newest;
+    bool have_pair;
+} flow_rate_span_t;
+
+/**
+ * Pick the newest pulses spanning at least window_us, ignoring gaps longer than stop_timeout_us
+ * 
+ * @param ring Pulse ring of FLOW_PULSE_RING_SIZE entries
+ * @param head Total entries written (slot = head & FLOW_PULSE_RING_MASK)
+ */
+static inline flow_rate_span_t flow_rate_select_span(const pulse_stamp_t* ring, uint32_t head,
+                                                     uint32_t window_us, uint32_t stop_timeout_us) {
+    flow_rate_span_t span = {};
+    uint32_t available = head < FLOW_PULSE_RING_SIZE ? head : FLOW_PULSE_RING_SIZE;
+    if (available == 0) {
+        return span;
+    }
+    span.newest = ring[(head - 1) & FLOW_PULSE_RING_MASK];
+    span.have_newest = true;
+    for (uint32_t back = 2; back <= available; back++) {
+        pulse_stamp_t entry = ring[(head - back) & FLOW_PULSE_RING_MASK];
+        uint32_t elapsed = span.newest.time_us - entry.time_us;
+        if (elapsed > stop_timeout_us) {
+            break;  // Belongs to an earlier burst of flow
+        }
+        span.oldest = entry;
+        span.have_pair = true;
+        if (elapsed >= window_us) {
+            break;
+        }
+    }
+    return span;
+}
+
+/**
+ * Pulse frequency (Hz) of a span, 0 when flow has stopped
+ * 
+ * @param resolution_us Stamp resolution (0 for per-pulse stamps, the sample period for PCNT)
+ */
+static inline float flow_rate_span_hz(const flow_rate_span_t* span, uint32_t now_us,
+                                      uint32_t stop_timeout_us, uint32_t resolution_us) {
+    if (!span->have_newest) {
+        return 0.0f;
+    }
+    uint32_t since_last = now_us - span->newest.time_us;
+    if (since_last > stop_timeout_us || !span->have_pair) {
+        return 0.0f;
+    }
+    uint32_t pulses = span->newest.count - span->oldest.count;
+    uint32_t elapsed = span->newest.time_us - span->oldest.time_us;
+    if (pulses == 0 || elapsed == 0) {
+        return 0.0f;
+    }
+    float hz = (float)pulses * 1000000.0f / (float)elapsed;
+    
+    // Flow slowing down: the gap since the last pulse bounds the rate from above
+    uint32_t quiet_us = since_last > resolution_us ? since_last - resolution_us : 0;
+    if (quiet_us > 0 && (uint64_t)quiet_us * pulses > elapsed) {
+        float cap = 1000000.0f / (float)quiet_us;
+        if (cap < hz) {
+            hz = cap;
+        }
+    }
+    return hz;
+}
+
+#endif // FLOW_RATE_H
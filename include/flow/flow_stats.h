@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Flow Analytics
+ * 
+ * Per-tap usage statistics aggregated on the device, so no raw samples leave
+ * it. The flow meter feeds every sampling step; each time window of
+ * FLOW_STATS_WINDOW_SEC is published as one message on
+ * prefix/chip_id/telemetry/flow_stats (QoS 0, packed binary, see below).
+ * Memory is fixed: two log-bucketed histograms (flow/flow_histogram.h) and a
+ * few counters per tap.
+ * 
+ * Pulses on a tap with no pour open while the QR code screen is shown are
+ * idle pulses (a leak, or flow nobody paid for). A run of them with no gap
+ * longer than FLOW_STATS_ANOMALY_GAP_MS is one anomaly event, logged as it
+ * starts and counted in the window.
+ * 
+ * Window format (little-endian):
+ *   u8  version (1)
+ *   u8  histogram sub-buckets per octave (FLOW_HIST_SUB_BUCKETS)
+ *   u16 window sequence (since boot)
+ *   u32 window start (Unix time, 0 if the clock was not set)
+ *   u32 window length (ms) - a window is held while offline, so it can be longer
+ *   u8  tap count, then per tap:
+ *       u8     tap
+ *       varint pulses
+ *       varint time with flow (ms)
+ *       varint pours ended
+ *       varint idle pulses
+ *       varint anomaly events
+ *       varint noise edges (ISR backend: edges dropped by the debounce, 0 with PCNT)
+ *       histogram: flow rate (mL/min), one entry per sampling step with flow
+ *       histogram: pour duration (ms), one entry per pour
+ *   (histogram encoding in flow/flow_histogram.h; varints are LEB128)
+ */
+
+#ifndef FLOW_STATS_H
+#define FLOW_STATS_H
+
+#include "config.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define FLOW_STATS_ANOMALY_GAP_MS 10000  // Idle pulses further apart than this are separate anomaly events
+
+#if FLOW_STATS_ENABLED
+
+// One sampling step of a tap (flow sampling task): new pulses and noise edges since the last step
+void flow_stats_sample(uint8_t tap, uint32_t pulses, uint32_t noise_edges, float rate_lpm, uint32_t step_ms);
+
+// A pour opened or closed on the tap - pulses in between are never idle (any task)
+void flow_stats_pour_begin(uint8_t tap);
+void flow_stats_pour_end(uint8_t tap);
+
+// The QR code screen was shown (true) or replaced (false) - any task
+void flow_stats_set_idle_screen(bool idle);
+
+// Log new anomalies and publish the window once it is due (call in main loop)
+void flow_stats_loop();
+
+#else
+
+static inline void flow_stats_sample(uint8_t tap, uint32_t pulses, uint32_t noise_edges, float rate_lpm, uint32_t step_ms) {
+    (void)tap;
+    (void)pulses;
+    (void)noise_edges;
+    (void)rate_lpm;
+    (void)step_ms;
+}
+static inline void flow_stats_pour_begin(uint8_t tap) { (void)tap; }
+static inline void flow_stats_pour_end(uint8_t tap) { (void)tap; }
+static inline void flow_stats_set_idle_screen(bool idle) { (void)idle; }
+static inline void flow_stats_loop() {}
+
+#endif // FLOW_STATS_ENABLED
+
+#endif // FLOW_STATS_H
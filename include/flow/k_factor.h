@@ -0,0 +1,162 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * K-Factor Calibration Table
+ * 
+ * The YF-S201 is not linear over 1-30 L/min: pulses per litre (the K-factor)
+ * rises with flow rate and differs from unit to unit. A tap's curve is a few
+ * measured points of K against pulse frequency, kept sorted by frequency;
+ * between points K is interpolated linearly, outside them the nearest point
+ * applies. An empty table means the tap's flat calibration.
+ * 
+ * Integer only (frequency in 0.1 Hz steps), header-only, no platform
+ * dependencies (unit tested on the host).
+ */
+
+#ifndef K_FACTOR_H
+#define K_FACTOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define K_FACTOR_MAX_POINTS 8
+#define K_FACTOR_MIN 100        // Pulses per litre accepted for a point
+#define K_FACTOR_MAX 5000
+#define K_FACTOR_MERGE_PERCENT 10  // A new point this close in frequency replaces the old one
+
+typedef struct {
+    uint16_t freq_dhz;          // Pulse frequency in 0.1 Hz (YF-S201: 7.5 Hz per L/min)
+    uint16_t pulses_per_liter;  // K measured at that frequency
+} k_factor_point_t;
+
+typedef struct {
+    uint8_t count;              // 0 = no curve, use the flat calibration
+    k_factor_point_t points[K_FACTOR_MAX_POINTS];  // Sorted by freq_dhz, strictly increasing
+} k_factor_table_t;
+
+// Frequency from pulses counted over a time (0.1 Hz, rounded)
+static inline uint32_t k_factor_freq_dhz(uint64_t pulses, uint64_t duration_ms) {
+    if (duration_ms == 0) {
+        return 0;
+    }
+    uint64_t dhz = (pulses * 10000ULL + duration_ms / 2) / duration_ms;
+    return dhz > UINT16_MAX ? UINT16_MAX : (uint32_t)dhz;
+}
+
+// K measured by one calibration pour (pulses counted for a known volume, rounded)
+static inline uint32_t k_factor_from_volume(uint64_t pulses, uint32_t ml) {
+    return ml != 0 ? (uint32_t)((pulses * 1000ULL + ml / 2) / ml) : 0;
+}
+
+// Nano-litres for pulses at k pulses per litre (rounds down by under 1 nl)
+static inline uint64_t k_factor_volume_nl(uint64_t pulses, uint32_t k) {
+    return pulses * 1000000000ULL / k;
+}
+
+// K at a frequency, default_k if the table is empty
+static inline uint32_t k_factor_lookup(const k_factor_table_t* table, uint32_t freq_dhz, uint32_t default_k) {
+    if (table->count == 0) {
+        return default_k;
+    }
+    const k_factor_point_t* p = table->points;
+    if (freq_dhz <= p[0].freq_dhz) {
+        return p[0].pulses_per_liter;
+    }
+    for (uint8_t i = 1; i < table->count; i++) {
+        if (freq_dhz <= p[i].freq_dhz) {
+            int64_t span = (int64_t)p[i].freq_dhz - p[i - 1].freq_dhz;
+            int64_t num = ((int64_t)p[i].pulses_per_liter - p[i - 1].pulses_per_liter) *
+                          ((int64_t)freq_dhz - p[i - 1].freq_dhz);
+            num += num >= 0 ? span / 2 : -span / 2;
+            return (uint32_t)((int64_t)p[i - 1].pulses_per_liter + num / span);
+        }
+    }
+    return p[table->count - 1].pulses_per_liter;
+}
+
+// Smallest and largest K anywhere on the curve (both default_k if empty)
+static inline void k_factor_range(const k_factor_table_t* table, uint32_t default_k, uint32_t* min_k, uint32_t* max_k) {
+    *min_k = table->count > 0 ? UINT32_MAX : default_k;
+    *max_k = table->count > 0 ? 0 : default_k;
+    for (uint8_t i = 0; i < table->count; i++) {
+        uint32_t k = table->points[i].pulses_per_liter;
+        *min_k = k < *min_k ? k : *min_k;
+        *max_k = k > *max_k ? k : *max_k;
+    }
+}
+
+// True if the table is usable as stored (e.g. after loading it from flash)
+static inline bool k_factor_valid(const k_factor_table_t* table) {
+    if (table->count > K_FACTOR_MAX_POINTS) {
+        return false;
+    }
+    for (uint8_t i = 0; i < table->count; i++) {
+        const k_factor_point_t* p = &table->points[i];
+        if (p->freq_dhz == 0 || p->pulses_per_liter < K_FACTOR_MIN || p->pulses_per_liter > K_FACTOR_MAX) {
+            return false;
+        }
+        if (i > 0 && p->freq_dhz <= table->points[i - 1].freq_dhz) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Add a measured point, keeping the table sorted
+ * 
+ * A point within K_FACTOR_MERGE_PERCENT of an existing frequency replaces it
+ * (re-calibration at the same rate); a full table replaces its nearest point.
+ * @return false if the point is out of range (table unchanged)
+ */
+static inline bool k_factor_insert(k_factor_table_t* table, uint32_t freq_dhz, uint32_t pulses_per_liter) {
+    if (freq_dhz == 0 || freq_dhz > UINT16_MAX || pulses_per_liter < K_FACTOR_MIN ||
+        pulses_per_liter > K_FACTOR_MAX || table->count > K_FACTOR_MAX_POINTS) {
+        return false;
+    }
+    
+    // Nearest existing point
+    int nearest = -1;
+    uint32_t nearest_distance = UINT32_MAX;
+    for (uint8_t i = 0; i < table->count; i++) {
+        uint32_t f = table->points[i].freq_dhz;
+        uint32_t distance = f > freq_dhz ? f - freq_dhz : freq_dhz - f;
+        if (distance < nearest_distance) {
+            nearest = i;
+            nearest_distance = distance;
+        }
+    }
+    
+    int slot;
+    if (nearest >= 0 && (nearest_distance * 100U <= table->points[nearest].freq_dhz * (uint32_t)K_FACTOR_MERGE_PERCENT ||
+                         table->count == K_FACTOR_MAX_POINTS)) {
+        slot = nearest;
+    } else {
+        slot = table->count++;
+    }
+    table->points[slot].freq_dhz = (uint16_t)freq_dhz;
+    table->points[slot].pulses_per_liter = (uint16_t)pulses_per_liter;
+    
+    // Move the new point to its place
+    while (slot > 0 && table->points[slot - 1].freq_dhz > table->points[slot].freq_dhz) {
+        k_factor_point_t tmp = table->points[slot - 1];
+        table->points[slot - 1] = table->points[slot];
+        table->points[slot] = tmp;
+        slot--;
+    }
+    while (slot + 1 < table->count && table->points[slot + 1].freq_dhz < table->points[slot].freq_dhz) {
+        k_factor_point_t tmp = table->points[slot + 1];
+        table->points[slot + 1] = table->points[slot];
+        table->points[slot] = tmp;
+        slot++;
+    }
+    return true;
+}
+
+#endif // K_FACTOR_H
@@ -0,0 +1,40 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Pour Checkpoint
+ * 
+ * Mirrors each tap's active pour session into RTC slow memory so a watchdog,
+ * panic or error-recovery restart mid-pour does not lose billable volume:
+ * - The session (id, price, max_ml, start time) is written when the valve opens
+ * - The pulse count is updated with a CRC32 on every flow sample - RAM only,
+ *   no flash writes
+ * - After a reset the session is closed (the valve stays shut until a new paid
+ *   command) and reported through the pour log as an interrupted pour
+ * 
+ * RTC slow memory survives software and watchdog resets but not power loss.
+ */
+
+#ifndef POUR_CHECKPOINT_H
+#define POUR_CHECKPOINT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Start tracking a pour on a tap (call when the valve opens)
+void pour_checkpoint_begin(uint8_t tap, const char* unique_id, int64_t price_micro_per_ml, uint64_t max_pulses);
+
+// The tap's pour ended normally - nothing to recover after a reset
+void pour_checkpoint_end(uint8_t tap);
+
+// Close and report pours that were interrupted by a reset (call once at boot,
+// after pour_log_init and flow_meter_init)
+// Returns true if any session was recovered
+bool pour_checkpoint_recover();
+
+#endif // POUR_CHECKPOINT_H
@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Pour Controller
+ * 
+ * Drives the solenoid valve for a paid pour and enforces max_ml, per tap
+ * (FLOW_TAP_COUNT taps, each with its own valve, cut-off and learned latency).
+ * 
+ * - The valve is closed from inside the pulse counting path (flow meter ISR or
+ *   PCNT watch point) when the count reaches the cut-off threshold
+ * - The cut-off is placed early by the predicted overshoot:
+ *   overshoot_pulses = flow rate (Hz) * stop latency
+ * - Stop latency is learned per tap from the pulses counted after each close
+ *   and persisted in NVS
+ * - start/stop may be called from any task; they are serialised with the
+ *   main loop's pour_controller_update()
+ */
+
+#ifndef POUR_CONTROLLER_H
+#define POUR_CONTROLLER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Pour controller states
+typedef enum {
+    POUR_CTRL_IDLE,      // Valve closed, no pour
+    POUR_CTRL_OPEN,      // Valve open, cut-off armed
+    POUR_CTRL_SETTLING,  // Valve closed at cut-off, waiting for flow to stop
+    POUR_CTRL_DONE       // Pour complete, final volume stable
+} pour_ctrl_state_t;
+
+// Initialize every tap's valve GPIO (closed) and load learned stop latencies from NVS
+void pour_controller_init();
+
+// Open the tap's valve and arm the cut-off for a pour of target_pulses
+void pour_controller_start(uint8_t tap, uint64_t target_pulses);
+
+// Close the tap's valve immediately (pour cancelled or replaced)
+void pour_controller_stop(uint8_t tap);
+
+// Update cut-off prediction and stop latency learning for every tap (call in main loop)
+void pour_controller_update();
+
+// Get a tap's state (POUR_CTRL_IDLE for an invalid tap)
+pour_ctrl_state_t pour_controller_get_state(uint8_t tap);
+
+// True while any tap's valve is open or settling
+bool pour_controller_any_active();
+
+// True once the tap's valve closed at the cut-off and flow has stopped
+bool pour_controller_is_complete(uint8_t tap);
+
+// Get a tap's learned stop latency in microseconds
+uint32_t pour_controller_get_stop_latency_us(uint8_t tap);
+
+#endif // POUR_CONTROLLER_H
@@ -0,0 +1,66 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Pour Log
+ * 
+ * Store-and-forward queue for completed pour records, so a pour that ends
+ * while MQTT is down is still reported:
+ * - Records are appended to a ring of fixed 256-byte slots in the "pourlog"
+ *   flash partition (config/partitions_ota.csv) - appends are O(1)
+ * - The ring erases each sector once per lap, so wear is spread evenly
+ * - A drain task publishes unacknowledged records in batches on
+ *   prefix/chip_id/telemetry/pour_summary (QoS 1) once MQTT is connected,
+ *   and marks them acknowledged in place when the broker's PUBACK arrives
+ * - Anything not acknowledged is replayed after a reboot
+ * 
+ * Payload: {"pours":[{"id":"...","seq":N,"complete":true,"pulses":N,
+ *           "volume_ul":N,"ml":N,"cost_minor":N,"start":N,"end":N,
+ *           "duration_ms":N}, ...]}
+ * start/end are Unix times (s), 0 if the clock was not set
+ * "interrupted":true is added for pours closed after a reset
+ */
+
+#ifndef POUR_LOG_H
+#define POUR_LOG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define POUR_LOG_ID_MAX 128  // Same limit as the paid command validation
+
+// One completed pour
+typedef struct {
+    char id[POUR_LOG_ID_MAX + 1];
+    uint8_t tap;             // Tap the pour ran on (0-based)
+    bool complete;           // Valve closed at max_ml (false = cancelled)
+    bool interrupted;        // Closed after a reset from the RTC checkpoint
+    uint64_t pulses;
+    uint64_t volume_ul;
+    int64_t cost_minor;
+    int64_t start_epoch;     // Unix time (s), 0 if unknown
+    int64_t end_epoch;
+    uint32_t duration_ms;
+    uint32_t seq;            // Assigned by pour_log_append()
+} pour_record_t;
+
+// Find the partition, recover the ring and start the drain task
+// Returns false if there is no pourlog partition (records are then not persisted)
+bool pour_log_init();
+
+// Append a record (assigns record->seq), returns false if it could not be stored
+bool pour_log_append(pour_record_t* record);
+
+// Records waiting for an acknowledgement
+uint32_t pour_log_pending_count();
+
+// Format records as the pour_summary payload, returns length or 0 if it does not fit
+size_t pour_log_format_json(const pour_record_t* records, size_t count, char* buf, size_t size);
+
+#endif // POUR_LOG_H
@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Pour Fixed-Point Math
+ * 
+ * Integer volume and cost accounting for billing.
+ * 
+ * Units:
+ * - Volume: pulses (exact) -> micro-litres (ul)
+ * - Price: micro currency units per ml (e.g. 0.005 GBP/ml = 5000)
+ * - Cost: minor currency units (pence/cents, 2 decimal places)
+ * 
+ * Floats only appear at the edges: parsing the MQTT price and formatting for display.
+ */
+
+#ifndef POUR_MATH_H
+#define POUR_MATH_H
+
+#include <stdint.h>
+
+// YF-S201 outputs 450 pulses per liter
+#define POUR_PULSES_PER_LITER 450
+
+// Price scale: micro currency units per ml
+#define POUR_PRICE_SCALE 1000000LL
+
+// Minor currency units per major unit (pence per pound)
+#define POUR_MINOR_PER_MAJOR 100LL
+
+// Pulses -> micro-litres for a sensor with k pulses per litre (exact to 1ul, rounds down)
+static inline uint64_t pour_pulses_to_ul_k(uint64_t pulses, uint32_t k) {
+    return pulses * 1000000ULL / k;
+}
+
+// Millilitres -> pulses needed to dispense at least that much with k pulses per litre (rounds up)
+static inline uint64_t pour_ml_to_pulses_k(uint32_t ml, uint32_t k) {
+    return ((uint64_t)ml * k + 999ULL) / 1000ULL;
+}
+
+// Pulses -> micro-litres at the nominal YF-S201 rate
+static inline uint64_t pour_pulses_to_ul(uint64_t pulses) {
+    return pour_pulses_to_ul_k(pulses, POUR_PULSES_PER_LITER);
+}
+
+// Millilitres -> pulses at the nominal YF-S201 rate
+static inline uint64_t pour_ml_to_pulses(uint32_t ml) {
+    return pour_ml_to_pulses_k(ml, POUR_PULSES_PER_LITER);
+}
+
+// Price per ml (float from MQTT) -> micro units per ml, rounded to nearest
+static inline int64_t pour_price_from_float(float cost_per_ml) {
+    double scaled = (double)cost_per_ml * (double)POUR_PRICE_SCALE;
+    return (int64_t)(scaled >= 0.0 ? scaled + 0.5 : scaled - 0.5);
+}
+
+// Cost in minor units for a volume, rounded half up
+// ul * micro/ml / 1000 (ul->ml) / 1e6 (micro->major) * 100 (major->minor) = ul * micro / 1e7
+static inline int64_t pour_cost_minor_units(uint64_t volume_ul, int64_t price_micro_per_ml) {
+    const int64_t divisor = 1000LL * POUR_PRICE_SCALE / POUR_MINOR_PER_MAJOR;
+    return ((int64_t)volume_ul * price_micro_per_ml + divisor / 2) / divisor;
+}
+
+#endif // POUR_MATH_H
@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Pour Session Engine
+ * 
+ * Owns each tap's paid pour from start to report, independent of the screen:
+ * 
+ *   IDLE -> ARMED      paid command accepted, checkpoint written, valve open
+ *   ARMED -> POURING   first pulse counted
+ *   -> STOPPING        valve closed at the max_ml cut-off or by a cancel
+ *   STOPPING -> SETTLED  flow has stopped (or SESSION_SETTLE_TIMEOUT_US),
+ *                      final volume and cost fixed
+ *   SETTLED -> REPORTED  summary handed to telemetry / the pour log,
+ *                      checkpoint closed
+ * 
+ * Volume and cost are accumulated here in fixed point (flow/pour_math.h) on
+ * every flow sample. Renderers read pour_session_get() and wake on
+ * APP_EVENT_POUR; the listener is told about every state change.
+ * 
+ * pour_session_start()/pour_session_stop() may be called from any task: they
+ * are queued and applied by pour_session_update() on the main loop, the task
+ * that also runs the valve controller.
+ */
+
+#ifndef POUR_SESSION_H
+#define POUR_SESSION_H
+
+#include "config.h"
+#include "flow/pour_log.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define POUR_SESSION_CURRENCY_SIZE 8
+
+typedef enum {
+    POUR_SESSION_IDLE,      // No pour on this tap
+    POUR_SESSION_ARMED,     // Valve open, no flow yet
+    POUR_SESSION_POURING,   // Flow counted
+    POUR_SESSION_STOPPING,  // Valve closed, waiting for the flow to stop
+    POUR_SESSION_SETTLED,   // Final volume and cost fixed
+    POUR_SESSION_REPORTED   // Summary handed over, ready for the next pour
+} pour_session_state_t;
+
+// One tap's session as the renderers see it
+typedef struct {
+    pour_session_state_t state;
+    uint32_t sequence;             // Changes whenever anything below does
+    char id[POUR_LOG_ID_MAX + 1];
+    char currency[POUR_SESSION_CURRENCY_SIZE];  // Display symbol (the device default if none was sent)
+    int64_t price_micro_per_ml;
+    uint32_t max_ml;
+    uint64_t volume_ul;
+    int64_t cost_minor;            // Minor currency units for volume_ul
+    float flow_rate_lpm;           // Display only
+    bool complete;                 // max_ml reached (valid once SETTLED)
+} pour_session_info_t;
+
+// State change notification (main loop task)
+typedef void (*pour_session_listener_t)(uint8_t tap, pour_session_state_t state);
+
+/**
+ * Set the state change listener (call before the first pour)
+ */
+void pour_session_set_listener(pour_session_listener_t listener);
+
+/**
+ * Queue a new pour on a tap (any task); a pour still running on the tap is
+ * stopped and reported as incomplete first
+ * @return false for an invalid tap
+ */
+bool pour_session_start(uint8_t tap, const char* unique_id, float cost_per_ml, int max_ml, const char* currency);
+
+/**
+ * Queue a cancel (any task): the valve closes and the pour is billed for
+ * what was poured
+ */
+void pour_session_stop(uint8_t tap);
+
+/**
+ * Apply queued requests, accumulate and advance the state machines
+ * (call in main loop, after pour_controller_update())
+ */
+void pour_session_update();
+
+/**
+ * Copy of a tap's session (any task)
+ * @return false for an invalid tap
+ */
+bool pour_session_get(uint8_t tap, pour_session_info_t* info);
+
+/**
+ * True while any tap is between ARMED and SETTLED
+ */
+bool pour_session_any_active();
+
+/**
+ * State name for logs
+ */
+const char* pour_session_state_name(pour_session_state_t state);
+
+#endif // POUR_SESSION_H
@@ -0,0 +1,67 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Pour Telemetry
+ * 
+ * Samples the flow meter during a pour and publishes the samples in batches,
+ * one message per POUR_TELEMETRY_BATCH_SEC instead of one per sample (each
+ * tap is tracked on its own, so pours on different taps may overlap):
+ * - prefix/chip_id/telemetry/pour (QoS 0, packed binary, see below)
+ * - prefix/chip_id/telemetry/pour_summary (QoS 1, JSON) when the pour ends,
+ *   sent through the pour log so it survives being offline (see pour_log.h)
+ * 
+ * Batch format (little-endian):
+ *   u8  version (1)
+ *   u8  id length N, then N bytes of the paid command id
+ *   u16 batch sequence (0 = first batch of the pour)
+ *   u16 sample period (ms)
+ *   u32 time of the first sample (ms since the pour started)
+ *   u32 volume before the first sample (ul)
+ *   u16 sample count, then per sample:
+ *       varint volume delta since the previous sample (ul, LEB128)
+ *       u16    flow rate (mL/min)
+ */
+
+#ifndef POUR_TELEMETRY_H
+#define POUR_TELEMETRY_H
+
+#include "config.h"
+#include "flow/pour_log.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if POUR_TELEMETRY_ENABLED
+
+// Start collecting for a pour on a tap (call when the valve opens, any task)
+void pour_telemetry_begin(uint8_t tap, const char* unique_id, int64_t price_micro_per_ml);
+
+// End the tap's pour - the summary is published from pour_telemetry_loop() (any task)
+void pour_telemetry_end(uint8_t tap, bool complete);
+
+// Sample, batch and publish (call in main loop)
+void pour_telemetry_loop();
+
+// Report a finished pour - stored in the pour log, or held in RAM until published
+void pour_telemetry_report(pour_record_t* record);
+
+#else
+
+static inline void pour_telemetry_begin(uint8_t tap, const char* unique_id, int64_t price_micro_per_ml) {
+    (void)tap;
+    (void)unique_id;
+    (void)price_micro_per_ml;
+}
+static inline void pour_telemetry_end(uint8_t tap, bool complete) { (void)tap; (void)complete; }
+static inline void pour_telemetry_loop() {}
+static inline void pour_telemetry_report(pour_record_t* record) { pour_log_append(record); }
+
+#endif // POUR_TELEMETRY_ENABLED
+
+#endif // POUR_TELEMETRY_H
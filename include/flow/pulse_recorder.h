@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Pulse Recorder
+ * 
+ * Captures one tap's raw flow meter edges as a pulse trace (flow/pulse_trace.h)
+ * so a field problem can be replayed on the bench, driven over MQTT on
+ * <prefix>/<chip_id>/commands/trace or the "trace" serial command:
+ * 
+ *   {"action":"start","tap":0}   clear the buffer and record the tap's edges
+ *   {"action":"stop"}            stop recording (the trace is kept)
+ *   {"action":"dump"}            send the trace on telemetry/trace
+ *   {"action":"status"}          report the capture
+ * 
+ * Recording stops taking edges once the PULSE_TRACE_BUFFER_SIZE buffer is
+ * full (the trace is marked truncated). The dump is the trace image in
+ * binary chunks of u32 offset, u32 total size, then up to
+ * PULSE_TRACE_CHUNK_SIZE bytes; the serial dump prints the same bytes as
+ * "trace <offset> <hex>" lines for tools/pulse_trace.py.
+ * 
+ * Compiles to stubs with PULSE_TRACE_ENABLED 0.
+ */
+
+#ifndef PULSE_RECORDER_H
+#define PULSE_RECORDER_H
+
+#include "config.h"
+
+#include <ArduinoJson.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define PULSE_TRACE_CHUNK_SIZE 2048  // Trace bytes per telemetry/trace message
+
+#if PULSE_TRACE_ENABLED
+
+// Allocate the trace buffer (internal RAM, the edge interrupt runs from IRAM)
+bool pulse_recorder_init();
+
+// Start a new trace on a tap (replaces the previous trace)
+bool pulse_recorder_start(uint8_t tap);
+
+// Stop recording, keeping the trace for a dump
+void pulse_recorder_stop();
+
+/**
+ * Handle a trace command (any task)
+ * @param reply JSON result and capture status, for telemetry/trace_status
+ * @return Length of the reply, 0 if it did not fit
+ */
+size_t pulse_recorder_command(JsonObjectConst cmd, char* reply, size_t size);
+
+// Print the capture status to the log
+void pulse_recorder_log_status();
+
+// Print the trace as hex lines on the console (serial "trace dump")
+void pulse_recorder_print_dump();
+
+#else
+
+static inline bool pulse_recorder_init() { return true; }
+static inline bool pulse_recorder_start(uint8_t tap) { (void)tap; return false; }
+static inline void pulse_recorder_stop() {}
+static inline size_t pulse_recorder_command(JsonObjectConst cmd, char* reply, size_t size) {
+    (void)cmd; (void)reply; (void)size; return 0;
+}
+static inline void pulse_recorder_log_status() {}
+static inline void pulse_recorder_print_dump() {}
+
+#endif // PULSE_TRACE_ENABLED
+
+#endif // PULSE_RECORDER_H
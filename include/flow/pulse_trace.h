@@ -0,0 +1,162 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Pulse Trace Format
+ * 
+ * Raw flow meter edge times from a real pour, recorded on the device
+ * (flow/pulse_recorder.h) and replayed on the host through the flow meter
+ * and pour controller code (test/test_trace_replay_native).
+ * 
+ *   header   24 bytes: magic, version, tap, flags, K at record time,
+ *            edge count, first edge time, data length
+ *   data     per edge: time since the previous edge in us (LEB128 varint,
+ *            0 for the first), 2 bytes above ~8 L/min on a YF-S201
+ *            and 3 bytes below
+ * 
+ * Edges are recorded before any debounce or glitch filtering, so a replay
+ * sees the same bounce and noise as the device did. Little-endian,
+ * header-only, no platform dependencies (unit tested on the host).
+ */
+
+#ifndef PULSE_TRACE_H
+#define PULSE_TRACE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define PULSE_TRACE_MAGIC 0x43525450UL  // "PTRC"
+#define PULSE_TRACE_VERSION 1
+#define PULSE_TRACE_MAX_VARINT 5        // Bytes for a 32-bit delta
+
+#define PULSE_TRACE_FLAG_TRUNCATED 0x01 // Buffer filled, later edges were dropped
+#define PULSE_TRACE_FLAG_PCNT 0x02      // Recorded alongside the PCNT backend
+
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t tap;
+    uint8_t flags;              // PULSE_TRACE_FLAG_*
+    uint8_t reserved;
+    uint32_t pulses_per_liter;  // Flat calibration when recorded
+    uint32_t count;             // Edges
+    uint32_t first_us;          // First edge (low 32 bits of esp_timer)
+    uint32_t data_len;          // Delta bytes after the header
+} pulse_trace_header_t;
+
+// Recording state: header plus the caller's data buffer
+typedef struct {
+    pulse_trace_header_t header;
+    uint8_t* data;
+    uint32_t capacity;
+    uint32_t last_us;
+} pulse_trace_t;
+
+// Reading state over a complete trace image (header then data)
+typedef struct {
+    const uint8_t* data;
+    uint32_t len;
+    uint32_t pos;
+    uint32_t remaining;         // Edges not yet read
+    uint32_t time_us;           // Last edge read (low 32 bits of esp_timer)
+    uint64_t elapsed_us;        // Last edge read, since the first
+} pulse_trace_reader_t;
+
+static inline void pulse_trace_init(pulse_trace_t* t, uint8_t* data, uint32_t capacity,
+                                    uint8_t tap, uint8_t flags, uint32_t pulses_per_liter) {
+    memset(&t->header, 0, sizeof(t->header));
+    t->header.magic = PULSE_TRACE_MAGIC;
+    t->header.version = PULSE_TRACE_VERSION;
+    t->header.tap = tap;
+    t->header.flags = flags;
+    t->header.pulses_per_liter = pulses_per_liter;
+    t->data = data;
+    t->capacity = capacity;
+    t->last_us = 0;
+}
+
+/**
+ * Add an edge (shifts only, always inlined so an IRAM interrupt handler can call it)
+ * @return false once the buffer is full (the trace is marked truncated)
+ */
+static inline __attribute__((always_inline)) bool pulse_trace_append(pulse_trace_t* t, uint32_t time_us) {
+    if (t->header.flags & PULSE_TRACE_FLAG_TRUNCATED) {
+        return false;
+    }
+    if (t->header.data_len + PULSE_TRACE_MAX_VARINT > t->capacity) {
+        t->header.flags |= PULSE_TRACE_FLAG_TRUNCATED;
+        return false;
+    }
+    if (t->header.count == 0) {
+        t->header.first_us = time_us;
+        t->last_us = time_us;
+    }
+    uint32_t delta = time_us - t->last_us;  // Wraps safely
+    uint8_t* p = t->data + t->header.data_len;
+    while (delta >= 0x80) {
+        *p++ = (uint8_t)(delta | 0x80);
+        delta >>= 7;
+    }
+    *p++ = (uint8_t)delta;
+    t->header.data_len = (uint32_t)(p - t->data);
+    t->header.count++;
+    t->last_us = time_us;
+    return true;
+}
+
+/**
+ * Open a trace image (e.g. a dump read back from a file)
+ * @param size Bytes available at image
+ * @return false if the header is invalid or the data is cut short
+ */
+static inline bool pulse_trace_reader_init(pulse_trace_reader_t* r, const uint8_t* image, size_t size) {
+    pulse_trace_header_t header;
+    if (size < sizeof(header)) {
+        return false;
+    }
+    memcpy(&header, image, sizeof(header));
+    if (header.magic != PULSE_TRACE_MAGIC || header.version != PULSE_TRACE_VERSION ||
+        header.data_len > size - sizeof(header)) {
+        return false;
+    }
+    r->data = image + sizeof(header);
+    r->len = header.data_len;
+    r->pos = 0;
+    r->remaining = header.count;
+    r->time_us = header.first_us;
+    r->elapsed_us = 0;
+    return true;
+}
+
+// Next edge time, false at the end (or on a malformed varint)
+static inline bool pulse_trace_next(pulse_trace_reader_t* r, uint32_t* time_us) {
+    if (r->remaining == 0) {
+        return false;
+    }
+    uint32_t delta = 0;
+    for (int shift = 0; ; shift += 7) {
+        if (r->pos >= r->len || shift > 28) {
+            r->remaining = 0;
+            return false;
+        }
+        uint8_t b = r->data[r->pos++];
+        delta |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+            break;
+        }
+    }
+    r->remaining--;
+    r->time_us += delta;
+    r->elapsed_us += delta;
+    *time_us = r->time_us;
+    return true;
+}
+
+#endif // PULSE_TRACE_H
@@ -1,8 +1,8 @@
 /**
  * Precision Pour Logo
  * Generated from: precision_pour_logo.png
- * Format: RGB565, Size: 259x40
- * Compression: RLE (compressed size: 9186 bytes, original: 20720 bytes)
+ * Format: RGB565 (byte-swapped), Size: 259x40
+ * Compression: RLE (compressed size: 9188 bytes, original: 20720 bytes)
  */
 
 #ifndef PRECISION_POUR_LOGO_H
@@ -10,587 +10,592 @@
 
 #include <lvgl.h>
 
+// Pixel byte order: LV_COLOR_16_SWAP 1
+#if LV_COLOR_16_SWAP != 1
+#error "precision_pour_logo byte order does not match LV_COLOR_16_SWAP - regenerate the image header"
+#endif
+
 // RLE-compressed image data
 // Use rle_decompress_image() to decompress before use
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wmissing-field-initializers"
 
 const uint8_t precision_pour_logo_data[] = {
-    0xFF, 0x12, 0x00, 0xA4, 0x41, 0x45, 0x62, 0x45, 0x5A, 0xA4, 0x39, 0xFF, 0xFF, 0x00, 0xFF, 0xFD,
-    0x00, 0xA5, 0x6A, 0x88, 0xBC, 0xC8, 0xCC, 0xC8, 0xCC, 0x87, 0xC4, 0xC5, 0x72, 0xFF, 0x14, 0x00,
-    0x86, 0x31, 0x86, 0x31, 0xFF, 0x06, 0x00, 0x86, 0x31, 0xA6, 0x31, 0xA6, 0x31, 0xFF, 0x18, 0x00,
-    0x86, 0x31, 0xA6, 0x31, 0xA6, 0x31, 0xA6, 0x31, 0x86, 0x31, 0xFF, 0x12, 0x00, 0x86, 0x31, 0x86,
-    0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0xA6, 0x31, 0xA6, 0x31, 0x86, 0x31, 0xFF,
-    0x18, 0x00, 0xE7, 0x39, 0xAA, 0x52, 0xEB, 0x5A, 0xAA, 0x52, 0xE7, 0x39, 0xFF, 0x12, 0x00, 0x86,
-    0x31, 0xFF, 0x10, 0x00, 0xE7, 0x39, 0x6A, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0x8A, 0x52, 0xC7, 0x39,
-    0xFF, 0x0C, 0x00, 0x86, 0x31, 0x86, 0x31, 0xA6, 0x31, 0x86, 0x31, 0xFF, 0x12, 0x00, 0xE7, 0x39,
-    0x69, 0x52, 0xAA, 0x52, 0xAA, 0x52, 0x49, 0x4A, 0xA6, 0x31, 0xFF, 0x12, 0x00, 0xA6, 0x31, 0xC7,
-    0x39, 0xC7, 0x39, 0xFF, 0x0E, 0x00, 0x86, 0x31, 0xC7, 0x39, 0xC7, 0x39, 0xC7, 0x39, 0xFF, 0x16,
-    0x00, 0x86, 0x31, 0xC7, 0x39, 0xC7, 0x39, 0xC7, 0x39, 0xC7, 0x39, 0xA6, 0x31, 0xA6, 0x31, 0xA6,
-    0x31, 0x86, 0x31, 0xFF, 0x1A, 0x00, 0xE7, 0x39, 0xAA, 0x52, 0xCB, 0x5A, 0x8A, 0x52, 0xE7, 0x39,
-    0xFF, 0x14, 0x00, 0x85, 0x31, 0x00, 0x00, 0x85, 0x31, 0xFF, 0x1E, 0x00, 0x86, 0x31, 0x86, 0x31,
-    0x86, 0x31, 0x86, 0x31, 0xA6, 0x31, 0xA6, 0x31, 0xA6, 0x31, 0x86, 0x31, 0xFF, 0x48, 0x00, 0xC4,
-    0x41, 0x07, 0xAC, 0xA6, 0x9B, 0xC8, 0xCC, 0xC8, 0xCC, 0xE8, 0xCC, 0xC8, 0xCC, 0x25, 0x52, 0xFF,
-    0x10, 0x00, 0xC7, 0x39, 0x59, 0xCE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBB, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE,
-    0xFB, 0xDE, 0xFB, 0xDE, 0x79, 0xCE, 0x55, 0xAD, 0x6D, 0x6B, 0xFF, 0x0A, 0x00, 0x2C, 0x63, 0xBA,
-    0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xDA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0x18,
-    0xC6, 0xB2, 0x94, 0x8A, 0x52, 0xFF, 0x0A, 0x00, 0x8A, 0x52, 0x9A, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE,
-    0xBA, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xDA, 0xD6, 0xDB, 0xDE, 0xBA, 0xD6, 0xBA, 0xD6, 0x9A, 0xD6,
-    0x58, 0xC6, 0x28, 0x42, 0xFF, 0x0A, 0x00, 0xA7, 0x31, 0xCF, 0x7B, 0xF7, 0xBD, 0x1C, 0xE7, 0x7E,
-    0xF7, 0xBE, 0xF7, 0x9E, 0xF7, 0x1C, 0xE7, 0x96, 0xB5, 0x2C, 0x63, 0xFF, 0x08, 0x00, 0xEB, 0x5A,
-    0x9A, 0xCE, 0x9A, 0xD6, 0xBA, 0xD6, 0x96, 0xB5, 0x85, 0x29, 0xFF, 0x08, 0x00, 0x6D, 0x6B, 0xD7,
-    0xBD, 0x1C, 0xE7, 0x9E, 0xEF, 0xBE, 0xF7, 0xBE, 0xF7, 0x7D, 0xEF, 0xDB, 0xDE, 0x55, 0xAD, 0x0C,
-    0x63, 0xFF, 0x06, 0x00, 0x49, 0x4A, 0x79, 0xCE, 0xBA, 0xD6, 0xDB, 0xD6, 0x18, 0xC6, 0xA7, 0x31,
-    0xFF, 0x0C, 0x00, 0x4D, 0x6B, 0x96, 0xB5, 0x1C, 0xE7, 0x9E, 0xF7, 0xBE, 0xEF, 0xBE, 0xEF, 0x7D,
-    0xEF, 0x9A, 0xD6, 0x92, 0x94, 0x08, 0x42, 0xFF, 0x0C, 0x00, 0x30, 0x84, 0xFB, 0xDE, 0xFB, 0xDE,
-    0xDB, 0xDE, 0x8E, 0x73, 0xFF, 0x0C, 0x00, 0x14, 0xA5, 0x1C, 0xDF, 0xFB, 0xDE, 0xFB, 0xDE, 0x8E,
-    0x73, 0xFF, 0x14, 0x00, 0x75, 0xAD, 0x1C, 0xE7, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE,
-    0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xD7, 0xBD, 0x10, 0x84, 0xC7, 0x39, 0xFF, 0x10, 0x00, 0x2C,
-    0x63, 0x76, 0xAD, 0x1C, 0xDF, 0x9E, 0xF7, 0xBE, 0xF7, 0x9E, 0xF7, 0x3C, 0xE7, 0x38, 0xC6, 0x10,
-    0x84, 0xC7, 0x39, 0xFF, 0x0C, 0x00, 0xD6, 0xB5, 0xDB, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0x0B, 0x5B,
-    0xFF, 0x0A, 0x00, 0x0C, 0x63, 0x9A, 0xD6, 0x9A, 0xD6, 0xBB, 0xD6, 0x34, 0xA5, 0xFF, 0x06, 0x00,
-    0x30, 0x84, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE,
-    0xDA, 0xD6, 0x18, 0xC6, 0x92, 0x94, 0x49, 0x4A, 0xFF, 0x42, 0x00, 0xC5, 0x72, 0xE5, 0x7A, 0xC4,
-    0x49, 0xA8, 0xC4, 0xE8, 0xCC, 0xE8, 0xCC, 0x08, 0xD5, 0x46, 0x8B, 0xFF, 0x10, 0x00, 0xC7, 0x39,
-    0x1C, 0xE7, 0xFF, 0x12, 0xFF, 0xBE, 0xF7, 0xF7, 0xBD, 0x29, 0x42, 0xFF, 0x06, 0x00, 0xCF, 0x7B,
-    0xFF, 0x14, 0xFF, 0x5D, 0xEF, 0xF4, 0xA4, 0x86, 0x31, 0xFF, 0x06, 0x00, 0xEB, 0x5A, 0xBE, 0xF7,
-    0xFF, 0x14, 0xFF, 0x9E, 0xF7, 0x89, 0x52, 0xFF, 0x08, 0x00, 0xCB, 0x5A, 0x79, 0xCE, 0xFF, 0x10,
-    0xFF, 0xBE, 0xF7, 0x34, 0xA5, 0xC7, 0x39, 0xFF, 0x04, 0x00, 0x6D, 0x6B, 0xDF, 0xF7, 0xFF, 0x04,
-    0xFF, 0xBA, 0xD6, 0x86, 0x31, 0xFF, 0x04, 0x00, 0x86, 0x31, 0xF3, 0x9C, 0xBE, 0xF7, 0xFF, 0x10,
-    0xFF, 0x5D, 0xEF, 0xAA, 0x52, 0xFF, 0x04, 0x00, 0xAA, 0x52, 0x9E, 0xF7, 0xFF, 0x04, 0xFF, 0x3C,
-    0xE7, 0xE7, 0x39, 0xFF, 0x08, 0x00, 0xA6, 0x31, 0x34, 0xA5, 0xBE, 0xF7, 0xFF, 0x10, 0xFF, 0xBA,
-    0xD6, 0x2C, 0x63, 0xFF, 0x0A, 0x00, 0xD3, 0x9C, 0xFF, 0x06, 0xFF, 0x3C, 0xE7, 0xEB, 0x5A, 0xFF,
-    0x0A, 0x00, 0xB6, 0xB5, 0xFF, 0x06, 0xFF, 0x10, 0x84, 0xFF, 0x14, 0x00, 0x38, 0xC6, 0xFF, 0x13,
-    0xFF, 0xF7, 0xBA, 0xD6, 0x2C, 0x63, 0xFF, 0x0A, 0x00, 0x28, 0x42, 0xB6, 0xB5, 0x9E, 0xF7, 0xFF,
-    0x10, 0xFF, 0x9A, 0xCE, 0xCB, 0x5A, 0xFF, 0x08, 0x00, 0x85, 0x29, 0xDB, 0xD6, 0xFF, 0x06, 0xFF,
-    0x6D, 0x6B, 0xFF, 0x0A, 0x00, 0x6D, 0x6B, 0xDF, 0xFF, 0x05, 0xFF, 0x18, 0xBE, 0xFF, 0x06, 0x00,
-    0xB2, 0x94, 0xFF, 0x14, 0xFF, 0x5D, 0xE7, 0x51, 0x8C, 0xFF, 0x40, 0x00, 0x05, 0x83, 0xA5, 0x6A,
-    0x65, 0x62, 0xC8, 0xCC, 0xE8, 0xCC, 0xE8, 0xCC, 0x08, 0xD5, 0xA7, 0x93, 0xFF, 0x10, 0x00, 0xA6,
-    0x31, 0xFB, 0xDE, 0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x0D, 0xFF, 0xDF, 0xFF,
-    0x00, 0xFF, 0x00, 0xFF, 0x00, 0x9A, 0xD6, 0x07, 0x42, 0xFF, 0x04, 0x00, 0xCF, 0x7B, 0xFF, 0x10,
-    0xFF, 0xDF, 0xFF, 0x00, 0xDF, 0xF7, 0xDF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x55, 0xAD, 0xFF,
-    0x06, 0x00, 0xCB, 0x5A, 0xBE, 0xF7, 0xFF, 0x08, 0xFF, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x09, 0xFF,
-    0xBE, 0xF7, 0xAA, 0x52, 0xFF, 0x06, 0x00, 0xAA, 0x52, 0x1C, 0xE7, 0xFF, 0x16, 0xFF, 0x55, 0xA5,
-    0xFF, 0x04, 0x00, 0x6D, 0x6B, 0xDF, 0xF7, 0xFF, 0x04, 0xFF, 0xBA, 0xD6, 0x86, 0x31, 0xFF, 0x04,
-    0x00, 0xCF, 0x7B, 0xDF, 0xFF, 0x07, 0xFF, 0xDF, 0xFF, 0x00, 0xBE, 0xF7, 0xBE, 0xF7, 0xFF, 0x06,
-    0xFF, 0xBA, 0xD6, 0xA6, 0x31, 0xFF, 0x04, 0x00, 0xCB, 0x5A, 0xBE, 0xF7, 0xFF, 0x04, 0xFF, 0x3C,
-    0xE7, 0x08, 0x42, 0xFF, 0x06, 0x00, 0xA6, 0x31, 0xD7, 0xBD, 0xFF, 0x16, 0xFF, 0x5D, 0xE7, 0x8E,
-    0x73, 0xFF, 0x08, 0x00, 0x14, 0xA5, 0xFF, 0x08, 0xFF, 0xBA, 0xD6, 0x28, 0x42, 0xFF, 0x08, 0x00,
-    0xB6, 0xB5, 0xFF, 0x06, 0xFF, 0x30, 0x84, 0xFF, 0x14, 0x00, 0x18, 0xC6, 0xFF, 0x13, 0xFF, 0xF7,
-    0xFF, 0x00, 0xFF, 0x00, 0x5D, 0xEF, 0xEB, 0x5A, 0xFF, 0x06, 0x00, 0x28, 0x42, 0x79, 0xCE, 0xFF,
-    0x16, 0xFF, 0x3C, 0xE7, 0xEB, 0x5A, 0xFF, 0x06, 0x00, 0x86, 0x31, 0xDB, 0xDE, 0xFF, 0x06, 0xFF,
-    0x6D, 0x6B, 0xFF, 0x0A, 0x00, 0x6D, 0x6B, 0xDF, 0xFF, 0x05, 0xFF, 0x17, 0xBE, 0xFF, 0x06, 0x00,
-    0x92, 0x94, 0xFF, 0x12, 0xFF, 0xDF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0x51,
-    0x8C, 0xFF, 0x3E, 0x00, 0xE5, 0x7A, 0xC5, 0x72, 0x85, 0x62, 0xC8, 0xCC, 0xE8, 0xCC, 0xE8, 0xCC,
-    0x09, 0xD5, 0x87, 0x93, 0xFF, 0x10, 0x00, 0x86, 0x31, 0xDB, 0xDE, 0xDF, 0xFF, 0x00, 0xDF, 0xFF,
-    0x00, 0xBE, 0xF7, 0x14, 0xA5, 0x30, 0x84, 0x51, 0x8C, 0x92, 0x94, 0x38, 0xC6, 0xDF, 0xF7, 0xDF,
-    0xFF, 0x05, 0xFF, 0xB2, 0x94, 0xFF, 0x04, 0x00, 0xAE, 0x73, 0xFF, 0x06, 0xFF, 0x1C, 0xE7, 0x71,
-    0x8C, 0x30, 0x84, 0x30, 0x84, 0x92, 0x94, 0x7A, 0xCE, 0xDF, 0xFF, 0x05, 0xFF, 0xBE, 0xF7, 0xEC,
-    0x62, 0xFF, 0x04, 0x00, 0xAA, 0x52, 0x9E, 0xF7, 0xFF, 0x04, 0xFF, 0x9D, 0xEF, 0x71, 0x8C, 0xCE,
-    0x73, 0xCF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x30, 0x84, 0x30, 0x84, 0x10, 0x84, 0xC7, 0x39, 0xFF,
-    0x04, 0x00, 0xA7, 0x39, 0x79, 0xCE, 0xFF, 0x06, 0xFF, 0xDF, 0xFF, 0x00, 0x38, 0xC6, 0x51, 0x8C,
-    0xAE, 0x73, 0x51, 0x8C, 0x38, 0xC6, 0xDE, 0xF7, 0xFF, 0x00, 0xFF, 0x00, 0x3C, 0xE7, 0x6D, 0x6B,
-    0xFF, 0x04, 0x00, 0x8E, 0x73, 0xDF, 0xFF, 0x05, 0xFF, 0x9A, 0xD6, 0xFF, 0x06, 0x00, 0x17, 0xC6,
-    0xFF, 0x04, 0xFF, 0xDF, 0xFF, 0x00, 0x38, 0xC6, 0x6D, 0x6B, 0xCB, 0x5A, 0xEB, 0x5A, 0xAE, 0x73,
-    0x34, 0xA5, 0xFB, 0xDE, 0xD2, 0x94, 0xFF, 0x06, 0x00, 0xCB, 0x5A, 0xBE, 0xF7, 0xFF, 0x04, 0xFF,
-    0x3C, 0xE7, 0x08, 0x42, 0xFF, 0x06, 0x00, 0x55, 0xA5, 0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xFF, 0x05,
-    0xFF, 0xDB, 0xDE, 0xD3, 0x9C, 0xEF, 0x7B, 0x30, 0x84, 0xD6, 0xBD, 0x9E, 0xEF, 0xFF, 0x00, 0xF7,
-    0xFF, 0x00, 0xF7, 0xFF, 0x00, 0xF7, 0x3C, 0xE7, 0xAA, 0x52, 0xFF, 0x06, 0x00, 0x14, 0xA5, 0xFF,
-    0x0A, 0xFF, 0xD7, 0xBD, 0x85, 0x31, 0xFF, 0x06, 0x00, 0xD6, 0xB5, 0xFF, 0x06, 0xFF, 0x30, 0x84,
-    0xFF, 0x14, 0x00, 0xF8, 0xBD, 0xFF, 0x06, 0xFF, 0xF7, 0xBD, 0x30, 0x84, 0x30, 0x84, 0x51, 0x8C,
-    0x55, 0xAD, 0x7D, 0xEF, 0xFF, 0x06, 0xFF, 0xB6, 0xB5, 0xFF, 0x06, 0x00, 0x96, 0xB5, 0xFF, 0x08,
-    0xFF, 0x79, 0xCE, 0x51, 0x8C, 0x8E, 0x73, 0x30, 0x84, 0xF7, 0xBD, 0xBE, 0xF7, 0xFF, 0x06, 0xFF,
-    0xBA, 0xD6, 0xC7, 0x39, 0xFF, 0x04, 0x00, 0xC7, 0x31, 0xFB, 0xDE, 0xFF, 0x04, 0xFF, 0xDF, 0xFF,
-    0x00, 0x4D, 0x6B, 0xFF, 0x0A, 0x00, 0xAE, 0x73, 0xFF, 0x06, 0xFF, 0x18, 0xC6, 0xFF, 0x06, 0x00,
-    0x92, 0x94, 0xFF, 0x06, 0xFF, 0x9A, 0xD6, 0xEF, 0x7B, 0xEF, 0x7B, 0xEF, 0x7B, 0xB2, 0x94, 0xDB,
-    0xDE, 0xFF, 0x06, 0xFF, 0x1C, 0xE7, 0x08, 0x42, 0xFF, 0x3C, 0x00, 0xC5, 0x72, 0x05, 0x83, 0x65,
-    0x62, 0xC8, 0xCC, 0xC8, 0xCC, 0xE8, 0xCC, 0x08, 0xD5, 0x46, 0x83, 0xFF, 0x10, 0x00, 0x86, 0x31,
-    0xDB, 0xDE, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0x9E, 0xF7, 0xAA, 0x52, 0xC3, 0x18, 0xE3, 0x18,
-    0xE3, 0x18, 0x65, 0x29, 0x96, 0xB5, 0xFF, 0x06, 0xFF, 0x58, 0xC6, 0xFF, 0x04, 0x00, 0x8E, 0x6B,
-    0xDF, 0xF7, 0xFF, 0x04, 0xFF, 0x79, 0xCE, 0x45, 0x29, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0x08,
-    0x42, 0xBA, 0xD6, 0xFF, 0x06, 0xFF, 0x92, 0x94, 0xFF, 0x04, 0x00, 0x8A, 0x52, 0x7E, 0xEF, 0xFF,
-    0x04, 0xFF, 0x3C, 0xE7, 0xC7, 0x39, 0xFF, 0x14, 0x00, 0x92, 0x94, 0xDF, 0xFF, 0x00, 0xDF, 0xFF,
-    0x00, 0xDF, 0xFF, 0x00, 0x9E, 0xF7, 0x71, 0x8C, 0x86, 0x31, 0xFF, 0x08, 0x00, 0x71, 0x8C, 0xBA,
-    0xD6, 0xEB, 0x5A, 0xFF, 0x06, 0x00, 0x6D, 0x6B, 0xDF, 0xFF, 0x05, 0xFF, 0x9A, 0xD6, 0xFF, 0x04,
-    0x00, 0x86, 0x31, 0xBA, 0xD6, 0xFF, 0x04, 0xFF, 0xDF, 0xFF, 0x00, 0x6D, 0x6B, 0xFF, 0x0A, 0x00,
-    0xE7, 0x39, 0xE7, 0x39, 0xFF, 0x06, 0x00, 0xCB, 0x5A, 0xBE, 0xF7, 0xFF, 0x04, 0xFF, 0x3C, 0xE7,
-    0x28, 0x42, 0xFF, 0x04, 0x00, 0x2D, 0x6B, 0xBE, 0xF7, 0xFF, 0x04, 0xFF, 0xDF, 0xF7, 0x75, 0xAD,
-    0xC7, 0x39, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x24, 0x21, 0x8D, 0x6B, 0x5D, 0xE7, 0xFF, 0x00,
-    0xF7, 0xFF, 0x04, 0xFF, 0xB6, 0xB5, 0xFF, 0x06, 0x00, 0x34, 0xA5, 0xFF, 0x0A, 0xFF, 0xDF, 0xF7,
-    0xF3, 0x9C, 0xFF, 0x06, 0x00, 0xD7, 0xBD, 0xFF, 0x06, 0xFF, 0x10, 0x84, 0xFF, 0x14, 0x00, 0xF8,
-    0xBD, 0xFF, 0x06, 0xFF, 0x51, 0x8C, 0xE3, 0x18, 0x04, 0x21, 0x04, 0x21, 0x24, 0x21, 0x0F, 0x84,
-    0xDF, 0xF7, 0xFF, 0x04, 0xFF, 0x1C, 0xDF, 0xC6, 0x31, 0x00, 0x00, 0x2C, 0x63, 0x9E, 0xF7, 0xFF,
-    0x06, 0xFF, 0x55, 0xAD, 0xA6, 0x31, 0xC3, 0x18, 0xC3, 0x18, 0xE3, 0x18, 0x45, 0x29, 0xCF, 0x7B,
-    0x7D, 0xEF, 0xFF, 0x00, 0xF7, 0xDF, 0xF7, 0xFF, 0x00, 0xFF, 0x00, 0xD2, 0x94, 0xFF, 0x04, 0x00,
-    0xC7, 0x39, 0xFB, 0xDE, 0xFF, 0x04, 0xFF, 0xDF, 0xFF, 0x00, 0x2C, 0x63, 0xFF, 0x0A, 0x00, 0xAE,
-    0x73, 0xFF, 0x06, 0xFF, 0x38, 0xC6, 0xFF, 0x06, 0x00, 0xB2, 0x94, 0xFF, 0x06, 0xFF, 0x75, 0xAD,
-    0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xC2, 0x18, 0xAA, 0x52, 0x5D, 0xEF, 0xFF, 0x06, 0xFF, 0x6D,
-    0x6B, 0xFF, 0x3C, 0x00, 0xA5, 0x6A, 0x46, 0x8B, 0x65, 0x62, 0xA8, 0xCC, 0xC8, 0xCC, 0xC8, 0xCC,
-    0xE8, 0xCC, 0x06, 0x7B, 0xFF, 0x10, 0x00, 0x86, 0x31, 0xDB, 0xDE, 0xFF, 0x00, 0xFF, 0x00, 0xDF,
-    0xFF, 0x00, 0x9E, 0xF7, 0xCB, 0x52, 0xC3, 0x18, 0xE3, 0x18, 0x03, 0x21, 0xE3, 0x18, 0x6D, 0x6B,
-    0xDF, 0xFF, 0x05, 0xFF, 0xBA, 0xD6, 0xFF, 0x04, 0x00, 0x6D, 0x6B, 0xBF, 0xF7, 0xDF, 0xFF, 0x00,
-    0xFF, 0x00, 0xFF, 0x00, 0x9A, 0xCE, 0x45, 0x29, 0xE3, 0x18, 0xE3, 0x18, 0x04, 0x21, 0x04, 0x21,
-    0x14, 0xA5, 0xFF, 0x06, 0xFF, 0x14, 0xA5, 0xFF, 0x04, 0x00, 0x69, 0x4A, 0x7D, 0xEF, 0xDF, 0xFF,
-    0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3C, 0xE7, 0xE7, 0x39, 0xFF, 0x12, 0x00, 0xC7, 0x39, 0xDB, 0xDE,
-    0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xF4, 0x9C, 0xFF, 0x0E, 0x00, 0xC7,
-    0x39, 0xFF, 0x08, 0x00, 0x6D, 0x6B, 0xDF, 0xFF, 0x05, 0xFF, 0x9A, 0xD6, 0x86, 0x31, 0x00, 0x00,
-    0x86, 0x31, 0x9A, 0xD6, 0xFF, 0x06, 0xFF, 0xF7, 0xBD, 0xAA, 0x5A, 0x86, 0x31, 0xFF, 0x10, 0x00,
-    0xCB, 0x5A, 0xBE, 0xF7, 0xFF, 0x04, 0xFF, 0x3C, 0xE7, 0x08, 0x42, 0xFF, 0x04, 0x00, 0x75, 0xAD,
-    0xFF, 0x06, 0xFF, 0x79, 0xCE, 0xA6, 0x31, 0xE3, 0x18, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0xE3,
-    0x18, 0xE3, 0x18, 0x50, 0x8C, 0xFF, 0x00, 0xF7, 0xFF, 0x04, 0xFF, 0x5D, 0xEF, 0x69, 0x4A, 0xFF,
-    0x04, 0x00, 0x14, 0xA5, 0xFF, 0x07, 0xFF, 0xF7, 0xFF, 0x04, 0xFF, 0xBE, 0xF7, 0x10, 0x84, 0xFF,
-    0x04, 0x00, 0xF7, 0xBD, 0xFF, 0x06, 0xFF, 0x10, 0x84, 0xFF, 0x14, 0x00, 0x18, 0xBE, 0xFF, 0x06,
-    0xFF, 0x50, 0x84, 0xE3, 0x18, 0x04, 0x21, 0x24, 0x21, 0x04, 0x21, 0x28, 0x42, 0x5C, 0xE7, 0xFF,
-    0x04, 0xFF, 0x7D, 0xEF, 0x49, 0x42, 0x00, 0x00, 0x76, 0xAD, 0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xFF,
-    0x00, 0xFF, 0x00, 0xFF, 0x00, 0x59, 0xCE, 0xA6, 0x31, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04,
-    0x21, 0xE3, 0x18, 0xE3, 0x18, 0xB2, 0x94, 0xFF, 0x06, 0xFF, 0xFB, 0xDE, 0xE7, 0x39, 0x00, 0x00,
-    0xE7, 0x39, 0xFB, 0xDE, 0xFF, 0x04, 0xFF, 0xBF, 0xF7, 0x2C, 0x63, 0xFF, 0x0A, 0x00, 0xCF, 0x7B,
-    0xFF, 0x06, 0xFF, 0x58, 0xC6, 0xFF, 0x06, 0x00, 0xB2, 0x94, 0xFF, 0x06, 0xFF, 0x75, 0xAD, 0xE3,
-    0x18, 0xE3, 0x18, 0xE3, 0x18, 0xE3, 0x18, 0x45, 0x29, 0x38, 0xC6, 0xFF, 0x06, 0xFF, 0xF0, 0x7B,
-    0xFF, 0x3C, 0x00, 0x65, 0x62, 0xA6, 0x9B, 0x65, 0x62, 0xA7, 0xC4, 0xA7, 0xCC, 0xC8, 0xCC, 0xC8,
-    0xCC, 0x85, 0x62, 0xFF, 0x10, 0x00, 0x86, 0x31, 0xDB, 0xDE, 0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xFF,
-    0x00, 0x9E, 0xF7, 0xAA, 0x52, 0xA2, 0x10, 0xC3, 0x18, 0xE3, 0x18, 0xC3, 0x18, 0x8E, 0x73, 0xFF,
-    0x06, 0xFF, 0xBA, 0xD6, 0xFF, 0x04, 0x00, 0x6D, 0x6B, 0xBF, 0xF7, 0xDF, 0xFF, 0x00, 0xFF, 0x00,
-    0xFF, 0x00, 0x79, 0xCE, 0x45, 0x29, 0xC3, 0x18, 0xE3, 0x18, 0x04, 0x21, 0x04, 0x21, 0x55, 0xAD,
-    0xFF, 0x06, 0xFF, 0xD3, 0x9C, 0xFF, 0x04, 0x00, 0x8A, 0x52, 0x9E, 0xEF, 0xFF, 0x04, 0xFF, 0x9E,
-    0xEF, 0xB6, 0xB5, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x55, 0xAD, 0x49,
-    0x4A, 0xFF, 0x04, 0x00, 0xCB, 0x5A, 0xBE, 0xF7, 0xFF, 0x04, 0xFF, 0x9D, 0xEF, 0x8A, 0x52, 0xFF,
-    0x18, 0x00, 0x6D, 0x6B, 0xDF, 0xFF, 0x05, 0xFF, 0xBA, 0xD6, 0x86, 0x31, 0xFF, 0x04, 0x00, 0x34,
-    0xAD, 0xFF, 0x08, 0xFF, 0x9D, 0xEF, 0x59, 0xCE, 0xF3, 0x9C, 0x6D, 0x6B, 0x08, 0x42, 0xFF, 0x0A,
-    0x00, 0xCB, 0x5A, 0x9E, 0xF7, 0xFF, 0x04, 0xFF, 0x3C, 0xE7, 0xE7, 0x39, 0x00, 0x00, 0xA6, 0x31,
-    0xBA, 0xD6, 0xFF, 0x06, 0xFF, 0x51, 0x8C, 0xE3, 0x18, 0x04, 0x21, 0x24, 0x21, 0x04, 0x21, 0x04,
-    0x21, 0x04, 0x21, 0xE3, 0x18, 0x08, 0x42, 0x3C, 0xE7, 0xFF, 0x06, 0xFF, 0x8E, 0x73, 0xFF, 0x04,
-    0x00, 0xF3, 0xA4, 0xFF, 0x05, 0xFF, 0xF7, 0xBE, 0xF7, 0xDF, 0xF7, 0xFF, 0x04, 0xFF, 0x7D, 0xEF,
-    0x2C, 0x63, 0x00, 0x00, 0xF7, 0xBD, 0xFF, 0x06, 0xFF, 0xEF, 0x7B, 0xFF, 0x14, 0x00, 0x18, 0xC6,
-    0xFF, 0x06, 0xFF, 0x30, 0x84, 0xC3, 0x18, 0x03, 0x19, 0x04, 0x21, 0x03, 0x19, 0x69, 0x4A, 0x7D,
-    0xEF, 0xFF, 0x04, 0xFF, 0x7D, 0xEF, 0x49, 0x42, 0x86, 0x31, 0xDB, 0xDE, 0xFF, 0x00, 0xFF, 0x00,
-    0xDF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xCF, 0x7B, 0xE4, 0x20, 0x04, 0x21, 0x04, 0x21, 0x04,
-    0x21, 0x04, 0x21, 0xE3, 0x18, 0xC3, 0x18, 0x49, 0x4A, 0x7D, 0xEF, 0xFF, 0x04, 0xFF, 0xBE, 0xF7,
-    0x0C, 0x5B, 0x00, 0x00, 0xC7, 0x39, 0xFB, 0xDE, 0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xBF,
-    0xF7, 0x2C, 0x63, 0xFF, 0x0A, 0x00, 0xAE, 0x73, 0xFF, 0x06, 0xFF, 0x59, 0xCE, 0xFF, 0x06, 0x00,
-    0xD3, 0x9C, 0xFF, 0x06, 0xFF, 0x75, 0xAD, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xE3, 0x18, 0x45,
-    0x29, 0x79, 0xCE, 0xFF, 0x06, 0xFF, 0xCF, 0x7B, 0xFF, 0x3C, 0x00, 0x05, 0x52, 0x67, 0xBC, 0x27,
-    0xAC, 0xA7, 0xC4, 0xA7, 0xC4, 0xA7, 0xC4, 0xA7, 0xC4, 0x04, 0x52, 0xFF, 0x10, 0x00, 0xA6, 0x31,
-    0xFB, 0xDE, 0xFF, 0x04, 0xFF, 0x9E, 0xEF, 0xAA, 0x52, 0xA2, 0x10, 0xC3, 0x18, 0xE3, 0x18, 0xE7,
-    0x39, 0x18, 0xC6, 0xFF, 0x06, 0xFF, 0xF7, 0xBD, 0xFF, 0x04, 0x00, 0x8E, 0x6B, 0xDF, 0xFF, 0x00,
-    0xDF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x79, 0xCE, 0x45, 0x29, 0xE3, 0x18, 0xE4, 0x18, 0x24,
-    0x21, 0xEB, 0x5A, 0x1C, 0xE7, 0xFF, 0x06, 0xFF, 0xCF, 0x7B, 0xFF, 0x04, 0x00, 0xAA, 0x52, 0x9E,
-    0xEF, 0xFF, 0x04, 0xFF, 0xDF, 0xFF, 0x0D, 0xFF, 0xDF, 0xFF, 0x00, 0x0C, 0x63, 0xFF, 0x04, 0x00,
-    0x2D, 0x6B, 0xDF, 0xFF, 0x05, 0xFF, 0x1C, 0xE7, 0xE7, 0x39, 0xFF, 0x18, 0x00, 0x8E, 0x73, 0xDF,
-    0xFF, 0x05, 0xFF, 0xBA, 0xD6, 0xA6, 0x31, 0xFF, 0x04, 0x00, 0x69, 0x4A, 0xBA, 0xD6, 0xFF, 0x0C,
-    0xFF, 0xDE, 0xF7, 0x3C, 0xE7, 0x96, 0xB5, 0xCB, 0x5A, 0xFF, 0x06, 0x00, 0xCB, 0x5A, 0x9E, 0xF7,
-    0xFF, 0x04, 0xFF, 0xFC, 0xDE, 0xC7, 0x39, 0x00, 0x00, 0xE7, 0x39, 0x1C, 0xE7, 0xFF, 0x04, 0xFF,
-    0xDF, 0xFF, 0x00, 0x4D, 0x6B, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04,
-    0x21, 0x24, 0x21, 0x86, 0x31, 0x9A, 0xD6, 0xFF, 0x06, 0xFF, 0x10, 0x84, 0xFF, 0x04, 0x00, 0xD3,
-    0x9C, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF7, 0xFF, 0x00, 0xF7, 0xD7, 0xBD, 0x59, 0xCE, 0xFF,
-    0x06, 0xFF, 0xDB, 0xD6, 0x8A, 0x4A, 0xF7, 0xBD, 0xFF, 0x06, 0xFF, 0xEF, 0x7B, 0xFF, 0x14, 0x00,
-    0x38, 0xC6, 0xFF, 0x06, 0xFF, 0x30, 0x84, 0xC3, 0x18, 0xE3, 0x18, 0x04, 0x21, 0xC7, 0x39, 0x55,
-    0xAD, 0xFF, 0x06, 0xFF, 0xDB, 0xD6, 0xA6, 0x31, 0x28, 0x42, 0x5D, 0xEF, 0xFF, 0x04, 0xFF, 0x9E,
-    0xF7, 0xAA, 0x52, 0xE3, 0x18, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x03, 0x21, 0xE3,
-    0x18, 0xA6, 0x31, 0xFB, 0xDE, 0xFF, 0x06, 0xFF, 0x8E, 0x73, 0x00, 0x00, 0xA6, 0x31, 0xDB, 0xD6,
-    0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xBF, 0xF7, 0x2C, 0x6B, 0xFF, 0x0A, 0x00, 0x8E, 0x73,
-    0xFF, 0x06, 0xFF, 0x59, 0xCE, 0xFF, 0x06, 0x00, 0xD3, 0x9C, 0xFF, 0x06, 0xFF, 0x75, 0xAD, 0xE3,
-    0x18, 0xC3, 0x18, 0xE3, 0x18, 0x04, 0x21, 0x8E, 0x73, 0x9E, 0xF7, 0xFF, 0x04, 0xFF, 0xBE, 0xF7,
-    0xCB, 0x5A, 0xFF, 0x3C, 0x00, 0xA4, 0x39, 0x88, 0xBC, 0xC7, 0xCC, 0xA7, 0xC4, 0xA7, 0xC4, 0xA7,
-    0xC4, 0x67, 0xBC, 0xA3, 0x39, 0xFF, 0x10, 0x00, 0xC7, 0x39, 0x1C, 0xE7, 0xFF, 0x04, 0xFF, 0xBF,
-    0xF7, 0xF7, 0xBD, 0x55, 0xA5, 0x55, 0xAD, 0xB6, 0xB5, 0xFB, 0xDE, 0xDF, 0xF7, 0xFF, 0x06, 0xFF,
-    0xEF, 0x7B, 0xFF, 0x04, 0x00, 0xAE, 0x73, 0xFF, 0x04, 0xFF, 0xDF, 0xFF, 0x00, 0x5D, 0xEF, 0xB7,
-    0xB5, 0x96, 0xAD, 0x96, 0xB5, 0x18, 0xBE, 0x5D, 0xEF, 0xDF, 0xFF, 0x05, 0xFF, 0x1B, 0xE7, 0x08,
-    0x42, 0xFF, 0x04, 0x00, 0xCA, 0x52, 0xBE, 0xF7, 0xFF, 0x12, 0xFF, 0xDF, 0xFF, 0x00, 0x0C, 0x63,
-    0xFF, 0x04, 0x00, 0x2C, 0x63, 0xDF, 0xFF, 0x05, 0xFF, 0x1C, 0xE7, 0xE7, 0x39, 0xFF, 0x18, 0x00,
-    0x8E, 0x73, 0xFF, 0x06, 0xFF, 0xBA, 0xD6, 0xA6, 0x31, 0xFF, 0x06, 0x00, 0x48, 0x4A, 0x34, 0xA5,
-    0x3C, 0xE7, 0xDF, 0xF7, 0xFF, 0x0C, 0xFF, 0x3C, 0xE7, 0x4D, 0x6B, 0xFF, 0x04, 0x00, 0xAA, 0x52,
-    0x9E, 0xF7, 0xFF, 0x04, 0xFF, 0xFB, 0xDE, 0xC7, 0x39, 0x00, 0x00, 0xC7, 0x39, 0xFB, 0xDE, 0xFF,
-    0x04, 0xFF, 0xDF, 0xFF, 0x00, 0x4D, 0x6B, 0x04, 0x21, 0x24, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04,
-    0x21, 0x24, 0x21, 0x24, 0x21, 0xA6, 0x31, 0x9A, 0xD6, 0xFF, 0x04, 0xFF, 0xDF, 0xFF, 0x00, 0xEF,
-    0x7B, 0xFF, 0x04, 0x00, 0xD2, 0x9C, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF7, 0xFF, 0x00, 0xFF,
-    0x00, 0x13, 0x9D, 0xCA, 0x5A, 0x3C, 0xE7, 0xFF, 0x06, 0xFF, 0x18, 0xC6, 0x79, 0xCE, 0xFF, 0x06,
-    0xFF, 0xEF, 0x7B, 0xFF, 0x14, 0x00, 0x38, 0xC6, 0xFF, 0x06, 0xFF, 0x99, 0xCE, 0x54, 0xA5, 0x55,
-    0xAD, 0xB6, 0xB5, 0xDB, 0xDE, 0xFF, 0x08, 0xFF, 0xF3, 0x9C, 0x00, 0x00, 0x28, 0x42, 0x7D, 0xEF,
-    0xFF, 0x04, 0xFF, 0xBE, 0xF7, 0xAA, 0x52, 0xC3, 0x18, 0xE3, 0x20, 0x04, 0x21, 0x04, 0x21, 0x04,
-    0x21, 0x04, 0x21, 0x03, 0x21, 0xC6, 0x39, 0xFB, 0xDE, 0xFF, 0x06, 0xFF, 0x8E, 0x73, 0xFF, 0x04,
-    0x00, 0xBB, 0xD6, 0xFF, 0x04, 0xFF, 0xDF, 0xFF, 0x00, 0x4D, 0x6B, 0xFF, 0x0A, 0x00, 0x8E, 0x73,
-    0xFF, 0x06, 0xFF, 0x59, 0xCE, 0xFF, 0x06, 0x00, 0xD3, 0x9C, 0xFF, 0x06, 0xFF, 0x1C, 0xDF, 0x96,
-    0xB5, 0x75, 0xAD, 0x75, 0xAD, 0x18, 0xBE, 0x7D, 0xEF, 0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xFF, 0x00,
-    0xFF, 0x00, 0xFF, 0x00, 0x59, 0xC6, 0xFF, 0x3E, 0x00, 0x44, 0x31, 0x47, 0xB4, 0xC8, 0xCC, 0xA7,
-    0xC4, 0xA7, 0xC4, 0xA7, 0xC4, 0x27, 0xB4, 0x43, 0x29, 0xFF, 0x10, 0x00, 0xC7, 0x39, 0x1C, 0xE7,
-    0xFF, 0x04, 0xFF, 0xDF, 0xFF, 0x00, 0xDF, 0xF7, 0xDF, 0xFF, 0x05, 0xFF, 0xDF, 0xFF, 0x00, 0xDF,
-    0xF7, 0xFF, 0x04, 0xFF, 0xD7, 0xBD, 0x86, 0x31, 0xFF, 0x04, 0x00, 0xCF, 0x7B, 0xFF, 0x04, 0xFF,
-    0xDF, 0xFF, 0x00, 0xDF, 0xF7, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x05, 0xFF, 0xDF, 0xFF, 0x00, 0xDF,
-    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x9E, 0xF7, 0xCF, 0x7B, 0xFF, 0x06, 0x00, 0xCB, 0x5A, 0xBE,
-    0xF7, 0xFF, 0x04, 0xFF, 0xBE, 0xF7, 0x55, 0xAD, 0xD3, 0x9C, 0xD3, 0x9C, 0xD3, 0x94, 0xD3, 0x9C,
-    0xB3, 0x9C, 0xB2, 0x94, 0x28, 0x42, 0xFF, 0x04, 0x00, 0xAA, 0x52, 0x9E, 0xF7, 0xFF, 0x04, 0xFF,
-    0x9E, 0xF7, 0x8A, 0x52, 0xFF, 0x18, 0x00, 0xAE, 0x73, 0xFF, 0x06, 0xFF, 0xBA, 0xD6, 0x86, 0x31,
-    0xFF, 0x0A, 0x00, 0x08, 0x42, 0x8E, 0x73, 0x34, 0xA5, 0x9A, 0xD6, 0x9E, 0xF7, 0xFF, 0x08, 0xFF,
-    0x59, 0xCE, 0xFF, 0x04, 0x00, 0x8A, 0x52, 0x9E, 0xEF, 0xFF, 0x04, 0xFF, 0xFB, 0xDE, 0xC7, 0x39,
-    0x00, 0x00, 0x86, 0x31, 0xBA, 0xD6, 0xFF, 0x06, 0xFF, 0x51, 0x8C, 0x03, 0x21, 0x04, 0x21, 0x04,
-    0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x28, 0x42, 0x3C, 0xE7, 0xFF, 0x04, 0xFF,
-    0xBF, 0xFF, 0x00, 0x4D, 0x6B, 0xFF, 0x04, 0x00, 0xD3, 0x9C, 0xFF, 0x06, 0xFF, 0x34, 0xA5, 0x00,
-    0x00, 0xEF, 0x7B, 0xBE, 0xF7, 0xFF, 0x06, 0xFF, 0xDF, 0xF7, 0xFF, 0x06, 0xFF, 0xEF, 0x7B, 0xFF,
-    0x14, 0x00, 0x38, 0xC6, 0xFF, 0x09, 0xFF, 0xF7, 0xFF, 0x00, 0xF7, 0xFF, 0x00, 0xF7, 0xFF, 0x08,
-    0xFF, 0x9A, 0xD6, 0xE7, 0x39, 0x00, 0x00, 0xA7, 0x39, 0xFB, 0xDE, 0xFF, 0x06, 0xFF, 0xAE, 0x73,
-    0xC3, 0x18, 0xE3, 0x18, 0x03, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x8A, 0x52,
-    0x7D, 0xEF, 0xFF, 0x04, 0xFF, 0xBE, 0xF7, 0xEB, 0x5A, 0xFF, 0x04, 0x00, 0x9A, 0xD6, 0xFF, 0x06,
-    0xFF, 0xAE, 0x73, 0xFF, 0x0A, 0x00, 0xAE, 0x73, 0xDF, 0xFF, 0x05, 0xFF, 0x18, 0xC6, 0xFF, 0x06,
-    0x00, 0xD3, 0x9C, 0xFF, 0x07, 0xFF, 0xF7, 0xDF, 0xF7, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xFF,
-    0x00, 0xF7, 0xDF, 0xF7, 0xDF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x1C, 0xE7, 0xAA, 0x52, 0xFF,
-    0x40, 0x00, 0xE6, 0xA3, 0xC8, 0xCC, 0xA7, 0xCC, 0xA7, 0xC4, 0xA7, 0xC4, 0xE6, 0xA3, 0xFF, 0x12,
-    0x00, 0xE7, 0x39, 0x1C, 0xE7, 0xFF, 0x10, 0xFF, 0xDF, 0xFF, 0x00, 0x3C, 0xE7, 0xF3, 0x9C, 0xA6,
-    0x31, 0xFF, 0x06, 0x00, 0xCF, 0x7B, 0xFF, 0x06, 0xFF, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF,
-    0xFF, 0x09, 0xFF, 0x1C, 0xE7, 0x6D, 0x6B, 0xFF, 0x08, 0x00, 0xCA, 0x5A, 0xBE, 0xF7, 0xFF, 0x04,
-    0xFF, 0x5D, 0xEF, 0x08, 0x42, 0xFF, 0x12, 0x00, 0xC7, 0x39, 0xFB, 0xDE, 0xFF, 0x06, 0xFF, 0xD3,
-    0x9C, 0xFF, 0x0E, 0x00, 0xA6, 0x31, 0xFF, 0x08, 0x00, 0xAE, 0x73, 0xFF, 0x06, 0xFF, 0xBA, 0xD6,
-    0x86, 0x31, 0xFF, 0x10, 0x00, 0xA6, 0x31, 0xEB, 0x5A, 0xF7, 0xBD, 0xFF, 0x06, 0xFF, 0x3C, 0xE7,
-    0x08, 0x42, 0x00, 0x00, 0x8A, 0x52, 0x9E, 0xEF, 0xFF, 0x04, 0xFF, 0xFB, 0xDE, 0xC7, 0x39, 0xFF,
-    0x04, 0x00, 0xB6, 0xB5, 0xFF, 0x06, 0xFF, 0x79, 0xCE, 0x86, 0x31, 0xE3, 0x18, 0x04, 0x21, 0x24,
-    0x21, 0x24, 0x21, 0x04, 0x21, 0xE3, 0x20, 0x51, 0x8C, 0xFF, 0x06, 0xFF, 0x5D, 0xEF, 0x28, 0x42,
-    0xFF, 0x04, 0x00, 0xD3, 0x9C, 0xFF, 0x06, 0xFF, 0x55, 0xAD, 0xFF, 0x04, 0x00, 0xF3, 0x9C, 0xFF,
-    0x05, 0xFF, 0xF7, 0xFF, 0x08, 0xFF, 0xEF, 0x7B, 0xFF, 0x14, 0x00, 0x38, 0xC6, 0xFF, 0x09, 0xFF,
-    0xF7, 0xFF, 0x00, 0xF7, 0xFF, 0x06, 0xFF, 0x9E, 0xEF, 0x96, 0xB5, 0x49, 0x4A, 0xFF, 0x06, 0x00,
-    0xB7, 0xB5, 0xFF, 0x06, 0xFF, 0x18, 0xC6, 0x45, 0x29, 0xC3, 0x18, 0xE3, 0x18, 0xE3, 0x18, 0x04,
-    0x21, 0x04, 0x21, 0x24, 0x21, 0xF3, 0x9C, 0xFF, 0x04, 0xFF, 0xDF, 0xFF, 0x00, 0xDB, 0xDE, 0xA7,
-    0x31, 0xFF, 0x04, 0x00, 0x38, 0xC6, 0xFF, 0x06, 0xFF, 0xD3, 0x9C, 0xFF, 0x0A, 0x00, 0xD3, 0x9C,
-    0xFF, 0x06, 0xFF, 0x75, 0xAD, 0xFF, 0x06, 0x00, 0xB2, 0x94, 0xFF, 0x07, 0xFF, 0xF7, 0xFF, 0x00,
-    0xF7, 0xDF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xFF,
-    0x00, 0x9A, 0xD6, 0x69, 0x4A, 0xFF, 0x42, 0x00, 0x66, 0x93, 0xE8, 0xCC, 0xC7, 0xCC, 0xA7, 0xCC,
-    0xA7, 0xC4, 0x86, 0x93, 0xFF, 0x12, 0x00, 0xC7, 0x39, 0x1C, 0xE7, 0xFF, 0x06, 0xFF, 0x59, 0xCE,
-    0xB6, 0xB5, 0xB6, 0xB5, 0x96, 0xAD, 0x14, 0xA5, 0xCF, 0x7B, 0x08, 0x42, 0xFF, 0x0A, 0x00, 0xAE,
-    0x73, 0xFF, 0x06, 0xFF, 0x5D, 0xEF, 0xD3, 0x9C, 0x71, 0x94, 0xB6, 0xB5, 0xDF, 0xFF, 0x05, 0xFF,
-    0xFB, 0xDE, 0x08, 0x42, 0xFF, 0x08, 0x00, 0xAA, 0x52, 0x9E, 0xF7, 0xFF, 0x04, 0xFF, 0x3C, 0xE7,
-    0xE7, 0x39, 0xFF, 0x14, 0x00, 0xF3, 0x9C, 0xFF, 0x06, 0xFF, 0x7D, 0xEF, 0xEF, 0x7B, 0xFF, 0x0A,
-    0x00, 0x30, 0x84, 0x59, 0xCE, 0xCB, 0x5A, 0xFF, 0x06, 0x00, 0x8E, 0x73, 0xFF, 0x06, 0xFF, 0xBA,
-    0xD6, 0xFF, 0x06, 0x00, 0xE7, 0x39, 0x8E, 0x73, 0x86, 0x31, 0xFF, 0x0A, 0x00, 0x69, 0x4A, 0x7D,
-    0xEF, 0xFF, 0x04, 0xFF, 0x3D, 0xE7, 0x08, 0x42, 0x00, 0x00, 0x8A, 0x52, 0x9E, 0xF7, 0xFF, 0x04,
-    0xFF, 0x1C, 0xE7, 0xE7, 0x39, 0xFF, 0x04, 0x00, 0x8E, 0x73, 0xDF, 0xFF, 0x05, 0xFF, 0xDF, 0xF7,
-    0x14, 0xA5, 0x86, 0x31, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x24, 0x21, 0x2C, 0x63, 0x3C, 0xE7,
-    0xFF, 0x06, 0xFF, 0x96, 0xB5, 0xFF, 0x06, 0x00, 0xF3, 0xA4, 0xFF, 0x06, 0xFF, 0x34, 0xA5, 0xFF,
-    0x04, 0x00, 0x86, 0x31, 0xB6, 0xB5, 0xFF, 0x0C, 0xFF, 0xEF, 0x7B, 0xFF, 0x14, 0x00, 0x38, 0xC6,
-    0xFF, 0x06, 0xFF, 0xBA, 0xD6, 0x96, 0xB5, 0x96, 0xB5, 0x76, 0xAD, 0x34, 0xA5, 0x10, 0x84, 0x8A,
-    0x52, 0xFF, 0x0A, 0x00, 0x8E, 0x73, 0xDF, 0xFF, 0x05, 0xFF, 0xDF, 0xF7, 0xB2, 0x94, 0x45, 0x29,
-    0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0x24, 0x21, 0xCF, 0x7B, 0x9E, 0xF7, 0xFF, 0x06, 0xFF, 0xF4,
-    0xA4, 0xFF, 0x06, 0x00, 0x14, 0xA5, 0xFF, 0x06, 0xFF, 0xFB, 0xDE, 0x28, 0x42, 0xFF, 0x06, 0x00,
-    0x69, 0x4A, 0xFB, 0xDE, 0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xEF, 0x7B,
-    0xFF, 0x06, 0x00, 0xB2, 0x94, 0xFF, 0x06, 0xFF, 0xFB, 0xDE, 0x92, 0x94, 0x71, 0x94, 0xF8, 0xC5,
-    0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0x79, 0xCE, 0xFF, 0x44, 0x00, 0x06, 0x7B,
-    0xC8, 0xCC, 0xC7, 0xCC, 0xA7, 0xC4, 0xA7, 0xCC, 0x46, 0x8B, 0xFF, 0x12, 0x00, 0xA7, 0x39, 0x1C,
-    0xE7, 0xFF, 0x04, 0xFF, 0xBE, 0xF7, 0xEB, 0x5A, 0xFF, 0x16, 0x00, 0x8E, 0x73, 0xFF, 0x06, 0xFF,
-    0xDB, 0xDE, 0x86, 0x31, 0x00, 0x00, 0xA6, 0x31, 0x59, 0xCE, 0xFF, 0x06, 0xFF, 0x96, 0xB5, 0xFF,
-    0x08, 0x00, 0x8A, 0x52, 0x9E, 0xEF, 0xFF, 0x04, 0xFF, 0x7D, 0xEF, 0x10, 0x84, 0x6D, 0x6B, 0x6D,
-    0x6B, 0x4D, 0x6B, 0x4D, 0x6B, 0x6D, 0x6B, 0x8E, 0x73, 0x8E, 0x73, 0x49, 0x4A, 0xFF, 0x04, 0x00,
-    0x28, 0x42, 0xFB, 0xDE, 0xFF, 0x06, 0xFF, 0xBE, 0xF7, 0xF7, 0xBD, 0x51, 0x8C, 0xCF, 0x7B, 0x51,
-    0x8C, 0x18, 0xC6, 0xBE, 0xF7, 0xFF, 0x00, 0xFF, 0x00, 0xFB, 0xDE, 0x2C, 0x63, 0xFF, 0x04, 0x00,
-    0x8E, 0x73, 0xFF, 0x06, 0xFF, 0xBA, 0xD6, 0xFF, 0x06, 0x00, 0xCF, 0x7B, 0xBE, 0xF7, 0x79, 0xCE,
-    0x71, 0x8C, 0x0C, 0x63, 0x49, 0x4A, 0x28, 0x42, 0x8A, 0x52, 0xD3, 0x9C, 0xDF, 0xF7, 0xFF, 0x04,
-    0xFF, 0x9A, 0xD6, 0xFF, 0x04, 0x00, 0xAA, 0x52, 0x9E, 0xF7, 0xFF, 0x04, 0xFF, 0x3C, 0xE7, 0x08,
-    0x42, 0xFF, 0x04, 0x00, 0x86, 0x31, 0xD7, 0xBD, 0xFF, 0x05, 0xFF, 0xF7, 0xDF, 0xF7, 0x59, 0xCE,
-    0x51, 0x8C, 0x8E, 0x73, 0xCF, 0x7B, 0x55, 0xAD, 0x5D, 0xEF, 0xDF, 0xFF, 0x05, 0xFF, 0x3C, 0xEF,
-    0xCA, 0x5A, 0xFF, 0x06, 0x00, 0x14, 0xA5, 0xFF, 0x06, 0xFF, 0x34, 0xA5, 0xFF, 0x06, 0x00, 0xE7,
-    0x39, 0x9A, 0xD6, 0xFF, 0x0A, 0xFF, 0xEF, 0x7B, 0xFF, 0x14, 0x00, 0x18, 0xC6, 0xFF, 0x06, 0xFF,
-    0x71, 0x8C, 0xFF, 0x16, 0x00, 0x86, 0x31, 0xF7, 0xBD, 0xFF, 0x06, 0xFF, 0xDF, 0xF7, 0x18, 0xC6,
-    0x10, 0x84, 0x4D, 0x6B, 0xAE, 0x73, 0x75, 0xAD, 0x9E, 0xF7, 0xFF, 0x06, 0xFF, 0x1C, 0xE7, 0x49,
-    0x4A, 0xFF, 0x06, 0x00, 0x0C, 0x63, 0xBE, 0xF7, 0xFF, 0x06, 0xFF, 0x9A, 0xCE, 0xCF, 0x7B, 0x2C,
-    0x63, 0x30, 0x84, 0xDB, 0xDE, 0xFF, 0x06, 0xFF, 0x1C, 0xE7, 0xE7, 0x41, 0xFF, 0x06, 0x00, 0x92,
-    0x94, 0xFF, 0x06, 0xFF, 0xF7, 0xBD, 0xFF, 0x04, 0x00, 0x08, 0x42, 0xDB, 0xDE, 0xFF, 0x04, 0xFF,
-    0xDF, 0xFF, 0x00, 0xB3, 0x94, 0xFF, 0x42, 0x00, 0x85, 0x62, 0xA8, 0xCC, 0xA7, 0xC4, 0xA7, 0xC4,
-    0xC7, 0xCC, 0x06, 0x7B, 0xFF, 0x12, 0x00, 0x86, 0x31, 0xFB, 0xDE, 0xFF, 0x04, 0xFF, 0xBE, 0xF7,
-    0xEB, 0x5A, 0xFF, 0x16, 0x00, 0x4D, 0x6B, 0xDF, 0xF7, 0xFF, 0x04, 0xFF, 0xDB, 0xDE, 0xA6, 0x31,
-    0xFF, 0x04, 0x00, 0xEB, 0x5A, 0x7D, 0xEF, 0xFF, 0x04, 0xFF, 0xDF, 0xF7, 0xCF, 0x7B, 0xFF, 0x06,
-    0x00, 0x6A, 0x4A, 0x9E, 0xEF, 0xFF, 0x06, 0xFF, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xFF,
-    0x00, 0xBF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x05, 0xFF, 0x71, 0x8C, 0xFF, 0x06, 0x00,
-    0x2C, 0x63, 0x5D, 0xE7, 0xFF, 0x10, 0xFF, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-    0x00, 0xF3, 0x9C, 0xFF, 0x04, 0x00, 0x6D, 0x6B, 0xDF, 0xF7, 0xFF, 0x04, 0xFF, 0x9A, 0xD6, 0x86,
-    0x31, 0xFF, 0x04, 0x00, 0x18, 0xBE, 0xFF, 0x06, 0xFF, 0xBF, 0xF7, 0x5D, 0xEF, 0x3C, 0xE7, 0x7D,
-    0xEF, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xF7, 0xBF, 0xF7, 0x51, 0x8C, 0xFF, 0x04, 0x00,
-    0xCB, 0x5A, 0x9E, 0xF7, 0xFF, 0x04, 0xFF, 0x3C, 0xE7, 0x28, 0x42, 0xFF, 0x06, 0x00, 0x08, 0x42,
-    0x59, 0xC6, 0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x05, 0xFF, 0xDF, 0xFF, 0x07,
-    0xFF, 0xDF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x7D, 0xEF, 0xCE, 0x7B, 0xFF, 0x08, 0x00, 0x14,
-    0xA5, 0xFF, 0x06, 0xFF, 0xF3, 0x9C, 0xFF, 0x08, 0x00, 0xEB, 0x5A, 0x5D, 0xEF, 0xFF, 0x08, 0xFF,
-    0xEF, 0x7B, 0xFF, 0x14, 0x00, 0xF7, 0xBD, 0xFF, 0x06, 0xFF, 0x51, 0x8C, 0xFF, 0x18, 0x00, 0x69,
-    0x4A, 0xBA, 0xD6, 0xFF, 0x0A, 0xFF, 0xDF, 0xFF, 0x0B, 0xFF, 0x7D, 0xEF, 0x8E, 0x73, 0xFF, 0x0A,
-    0x00, 0x75, 0xAD, 0xFF, 0x0A, 0xFF, 0xDE, 0xFF, 0x0B, 0xFF, 0x71, 0x8C, 0xFF, 0x08, 0x00, 0x71,
-    0x94, 0xFF, 0x06, 0xFF, 0x18, 0xC6, 0xFF, 0x06, 0x00, 0xAE, 0x73, 0xDF, 0xFF, 0x05, 0xFF, 0x7D,
-    0xEF, 0xCB, 0x5A, 0xFF, 0x40, 0x00, 0xE4, 0x49, 0x87, 0xC4, 0xA7, 0xC4, 0xA7, 0xC4, 0xC8, 0xCC,
-    0xA5, 0x6A, 0xFF, 0x12, 0x00, 0x86, 0x31, 0xFB, 0xDE, 0xFF, 0x04, 0xFF, 0xBE, 0xF7, 0xEB, 0x5A,
-    0xFF, 0x16, 0x00, 0x4D, 0x6B, 0xDF, 0xFF, 0x05, 0xFF, 0xDB, 0xDE, 0xA6, 0x31, 0xFF, 0x06, 0x00,
-    0xD3, 0x9C, 0xFF, 0x06, 0xFF, 0x1C, 0xE7, 0x28, 0x42, 0xFF, 0x04, 0x00, 0x8A, 0x52, 0xBE, 0xF7,
-    0xFF, 0x16, 0xFF, 0x51, 0x8C, 0xFF, 0x08, 0x00, 0x0C, 0x63, 0xBA, 0xD6, 0xFF, 0x10, 0xFF, 0x9E,
-    0xF7, 0xF3, 0x9C, 0x86, 0x31, 0xFF, 0x04, 0x00, 0x6D, 0x6B, 0xDF, 0xF7, 0xFF, 0x04, 0xFF, 0xBA,
-    0xD6, 0x86, 0x31, 0x00, 0x00, 0xC7, 0x39, 0x79, 0xCE, 0xFF, 0x0C, 0xFF, 0xDF, 0xFF, 0x00, 0xDF,
-    0xFF, 0x00, 0xDF, 0xFF, 0x00, 0x9E, 0xF7, 0x14, 0xA5, 0xFF, 0x06, 0x00, 0xCB, 0x5A, 0xBE, 0xF7,
-    0xFF, 0x04, 0xFF, 0x3D, 0xE7, 0x08, 0x42, 0xFF, 0x08, 0x00, 0xE7, 0x39, 0x96, 0xB5, 0xBF, 0xF7,
-    0xFF, 0x0E, 0xFF, 0xDF, 0xFF, 0x00, 0xBA, 0xDE, 0x6D, 0x73, 0xFF, 0x08, 0x00, 0x64, 0x31, 0x14,
-    0xA5, 0xFF, 0x06, 0xFF, 0xF3, 0x9C, 0xFF, 0x0A, 0x00, 0xF0, 0x83, 0xBE, 0xF7, 0xFF, 0x06, 0xFF,
-    0xEF, 0x7B, 0xFF, 0x14, 0x00, 0xF7, 0xBD, 0xFF, 0x06, 0xFF, 0x51, 0x8C, 0xFF, 0x1A, 0x00, 0x69,
-    0x4A, 0xF7, 0xBD, 0xDF, 0xF7, 0xFF, 0x0E, 0xFF, 0xDF, 0xFF, 0x00, 0x9A, 0xD6, 0x2C, 0x6B, 0xFF,
-    0x0C, 0x00, 0xC7, 0x39, 0xB6, 0xB5, 0xDF, 0xFF, 0x0F, 0xFF, 0xDF, 0xFF, 0x00, 0x55, 0xAD, 0xFF,
-    0x0A, 0x00, 0x72, 0x94, 0xFF, 0x06, 0xFF, 0x18, 0xC6, 0xFF, 0x08, 0x00, 0xB6, 0xB5, 0xFF, 0x06,
-    0xFF, 0x59, 0xCE, 0xFF, 0x40, 0x00, 0x64, 0x31, 0x47, 0xB4, 0xA7, 0xC4, 0xA8, 0xC4, 0xC8, 0xCC,
-    0x45, 0x5A, 0xFF, 0x14, 0x00, 0x18, 0xC6, 0x1C, 0xDF, 0x1C, 0xDF, 0xFB, 0xDE, 0xAA, 0x52, 0xFF,
-    0x16, 0x00, 0x0C, 0x63, 0x1C, 0xE7, 0x3C, 0xE7, 0x3C, 0xE7, 0x18, 0xC6, 0x86, 0x31, 0xFF, 0x06,
-    0x00, 0xC7, 0x39, 0x38, 0xC6, 0x3C, 0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0x92, 0x94, 0xFF, 0x04, 0x00,
-    0x69, 0x4A, 0xDB, 0xDE, 0x3C, 0xE7, 0x1C, 0xE7, 0xFB, 0xDE, 0xFC, 0xE6, 0xFC, 0xE6, 0x1C, 0xE7,
-    0x3C, 0xE7, 0x3C, 0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0xCF, 0x7B, 0xFF, 0x0A, 0x00, 0xE7,
-    0x39, 0x51, 0x8C, 0x79, 0xCE, 0x7D, 0xEF, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0x9E, 0xF7, 0x3C,
-    0xE7, 0xD7, 0xBD, 0x2C, 0x63, 0xFF, 0x08, 0x00, 0x0C, 0x63, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE,
-    0xD7, 0xBD, 0xFF, 0x06, 0x00, 0xE7, 0x39, 0x50, 0x84, 0x38, 0xC6, 0x3C, 0xE7, 0xBE, 0xF7, 0xDF,
-    0xFF, 0x00, 0xBF, 0xFF, 0x00, 0x9E, 0xF7, 0x1C, 0xE7, 0xD7, 0xBD, 0x4D, 0x6B, 0xFF, 0x08, 0x00,
-    0xAA, 0x5A, 0xFB, 0xDE, 0x3C, 0xE7, 0x3C, 0xE7, 0x79, 0xCE, 0xE7, 0x39, 0xFF, 0x0C, 0x00, 0x8E,
-    0x73, 0xF7, 0xC5, 0x3C, 0xE7, 0xBE, 0xF7, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0x7D, 0xF7, 0x9A,
-    0xD6, 0x91, 0x94, 0x27, 0x4A, 0x23, 0x29, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x64, 0x31, 0x64,
-    0x31, 0xB2, 0x94, 0x5C, 0xEF, 0x1C, 0xE7, 0x1C, 0xE7, 0x71, 0x8C, 0xFF, 0x0C, 0x00, 0xD3, 0x9C,
-    0x3D, 0xEF, 0x3C, 0xE7, 0x3C, 0xE7, 0xAE, 0x73, 0xFF, 0x14, 0x00, 0x55, 0xAD, 0x3C, 0xE7, 0x3C,
-    0xE7, 0x3C, 0xE7, 0xEF, 0x7B, 0xFF, 0x1E, 0x00, 0x8D, 0x73, 0xD7, 0xBD, 0x1C, 0xE7, 0xBE, 0xF7,
-    0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0x5D, 0xEF, 0x38, 0xCE, 0x10, 0x84, 0xA6, 0x31, 0xFF, 0x12,
-    0x00, 0xEF, 0x7B, 0x59, 0xCE, 0x7D, 0xEF, 0x9E, 0xF7, 0xBE, 0xF7, 0xBE, 0xF7, 0x5D, 0xEF, 0x38,
-    0xC6, 0xCF, 0x7B, 0xFF, 0x0C, 0x00, 0x10, 0x84, 0xFC, 0xE6, 0xFC, 0xDE, 0x3C, 0xE7, 0x96, 0xB5,
-    0xFF, 0x08, 0x00, 0x8A, 0x52, 0xDB, 0xDE, 0x3C, 0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0xEF, 0x7B, 0xFF,
-    0x16, 0x00, 0x64, 0x31, 0x64, 0x31, 0xFF, 0x26, 0x00, 0xC6, 0x9B, 0x47, 0xBC, 0x87, 0xBC, 0x68,
-    0xBC, 0xE5, 0x49, 0xFF, 0x14, 0x00, 0x85, 0x31, 0x86, 0x31, 0xA6, 0x31, 0xA6, 0x31, 0xFF, 0x1A,
-    0x00, 0xE7, 0x39, 0xE7, 0x41, 0xE7, 0x39, 0xA6, 0x39, 0xFF, 0x0A, 0x00, 0xA6, 0x31, 0xC7, 0x39,
-    0xC7, 0x39, 0xC7, 0x39, 0xA6, 0x31, 0xFF, 0x06, 0x00, 0xE7, 0x39, 0xE7, 0x39, 0xC7, 0x39, 0xA6,
-    0x39, 0xA6, 0x39, 0xC7, 0x39, 0xE7, 0x39, 0xE7, 0x41, 0xE7, 0x41, 0xE7, 0x39, 0xC7, 0x39, 0xC7,
-    0x39, 0xFF, 0x12, 0x00, 0x49, 0x4A, 0x0C, 0x63, 0x2C, 0x63, 0xCB, 0x5A, 0x08, 0x42, 0xFF, 0x0E,
-    0x00, 0xA6, 0x31, 0xA6, 0x39, 0xA6, 0x39, 0x86, 0x31, 0xFF, 0x0A, 0x00, 0x86, 0x31, 0x48, 0x4A,
-    0xEB, 0x5A, 0x4D, 0x6B, 0x2C, 0x6B, 0xCB, 0x5A, 0x08, 0x42, 0xFF, 0x0E, 0x00, 0x08, 0x42, 0x08,
-    0x42, 0x08, 0x42, 0xC7, 0x39, 0xFF, 0x10, 0x00, 0x85, 0x31, 0x28, 0x4A, 0xCA, 0x62, 0x4C, 0x73,
-    0x6C, 0x73, 0xEA, 0x62, 0x06, 0x4A, 0x84, 0x39, 0x63, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31,
-    0x64, 0x31, 0x64, 0x31, 0x84, 0x39, 0xE6, 0x41, 0x48, 0x4A, 0x07, 0x42, 0xE7, 0x39, 0xFF, 0x10,
-    0x00, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0xFF, 0x16, 0x00, 0x86, 0x31, 0xE7, 0x39, 0xE7, 0x41,
-    0x07, 0x42, 0xFF, 0x24, 0x00, 0xE7, 0x39, 0xAA, 0x5A, 0x2C, 0x63, 0x0C, 0x63, 0x49, 0x4A, 0xFF,
-    0x1C, 0x00, 0x28, 0x4A, 0xCA, 0x5A, 0x0B, 0x63, 0xEB, 0x5A, 0x28, 0x42, 0xFF, 0x12, 0x00, 0x86,
-    0x31, 0x86, 0x31, 0xA6, 0x39, 0x86, 0x31, 0xFF, 0x0A, 0x00, 0xC7, 0x39, 0xE7, 0x39, 0xC7, 0x39,
-    0xC7, 0x39, 0x86, 0x31, 0xFF, 0x12, 0x00, 0x85, 0x39, 0x49, 0xAC, 0x69, 0xAC, 0x69, 0xB4, 0xA7,
-    0x93, 0xFF, 0x24, 0x00, 0xA4, 0x39, 0xE4, 0x49, 0x05, 0x52, 0x05, 0x52, 0x84, 0x39, 0xFF, 0xE6,
-    0x00, 0x23, 0x29, 0x64, 0x39, 0xA4, 0x41, 0xC4, 0x41, 0xA4, 0x41, 0xA4, 0x41, 0x84, 0x39, 0x64,
-    0x39, 0x84, 0x39, 0x84, 0x39, 0x84, 0x39, 0x84, 0x39, 0x64, 0x31, 0x64, 0x31, 0xFF, 0xCC, 0x00,
-    0x66, 0x5A, 0x48, 0xAC, 0xA4, 0x41, 0xE5, 0x49, 0x48, 0xAC, 0x64, 0x31, 0xFF, 0x1E, 0x00, 0x24,
-    0x52, 0xE7, 0xA3, 0x07, 0xA4, 0x28, 0xAC, 0x48, 0xB4, 0x48, 0xB4, 0x68, 0xB4, 0x06, 0x7B, 0xFF,
-    0xE2, 0x00, 0x44, 0x31, 0x64, 0x31, 0x84, 0x39, 0xC4, 0x41, 0xA6, 0x6A, 0x29, 0xA4, 0xCA, 0xBC,
-    0xCA, 0xBC, 0x08, 0x9C, 0x85, 0x62, 0xA4, 0x41, 0xA4, 0x41, 0x84, 0x39, 0x64, 0x39, 0x64, 0x31,
-    0xFF, 0xC2, 0x00, 0x43, 0x29, 0xC7, 0x93, 0xE7, 0x9B, 0x25, 0x52, 0x25, 0x52, 0x48, 0xAC, 0x87,
-    0x8B, 0xE3, 0x18, 0x03, 0x21, 0xE8, 0x9B, 0x87, 0x8B, 0xE4, 0x49, 0x25, 0x52, 0x08, 0xA4, 0xE6,
-    0x72, 0xFF, 0x16, 0x00, 0x85, 0x62, 0xA8, 0xC4, 0xA8, 0xC4, 0xC9, 0xC4, 0xC9, 0xC4, 0xC9, 0xC4,
-    0xC9, 0xC4, 0x46, 0x83, 0xFF, 0xE0, 0x00, 0x44, 0x31, 0x44, 0x31, 0x64, 0x39, 0x84, 0x39, 0x07,
-    0x7B, 0xED, 0xDD, 0x8E, 0xFE, 0x4D, 0xEE, 0x2C, 0xEE, 0x6D, 0xFE, 0x0D, 0xE6, 0xC8, 0x93, 0xE4,
-    0x49, 0x84, 0x39, 0x64, 0x39, 0x64, 0x31, 0x44, 0x31, 0xFF, 0xBE, 0x00, 0x64, 0x31, 0xC7, 0x9B,
-    0xC5, 0x72, 0x24, 0x52, 0x27, 0xAC, 0xC7, 0x9B, 0xC6, 0x72, 0x84, 0x39, 0xE3, 0x18, 0xE3, 0x18,
-    0xA4, 0x39, 0x47, 0x83, 0x48, 0xAC, 0xC7, 0x93, 0x04, 0x4A, 0xA7, 0x93, 0xE6, 0x72, 0xFF, 0x08,
-    0x00, 0x64, 0x31, 0xFF, 0x0A, 0x00, 0x44, 0x31, 0x05, 0x4A, 0x25, 0x52, 0x45, 0x5A, 0x25, 0x5A,
-    0x05, 0x52, 0xC4, 0x41, 0x44, 0x31, 0xFF, 0xDE, 0x00, 0x44, 0x31, 0x44, 0x31, 0x64, 0x31, 0x64,
-    0x31, 0x86, 0x62, 0xAC, 0xDD, 0x2D, 0xEE, 0x49, 0xA4, 0xE6, 0x72, 0xC6, 0x6A, 0x09, 0x9C, 0x0D,
-    0xE6, 0x6E, 0xF6, 0x69, 0xAC, 0x04, 0x4A, 0x63, 0x39, 0x64, 0x39, 0x64, 0x31, 0x64, 0x31, 0x44,
-    0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x29, 0xFF, 0xB4, 0x00, 0xC6, 0x6A, 0x07, 0xA4, 0xC2, 0x18,
-    0x82, 0x10, 0x23, 0x29, 0xE2, 0x20, 0x82, 0x10, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA2, 0x10,
-    0x82, 0x10, 0x43, 0x29, 0x23, 0x29, 0xA2, 0x10, 0x64, 0x31, 0x48, 0xAC, 0xC4, 0x41, 0xFF, 0x04,
-    0x00, 0x05, 0x7B, 0x47, 0xB4, 0xE5, 0x72, 0xFF, 0x0C, 0x00, 0x66, 0x8B, 0x07, 0xAC, 0xC6, 0xA3,
-    0x05, 0x83, 0xFF, 0x90, 0x00, 0x44, 0x29, 0x44, 0x29, 0x44, 0x31, 0x44, 0x29, 0x44, 0x31, 0x44,
-    0x29, 0x44, 0x29, 0x44, 0x29, 0x44, 0x29, 0xFF, 0x0A, 0x00, 0x44, 0x29, 0x00, 0x00, 0x44, 0x31,
-    0x44, 0x31, 0x44, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31,
-    0x44, 0x31, 0xFF, 0x1C, 0x00, 0x64, 0x31, 0x64, 0x31, 0x64, 0x39, 0x64, 0x39, 0x25, 0x52, 0x0A,
-    0xC5, 0x0B, 0xEE, 0xA8, 0x8B, 0xE4, 0x49, 0xC4, 0x49, 0xC4, 0x49, 0xE4, 0x49, 0xE6, 0x72, 0x4B,
-    0xCD, 0x4C, 0xF6, 0x09, 0xC5, 0x65, 0x5A, 0x63, 0x39, 0x64, 0x39, 0x84, 0x39, 0x64, 0x39, 0x64,
-    0x39, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x44, 0x31, 0x44, 0x29, 0xFF, 0x0C, 0x00, 0x44, 0x29,
-    0x44, 0x31, 0x44, 0x29, 0x44, 0x31, 0x00, 0x00, 0x44, 0x31, 0x44, 0x29, 0xFF, 0x94, 0x00, 0x84,
-    0x39, 0x28, 0xAC, 0x05, 0x4A, 0xA2, 0x10, 0x82, 0x10, 0x82, 0x10, 0x23, 0x29, 0x85, 0x62, 0x66,
-    0x83, 0x46, 0x83, 0x45, 0x5A, 0x03, 0x21, 0xA2, 0x10, 0xA2, 0x10, 0xC3, 0x18, 0xA6, 0x6A, 0xC7,
-    0x93, 0xFF, 0x06, 0x00, 0x26, 0x83, 0xA7, 0xC4, 0x25, 0x83, 0x43, 0x29, 0x04, 0x52, 0x04, 0x52,
-    0xE4, 0x49, 0x84, 0x39, 0x84, 0x39, 0x07, 0xAC, 0xA7, 0xCC, 0x67, 0xC4, 0x86, 0x93, 0xFF, 0x8E,
-    0x00, 0x44, 0x29, 0x44, 0x31, 0x44, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x44,
-    0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44,
-    0x31, 0x44, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x39, 0x64, 0x39, 0x64, 0x39, 0x84,
-    0x39, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x44, 0x29, 0xFF, 0x18, 0x00, 0x44, 0x31, 0x64, 0x31,
-    0x84, 0x39, 0x84, 0x39, 0xE4, 0x49, 0xA9, 0xB4, 0x0B, 0xEE, 0xE7, 0x9B, 0xA4, 0x41, 0xA4, 0x41,
-    0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xA4, 0x41, 0x05, 0x52, 0x48, 0xAC, 0x2B, 0xF6, 0xAA, 0xDD,
-    0x47, 0x83, 0xC4, 0x41, 0xA4, 0x41, 0x84, 0x41, 0x84, 0x39, 0x84, 0x39, 0x64, 0x39, 0x64, 0x31,
-    0x44, 0x31, 0x44, 0x31, 0x43, 0x29, 0x43, 0x29, 0x44, 0x29, 0x44, 0x29, 0x44, 0x31, 0x64, 0x31,
-    0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x44, 0x31, 0x44, 0x31,
-    0x44, 0x29, 0xFF, 0x0C, 0x00, 0x44, 0x29, 0x44, 0x29, 0x44, 0x31, 0x44, 0x29, 0xFF, 0x7E, 0x00,
-    0x08, 0x9C, 0x87, 0x8B, 0xC3, 0x18, 0xA2, 0x10, 0xE4, 0x49, 0x07, 0xA4, 0xE7, 0x9B, 0x06, 0x7B,
-    0x06, 0x7B, 0xE7, 0xA3, 0x07, 0xA4, 0xC4, 0x41, 0xC3, 0x18, 0x03, 0x21, 0x28, 0xA4, 0xA6, 0x6A,
-    0xFF, 0x06, 0x00, 0x26, 0x83, 0x87, 0xC4, 0x05, 0x7B, 0x24, 0x5A, 0x47, 0xBC, 0x67, 0xBC, 0x67,
-    0xBC, 0x47, 0xBC, 0x06, 0xAC, 0x67, 0xBC, 0x67, 0xC4, 0x47, 0xBC, 0xE6, 0xA3, 0xA5, 0x72, 0x85,
-    0x6A, 0xA5, 0x72, 0x24, 0x52, 0xFF, 0x6C, 0x00, 0x44, 0x29, 0x44, 0x29, 0x44, 0x31, 0x44, 0x31,
-    0x44, 0x31, 0xFF, 0x0E, 0x00, 0x43, 0x29, 0x44, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64,
-    0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44,
-    0x31, 0x44, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x39, 0x84, 0x39, 0x84, 0x39, 0x84,
-    0x39, 0x84, 0x39, 0x84, 0x39, 0x64, 0x39, 0x64, 0x31, 0x44, 0x31, 0x64, 0x31, 0x44, 0x31, 0x44,
-    0x29, 0xFF, 0x16, 0x00, 0x64, 0x31, 0x84, 0x39, 0xA4, 0x41, 0xE4, 0x49, 0x49, 0xAC, 0x2C, 0xF6,
-    0x89, 0xB4, 0xC4, 0x41, 0x64, 0x39, 0x84, 0x39, 0x84, 0x39, 0x84, 0x39, 0xA4, 0x39, 0x84, 0x39,
-    0x84, 0x39, 0x84, 0x39, 0x47, 0x83, 0xCB, 0xE5, 0x2C, 0xF6, 0x8A, 0xB4, 0xA6, 0x6A, 0xC4, 0x49,
-    0xA4, 0x41, 0x84, 0x39, 0x64, 0x39, 0x44, 0x31, 0x43, 0x31, 0x43, 0x31, 0x43, 0x29, 0x43, 0x29,
-    0x43, 0x31, 0x43, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31,
-    0x64, 0x31, 0x64, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x43, 0x31, 0x00, 0x00, 0x43, 0x29,
-    0x00, 0x00, 0x44, 0x29, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31,
-    0x43, 0x29, 0x43, 0x29, 0xFF, 0x76, 0x00, 0xE5, 0x41, 0xA9, 0xBC, 0x45, 0x5A, 0xE3, 0x18, 0xC4,
-    0x41, 0x47, 0xB4, 0xA5, 0x6A, 0xE2, 0x18, 0xA2, 0x10, 0xA2, 0x10, 0xE3, 0x20, 0x06, 0x7B, 0x68,
-    0xB4, 0x84, 0x39, 0xC3, 0x18, 0xE7, 0x72, 0xA8, 0x93, 0xFF, 0x06, 0x00, 0x06, 0x7B, 0x87, 0xBC,
-    0x25, 0x83, 0x45, 0x5A, 0x67, 0xBC, 0x67, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x87, 0xC4,
-    0x47, 0xBC, 0x47, 0xBC, 0x27, 0xB4, 0x27, 0xB4, 0x27, 0xB4, 0x46, 0xBC, 0x65, 0x8B, 0x00, 0x00,
-    0xA5, 0x6A, 0x25, 0x83, 0x05, 0x83, 0x05, 0x7B, 0xE5, 0x7A, 0xC5, 0x72, 0xC4, 0x72, 0xC4, 0x72,
-    0xC4, 0x72, 0xC5, 0x72, 0xC5, 0x72, 0xC5, 0x72, 0xE5, 0x7A, 0xE5, 0x7A, 0xE5, 0x7A, 0x05, 0x83,
-    0x05, 0x83, 0x05, 0x83, 0x25, 0x83, 0x25, 0x83, 0x25, 0x83, 0x25, 0x83, 0x25, 0x83, 0x25, 0x83,
-    0x25, 0x83, 0x25, 0x83, 0x25, 0x83, 0x25, 0x83, 0x25, 0x83, 0x25, 0x83, 0x25, 0x83, 0x25, 0x83,
-    0x26, 0x83, 0x26, 0x8B, 0x46, 0x8B, 0x46, 0x8B, 0x46, 0x8B, 0x46, 0x8B, 0x46, 0x8B, 0x66, 0x8B,
-    0x66, 0x8B, 0x66, 0x8B, 0x66, 0x8B, 0x66, 0x8B, 0x86, 0x8B, 0x86, 0x93, 0x86, 0x93, 0x86, 0x93,
-    0x86, 0x93, 0xA6, 0x93, 0xA6, 0x93, 0xA7, 0x93, 0xA7, 0x9B, 0xC7, 0x9B, 0xC7, 0x9B, 0xC7, 0x9B,
-    0xC7, 0x9B, 0xC7, 0x9B, 0xC7, 0x9B, 0xC7, 0x9B, 0xC7, 0x9B, 0xC7, 0x9B, 0xC7, 0x9B, 0xE7, 0x9B,
-    0xE7, 0x9B, 0xE7, 0x9B, 0xE7, 0xA3, 0x08, 0xA4, 0x08, 0xA4, 0x08, 0xA4, 0x08, 0xA4, 0x08, 0xA4,
-    0x08, 0xA4, 0x28, 0xA4, 0x08, 0xA4, 0x08, 0xA4, 0x28, 0xA4, 0x28, 0xA4, 0x28, 0xA4, 0x28, 0xA4,
-    0x28, 0xA4, 0x49, 0xAC, 0x49, 0xAC, 0x49, 0xAC, 0x49, 0xAC, 0x69, 0xAC, 0x69, 0xAC, 0x69, 0xAC,
-    0x49, 0xAC, 0x28, 0xA4, 0x87, 0x8B, 0x45, 0x5A, 0x63, 0x31, 0x43, 0x31, 0x64, 0x31, 0x44, 0x31,
-    0x44, 0x29, 0xFF, 0x10, 0x00, 0x44, 0x31, 0x64, 0x31, 0x84, 0x39, 0xC4, 0x41, 0xC8, 0x93, 0x4D,
-    0xF6, 0x4B, 0xCD, 0x25, 0x52, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64,
-    0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0xA6, 0x62, 0x2A, 0xCD, 0x6E, 0xFE, 0x0D,
-    0xEE, 0x0A, 0xC5, 0x69, 0xAC, 0x49, 0xA4, 0x28, 0xA4, 0x08, 0x9C, 0x08, 0x9C, 0x08, 0x9C, 0x28,
-    0xA4, 0x29, 0xA4, 0x29, 0xA4, 0x29, 0xA4, 0x49, 0xA4, 0x49, 0xA4, 0x49, 0xA4, 0x49, 0xA4, 0x29,
-    0xA4, 0x49, 0xA4, 0x29, 0xA4, 0x29, 0xA4, 0x29, 0xA4, 0x29, 0xA4, 0x28, 0xA4, 0x28, 0xA4, 0x28,
-    0xA4, 0x28, 0xA4, 0x28, 0xA4, 0x28, 0xA4, 0x28, 0xA4, 0x28, 0xA4, 0x08, 0xA4, 0x28, 0xA4, 0x28,
-    0xA4, 0x08, 0xA4, 0x08, 0xA4, 0x08, 0xA4, 0xE8, 0x9B, 0xE8, 0x9B, 0xE7, 0x9B, 0xE7, 0x9B, 0xE7,
-    0x9B, 0xC7, 0x9B, 0xC7, 0x9B, 0xC7, 0x9B, 0xC7, 0x9B, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7,
-    0x93, 0xA7, 0x93, 0xA7, 0x93, 0x86, 0x93, 0x86, 0x93, 0x86, 0x93, 0x86, 0x93, 0xA6, 0x93, 0x86,
-    0x93, 0x86, 0x93, 0x86, 0x93, 0x86, 0x93, 0x86, 0x93, 0x66, 0x8B, 0x66, 0x8B, 0x66, 0x8B, 0x66,
-    0x8B, 0x66, 0x8B, 0x46, 0x8B, 0x46, 0x8B, 0x46, 0x8B, 0x46, 0x8B, 0x66, 0x8B, 0x66, 0x8B, 0x66,
-    0x8B, 0x66, 0x93, 0x66, 0x93, 0x66, 0x93, 0x66, 0x8B, 0x66, 0x8B, 0x66, 0x8B, 0x46, 0x8B, 0x46,
-    0x8B, 0x26, 0x83, 0x25, 0x83, 0x25, 0x83, 0x05, 0x7B, 0x05, 0x7B, 0x05, 0x7B, 0x05, 0x7B, 0x05,
-    0x7B, 0x26, 0x83, 0x46, 0x8B, 0x66, 0x8B, 0x87, 0x93, 0x87, 0x93, 0xC8, 0x93, 0xA9, 0xBC, 0x48,
-    0xA4, 0x44, 0x29, 0x04, 0x21, 0xC7, 0x9B, 0x67, 0x8B, 0xC3, 0x18, 0xA2, 0x10, 0xC2, 0x10, 0xC2,
-    0x10, 0xA2, 0x10, 0xE3, 0x18, 0xC8, 0x9B, 0x47, 0x83, 0xE3, 0x18, 0xA5, 0x39, 0xA9, 0xB4, 0x48,
-    0xA4, 0x67, 0x83, 0x44, 0x31, 0x05, 0x7B, 0x87, 0xBC, 0x46, 0x83, 0x85, 0x62, 0x87, 0xC4, 0x67,
-    0xC4, 0x67, 0xC4, 0x67, 0xC4, 0x67, 0xC4, 0x67, 0xBC, 0x47, 0xBC, 0x47, 0xBC, 0x47, 0xBC, 0x47,
-    0xBC, 0x47, 0xBC, 0x66, 0xBC, 0x86, 0x93, 0x44, 0x29, 0xC6, 0x9B, 0xA7, 0xC4, 0x86, 0xC4, 0x66,
-    0xBC, 0x46, 0xBC, 0x46, 0xBC, 0x46, 0xB4, 0x26, 0xB4, 0x26, 0xB4, 0x26, 0xB4, 0x26, 0xB4, 0x26,
-    0xB4, 0x46, 0xB4, 0x46, 0xBC, 0x46, 0xBC, 0x46, 0xBC, 0x66, 0xBC, 0x66, 0xBC, 0x66, 0xC4, 0x86,
-    0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x87,
-    0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0xA7, 0xC4, 0xA7, 0xC4, 0xA7, 0xC4, 0xA7, 0xCC, 0xA7,
-    0xCC, 0xA7, 0xCC, 0xC7, 0xCC, 0xC7, 0xCC, 0xC7, 0xCC, 0xC7, 0xCC, 0xE7, 0xCC, 0xE8, 0xCC, 0xE8,
-    0xCC, 0xE8, 0xCC, 0xE8, 0xD4, 0x08, 0xD5, 0x08, 0xD5, 0x08, 0xD5, 0x08, 0xD5, 0x28, 0xD5, 0x28,
-    0xD5, 0x29, 0xD5, 0x29, 0xD5, 0x49, 0xDD, 0x49, 0xDD, 0x49, 0xDD, 0x49, 0xDD, 0x49, 0xDD, 0x49,
-    0xDD, 0x49, 0xDD, 0x69, 0xDD, 0x69, 0xDD, 0x89, 0xDD, 0x89, 0xDD, 0x8A, 0xDD, 0x8A, 0xE5, 0xAA,
-    0xE5, 0xAA, 0xE5, 0xAA, 0xE5, 0xAA, 0xE5, 0xAA, 0xE5, 0xAA, 0xE5, 0xAB, 0xE5, 0xAB, 0xE5, 0xCB,
-    0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xEB, 0xE5, 0xEC, 0xE5, 0xEC,
-    0xED, 0xEC, 0xED, 0xEC, 0xE5, 0x0C, 0xE6, 0xEB, 0xE5, 0xEB, 0xE5, 0xEB, 0xED, 0x0B, 0xF6, 0xAA,
-    0xE5, 0xE7, 0x9B, 0xC4, 0x41, 0x64, 0x31, 0x84, 0x31, 0x64, 0x31, 0x64, 0x31, 0xFF, 0x0E, 0x00,
-    0x44, 0x31, 0x64, 0x31, 0x84, 0x39, 0x07, 0x7B, 0x2D, 0xEE, 0xCC, 0xDD, 0xC6, 0x6A, 0xA4, 0x39,
-    0x84, 0x39, 0x64, 0x31, 0x44, 0x31, 0x44, 0x29, 0x00, 0x00, 0x44, 0x29, 0x44, 0x31, 0x64, 0x31,
-    0x64, 0x31, 0x64, 0x39, 0x84, 0x39, 0x05, 0x52, 0xA8, 0x93, 0x6B, 0xCD, 0x0C, 0xE6, 0x0C, 0xEE,
-    0xEB, 0xE5, 0xEB, 0xE5, 0xEB, 0xE5, 0xEB, 0xE5, 0xEC, 0xE5, 0x0C, 0xEE, 0x0C, 0xEE, 0x0C, 0xEE,
-    0x0C, 0xEE, 0x0C, 0xEE, 0x0C, 0xEE, 0xEC, 0xED, 0xEC, 0xE5, 0xEC, 0xE5, 0xEB, 0xE5, 0xEB, 0xE5,
-    0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5,
-    0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xAB, 0xE5, 0xAA, 0xE5, 0xAA, 0xE5, 0xAA, 0xE5,
-    0x8A, 0xE5, 0x8A, 0xDD, 0x8A, 0xDD, 0x8A, 0xDD, 0x8A, 0xDD, 0x8A, 0xDD, 0x6A, 0xDD, 0x6A, 0xDD,
-    0x49, 0xDD, 0x49, 0xDD, 0x49, 0xDD, 0x49, 0xDD, 0x29, 0xDD, 0x29, 0xDD, 0x29, 0xDD, 0x29, 0xD5,
-    0x28, 0xD5, 0x28, 0xD5, 0x28, 0xD5, 0x28, 0xD5, 0x28, 0xD5, 0x28, 0xD5, 0x08, 0xD5, 0x08, 0xD5,
-    0x08, 0xD5, 0x08, 0xD5, 0x08, 0xD5, 0x08, 0xD5, 0x08, 0xD5, 0xE8, 0xD4, 0xE8, 0xD4, 0xE8, 0xD4,
-    0xE8, 0xCC, 0xE8, 0xCC, 0xE8, 0xCC, 0xE8, 0xCC, 0xE8, 0xCC, 0xE8, 0xCC, 0xE8, 0xD4, 0xE8, 0xD4,
-    0xE8, 0xCC, 0xE8, 0xCC, 0xE8, 0xCC, 0xE8, 0xCC, 0xE8, 0xCC, 0xC7, 0xCC, 0xC7, 0xCC, 0xC7, 0xCC,
-    0xA7, 0xC4, 0xA7, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0xA7, 0xC4, 0xC8, 0xCC,
-    0xC8, 0xCC, 0xE9, 0xCC, 0x29, 0xD5, 0x48, 0xAC, 0x65, 0x5A, 0xA4, 0x39, 0xE3, 0x18, 0x84, 0x39,
-    0xA9, 0xBC, 0x25, 0x52, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
-    0x85, 0x62, 0x28, 0xA4, 0x03, 0x21, 0xE3, 0x20, 0x05, 0x4A, 0xE6, 0x72, 0xA9, 0xBC, 0x05, 0x4A,
-    0xE5, 0x72, 0x87, 0xBC, 0x46, 0x83, 0x85, 0x6A, 0x87, 0xC4, 0x67, 0xC4, 0x87, 0xC4, 0x67, 0xC4,
-    0x67, 0xBC, 0x47, 0xBC, 0x47, 0xBC, 0x47, 0xBC, 0x47, 0xBC, 0x47, 0xBC, 0x67, 0xBC, 0x86, 0xC4,
-    0xA6, 0x9B, 0x00, 0x00, 0xA4, 0x39, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xA4, 0x41, 0xA4, 0x41,
-    0xA4, 0x41, 0xA4, 0x39, 0xA4, 0x39, 0x84, 0x39, 0x84, 0x39, 0x84, 0x39, 0x84, 0x39, 0x84, 0x39,
-    0xA4, 0x39, 0xA4, 0x39, 0xA4, 0x41, 0xA4, 0x41, 0xA4, 0x41, 0xA4, 0x41, 0xC4, 0x41, 0xC4, 0x41,
-    0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41,
-    0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x49, 0xC4, 0x49, 0xE4, 0x49,
-    0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49,
-    0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0x04, 0x4A, 0x04, 0x4A, 0x05, 0x52,
-    0x05, 0x52, 0x04, 0x52, 0x04, 0x52, 0x04, 0x52, 0x04, 0x52, 0x05, 0x52, 0x05, 0x52, 0x25, 0x52,
-    0x25, 0x52, 0x25, 0x52, 0x25, 0x52, 0x25, 0x52, 0x45, 0x52, 0x45, 0x5A, 0x45, 0x52, 0x45, 0x52,
-    0x45, 0x52, 0x45, 0x52, 0x25, 0x52, 0x45, 0x5A, 0x25, 0x52, 0x45, 0x5A, 0x45, 0x5A, 0x45, 0x5A,
-    0x45, 0x5A, 0x45, 0x5A, 0x45, 0x5A, 0x45, 0x5A, 0x45, 0x5A, 0x45, 0x5A, 0x45, 0x5A, 0x45, 0x5A,
-    0x45, 0x5A, 0x45, 0x52, 0x45, 0x5A, 0x85, 0x62, 0x46, 0x83, 0x29, 0xCD, 0x0A, 0xEE, 0xA9, 0xB4,
-    0x25, 0x52, 0xA4, 0x39, 0x84, 0x39, 0x64, 0x31, 0x64, 0x31, 0x44, 0x29, 0xFF, 0x06, 0x00, 0x44,
-    0x29, 0x44, 0x31, 0x64, 0x31, 0x63, 0x31, 0x65, 0x5A, 0x8B, 0xDD, 0x0C, 0xEE, 0x47, 0x7B, 0xA4,
-    0x41, 0xA4, 0x39, 0x64, 0x31, 0x44, 0x29, 0xFF, 0x0C, 0x00, 0x44, 0x31, 0x64, 0x31, 0x84, 0x39,
-    0x84, 0x39, 0x84, 0x39, 0xC4, 0x49, 0x25, 0x52, 0x45, 0x5A, 0x45, 0x52, 0x45, 0x52, 0x45, 0x5A,
-    0x45, 0x5A, 0x45, 0x5A, 0x65, 0x5A, 0x66, 0x5A, 0x65, 0x5A, 0x66, 0x5A, 0x65, 0x5A, 0x65, 0x5A,
-    0x45, 0x5A, 0x45, 0x5A, 0x25, 0x52, 0x25, 0x52, 0x25, 0x52, 0x25, 0x52, 0x25, 0x52, 0x25, 0x52,
-    0x25, 0x52, 0x45, 0x5A, 0x45, 0x5A, 0x45, 0x5A, 0x45, 0x5A, 0x45, 0x5A, 0x45, 0x5A, 0x45, 0x5A,
-    0x25, 0x52, 0x25, 0x52, 0x25, 0x52, 0x25, 0x52, 0x25, 0x52, 0x05, 0x52, 0x25, 0x52, 0x05, 0x52,
-    0x05, 0x52, 0x05, 0x52, 0x05, 0x52, 0x05, 0x52, 0x05, 0x52, 0x05, 0x52, 0x05, 0x4A, 0xE5, 0x49,
-    0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49,
-    0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49,
-    0xE4, 0x49, 0xE4, 0x49, 0xC4, 0x49, 0xC4, 0x49, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41,
-    0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41,
-    0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xA4, 0x41, 0xA4, 0x41, 0xA4, 0x39, 0x84, 0x39, 0x84, 0x39,
-    0x84, 0x39, 0x84, 0x39, 0x84, 0x39, 0xA4, 0x39, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xA7, 0x93,
-    0xA7, 0x8B, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xC4, 0x41, 0xA9, 0xBC, 0xC4, 0x41, 0xC3, 0x18,
-    0xE3, 0x18, 0xE3, 0x18, 0xE3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x25, 0x52, 0x28, 0xA4, 0x03, 0x21,
-    0xC3, 0x18, 0xC3, 0x18, 0x03, 0x21, 0x08, 0xA4, 0x25, 0x52, 0xE5, 0x72, 0x87, 0xBC, 0x26, 0x83,
-    0x85, 0x6A, 0xA7, 0xCC, 0x87, 0xC4, 0x87, 0xC4, 0x67, 0xC4, 0x47, 0xBC, 0x47, 0xBC, 0x47, 0xBC,
-    0x47, 0xBC, 0x47, 0xBC, 0x67, 0xC4, 0xC6, 0x9B, 0x85, 0x62, 0x05, 0x52, 0xFF, 0x7C, 0x00, 0x23,
-    0x29, 0x43, 0x29, 0x43, 0x29, 0x43, 0x29, 0x43, 0x29, 0x43, 0x29, 0x43, 0x29, 0x43, 0x29, 0x43,
-    0x29, 0x43, 0x29, 0x43, 0x29, 0x43, 0x29, 0x44, 0x29, 0x44, 0x29, 0x44, 0x31, 0x44, 0x31, 0x44,
-    0x31, 0x44, 0x31, 0x44, 0x31, 0x43, 0x31, 0x43, 0x31, 0x43, 0x31, 0x43, 0x31, 0x43, 0x31, 0x43,
-    0x31, 0x43, 0x31, 0x43, 0x31, 0x43, 0x31, 0x43, 0x31, 0x63, 0x31, 0x05, 0x52, 0xA9, 0xB4, 0x2C,
-    0xF6, 0x0A, 0xC5, 0x65, 0x5A, 0xA4, 0x41, 0x84, 0x39, 0x64, 0x31, 0x64, 0x31, 0x44, 0x31, 0x44,
-    0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x63, 0x31, 0xE4, 0x49, 0xE9, 0xC4, 0x0B, 0xEE, 0x87,
-    0x8B, 0xA4, 0x41, 0xA4, 0x39, 0x84, 0x39, 0x64, 0x31, 0xFF, 0x10, 0x00, 0x44, 0x31, 0x64, 0x31,
-    0x64, 0x31, 0x64, 0x39, 0x64, 0x31, 0x43, 0x31, 0x43, 0x29, 0x43, 0x29, 0x43, 0x31, 0x43, 0x31,
-    0x43, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x44, 0x31,
-    0x43, 0x31, 0x43, 0x29, 0xFF, 0x0C, 0x00, 0x44, 0x29, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44,
-    0x31, 0x44, 0x31, 0x43, 0x31, 0x43, 0x29, 0xFF, 0x7E, 0x00, 0xE6, 0x72, 0xA8, 0xBC, 0x06, 0x7B,
-    0x04, 0x4A, 0xC2, 0x18, 0x43, 0x29, 0x68, 0xB4, 0x24, 0x52, 0xC3, 0x10, 0xE3, 0x18, 0xE3, 0x18,
-    0xE3, 0x18, 0xE3, 0x18, 0xA3, 0x10, 0xA6, 0x6A, 0xC7, 0x93, 0xC3, 0x18, 0xE3, 0x20, 0x25, 0x52,
-    0x27, 0x7B, 0xCA, 0xC4, 0x05, 0x4A, 0xE5, 0x72, 0x87, 0xC4, 0x26, 0x83, 0x04, 0x52, 0xA6, 0x9B,
-    0x86, 0x9B, 0x66, 0x93, 0x66, 0x93, 0xC6, 0xA3, 0x26, 0xB4, 0x47, 0xBC, 0x67, 0xBC, 0x67, 0xBC,
-    0x87, 0xC4, 0x85, 0x62, 0xFF, 0x7E, 0x00, 0x43, 0x29, 0x43, 0x29, 0x43, 0x29, 0x44, 0x29, 0x43,
-    0x29, 0x43, 0x29, 0x00, 0x00, 0x43, 0x29, 0x43, 0x29, 0x43, 0x29, 0xFF, 0x04, 0x00, 0x43, 0x29,
-    0x43, 0x29, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31,
-    0x43, 0x31, 0x43, 0x31, 0x43, 0x29, 0x43, 0x29, 0x43, 0x29, 0x43, 0x31, 0x44, 0x31, 0x63, 0x31,
-    0x64, 0x31, 0x84, 0x39, 0x84, 0x39, 0x25, 0x52, 0x89, 0xB4, 0x4C, 0xF6, 0x2A, 0xCD, 0x65, 0x62,
-    0x84, 0x39, 0x64, 0x39, 0x64, 0x31, 0x64, 0x31, 0x64, 0x39, 0x84, 0x39, 0x84, 0x39, 0x84, 0x39,
-    0xC4, 0x41, 0x68, 0xAC, 0x0B, 0xEE, 0xE8, 0x9B, 0xA4, 0x39, 0x84, 0x39, 0x84, 0x39, 0x64, 0x31,
-    0x44, 0x29, 0xFF, 0x12, 0x00, 0x44, 0x29, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44,
-    0x29, 0x44, 0x31, 0x43, 0x31, 0x44, 0x31, 0x44, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64,
-    0x31, 0x64, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x29, 0x43, 0x29, 0xFF, 0x0C, 0x00, 0x44, 0x31,
-    0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x43, 0x31, 0x43, 0x29,
-    0xFF, 0x7C, 0x00, 0x64, 0x31, 0x85, 0x62, 0xA7, 0x93, 0x47, 0xAC, 0x43, 0x29, 0xA2, 0x10, 0x26,
-    0x7B, 0xA6, 0x93, 0xE3, 0x20, 0xE3, 0x18, 0xE3, 0x18, 0xE3, 0x18, 0xE3, 0x18, 0x44, 0x29, 0x08,
-    0xA4, 0x65, 0x62, 0x82, 0x10, 0xE4, 0x49, 0x89, 0xBC, 0xC8, 0x9B, 0xE7, 0x6A, 0x00, 0x00, 0x06,
-    0x7B, 0xA7, 0xCC, 0x66, 0x8B, 0xFF, 0x0A, 0x00, 0x63, 0x31, 0x66, 0x8B, 0x66, 0xBC, 0x66, 0xBC,
-    0x86, 0xC4, 0x87, 0xC4, 0x46, 0x8B, 0xFF, 0xA4, 0x00, 0x44, 0x29, 0xFF, 0x10, 0x00, 0x44, 0x29,
-    0x64, 0x31, 0x84, 0x39, 0x84, 0x39, 0xA4, 0x41, 0x05, 0x52, 0x69, 0xAC, 0x2C, 0xF6, 0x09, 0xCD,
-    0x45, 0x5A, 0x63, 0x31, 0x84, 0x39, 0x84, 0x39, 0x84, 0x39, 0xA4, 0x41, 0xA4, 0x41, 0xC4, 0x49,
-    0x08, 0x9C, 0x0B, 0xEE, 0x48, 0xAC, 0xA4, 0x39, 0x63, 0x31, 0x63, 0x31, 0x64, 0x31, 0x44, 0x29,
-    0xFF, 0x22, 0x00, 0x43, 0x29, 0x44, 0x29, 0x44, 0x29, 0x44, 0x29, 0x44, 0x29, 0x44, 0x29, 0xFF,
-    0xAC, 0x00, 0xA7, 0x93, 0x65, 0x5A, 0x82, 0x08, 0x43, 0x29, 0x07, 0xA4, 0x66, 0x8B, 0xA4, 0x39,
-    0x24, 0x29, 0x24, 0x29, 0xC5, 0x41, 0xC8, 0x9B, 0xA7, 0x93, 0xE3, 0x20, 0xA2, 0x10, 0x26, 0x83,
-    0x06, 0x7B, 0xFF, 0x06, 0x00, 0x65, 0x62, 0xA6, 0x93, 0x65, 0x62, 0xFF, 0x0C, 0x00, 0x84, 0x39,
-    0x06, 0xAC, 0x87, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x26, 0xB4, 0x84, 0x39, 0xFF, 0xB6, 0x00, 0x44,
-    0x31, 0x64, 0x31, 0x84, 0x31, 0x84, 0x39, 0xA4, 0x41, 0xE5, 0x49, 0x08, 0xA4, 0xEA, 0xED, 0xE8,
-    0xC4, 0x44, 0x5A, 0x63, 0x39, 0xA4, 0x41, 0xA4, 0x41, 0xC4, 0x41, 0xE4, 0x49, 0xA8, 0x93, 0x2C,
-    0xEE, 0x0A, 0xC5, 0xE4, 0x49, 0x63, 0x31, 0x63, 0x31, 0x44, 0x31, 0xFF, 0xDE, 0x00, 0x66, 0x8B,
-    0x66, 0x83, 0xA2, 0x10, 0x82, 0x10, 0x83, 0x39, 0xE7, 0x9B, 0xA9, 0xBC, 0x68, 0xAC, 0x69, 0xB4,
-    0xA9, 0xBC, 0xA7, 0x8B, 0x44, 0x31, 0xA2, 0x10, 0xE3, 0x20, 0xC7, 0x9B, 0x45, 0x5A, 0xFF, 0x1A,
-    0x00, 0x05, 0x7B, 0xA7, 0xC4, 0x87, 0xC4, 0x67, 0xBC, 0x47, 0xBC, 0xA5, 0x6A, 0xFF, 0xB8, 0x00,
-    0x64, 0x31, 0x64, 0x31, 0x84, 0x31, 0x84, 0x39, 0x84, 0x39, 0xA4, 0x41, 0xA7, 0x93, 0xCA, 0xED,
-    0x08, 0xCD, 0x85, 0x6A, 0xC4, 0x41, 0xC4, 0x41, 0xE4, 0x49, 0x87, 0x8B, 0x0C, 0xEE, 0x8B, 0xDD,
-    0x86, 0x62, 0x84, 0x39, 0x64, 0x31, 0x64, 0x31, 0xFF, 0xDE, 0x00, 0x83, 0x39, 0xE7, 0x9B, 0x84,
-    0x39, 0x82, 0x10, 0x82, 0x10, 0xA2, 0x10, 0x03, 0x21, 0x05, 0x4A, 0xC6, 0x6A, 0xA6, 0x6A, 0xE5,
-    0x49, 0x03, 0x21, 0xA3, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0x25, 0x52, 0xA7, 0x93, 0xFF, 0x1A, 0x00,
-    0xC4, 0x41, 0x46, 0xBC, 0x67, 0xBC, 0x47, 0xBC, 0x47, 0xB4, 0xA6, 0x9B, 0xFF, 0xBC, 0x00, 0x64,
-    0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x39, 0x87, 0x8B, 0xAA, 0xE5, 0xAA, 0xE5, 0x89,
-    0xB4, 0x08, 0xA4, 0x89, 0xB4, 0x0B, 0xEE, 0xCC, 0xDD, 0xE7, 0x72, 0xA4, 0x41, 0x84, 0x39, 0x64,
-    0x31, 0xFF, 0xE0, 0x00, 0xC4, 0x41, 0x07, 0xA4, 0x83, 0x31, 0x82, 0x10, 0xC4, 0x41, 0xE4, 0x49,
-    0x03, 0x21, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0x03, 0x21, 0x05, 0x52, 0xA4, 0x39,
-    0xA2, 0x18, 0x25, 0x52, 0x27, 0xAC, 0x63, 0x31, 0xFF, 0x1A, 0x00, 0x24, 0x5A, 0x64, 0x62, 0x44,
-    0x5A, 0x44, 0x5A, 0x24, 0x52, 0xFF, 0xC0, 0x00, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x64, 0x39,
-    0x06, 0x7B, 0x2A, 0xCD, 0x0C, 0xEE, 0x0B, 0xEE, 0xCB, 0xE5, 0xE9, 0xBC, 0xC6, 0x6A, 0xA4, 0x41,
-    0xA4, 0x39, 0x84, 0x31, 0x64, 0x31, 0xFF, 0xE2, 0x00, 0x65, 0x5A, 0xE7, 0x9B, 0x46, 0x83, 0x28,
-    0xAC, 0x68, 0xB4, 0x08, 0xA4, 0x05, 0x52, 0xC3, 0x18, 0xE3, 0x18, 0x65, 0x5A, 0xE8, 0x9B, 0x68,
-    0xB4, 0x28, 0xA4, 0x46, 0x83, 0x08, 0xA4, 0x04, 0x52, 0xFF, 0xEA, 0x00, 0x44, 0x31, 0x64, 0x31,
-    0x84, 0x39, 0x05, 0x52, 0xC6, 0x6A, 0xC6, 0x6A, 0x45, 0x5A, 0xA4, 0x41, 0x84, 0x39, 0x84, 0x39,
-    0x84, 0x31, 0x64, 0x31, 0x44, 0x29, 0xFF, 0xE4, 0x00, 0x65, 0x5A, 0x06, 0x7B, 0x84, 0x39, 0xA4,
-    0x39, 0x08, 0xA4, 0x67, 0x83, 0xC3, 0x18, 0x03, 0x21, 0x28, 0xA4, 0x67, 0x83, 0x64, 0x31, 0xE4,
-    0x49, 0x87, 0x8B, 0xE4, 0x49, 0xFF, 0xEC, 0x00, 0x44, 0x29, 0x64, 0x31, 0x64, 0x39, 0x84, 0x39,
-    0x84, 0x39, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0xFF, 0xF0,
-    0x00, 0x66, 0x5A, 0x48, 0xAC, 0x45, 0x5A, 0x85, 0x6A, 0x27, 0xAC, 0x64, 0x31, 0xFF, 0xF8, 0x00,
-    0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x44, 0x31, 0xFF, 0xFA, 0x00, 0x47, 0x83, 0x87,
-    0x93, 0xA7, 0x93, 0xC5, 0x72, 0xFF, 0xFC, 0x00, 0x64, 0x31, 0x64, 0x29, 0xFF, 0xFF, 0x00, 0xFF,
-    0x19, 0x00
+    0xFF, 0x12, 0x00, 0x41, 0xA4, 0x62, 0x45, 0x5A, 0x45, 0x39, 0xA4, 0xFF, 0xFF, 0x00, 0xFF, 0xFD,
+    0x00, 0x6A, 0xA5, 0xBC, 0x88, 0xCC, 0xC8, 0xCC, 0xC8, 0xC4, 0x87, 0x72, 0xC5, 0xFF, 0x14, 0x00,
+    0x31, 0x86, 0x31, 0x86, 0xFF, 0x06, 0x00, 0x31, 0x86, 0x31, 0xA6, 0x31, 0xA6, 0xFF, 0x18, 0x00,
+    0x31, 0x86, 0x31, 0xA6, 0x31, 0xA6, 0x31, 0xA6, 0x31, 0x86, 0xFF, 0x12, 0x00, 0x31, 0x86, 0x31,
+    0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0xA6, 0x31, 0xA6, 0x31, 0x86, 0xFF,
+    0x18, 0x00, 0x39, 0xE7, 0x52, 0xAA, 0x5A, 0xEB, 0x52, 0xAA, 0x39, 0xE7, 0xFF, 0x12, 0x00, 0x31,
+    0x86, 0xFF, 0x10, 0x00, 0x39, 0xE7, 0x52, 0x6A, 0x5A, 0xCB, 0x5A, 0xCB, 0x52, 0x8A, 0x39, 0xC7,
+    0xFF, 0x0C, 0x00, 0x31, 0x86, 0x31, 0x86, 0x31, 0xA6, 0x31, 0x86, 0xFF, 0x12, 0x00, 0x39, 0xE7,
+    0x52, 0x69, 0x52, 0xAA, 0x52, 0xAA, 0x4A, 0x49, 0x31, 0xA6, 0xFF, 0x12, 0x00, 0x31, 0xA6, 0x39,
+    0xC7, 0x39, 0xC7, 0xFF, 0x0E, 0x00, 0x31, 0x86, 0x39, 0xC7, 0x39, 0xC7, 0x39, 0xC7, 0xFF, 0x16,
+    0x00, 0x31, 0x86, 0x39, 0xC7, 0x39, 0xC7, 0x39, 0xC7, 0x39, 0xC7, 0x31, 0xA6, 0x31, 0xA6, 0x31,
+    0xA6, 0x31, 0x86, 0xFF, 0x1A, 0x00, 0x39, 0xE7, 0x52, 0xAA, 0x5A, 0xCB, 0x52, 0x8A, 0x39, 0xE7,
+    0xFF, 0x14, 0x00, 0x31, 0x85, 0x00, 0x00, 0x31, 0x85, 0xFF, 0x1E, 0x00, 0x31, 0x86, 0x31, 0x86,
+    0x31, 0x86, 0x31, 0x86, 0x31, 0xA6, 0x31, 0xA6, 0x31, 0xA6, 0x31, 0x86, 0xFF, 0x48, 0x00, 0x41,
+    0xC4, 0xAC, 0x07, 0x9B, 0xA6, 0xCC, 0xC8, 0xCC, 0xC8, 0xCC, 0xE8, 0xCC, 0xC8, 0x52, 0x25, 0xFF,
+    0x10, 0x00, 0x39, 0xC7, 0xCE, 0x59, 0xDE, 0xFB, 0xDE, 0xDB, 0xD6, 0xBB, 0xDE, 0xDB, 0xDE, 0xFB,
+    0xDE, 0xFB, 0xDE, 0xFB, 0xCE, 0x79, 0xAD, 0x55, 0x6B, 0x6D, 0xFF, 0x0A, 0x00, 0x63, 0x2C, 0xD6,
+    0xBA, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xDA, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xD6, 0xBA, 0xC6,
+    0x18, 0x94, 0xB2, 0x52, 0x8A, 0xFF, 0x0A, 0x00, 0x52, 0x8A, 0xD6, 0x9A, 0xDE, 0xDB, 0xDE, 0xDB,
+    0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xDA, 0xDE, 0xDB, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0x9A,
+    0xC6, 0x58, 0x42, 0x28, 0xFF, 0x0A, 0x00, 0x31, 0xA7, 0x7B, 0xCF, 0xBD, 0xF7, 0xE7, 0x1C, 0xF7,
+    0x7E, 0xF7, 0xBE, 0xF7, 0x9E, 0xE7, 0x1C, 0xB5, 0x96, 0x63, 0x2C, 0xFF, 0x08, 0x00, 0x5A, 0xEB,
+    0xCE, 0x9A, 0xD6, 0x9A, 0xD6, 0xBA, 0xB5, 0x96, 0x29, 0x85, 0xFF, 0x08, 0x00, 0x6B, 0x6D, 0xBD,
+    0xD7, 0xE7, 0x1C, 0xEF, 0x9E, 0xF7, 0xBE, 0xF7, 0xBE, 0xEF, 0x7D, 0xDE, 0xDB, 0xAD, 0x55, 0x63,
+    0x0C, 0xFF, 0x06, 0x00, 0x4A, 0x49, 0xCE, 0x79, 0xD6, 0xBA, 0xD6, 0xDB, 0xC6, 0x18, 0x31, 0xA7,
+    0xFF, 0x0C, 0x00, 0x6B, 0x4D, 0xB5, 0x96, 0xE7, 0x1C, 0xF7, 0x9E, 0xEF, 0xBE, 0xEF, 0xBE, 0xEF,
+    0x7D, 0xD6, 0x9A, 0x94, 0x92, 0x42, 0x08, 0xFF, 0x0C, 0x00, 0x84, 0x30, 0xDE, 0xFB, 0xDE, 0xFB,
+    0xDE, 0xDB, 0x73, 0x8E, 0xFF, 0x0C, 0x00, 0xA5, 0x14, 0xDF, 0x1C, 0xDE, 0xFB, 0xDE, 0xFB, 0x73,
+    0x8E, 0xFF, 0x14, 0x00, 0xAD, 0x75, 0xE7, 0x1C, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB,
+    0xDE, 0xFB, 0xDE, 0xDB, 0xD6, 0xBA, 0xBD, 0xD7, 0x84, 0x10, 0x39, 0xC7, 0xFF, 0x10, 0x00, 0x63,
+    0x2C, 0xAD, 0x76, 0xDF, 0x1C, 0xF7, 0x9E, 0xF7, 0xBE, 0xF7, 0x9E, 0xE7, 0x3C, 0xC6, 0x38, 0x84,
+    0x10, 0x39, 0xC7, 0xFF, 0x0C, 0x00, 0xB5, 0xD6, 0xD6, 0xDB, 0xD6, 0xBA, 0xD6, 0xBA, 0x5B, 0x0B,
+    0xFF, 0x0A, 0x00, 0x63, 0x0C, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0xBB, 0xA5, 0x34, 0xFF, 0x06, 0x00,
+    0x84, 0x30, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB,
+    0xD6, 0xDA, 0xC6, 0x18, 0x94, 0x92, 0x4A, 0x49, 0xFF, 0x42, 0x00, 0x72, 0xC5, 0x7A, 0xE5, 0x49,
+    0xC4, 0xC4, 0xA8, 0xCC, 0xE8, 0xCC, 0xE8, 0xD5, 0x08, 0x8B, 0x46, 0xFF, 0x10, 0x00, 0x39, 0xC7,
+    0xE7, 0x1C, 0xFF, 0x12, 0xFF, 0xF7, 0xBE, 0xBD, 0xF7, 0x42, 0x29, 0xFF, 0x06, 0x00, 0x7B, 0xCF,
+    0xFF, 0x14, 0xFF, 0xEF, 0x5D, 0xA4, 0xF4, 0x31, 0x86, 0xFF, 0x06, 0x00, 0x5A, 0xEB, 0xF7, 0xBE,
+    0xFF, 0x14, 0xFF, 0xF7, 0x9E, 0x52, 0x89, 0xFF, 0x08, 0x00, 0x5A, 0xCB, 0xCE, 0x79, 0xFF, 0x10,
+    0xFF, 0xF7, 0xBE, 0xA5, 0x34, 0x39, 0xC7, 0xFF, 0x04, 0x00, 0x6B, 0x6D, 0xF7, 0xDF, 0xFF, 0x04,
+    0xFF, 0xD6, 0xBA, 0x31, 0x86, 0xFF, 0x04, 0x00, 0x31, 0x86, 0x9C, 0xF3, 0xF7, 0xBE, 0xFF, 0x10,
+    0xFF, 0xEF, 0x5D, 0x52, 0xAA, 0xFF, 0x04, 0x00, 0x52, 0xAA, 0xF7, 0x9E, 0xFF, 0x04, 0xFF, 0xE7,
+    0x3C, 0x39, 0xE7, 0xFF, 0x08, 0x00, 0x31, 0xA6, 0xA5, 0x34, 0xF7, 0xBE, 0xFF, 0x10, 0xFF, 0xD6,
+    0xBA, 0x63, 0x2C, 0xFF, 0x0A, 0x00, 0x9C, 0xD3, 0xFF, 0x06, 0xFF, 0xE7, 0x3C, 0x5A, 0xEB, 0xFF,
+    0x0A, 0x00, 0xB5, 0xB6, 0xFF, 0x06, 0xFF, 0x84, 0x10, 0xFF, 0x14, 0x00, 0xC6, 0x38, 0xFF, 0x12,
+    0xFF, 0xF7, 0xFF, 0x00, 0xD6, 0xBA, 0x63, 0x2C, 0xFF, 0x0A, 0x00, 0x42, 0x28, 0xB5, 0xB6, 0xF7,
+    0x9E, 0xFF, 0x10, 0xFF, 0xCE, 0x9A, 0x5A, 0xCB, 0xFF, 0x08, 0x00, 0x29, 0x85, 0xD6, 0xDB, 0xFF,
+    0x06, 0xFF, 0x6B, 0x6D, 0xFF, 0x0A, 0x00, 0x6B, 0x6D, 0xFF, 0x00, 0xDF, 0xFF, 0x04, 0xFF, 0xBE,
+    0x18, 0xFF, 0x06, 0x00, 0x94, 0xB2, 0xFF, 0x14, 0xFF, 0xE7, 0x5D, 0x8C, 0x51, 0xFF, 0x40, 0x00,
+    0x83, 0x05, 0x6A, 0xA5, 0x62, 0x65, 0xCC, 0xC8, 0xCC, 0xE8, 0xCC, 0xE8, 0xD5, 0x08, 0x93, 0xA7,
+    0xFF, 0x10, 0x00, 0x31, 0xA6, 0xDE, 0xFB, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xFF, 0x00,
+    0xDF, 0xFF, 0x0D, 0xFF, 0xDF, 0xFF, 0x00, 0xFF, 0x00, 0xD6, 0x9A, 0x42, 0x07, 0xFF, 0x04, 0x00,
+    0x7B, 0xCF, 0xFF, 0x11, 0xFF, 0xDF, 0xF7, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xFF, 0x00, 0xAD,
+    0x55, 0xFF, 0x06, 0x00, 0x5A, 0xCB, 0xF7, 0xBE, 0xFF, 0x09, 0xFF, 0xDF, 0xFF, 0x00, 0xDF, 0xFF,
+    0x08, 0xFF, 0xF7, 0xBE, 0x52, 0xAA, 0xFF, 0x06, 0x00, 0x52, 0xAA, 0xE7, 0x1C, 0xFF, 0x16, 0xFF,
+    0xA5, 0x55, 0xFF, 0x04, 0x00, 0x6B, 0x6D, 0xF7, 0xDF, 0xFF, 0x04, 0xFF, 0xD6, 0xBA, 0x31, 0x86,
+    0xFF, 0x04, 0x00, 0x7B, 0xCF, 0xFF, 0x00, 0xDF, 0xFF, 0x07, 0xFF, 0xDF, 0xF7, 0xBE, 0xF7, 0xBE,
+    0xFF, 0x06, 0xFF, 0xD6, 0xBA, 0x31, 0xA6, 0xFF, 0x04, 0x00, 0x5A, 0xCB, 0xF7, 0xBE, 0xFF, 0x04,
+    0xFF, 0xE7, 0x3C, 0x42, 0x08, 0xFF, 0x06, 0x00, 0x31, 0xA6, 0xBD, 0xD7, 0xFF, 0x16, 0xFF, 0xE7,
+    0x5D, 0x73, 0x8E, 0xFF, 0x08, 0x00, 0xA5, 0x14, 0xFF, 0x08, 0xFF, 0xD6, 0xBA, 0x42, 0x28, 0xFF,
+    0x08, 0x00, 0xB5, 0xB6, 0xFF, 0x06, 0xFF, 0x84, 0x30, 0xFF, 0x14, 0x00, 0xC6, 0x18, 0xFF, 0x12,
+    0xFF, 0xF7, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xEF, 0x5D, 0x5A, 0xEB, 0xFF, 0x06, 0x00, 0x42,
+    0x28, 0xCE, 0x79, 0xFF, 0x16, 0xFF, 0xE7, 0x3C, 0x5A, 0xEB, 0xFF, 0x06, 0x00, 0x31, 0x86, 0xDE,
+    0xDB, 0xFF, 0x06, 0xFF, 0x6B, 0x6D, 0xFF, 0x0A, 0x00, 0x6B, 0x6D, 0xFF, 0x00, 0xDF, 0xFF, 0x04,
+    0xFF, 0xBE, 0x17, 0xFF, 0x06, 0x00, 0x94, 0x92, 0xFF, 0x13, 0xFF, 0xDF, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xDF, 0x8C, 0x51, 0xFF, 0x3E, 0x00, 0x7A, 0xE5, 0x72, 0xC5, 0x62, 0x85, 0xCC, 0xC8,
+    0xCC, 0xE8, 0xCC, 0xE8, 0xD5, 0x09, 0x93, 0x87, 0xFF, 0x10, 0x00, 0x31, 0x86, 0xDE, 0xDB, 0xFF,
+    0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xF7, 0xBE, 0xA5, 0x14, 0x84, 0x30, 0x8C, 0x51, 0x94, 0x92, 0xC6,
+    0x38, 0xF7, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x04, 0xFF, 0x94, 0xB2, 0xFF, 0x04, 0x00, 0x73, 0xAE,
+    0xFF, 0x06, 0xFF, 0xE7, 0x1C, 0x8C, 0x71, 0x84, 0x30, 0x84, 0x30, 0x94, 0x92, 0xCE, 0x7A, 0xFF,
+    0x00, 0xDF, 0xFF, 0x04, 0xFF, 0xF7, 0xBE, 0x62, 0xEC, 0xFF, 0x04, 0x00, 0x52, 0xAA, 0xF7, 0x9E,
+    0xFF, 0x04, 0xFF, 0xEF, 0x9D, 0x8C, 0x71, 0x73, 0xCE, 0x7B, 0xCF, 0x7B, 0xEF, 0x84, 0x10, 0x84,
+    0x30, 0x84, 0x30, 0x84, 0x10, 0x39, 0xC7, 0xFF, 0x04, 0x00, 0x39, 0xA7, 0xCE, 0x79, 0xFF, 0x07,
+    0xFF, 0xDF, 0xC6, 0x38, 0x8C, 0x51, 0x73, 0xAE, 0x8C, 0x51, 0xC6, 0x38, 0xF7, 0xDE, 0xFF, 0x00,
+    0xFF, 0x00, 0xE7, 0x3C, 0x6B, 0x6D, 0xFF, 0x04, 0x00, 0x73, 0x8E, 0xFF, 0x00, 0xDF, 0xFF, 0x04,
+    0xFF, 0xD6, 0x9A, 0xFF, 0x06, 0x00, 0xC6, 0x17, 0xFF, 0x05, 0xFF, 0xDF, 0xC6, 0x38, 0x6B, 0x6D,
+    0x5A, 0xCB, 0x5A, 0xEB, 0x73, 0xAE, 0xA5, 0x34, 0xDE, 0xFB, 0x94, 0xD2, 0xFF, 0x06, 0x00, 0x5A,
+    0xCB, 0xF7, 0xBE, 0xFF, 0x04, 0xFF, 0xE7, 0x3C, 0x42, 0x08, 0xFF, 0x06, 0x00, 0xA5, 0x55, 0xFF,
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xFF, 0x04, 0xFF, 0xDE, 0xDB, 0x9C, 0xD3, 0x7B, 0xEF, 0x84,
+    0x30, 0xBD, 0xD6, 0xEF, 0x9E, 0xF7, 0xFF, 0x00, 0xF7, 0xFF, 0x00, 0xF7, 0xFF, 0x00, 0xE7, 0x3C,
+    0x52, 0xAA, 0xFF, 0x06, 0x00, 0xA5, 0x14, 0xFF, 0x0A, 0xFF, 0xBD, 0xD7, 0x31, 0x85, 0xFF, 0x06,
+    0x00, 0xB5, 0xD6, 0xFF, 0x06, 0xFF, 0x84, 0x30, 0xFF, 0x14, 0x00, 0xBD, 0xF8, 0xFF, 0x06, 0xFF,
+    0xBD, 0xF7, 0x84, 0x30, 0x84, 0x30, 0x8C, 0x51, 0xAD, 0x55, 0xEF, 0x7D, 0xFF, 0x06, 0xFF, 0xB5,
+    0xB6, 0xFF, 0x06, 0x00, 0xB5, 0x96, 0xFF, 0x08, 0xFF, 0xCE, 0x79, 0x8C, 0x51, 0x73, 0x8E, 0x84,
+    0x30, 0xBD, 0xF7, 0xF7, 0xBE, 0xFF, 0x06, 0xFF, 0xD6, 0xBA, 0x39, 0xC7, 0xFF, 0x04, 0x00, 0x31,
+    0xC7, 0xDE, 0xFB, 0xFF, 0x05, 0xFF, 0xDF, 0x6B, 0x4D, 0xFF, 0x0A, 0x00, 0x73, 0xAE, 0xFF, 0x06,
+    0xFF, 0xC6, 0x18, 0xFF, 0x06, 0x00, 0x94, 0x92, 0xFF, 0x06, 0xFF, 0xD6, 0x9A, 0x7B, 0xEF, 0x7B,
+    0xEF, 0x7B, 0xEF, 0x94, 0xB2, 0xDE, 0xDB, 0xFF, 0x06, 0xFF, 0xE7, 0x1C, 0x42, 0x08, 0xFF, 0x3C,
+    0x00, 0x72, 0xC5, 0x83, 0x05, 0x62, 0x65, 0xCC, 0xC8, 0xCC, 0xC8, 0xCC, 0xE8, 0xD5, 0x08, 0x83,
+    0x46, 0xFF, 0x10, 0x00, 0x31, 0x86, 0xDE, 0xDB, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xF7, 0x9E,
+    0x52, 0xAA, 0x18, 0xC3, 0x18, 0xE3, 0x18, 0xE3, 0x29, 0x65, 0xB5, 0x96, 0xFF, 0x06, 0xFF, 0xC6,
+    0x58, 0xFF, 0x04, 0x00, 0x6B, 0x8E, 0xF7, 0xDF, 0xFF, 0x04, 0xFF, 0xCE, 0x79, 0x29, 0x45, 0x18,
+    0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x42, 0x08, 0xD6, 0xBA, 0xFF, 0x06, 0xFF, 0x94, 0x92, 0xFF, 0x04,
+    0x00, 0x52, 0x8A, 0xEF, 0x7E, 0xFF, 0x04, 0xFF, 0xE7, 0x3C, 0x39, 0xC7, 0xFF, 0x14, 0x00, 0x94,
+    0x92, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xF7, 0x9E, 0x8C, 0x71, 0x31, 0x86,
+    0xFF, 0x08, 0x00, 0x8C, 0x71, 0xD6, 0xBA, 0x5A, 0xEB, 0xFF, 0x06, 0x00, 0x6B, 0x6D, 0xFF, 0x00,
+    0xDF, 0xFF, 0x04, 0xFF, 0xD6, 0x9A, 0xFF, 0x04, 0x00, 0x31, 0x86, 0xD6, 0xBA, 0xFF, 0x05, 0xFF,
+    0xDF, 0x6B, 0x6D, 0xFF, 0x0A, 0x00, 0x39, 0xE7, 0x39, 0xE7, 0xFF, 0x06, 0x00, 0x5A, 0xCB, 0xF7,
+    0xBE, 0xFF, 0x04, 0xFF, 0xE7, 0x3C, 0x42, 0x28, 0xFF, 0x04, 0x00, 0x6B, 0x2D, 0xF7, 0xBE, 0xFF,
+    0x04, 0xFF, 0xF7, 0xDF, 0xAD, 0x75, 0x39, 0xC7, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x24,
+    0x6B, 0x8D, 0xE7, 0x5D, 0xF7, 0xFF, 0x05, 0xFF, 0xB5, 0xB6, 0xFF, 0x06, 0x00, 0xA5, 0x34, 0xFF,
+    0x0A, 0xFF, 0xF7, 0xDF, 0x9C, 0xF3, 0xFF, 0x06, 0x00, 0xBD, 0xD7, 0xFF, 0x06, 0xFF, 0x84, 0x10,
+    0xFF, 0x14, 0x00, 0xBD, 0xF8, 0xFF, 0x06, 0xFF, 0x8C, 0x51, 0x18, 0xE3, 0x21, 0x04, 0x21, 0x04,
+    0x21, 0x24, 0x84, 0x0F, 0xF7, 0xDF, 0xFF, 0x04, 0xFF, 0xDF, 0x1C, 0x31, 0xC6, 0x00, 0x00, 0x63,
+    0x2C, 0xF7, 0x9E, 0xFF, 0x06, 0xFF, 0xAD, 0x55, 0x31, 0xA6, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xE3,
+    0x29, 0x45, 0x7B, 0xCF, 0xEF, 0x7D, 0xF7, 0xFF, 0x00, 0xF7, 0xDF, 0xFF, 0x00, 0xFF, 0x00, 0x94,
+    0xD2, 0xFF, 0x04, 0x00, 0x39, 0xC7, 0xDE, 0xFB, 0xFF, 0x05, 0xFF, 0xDF, 0x63, 0x2C, 0xFF, 0x0A,
+    0x00, 0x73, 0xAE, 0xFF, 0x06, 0xFF, 0xC6, 0x38, 0xFF, 0x06, 0x00, 0x94, 0xB2, 0xFF, 0x06, 0xFF,
+    0xAD, 0x75, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xC2, 0x52, 0xAA, 0xEF, 0x5D, 0xFF, 0x06,
+    0xFF, 0x6B, 0x6D, 0xFF, 0x3C, 0x00, 0x6A, 0xA5, 0x8B, 0x46, 0x62, 0x65, 0xCC, 0xA8, 0xCC, 0xC8,
+    0xCC, 0xC8, 0xCC, 0xE8, 0x7B, 0x06, 0xFF, 0x10, 0x00, 0x31, 0x86, 0xDE, 0xDB, 0xFF, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0xDF, 0xF7, 0x9E, 0x52, 0xCB, 0x18, 0xC3, 0x18, 0xE3, 0x21, 0x03, 0x18, 0xE3,
+    0x6B, 0x6D, 0xFF, 0x00, 0xDF, 0xFF, 0x04, 0xFF, 0xD6, 0xBA, 0xFF, 0x04, 0x00, 0x6B, 0x6D, 0xF7,
+    0xBF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xFF, 0x00, 0xCE, 0x9A, 0x29, 0x45, 0x18, 0xE3, 0x18, 0xE3,
+    0x21, 0x04, 0x21, 0x04, 0xA5, 0x14, 0xFF, 0x06, 0xFF, 0xA5, 0x14, 0xFF, 0x04, 0x00, 0x4A, 0x69,
+    0xEF, 0x7D, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xFF, 0x00, 0xE7, 0x3C, 0x39, 0xE7, 0xFF, 0x12, 0x00,
+    0x39, 0xC7, 0xDE, 0xDB, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0x9C, 0xF4,
+    0xFF, 0x0E, 0x00, 0x39, 0xC7, 0xFF, 0x08, 0x00, 0x6B, 0x6D, 0xFF, 0x00, 0xDF, 0xFF, 0x04, 0xFF,
+    0xD6, 0x9A, 0x31, 0x86, 0x00, 0x00, 0x31, 0x86, 0xD6, 0x9A, 0xFF, 0x06, 0xFF, 0xBD, 0xF7, 0x5A,
+    0xAA, 0x31, 0x86, 0xFF, 0x10, 0x00, 0x5A, 0xCB, 0xF7, 0xBE, 0xFF, 0x04, 0xFF, 0xE7, 0x3C, 0x42,
+    0x08, 0xFF, 0x04, 0x00, 0xAD, 0x75, 0xFF, 0x06, 0xFF, 0xCE, 0x79, 0x31, 0xA6, 0x18, 0xE3, 0x21,
+    0x24, 0x21, 0x24, 0x21, 0x24, 0x18, 0xE3, 0x18, 0xE3, 0x8C, 0x50, 0xF7, 0xFF, 0x05, 0xFF, 0xEF,
+    0x5D, 0x4A, 0x69, 0xFF, 0x04, 0x00, 0xA5, 0x14, 0xFF, 0x06, 0xFF, 0xF7, 0xFF, 0x05, 0xFF, 0xF7,
+    0xBE, 0x84, 0x10, 0xFF, 0x04, 0x00, 0xBD, 0xF7, 0xFF, 0x06, 0xFF, 0x84, 0x10, 0xFF, 0x14, 0x00,
+    0xBE, 0x18, 0xFF, 0x06, 0xFF, 0x84, 0x50, 0x18, 0xE3, 0x21, 0x04, 0x21, 0x24, 0x21, 0x04, 0x42,
+    0x28, 0xE7, 0x5C, 0xFF, 0x04, 0xFF, 0xEF, 0x7D, 0x42, 0x49, 0x00, 0x00, 0xAD, 0x76, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xFF, 0x00, 0xCE, 0x59, 0x31, 0xA6, 0x21, 0x04, 0x21,
+    0x04, 0x21, 0x04, 0x21, 0x04, 0x18, 0xE3, 0x18, 0xE3, 0x94, 0xB2, 0xFF, 0x06, 0xFF, 0xDE, 0xFB,
+    0x39, 0xE7, 0x00, 0x00, 0x39, 0xE7, 0xDE, 0xFB, 0xFF, 0x04, 0xFF, 0xF7, 0xBF, 0x63, 0x2C, 0xFF,
+    0x0A, 0x00, 0x7B, 0xCF, 0xFF, 0x06, 0xFF, 0xC6, 0x58, 0xFF, 0x06, 0x00, 0x94, 0xB2, 0xFF, 0x06,
+    0xFF, 0xAD, 0x75, 0x18, 0xE3, 0x18, 0xE3, 0x18, 0xE3, 0x18, 0xE3, 0x29, 0x45, 0xC6, 0x38, 0xFF,
+    0x06, 0xFF, 0x7B, 0xF0, 0xFF, 0x3C, 0x00, 0x62, 0x65, 0x9B, 0xA6, 0x62, 0x65, 0xC4, 0xA7, 0xCC,
+    0xA7, 0xCC, 0xC8, 0xCC, 0xC8, 0x62, 0x85, 0xFF, 0x10, 0x00, 0x31, 0x86, 0xDE, 0xDB, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xF7, 0x9E, 0x52, 0xAA, 0x10, 0xA2, 0x18, 0xC3, 0x18, 0xE3, 0x18,
+    0xC3, 0x73, 0x8E, 0xFF, 0x06, 0xFF, 0xD6, 0xBA, 0xFF, 0x04, 0x00, 0x6B, 0x6D, 0xF7, 0xBF, 0xFF,
+    0x00, 0xDF, 0xFF, 0x00, 0xFF, 0x00, 0xCE, 0x79, 0x29, 0x45, 0x18, 0xC3, 0x18, 0xE3, 0x21, 0x04,
+    0x21, 0x04, 0xAD, 0x55, 0xFF, 0x06, 0xFF, 0x9C, 0xD3, 0xFF, 0x04, 0x00, 0x52, 0x8A, 0xEF, 0x9E,
+    0xFF, 0x04, 0xFF, 0xEF, 0x9E, 0xB5, 0xB6, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD,
+    0x75, 0xAD, 0x55, 0x4A, 0x49, 0xFF, 0x04, 0x00, 0x5A, 0xCB, 0xF7, 0xBE, 0xFF, 0x04, 0xFF, 0xEF,
+    0x9D, 0x52, 0x8A, 0xFF, 0x18, 0x00, 0x6B, 0x6D, 0xFF, 0x00, 0xDF, 0xFF, 0x04, 0xFF, 0xD6, 0xBA,
+    0x31, 0x86, 0xFF, 0x04, 0x00, 0xAD, 0x34, 0xFF, 0x08, 0xFF, 0xEF, 0x9D, 0xCE, 0x59, 0x9C, 0xF3,
+    0x6B, 0x6D, 0x42, 0x08, 0xFF, 0x0A, 0x00, 0x5A, 0xCB, 0xF7, 0x9E, 0xFF, 0x04, 0xFF, 0xE7, 0x3C,
+    0x39, 0xE7, 0x00, 0x00, 0x31, 0xA6, 0xD6, 0xBA, 0xFF, 0x06, 0xFF, 0x8C, 0x51, 0x18, 0xE3, 0x21,
+    0x04, 0x21, 0x24, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x18, 0xE3, 0x42, 0x08, 0xE7, 0x3C, 0xFF,
+    0x06, 0xFF, 0x73, 0x8E, 0xFF, 0x04, 0x00, 0xA4, 0xF3, 0xFF, 0x04, 0xFF, 0xF7, 0xFF, 0x00, 0xF7,
+    0xBE, 0xF7, 0xDF, 0xFF, 0x04, 0xFF, 0xEF, 0x7D, 0x63, 0x2C, 0x00, 0x00, 0xBD, 0xF7, 0xFF, 0x06,
+    0xFF, 0x7B, 0xEF, 0xFF, 0x14, 0x00, 0xC6, 0x18, 0xFF, 0x06, 0xFF, 0x84, 0x30, 0x18, 0xC3, 0x19,
+    0x03, 0x21, 0x04, 0x19, 0x03, 0x4A, 0x69, 0xEF, 0x7D, 0xFF, 0x04, 0xFF, 0xEF, 0x7D, 0x42, 0x49,
+    0x31, 0x86, 0xDE, 0xDB, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xFF, 0x00, 0x7B,
+    0xCF, 0x20, 0xE4, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x18, 0xE3, 0x18, 0xC3, 0x4A,
+    0x49, 0xEF, 0x7D, 0xFF, 0x04, 0xFF, 0xF7, 0xBE, 0x5B, 0x0C, 0x00, 0x00, 0x39, 0xC7, 0xDE, 0xFB,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xF7, 0xBF, 0x63, 0x2C, 0xFF, 0x0A, 0x00, 0x73, 0xAE,
+    0xFF, 0x06, 0xFF, 0xCE, 0x59, 0xFF, 0x06, 0x00, 0x9C, 0xD3, 0xFF, 0x06, 0xFF, 0xAD, 0x75, 0x18,
+    0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xE3, 0x29, 0x45, 0xCE, 0x79, 0xFF, 0x06, 0xFF, 0x7B, 0xCF,
+    0xFF, 0x3C, 0x00, 0x52, 0x05, 0xBC, 0x67, 0xAC, 0x27, 0xC4, 0xA7, 0xC4, 0xA7, 0xC4, 0xA7, 0xC4,
+    0xA7, 0x52, 0x04, 0xFF, 0x10, 0x00, 0x31, 0xA6, 0xDE, 0xFB, 0xFF, 0x04, 0xFF, 0xEF, 0x9E, 0x52,
+    0xAA, 0x10, 0xA2, 0x18, 0xC3, 0x18, 0xE3, 0x39, 0xE7, 0xC6, 0x18, 0xFF, 0x06, 0xFF, 0xBD, 0xF7,
+    0xFF, 0x04, 0x00, 0x6B, 0x8E, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xFF, 0x00, 0xCE,
+    0x79, 0x29, 0x45, 0x18, 0xE3, 0x18, 0xE4, 0x21, 0x24, 0x5A, 0xEB, 0xE7, 0x1C, 0xFF, 0x06, 0xFF,
+    0x7B, 0xCF, 0xFF, 0x04, 0x00, 0x52, 0xAA, 0xEF, 0x9E, 0xFF, 0x05, 0xFF, 0xDF, 0xFF, 0x0D, 0xFF,
+    0xDF, 0x63, 0x0C, 0xFF, 0x04, 0x00, 0x6B, 0x2D, 0xFF, 0x00, 0xDF, 0xFF, 0x04, 0xFF, 0xE7, 0x1C,
+    0x39, 0xE7, 0xFF, 0x18, 0x00, 0x73, 0x8E, 0xFF, 0x00, 0xDF, 0xFF, 0x04, 0xFF, 0xD6, 0xBA, 0x31,
+    0xA6, 0xFF, 0x04, 0x00, 0x4A, 0x69, 0xD6, 0xBA, 0xFF, 0x0C, 0xFF, 0xF7, 0xDE, 0xE7, 0x3C, 0xB5,
+    0x96, 0x5A, 0xCB, 0xFF, 0x06, 0x00, 0x5A, 0xCB, 0xF7, 0x9E, 0xFF, 0x04, 0xFF, 0xDE, 0xFC, 0x39,
+    0xC7, 0x00, 0x00, 0x39, 0xE7, 0xE7, 0x1C, 0xFF, 0x05, 0xFF, 0xDF, 0x6B, 0x4D, 0x21, 0x04, 0x21,
+    0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x24, 0x31, 0x86, 0xD6, 0x9A, 0xFF,
+    0x06, 0xFF, 0x84, 0x10, 0xFF, 0x04, 0x00, 0x9C, 0xD3, 0xFF, 0x00, 0xFF, 0x00, 0xF7, 0xFF, 0x00,
+    0xF7, 0xFF, 0x00, 0xBD, 0xD7, 0xCE, 0x59, 0xFF, 0x06, 0xFF, 0xD6, 0xDB, 0x4A, 0x8A, 0xBD, 0xF7,
+    0xFF, 0x06, 0xFF, 0x7B, 0xEF, 0xFF, 0x14, 0x00, 0xC6, 0x38, 0xFF, 0x06, 0xFF, 0x84, 0x30, 0x18,
+    0xC3, 0x18, 0xE3, 0x21, 0x04, 0x39, 0xC7, 0xAD, 0x55, 0xFF, 0x06, 0xFF, 0xD6, 0xDB, 0x31, 0xA6,
+    0x42, 0x28, 0xEF, 0x5D, 0xFF, 0x04, 0xFF, 0xF7, 0x9E, 0x52, 0xAA, 0x18, 0xE3, 0x21, 0x04, 0x21,
+    0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x03, 0x18, 0xE3, 0x31, 0xA6, 0xDE, 0xFB, 0xFF, 0x06, 0xFF,
+    0x73, 0x8E, 0x00, 0x00, 0x31, 0xA6, 0xD6, 0xDB, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xF7,
+    0xBF, 0x6B, 0x2C, 0xFF, 0x0A, 0x00, 0x73, 0x8E, 0xFF, 0x06, 0xFF, 0xCE, 0x59, 0xFF, 0x06, 0x00,
+    0x9C, 0xD3, 0xFF, 0x06, 0xFF, 0xAD, 0x75, 0x18, 0xE3, 0x18, 0xC3, 0x18, 0xE3, 0x21, 0x04, 0x73,
+    0x8E, 0xF7, 0x9E, 0xFF, 0x04, 0xFF, 0xF7, 0xBE, 0x5A, 0xCB, 0xFF, 0x3C, 0x00, 0x39, 0xA4, 0xBC,
+    0x88, 0xCC, 0xC7, 0xC4, 0xA7, 0xC4, 0xA7, 0xC4, 0xA7, 0xBC, 0x67, 0x39, 0xA3, 0xFF, 0x10, 0x00,
+    0x39, 0xC7, 0xE7, 0x1C, 0xFF, 0x04, 0xFF, 0xF7, 0xBF, 0xBD, 0xF7, 0xA5, 0x55, 0xAD, 0x55, 0xB5,
+    0xB6, 0xDE, 0xFB, 0xF7, 0xDF, 0xFF, 0x06, 0xFF, 0x7B, 0xEF, 0xFF, 0x04, 0x00, 0x73, 0xAE, 0xFF,
+    0x05, 0xFF, 0xDF, 0xEF, 0x5D, 0xB5, 0xB7, 0xAD, 0x96, 0xB5, 0x96, 0xBE, 0x18, 0xEF, 0x5D, 0xFF,
+    0x00, 0xDF, 0xFF, 0x04, 0xFF, 0xE7, 0x1B, 0x42, 0x08, 0xFF, 0x04, 0x00, 0x52, 0xCA, 0xF7, 0xBE,
+    0xFF, 0x13, 0xFF, 0xDF, 0x63, 0x0C, 0xFF, 0x04, 0x00, 0x63, 0x2C, 0xFF, 0x00, 0xDF, 0xFF, 0x04,
+    0xFF, 0xE7, 0x1C, 0x39, 0xE7, 0xFF, 0x18, 0x00, 0x73, 0x8E, 0xFF, 0x06, 0xFF, 0xD6, 0xBA, 0x31,
+    0xA6, 0xFF, 0x06, 0x00, 0x4A, 0x48, 0xA5, 0x34, 0xE7, 0x3C, 0xF7, 0xDF, 0xFF, 0x0C, 0xFF, 0xE7,
+    0x3C, 0x6B, 0x4D, 0xFF, 0x04, 0x00, 0x52, 0xAA, 0xF7, 0x9E, 0xFF, 0x04, 0xFF, 0xDE, 0xFB, 0x39,
+    0xC7, 0x00, 0x00, 0x39, 0xC7, 0xDE, 0xFB, 0xFF, 0x05, 0xFF, 0xDF, 0x6B, 0x4D, 0x21, 0x04, 0x21,
+    0x24, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x24, 0x21, 0x24, 0x31, 0xA6, 0xD6, 0x9A, 0xFF,
+    0x05, 0xFF, 0xDF, 0x7B, 0xEF, 0xFF, 0x04, 0x00, 0x9C, 0xD2, 0xFF, 0x00, 0xFF, 0x00, 0xF7, 0xFF,
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0x9D, 0x13, 0x5A, 0xCA, 0xE7, 0x3C, 0xFF, 0x06, 0xFF, 0xC6, 0x18,
+    0xCE, 0x79, 0xFF, 0x06, 0xFF, 0x7B, 0xEF, 0xFF, 0x14, 0x00, 0xC6, 0x38, 0xFF, 0x06, 0xFF, 0xCE,
+    0x99, 0xA5, 0x54, 0xAD, 0x55, 0xB5, 0xB6, 0xDE, 0xDB, 0xFF, 0x08, 0xFF, 0x9C, 0xF3, 0x00, 0x00,
+    0x42, 0x28, 0xEF, 0x7D, 0xFF, 0x04, 0xFF, 0xF7, 0xBE, 0x52, 0xAA, 0x18, 0xC3, 0x20, 0xE3, 0x21,
+    0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x03, 0x39, 0xC6, 0xDE, 0xFB, 0xFF, 0x06, 0xFF,
+    0x73, 0x8E, 0xFF, 0x04, 0x00, 0xD6, 0xBB, 0xFF, 0x05, 0xFF, 0xDF, 0x6B, 0x4D, 0xFF, 0x0A, 0x00,
+    0x73, 0x8E, 0xFF, 0x06, 0xFF, 0xCE, 0x59, 0xFF, 0x06, 0x00, 0x9C, 0xD3, 0xFF, 0x06, 0xFF, 0xDF,
+    0x1C, 0xB5, 0x96, 0xAD, 0x75, 0xAD, 0x75, 0xBE, 0x18, 0xEF, 0x7D, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+    0x00, 0xDF, 0xFF, 0x00, 0xFF, 0x00, 0xC6, 0x59, 0xFF, 0x3E, 0x00, 0x31, 0x44, 0xB4, 0x47, 0xCC,
+    0xC8, 0xC4, 0xA7, 0xC4, 0xA7, 0xC4, 0xA7, 0xB4, 0x27, 0x29, 0x43, 0xFF, 0x10, 0x00, 0x39, 0xC7,
+    0xE7, 0x1C, 0xFF, 0x05, 0xFF, 0xDF, 0xF7, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x05, 0xFF, 0xDF, 0xF7,
+    0xDF, 0xFF, 0x04, 0xFF, 0xBD, 0xD7, 0x31, 0x86, 0xFF, 0x04, 0x00, 0x7B, 0xCF, 0xFF, 0x05, 0xFF,
+    0xDF, 0xF7, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x05, 0xFF, 0xDF, 0xFF, 0x00, 0xDF,
+    0xFF, 0x00, 0xFF, 0x00, 0xF7, 0x9E, 0x7B, 0xCF, 0xFF, 0x06, 0x00, 0x5A, 0xCB, 0xF7, 0xBE, 0xFF,
+    0x04, 0xFF, 0xF7, 0xBE, 0xAD, 0x55, 0x9C, 0xD3, 0x9C, 0xD3, 0x94, 0xD3, 0x9C, 0xD3, 0x9C, 0xB3,
+    0x94, 0xB2, 0x42, 0x28, 0xFF, 0x04, 0x00, 0x52, 0xAA, 0xF7, 0x9E, 0xFF, 0x04, 0xFF, 0xF7, 0x9E,
+    0x52, 0x8A, 0xFF, 0x18, 0x00, 0x73, 0xAE, 0xFF, 0x06, 0xFF, 0xD6, 0xBA, 0x31, 0x86, 0xFF, 0x0A,
+    0x00, 0x42, 0x08, 0x73, 0x8E, 0xA5, 0x34, 0xD6, 0x9A, 0xF7, 0x9E, 0xFF, 0x08, 0xFF, 0xCE, 0x59,
+    0xFF, 0x04, 0x00, 0x52, 0x8A, 0xEF, 0x9E, 0xFF, 0x04, 0xFF, 0xDE, 0xFB, 0x39, 0xC7, 0x00, 0x00,
+    0x31, 0x86, 0xD6, 0xBA, 0xFF, 0x06, 0xFF, 0x8C, 0x51, 0x21, 0x03, 0x21, 0x04, 0x21, 0x04, 0x21,
+    0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x42, 0x28, 0xE7, 0x3C, 0xFF, 0x05, 0xFF, 0xBF, 0x6B,
+    0x4D, 0xFF, 0x04, 0x00, 0x9C, 0xD3, 0xFF, 0x06, 0xFF, 0xA5, 0x34, 0x00, 0x00, 0x7B, 0xEF, 0xF7,
+    0xBE, 0xFF, 0x06, 0xFF, 0xF7, 0xDF, 0xFF, 0x06, 0xFF, 0x7B, 0xEF, 0xFF, 0x14, 0x00, 0xC6, 0x38,
+    0xFF, 0x08, 0xFF, 0xF7, 0xFF, 0x00, 0xF7, 0xFF, 0x00, 0xF7, 0xFF, 0x09, 0xFF, 0xD6, 0x9A, 0x39,
+    0xE7, 0x00, 0x00, 0x39, 0xA7, 0xDE, 0xFB, 0xFF, 0x06, 0xFF, 0x73, 0xAE, 0x18, 0xC3, 0x18, 0xE3,
+    0x21, 0x03, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x52, 0x8A, 0xEF, 0x7D, 0xFF, 0x04,
+    0xFF, 0xF7, 0xBE, 0x5A, 0xEB, 0xFF, 0x04, 0x00, 0xD6, 0x9A, 0xFF, 0x06, 0xFF, 0x73, 0xAE, 0xFF,
+    0x0A, 0x00, 0x73, 0xAE, 0xFF, 0x00, 0xDF, 0xFF, 0x04, 0xFF, 0xC6, 0x18, 0xFF, 0x06, 0x00, 0x9C,
+    0xD3, 0xFF, 0x06, 0xFF, 0xF7, 0xFF, 0x00, 0xF7, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xF7,
+    0xFF, 0x00, 0xF7, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xFF, 0x00, 0xE7, 0x1C, 0x52, 0xAA, 0xFF,
+    0x40, 0x00, 0xA3, 0xE6, 0xCC, 0xC8, 0xCC, 0xA7, 0xC4, 0xA7, 0xC4, 0xA7, 0xA3, 0xE6, 0xFF, 0x12,
+    0x00, 0x39, 0xE7, 0xE7, 0x1C, 0xFF, 0x11, 0xFF, 0xDF, 0xE7, 0x3C, 0x9C, 0xF3, 0x31, 0xA6, 0xFF,
+    0x06, 0x00, 0x7B, 0xCF, 0xFF, 0x07, 0xFF, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x08,
+    0xFF, 0xE7, 0x1C, 0x6B, 0x6D, 0xFF, 0x08, 0x00, 0x5A, 0xCA, 0xF7, 0xBE, 0xFF, 0x04, 0xFF, 0xEF,
+    0x5D, 0x42, 0x08, 0xFF, 0x12, 0x00, 0x39, 0xC7, 0xDE, 0xFB, 0xFF, 0x06, 0xFF, 0x9C, 0xD3, 0xFF,
+    0x0E, 0x00, 0x31, 0xA6, 0xFF, 0x08, 0x00, 0x73, 0xAE, 0xFF, 0x06, 0xFF, 0xD6, 0xBA, 0x31, 0x86,
+    0xFF, 0x10, 0x00, 0x31, 0xA6, 0x5A, 0xEB, 0xBD, 0xF7, 0xFF, 0x06, 0xFF, 0xE7, 0x3C, 0x42, 0x08,
+    0x00, 0x00, 0x52, 0x8A, 0xEF, 0x9E, 0xFF, 0x04, 0xFF, 0xDE, 0xFB, 0x39, 0xC7, 0xFF, 0x04, 0x00,
+    0xB5, 0xB6, 0xFF, 0x06, 0xFF, 0xCE, 0x79, 0x31, 0x86, 0x18, 0xE3, 0x21, 0x04, 0x21, 0x24, 0x21,
+    0x24, 0x21, 0x04, 0x20, 0xE3, 0x8C, 0x51, 0xFF, 0x06, 0xFF, 0xEF, 0x5D, 0x42, 0x28, 0xFF, 0x04,
+    0x00, 0x9C, 0xD3, 0xFF, 0x06, 0xFF, 0xAD, 0x55, 0xFF, 0x04, 0x00, 0x9C, 0xF3, 0xFF, 0x04, 0xFF,
+    0xF7, 0xFF, 0x09, 0xFF, 0x7B, 0xEF, 0xFF, 0x14, 0x00, 0xC6, 0x38, 0xFF, 0x08, 0xFF, 0xF7, 0xFF,
+    0x00, 0xF7, 0xFF, 0x07, 0xFF, 0xEF, 0x9E, 0xB5, 0x96, 0x4A, 0x49, 0xFF, 0x06, 0x00, 0xB5, 0xB7,
+    0xFF, 0x06, 0xFF, 0xC6, 0x18, 0x29, 0x45, 0x18, 0xC3, 0x18, 0xE3, 0x18, 0xE3, 0x21, 0x04, 0x21,
+    0x04, 0x21, 0x24, 0x9C, 0xF3, 0xFF, 0x05, 0xFF, 0xDF, 0xDE, 0xDB, 0x31, 0xA7, 0xFF, 0x04, 0x00,
+    0xC6, 0x38, 0xFF, 0x06, 0xFF, 0x9C, 0xD3, 0xFF, 0x0A, 0x00, 0x9C, 0xD3, 0xFF, 0x06, 0xFF, 0xAD,
+    0x75, 0xFF, 0x06, 0x00, 0x94, 0xB2, 0xFF, 0x06, 0xFF, 0xF7, 0xFF, 0x00, 0xF7, 0xFF, 0x00, 0xFF,
+    0x00, 0xDF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xD6,
+    0x9A, 0x4A, 0x69, 0xFF, 0x42, 0x00, 0x93, 0x66, 0xCC, 0xE8, 0xCC, 0xC7, 0xCC, 0xA7, 0xC4, 0xA7,
+    0x93, 0x86, 0xFF, 0x12, 0x00, 0x39, 0xC7, 0xE7, 0x1C, 0xFF, 0x06, 0xFF, 0xCE, 0x59, 0xB5, 0xB6,
+    0xB5, 0xB6, 0xAD, 0x96, 0xA5, 0x14, 0x7B, 0xCF, 0x42, 0x08, 0xFF, 0x0A, 0x00, 0x73, 0xAE, 0xFF,
+    0x06, 0xFF, 0xEF, 0x5D, 0x9C, 0xD3, 0x94, 0x71, 0xB5, 0xB6, 0xFF, 0x00, 0xDF, 0xFF, 0x04, 0xFF,
+    0xDE, 0xFB, 0x42, 0x08, 0xFF, 0x08, 0x00, 0x52, 0xAA, 0xF7, 0x9E, 0xFF, 0x04, 0xFF, 0xE7, 0x3C,
+    0x39, 0xE7, 0xFF, 0x14, 0x00, 0x9C, 0xF3, 0xFF, 0x06, 0xFF, 0xEF, 0x7D, 0x7B, 0xEF, 0xFF, 0x0A,
+    0x00, 0x84, 0x30, 0xCE, 0x59, 0x5A, 0xCB, 0xFF, 0x06, 0x00, 0x73, 0x8E, 0xFF, 0x06, 0xFF, 0xD6,
+    0xBA, 0xFF, 0x06, 0x00, 0x39, 0xE7, 0x73, 0x8E, 0x31, 0x86, 0xFF, 0x0A, 0x00, 0x4A, 0x69, 0xEF,
+    0x7D, 0xFF, 0x04, 0xFF, 0xE7, 0x3D, 0x42, 0x08, 0x00, 0x00, 0x52, 0x8A, 0xF7, 0x9E, 0xFF, 0x04,
+    0xFF, 0xE7, 0x1C, 0x39, 0xE7, 0xFF, 0x04, 0x00, 0x73, 0x8E, 0xFF, 0x00, 0xDF, 0xFF, 0x04, 0xFF,
+    0xF7, 0xDF, 0xA5, 0x14, 0x31, 0x86, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x24, 0x63, 0x2C,
+    0xE7, 0x3C, 0xFF, 0x06, 0xFF, 0xB5, 0x96, 0xFF, 0x06, 0x00, 0xA4, 0xF3, 0xFF, 0x06, 0xFF, 0xA5,
+    0x34, 0xFF, 0x04, 0x00, 0x31, 0x86, 0xB5, 0xB6, 0xFF, 0x0C, 0xFF, 0x7B, 0xEF, 0xFF, 0x14, 0x00,
+    0xC6, 0x38, 0xFF, 0x06, 0xFF, 0xD6, 0xBA, 0xB5, 0x96, 0xB5, 0x96, 0xAD, 0x76, 0xA5, 0x34, 0x84,
+    0x10, 0x52, 0x8A, 0xFF, 0x0A, 0x00, 0x73, 0x8E, 0xFF, 0x00, 0xDF, 0xFF, 0x04, 0xFF, 0xF7, 0xDF,
+    0x94, 0xB2, 0x29, 0x45, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x21, 0x24, 0x7B, 0xCF, 0xF7, 0x9E,
+    0xFF, 0x06, 0xFF, 0xA4, 0xF4, 0xFF, 0x06, 0x00, 0xA5, 0x14, 0xFF, 0x06, 0xFF, 0xDE, 0xFB, 0x42,
+    0x28, 0xFF, 0x06, 0x00, 0x4A, 0x69, 0xDE, 0xFB, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xFF,
+    0x00, 0xDF, 0x7B, 0xEF, 0xFF, 0x06, 0x00, 0x94, 0xB2, 0xFF, 0x06, 0xFF, 0xDE, 0xFB, 0x94, 0x92,
+    0x94, 0x71, 0xC5, 0xF8, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xCE, 0x79, 0xFF,
+    0x44, 0x00, 0x7B, 0x06, 0xCC, 0xC8, 0xCC, 0xC7, 0xC4, 0xA7, 0xCC, 0xA7, 0x8B, 0x46, 0xFF, 0x12,
+    0x00, 0x39, 0xA7, 0xE7, 0x1C, 0xFF, 0x04, 0xFF, 0xF7, 0xBE, 0x5A, 0xEB, 0xFF, 0x16, 0x00, 0x73,
+    0x8E, 0xFF, 0x06, 0xFF, 0xDE, 0xDB, 0x31, 0x86, 0x00, 0x00, 0x31, 0xA6, 0xCE, 0x59, 0xFF, 0x06,
+    0xFF, 0xB5, 0x96, 0xFF, 0x08, 0x00, 0x52, 0x8A, 0xEF, 0x9E, 0xFF, 0x04, 0xFF, 0xEF, 0x7D, 0x84,
+    0x10, 0x6B, 0x6D, 0x6B, 0x6D, 0x6B, 0x4D, 0x6B, 0x4D, 0x6B, 0x6D, 0x73, 0x8E, 0x73, 0x8E, 0x4A,
+    0x49, 0xFF, 0x04, 0x00, 0x42, 0x28, 0xDE, 0xFB, 0xFF, 0x06, 0xFF, 0xF7, 0xBE, 0xBD, 0xF7, 0x8C,
+    0x51, 0x7B, 0xCF, 0x8C, 0x51, 0xC6, 0x18, 0xF7, 0xBE, 0xFF, 0x00, 0xFF, 0x00, 0xDE, 0xFB, 0x63,
+    0x2C, 0xFF, 0x04, 0x00, 0x73, 0x8E, 0xFF, 0x06, 0xFF, 0xD6, 0xBA, 0xFF, 0x06, 0x00, 0x7B, 0xCF,
+    0xF7, 0xBE, 0xCE, 0x79, 0x8C, 0x71, 0x63, 0x0C, 0x4A, 0x49, 0x42, 0x28, 0x52, 0x8A, 0x9C, 0xD3,
+    0xF7, 0xDF, 0xFF, 0x04, 0xFF, 0xD6, 0x9A, 0xFF, 0x04, 0x00, 0x52, 0xAA, 0xF7, 0x9E, 0xFF, 0x04,
+    0xFF, 0xE7, 0x3C, 0x42, 0x08, 0xFF, 0x04, 0x00, 0x31, 0x86, 0xBD, 0xD7, 0xFF, 0x04, 0xFF, 0xF7,
+    0xFF, 0x00, 0xF7, 0xDF, 0xCE, 0x59, 0x8C, 0x51, 0x73, 0x8E, 0x7B, 0xCF, 0xAD, 0x55, 0xEF, 0x5D,
+    0xFF, 0x00, 0xDF, 0xFF, 0x04, 0xFF, 0xEF, 0x3C, 0x5A, 0xCA, 0xFF, 0x06, 0x00, 0xA5, 0x14, 0xFF,
+    0x06, 0xFF, 0xA5, 0x34, 0xFF, 0x06, 0x00, 0x39, 0xE7, 0xD6, 0x9A, 0xFF, 0x0A, 0xFF, 0x7B, 0xEF,
+    0xFF, 0x14, 0x00, 0xC6, 0x18, 0xFF, 0x06, 0xFF, 0x8C, 0x71, 0xFF, 0x16, 0x00, 0x31, 0x86, 0xBD,
+    0xF7, 0xFF, 0x06, 0xFF, 0xF7, 0xDF, 0xC6, 0x18, 0x84, 0x10, 0x6B, 0x4D, 0x73, 0xAE, 0xAD, 0x75,
+    0xF7, 0x9E, 0xFF, 0x06, 0xFF, 0xE7, 0x1C, 0x4A, 0x49, 0xFF, 0x06, 0x00, 0x63, 0x0C, 0xF7, 0xBE,
+    0xFF, 0x06, 0xFF, 0xCE, 0x9A, 0x7B, 0xCF, 0x63, 0x2C, 0x84, 0x30, 0xDE, 0xDB, 0xFF, 0x06, 0xFF,
+    0xE7, 0x1C, 0x41, 0xE7, 0xFF, 0x06, 0x00, 0x94, 0x92, 0xFF, 0x06, 0xFF, 0xBD, 0xF7, 0xFF, 0x04,
+    0x00, 0x42, 0x08, 0xDE, 0xDB, 0xFF, 0x05, 0xFF, 0xDF, 0x94, 0xB3, 0xFF, 0x42, 0x00, 0x62, 0x85,
+    0xCC, 0xA8, 0xC4, 0xA7, 0xC4, 0xA7, 0xCC, 0xC7, 0x7B, 0x06, 0xFF, 0x12, 0x00, 0x31, 0x86, 0xDE,
+    0xFB, 0xFF, 0x04, 0xFF, 0xF7, 0xBE, 0x5A, 0xEB, 0xFF, 0x16, 0x00, 0x6B, 0x4D, 0xF7, 0xDF, 0xFF,
+    0x04, 0xFF, 0xDE, 0xDB, 0x31, 0xA6, 0xFF, 0x04, 0x00, 0x5A, 0xEB, 0xEF, 0x7D, 0xFF, 0x04, 0xFF,
+    0xF7, 0xDF, 0x7B, 0xCF, 0xFF, 0x06, 0x00, 0x4A, 0x6A, 0xEF, 0x9E, 0xFF, 0x07, 0xFF, 0xDF, 0xFF,
+    0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xBF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x04,
+    0xFF, 0x8C, 0x71, 0xFF, 0x06, 0x00, 0x63, 0x2C, 0xE7, 0x5D, 0xFF, 0x11, 0xFF, 0xDF, 0xFF, 0x00,
+    0xDF, 0xFF, 0x00, 0xFF, 0x00, 0x9C, 0xF3, 0xFF, 0x04, 0x00, 0x6B, 0x6D, 0xF7, 0xDF, 0xFF, 0x04,
+    0xFF, 0xD6, 0x9A, 0x31, 0x86, 0xFF, 0x04, 0x00, 0xBE, 0x18, 0xFF, 0x06, 0xFF, 0xF7, 0xBF, 0xEF,
+    0x5D, 0xE7, 0x3C, 0xEF, 0x7D, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xF7, 0xDF, 0xF7, 0xBF, 0x8C,
+    0x51, 0xFF, 0x04, 0x00, 0x5A, 0xCB, 0xF7, 0x9E, 0xFF, 0x04, 0xFF, 0xE7, 0x3C, 0x42, 0x28, 0xFF,
+    0x06, 0x00, 0x42, 0x08, 0xC6, 0x59, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF,
+    0xFF, 0x05, 0xFF, 0xDF, 0xFF, 0x07, 0xFF, 0xDF, 0xFF, 0x00, 0xFF, 0x00, 0xEF, 0x7D, 0x7B, 0xCE,
+    0xFF, 0x08, 0x00, 0xA5, 0x14, 0xFF, 0x06, 0xFF, 0x9C, 0xF3, 0xFF, 0x08, 0x00, 0x5A, 0xEB, 0xEF,
+    0x5D, 0xFF, 0x08, 0xFF, 0x7B, 0xEF, 0xFF, 0x14, 0x00, 0xBD, 0xF7, 0xFF, 0x06, 0xFF, 0x8C, 0x51,
+    0xFF, 0x18, 0x00, 0x4A, 0x69, 0xD6, 0xBA, 0xFF, 0x0B, 0xFF, 0xDF, 0xFF, 0x0A, 0xFF, 0xEF, 0x7D,
+    0x73, 0x8E, 0xFF, 0x0A, 0x00, 0xAD, 0x75, 0xFF, 0x0B, 0xFF, 0xDE, 0xFF, 0x0A, 0xFF, 0x8C, 0x71,
+    0xFF, 0x08, 0x00, 0x94, 0x71, 0xFF, 0x06, 0xFF, 0xC6, 0x18, 0xFF, 0x06, 0x00, 0x73, 0xAE, 0xFF,
+    0x00, 0xDF, 0xFF, 0x04, 0xFF, 0xEF, 0x7D, 0x5A, 0xCB, 0xFF, 0x40, 0x00, 0x49, 0xE4, 0xC4, 0x87,
+    0xC4, 0xA7, 0xC4, 0xA7, 0xCC, 0xC8, 0x6A, 0xA5, 0xFF, 0x12, 0x00, 0x31, 0x86, 0xDE, 0xFB, 0xFF,
+    0x04, 0xFF, 0xF7, 0xBE, 0x5A, 0xEB, 0xFF, 0x16, 0x00, 0x6B, 0x4D, 0xFF, 0x00, 0xDF, 0xFF, 0x04,
+    0xFF, 0xDE, 0xDB, 0x31, 0xA6, 0xFF, 0x06, 0x00, 0x9C, 0xD3, 0xFF, 0x06, 0xFF, 0xE7, 0x1C, 0x42,
+    0x28, 0xFF, 0x04, 0x00, 0x52, 0x8A, 0xF7, 0xBE, 0xFF, 0x16, 0xFF, 0x8C, 0x51, 0xFF, 0x08, 0x00,
+    0x63, 0x0C, 0xD6, 0xBA, 0xFF, 0x10, 0xFF, 0xF7, 0x9E, 0x9C, 0xF3, 0x31, 0x86, 0xFF, 0x04, 0x00,
+    0x6B, 0x6D, 0xF7, 0xDF, 0xFF, 0x04, 0xFF, 0xD6, 0xBA, 0x31, 0x86, 0x00, 0x00, 0x39, 0xC7, 0xCE,
+    0x79, 0xFF, 0x0D, 0xFF, 0xDF, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xF7, 0x9E, 0xA5, 0x14, 0xFF,
+    0x06, 0x00, 0x5A, 0xCB, 0xF7, 0xBE, 0xFF, 0x04, 0xFF, 0xE7, 0x3D, 0x42, 0x08, 0xFF, 0x08, 0x00,
+    0x39, 0xE7, 0xB5, 0x96, 0xF7, 0xBF, 0xFF, 0x0F, 0xFF, 0xDF, 0xDE, 0xBA, 0x73, 0x6D, 0xFF, 0x08,
+    0x00, 0x31, 0x64, 0xA5, 0x14, 0xFF, 0x06, 0xFF, 0x9C, 0xF3, 0xFF, 0x0A, 0x00, 0x83, 0xF0, 0xF7,
+    0xBE, 0xFF, 0x06, 0xFF, 0x7B, 0xEF, 0xFF, 0x14, 0x00, 0xBD, 0xF7, 0xFF, 0x06, 0xFF, 0x8C, 0x51,
+    0xFF, 0x1A, 0x00, 0x4A, 0x69, 0xBD, 0xF7, 0xF7, 0xDF, 0xFF, 0x0F, 0xFF, 0xDF, 0xD6, 0x9A, 0x6B,
+    0x2C, 0xFF, 0x0C, 0x00, 0x39, 0xC7, 0xB5, 0xB6, 0xFF, 0x00, 0xDF, 0xFF, 0x0F, 0xFF, 0xDF, 0xAD,
+    0x55, 0xFF, 0x0A, 0x00, 0x94, 0x72, 0xFF, 0x06, 0xFF, 0xC6, 0x18, 0xFF, 0x08, 0x00, 0xB5, 0xB6,
+    0xFF, 0x06, 0xFF, 0xCE, 0x59, 0xFF, 0x40, 0x00, 0x31, 0x64, 0xB4, 0x47, 0xC4, 0xA7, 0xC4, 0xA8,
+    0xCC, 0xC8, 0x5A, 0x45, 0xFF, 0x14, 0x00, 0xC6, 0x18, 0xDF, 0x1C, 0xDF, 0x1C, 0xDE, 0xFB, 0x52,
+    0xAA, 0xFF, 0x16, 0x00, 0x63, 0x0C, 0xE7, 0x1C, 0xE7, 0x3C, 0xE7, 0x3C, 0xC6, 0x18, 0x31, 0x86,
+    0xFF, 0x06, 0x00, 0x39, 0xC7, 0xC6, 0x38, 0xE7, 0x3C, 0xE7, 0x1C, 0xE7, 0x1C, 0x94, 0x92, 0xFF,
+    0x04, 0x00, 0x4A, 0x69, 0xDE, 0xDB, 0xE7, 0x3C, 0xE7, 0x1C, 0xDE, 0xFB, 0xE6, 0xFC, 0xE6, 0xFC,
+    0xE7, 0x1C, 0xE7, 0x3C, 0xE7, 0x3C, 0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0x1C, 0x7B, 0xCF, 0xFF, 0x0A,
+    0x00, 0x39, 0xE7, 0x8C, 0x51, 0xCE, 0x79, 0xEF, 0x7D, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xF7,
+    0x9E, 0xE7, 0x3C, 0xBD, 0xD7, 0x63, 0x2C, 0xFF, 0x08, 0x00, 0x63, 0x0C, 0xDE, 0xDB, 0xDE, 0xFB,
+    0xDE, 0xFB, 0xBD, 0xD7, 0xFF, 0x06, 0x00, 0x39, 0xE7, 0x84, 0x50, 0xC6, 0x38, 0xE7, 0x3C, 0xF7,
+    0xBE, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xBF, 0xF7, 0x9E, 0xE7, 0x1C, 0xBD, 0xD7, 0x6B, 0x4D, 0xFF,
+    0x08, 0x00, 0x5A, 0xAA, 0xDE, 0xFB, 0xE7, 0x3C, 0xE7, 0x3C, 0xCE, 0x79, 0x39, 0xE7, 0xFF, 0x0C,
+    0x00, 0x73, 0x8E, 0xC5, 0xF7, 0xE7, 0x3C, 0xF7, 0xBE, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xF7,
+    0x7D, 0xD6, 0x9A, 0x94, 0x91, 0x4A, 0x27, 0x29, 0x23, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31,
+    0x64, 0x31, 0x64, 0x94, 0xB2, 0xEF, 0x5C, 0xE7, 0x1C, 0xE7, 0x1C, 0x8C, 0x71, 0xFF, 0x0C, 0x00,
+    0x9C, 0xD3, 0xEF, 0x3D, 0xE7, 0x3C, 0xE7, 0x3C, 0x73, 0xAE, 0xFF, 0x14, 0x00, 0xAD, 0x55, 0xE7,
+    0x3C, 0xE7, 0x3C, 0xE7, 0x3C, 0x7B, 0xEF, 0xFF, 0x1E, 0x00, 0x73, 0x8D, 0xBD, 0xD7, 0xE7, 0x1C,
+    0xF7, 0xBE, 0xFF, 0x00, 0xDF, 0xFF, 0x00, 0xDF, 0xEF, 0x5D, 0xCE, 0x38, 0x84, 0x10, 0x31, 0xA6,
+    0xFF, 0x12, 0x00, 0x7B, 0xEF, 0xCE, 0x59, 0xEF, 0x7D, 0xF7, 0x9E, 0xF7, 0xBE, 0xF7, 0xBE, 0xEF,
+    0x5D, 0xC6, 0x38, 0x7B, 0xCF, 0xFF, 0x0C, 0x00, 0x84, 0x10, 0xE6, 0xFC, 0xDE, 0xFC, 0xE7, 0x3C,
+    0xB5, 0x96, 0xFF, 0x08, 0x00, 0x52, 0x8A, 0xDE, 0xDB, 0xE7, 0x3C, 0xE7, 0x1C, 0xE7, 0x1C, 0x7B,
+    0xEF, 0xFF, 0x16, 0x00, 0x31, 0x64, 0x31, 0x64, 0xFF, 0x26, 0x00, 0x9B, 0xC6, 0xBC, 0x47, 0xBC,
+    0x87, 0xBC, 0x68, 0x49, 0xE5, 0xFF, 0x14, 0x00, 0x31, 0x85, 0x31, 0x86, 0x31, 0xA6, 0x31, 0xA6,
+    0xFF, 0x1A, 0x00, 0x39, 0xE7, 0x41, 0xE7, 0x39, 0xE7, 0x39, 0xA6, 0xFF, 0x0A, 0x00, 0x31, 0xA6,
+    0x39, 0xC7, 0x39, 0xC7, 0x39, 0xC7, 0x31, 0xA6, 0xFF, 0x06, 0x00, 0x39, 0xE7, 0x39, 0xE7, 0x39,
+    0xC7, 0x39, 0xA6, 0x39, 0xA6, 0x39, 0xC7, 0x39, 0xE7, 0x41, 0xE7, 0x41, 0xE7, 0x39, 0xE7, 0x39,
+    0xC7, 0x39, 0xC7, 0xFF, 0x12, 0x00, 0x4A, 0x49, 0x63, 0x0C, 0x63, 0x2C, 0x5A, 0xCB, 0x42, 0x08,
+    0xFF, 0x0E, 0x00, 0x31, 0xA6, 0x39, 0xA6, 0x39, 0xA6, 0x31, 0x86, 0xFF, 0x0A, 0x00, 0x31, 0x86,
+    0x4A, 0x48, 0x5A, 0xEB, 0x6B, 0x4D, 0x6B, 0x2C, 0x5A, 0xCB, 0x42, 0x08, 0xFF, 0x0E, 0x00, 0x42,
+    0x08, 0x42, 0x08, 0x42, 0x08, 0x39, 0xC7, 0xFF, 0x10, 0x00, 0x31, 0x85, 0x4A, 0x28, 0x62, 0xCA,
+    0x73, 0x4C, 0x73, 0x6C, 0x62, 0xEA, 0x4A, 0x06, 0x39, 0x84, 0x31, 0x63, 0x31, 0x64, 0x31, 0x64,
+    0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x39, 0x84, 0x41, 0xE6, 0x4A, 0x48, 0x42, 0x07, 0x39, 0xE7,
+    0xFF, 0x10, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xFF, 0x16, 0x00, 0x31, 0x86, 0x39, 0xE7,
+    0x41, 0xE7, 0x42, 0x07, 0xFF, 0x24, 0x00, 0x39, 0xE7, 0x5A, 0xAA, 0x63, 0x2C, 0x63, 0x0C, 0x4A,
+    0x49, 0xFF, 0x1C, 0x00, 0x4A, 0x28, 0x5A, 0xCA, 0x63, 0x0B, 0x5A, 0xEB, 0x42, 0x28, 0xFF, 0x12,
+    0x00, 0x31, 0x86, 0x31, 0x86, 0x39, 0xA6, 0x31, 0x86, 0xFF, 0x0A, 0x00, 0x39, 0xC7, 0x39, 0xE7,
+    0x39, 0xC7, 0x39, 0xC7, 0x31, 0x86, 0xFF, 0x12, 0x00, 0x39, 0x85, 0xAC, 0x49, 0xAC, 0x69, 0xB4,
+    0x69, 0x93, 0xA7, 0xFF, 0x24, 0x00, 0x39, 0xA4, 0x49, 0xE4, 0x52, 0x05, 0x52, 0x05, 0x39, 0x84,
+    0xFF, 0xE6, 0x00, 0x29, 0x23, 0x39, 0x64, 0x41, 0xA4, 0x41, 0xC4, 0x41, 0xA4, 0x41, 0xA4, 0x39,
+    0x84, 0x39, 0x64, 0x39, 0x84, 0x39, 0x84, 0x39, 0x84, 0x39, 0x84, 0x31, 0x64, 0x31, 0x64, 0xFF,
+    0xCC, 0x00, 0x5A, 0x66, 0xAC, 0x48, 0x41, 0xA4, 0x49, 0xE5, 0xAC, 0x48, 0x31, 0x64, 0xFF, 0x1E,
+    0x00, 0x52, 0x24, 0xA3, 0xE7, 0xA4, 0x07, 0xAC, 0x28, 0xB4, 0x48, 0xB4, 0x48, 0xB4, 0x68, 0x7B,
+    0x06, 0xFF, 0xE2, 0x00, 0x31, 0x44, 0x31, 0x64, 0x39, 0x84, 0x41, 0xC4, 0x6A, 0xA6, 0xA4, 0x29,
+    0xBC, 0xCA, 0xBC, 0xCA, 0x9C, 0x08, 0x62, 0x85, 0x41, 0xA4, 0x41, 0xA4, 0x39, 0x84, 0x39, 0x64,
+    0x31, 0x64, 0xFF, 0xC2, 0x00, 0x29, 0x43, 0x93, 0xC7, 0x9B, 0xE7, 0x52, 0x25, 0x52, 0x25, 0xAC,
+    0x48, 0x8B, 0x87, 0x18, 0xE3, 0x21, 0x03, 0x9B, 0xE8, 0x8B, 0x87, 0x49, 0xE4, 0x52, 0x25, 0xA4,
+    0x08, 0x72, 0xE6, 0xFF, 0x16, 0x00, 0x62, 0x85, 0xC4, 0xA8, 0xC4, 0xA8, 0xC4, 0xC9, 0xC4, 0xC9,
+    0xC4, 0xC9, 0xC4, 0xC9, 0x83, 0x46, 0xFF, 0xE0, 0x00, 0x31, 0x44, 0x31, 0x44, 0x39, 0x64, 0x39,
+    0x84, 0x7B, 0x07, 0xDD, 0xED, 0xFE, 0x8E, 0xEE, 0x4D, 0xEE, 0x2C, 0xFE, 0x6D, 0xE6, 0x0D, 0x93,
+    0xC8, 0x49, 0xE4, 0x39, 0x84, 0x39, 0x64, 0x31, 0x64, 0x31, 0x44, 0xFF, 0xBE, 0x00, 0x31, 0x64,
+    0x9B, 0xC7, 0x72, 0xC5, 0x52, 0x24, 0xAC, 0x27, 0x9B, 0xC7, 0x72, 0xC6, 0x39, 0x84, 0x18, 0xE3,
+    0x18, 0xE3, 0x39, 0xA4, 0x83, 0x47, 0xAC, 0x48, 0x93, 0xC7, 0x4A, 0x04, 0x93, 0xA7, 0x72, 0xE6,
+    0xFF, 0x08, 0x00, 0x31, 0x64, 0xFF, 0x0A, 0x00, 0x31, 0x44, 0x4A, 0x05, 0x52, 0x25, 0x5A, 0x45,
+    0x5A, 0x25, 0x52, 0x05, 0x41, 0xC4, 0x31, 0x44, 0xFF, 0xDE, 0x00, 0x31, 0x44, 0x31, 0x44, 0x31,
+    0x64, 0x31, 0x64, 0x62, 0x86, 0xDD, 0xAC, 0xEE, 0x2D, 0xA4, 0x49, 0x72, 0xE6, 0x6A, 0xC6, 0x9C,
+    0x09, 0xE6, 0x0D, 0xF6, 0x6E, 0xAC, 0x69, 0x4A, 0x04, 0x39, 0x63, 0x39, 0x64, 0x31, 0x64, 0x31,
+    0x64, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x29, 0x44, 0xFF, 0xB4, 0x00, 0x6A, 0xC6, 0xA4, 0x07,
+    0x18, 0xC2, 0x10, 0x82, 0x29, 0x23, 0x20, 0xE2, 0x10, 0x82, 0x10, 0xA3, 0x18, 0xC3, 0x18, 0xC3,
+    0x10, 0xA2, 0x10, 0x82, 0x29, 0x43, 0x29, 0x23, 0x10, 0xA2, 0x31, 0x64, 0xAC, 0x48, 0x41, 0xC4,
+    0xFF, 0x04, 0x00, 0x7B, 0x05, 0xB4, 0x47, 0x72, 0xE5, 0xFF, 0x0C, 0x00, 0x8B, 0x66, 0xAC, 0x07,
+    0xA3, 0xC6, 0x83, 0x05, 0xFF, 0x90, 0x00, 0x29, 0x44, 0x29, 0x44, 0x31, 0x44, 0x29, 0x44, 0x31,
+    0x44, 0x29, 0x44, 0x29, 0x44, 0x29, 0x44, 0x29, 0x44, 0xFF, 0x0A, 0x00, 0x29, 0x44, 0x00, 0x00,
+    0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64,
+    0x31, 0x64, 0x31, 0x44, 0xFF, 0x1C, 0x00, 0x31, 0x64, 0x31, 0x64, 0x39, 0x64, 0x39, 0x64, 0x52,
+    0x25, 0xC5, 0x0A, 0xEE, 0x0B, 0x8B, 0xA8, 0x49, 0xE4, 0x49, 0xC4, 0x49, 0xC4, 0x49, 0xE4, 0x72,
+    0xE6, 0xCD, 0x4B, 0xF6, 0x4C, 0xC5, 0x09, 0x5A, 0x65, 0x39, 0x63, 0x39, 0x64, 0x39, 0x84, 0x39,
+    0x64, 0x39, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x44, 0x29, 0x44, 0xFF, 0x0C, 0x00,
+    0x29, 0x44, 0x31, 0x44, 0x29, 0x44, 0x31, 0x44, 0x00, 0x00, 0x31, 0x44, 0x29, 0x44, 0xFF, 0x94,
+    0x00, 0x39, 0x84, 0xAC, 0x28, 0x4A, 0x05, 0x10, 0xA2, 0x10, 0x82, 0x10, 0x82, 0x29, 0x23, 0x62,
+    0x85, 0x83, 0x66, 0x83, 0x46, 0x5A, 0x45, 0x21, 0x03, 0x10, 0xA2, 0x10, 0xA2, 0x18, 0xC3, 0x6A,
+    0xA6, 0x93, 0xC7, 0xFF, 0x06, 0x00, 0x83, 0x26, 0xC4, 0xA7, 0x83, 0x25, 0x29, 0x43, 0x52, 0x04,
+    0x52, 0x04, 0x49, 0xE4, 0x39, 0x84, 0x39, 0x84, 0xAC, 0x07, 0xCC, 0xA7, 0xC4, 0x67, 0x93, 0x86,
+    0xFF, 0x8E, 0x00, 0x29, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31,
+    0x64, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31,
+    0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x39, 0x64, 0x39, 0x64, 0x39,
+    0x64, 0x39, 0x84, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x29, 0x44, 0xFF, 0x18, 0x00, 0x31, 0x44,
+    0x31, 0x64, 0x39, 0x84, 0x39, 0x84, 0x49, 0xE4, 0xB4, 0xA9, 0xEE, 0x0B, 0x9B, 0xE7, 0x41, 0xA4,
+    0x41, 0xA4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xA4, 0x52, 0x05, 0xAC, 0x48, 0xF6, 0x2B,
+    0xDD, 0xAA, 0x83, 0x47, 0x41, 0xC4, 0x41, 0xA4, 0x41, 0x84, 0x39, 0x84, 0x39, 0x84, 0x39, 0x64,
+    0x31, 0x64, 0x31, 0x44, 0x31, 0x44, 0x29, 0x43, 0x29, 0x43, 0x29, 0x44, 0x29, 0x44, 0x31, 0x44,
+    0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x44,
+    0x31, 0x44, 0x29, 0x44, 0xFF, 0x0C, 0x00, 0x29, 0x44, 0x29, 0x44, 0x31, 0x44, 0x29, 0x44, 0xFF,
+    0x7E, 0x00, 0x9C, 0x08, 0x8B, 0x87, 0x18, 0xC3, 0x10, 0xA2, 0x49, 0xE4, 0xA4, 0x07, 0x9B, 0xE7,
+    0x7B, 0x06, 0x7B, 0x06, 0xA3, 0xE7, 0xA4, 0x07, 0x41, 0xC4, 0x18, 0xC3, 0x21, 0x03, 0xA4, 0x28,
+    0x6A, 0xA6, 0xFF, 0x06, 0x00, 0x83, 0x26, 0xC4, 0x87, 0x7B, 0x05, 0x5A, 0x24, 0xBC, 0x47, 0xBC,
+    0x67, 0xBC, 0x67, 0xBC, 0x47, 0xAC, 0x06, 0xBC, 0x67, 0xC4, 0x67, 0xBC, 0x47, 0xA3, 0xE6, 0x72,
+    0xA5, 0x6A, 0x85, 0x72, 0xA5, 0x52, 0x24, 0xFF, 0x6C, 0x00, 0x29, 0x44, 0x29, 0x44, 0x31, 0x44,
+    0x31, 0x44, 0x31, 0x44, 0xFF, 0x0E, 0x00, 0x29, 0x43, 0x31, 0x44, 0x31, 0x64, 0x31, 0x64, 0x31,
+    0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31,
+    0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x39, 0x64, 0x39, 0x84, 0x39,
+    0x84, 0x39, 0x84, 0x39, 0x84, 0x39, 0x84, 0x39, 0x64, 0x31, 0x64, 0x31, 0x44, 0x31, 0x64, 0x31,
+    0x44, 0x29, 0x44, 0xFF, 0x16, 0x00, 0x31, 0x64, 0x39, 0x84, 0x41, 0xA4, 0x49, 0xE4, 0xAC, 0x49,
+    0xF6, 0x2C, 0xB4, 0x89, 0x41, 0xC4, 0x39, 0x64, 0x39, 0x84, 0x39, 0x84, 0x39, 0x84, 0x39, 0xA4,
+    0x39, 0x84, 0x39, 0x84, 0x39, 0x84, 0x83, 0x47, 0xE5, 0xCB, 0xF6, 0x2C, 0xB4, 0x8A, 0x6A, 0xA6,
+    0x49, 0xC4, 0x41, 0xA4, 0x39, 0x84, 0x39, 0x64, 0x31, 0x44, 0x31, 0x43, 0x31, 0x43, 0x29, 0x43,
+    0x29, 0x43, 0x31, 0x43, 0x31, 0x43, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64,
+    0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x43, 0x00, 0x00,
+    0x29, 0x43, 0x00, 0x00, 0x29, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44,
+    0x31, 0x44, 0x29, 0x43, 0x29, 0x43, 0xFF, 0x76, 0x00, 0x41, 0xE5, 0xBC, 0xA9, 0x5A, 0x45, 0x18,
+    0xE3, 0x41, 0xC4, 0xB4, 0x47, 0x6A, 0xA5, 0x18, 0xE2, 0x10, 0xA2, 0x10, 0xA2, 0x20, 0xE3, 0x7B,
+    0x06, 0xB4, 0x68, 0x39, 0x84, 0x18, 0xC3, 0x72, 0xE7, 0x93, 0xA8, 0xFF, 0x06, 0x00, 0x7B, 0x06,
+    0xBC, 0x87, 0x83, 0x25, 0x5A, 0x45, 0xBC, 0x67, 0xC4, 0x67, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x87,
+    0xC4, 0x87, 0xBC, 0x47, 0xBC, 0x47, 0xB4, 0x27, 0xB4, 0x27, 0xB4, 0x27, 0xBC, 0x46, 0x8B, 0x65,
+    0x00, 0x00, 0x6A, 0xA5, 0x83, 0x25, 0x83, 0x05, 0x7B, 0x05, 0x7A, 0xE5, 0x72, 0xC5, 0x72, 0xC4,
+    0x72, 0xC4, 0x72, 0xC4, 0x72, 0xC5, 0x72, 0xC5, 0x72, 0xC5, 0x7A, 0xE5, 0x7A, 0xE5, 0x7A, 0xE5,
+    0x83, 0x05, 0x83, 0x05, 0x83, 0x05, 0x83, 0x25, 0x83, 0x25, 0x83, 0x25, 0x83, 0x25, 0x83, 0x25,
+    0x83, 0x25, 0x83, 0x25, 0x83, 0x25, 0x83, 0x25, 0x83, 0x25, 0x83, 0x25, 0x83, 0x25, 0x83, 0x25,
+    0x83, 0x25, 0x83, 0x26, 0x8B, 0x26, 0x8B, 0x46, 0x8B, 0x46, 0x8B, 0x46, 0x8B, 0x46, 0x8B, 0x46,
+    0x8B, 0x66, 0x8B, 0x66, 0x8B, 0x66, 0x8B, 0x66, 0x8B, 0x66, 0x8B, 0x86, 0x93, 0x86, 0x93, 0x86,
+    0x93, 0x86, 0x93, 0x86, 0x93, 0xA6, 0x93, 0xA6, 0x93, 0xA7, 0x9B, 0xA7, 0x9B, 0xC7, 0x9B, 0xC7,
+    0x9B, 0xC7, 0x9B, 0xC7, 0x9B, 0xC7, 0x9B, 0xC7, 0x9B, 0xC7, 0x9B, 0xC7, 0x9B, 0xC7, 0x9B, 0xC7,
+    0x9B, 0xE7, 0x9B, 0xE7, 0x9B, 0xE7, 0xA3, 0xE7, 0xA4, 0x08, 0xA4, 0x08, 0xA4, 0x08, 0xA4, 0x08,
+    0xA4, 0x08, 0xA4, 0x08, 0xA4, 0x28, 0xA4, 0x08, 0xA4, 0x08, 0xA4, 0x28, 0xA4, 0x28, 0xA4, 0x28,
+    0xA4, 0x28, 0xA4, 0x28, 0xAC, 0x49, 0xAC, 0x49, 0xAC, 0x49, 0xAC, 0x49, 0xAC, 0x69, 0xAC, 0x69,
+    0xAC, 0x69, 0xAC, 0x49, 0xA4, 0x28, 0x8B, 0x87, 0x5A, 0x45, 0x31, 0x63, 0x31, 0x43, 0x31, 0x64,
+    0x31, 0x44, 0x29, 0x44, 0xFF, 0x10, 0x00, 0x31, 0x44, 0x31, 0x64, 0x39, 0x84, 0x41, 0xC4, 0x93,
+    0xC8, 0xF6, 0x4D, 0xCD, 0x4B, 0x52, 0x25, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31,
+    0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x62, 0xA6, 0xCD, 0x2A, 0xFE,
+    0x6E, 0xEE, 0x0D, 0xC5, 0x0A, 0xAC, 0x69, 0xA4, 0x49, 0xA4, 0x28, 0x9C, 0x08, 0x9C, 0x08, 0x9C,
+    0x08, 0xA4, 0x28, 0xA4, 0x29, 0xA4, 0x29, 0xA4, 0x29, 0xA4, 0x49, 0xA4, 0x49, 0xA4, 0x49, 0xA4,
+    0x49, 0xA4, 0x29, 0xA4, 0x49, 0xA4, 0x29, 0xA4, 0x29, 0xA4, 0x29, 0xA4, 0x29, 0xA4, 0x28, 0xA4,
+    0x28, 0xA4, 0x28, 0xA4, 0x28, 0xA4, 0x28, 0xA4, 0x28, 0xA4, 0x28, 0xA4, 0x28, 0xA4, 0x08, 0xA4,
+    0x28, 0xA4, 0x28, 0xA4, 0x08, 0xA4, 0x08, 0xA4, 0x08, 0x9B, 0xE8, 0x9B, 0xE8, 0x9B, 0xE7, 0x9B,
+    0xE7, 0x9B, 0xE7, 0x9B, 0xC7, 0x9B, 0xC7, 0x9B, 0xC7, 0x9B, 0xC7, 0x93, 0xA7, 0x93, 0xA7, 0x93,
+    0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0xA7, 0x93, 0x86, 0x93, 0x86, 0x93, 0x86, 0x93, 0x86, 0x93,
+    0xA6, 0x93, 0x86, 0x93, 0x86, 0x93, 0x86, 0x93, 0x86, 0x93, 0x86, 0x8B, 0x66, 0x8B, 0x66, 0x8B,
+    0x66, 0x8B, 0x66, 0x8B, 0x66, 0x8B, 0x46, 0x8B, 0x46, 0x8B, 0x46, 0x8B, 0x46, 0x8B, 0x66, 0x8B,
+    0x66, 0x8B, 0x66, 0x93, 0x66, 0x93, 0x66, 0x93, 0x66, 0x8B, 0x66, 0x8B, 0x66, 0x8B, 0x66, 0x8B,
+    0x46, 0x8B, 0x46, 0x83, 0x26, 0x83, 0x25, 0x83, 0x25, 0x7B, 0x05, 0x7B, 0x05, 0x7B, 0x05, 0x7B,
+    0x05, 0x7B, 0x05, 0x83, 0x26, 0x8B, 0x46, 0x8B, 0x66, 0x93, 0x87, 0x93, 0x87, 0x93, 0xC8, 0xBC,
+    0xA9, 0xA4, 0x48, 0x29, 0x44, 0x21, 0x04, 0x9B, 0xC7, 0x8B, 0x67, 0x18, 0xC3, 0x10, 0xA2, 0x10,
+    0xC2, 0x10, 0xC2, 0x10, 0xA2, 0x18, 0xE3, 0x9B, 0xC8, 0x83, 0x47, 0x18, 0xE3, 0x39, 0xA5, 0xB4,
+    0xA9, 0xA4, 0x48, 0x83, 0x67, 0x31, 0x44, 0x7B, 0x05, 0xBC, 0x87, 0x83, 0x46, 0x62, 0x85, 0xC4,
+    0x87, 0xC4, 0x67, 0xC4, 0x67, 0xC4, 0x67, 0xC4, 0x67, 0xBC, 0x67, 0xBC, 0x47, 0xBC, 0x47, 0xBC,
+    0x47, 0xBC, 0x47, 0xBC, 0x47, 0xBC, 0x66, 0x93, 0x86, 0x29, 0x44, 0x9B, 0xC6, 0xC4, 0xA7, 0xC4,
+    0x86, 0xBC, 0x66, 0xBC, 0x46, 0xBC, 0x46, 0xB4, 0x46, 0xB4, 0x26, 0xB4, 0x26, 0xB4, 0x26, 0xB4,
+    0x26, 0xB4, 0x26, 0xB4, 0x46, 0xBC, 0x46, 0xBC, 0x46, 0xBC, 0x46, 0xBC, 0x66, 0xBC, 0x66, 0xC4,
+    0x66, 0xC4, 0x86, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x87, 0xC4,
+    0x87, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0xA7, 0xC4, 0xA7, 0xC4, 0xA7, 0xCC,
+    0xA7, 0xCC, 0xA7, 0xCC, 0xA7, 0xCC, 0xC7, 0xCC, 0xC7, 0xCC, 0xC7, 0xCC, 0xC7, 0xCC, 0xE7, 0xCC,
+    0xE8, 0xCC, 0xE8, 0xCC, 0xE8, 0xD4, 0xE8, 0xD5, 0x08, 0xD5, 0x08, 0xD5, 0x08, 0xD5, 0x08, 0xD5,
+    0x28, 0xD5, 0x28, 0xD5, 0x29, 0xD5, 0x29, 0xDD, 0x49, 0xDD, 0x49, 0xDD, 0x49, 0xDD, 0x49, 0xDD,
+    0x49, 0xDD, 0x49, 0xDD, 0x49, 0xDD, 0x69, 0xDD, 0x69, 0xDD, 0x89, 0xDD, 0x89, 0xDD, 0x8A, 0xE5,
+    0x8A, 0xE5, 0xAA, 0xE5, 0xAA, 0xE5, 0xAA, 0xE5, 0xAA, 0xE5, 0xAA, 0xE5, 0xAA, 0xE5, 0xAB, 0xE5,
+    0xAB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xEB, 0xE5,
+    0xEC, 0xED, 0xEC, 0xED, 0xEC, 0xE5, 0xEC, 0xE6, 0x0C, 0xE5, 0xEB, 0xE5, 0xEB, 0xED, 0xEB, 0xF6,
+    0x0B, 0xE5, 0xAA, 0x9B, 0xE7, 0x41, 0xC4, 0x31, 0x64, 0x31, 0x84, 0x31, 0x64, 0x31, 0x64, 0xFF,
+    0x0E, 0x00, 0x31, 0x44, 0x31, 0x64, 0x39, 0x84, 0x7B, 0x07, 0xEE, 0x2D, 0xDD, 0xCC, 0x6A, 0xC6,
+    0x39, 0xA4, 0x39, 0x84, 0x31, 0x64, 0x31, 0x44, 0x29, 0x44, 0x00, 0x00, 0x29, 0x44, 0x31, 0x44,
+    0x31, 0x64, 0x31, 0x64, 0x39, 0x64, 0x39, 0x84, 0x52, 0x05, 0x93, 0xA8, 0xCD, 0x6B, 0xE6, 0x0C,
+    0xEE, 0x0C, 0xE5, 0xEB, 0xE5, 0xEB, 0xE5, 0xEB, 0xE5, 0xEB, 0xE5, 0xEC, 0xEE, 0x0C, 0xEE, 0x0C,
+    0xEE, 0x0C, 0xEE, 0x0C, 0xEE, 0x0C, 0xEE, 0x0C, 0xED, 0xEC, 0xE5, 0xEC, 0xE5, 0xEC, 0xE5, 0xEB,
+    0xE5, 0xEB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB,
+    0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0xE5, 0xAB, 0xE5, 0xAA, 0xE5, 0xAA,
+    0xE5, 0xAA, 0xE5, 0x8A, 0xDD, 0x8A, 0xDD, 0x8A, 0xDD, 0x8A, 0xDD, 0x8A, 0xDD, 0x8A, 0xDD, 0x6A,
+    0xDD, 0x6A, 0xDD, 0x49, 0xDD, 0x49, 0xDD, 0x49, 0xDD, 0x49, 0xDD, 0x29, 0xDD, 0x29, 0xDD, 0x29,
+    0xD5, 0x29, 0xD5, 0x28, 0xD5, 0x28, 0xD5, 0x28, 0xD5, 0x28, 0xD5, 0x28, 0xD5, 0x28, 0xD5, 0x08,
+    0xD5, 0x08, 0xD5, 0x08, 0xD5, 0x08, 0xD5, 0x08, 0xD5, 0x08, 0xD5, 0x08, 0xD4, 0xE8, 0xD4, 0xE8,
+    0xD4, 0xE8, 0xCC, 0xE8, 0xCC, 0xE8, 0xCC, 0xE8, 0xCC, 0xE8, 0xCC, 0xE8, 0xCC, 0xE8, 0xD4, 0xE8,
+    0xD4, 0xE8, 0xCC, 0xE8, 0xCC, 0xE8, 0xCC, 0xE8, 0xCC, 0xE8, 0xCC, 0xE8, 0xCC, 0xC7, 0xCC, 0xC7,
+    0xCC, 0xC7, 0xC4, 0xA7, 0xC4, 0xA7, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0xA7,
+    0xCC, 0xC8, 0xCC, 0xC8, 0xCC, 0xE9, 0xD5, 0x29, 0xAC, 0x48, 0x5A, 0x65, 0x39, 0xA4, 0x18, 0xE3,
+    0x39, 0x84, 0xBC, 0xA9, 0x52, 0x25, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xC3,
+    0x10, 0xA3, 0x62, 0x85, 0xA4, 0x28, 0x21, 0x03, 0x20, 0xE3, 0x4A, 0x05, 0x72, 0xE6, 0xBC, 0xA9,
+    0x4A, 0x05, 0x72, 0xE5, 0xBC, 0x87, 0x83, 0x46, 0x6A, 0x85, 0xC4, 0x87, 0xC4, 0x67, 0xC4, 0x87,
+    0xC4, 0x67, 0xBC, 0x67, 0xBC, 0x47, 0xBC, 0x47, 0xBC, 0x47, 0xBC, 0x47, 0xBC, 0x47, 0xBC, 0x67,
+    0xC4, 0x86, 0x9B, 0xA6, 0x00, 0x00, 0x39, 0xA4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xA4,
+    0x41, 0xA4, 0x41, 0xA4, 0x39, 0xA4, 0x39, 0xA4, 0x39, 0x84, 0x39, 0x84, 0x39, 0x84, 0x39, 0x84,
+    0x39, 0x84, 0x39, 0xA4, 0x39, 0xA4, 0x41, 0xA4, 0x41, 0xA4, 0x41, 0xA4, 0x41, 0xA4, 0x41, 0xC4,
+    0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4,
+    0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x49, 0xC4, 0x49, 0xC4,
+    0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4,
+    0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x4A, 0x04, 0x4A, 0x04,
+    0x52, 0x05, 0x52, 0x05, 0x52, 0x04, 0x52, 0x04, 0x52, 0x04, 0x52, 0x04, 0x52, 0x05, 0x52, 0x05,
+    0x52, 0x25, 0x52, 0x25, 0x52, 0x25, 0x52, 0x25, 0x52, 0x25, 0x52, 0x45, 0x5A, 0x45, 0x52, 0x45,
+    0x52, 0x45, 0x52, 0x45, 0x52, 0x45, 0x52, 0x25, 0x5A, 0x45, 0x52, 0x25, 0x5A, 0x45, 0x5A, 0x45,
+    0x5A, 0x45, 0x5A, 0x45, 0x5A, 0x45, 0x5A, 0x45, 0x5A, 0x45, 0x5A, 0x45, 0x5A, 0x45, 0x5A, 0x45,
+    0x5A, 0x45, 0x5A, 0x45, 0x52, 0x45, 0x5A, 0x45, 0x62, 0x85, 0x83, 0x46, 0xCD, 0x29, 0xEE, 0x0A,
+    0xB4, 0xA9, 0x52, 0x25, 0x39, 0xA4, 0x39, 0x84, 0x31, 0x64, 0x31, 0x64, 0x29, 0x44, 0xFF, 0x06,
+    0x00, 0x29, 0x44, 0x31, 0x44, 0x31, 0x64, 0x31, 0x63, 0x5A, 0x65, 0xDD, 0x8B, 0xEE, 0x0C, 0x7B,
+    0x47, 0x41, 0xA4, 0x39, 0xA4, 0x31, 0x64, 0x29, 0x44, 0xFF, 0x0C, 0x00, 0x31, 0x44, 0x31, 0x64,
+    0x39, 0x84, 0x39, 0x84, 0x39, 0x84, 0x49, 0xC4, 0x52, 0x25, 0x5A, 0x45, 0x52, 0x45, 0x52, 0x45,
+    0x5A, 0x45, 0x5A, 0x45, 0x5A, 0x45, 0x5A, 0x65, 0x5A, 0x66, 0x5A, 0x65, 0x5A, 0x66, 0x5A, 0x65,
+    0x5A, 0x65, 0x5A, 0x45, 0x5A, 0x45, 0x52, 0x25, 0x52, 0x25, 0x52, 0x25, 0x52, 0x25, 0x52, 0x25,
+    0x52, 0x25, 0x52, 0x25, 0x5A, 0x45, 0x5A, 0x45, 0x5A, 0x45, 0x5A, 0x45, 0x5A, 0x45, 0x5A, 0x45,
+    0x5A, 0x45, 0x52, 0x25, 0x52, 0x25, 0x52, 0x25, 0x52, 0x25, 0x52, 0x25, 0x52, 0x05, 0x52, 0x25,
+    0x52, 0x05, 0x52, 0x05, 0x52, 0x05, 0x52, 0x05, 0x52, 0x05, 0x52, 0x05, 0x52, 0x05, 0x4A, 0x05,
+    0x49, 0xE5, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4,
+    0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4,
+    0x49, 0xE4, 0x49, 0xE4, 0x49, 0xE4, 0x49, 0xC4, 0x49, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4,
+    0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4,
+    0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xA4, 0x41, 0xA4, 0x39, 0xA4, 0x39, 0x84,
+    0x39, 0x84, 0x39, 0x84, 0x39, 0x84, 0x39, 0x84, 0x39, 0xA4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4,
+    0x93, 0xA7, 0x8B, 0xA7, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x41, 0xC4, 0xBC, 0xA9, 0x41, 0xC4,
+    0x18, 0xC3, 0x18, 0xE3, 0x18, 0xE3, 0x18, 0xE3, 0x18, 0xC3, 0x10, 0xA3, 0x52, 0x25, 0xA4, 0x28,
+    0x21, 0x03, 0x18, 0xC3, 0x18, 0xC3, 0x21, 0x03, 0xA4, 0x08, 0x52, 0x25, 0x72, 0xE5, 0xBC, 0x87,
+    0x83, 0x26, 0x6A, 0x85, 0xCC, 0xA7, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x67, 0xBC, 0x47, 0xBC, 0x47,
+    0xBC, 0x47, 0xBC, 0x47, 0xBC, 0x47, 0xC4, 0x67, 0x9B, 0xC6, 0x62, 0x85, 0x52, 0x05, 0xFF, 0x7C,
+    0x00, 0x29, 0x23, 0x29, 0x43, 0x29, 0x43, 0x29, 0x43, 0x29, 0x43, 0x29, 0x43, 0x29, 0x43, 0x29,
+    0x43, 0x29, 0x43, 0x29, 0x43, 0x29, 0x43, 0x29, 0x43, 0x29, 0x44, 0x29, 0x44, 0x31, 0x44, 0x31,
+    0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x43, 0x31, 0x43, 0x31, 0x43, 0x31, 0x43, 0x31,
+    0x43, 0x31, 0x43, 0x31, 0x43, 0x31, 0x43, 0x31, 0x43, 0x31, 0x43, 0x31, 0x63, 0x52, 0x05, 0xB4,
+    0xA9, 0xF6, 0x2C, 0xC5, 0x0A, 0x5A, 0x65, 0x41, 0xA4, 0x39, 0x84, 0x31, 0x64, 0x31, 0x64, 0x31,
+    0x44, 0x31, 0x44, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x63, 0x49, 0xE4, 0xC4, 0xE9, 0xEE,
+    0x0B, 0x8B, 0x87, 0x41, 0xA4, 0x39, 0xA4, 0x39, 0x84, 0x31, 0x64, 0xFF, 0x10, 0x00, 0x31, 0x44,
+    0x31, 0x64, 0x31, 0x64, 0x39, 0x64, 0x31, 0x64, 0x31, 0x43, 0x29, 0x43, 0x29, 0x43, 0x31, 0x43,
+    0x31, 0x43, 0x31, 0x43, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64,
+    0x31, 0x44, 0x31, 0x43, 0x29, 0x43, 0xFF, 0x0C, 0x00, 0x29, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31,
+    0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x43, 0x29, 0x43, 0xFF, 0x7E, 0x00, 0x72, 0xE6, 0xBC, 0xA8,
+    0x7B, 0x06, 0x4A, 0x04, 0x18, 0xC2, 0x29, 0x43, 0xB4, 0x68, 0x52, 0x24, 0x10, 0xC3, 0x18, 0xE3,
+    0x18, 0xE3, 0x18, 0xE3, 0x18, 0xE3, 0x10, 0xA3, 0x6A, 0xA6, 0x93, 0xC7, 0x18, 0xC3, 0x20, 0xE3,
+    0x52, 0x25, 0x7B, 0x27, 0xC4, 0xCA, 0x4A, 0x05, 0x72, 0xE5, 0xC4, 0x87, 0x83, 0x26, 0x52, 0x04,
+    0x9B, 0xA6, 0x9B, 0x86, 0x93, 0x66, 0x93, 0x66, 0xA3, 0xC6, 0xB4, 0x26, 0xBC, 0x47, 0xBC, 0x67,
+    0xBC, 0x67, 0xC4, 0x87, 0x62, 0x85, 0xFF, 0x7E, 0x00, 0x29, 0x43, 0x29, 0x43, 0x29, 0x43, 0x29,
+    0x44, 0x29, 0x43, 0x29, 0x43, 0x00, 0x00, 0x29, 0x43, 0x29, 0x43, 0x29, 0x43, 0xFF, 0x04, 0x00,
+    0x29, 0x43, 0x29, 0x43, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44,
+    0x31, 0x44, 0x31, 0x43, 0x31, 0x43, 0x29, 0x43, 0x29, 0x43, 0x29, 0x43, 0x31, 0x43, 0x31, 0x44,
+    0x31, 0x63, 0x31, 0x64, 0x39, 0x84, 0x39, 0x84, 0x52, 0x25, 0xB4, 0x89, 0xF6, 0x4C, 0xCD, 0x2A,
+    0x62, 0x65, 0x39, 0x84, 0x39, 0x64, 0x31, 0x64, 0x31, 0x64, 0x39, 0x64, 0x39, 0x84, 0x39, 0x84,
+    0x39, 0x84, 0x41, 0xC4, 0xAC, 0x68, 0xEE, 0x0B, 0x9B, 0xE8, 0x39, 0xA4, 0x39, 0x84, 0x39, 0x84,
+    0x31, 0x64, 0x29, 0x44, 0xFF, 0x12, 0x00, 0x29, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31,
+    0x44, 0x29, 0x44, 0x31, 0x44, 0x31, 0x43, 0x31, 0x44, 0x31, 0x44, 0x31, 0x64, 0x31, 0x64, 0x31,
+    0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x44, 0x31, 0x44, 0x29, 0x44, 0x29, 0x43, 0xFF, 0x0C, 0x00,
+    0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44, 0x31, 0x43,
+    0x29, 0x43, 0xFF, 0x7C, 0x00, 0x31, 0x64, 0x62, 0x85, 0x93, 0xA7, 0xAC, 0x47, 0x29, 0x43, 0x10,
+    0xA2, 0x7B, 0x26, 0x93, 0xA6, 0x20, 0xE3, 0x18, 0xE3, 0x18, 0xE3, 0x18, 0xE3, 0x18, 0xE3, 0x29,
+    0x44, 0xA4, 0x08, 0x62, 0x65, 0x10, 0x82, 0x49, 0xE4, 0xBC, 0x89, 0x9B, 0xC8, 0x6A, 0xE7, 0x00,
+    0x00, 0x7B, 0x06, 0xCC, 0xA7, 0x8B, 0x66, 0xFF, 0x0A, 0x00, 0x31, 0x63, 0x8B, 0x66, 0xBC, 0x66,
+    0xBC, 0x66, 0xC4, 0x86, 0xC4, 0x87, 0x8B, 0x46, 0xFF, 0xA4, 0x00, 0x29, 0x44, 0xFF, 0x10, 0x00,
+    0x29, 0x44, 0x31, 0x64, 0x39, 0x84, 0x39, 0x84, 0x41, 0xA4, 0x52, 0x05, 0xAC, 0x69, 0xF6, 0x2C,
+    0xCD, 0x09, 0x5A, 0x45, 0x31, 0x63, 0x39, 0x84, 0x39, 0x84, 0x39, 0x84, 0x41, 0xA4, 0x41, 0xA4,
+    0x49, 0xC4, 0x9C, 0x08, 0xEE, 0x0B, 0xAC, 0x48, 0x39, 0xA4, 0x31, 0x63, 0x31, 0x63, 0x31, 0x64,
+    0x29, 0x44, 0xFF, 0x22, 0x00, 0x29, 0x43, 0x29, 0x44, 0x29, 0x44, 0x29, 0x44, 0x29, 0x44, 0x29,
+    0x44, 0xFF, 0xAC, 0x00, 0x93, 0xA7, 0x5A, 0x65, 0x08, 0x82, 0x29, 0x43, 0xA4, 0x07, 0x8B, 0x66,
+    0x39, 0xA4, 0x29, 0x24, 0x29, 0x24, 0x41, 0xC5, 0x9B, 0xC8, 0x93, 0xA7, 0x20, 0xE3, 0x10, 0xA2,
+    0x83, 0x26, 0x7B, 0x06, 0xFF, 0x06, 0x00, 0x62, 0x65, 0x93, 0xA6, 0x62, 0x65, 0xFF, 0x0C, 0x00,
+    0x39, 0x84, 0xAC, 0x06, 0xC4, 0x87, 0xC4, 0x87, 0xC4, 0x87, 0xB4, 0x26, 0x39, 0x84, 0xFF, 0xB6,
+    0x00, 0x31, 0x44, 0x31, 0x64, 0x31, 0x84, 0x39, 0x84, 0x41, 0xA4, 0x49, 0xE5, 0xA4, 0x08, 0xED,
+    0xEA, 0xC4, 0xE8, 0x5A, 0x44, 0x39, 0x63, 0x41, 0xA4, 0x41, 0xA4, 0x41, 0xC4, 0x49, 0xE4, 0x93,
+    0xA8, 0xEE, 0x2C, 0xC5, 0x0A, 0x49, 0xE4, 0x31, 0x63, 0x31, 0x63, 0x31, 0x44, 0xFF, 0xDE, 0x00,
+    0x8B, 0x66, 0x83, 0x66, 0x10, 0xA2, 0x10, 0x82, 0x39, 0x83, 0x9B, 0xE7, 0xBC, 0xA9, 0xAC, 0x68,
+    0xB4, 0x69, 0xBC, 0xA9, 0x8B, 0xA7, 0x31, 0x44, 0x10, 0xA2, 0x20, 0xE3, 0x9B, 0xC7, 0x5A, 0x45,
+    0xFF, 0x1A, 0x00, 0x7B, 0x05, 0xC4, 0xA7, 0xC4, 0x87, 0xBC, 0x67, 0xBC, 0x47, 0x6A, 0xA5, 0xFF,
+    0xB8, 0x00, 0x31, 0x64, 0x31, 0x64, 0x31, 0x84, 0x39, 0x84, 0x39, 0x84, 0x41, 0xA4, 0x93, 0xA7,
+    0xED, 0xCA, 0xCD, 0x08, 0x6A, 0x85, 0x41, 0xC4, 0x41, 0xC4, 0x49, 0xE4, 0x8B, 0x87, 0xEE, 0x0C,
+    0xDD, 0x8B, 0x62, 0x86, 0x39, 0x84, 0x31, 0x64, 0x31, 0x64, 0xFF, 0xDE, 0x00, 0x39, 0x83, 0x9B,
+    0xE7, 0x39, 0x84, 0x10, 0x82, 0x10, 0x82, 0x10, 0xA2, 0x21, 0x03, 0x4A, 0x05, 0x6A, 0xC6, 0x6A,
+    0xA6, 0x49, 0xE5, 0x21, 0x03, 0x10, 0xA3, 0x10, 0xA2, 0x10, 0xA2, 0x52, 0x25, 0x93, 0xA7, 0xFF,
+    0x1A, 0x00, 0x41, 0xC4, 0xBC, 0x46, 0xBC, 0x67, 0xBC, 0x47, 0xB4, 0x47, 0x9B, 0xA6, 0xFF, 0xBC,
+    0x00, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x39, 0x64, 0x8B, 0x87, 0xE5, 0xAA, 0xE5,
+    0xAA, 0xB4, 0x89, 0xA4, 0x08, 0xB4, 0x89, 0xEE, 0x0B, 0xDD, 0xCC, 0x72, 0xE7, 0x41, 0xA4, 0x39,
+    0x84, 0x31, 0x64, 0xFF, 0xE0, 0x00, 0x41, 0xC4, 0xA4, 0x07, 0x31, 0x83, 0x10, 0x82, 0x41, 0xC4,
+    0x49, 0xE4, 0x21, 0x03, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x21, 0x03, 0x52, 0x05,
+    0x39, 0xA4, 0x18, 0xA2, 0x52, 0x25, 0xAC, 0x27, 0x31, 0x63, 0xFF, 0x1A, 0x00, 0x5A, 0x24, 0x62,
+    0x64, 0x5A, 0x44, 0x5A, 0x44, 0x52, 0x24, 0xFF, 0xC0, 0x00, 0x31, 0x44, 0x31, 0x44, 0x31, 0x44,
+    0x39, 0x64, 0x7B, 0x06, 0xCD, 0x2A, 0xEE, 0x0C, 0xEE, 0x0B, 0xE5, 0xCB, 0xBC, 0xE9, 0x6A, 0xC6,
+    0x41, 0xA4, 0x39, 0xA4, 0x31, 0x84, 0x31, 0x64, 0xFF, 0xE2, 0x00, 0x5A, 0x65, 0x9B, 0xE7, 0x83,
+    0x46, 0xAC, 0x28, 0xB4, 0x68, 0xA4, 0x08, 0x52, 0x05, 0x18, 0xC3, 0x18, 0xE3, 0x5A, 0x65, 0x9B,
+    0xE8, 0xB4, 0x68, 0xA4, 0x28, 0x83, 0x46, 0xA4, 0x08, 0x52, 0x04, 0xFF, 0xEA, 0x00, 0x31, 0x44,
+    0x31, 0x64, 0x39, 0x84, 0x52, 0x05, 0x6A, 0xC6, 0x6A, 0xC6, 0x5A, 0x45, 0x41, 0xA4, 0x39, 0x84,
+    0x39, 0x84, 0x31, 0x84, 0x31, 0x64, 0x29, 0x44, 0xFF, 0xE4, 0x00, 0x5A, 0x65, 0x7B, 0x06, 0x39,
+    0x84, 0x39, 0xA4, 0xA4, 0x08, 0x83, 0x67, 0x18, 0xC3, 0x21, 0x03, 0xA4, 0x28, 0x83, 0x67, 0x31,
+    0x64, 0x49, 0xE4, 0x8B, 0x87, 0x49, 0xE4, 0xFF, 0xEC, 0x00, 0x29, 0x44, 0x31, 0x64, 0x39, 0x64,
+    0x39, 0x84, 0x39, 0x84, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64,
+    0xFF, 0xF0, 0x00, 0x5A, 0x66, 0xAC, 0x48, 0x5A, 0x45, 0x6A, 0x85, 0xAC, 0x27, 0x31, 0x64, 0xFF,
+    0xF8, 0x00, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x44, 0xFF, 0xFA, 0x00, 0x83,
+    0x47, 0x93, 0x87, 0x93, 0xA7, 0x72, 0xC5, 0xFF, 0xFC, 0x00, 0x31, 0x64, 0x29, 0x64, 0xFF, 0xFF,
+    0x00, 0xFF, 0x19, 0x00
 };
 
 // Original uncompressed size (for decompression)
@@ -606,7 +611,7 @@ const lv_img_dsc_t precision_pour_logo = {
         .h = 40,
         // always_zero and reserved fields are automatically zero-initialized
     },
-    .data_size = 9186,  // Compressed size
+    .data_size = 9188,  // Compressed size
     .data = precision_pour_logo_data,
 };
 
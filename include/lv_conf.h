@@ -25,8 +25,10 @@
 /*Color depth: 1 (1 byte per pixel), 8 (RGB332), 16 (RGB565), 32 (ARGB8888)*/
 #define LV_COLOR_DEPTH 16
 
-/*Swap the 2 bytes of RGB565 color. Useful if the display has an 8-bit interface (e.g. SPI)*/
-#define LV_COLOR_16_SWAP 0
+/*Swap the 2 bytes of RGB565 color. Useful if the display has an 8-bit interface (e.g. SPI)
+ *Enabled: LVGL renders in the ILI9341 wire order (MSB first), so the flush hands the draw
+ *buffer straight to SPI DMA. Image headers in include/images must be generated to match.*/
+#define LV_COLOR_16_SWAP 1
 
 /*Enable more complex drawing routines to manage screens transparency.
  *Can be used if the UI is above another layer, e.g. an OSD menu or video player.*/
@@ -56,10 +58,11 @@
     #endif
     
 #else       /*LV_MEM_CUSTOM*/
-    #define LV_MEM_CUSTOM_INCLUDE <stdlib.h>   /*Header for the dynamic memory function*/
-    #define LV_MEM_CUSTOM_ALLOC   malloc
-    #define LV_MEM_CUSTOM_FREE    free
-    #define LV_MEM_CUSTOM_REALLOC realloc
+    /*Size-class pool (src/utils/lv_pool.cpp), passes through to the heap when LVGL_POOL is off*/
+    #define LV_MEM_CUSTOM_INCLUDE "utils/lv_pool.h"   /*Header for the dynamic memory function*/
+    #define LV_MEM_CUSTOM_ALLOC   lv_pool_alloc
+    #define LV_MEM_CUSTOM_FREE    lv_pool_free
+    #define LV_MEM_CUSTOM_REALLOC lv_pool_realloc
 #endif     /*LV_MEM_CUSTOM*/
 
 /*Number of the intermediate memory buffer used during rendering and other internal processing.
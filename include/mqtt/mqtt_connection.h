@@ -13,10 +13,7 @@
 // Initialize MQTT client
 bool mqtt_connection_init(const char* chip_id);
 
-// Reconnect to MQTT broker
-bool mqtt_connection_reconnect(const char* chip_id);
-
-// Main loop - call this periodically
+// Main loop - starts connection attempts (on a new IP or when the backoff expires)
 void mqtt_connection_loop();
 
 // Check if connected
@@ -29,9 +26,11 @@ void* mqtt_connection_get_handle();
 const char* mqtt_connection_get_subscribe_topic();
 const char* mqtt_connection_get_paid_topic();
 
+// Get device topic base "prefix/chip_id" (for building publish topics)
+const char* mqtt_connection_get_device_topic();
+
 // Internal state updates (for use by mqtt_messages)
-void mqtt_connection_set_connected(bool connected);
-void mqtt_connection_set_connecting(bool connecting);
-bool mqtt_connection_is_connecting();
+void mqtt_connection_on_connected();
+void mqtt_connection_on_disconnected();  // Disconnect or error - schedules a retry
 
 #endif // MQTT_CONNECTION_H
@@ -0,0 +1,48 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * MQTT Command Dispatch
+ * 
+ * Routes inbound messages to handlers by topic suffix without copying them:
+ * - The topic is matched against <prefix>/<chip_id> and the rest is looked up
+ *   in a table of pre-hashed suffixes (FNV-1a)
+ * - The payload is parsed straight from the esp-mqtt event buffer into a
+ *   JsonDocument backed by a static pool, so commands never touch the heap
+ * - Messages split across several events are reassembled into a bounded arena
+ * - Handlers run on the esp-mqtt task; the document is only valid during the call
+ */
+
+#ifndef MQTT_DISPATCH_H
+#define MQTT_DISPATCH_H
+
+#include <ArduinoJson.h>
+#include <stddef.h>
+
+// Topic suffixes under <prefix>/<chip_id>
+#define MQTT_SUFFIX_COMMANDS "/commands"
+#define MQTT_SUFFIX_PAID     "/commands/paid"
+#define MQTT_SUFFIX_LOGS     "/commands/logs"
+#define MQTT_SUFFIX_CONFIG   "/commands/config"
+#define MQTT_SUFFIX_CALIBRATE "/commands/calibrate"
+#define MQTT_SUFFIX_OTA      "/commands/ota"
+#define MQTT_SUFFIX_TRACE    "/commands/trace"
+
+// Command handler (cmd is only valid during the call)
+typedef void (*mqtt_command_handler_t)(JsonObjectConst cmd);
+
+// Register a handler for <prefix>/<chip_id><suffix>, returns false if the table is full
+bool mqtt_dispatch_register(const char* suffix, mqtt_command_handler_t handler);
+
+// Called when a payload is not a JSON object (optional)
+void mqtt_dispatch_set_error_handler(void (*handler)(const char* error));
+
+// Parse and dispatch one complete message (topic and data are not NUL-terminated)
+void mqtt_dispatch_message(const char* topic, size_t topic_len, const char* data, size_t data_len);
+
+// Feed one MQTT_EVENT_DATA event - whole messages are dispatched in place,
+// fragments are reassembled (up to MQTT_MAX_MESSAGE_SIZE) and dispatched when complete
+void mqtt_dispatch_fragment(const char* topic, size_t topic_len, const char* data, size_t data_len,
+                            size_t offset, size_t total);
+
+#endif // MQTT_DISPATCH_H
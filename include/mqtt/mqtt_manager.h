@@ -17,15 +17,23 @@
 
 // ESP-IDF framework
 #include <stdint.h>
+#include <stddef.h>
 typedef uint8_t byte;
 
+#include "mqtt/mqtt_dispatch.h"
+
 // MQTT connection status
 bool mqtt_client_init(const char* chip_id);
 bool mqtt_client_is_connected();
 void mqtt_client_loop();  // Call this in main loop
 bool mqtt_client_publish(const char* topic, const char* payload);
+int mqtt_client_publish_data(const char* topic, const void* data, size_t len, int qos);  // Binary payload, returns msg_id or -1
+bool mqtt_client_publish_telemetry(const char* name, const char* payload);  // Publishes to prefix/chip_id/telemetry/<name>
+int mqtt_client_publish_telemetry_data(const char* name, const void* data, size_t len, int qos);  // Returns msg_id or -1
+void mqtt_client_set_published_callback(void (*callback)(int msg_id));  // QoS 1 PUBACK received (esp-mqtt task)
 bool mqtt_client_subscribe(const char* topic);
-void mqtt_client_set_callback(void (*callback)(char* topic, byte* payload, unsigned int length));
+bool mqtt_client_on_command(const char* suffix, mqtt_command_handler_t handler);  // Handle prefix/chip_id<suffix>
+void mqtt_client_set_parse_error_callback(void (*callback)(const char* error));
 bool mqtt_client_has_activity();  // Returns true if there was recent TX/RX activity
 
 #endif // MQTT_MANAGER_H
@@ -18,15 +18,15 @@
     typedef uint8_t byte;
 #endif
 
-// Set user callback for received messages
-void mqtt_messages_set_callback(void (*callback)(char* topic, byte* payload, unsigned int length));
-
 // Check if there was recent MQTT activity (TX/RX)
 bool mqtt_messages_has_activity();
 
 // Mark activity (called internally)
 void mqtt_messages_mark_activity();
 
+// Called with the msg_id of each acknowledged publish (MQTT_EVENT_PUBLISHED)
+void mqtt_messages_set_published_callback(void (*callback)(int msg_id));
+
 // Initialize message handling (register event handlers)
 void mqtt_messages_init(void* client_handle);
 
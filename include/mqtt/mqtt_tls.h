@@ -0,0 +1,34 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * MQTT TLS Transport
+ * 
+ * esp-tls transport for mqtts:// that resumes the previous TLS session:
+ * - The session (ticket or session ID) from the last connection is offered on
+ *   every reconnect, so the broker can skip the certificate exchange and the
+ *   ECDHE/RSA work of a full handshake
+ * - The session is also kept in RTC memory, so a soft reset (watchdog, panic,
+ *   OTA restart) resumes too; power loss falls back to a full handshake
+ * - TCP keep-alive holds the connection open between MQTT pings
+ * - The broker is verified against the ESP-IDF certificate bundle
+ * 
+ * Enabled with CONFIG_MQTT_USE_TLS (port 8883).
+ */
+
+#ifndef MQTT_TLS_H
+#define MQTT_TLS_H
+
+#include "config.h"
+
+#if MQTT_USE_TLS
+
+#include <esp_transport.h>
+
+// Create the transport for esp_mqtt_client_config_t.network.transport
+// (esp-mqtt owns it and destroys it with the client). Returns NULL on failure.
+esp_transport_handle_t mqtt_tls_transport_create(const char* host, int port);
+
+#endif // MQTT_USE_TLS
+
+#endif // MQTT_TLS_H
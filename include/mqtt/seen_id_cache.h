@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Seen ID Cache
+ * 
+ * Remembers the last few hundred command IDs so a QoS 1 redelivery of the
+ * same paid command is recognised and dropped. Header-only, no platform
+ * dependencies (unit tested on the host).
+ * 
+ * - IDs are stored as 64-bit FNV-1a hashes, never as strings
+ * - Set-associative: the hash picks one set of SEEN_ID_WAYS entries, kept
+ *   most recent first, so a lookup is a fixed handful of compares
+ * - A full set drops its least recently seen ID; memory never grows
+ * 
+ * Not thread safe: use one cache per task (paid commands all arrive on the
+ * esp-mqtt task).
+ */
+
+#ifndef SEEN_ID_CACHE_H
+#define SEEN_ID_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define SEEN_ID_SETS 64   // Power of two
+#define SEEN_ID_WAYS 4    // 256 IDs, 2 KB
+
+typedef struct {
+    uint64_t hashes[SEEN_ID_SETS][SEEN_ID_WAYS];  // 0 = empty slot
+} seen_id_cache_t;
+
+static inline uint64_t seen_id_hash(const char* id) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (const uint8_t* p = (const uint8_t*)id; *p != '\0'; p++) {
+        hash ^= *p;
+        hash *= 1099511628211ULL;
+    }
+    return hash != 0 ? hash : 1;  // 0 marks an empty slot
+}
+
+static inline void seen_id_clear(seen_id_cache_t* cache) {
+    memset(cache, 0, sizeof(*cache));
+}
+
+/**
+ * Record id as seen
+ * 
+ * @return true if it was already in the cache (a duplicate)
+ */
+static inline bool seen_id_check_and_add(seen_id_cache_t* cache, const char* id) {
+    uint64_t hash = seen_id_hash(id);
+    uint64_t* set = cache->hashes[(hash ^ (hash >> 32)) & (SEEN_ID_SETS - 1)];
+    
+    // Move the hit (or the evicted last way) to the front
+    int way = 0;
+    while (way < SEEN_ID_WAYS - 1 && set[way] != hash && set[way] != 0) {
+        way++;
+    }
+    bool seen = (set[way] == hash);
+    memmove(&set[1], &set[0], sizeof(set[0]) * way);
+    set[0] = hash;
+    return seen;
+}
+
+#endif // SEEN_ID_CACHE_H
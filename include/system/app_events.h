@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Application Events
+ * 
+ * Event group that wakes the main loop and the UI task. Producers (flow
+ * sampling task, MQTT and WiFi event handlers, touch IRQ, UI command queue)
+ * post bits; each consumer waits on its own set of bits until one is set or
+ * its next deadline passes.
+ */
+
+#ifndef APP_EVENTS_H
+#define APP_EVENTS_H
+
+#include <stdint.h>
+
+// Event bits
+#define APP_EVENT_FLOW      (1UL << 0)  // Flow meter published a changed sample
+#define APP_EVENT_MQTT      (1UL << 1)  // MQTT message received
+#define APP_EVENT_NETWORK   (1UL << 2)  // WiFi or MQTT connection state changed
+#define APP_EVENT_TOUCH     (1UL << 3)  // Touch panel pressed (PENIRQ)
+#define APP_EVENT_UI        (1UL << 4)  // UI command queued
+#define APP_EVENT_POUR      (1UL << 5)  // Pour session volume, cost or state changed
+#define APP_EVENT_POUR_REQUEST (1UL << 6)  // Pour start/stop queued for the main loop
+#define APP_EVENT_ALL       (APP_EVENT_FLOW | APP_EVENT_MQTT | APP_EVENT_NETWORK | APP_EVENT_TOUCH | APP_EVENT_UI | \
+                             APP_EVENT_POUR | APP_EVENT_POUR_REQUEST)
+
+// Create the event group (call before any producer starts)
+void app_events_init();
+
+// Post events from task context (no-op before init)
+void app_events_post(uint32_t events);
+
+// Post events from ISR context (no-op before init)
+void app_events_post_from_isr(uint32_t events);
+
+// Wait until any of events is posted or timeout_ms passes
+// Returns the requested events that were set (and clears only those)
+uint32_t app_events_wait(uint32_t events, uint32_t timeout_ms);
+
+#endif // APP_EVENTS_H
@@ -0,0 +1,51 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Boot Orchestrator
+ * 
+ * Brings the network up in its own task while app_main builds the UI, and
+ * tracks which subsystems are ready. Local stages (display, touch, flow, UI)
+ * drive the splash progress bar; network stages (WiFi, NTP, MQTT) are marked
+ * by their event handlers whenever the radio gets there.
+ */
+
+#ifndef BOOT_H
+#define BOOT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Readiness bits
+#define BOOT_READY_DISPLAY  (1UL << 0)  // Panel and LVGL driver up
+#define BOOT_READY_TOUCH    (1UL << 1)  // Touch controller up
+#define BOOT_READY_FLOW     (1UL << 2)  // Flow meter and valve up
+#define BOOT_READY_UI       (1UL << 3)  // QR screen shown, UI task running
+#define BOOT_READY_WIFI     (1UL << 4)  // Station has an IP address
+#define BOOT_READY_NTP      (1UL << 5)  // Time synchronized
+#define BOOT_READY_MQTT     (1UL << 6)  // Broker connected
+#define BOOT_READY_LOCAL    (BOOT_READY_DISPLAY | BOOT_READY_TOUCH | BOOT_READY_FLOW | BOOT_READY_UI)
+#define BOOT_READY_ALL      (BOOT_READY_LOCAL | BOOT_READY_WIFI | BOOT_READY_NTP | BOOT_READY_MQTT)
+
+// Start the network bring-up task (WiFi, then MQTT) - call once NVS is ready
+// chip_id is copied; MQTT is initialized even if WiFi is not up yet
+void boot_start_network(const char* chip_id);
+
+// True once WiFi and MQTT are initialized and their loops may run
+bool boot_network_started();
+
+// Mark stages ready (safe from any task, logs the first time each is set)
+void boot_mark_ready(uint32_t stages);
+
+// Currently ready stages
+uint32_t boot_get_ready();
+
+// Splash progress (0-100) from the local stages that are ready
+uint8_t boot_get_progress();
+
+#endif // BOOT_H
@@ -0,0 +1,68 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Boot Profiler
+ * 
+ * Timestamps named boot phases so slow power-up to payable can be tracked
+ * across the fleet.
+ * 
+ * - Each phase keeps the first esp_timer time it was reached (ms since start)
+ * - The boot is appended to a history of the last BOOT_PROFILE_HISTORY boots
+ *   in NVS once the first subscribe ack arrives (or the boot times out), so
+ *   boots that never reached the broker are reported by the next one
+ * - The history is published once per boot on <prefix>/<chip_id>/telemetry/boot
+ * - Compiles to nothing with BOOT_PROFILE_ENABLED 0
+ */
+
+#ifndef BOOT_PROFILE_H
+#define BOOT_PROFILE_H
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Boot phases, in the order they normally complete
+typedef enum {
+    BOOT_PHASE_NVS,          // NVS flash initialized
+    BOOT_PHASE_LVGL,         // lv_init() done
+    BOOT_PHASE_DISPLAY,      // Panel and LVGL display driver up
+    BOOT_PHASE_FIRST_FLUSH,  // First LVGL flush sent to the panel
+    BOOT_PHASE_TOUCH,        // Touch controller up
+    BOOT_PHASE_WIFI,         // Associated with the AP
+    BOOT_PHASE_IP,           // IP address acquired
+    BOOT_PHASE_MQTT,         // Broker connected
+    BOOT_PHASE_SUBSCRIBED,   // First subscribe ack
+    BOOT_PHASE_COUNT
+} boot_phase_t;
+
+#if BOOT_PROFILE_ENABLED
+
+// Record that a phase was reached (first call per boot wins)
+void boot_profile_mark(boot_phase_t phase);
+
+// Save the boot to NVS when complete and publish the report once MQTT is up (call in main loop)
+void boot_profile_loop();
+
+// Format this boot and the stored history as JSON, returns the length written (0 if it did not fit)
+size_t boot_profile_format_json(char* buf, size_t size);
+
+// Print this boot's phases to the log (serial)
+void boot_profile_log_report();
+
+#else
+
+static inline void boot_profile_mark(boot_phase_t phase) { (void)phase; }
+static inline void boot_profile_loop() {}
+static inline size_t boot_profile_format_json(char* buf, size_t size) { (void)buf; (void)size; return 0; }
+static inline void boot_profile_log_report() {}
+
+#endif // BOOT_PROFILE_ENABLED
+
+#endif // BOOT_PROFILE_H
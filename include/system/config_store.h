@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Config Store
+ * 
+ * All persisted runtime settings in one RAM struct, loaded from NVS once at
+ * boot. Reads never touch flash.
+ * 
+ * - Kconfig values are the defaults; a stored value overrides them
+ * - Setters update RAM at once and mark the store dirty; the whole struct is
+ *   written back as one blob after CONFIG_STORE_SAVE_DELAY_MS without
+ *   further changes, so a burst of updates costs one flash write
+ * - Remote updates arrive on <prefix>/<chip_id>/commands/config, e.g.
+ *   {"currency":"EUR ","finished_timeout_sec":8}; the resulting settings are
+ *   published on <prefix>/<chip_id>/telemetry/config (password omitted)
+ * - The first boot without a stored blob imports the WiFi credentials and
+ *   learned stop latencies from their old NVS keys
+ * - Fields are only ever appended: a blob from older firmware loads into the
+ *   front of the struct and the rest keeps its defaults
+ * 
+ * Getters and setters may be called from any task.
+ */
+
+#ifndef CONFIG_STORE_H
+#define CONFIG_STORE_H
+
+#include "config.h"
+#include "flow/k_factor.h"
+
+#include <ArduinoJson.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define CONFIG_STORE_SAVE_DELAY_MS 2000
+#define CONFIG_SSID_SIZE 33         // 32 + terminator (802.11 limit)
+#define CONFIG_PASSWORD_SIZE 65     // 64 + terminator (WPA2 limit)
+#define CONFIG_CURRENCY_SIZE 8
+#define CONFIG_MAX_TAPS 4           // Stored blob keeps a fixed size whatever FLOW_TAP_COUNT is
+
+typedef struct {
+    // WiFi credentials (from provisioning), only used while wifi_use_saved is set
+    char wifi_ssid[CONFIG_SSID_SIZE];
+    char wifi_password[CONFIG_PASSWORD_SIZE];
+    bool wifi_use_saved;
+    
+    // UI
+    char currency_symbol[CONFIG_CURRENCY_SIZE];  // Used when a paid command has no currency
+    uint16_t finished_timeout_sec;
+    
+    // Learned valve stop latency per tap (0 = not learned, use the default)
+    uint32_t stop_latency_us[CONFIG_MAX_TAPS];
+    
+    // Flow sensor K-factor curve per tap (empty = flat calibration), from calibration pours
+    k_factor_table_t k_factor[CONFIG_MAX_TAPS];
+} device_config_t;
+
+/**
+ * Load the settings from NVS (call once, after nvs_flash_init())
+ */
+void config_store_init();
+
+/**
+ * Copy of all settings
+ */
+void config_store_get(device_config_t* out);
+
+/**
+ * Saved WiFi credentials
+ * @return false if none are saved
+ */
+bool config_store_get_wifi(char* ssid, size_t ssid_size, char* password, size_t password_size);
+
+void config_store_get_currency(char* buf, size_t size);
+uint16_t config_store_get_finished_timeout_sec();
+uint32_t config_store_get_stop_latency_us(uint8_t tap);
+void config_store_get_k_factor(uint8_t tap, k_factor_table_t* out);
+
+void config_store_set_wifi(const char* ssid, const char* password);
+void config_store_set_currency(const char* symbol);
+void config_store_set_finished_timeout_sec(uint16_t sec);
+void config_store_set_stop_latency_us(uint8_t tap, uint32_t us);
+void config_store_set_k_factor(uint8_t tap, const k_factor_table_t* table);
+
+/**
+ * Apply a remote update; unknown keys are ignored
+ * @return Number of settings changed (-1 if a value was out of range, nothing applied)
+ */
+int config_store_apply_json(JsonObjectConst update);
+
+/**
+ * Format the settings as JSON (WiFi password omitted)
+ * @return Length written, 0 if it did not fit
+ */
+size_t config_store_format_json(char* buf, size_t size);
+
+/**
+ * Write pending changes now (e.g. before a restart)
+ */
+void config_store_flush();
+
+/**
+ * Write pending changes once they have settled (call in main loop)
+ * @return How long until the pending write is due (ms), UINT32_MAX if none
+ */
+uint32_t config_store_loop();
+
+#endif // CONFIG_STORE_H
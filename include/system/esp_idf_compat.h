@@ -128,7 +128,7 @@ typedef struct {
     gpio_int_type_t type;
 } gpio_isr_handler_t;
 
-// Global ISR handler storage
+// Global ISR handler storage (attachInterrupt() only - see esp_idf_gpio_isr.cpp)
 extern gpio_isr_handler_t gpio_isr_handlers[GPIO_NUM_MAX];
 
 static inline void attachInterrupt(int pin, voidFuncPtr func, int mode) {
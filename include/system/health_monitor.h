@@ -0,0 +1,59 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Health Monitor
+ * 
+ * Background task that tracks memory headroom over the device's uptime, so
+ * buffers and task stacks can be sized from fleet data instead of guesses.
+ * 
+ * - Every HEALTH_MONITOR_INTERVAL_SEC: free, minimum-ever free and largest
+ *   free block for DRAM, IRAM, PSRAM and DMA-capable memory, plus the stack
+ *   high-water mark (bytes never used), core and CPU share of every task
+ * - Published on <prefix>/<chip_id>/telemetry/health as compact deltas: only
+ *   heap values that moved by HEALTH_MONITOR_DELTA_BYTES or more, stacks
+ *   whose high-water mark changed and CPU shares that moved by 2 points or
+ *   more. A full snapshot ("full":1) is sent after
+ *   each connect and every HEALTH_MONITOR_FULL_EVERY reports
+ * - Compiles to nothing with HEALTH_MONITOR_ENABLED 0
+ * 
+ * Payload: {"up":s,"full":1,"heap":{"dram":[free,min,largest],...},
+ *           "frag":pct,"stk":{"main_loop":bytes,...},"core":{"main_loop":0,...},
+ *           "cpu":{"main_loop":pct,...},"load":[core0,core1]}
+ * frag is DRAM fragmentation: 100 - largest * 100 / free. core is the pinned
+ * core (-1 = either, full snapshots only), cpu a task's share of one core
+ * over the last interval and load each core's busy percentage.
+ */
+
+#ifndef HEALTH_MONITOR_H
+#define HEALTH_MONITOR_H
+
+#include "config.h"
+
+#include <stddef.h>
+
+#if HEALTH_MONITOR_ENABLED
+
+// Start the sampling task
+bool health_monitor_init();
+
+// Format a full snapshot as JSON, returns the length written (0 if it did not fit)
+size_t health_monitor_format_json(char* buf, size_t size);
+
+// Print a full snapshot to the log (serial "health" command)
+void health_monitor_log_report();
+
+#else
+
+static inline bool health_monitor_init() { return true; }
+static inline size_t health_monitor_format_json(char* buf, size_t size) { (void)buf; (void)size; return 0; }
+static inline void health_monitor_log_report() {}
+
+#endif // HEALTH_MONITOR_ENABLED
+
+#endif // HEALTH_MONITOR_H
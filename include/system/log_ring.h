@@ -0,0 +1,71 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Binary Log Ring
+ * 
+ * Keeps the most recent log lines in RTC memory so they survive soft resets
+ * (panic, watchdog, esp_restart) and can be fetched over MQTT without a
+ * serial cable.
+ * 
+ * - Hooks ESP-IDF logging ahead of the UART/async sink; lines up to
+ *   LOG_RING_LEVEL are recorded
+ * - A record is the format string's address plus the packed arguments
+ *   (strings copied, truncated), not rendered text, so recording is one
+ *   format scan and a short copy
+ * - Text is only rendered on retrieval. Format addresses are only meaningful
+ *   for the firmware that wrote them, so a ring left by another build (OTA)
+ *   is discarded at boot.
+ * - Compiles to stubs with LOG_RING_ENABLED 0
+ */
+
+#ifndef LOG_RING_H
+#define LOG_RING_H
+
+#include "config.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#define LOG_RING_CHUNK_SIZE 768   // Rendered text per chunk
+
+// Receives rendered text in order (NUL-terminated at len); index counts chunks from 0
+typedef void (*log_ring_chunk_cb_t)(const char* text, size_t len, int index, bool last, void* ctx);
+
+#if LOG_RING_ENABLED
+
+/**
+ * Keep or discard the ring left by the previous boot and start recording
+ * 
+ * Call after log_sink_init() so records are taken before lines are queued.
+ */
+void log_ring_init();
+
+/**
+ * Render the ring oldest first and pass it on in LOG_RING_CHUNK_SIZE chunks
+ * 
+ * Lines from earlier boots are preceded by a "--- boot -N ---" marker.
+ * 
+ * @return Number of records rendered (the callback runs at least once)
+ */
+int log_ring_render(log_ring_chunk_cb_t cb, void* ctx);
+
+/**
+ * Drop everything recorded so far
+ */
+void log_ring_clear();
+
+#else
+
+static inline void log_ring_init() {}
+static inline int log_ring_render(log_ring_chunk_cb_t cb, void* ctx) { (void)cb; (void)ctx; return 0; }
+static inline void log_ring_clear() {}
+
+#endif // LOG_RING_ENABLED
+
+#endif // LOG_RING_H
@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Asynchronous Log Sink
+ * 
+ * Replaces ESP-IDF's log output (esp_log_set_vprintf) so a log call only
+ * formats into a ring buffer; a low-priority task writes the lines to the
+ * UART. Lines are formatted straight into the ring, so a log call puts no
+ * line buffer on the caller's stack. Each line is stamped with the wall clock once NTP time is set. The
+ * stamp is formatted once per second and reused.
+ * 
+ * - A caller never blocks: when the ring is full the line is dropped and
+ *   counted, and the drain task reports the count
+ * - Lines still queued at esp_restart() are flushed by a shutdown handler,
+ *   and printed through the ROM (without time stamp) before a panic report
+ * - Compiles to stubs with LOG_SINK_ENABLED 0 (synchronous ESP-IDF output)
+ */
+
+#ifndef LOG_SINK_H
+#define LOG_SINK_H
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define LOG_TIME_PREFIX_SIZE 20   // "YYYY-MM-DD HH:MM:SS" + terminator
+
+/**
+ * Copy the cached wall clock string for the current second into buf
+ * 
+ * Safe from any task. Reformats only when the second changes.
+ * 
+ * @param buf At least LOG_TIME_PREFIX_SIZE bytes
+ * @return false (buf empty) if the time has not been synchronized yet
+ */
+bool log_time_prefix(char* buf, size_t size);
+
+#if LOG_SINK_ENABLED
+
+/**
+ * Create the ring and drain task and redirect ESP-IDF logging into it
+ */
+void log_sink_init();
+
+/**
+ * Write everything queued to the UART now (calling task)
+ */
+void log_sink_flush();
+
+/**
+ * Lines dropped because the ring was full since boot
+ */
+uint32_t log_sink_dropped();
+
+#else
+
+static inline void log_sink_init() {}
+static inline void log_sink_flush() {}
+static inline uint32_t log_sink_dropped() { return 0; }
+
+#endif // LOG_SINK_ENABLED
+
+#endif // LOG_SINK_H
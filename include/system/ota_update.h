@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * OTA Updates
+ * 
+ * Firmware updates into the inactive app slot (ota_0 / ota_1 in
+ * config/partitions_ota.csv), driven over MQTT on
+ * <prefix>/<chip_id>/commands/ota:
+ * 
+ *   {"action":"start","url":"https://.../fw.bin.z","sha256":"<64 hex>",
+ *    "encoding":"zlib"}          download, verify and boot the image
+ *   {"action":"cancel"}          abort a download that has not finished
+ *   {"action":"status"}          report the state
+ * 
+ * The image is streamed in chunks from HTTPS straight into flash, never held
+ * in RAM. "encoding" is "raw" (default) or "zlib" (a zlib stream of the .bin,
+ * inflated on the fly); sha256 is over the uncompressed image and checked
+ * before the slot is made bootable.
+ * 
+ * Nothing touches flash while a tap is pouring: a download waits for the taps
+ * to go idle and starts over if a pour begins part way through, and the
+ * restart into the new image also waits for idle taps.
+ * 
+ * A new image boots in the bootloader's pending-verify state. Once MQTT is
+ * connected and it has run OTA_HEALTHY_SEC it is marked valid; if it is not
+ * healthy within OTA_ROLLBACK_TIMEOUT_SEC (or resets first) the previous
+ * image comes back.
+ * 
+ * Status on telemetry/ota: {"state":"downloading","written":bytes,
+ * "error":"...","running":"ota_0","version":"..."}
+ */
+
+#ifndef OTA_UPDATE_H
+#define OTA_UPDATE_H
+
+#include "config.h"
+
+#include <ArduinoJson.h>
+#include <stddef.h>
+
+#if OTA_UPDATES_ENABLED
+
+// Check the running image (pending verify after an update), call once at boot
+bool ota_update_init();
+
+/**
+ * Handle an ota command (any task)
+ * @param reply JSON result and state, for telemetry/ota
+ * @return Length of the reply, 0 if it did not fit
+ */
+size_t ota_update_command(JsonObjectConst cmd, char* reply, size_t size);
+
+// Main loop: confirm a healthy image, roll back an unhealthy one, restart into a downloaded one
+void ota_update_loop(bool pour_active);
+
+#else
+
+static inline bool ota_update_init() { return true; }
+static inline size_t ota_update_command(JsonObjectConst cmd, char* reply, size_t size) {
+    (void)cmd; (void)reply; (void)size; return 0;
+}
+static inline void ota_update_loop(bool pour_active) { (void)pour_active; }
+
+#endif // OTA_UPDATES_ENABLED
+
+#endif // OTA_UPDATE_H
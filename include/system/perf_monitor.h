@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Performance Monitor
+ * 
+ * Lightweight on-device profiler for the render pipeline.
+ * 
+ * - Spans are timed with the CPU cycle counter (begin/end on the same task)
+ * - Each metric keeps count, sum, min, max and a log2 histogram
+ * - Recording is ISR-safe so SPI completion callbacks can record flush times
+ * - Compiles to nothing with PERF_MONITOR_ENABLED 0
+ * 
+ * End-to-end latencies are recorded alongside: a paid command is followed by
+ * perf_monitor_mark() from MQTT arrival to the first flush of the pouring
+ * screen, and the cut-off path records the time from the pulse
+ * that reached max_ml to the valve command and from there to the flow
+ * stopping. perf_monitor_format_latency_json() reports just those, for
+ * publishing after every pour.
+ */
+
+#ifndef PERF_MONITOR_H
+#define PERF_MONITOR_H
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Profiled metrics
+typedef enum {
+    PERF_RENDER_US,      // lv_timer_handler() duration
+    PERF_FLUSH_US,       // Flush callback entry to last SPI chunk on the wire
+    PERF_FLUSH_BYTES,    // Bytes sent per flush
+    PERF_FRAME_PIXELS,   // Pixels flushed per frame (sum of areas up to the last flush)
+    PERF_INPUT_US,       // Touch read callback duration
+    PERF_LOOP_US,        // Main loop iteration duration
+    PERF_PAID_PARSE_US,  // MQTT_EVENT_DATA to paid command accepted
+    PERF_PAID_SCREEN_US, // MQTT_EVENT_DATA to pouring screen built
+    PERF_PAID_PIXEL_US,  // MQTT_EVENT_DATA to the pouring screen's first flush
+    PERF_CUTOFF_US,      // Pulse reaching the cut-off to the valve close command
+    PERF_STOP_US,        // Valve close to flow stopped (measured from the overshoot)
+    PERF_METRIC_COUNT
+} perf_metric_t;
+
+#define PERF_LATENCY_FIRST PERF_PAID_PARSE_US
+
+// Points on the paid command path, in order
+typedef enum {
+    PERF_MARK_MQTT_RX,   // Message arrived (first fragment)
+    PERF_MARK_PAID,      // Paid command accepted - starts a latency chain from the arrival
+    PERF_MARK_SCREEN,    // Pouring screen built
+    PERF_MARK_FLUSH,     // Display flush started (the screen has been rendered)
+} perf_mark_t;
+
+#if PERF_MONITOR_ENABLED
+
+// Reset all histograms
+void perf_monitor_init();
+
+// Start a span - returns the CPU cycle counter
+uint32_t perf_monitor_begin();
+
+// End a span started on the same core and record it in microseconds
+void perf_monitor_end_us(perf_metric_t metric, uint32_t start_cycles);
+
+// Record a raw value (ISR-safe)
+void perf_monitor_record(perf_metric_t metric, uint32_t value);
+
+// Stamp a point on the paid command path (ISR-safe)
+void perf_monitor_mark(perf_mark_t mark);
+
+// Clear all histograms
+void perf_monitor_reset();
+
+// Format the report as JSON, returns the length written (0 if it did not fit)
+size_t perf_monitor_format_json(char* buf, size_t size);
+
+// Format the end-to-end latencies with the firmware version, for prefix/chip_id/telemetry/latency
+size_t perf_monitor_format_latency_json(char* buf, size_t size);
+
+// Print the report to the log (serial)
+void perf_monitor_log_report();
+
+#else
+
+static inline void perf_monitor_init() {}
+static inline uint32_t perf_monitor_begin() { return 0; }
+static inline void perf_monitor_end_us(perf_metric_t metric, uint32_t start_cycles) { (void)metric; (void)start_cycles; }
+static inline void perf_monitor_record(perf_metric_t metric, uint32_t value) { (void)metric; (void)value; }
+static inline void perf_monitor_mark(perf_mark_t mark) { (void)mark; }
+static inline void perf_monitor_reset() {}
+static inline size_t perf_monitor_format_json(char* buf, size_t size) { (void)buf; (void)size; return 0; }
+static inline size_t perf_monitor_format_latency_json(char* buf, size_t size) { (void)buf; (void)size; return 0; }
+static inline void perf_monitor_log_report() {}
+
+#endif // PERF_MONITOR_ENABLED
+
+#endif // PERF_MONITOR_H
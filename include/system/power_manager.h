@@ -0,0 +1,65 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Power Management
+ * 
+ * Dynamic frequency scaling and automatic light sleep (esp_pm) for always-on
+ * units. The CPU drops to POWER_MIN_CPU_MHZ whenever nothing holds it up and
+ * the chip light-sleeps in idle once light sleep is allowed.
+ * 
+ * - POWER_HOLD_POUR: full CPU speed, held for the whole pour.
+ * - POWER_HOLD_FLOW: no light sleep, held by flow_meter_init() while a meter
+ *   is counting. PCNT stops in light sleep and the ISR backend's edge
+ *   interrupt does not wake the chip, so idle and leak pulses (flow/flow_stats.h)
+ *   would be lost. With FLOW_METER_GLITCH_FILTER_NS > 0 the PCNT driver also
+ *   holds its own APB-max lock for the filter clock, which keeps the APB at
+ *   80 MHz and likewise prevents light sleep. So with taps fitted the chip
+ *   never light-sleeps; the CPU still scales down to POWER_MIN_CPU_MHZ.
+ * - POWER_HOLD_DISPLAY: APB at 80 MHz, no light sleep. The LEDC backlight and
+ *   the display SPI clock run from APB, so this is held while the panel is lit.
+ * 
+ * WiFi modem sleep (see wifi_manager) bounds how late a paid command is seen:
+ * up to POWER_WIFI_LISTEN_INTERVAL beacon intervals (~102 ms each).
+ * Compiles to stubs with POWER_MANAGEMENT_ENABLED 0.
+ */
+
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include "config.h"
+
+#include <stdbool.h>
+
+typedef enum {
+    POWER_HOLD_POUR = 0,
+    POWER_HOLD_DISPLAY,
+    POWER_HOLD_FLOW,
+    POWER_HOLD_COUNT
+} power_hold_t;
+
+#if POWER_MANAGEMENT_ENABLED
+
+/**
+ * Configure esp_pm and create the hold locks (call early in setup)
+ */
+void power_manager_init();
+
+/**
+ * Take or drop a hold (idempotent, any task)
+ */
+void power_manager_hold(power_hold_t hold, bool held);
+
+#else
+
+static inline void power_manager_init() {}
+static inline void power_manager_hold(power_hold_t hold, bool held) { (void)hold; (void)held; }
+
+#endif // POWER_MANAGEMENT_ENABLED
+
+#endif // POWER_MANAGER_H
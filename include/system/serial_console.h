@@ -0,0 +1,35 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Serial Console
+ * 
+ * Minimal line-based command console on the UART/USB stdin.
+ * 
+ * - stdin is switched to non-blocking, so polling never stalls the caller
+ * - A line is "<name> [args]", dispatched to the handler registered for <name>
+ */
+
+#ifndef SERIAL_CONSOLE_H
+#define SERIAL_CONSOLE_H
+
+#include <stdbool.h>
+
+// Command handler - args is the rest of the line after the command name ("" if none)
+typedef void (*serial_console_handler_t)(const char* args);
+
+// Put stdin into non-blocking mode
+void serial_console_init();
+
+// Register a command (returns false if the table is full)
+bool serial_console_register(const char* name, serial_console_handler_t handler);
+
+// Read pending input and run any completed command lines (call in main loop)
+void serial_console_poll();
+
+#endif // SERIAL_CONSOLE_H
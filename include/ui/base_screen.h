@@ -16,7 +16,9 @@
  * - Data icon at bottom right (shared component)
  * 
  * All screens should use this component to ensure consistent layout
- * and minimize memory usage through shared UI elements.
+ * and minimize memory usage through shared UI elements. The shared
+ * elements live on lv_layer_top(), so each screen is a separate lv_obj
+ * screen that is built once and switched with lv_scr_load().
  */
 
 #ifndef BASE_SCREEN_H
@@ -33,20 +35,27 @@
 #define BASE_SCREEN_ICON_MARGIN 5
 
 /**
- * Create the base screen layout
- * This creates the standard layout with logo, WiFi icon, and data icon
- * @param parent Parent object (usually lv_scr_act())
- * @return Pointer to content area container, or NULL on error
+ * Create the shared layer (logo, WiFi icon, data icon) on lv_layer_top()
+ * Safe to call more than once; the layer is drawn above every screen
+ * @return true if the shared layer exists
+ */
+bool base_screen_init();
+
+/**
+ * Set up a screen with the standard layout
+ * Creates the shared layer on first use and a content area on the screen
+ * @param screen Screen object (created with lv_obj_create(NULL))
+ * @return Pointer to the screen's content area, or NULL on error
  *         Screen-specific content should be added to this container
  */
-lv_obj_t* base_screen_create(lv_obj_t* parent);
+lv_obj_t* base_screen_create(lv_obj_t* screen);
 
 /**
- * Get the content area container
- * Use this to add screen-specific content
- * @return Pointer to content area container, or NULL if not created
+ * Make a screen active with lv_scr_load()
+ * The boot (splash) screen is deleted the first time it is left
+ * @param screen Screen object created with base_screen_create()
  */
-lv_obj_t* base_screen_get_content_area();
+void base_screen_load(lv_obj_t* screen);
 
 /**
  * Update the base screen (WiFi and data icons)
@@ -55,8 +64,14 @@ lv_obj_t* base_screen_get_content_area();
 void base_screen_update();
 
 /**
- * Clean up the base screen
- * Note: Shared components (logo, WiFi icon, data icon) persist across screens
+ * Refresh the icons immediately, bypassing the RSSI throttle
+ * Call when WiFi or MQTT connection state changes
+ */
+void base_screen_refresh_network();
+
+/**
+ * Delete the shared layer (logo, WiFi icon, data icon)
+ * Screens delete their own content areas with the screen object
  */
 void base_screen_cleanup();
 
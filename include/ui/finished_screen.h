@@ -21,11 +21,22 @@
 
 /**
  * Initialize the finished screen
+ * Builds the screen objects (once)
+ */
+void finished_screen_init();
+
+/**
+ * Make the finished screen active with the final values (builds it on first use)
  * @param final_volume_ml Final volume in milliliters
  * @param final_cost Final cost
  * @param currency Currency symbol (e.g., "GBP ", "$")
  */
-void finished_screen_init(float final_volume_ml, float final_cost, const char* currency);
+void finished_screen_show(float final_volume_ml, float final_cost, const char* currency);
+
+/**
+ * Mark the finished screen inactive before another screen is loaded
+ */
+void finished_screen_hide();
 
 /**
  * Update the finished screen
@@ -35,7 +46,7 @@ void finished_screen_init(float final_volume_ml, float final_cost, const char* c
 bool finished_screen_update();
 
 /**
- * Clean up the finished screen
+ * Delete the finished screen (must not be the active screen)
  */
 void finished_screen_cleanup();
 
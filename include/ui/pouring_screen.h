@@ -11,52 +11,40 @@
  * 
  * Screen displayed during active pouring, showing flow rate, volume, and cost.
  * Uses base_screen for standard layout (logo, WiFi icon, data icon).
+ * 
+ * Only renders one tap's pour session (flow/pour_session.h) - the valve,
+ * billing and reporting carry on whichever screen is shown.
  */
 
 #ifndef POURING_SCREEN_H
 #define POURING_SCREEN_H
 
 #include <lvgl.h>
+#include <stdint.h>
 
 /**
  * Initialize the pouring screen
+ * Builds the screen objects (once)
  */
 void pouring_screen_init();
 
 /**
- * Update the pouring screen
- * Call this periodically to update flow rate, volume, and cost
- */
-void pouring_screen_update();
-
-/**
- * Reset volume and cost for new pour
+ * Make the pouring screen active (builds it on first use)
+ * @param tap Tap whose pour session is shown (0-based, FLOW_TAP_COUNT taps)
  */
-void pouring_screen_reset();
+void pouring_screen_show(uint8_t tap);
 
 /**
- * Set pour parameters from MQTT "paid" command
- * @param unique_id Unique ID for this pour
- * @param cost_per_ml Cost per milliliter
- * @param max_ml Maximum milliliters allowed
- * @param currency Currency symbol (e.g., "GBP ", "$")
+ * Mark the pouring screen inactive (the pour itself carries on)
+ * Call before another screen is loaded
  */
-void pouring_screen_set_params(const char* unique_id, float cost_per_ml, int max_ml, const char* currency);
+void pouring_screen_hide();
 
 /**
- * Start pouring with paid parameters
- * @param unique_id Unique ID for this pour
- * @param cost_per_ml Cost per milliliter
- * @param max_ml Maximum milliliters allowed
- * @param currency Currency symbol
- */
-void pouring_screen_start_pour(const char* unique_id, float cost_per_ml, int max_ml, const char* currency);
-
-/**
- * Check if maximum volume has been reached
- * @return true if max ml reached, false otherwise
+ * Update the pouring screen
+ * Redraws flow rate, volume and cost when the pour session changes
  */
-bool pouring_screen_is_max_reached();
+void pouring_screen_update();
 
 /**
  * Set callback function to switch back to QR code screen
@@ -66,13 +54,12 @@ bool pouring_screen_is_max_reached();
 void pouring_screen_set_switch_callback(void (*callback)(void));
 
 /**
- * Get current pour cost per ml
- * @return Cost per milliliter
+ * Get the tap of the pour being shown
  */
-float pouring_screen_get_cost_per_ml();
+uint8_t pouring_screen_get_tap();
 
 /**
- * Clean up the pouring screen
+ * Delete the pouring screen (must not be the active screen)
  */
 void pouring_screen_cleanup();
 
@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * QR Code Render Cache
+ * 
+ * Encodes a URL once into qrcodegen's 1-bit module bitmap (one bit per
+ * module, PSRAM when available) and blits it, scaled to whole pixels per
+ * module, into one indexed-1bpp image shown with a plain lv_img. Re-showing
+ * the same code costs nothing; a new code costs a bit expansion, not an
+ * encode, when it was prepared ahead.
+ * 
+ * - qr_cache_set_url(): encode now and blit (call once at screen build)
+ * - qr_cache_prepare_next(): encode the next URL on a background task,
+ *   e.g. the next session's URL while a pour is running
+ * - qr_cache_swap_next(): make the prepared code current and re-blit
+ * 
+ * All calls except qr_cache_prepare_next() belong to the LVGL (UI) task.
+ */
+
+#ifndef QR_CACHE_H
+#define QR_CACHE_H
+
+#include <lvgl.h>
+
+#include <stddef.h>
+
+#define QR_CACHE_URL_SIZE 160      // Longest URL + terminator
+#define QR_CACHE_MAX_VERSION 10    // 57x57 modules, 213 bytes at ECC medium
+
+/**
+ * Allocate the module bitmaps and the size_px square image
+ */
+bool qr_cache_init(int size_px);
+
+/**
+ * Encode url and blit it into the image
+ * 
+ * @return false if the URL does not fit QR_CACHE_MAX_VERSION
+ */
+bool qr_cache_set_url(const char* url);
+
+/**
+ * Queue url to be encoded in the background (any task)
+ * 
+ * A newer request replaces one that has not been swapped in yet.
+ */
+bool qr_cache_prepare_next(const char* url);
+
+/**
+ * Swap in the prepared code if it is ready
+ * 
+ * Re-blits the image in place; the caller invalidates the lv_img showing it.
+ * 
+ * @return true if the image changed
+ */
+bool qr_cache_swap_next();
+
+/**
+ * Image descriptor for lv_img_set_src() (stable for the cache's lifetime)
+ */
+const lv_img_dsc_t* qr_cache_get_image();
+
+/**
+ * URL encoded in the current image
+ */
+const char* qr_cache_get_url();
+
+#endif // QR_CACHE_H
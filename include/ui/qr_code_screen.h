@@ -20,10 +20,26 @@
 
 /**
  * Initialize the QR code screen
- * Creates the QR code with device-specific URL
+ * Builds the screen and QR code with device-specific URL (once)
  */
 void qr_code_screen_init();
 
+/**
+ * Make the QR code screen active (builds it on first use)
+ */
+void qr_code_screen_show();
+
+/**
+ * Start encoding the next session's QR code in the background
+ * No-op unless QR_SESSION_NONCE_ENABLED; the new code is shown on the next show
+ */
+void qr_code_screen_prepare_next();
+
+/**
+ * Mark the QR code screen inactive before another screen is loaded
+ */
+void qr_code_screen_hide();
+
 /**
  * Update the QR code screen
  * Call this periodically to update status icons
@@ -31,7 +47,7 @@ void qr_code_screen_init();
 void qr_code_screen_update();
 
 /**
- * Clean up the QR code screen
+ * Delete the QR code screen (must not be the active screen)
  */
 void qr_code_screen_cleanup();
 
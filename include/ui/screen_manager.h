@@ -11,6 +11,9 @@
  * 
  * Centralized screen state management and transitions.
  * Handles the UX flow: Splash → QR Code → Pouring → Finished → QR Code
+ * 
+ * Once the UI task is running these functions must only be called from it;
+ * other tasks request transitions through ui/ui_task.h.
  */
 
 #ifndef SCREEN_MANAGER_H
@@ -25,7 +28,8 @@ enum ScreenState {
     SCREEN_SPLASH,      // Startup splashscreen
     SCREEN_QR_CODE,     // QR code / payment waiting
     SCREEN_POURING,     // Active pouring
-    SCREEN_FINISHED     // Pouring complete
+    SCREEN_FINISHED,    // Pouring complete
+    SCREEN_TOUCH_CAL    // Touch calibration (service)
 };
 
 /**
@@ -47,12 +51,10 @@ void screen_manager_show_qr_code();
 
 /**
  * Transition to pouring screen
- * @param unique_id Unique ID for this pour
- * @param cost_per_ml Cost per milliliter
- * @param max_ml Maximum milliliters allowed
- * @param currency Currency symbol
+ * The pour itself is started by flow/pour_session.h; this only shows it.
+ * @param tap Tap whose pour is shown (0-based, FLOW_TAP_COUNT taps)
  */
-void screen_manager_show_pouring(const char* unique_id, float cost_per_ml, int max_ml, const char* currency);
+void screen_manager_show_pouring(uint8_t tap);
 
 /**
  * Transition to finished screen
@@ -62,6 +64,12 @@ void screen_manager_show_pouring(const char* unique_id, float cost_per_ml, int m
  */
 void screen_manager_show_finished(float final_volume_ml, float final_cost, const char* currency);
 
+/**
+ * Transition to the touch calibration screen
+ * Returns to the QR code screen when the run is over
+ */
+void screen_manager_show_touch_cal();
+
 /**
  * Update the screen manager
  * Call this periodically from main loop
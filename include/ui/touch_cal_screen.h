@@ -0,0 +1,55 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Touch Calibration Screen
+ * 
+ * Service screen for the 3-point touch calibration (display/lvgl_touch.h),
+ * opened with {"cmd":"touch_cal"} on prefix/chip_id/commands. A crosshair is
+ * shown at three targets in turn; holding a finger on each one collects
+ * TOUCH_CAL_SCREEN_SAMPLES stable raw samples, averaged into the target's raw
+ * point. After the third target the calibration is solved, applied and
+ * stored in NVS. The screen gives up (calibration unchanged) after
+ * TOUCH_CAL_SCREEN_TIMEOUT_MS without a completed target.
+ * 
+ * Built on first use only - it is not part of the customer flow.
+ */
+
+#ifndef TOUCH_CAL_SCREEN_H
+#define TOUCH_CAL_SCREEN_H
+
+#include <lvgl.h>
+
+#define TOUCH_CAL_SCREEN_SAMPLES 8            // Stable raw samples averaged per target
+#define TOUCH_CAL_SCREEN_TIMEOUT_MS 30000     // Give up if a target is not touched in time
+#define TOUCH_CAL_SCREEN_RESULT_MS 2000       // How long the result stays on screen
+
+/**
+ * Start a calibration run at the first target (builds the screen on first use)
+ */
+void touch_cal_screen_show();
+
+/**
+ * Mark the calibration screen inactive before another screen is loaded
+ * An unfinished run is abandoned and the calibration is left unchanged
+ */
+void touch_cal_screen_hide();
+
+/**
+ * Sample the touch panel and advance through the targets
+ * Call this periodically while the screen is shown
+ * @return true once the run is over (should transition to QR code screen)
+ */
+bool touch_cal_screen_update();
+
+/**
+ * Delete the calibration screen (must not be the active screen)
+ */
+void touch_cal_screen_cleanup();
+
+#endif // TOUCH_CAL_SCREEN_H
@@ -34,7 +34,8 @@ lv_obj_t* ui_data_icon_get_container();
 
 /**
  * Update data icon status
- * Call this periodically to update the icon based on current MQTT status
+ * Cheap to call every pass: the icon is only redrawn when its state changes,
+ * the flashing and the return to idle after activity run from an lv_timer
  * @param connected MQTT connection status
  * @param active Whether there's recent MQTT activity
  */
@@ -16,8 +16,17 @@
 #ifndef UI_LOGO_H
 #define UI_LOGO_H
 
+#include "utils/asset_store.h"
+
 #include <lvgl.h>
 
+/**
+ * Find the logo image: the asset bundle's, else the compiled-in one
+ * (ASSET_BUILTIN_LOGO_ENABLED)
+ * @return false if neither exists
+ */
+bool ui_logo_get_image(asset_image_t* out);
+
 /**
  * Create the shared logo object
  * Should be called once during initialization
@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * UI Task
+ * 
+ * Dedicated task that owns LVGL. After ui_task_start() no other task may call
+ * lv_* or screen functions directly - post a command instead. Commands are
+ * copied into a queue, so callers (MQTT handler, main loop) never block on
+ * rendering and rendering never waits on the network.
+ */
+
+#ifndef UI_TASK_H
+#define UI_TASK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * UI command types
+ */
+typedef enum {
+    UI_CMD_SHOW_QR_CODE,    // Transition to QR code screen
+    UI_CMD_SHOW_POURING,    // Transition to pouring screen for a tap's pour session
+    UI_CMD_SHOW_FINISHED,   // Transition to finished screen if that tap's pour is shown
+    UI_CMD_UPDATE,          // Run screen updates now (values changed)
+    UI_CMD_REFRESH_ICONS,   // Re-read WiFi/MQTT state for the status icons
+    UI_CMD_TOUCH_CAL        // Start a touch calibration run, or reset the calibration
+} ui_cmd_type_t;
+
+/**
+ * Start the UI task
+ * Call once after LVGL, the display and the first screen are initialized.
+ * From then on the UI task is the only caller of lv_timer_handler().
+ * @return true if the task and queue were created
+ */
+bool ui_task_start();
+
+/**
+ * Check if the UI task is running
+ * @return true once ui_task_start() succeeded
+ */
+bool ui_task_is_running();
+
+/**
+ * Request the QR code screen
+ * @return true if the command was queued
+ */
+bool ui_task_show_qr_code();
+
+/**
+ * Request the pouring screen for a tap (the pour is started by pour_session_start())
+ * @param tap Tap whose pour is shown (0-based)
+ * @return true if the command was queued
+ */
+bool ui_task_show_pouring(uint8_t tap);
+
+/**
+ * Request the finished screen (currency is copied)
+ * Ignored unless the pouring screen is showing that tap's pour
+ * @param tap Tap the pour ran on
+ * @param final_volume_ml Final volume in milliliters
+ * @param final_cost Final cost
+ * @param currency Currency symbol
+ * @return true if the command was queued
+ */
+bool ui_task_show_finished(uint8_t tap, float final_volume_ml, float final_cost, const char* currency);
+
+/**
+ * Request an immediate screen update (e.g. new flow values)
+ * @return true if the command was queued
+ */
+bool ui_task_request_update();
+
+/**
+ * Request a status icon refresh (WiFi/MQTT state changed)
+ * @return true if the command was queued
+ */
+bool ui_task_refresh_icons();
+
+/**
+ * Request the touch calibration screen (ignored while a pour is shown)
+ * @param reset Restore the default calibration instead of running the screen
+ * @return true if the command was queued
+ */
+bool ui_task_touch_calibration(bool reset);
+
+#endif // UI_TASK_H
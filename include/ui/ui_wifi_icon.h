@@ -34,7 +34,7 @@ lv_obj_t* ui_wifi_icon_get_container();
 
 /**
  * Update WiFi icon status
- * Call this periodically to update the icon based on current WiFi status
+ * Cheap to call every pass: the icon is only redrawn when its state changes
  * @param connected WiFi connection status
  * @param rssi WiFi signal strength (RSSI in dBm)
  * @param flashing Whether to flash the icon (e.g., WiFi connected but MQTT not)
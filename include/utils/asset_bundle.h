@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Asset Bundle Format
+ * 
+ * Images (logos, splash, per-venue branding) packed into one binary that is
+ * written to the "assets" partition instead of being compiled into the app.
+ * Built by tools/build_asset_bundle.py; read in place from memory-mapped
+ * flash, so pixel data is never copied.
+ * 
+ *   header   16 bytes: magic, version, entry count, bundle size, index CRC
+ *   index    count x asset_entry_t, names NUL-padded
+ *   data     each asset's bytes at a 4-byte aligned offset
+ * 
+ * Little-endian, CRC-32 as zlib.crc32. Header-only, no platform dependencies
+ * (unit tested on the host).
+ */
+
+#ifndef ASSET_BUNDLE_H
+#define ASSET_BUNDLE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define ASSET_BUNDLE_MAGIC 0x42415050UL  // "PPAB"
+#define ASSET_BUNDLE_VERSION 1
+#define ASSET_BUNDLE_MAX_ENTRIES 32
+#define ASSET_NAME_SIZE 16               // Including the terminator
+
+#define ASSET_FLAG_RLE 0x01              // Data is RLE-compressed (utils/rle_decompress.h)
+#define ASSET_FLAG_SWAP16 0x02           // RGB565 stored MSB first (LV_COLOR_16_SWAP 1)
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    uint32_t size;          // Header, index and data
+    uint32_t index_crc;     // CRC-32 of the index
+} asset_bundle_header_t;
+
+typedef struct {
+    char name[ASSET_NAME_SIZE];
+    uint32_t offset;        // From the start of the bundle
+    uint32_t size;          // Stored bytes
+    uint32_t raw_size;      // Decoded bytes (== size unless ASSET_FLAG_RLE)
+    uint16_t width;
+    uint16_t height;
+    uint8_t cf;             // LVGL colour format (lv_img_cf_t)
+    uint8_t flags;          // ASSET_FLAG_*
+    uint16_t reserved;
+} asset_entry_t;
+
+static inline uint32_t asset_bundle_crc32(const uint8_t* data, size_t len) {
+    uint32_t crc = 0xFFFFFFFFUL;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320UL & (0U - (crc & 1U)));
+        }
+    }
+    return ~crc;
+}
+
+static inline const asset_entry_t* asset_bundle_entries(const uint8_t* bundle) {
+    return (const asset_entry_t*)(bundle + sizeof(asset_bundle_header_t));
+}
+
+/**
+ * Check a bundle before use (e.g. right after mapping it)
+ * 
+ * @param available Bytes readable at bundle (the partition size)
+ * @return true if the header, index and every asset lie within the bundle
+ */
+static inline bool asset_bundle_valid(const uint8_t* bundle, size_t available) {
+    if (available < sizeof(asset_bundle_header_t)) {
+        return false;
+    }
+    const asset_bundle_header_t* header = (const asset_bundle_header_t*)bundle;
+    size_t index_size = (size_t)header->count * sizeof(asset_entry_t);
+    if (header->magic != ASSET_BUNDLE_MAGIC || header->version != ASSET_BUNDLE_VERSION ||
+        header->count > ASSET_BUNDLE_MAX_ENTRIES || header->size > available ||
+        header->size < sizeof(asset_bundle_header_t) + index_size) {
+        return false;
+    }
+    const asset_entry_t* entries = asset_bundle_entries(bundle);
+    if (asset_bundle_crc32((const uint8_t*)entries, index_size) != header->index_crc) {
+        return false;
+    }
+    for (uint16_t i = 0; i < header->count; i++) {
+        const asset_entry_t* e = &entries[i];
+        if (memchr(e->name, '\0', ASSET_NAME_SIZE) == NULL || e->name[0] == '\0' ||
+            e->offset % 4 != 0 || e->offset > header->size || e->size > header->size - e->offset ||
+            (!(e->flags & ASSET_FLAG_RLE) && e->raw_size != e->size)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Look up an asset by name in a valid bundle
+ * @return The entry, NULL if there is none
+ */
+static inline const asset_entry_t* asset_bundle_find(const uint8_t* bundle, const char* name) {
+    const asset_bundle_header_t* header = (const asset_bundle_header_t*)bundle;
+    const asset_entry_t* entries = asset_bundle_entries(bundle);
+    for (uint16_t i = 0; i < header->count; i++) {
+        if (strncmp(entries[i].name, name, ASSET_NAME_SIZE) == 0) {
+            return &entries[i];
+        }
+    }
+    return NULL;
+}
+
+#endif // ASSET_BUNDLE_H
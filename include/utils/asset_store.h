@@ -0,0 +1,65 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Asset Store
+ * 
+ * Maps the "assets" partition (utils/asset_bundle.h) into the data address
+ * space once at boot and hands out LVGL image descriptors that point straight
+ * at the mapped flash: uncompressed images are drawn from flash with no copy,
+ * RLE images are decoded from flash by the image cache.
+ * 
+ * Branding is changed by writing a new bundle to the partition, e.g.
+ *   python3 tools/build_asset_bundle.py logo=resources/precision_pour_logo.png
+ *   parttool.py write_partition --partition-name assets --input assets.bin
+ * without rebuilding the firmware.
+ * 
+ * Descriptors are stable for the life of the firmware; they may be passed to
+ * image_cache_acquire() / lvgl_display_stream_image() like compiled-in images.
+ */
+
+#ifndef ASSET_STORE_H
+#define ASSET_STORE_H
+
+#include "config.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <lvgl.h>
+
+#define ASSET_NAME_LOGO "logo"       // Header logo on every screen
+#define ASSET_NAME_SPLASH "splash"   // Boot splash (the logo is used if absent)
+
+typedef struct {
+    const lv_img_dsc_t* dsc;
+    int is_compressed;               // As for image_cache_acquire()
+    size_t raw_size;                 // Decoded bytes
+} asset_image_t;
+
+#if ASSET_PARTITION_ENABLED
+
+/**
+ * Map the asset partition and check the bundle (call once, before the UI)
+ * @return false if there is no partition or no valid bundle in it
+ */
+bool asset_store_init();
+
+/**
+ * Find an image in the bundle (any task, after asset_store_init())
+ * @return false if the bundle has no usable image of that name
+ */
+bool asset_store_get_image(const char* name, asset_image_t* out);
+
+#else
+
+static inline bool asset_store_init() { return false; }
+static inline bool asset_store_get_image(const char* name, asset_image_t* out) { (void)name; (void)out; return false; }
+
+#endif // ASSET_PARTITION_ENABLED
+
+#endif // ASSET_STORE_H
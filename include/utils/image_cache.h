@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Decoded Image Cache
+ * 
+ * Decodes each RLE-compressed image once and keeps the result for reuse,
+ * keyed by the source descriptor. Decoded data lives in PSRAM when the board
+ * has it (BOARD_HAS_PSRAM), otherwise in internal RAM.
+ * 
+ * - Returned descriptors are stable: each source image gets its own buffer
+ * - Images in use (acquired and not released) are never evicted
+ * - When a new image does not fit in IMAGE_CACHE_BUDGET_KB, released images
+ *   are evicted least recently used first
+ * 
+ * Not thread-safe: call from the LVGL (UI) task only.
+ */
+
+#ifndef IMAGE_CACHE_H
+#define IMAGE_CACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Get a decoded image and mark it in use
+ * 
+ * Uncompressed images are returned as-is (not cached).
+ * Every successful call must be paired with image_cache_release().
+ * 
+ * @param src Source image descriptor (compressed or uncompressed)
+ * @param is_compressed Flag indicating if image is RLE-compressed (from header define)
+ * @param uncompressed_size Uncompressed size in bytes (only used if is_compressed is true)
+ * @return Pointer to decoded LVGL image descriptor, or NULL on error
+ */
+const lv_img_dsc_t* image_cache_acquire(const lv_img_dsc_t* src, int is_compressed, size_t uncompressed_size);
+
+/**
+ * Release an image acquired with image_cache_acquire()
+ * 
+ * The decoded data stays cached and becomes eligible for eviction once no
+ * user holds it.
+ * 
+ * @param src Source image descriptor passed to image_cache_acquire()
+ */
+void image_cache_release(const lv_img_dsc_t* src);
+
+/**
+ * Free every image that is not in use
+ */
+void image_cache_flush(void);
+
+/**
+ * Get bytes of decoded image data currently cached
+ * 
+ * @return Cached bytes
+ */
+size_t image_cache_get_used_bytes(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // IMAGE_CACHE_H
@@ -6,69 +6,58 @@
  * 
  * Provides wrapper macros for ESP-IDF logging that include full date/time
  * information in the log message when NTP time is synchronized.
+ * 
+ * With LOG_SINK_ENABLED the sink stamps every line already, so the _TIME
+ * macros are plain ESP_LOGx. Otherwise they copy the once-per-second cached
+ * string from log_time_prefix() onto the caller's stack (thread-safe).
+ * 
+ * ESP_LOGI_HOT() is for chatty per-message / per-pour lines on hot paths
+ * (payload dumps, publish acks); LOG_HOT_PATH_ENABLED 0 compiles them out.
  */
 
 #ifndef LOG_WITH_TIME_H
 #define LOG_WITH_TIME_H
 
+#include "config.h"
+#include "system/log_sink.h"
+
 #include <esp_log.h>
-#include <time.h>
-#include <string.h>
 
-// Helper function to get formatted date/time string
-static inline const char* get_log_time_string(void) {
-    static char time_str[32];
-    time_t now = 0;
-    struct tm timeinfo;
-    
-    time(&now);
-    if (now > 0 && localtime_r(&now, &timeinfo) != NULL) {
-        // Format: YYYY-MM-DD HH:MM:SS
-        snprintf(time_str, sizeof(time_str), "%04d-%02d-%02d %02d:%02d:%02d",
-                 timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday,
-                 timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
-        return time_str;
-    }
-    
-    // Fallback: return empty string if time not synced
-    return "";
-}
+#if LOG_SINK_ENABLED
 
-// Wrapper macros that include date/time in the log message
-#define ESP_LOGI_TIME(tag, format, ...) do { \
-    const char* dt = get_log_time_string(); \
-    if (strlen(dt) > 0) { \
-        ESP_LOGI(tag, "[%s] " format, dt, ##__VA_ARGS__); \
-    } else { \
-        ESP_LOGI(tag, format, ##__VA_ARGS__); \
-    } \
-} while(0)
+#define ESP_LOGI_TIME(tag, format, ...) ESP_LOGI(tag, format, ##__VA_ARGS__)
+#define ESP_LOGW_TIME(tag, format, ...) ESP_LOGW(tag, format, ##__VA_ARGS__)
+#define ESP_LOGE_TIME(tag, format, ...) ESP_LOGE(tag, format, ##__VA_ARGS__)
+#define ESP_LOGD_TIME(tag, format, ...) ESP_LOGD(tag, format, ##__VA_ARGS__)
 
-#define ESP_LOGW_TIME(tag, format, ...) do { \
-    const char* dt = get_log_time_string(); \
-    if (strlen(dt) > 0) { \
-        ESP_LOGW(tag, "[%s] " format, dt, ##__VA_ARGS__); \
-    } else { \
-        ESP_LOGW(tag, format, ##__VA_ARGS__); \
-    } \
-} while(0)
+#else
 
-#define ESP_LOGE_TIME(tag, format, ...) do { \
-    const char* dt = get_log_time_string(); \
-    if (strlen(dt) > 0) { \
-        ESP_LOGE(tag, "[%s] " format, dt, ##__VA_ARGS__); \
+#define LOG_WITH_TIME(level_macro, tag, format, ...) do { \
+    char dt[LOG_TIME_PREFIX_SIZE]; \
+    if (log_time_prefix(dt, sizeof(dt))) { \
+        level_macro(tag, "[%s] " format, dt, ##__VA_ARGS__); \
     } else { \
-        ESP_LOGE(tag, format, ##__VA_ARGS__); \
+        level_macro(tag, format, ##__VA_ARGS__); \
     } \
 } while(0)
 
-#define ESP_LOGD_TIME(tag, format, ...) do { \
-    const char* dt = get_log_time_string(); \
-    if (strlen(dt) > 0) { \
-        ESP_LOGD(tag, "[%s] " format, dt, ##__VA_ARGS__); \
-    } else { \
-        ESP_LOGD(tag, format, ##__VA_ARGS__); \
+// Wrapper macros that include date/time in the log message
+#define ESP_LOGI_TIME(tag, format, ...) LOG_WITH_TIME(ESP_LOGI, tag, format, ##__VA_ARGS__)
+#define ESP_LOGW_TIME(tag, format, ...) LOG_WITH_TIME(ESP_LOGW, tag, format, ##__VA_ARGS__)
+#define ESP_LOGE_TIME(tag, format, ...) LOG_WITH_TIME(ESP_LOGE, tag, format, ##__VA_ARGS__)
+#define ESP_LOGD_TIME(tag, format, ...) LOG_WITH_TIME(ESP_LOGD, tag, format, ##__VA_ARGS__)
+
+#endif // LOG_SINK_ENABLED
+
+// Hot path info logging: arguments stay type-checked when compiled out
+#if LOG_HOT_PATH_ENABLED
+#define ESP_LOGI_HOT(tag, format, ...) ESP_LOGI(tag, format, ##__VA_ARGS__)
+#else
+#define ESP_LOGI_HOT(tag, format, ...) do { \
+    if (0) { \
+        ESP_LOGI(tag, format, ##__VA_ARGS__); \
     } \
 } while(0)
+#endif
 
 #endif // LOG_WITH_TIME_H
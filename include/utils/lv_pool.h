@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * LVGL Pool Allocator
+ * 
+ * Size-class allocator behind LV_MEM_CUSTOM (see lv_conf.h), so widget,
+ * style and label-text churn never fragments the general heap:
+ * - One internal-RAM arena (LVGL_POOL_KB) split into classes of 16..512 bytes,
+ *   each with its own free list - alloc and free are O(1)
+ * - A full class borrows from the next larger one, then falls back to the heap
+ * - Larger blocks come from the heap, from PSRAM at or above
+ *   LVGL_POOL_PSRAM_MIN_BYTES when the board has it
+ * - Per-class high-water marks show whether the split fits the UI
+ * 
+ * With LVGL_POOL_ENABLED 0 the functions pass straight through to the heap.
+ * Included by LVGL's C sources, so this header only uses C types.
+ */
+
+#ifndef LV_POOL_H
+#define LV_POOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LV_POOL_CLASS_COUNT 6
+
+typedef struct {
+    uint16_t block_size;
+    uint16_t blocks;
+    uint16_t in_use;
+    uint16_t high_water;     // Most blocks in use at once since boot
+} lv_pool_class_stats_t;
+
+typedef struct {
+    lv_pool_class_stats_t classes[LV_POOL_CLASS_COUNT];
+    uint32_t borrowed;       // Allocations served by a larger class (own class full)
+    uint32_t heap_allocs;    // Allocations served by the heap (too large or pool full)
+    uint32_t heap_live;      // Heap blocks currently held by LVGL
+    uint32_t heap_high_water;
+    size_t internal_free;            // Internal heap free bytes
+    size_t internal_largest_block;   // Largest allocatable internal block
+    uint32_t fragmentation_pct;      // 100 - largest * 100 / free
+} lv_pool_stats_t;
+
+/**
+ * Carve the arena - call before lv_init()
+ * 
+ * @return 0 on success, -1 if the arena could not be allocated (heap is used)
+ */
+int lv_pool_init(void);
+
+// LV_MEM_CUSTOM_ALLOC / FREE / REALLOC
+void* lv_pool_alloc(size_t size);
+void lv_pool_free(void* ptr);
+void* lv_pool_realloc(void* ptr, size_t size);
+
+/**
+ * Snapshot of the pool and heap counters
+ * 
+ * @param stats Filled with the current values
+ */
+void lv_pool_get_stats(lv_pool_stats_t* stats);
+
+/**
+ * Print the stats to the log (serial "lvmem" command)
+ */
+void lv_pool_log_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LV_POOL_H
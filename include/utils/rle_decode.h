@@ -0,0 +1,215 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * RLE Fast Decode Core
+ * 
+ * Header-only decoder for the image RLE format (see rle_decompress.h), with
+ * no logging or platform dependencies so it can also be unit tested and
+ * benchmarked.
+ * 
+ * - Literal bytes are copied inline; once a span passes RLE_SHORT_SPAN bytes
+ *   the rest of it is located with memchr() and copied with one memcpy()
+ * - Runs are filled with aligned 32-bit stores
+ */
+
+#ifndef RLE_DECODE_H
+#define RLE_DECODE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define RLE_MARKER 0xFF
+#define RLE_SHORT_SPAN 8    // Literal spans longer than this use memchr/memcpy
+#define RLE_SHORT_RUN 8     // Runs shorter than this are filled bytewise
+
+typedef uint32_t __attribute__((may_alias)) rle_word_t;
+
+/**
+ * Fill count bytes with value using word-wide stores
+ */
+static inline void rle_fill(uint8_t* dst, uint8_t value, size_t count) {
+    if (count < RLE_SHORT_RUN) {
+        while (count-- > 0) {
+            *dst++ = value;
+        }
+        return;
+    }
+    
+    // Head: bytes up to the next word boundary
+    while (count > 0 && ((uintptr_t)dst & 3) != 0) {
+        *dst++ = value;
+        count--;
+    }
+    
+    // Body: four bytes per store
+    const uint32_t pattern = value * 0x01010101U;
+    rle_word_t* words = (rle_word_t*)dst;
+    for (size_t i = count >> 2; i > 0; i--) {
+        *words++ = pattern;
+    }
+    dst = (uint8_t*)words;
+    
+    // Tail
+    for (count &= 3; count > 0; count--) {
+        *dst++ = value;
+    }
+}
+
+/**
+ * Decode RLE data
+ * 
+ * Stops when the input is consumed or the output is full.
+ * 
+ * @param in Compressed data
+ * @param in_size Size of compressed data in bytes
+ * @param out Output buffer
+ * @param out_size Size of output buffer in bytes
+ * @param in_used Set to the number of input bytes consumed (may be NULL)
+ * @return Number of bytes written, or -1 if a run would overflow the output
+ */
+static inline long rle_decode(const uint8_t* in, size_t in_size, uint8_t* out, size_t out_size, size_t* in_used) {
+    const uint8_t* src = in;
+    const uint8_t* const src_end = in + in_size;
+    uint8_t* dst = out;
+    uint8_t* const dst_end = out + out_size;
+    size_t literal_count = 0;  // Literal bytes since the last marker
+    
+    while (src < src_end && dst < dst_end) {
+        if (*src != RLE_MARKER) {
+            *dst++ = *src++;
+            
+            // Long literal span: find the next marker with memchr and copy the rest in one go
+            if (++literal_count == RLE_SHORT_SPAN) {
+                literal_count = 0;
+                size_t avail = (size_t)(src_end - src);
+                if ((size_t)(dst_end - dst) < avail) {
+                    avail = (size_t)(dst_end - dst);
+                }
+                const uint8_t* marker = (const uint8_t*)memchr(src, RLE_MARKER, avail);
+                size_t literal = marker != NULL ? (size_t)(marker - src) : avail;
+                memcpy(dst, src, literal);
+                src += literal;
+                dst += literal;
+            }
+            continue;
+        }
+        literal_count = 0;
+        
+        if (src + 1 < src_end && src[1] == 0x00) {
+            // Escaped literal 0xFF
+            *dst++ = RLE_MARKER;
+            src += 2;
+        } else if (src + 2 < src_end) {
+            // Run: 0xFF, count, value
+            size_t count = src[1];
+            if (count > (size_t)(dst_end - dst)) {
+                if (in_used != NULL) {
+                    *in_used = (size_t)(src - in);
+                }
+                return -1;
+            }
+            rle_fill(dst, src[2], count);
+            dst += count;
+            src += 3;
+        } else {
+            // Truncated marker at the end of the input, treat as literal
+            *dst++ = *src++;
+        }
+    }
+    
+    if (in_used != NULL) {
+        *in_used = (size_t)(src - in);
+    }
+    return (long)(dst - out);
+}
+
+/**
+ * Resumable decoder state, for decoding an image in bands
+ */
+typedef struct {
+    const uint8_t* in;
+    size_t in_size;
+    size_t pos;            // Next input byte
+    size_t run_remaining;  // Bytes of a run split across reads
+    uint8_t run_value;
+} rle_stream_t;
+
+/**
+ * Start decoding a compressed buffer
+ * 
+ * @param stream Decoder state
+ * @param in Compressed data
+ * @param in_size Size of compressed data in bytes
+ */
+static inline void rle_stream_init(rle_stream_t* stream, const uint8_t* in, size_t in_size) {
+    stream->in = in;
+    stream->in_size = in_size;
+    stream->pos = 0;
+    stream->run_remaining = 0;
+    stream->run_value = 0;
+}
+
+/**
+ * Decode the next out_size bytes
+ * 
+ * Runs that cross the end of the output are carried over to the next read.
+ * 
+ * @param stream Decoder state
+ * @param out Output buffer
+ * @param out_size Bytes wanted
+ * @return Bytes written (less than out_size only when the input is exhausted)
+ */
+static inline size_t rle_stream_read(rle_stream_t* stream, uint8_t* out, size_t out_size) {
+    size_t op = 0;
+    
+    // Finish a run left over from the previous read
+    if (stream->run_remaining > 0) {
+        size_t n = stream->run_remaining < out_size ? stream->run_remaining : out_size;
+        rle_fill(out, stream->run_value, n);
+        stream->run_remaining -= n;
+        op = n;
+    }
+    
+    while (op < out_size && stream->pos < stream->in_size) {
+        const uint8_t* in = stream->in + stream->pos;
+        size_t in_left = stream->in_size - stream->pos;
+        
+        if (in[0] != RLE_MARKER) {
+            // Literal span up to the next marker
+            size_t avail = in_left < out_size - op ? in_left : out_size - op;
+            const uint8_t* marker = (const uint8_t*)memchr(in, RLE_MARKER, avail);
+            size_t literal = marker != NULL ? (size_t)(marker - in) : avail;
+            memcpy(out + op, in, literal);
+            op += literal;
+            stream->pos += literal;
+        } else if (in_left > 1 && in[1] == 0x00) {
+            // Escaped literal 0xFF
+            out[op++] = RLE_MARKER;
+            stream->pos += 2;
+        } else if (in_left > 2) {
+            // Run: 0xFF, count, value
+            size_t count = in[1];
+            size_t n = count < out_size - op ? count : out_size - op;
+            rle_fill(out + op, in[2], n);
+            op += n;
+            stream->run_remaining = count - n;
+            stream->run_value = in[2];
+            stream->pos += 3;
+        } else {
+            // Truncated marker at the end of the input, treat as literal
+            out[op++] = in[0];
+            stream->pos++;
+        }
+    }
+    
+    return op;
+}
+
+#endif // RLE_DECODE_H
@@ -32,9 +32,9 @@ int rle_decompress(const uint8_t* compressed_data, size_t compressed_size,
 /**
  * Decompress RLE image and create LVGL image descriptor
  * 
- * This function decompresses RLE-compressed image data and creates a new
- * LVGL image descriptor with the decompressed data. The decompressed data
- * is stored in a static buffer (decompressed on first call, reused on subsequent calls).
+ * The image is decoded once into the image cache (see image_cache.h) and
+ * the cached descriptor is returned on subsequent calls. Each call acquires
+ * the image; pair it with image_cache_release().
  * 
  * @param compressed_img Pointer to compressed LVGL image descriptor
  * @param uncompressed_size Expected uncompressed size in bytes
@@ -47,6 +47,7 @@ const lv_img_dsc_t* rle_decompress_image(const lv_img_dsc_t* compressed_img, siz
  * 
  * This is a convenience function that checks if an image is compressed and
  * decompresses it if needed. For uncompressed images, returns the original descriptor.
+ * Compressed images come from the image cache; pair with image_cache_release().
  * 
  * @param img Pointer to LVGL image descriptor (may be compressed or uncompressed)
  * @param is_compressed Flag indicating if image is RLE-compressed (from header define)
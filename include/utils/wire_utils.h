@@ -0,0 +1,41 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Wire Format Helpers
+ * 
+ * Shared by the packed binary records (pour telemetry, flow analytics, pour
+ * checkpoints, the WiFi lease cache): the wall clock as stored in them, and
+ * little-endian packing. Header-only, no platform dependencies.
+ */
+
+#ifndef WIRE_UTILS_H
+#define WIRE_UTILS_H
+
+#include <stdint.h>
+#include <time.h>
+
+#define CLOCK_VALID_EPOCH 1700000000LL  // Wall clock is treated as set after this (Nov 2023)
+
+// Wall clock (s), 0 until NTP has set it
+static inline int64_t wall_clock_now() {
+    int64_t now = (int64_t)time(NULL);
+    return now > CLOCK_VALID_EPOCH ? now : 0;
+}
+
+static inline void put_le16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static inline void put_le32(uint8_t* p, uint32_t v) {
+    put_le16(p, (uint16_t)v);
+    put_le16(p + 2, (uint16_t)(v >> 16));
+}
+
+#endif // WIRE_UTILS_H
@@ -4,7 +4,7 @@
  * 
  * WiFi Credentials Storage
  * 
- * Handles saving and loading WiFi credentials from NVS
+ * Handles saving and loading WiFi credentials (kept by the config store)
  */
 
 #ifndef WIFI_CREDENTIALS_H
@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * WiFi Fast Reconnect
+ * 
+ * Caches the last AP (SSID, BSSID, channel) and DHCP lease in NVS so a
+ * reconnect can skip the scan and DHCP:
+ * - The station config is pinned to the cached BSSID/channel
+ * - Disconnects are retried straight from the event handler
+ * - The cached lease is applied as a static address while it is younger
+ *   than WIFI_LEASE_REUSE_SEC, then DHCP takes over again
+ * - After repeated failures or "no AP found" the pin is dropped and the
+ *   normal scan + DHCP path in the WiFi manager task runs
+ */
+
+#ifndef WIFI_FAST_RECONNECT_H
+#define WIFI_FAST_RECONNECT_H
+
+#include "config.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <esp_netif.h>
+#include <esp_wifi.h>
+
+#if WIFI_FAST_RECONNECT_ENABLED
+
+// Load the cache from NVS (call once the station netif exists)
+void wifi_fast_init(esp_netif_t* netif);
+
+// Pin the config to the cached BSSID/channel if it is for the same SSID
+void wifi_fast_apply_config(wifi_config_t* config);
+
+// Use the cached lease as a static address if it is still valid
+// Returns true if the lease is in use (DHCP stopped)
+bool wifi_fast_apply_lease();
+
+// Remember the AP and lease after DHCP got an address (IP_EVENT_STA_GOT_IP)
+void wifi_fast_on_got_ip();
+
+// Stamp a lease obtained before the clock was set (call when NTP syncs)
+void wifi_fast_on_time_sync();
+
+// Handle WIFI_EVENT_STA_DISCONNECTED
+// Returns true if a fast reconnect was started (caller should not retry yet)
+bool wifi_fast_on_disconnect(uint16_t reason);
+
+// Hand back to DHCP when the reused lease gets too old (call from the WiFi manager task)
+void wifi_fast_loop();
+
+#else
+
+static inline void wifi_fast_init(esp_netif_t* netif) { (void)netif; }
+static inline void wifi_fast_apply_config(wifi_config_t* config) { (void)config; }
+static inline bool wifi_fast_apply_lease() { return false; }
+static inline void wifi_fast_on_got_ip() {}
+static inline void wifi_fast_on_time_sync() {}
+static inline bool wifi_fast_on_disconnect(uint16_t reason) { (void)reason; return false; }
+static inline void wifi_fast_loop() {}
+
+#endif // WIFI_FAST_RECONNECT_ENABLED
+
+#endif // WIFI_FAST_RECONNECT_H
@@ -16,7 +16,11 @@ void wifi_improv_start_provisioning();
 // Check if provisioning is active
 bool wifi_improv_is_provisioning();
 
-// Call this in main loop to handle provisioning
+// Called from the WiFi manager task to handle provisioning
 void wifi_improv_loop();
 
+// Free BLE controller and host memory for the rest of the boot (no-op while
+// provisioning, once released, or with IMPROV_RELEASE_BLE_MEMORY disabled)
+void wifi_improv_release_memory();
+
 #endif // WIFI_IMPROV_H
@@ -11,6 +11,10 @@
  * 
  * Handles WiFi connection and automatic reconnection
  * Supports Improv WiFi BLE provisioning for credential setup
+ * 
+ * wifi_manager_init() brings the station up (blocking, from the boot network
+ * task); wifi_manager_start_task() then hands reconnection, SNTP and Improv
+ * to a dedicated task. The getters read cached state and never block.
  */
 
 #ifndef WIFI_MANAGER_H
@@ -30,11 +34,11 @@
 
 // WiFi connection status
 bool wifi_manager_init();
+bool wifi_manager_start_task();  // Reconnection, NTP and Improv WiFi from here on (call after init)
 bool wifi_manager_is_connected();
-void wifi_manager_loop();  // Call this in main loop for reconnection handling and Improv WiFi
-String wifi_manager_get_ip();
+void wifi_manager_get_ip(char* buf, size_t size);  // Dotted quad, or "Not connected"
 String wifi_manager_get_mac_address();
-int wifi_manager_get_rssi();  // Get WiFi signal strength (RSSI in dBm)
+int wifi_manager_get_rssi();  // Last WiFi signal strength (RSSI in dBm)
 bool wifi_manager_has_activity();  // Returns true if RX/TX bytes have changed recently
 
 // Internal function for connecting to WiFi (used by wifi_improv)
@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Dynamic Devices Ltd
+# All rights reserved.
+#
+# Compare two host benchmark runs (JSON lines from test/test_bench_native)
+# - Prints the change in ns_per_op for every benchmark present in both runs
+# - Exits 1 if any benchmark got slower by more than the threshold
+#
+# Usage:
+#   BENCH_OUTPUT=baseline.jsonl pio test -e native
+#   ... change code ...
+#   BENCH_OUTPUT=current.jsonl pio test -e native
+#   scripts/bench_compare.py baseline.jsonl current.jsonl --threshold 10
+#
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    """Read benchmark name -> ns_per_op from a JSON lines file"""
+    results = {}
+    with open(path, 'r') as f:
+        for line in f:
+            line = line.strip()
+            if not line:
+                continue
+            entry = json.loads(line)
+            results[entry["bench"]] = float(entry["ns_per_op"])
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare host benchmark results")
+    parser.add_argument("baseline", help="JSON lines from the reference run")
+    parser.add_argument("current", help="JSON lines from the run under test")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="Allowed slowdown in percent (default 10)")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+
+    regressions = 0
+    for name in sorted(set(baseline) | set(current)):
+        if name not in baseline or name not in current:
+            print(f"{name:45s} {'only in ' + ('current' if name in current else 'baseline'):>30s}")
+            continue
+        before = baseline[name]
+        after = current[name]
+        change = (after - before) * 100.0 / before if before > 0 else 0.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+        print(f"{name:45s} {before:12.1f} -> {after:12.1f} ns  {change:+6.1f}%{flag}")
+
+    if regressions:
+        print(f"{regressions} benchmark(s) slower than {args.threshold:.0f}% threshold")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Display Power Management Implementation
+ * 
+ * 5 kHz, 13-bit LEDC on TFT_BL (above audible and flicker range). Dimming
+ * fades; waking restores brightness at once, after the panel is out of sleep
+ * so stale content is never lit.
+ */
+
+// Project headers
+#include "config.h"
+#include "display/display_power.h"
+
+#if DISPLAY_POWER_ENABLED
+
+#include "display/lvgl_display.h"
+#include "system/power_manager.h"
+
+// ESP-IDF framework headers
+#include <driver/ledc.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+#define TAG "display_pwr"
+
+#define BACKLIGHT_MODE LEDC_LOW_SPEED_MODE
+#define BACKLIGHT_TIMER LEDC_TIMER_0
+#define BACKLIGHT_CHANNEL LEDC_CHANNEL_0
+#define BACKLIGHT_FREQ_HZ 5000
+#define BACKLIGHT_DUTY_MAX ((1U << 13) - 1)
+#define BACKLIGHT_DIM_FADE_MS 1000
+
+typedef enum {
+    DISPLAY_ACTIVE = 0,
+    DISPLAY_DIMMED,
+    DISPLAY_ASLEEP,
+} display_power_state_t;
+
+static display_power_state_t state = DISPLAY_ACTIVE;
+static int64_t last_activity_us = 0;
+static bool initialized = false;
+
+static uint32_t duty_for_level(int percent) {
+    return (uint32_t)percent * BACKLIGHT_DUTY_MAX / 100U;
+}
+
+static void backlight_set(int percent) {
+    ledc_fade_stop(BACKLIGHT_MODE, BACKLIGHT_CHANNEL);  // A dimming fade may still be running
+    ledc_set_duty(BACKLIGHT_MODE, BACKLIGHT_CHANNEL, duty_for_level(percent));
+    ledc_update_duty(BACKLIGHT_MODE, BACKLIGHT_CHANNEL);
+}
+
+static void backlight_fade(int percent, int ms) {
+    ledc_set_fade_with_time(BACKLIGHT_MODE, BACKLIGHT_CHANNEL, duty_for_level(percent), ms);
+    ledc_fade_start(BACKLIGHT_MODE, BACKLIGHT_CHANNEL, LEDC_FADE_NO_WAIT);
+}
+
+void display_power_init() {
+    if (initialized) {
+        return;
+    }
+    
+    ledc_timer_config_t timer = {};
+    timer.speed_mode = BACKLIGHT_MODE;
+    timer.duty_resolution = LEDC_TIMER_13_BIT;
+    timer.timer_num = BACKLIGHT_TIMER;
+    timer.freq_hz = BACKLIGHT_FREQ_HZ;
+    timer.clk_cfg = LEDC_AUTO_CLK;
+    ESP_ERROR_CHECK(ledc_timer_config(&timer));
+    
+    ledc_channel_config_t channel = {};
+    channel.gpio_num = TFT_BL;
+    channel.speed_mode = BACKLIGHT_MODE;
+    channel.channel = BACKLIGHT_CHANNEL;
+    channel.intr_type = LEDC_INTR_DISABLE;
+    channel.timer_sel = BACKLIGHT_TIMER;
+    channel.duty = duty_for_level(DISPLAY_BACKLIGHT_LEVEL);
+    channel.hpoint = 0;
+    ESP_ERROR_CHECK(ledc_channel_config(&channel));
+    ledc_fade_func_install(0);
+    
+    power_manager_hold(POWER_HOLD_DISPLAY, true);  // LEDC stops in light sleep
+    state = DISPLAY_ACTIVE;
+    last_activity_us = esp_timer_get_time();
+    initialized = true;
+    ESP_LOGI(TAG, "[Display Power] Backlight PWM on GPIO%d at %d%% (dim after %ds, sleep after %ds)",
+             TFT_BL, DISPLAY_BACKLIGHT_LEVEL, DISPLAY_DIM_TIMEOUT_SEC, DISPLAY_SLEEP_TIMEOUT_SEC);
+}
+
+bool display_power_activity() {
+    last_activity_us = esp_timer_get_time();
+    if (!initialized || state == DISPLAY_ACTIVE) {
+        return true;
+    }
+    
+    bool was_asleep = (state == DISPLAY_ASLEEP);
+    if (was_asleep) {
+        power_manager_hold(POWER_HOLD_DISPLAY, true);
+        lvgl_display_set_sleep(false);  // Panel out of sleep before the backlight comes on
+        ESP_LOGI(TAG, "[Display Power] Display woken");
+    }
+    backlight_set(DISPLAY_BACKLIGHT_LEVEL);
+    state = DISPLAY_ACTIVE;
+    return !was_asleep;
+}
+
+bool display_power_update(bool hold_awake) {
+    if (!initialized) {
+        return true;
+    }
+    if (hold_awake) {
+        display_power_activity();
+        return true;
+    }
+    
+    int64_t idle_s = (esp_timer_get_time() - last_activity_us) / 1000000LL;
+    if (state == DISPLAY_ACTIVE && DISPLAY_DIM_TIMEOUT_SEC > 0 && idle_s >= DISPLAY_DIM_TIMEOUT_SEC) {
+        backlight_fade(DISPLAY_DIM_LEVEL, BACKLIGHT_DIM_FADE_MS);
+        state = DISPLAY_DIMMED;
+        ESP_LOGI(TAG, "[Display Power] Idle for %llds, dimming to %d%%", (long long)idle_s, DISPLAY_DIM_LEVEL);
+    }
+    if (state != DISPLAY_ASLEEP && DISPLAY_SLEEP_TIMEOUT_SEC > 0 && idle_s >= DISPLAY_SLEEP_TIMEOUT_SEC) {
+        backlight_set(0);
+        lvgl_display_set_sleep(true);
+        power_manager_hold(POWER_HOLD_DISPLAY, false);
+        state = DISPLAY_ASLEEP;
+        ESP_LOGI(TAG, "[Display Power] Idle for %llds, panel asleep", (long long)idle_s);
+    }
+    return state != DISPLAY_ASLEEP;
+}
+
+bool display_power_is_asleep() {
+    return state == DISPLAY_ASLEEP;
+}
+
+#endif // DISPLAY_POWER_ENABLED
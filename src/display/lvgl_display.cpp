@@ -9,17 +9,45 @@
 /**
  * LVGL Display Driver Implementation
  * Compatible with LVGL v8.x
+ * 
+ * Refresh cadence: the LVGL refresh timer runs every DISPLAY_REFRESH_FAST_MS
+ * while something is moving (touch, pour samples, screen changes, running
+ * animations - see lvgl_display_boost()) and falls back to
+ * DISPLAY_REFRESH_IDLE_MS once it has been quiet for DISPLAY_REFRESH_HOLD_MS,
+ * so idle screens coalesce their small updates into fewer, larger flushes.
+ * 
+ * Window reuse: LVGL flushes a tall area in bands of draw-buffer rows, and
+ * adjacent invalidated areas of the same width back to back. The first flush
+ * opens a panel window covering the whole run; the bands that follow only
+ * send RAMWR continue instead of the full CASET/PASET/RAMWR sequence.
+ * 
+ * SPI: DC is driven from the SPI pre-transaction callback, from a flag in
+ * each transaction's user data, so commands, parameters and pixels can be
+ * chained without the task touching the GPIO. Commands and their parameters
+ * are short, so they go out as one chain of polling transactions with the
+ * bus held (no interrupt or context switch each), and pixels are queued.
  */
 
 // Project headers
 #include "config.h"
 #include "display/lvgl_display.h"
+#include "display/board_profile.h"
+#include "display/pixel_swap.h"
+#include "system/boot_profile.h"
+#include "system/perf_monitor.h"
+#include "utils/rle_decode.h"
 
 // System/Standard library headers
+#include <inttypes.h>
+
 // ESP-IDF framework headers
 #include <driver/gpio.h>
 #include <driver/spi_master.h>
+#include <hal/gpio_ll.h>
+#include <esp_attr.h>
+#include <esp_heap_caps.h>
 #include <esp_log.h>
+#include <esp_timer.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <string.h>
@@ -33,14 +61,101 @@
 
 // ESP-IDF SPI handle
 static spi_device_handle_t spi_handle = NULL;
+
+// Flush pipeline: pixel transactions are queued to the SPI driver and
+// lv_disp_flush_ready() is called from the post-transaction callback of the
+// last one, so LVGL renders into the other draw buffer during the transfer.
+//
+// LV_COLOR_16_SWAP 1 (default): LVGL already renders in the ILI9341 wire order,
+// so the draw buffer is sent by DMA as-is (zero copy).
+// LV_COLOR_16_SWAP 0: pixels are byte-swapped into a small ring of DMA buffers,
+// the CPU swapping chunk N+1 while DMA sends chunk N.
+#if LV_COLOR_16_SWAP
+#define FLUSH_CHUNK_PIXELS (LVGL_BUFFER_SIZE)  // Whole area in one transaction
+#define FLUSH_SWAP_BUFFERS 1                     // One transaction in flight
+#else
+#define FLUSH_CHUNK_PIXELS 2048   // 2048 px = 4096 bytes @ RGB565
+#define FLUSH_SWAP_BUFFERS 3      // Chunks in flight (also the SPI queue depth)
+
+DMA_ATTR static uint16_t swap_buffers[FLUSH_SWAP_BUFFERS][FLUSH_CHUNK_PIXELS];
+#endif
+
+// Direct image streaming (splash): bands of a few lines, one decoding while one is sent
+#define STREAM_BAND_LINES 4
+#define STREAM_BANDS 2
+
+// SPI queue depth covers both pipelines
+#define SPI_QUEUE_SIZE (FLUSH_SWAP_BUFFERS > STREAM_BANDS ? FLUSH_SWAP_BUFFERS : STREAM_BANDS)
+
+static spi_transaction_t flush_trans[FLUSH_SWAP_BUFFERS];
+static size_t flush_in_flight = 0;
+
+// Panel window left open by the last flush: the next one continues at next_row
+// if it has the same columns and fits inside
+static lv_area_t open_window;
+static lv_coord_t next_row = 0;
+static bool window_open = false;
+
+// Adaptive refresh period
+static int64_t last_boost_us = 0;
+static uint32_t refresh_period_ms = LV_DISP_DEF_REFR_PERIOD;
+
+#if PERF_MONITOR_ENABLED
+// Flush timing: the post callback may run on the other core, so use esp_timer
+// rather than the per-core cycle counter
+static volatile int64_t flush_start_us = 0;
+static uint32_t frame_pixels = 0;
+#endif
+
+// Every transaction's user field points at one of these: the DC level for
+// the pre callback and, on the last pixel chunk of a flush, the display
+// driver to hand back to LVGL
+typedef struct {
+    uint32_t dc;                // 0 = command, 1 = data
+    lv_disp_drv_t *disp_drv;
+} trans_info_t;
+
+// In DRAM: read from the SPI ISR
+static DRAM_ATTR const trans_info_t TRANS_CMD = { 0, NULL };
+static DRAM_ATTR const trans_info_t TRANS_DATA = { 1, NULL };
+static DRAM_ATTR trans_info_t trans_flush_done = { 1, NULL };
+
+// Short command/parameter transactions, built up and sent as one chain
+#define ILI9341_BATCH_MAX 8
+
+typedef struct {
+    spi_transaction_t trans[ILI9341_BATCH_MAX];
+    size_t count;
+} ili9341_batch_t;
+
+// SPI pre-transaction callback (ISR context): DC follows the transaction
+// (one register store, the pin is a board profile constant)
+static void IRAM_ATTR lvgl_display_spi_pre_cb(spi_transaction_t *t) {
+    const trans_info_t *info = (const trans_info_t *)t->user;
+    gpio_ll_set_level(&GPIO, (gpio_num_t)BOARD.tft_dc, info->dc);
+}
+
+// SPI post-transaction callback (ISR context)
+static void IRAM_ATTR lvgl_display_spi_post_cb(spi_transaction_t *t) {
+    // Only the last chunk of a flush carries the display driver
+    const trans_info_t *info = (const trans_info_t *)t->user;
+    if (info->disp_drv != NULL) {
+#if PERF_MONITOR_ENABLED
+        perf_monitor_record(PERF_FLUSH_US, (uint32_t)(esp_timer_get_time() - flush_start_us));
+#endif
+        lv_disp_flush_ready(info->disp_drv);
+    }
+}
     
     // ILI9341 command constants
     #define ILI9341_SWRESET     0x01
+    #define ILI9341_SLPIN       0x10
     #define ILI9341_SLPOUT      0x11
     #define ILI9341_DISPLAYON   0x29
     #define ILI9341_CASET       0x2A
     #define ILI9341_PASET       0x2B
     #define ILI9341_RAMWR       0x2C
+    #define ILI9341_RAMWRC      0x3C   // Write memory continue
     #define ILI9341_MADCTL      0x36
     #define ILI9341_PIXFMT      0x3A
     #define ILI9341_PWRCTL1     0xC0
@@ -52,67 +167,71 @@ static spi_device_handle_t spi_handle = NULL;
     #define ILI9341_GMCTRP1     0xE0
     #define ILI9341_GMCTRN1     0xE1
     
-    // Helper function to send command
-    static void ili9341_send_cmd(uint8_t cmd) {
-        gpio_set_level((gpio_num_t)TFT_DC, 0);  // Command mode
-        spi_transaction_t t = {};
-        t.length = 8;
-        t.flags = SPI_TRANS_USE_TXDATA;
-        t.tx_data[0] = cmd;
-        esp_err_t ret = spi_device_transmit(spi_handle, &t);
-        if (ret != ESP_OK) {
-            ESP_LOGE(TAG, "SPI command transmit error: %s", esp_err_to_name(ret));
+    // Add one transaction to a batch (data up to 4 bytes is copied, longer
+    // data must stay valid until the batch has run)
+    static void batch_add(ili9341_batch_t *batch, const trans_info_t *info, const uint8_t *data, size_t len) {
+        if (batch->count == ILI9341_BATCH_MAX) {
+            ESP_LOGE(TAG, "SPI batch full, transaction dropped");
+            return;
         }
-    }
-    
-    // Helper function to send data
-    static void ili9341_send_data(const uint8_t* data, size_t len) {
-        gpio_set_level((gpio_num_t)TFT_DC, 1);  // Data mode
-        spi_transaction_t t = {};
-        t.length = len * 8;
+        spi_transaction_t *t = &batch->trans[batch->count++];
+        memset(t, 0, sizeof(*t));
+        t->length = len * 8;
+        t->user = (void *)info;
         if (len <= 4) {
-            t.flags = SPI_TRANS_USE_TXDATA;
-            memcpy(t.tx_data, data, len);
+            t->flags = SPI_TRANS_USE_TXDATA;
+            memcpy(t->tx_data, data, len);
         } else {
-            t.tx_buffer = data;
-        }
-        esp_err_t ret = spi_device_transmit(spi_handle, &t);
-        if (ret != ESP_OK) {
-            ESP_LOGE(TAG, "SPI data transmit error: %s", esp_err_to_name(ret));
+            t->tx_buffer = data;
         }
     }
     
-    // Helper function to send command with data
-    static void ili9341_send_cmd_data(uint8_t cmd, const uint8_t* data, size_t len) {
-        ili9341_send_cmd(cmd);
+    // Add a command byte and its parameters
+    static void batch_cmd(ili9341_batch_t *batch, uint8_t cmd, const uint8_t *data, size_t len) {
+        batch_add(batch, &TRANS_CMD, &cmd, 1);
         if (data && len > 0) {
-            ili9341_send_data(data, len);
+            batch_add(batch, &TRANS_DATA, data, len);
+        }
+    }
+    
+    // Send a batch back to back as polling transactions, holding the bus for
+    // the whole chain (no queued pixel transactions may be in flight)
+    static void batch_run(ili9341_batch_t *batch) {
+        spi_device_acquire_bus(spi_handle, portMAX_DELAY);
+        for (size_t i = 0; i < batch->count; i++) {
+            esp_err_t ret = spi_device_polling_transmit(spi_handle, &batch->trans[i]);
+            if (ret != ESP_OK) {
+                ESP_LOGE(TAG, "SPI transmit error: %s", esp_err_to_name(ret));
+                break;
+            }
         }
+        spi_device_release_bus(spi_handle);
+        batch->count = 0;
+    }
+    
+    // Helper function to send command
+    static void ili9341_send_cmd(uint8_t cmd) {
+        ili9341_batch_t batch = {};
+        batch_cmd(&batch, cmd, NULL, 0);
+        batch_run(&batch);
     }
     
-    // Forward declaration
-    static void ili9341_set_window(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+    // Helper function to send command with data
+    static void ili9341_send_cmd_data(uint8_t cmd, const uint8_t* data, size_t len) {
+        ili9341_batch_t batch = {};
+        batch_cmd(&batch, cmd, data, len);
+        batch_run(&batch);
+    }
     
-    // Set display window for drawing
+    // Set display window for drawing: CASET, PASET and RAMWR in one chain
     static void ili9341_set_window(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
-        uint8_t data[4];
-        
-        // Column address set
-        data[0] = (x1 >> 8) & 0xFF;
-        data[1] = x1 & 0xFF;
-        data[2] = (x2 >> 8) & 0xFF;
-        data[3] = x2 & 0xFF;
-        ili9341_send_cmd_data(ILI9341_CASET, data, 4);
-        
-        // Row address set
-        data[0] = (y1 >> 8) & 0xFF;
-        data[1] = y1 & 0xFF;
-        data[2] = (y2 >> 8) & 0xFF;
-        data[3] = y2 & 0xFF;
-        ili9341_send_cmd_data(ILI9341_PASET, data, 4);
-        
-        // Write to RAM
-        ili9341_send_cmd(ILI9341_RAMWR);
+        const uint8_t columns[4] = { (uint8_t)(x1 >> 8), (uint8_t)x1, (uint8_t)(x2 >> 8), (uint8_t)x2 };
+        const uint8_t rows[4] = { (uint8_t)(y1 >> 8), (uint8_t)y1, (uint8_t)(y2 >> 8), (uint8_t)y2 };
+        ili9341_batch_t batch = {};
+        batch_cmd(&batch, ILI9341_CASET, columns, 4);
+        batch_cmd(&batch, ILI9341_PASET, rows, 4);
+        batch_cmd(&batch, ILI9341_RAMWR, NULL, 0);
+        batch_run(&batch);
     }
     
     // Initialize ILI9341 display
@@ -121,12 +240,12 @@ static spi_device_handle_t spi_handle = NULL;
         
         // Configure SPI bus
         spi_bus_config_t bus_cfg = {};
-        bus_cfg.mosi_io_num = TFT_MOSI;
-        bus_cfg.miso_io_num = TFT_MISO;
-        bus_cfg.sclk_io_num = TFT_SCLK;
+        bus_cfg.mosi_io_num = BOARD.tft_mosi;
+        bus_cfg.miso_io_num = BOARD.tft_miso;
+        bus_cfg.sclk_io_num = BOARD.tft_sclk;
         bus_cfg.quadwp_io_num = -1;
         bus_cfg.quadhd_io_num = -1;
-        bus_cfg.max_transfer_sz = DISPLAY_WIDTH * DISPLAY_HEIGHT * 2;  // 2 bytes per pixel
+        bus_cfg.max_transfer_sz = BOARD.width * BOARD.height * 2;  // 2 bytes per pixel
         
         // Use SPI2_HOST (HSPI) for ESP32
         ESP_ERROR_CHECK(spi_bus_initialize(SPI2_HOST, &bus_cfg, SPI_DMA_CH_AUTO));
@@ -135,29 +254,32 @@ static spi_device_handle_t spi_handle = NULL;
         spi_device_interface_config_t dev_cfg = {};
         dev_cfg.clock_speed_hz = TFT_SPI_CLOCK_HZ;
         dev_cfg.mode = 0;
-        dev_cfg.spics_io_num = TFT_CS;
-        dev_cfg.queue_size = 1;
+        dev_cfg.spics_io_num = BOARD.tft_cs;
+        dev_cfg.queue_size = SPI_QUEUE_SIZE;
         dev_cfg.flags = 0;
-        dev_cfg.pre_cb = NULL;
+        dev_cfg.pre_cb = lvgl_display_spi_pre_cb;   // Drives DC per transaction
+        dev_cfg.post_cb = lvgl_display_spi_post_cb;
         
         ESP_ERROR_CHECK(spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_handle));
         
         // Configure control pins
-        gpio_set_direction((gpio_num_t)TFT_CS, GPIO_MODE_OUTPUT);
-        gpio_set_direction((gpio_num_t)TFT_DC, GPIO_MODE_OUTPUT);
-        gpio_set_direction((gpio_num_t)TFT_RST, GPIO_MODE_OUTPUT);
-        gpio_set_direction((gpio_num_t)TFT_BL, GPIO_MODE_OUTPUT);
+        gpio_set_direction((gpio_num_t)BOARD.tft_cs, GPIO_MODE_OUTPUT);
+        gpio_set_direction((gpio_num_t)BOARD.tft_dc, GPIO_MODE_OUTPUT);
+        gpio_set_direction((gpio_num_t)BOARD.tft_rst, GPIO_MODE_OUTPUT);
+        #if !DISPLAY_POWER_ENABLED
+        gpio_set_direction((gpio_num_t)BOARD.tft_bl, GPIO_MODE_OUTPUT);
+        #endif
         
         // Initialize CS pin (HIGH = inactive, SPI driver will control it during transactions)
-        gpio_set_level((gpio_num_t)TFT_CS, 1);
+        gpio_set_level((gpio_num_t)BOARD.tft_cs, 1);
         
         // Initialize DC pin
-        gpio_set_level((gpio_num_t)TFT_DC, 0);
+        gpio_set_level((gpio_num_t)BOARD.tft_dc, 0);
         
         // Reset display
-        gpio_set_level((gpio_num_t)TFT_RST, 0);
+        gpio_set_level((gpio_num_t)BOARD.tft_rst, 0);
         vTaskDelay(pdMS_TO_TICKS(10));
-        gpio_set_level((gpio_num_t)TFT_RST, 1);
+        gpio_set_level((gpio_num_t)BOARD.tft_rst, 1);
         vTaskDelay(pdMS_TO_TICKS(120));  // Wait for display to stabilize after reset
         
         // Initialize ILI9341 with complete sequence
@@ -180,35 +302,8 @@ static spi_device_handle_t spi_handle = NULL;
         uint8_t vcom2_data[] = {0xC0};
         ili9341_send_cmd_data(ILI9341_VMCTL2, vcom2_data, 1);
         
-        // Memory Access Control (MADCTL) - rotation and color order
-        // ILI9341 MADCTL bits:
-        // Bit 0 (0x01): MY (row address order)
-        // Bit 1 (0x02): MX (column address order)
-        // Bit 2 (0x04): MV (row/column exchange)
-        // Bit 3 (0x08): ML (vertical refresh order)
-        // Bit 3 (0x08): BGR (0=RGB, 1=BGR) - controls color order
-        // Bit 4 (0x10): ML (vertical refresh order)
-        // Bit 5 (0x20): MV (row/column exchange)
-        // Bit 6 (0x40): MX (column address order)
-        // Bit 7 (0x80): MY (row address order)
-        // 
-        // Note: Display configured for BGR mode (bit 3 = 0x08)
-        // Rotation settings (for reference, these match previous TFT_eSPI configuration):
-        // Rotation 0: MX=1, BGR=1 -> 0x40 | 0x08 = 0x48
-        // Rotation 1: MV=1, BGR=1 -> 0x20 | 0x08 = 0x28
-        // Rotation 2: MY=1, BGR=1 -> 0x80 | 0x08 = 0x88
-        // Rotation 3: MX=1, MY=1, MV=1, BGR=1 -> 0x40 | 0x80 | 0x20 | 0x08 = 0xE8
-        uint8_t madctl = 0x00;
-        if (DISPLAY_ROTATION == 1) {
-            // Landscape: MV=1, BGR=1
-            madctl = 0x20 | 0x08;  // MV=1, BGR=1 (bit 3)
-        } else if (DISPLAY_ROTATION == 3) {
-            // Landscape flipped: MX=1, MY=1, MV=1, BGR=1
-            madctl = 0x40 | 0x80 | 0x20 | 0x08;  // MX, MY, MV, BGR=1
-        } else {
-            // Portrait: MV=1, BGR=1
-            madctl = 0x20 | 0x08;  // MV=1, BGR=1 (bit 3)
-        }
+        // Memory Access Control (MADCTL) - rotation and color order, from the board profile
+        static constexpr uint8_t madctl = board_madctl(BOARD);
         ili9341_send_cmd_data(ILI9341_MADCTL, &madctl, 1);
         
         // Pixel format: 16-bit color
@@ -241,8 +336,10 @@ static spi_device_handle_t spi_handle = NULL;
         ili9341_send_cmd(ILI9341_DISPLAYON);
         vTaskDelay(pdMS_TO_TICKS(10));
         
-        // Enable backlight
-        gpio_set_level((gpio_num_t)TFT_BL, 1);
+        // Enable backlight (display_power dims it with PWM instead)
+        #if !DISPLAY_POWER_ENABLED
+        gpio_set_level((gpio_num_t)BOARD.tft_bl, 1);
+        #endif
         
         // Note: Screen clearing is handled by LVGL when it first renders
         // No need to manually clear the screen here
@@ -250,27 +347,123 @@ static spi_device_handle_t spi_handle = NULL;
         ESP_LOGI(TAG, "ILI9341 initialized");
     }
 
-// Display buffer
-static lv_color_t buf1[LVGL_BUFFER_SIZE];
+// Collect results of queued pixel transactions (frees SPI queue slots)
+static void flush_wait_one() {
+    spi_transaction_t *done = NULL;
+    esp_err_t ret = spi_device_get_trans_result(spi_handle, &done, portMAX_DELAY);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "SPI transaction result error: %s", esp_err_to_name(ret));
+    }
+    flush_in_flight--;
+}
+
+static void flush_wait_all() {
+    while (flush_in_flight > 0) {
+        flush_wait_one();
+    }
+}
 
 void lvgl_display_init() {
     // ESP-IDF: Initialize ILI9341
     ili9341_init();
     
+    // Two DMA-capable draw buffers: LVGL renders into one while the other is flushed
+    size_t buf_bytes = LVGL_BUFFER_SIZE * sizeof(lv_color_t);
+    lv_color_t *buf1 = (lv_color_t *)heap_caps_malloc(buf_bytes, MALLOC_CAP_DMA);
+    lv_color_t *buf2 = (lv_color_t *)heap_caps_malloc(buf_bytes, MALLOC_CAP_DMA);
+    if (buf1 == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate LVGL draw buffer (%d bytes)", (int)buf_bytes);
+        return;
+    }
+    if (buf2 == NULL) {
+        ESP_LOGW(TAG, "Second draw buffer allocation failed - falling back to single buffering");
+    }
+    
     // Initialize LVGL display driver
     lv_disp_draw_buf_t *draw_buf = (lv_disp_draw_buf_t *)malloc(sizeof(lv_disp_draw_buf_t));
-    // Single buffer to reduce DRAM usage (double buffering costs ~2x LVGL_BUFFER_SIZE)
-    lv_disp_draw_buf_init(draw_buf, buf1, NULL, LVGL_BUFFER_SIZE);
+    lv_disp_draw_buf_init(draw_buf, buf1, buf2, LVGL_BUFFER_SIZE);
     
     static lv_disp_drv_t disp_drv;
     lv_disp_drv_init(&disp_drv);
-    disp_drv.hor_res = DISPLAY_WIDTH;
-    disp_drv.ver_res = DISPLAY_HEIGHT;
+    disp_drv.hor_res = BOARD.width;
+    disp_drv.ver_res = BOARD.height;
     disp_drv.flush_cb = lvgl_display_flush;
     disp_drv.draw_buf = draw_buf;
-    lv_disp_drv_register(&disp_drv);
+    lv_disp_t *disp = lv_disp_drv_register(&disp_drv);
+    if (disp != NULL && disp->refr_timer != NULL) {
+        lv_timer_set_period(disp->refr_timer, DISPLAY_REFRESH_FAST_MS);
+        refresh_period_ms = DISPLAY_REFRESH_FAST_MS;
+    }
+    last_boost_us = esp_timer_get_time();  // Boot screens start at the fast rate
     
-    ESP_LOGI(TAG, "LVGL display initialized");
+    ESP_LOGI(TAG, "LVGL display initialized (%s buffered, %d px per buffer)",
+             buf2 ? "double" : "single", LVGL_BUFFER_SIZE);
+}
+
+void lvgl_display_set_sleep(bool sleep) {
+    // Panel keeps its GRAM in sleep, so LVGL only redraws what changed meanwhile
+    flush_wait_all();
+    window_open = false;
+    ili9341_send_cmd(sleep ? ILI9341_SLPIN : ILI9341_SLPOUT);
+    vTaskDelay(pdMS_TO_TICKS(sleep ? 5 : 120));  // ILI9341 sleep in/out settle times
+}
+
+void lvgl_display_boost() {
+    last_boost_us = esp_timer_get_time();
+}
+
+void lvgl_display_pause_if_idle() {
+    lv_disp_t *disp = lv_disp_get_default();
+    if (disp == NULL || disp->refr_timer == NULL) {
+        return;
+    }
+    
+    // Fast while something is moving, slow once it has been quiet for a while
+    bool busy = lv_anim_count_running() > 0 ||
+                esp_timer_get_time() - last_boost_us < (int64_t)DISPLAY_REFRESH_HOLD_MS * 1000;
+    uint32_t period = busy ? DISPLAY_REFRESH_FAST_MS : DISPLAY_REFRESH_IDLE_MS;
+    if (period != refresh_period_ms) {
+        lv_timer_set_period(disp->refr_timer, period);
+        refresh_period_ms = period;
+    }
+    
+    // Nothing invalidated and nothing animating: stop the refresh timer.
+    // LVGL resumes it itself as soon as an area is invalidated (_lv_inv_area).
+    if (disp->inv_p == 0 && lv_anim_count_running() == 0) {
+        lv_timer_pause(disp->refr_timer);
+    }
+}
+
+/**
+ * Bottom row of the window to open for a flush: the end of the invalidated
+ * area being refreshed, extended over the areas right below it with the same
+ * columns (LVGL refreshes them next, top to bottom)
+ */
+static lv_coord_t flush_window_bottom(const lv_area_t *area) {
+    lv_disp_t *disp = _lv_refr_get_disp_refreshing();
+    if (disp == NULL) {
+        return area->y2;
+    }
+    for (uint16_t i = 0; i < disp->inv_p; i++) {
+        const lv_area_t *inv = &disp->inv_areas[i];
+        if (disp->inv_area_joined[i] || inv->x1 != area->x1 || inv->x2 != area->x2 ||
+            inv->y1 > area->y1 || inv->y2 < area->y2) {
+            continue;
+        }
+        lv_coord_t bottom = inv->y2;
+        for (uint16_t j = i + 1; j < disp->inv_p; j++) {
+            const lv_area_t *below = &disp->inv_areas[j];
+            if (disp->inv_area_joined[j]) {
+                continue;
+            }
+            if (below->x1 != area->x1 || below->x2 != area->x2 || below->y1 != bottom + 1) {
+                break;
+            }
+            bottom = below->y2;
+        }
+        return bottom;
+    }
+    return area->y2;
 }
 
 void lvgl_display_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p) {
@@ -284,76 +477,167 @@ void lvgl_display_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color
         ESP_LOGI(TAG, "First flush: area (%d,%d) to (%d,%d), %dx%d pixels", 
                  area->x1, area->y1, area->x2, area->y2, w, h);
         first_flush = false;
+        boot_profile_mark(BOOT_PHASE_FIRST_FLUSH);
     }
     
-    ili9341_set_window(area->x1, area->y1, area->x2, area->y2);
+    // Previous flush must be fully on the wire before commands change the window
+    // (and spi_device_transmit would otherwise pick up a queued pixel result)
+    flush_wait_all();
     
-    // Send pixel data in chunks (SPI has max transfer size limits)
-    // Chunked transfer (larger chunks reduce SPI transaction overhead).
-    static constexpr size_t MAX_CHUNK_PIXELS = 4096; // 4096 px = 8192 bytes @ RGB565
+#if PERF_MONITOR_ENABLED
+    flush_start_us = esp_timer_get_time();
+    perf_monitor_mark(PERF_MARK_FLUSH);  // Closes a paid command's latency chain
+    perf_monitor_record(PERF_FLUSH_BYTES, pixel_count * 2);
+    frame_pixels += pixel_count;
+    if (lv_disp_flush_is_last(disp_drv)) {
+        perf_monitor_record(PERF_FRAME_PIXELS, frame_pixels);
+        frame_pixels = 0;
+    }
+#endif
     
-    gpio_set_level((gpio_num_t)TFT_DC, 1);  // Data mode
+    if (window_open && area->x1 == open_window.x1 && area->x2 == open_window.x2 &&
+        area->y1 == next_row && area->y2 <= open_window.y2) {
+        ili9341_send_cmd(ILI9341_RAMWRC);  // Continue where the last band stopped
+    } else {
+        open_window = *area;
+        open_window.y2 = flush_window_bottom(area);
+        ili9341_set_window(open_window.x1, open_window.y1, open_window.x2, open_window.y2);
+        window_open = true;
+    }
+    next_row = area->y2 + 1;
+    trans_flush_done.disp_drv = disp_drv;
     
-    // LVGL provides RGB565 in native endian order; ILI9341 expects MSB-first over SPI,
-    // so we byte-swap into a small reusable buffer (keeps colors correct).
-    uint16_t *pixels = (uint16_t *)color_p;
+    const uint16_t *pixels = (const uint16_t *)color_p;
     size_t remaining_pixels = pixel_count;
     size_t offset = 0;
-
-    static uint16_t swapped_buffer[MAX_CHUNK_PIXELS];
-
+    size_t slot = 0;
+    
     while (remaining_pixels > 0) {
-        const size_t chunk_pixels = (remaining_pixels > MAX_CHUNK_PIXELS) ? MAX_CHUNK_PIXELS : remaining_pixels;
-
-        // Fast byte-swap: operate on 32-bit words where possible (swaps bytes within each 16-bit pixel)
-        size_t i = 0;
-
-        // Align input to 4 bytes; keep output aligned too by consuming 2 pixels when needed.
-        if ((((uintptr_t)(&pixels[offset]) & 0x3) != 0) && chunk_pixels >= 2) {
-            const uint16_t p0 = pixels[offset + 0];
-            const uint16_t p1 = pixels[offset + 1];
-            swapped_buffer[0] = (uint16_t)(((p0 & 0x00FF) << 8) | ((p0 & 0xFF00) >> 8));
-            swapped_buffer[1] = (uint16_t)(((p1 & 0x00FF) << 8) | ((p1 & 0xFF00) >> 8));
-            i = 2;
-        } else if ((((uintptr_t)(&pixels[offset]) & 0x3) != 0) && chunk_pixels == 1) {
-            const uint16_t p0 = pixels[offset + 0];
-            swapped_buffer[0] = (uint16_t)(((p0 & 0x00FF) << 8) | ((p0 & 0xFF00) >> 8));
-            i = 1;
+        const size_t chunk_pixels = (remaining_pixels > FLUSH_CHUNK_PIXELS) ? FLUSH_CHUNK_PIXELS : remaining_pixels;
+        
+        // Reuse the oldest transaction slot once its transfer has completed
+        if (flush_in_flight == FLUSH_SWAP_BUFFERS) {
+            flush_wait_one();
         }
+        
+#if LV_COLOR_16_SWAP
+        const void *tx = &pixels[offset];  // Draw buffer is DMA-capable and already in wire order
+#else
+        pixel_swap_rgb565(swap_buffers[slot], &pixels[offset], chunk_pixels);
+        const void *tx = swap_buffers[slot];
+#endif
+        
+        offset += chunk_pixels;
+        remaining_pixels -= chunk_pixels;
+        
+        spi_transaction_t *t = &flush_trans[slot];
+        memset(t, 0, sizeof(*t));
+        t->length = chunk_pixels * 2 * 8;  // Length in bits
+        t->tx_buffer = tx;
+        // Last chunk signals LVGL
+        t->user = (void *)((remaining_pixels == 0) ? &trans_flush_done : &TRANS_DATA);
+        
+        esp_err_t ret = spi_device_queue_trans(spi_handle, t, portMAX_DELAY);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "SPI queue error: %s", esp_err_to_name(ret));
+            flush_wait_all();
+            window_open = false;  // Panel write position is unknown now
+            lv_disp_flush_ready(disp_drv);
+            return;
+        }
+        flush_in_flight++;
+        slot = (slot + 1) % FLUSH_SWAP_BUFFERS;
+    }
+    
+    // No wait here: LVGL renders the next area while the last chunks go out
+}
 
-        const size_t remaining_after_align = (chunk_pixels > i) ? (chunk_pixels - i) : 0;
-        const size_t pairs = remaining_after_align / 2;
-
-        if (pairs > 0 && (((uintptr_t)swapped_buffer & 0x3) == 0)) {
-            const uint32_t *in32 = (const uint32_t *)(&pixels[offset + i]);
-            uint32_t *out32 = (uint32_t *)(&swapped_buffer[i]);
-            for (size_t j = 0; j < pairs; j++) {
-                const uint32_t v = in32[j];
-                out32[j] = ((v & 0x00FF00FFu) << 8) | ((v & 0xFF00FF00u) >> 8);
+bool lvgl_display_stream_image(const lv_img_dsc_t *img, int is_compressed, lv_coord_t x, lv_coord_t y) {
+    const uint32_t w = img->header.w;
+    const uint32_t h = img->header.h;
+    if (x < 0 || y < 0 || x + w > BOARD.width || y + h > BOARD.height || w == 0 || h == 0) {
+        ESP_LOGE(TAG, "Stream image %" PRIu32 "x%" PRIu32 " at (%d,%d) is off screen", w, h, x, y);
+        return false;
+    }
+    
+    const size_t total_bytes = (size_t)w * h * 2;
+    if (!is_compressed && img->data_size < total_bytes) {
+        ESP_LOGE(TAG, "Stream image data too short: %" PRIu32 " < %zu bytes", img->data_size, total_bytes);
+        return false;
+    }
+    
+    // Band buffers must be DMA-capable (image data lives in flash)
+    const size_t band_bytes = (size_t)w * 2 * STREAM_BAND_LINES;
+    uint8_t *bands[STREAM_BANDS] = {};
+    for (int i = 0; i < STREAM_BANDS; i++) {
+        bands[i] = (uint8_t *)heap_caps_malloc(band_bytes, MALLOC_CAP_DMA);
+        if (bands[i] == NULL) {
+            ESP_LOGE(TAG, "Failed to allocate %zu byte stream band", band_bytes);
+            for (int j = 0; j < i; j++) {
+                heap_caps_free(bands[j]);
             }
-            i += pairs * 2;
+            return false;
         }
-
-        // Tail pixel (if odd count)
-        for (; i < chunk_pixels; i++) {
-            const uint16_t p = pixels[offset + i];
-            swapped_buffer[i] = (uint16_t)(((p & 0x00FF) << 8) | ((p & 0xFF00) >> 8));
+    }
+    
+    // LVGL flushes must be off the wire before the window changes
+    flush_wait_all();
+    ili9341_set_window(x, y, x + w - 1, y + h - 1);
+    window_open = false;  // Next LVGL flush sets its own window
+    
+    rle_stream_t stream;
+    rle_stream_init(&stream, img->data, img->data_size);
+    
+    spi_transaction_t trans[STREAM_BANDS];
+    size_t in_flight = 0;
+    size_t offset = 0;
+    int slot = 0;
+    bool ok = true;
+    
+    while (offset < total_bytes) {
+        // Reuse the oldest band once its transfer has completed
+        if (in_flight == STREAM_BANDS) {
+            spi_transaction_t *done = NULL;
+            spi_device_get_trans_result(spi_handle, &done, portMAX_DELAY);
+            in_flight--;
         }
-
-        spi_transaction_t t = {};
-        t.length = chunk_pixels * 2 * 8;  // Length in bits
-        t.tx_buffer = swapped_buffer;
-        t.flags = 0;  // No special flags
         
-        esp_err_t ret = spi_device_transmit(spi_handle, &t);
-        if (ret != ESP_OK) {
-            ESP_LOGE(TAG, "SPI transmit error: %s", esp_err_to_name(ret));
+        size_t n = total_bytes - offset < band_bytes ? total_bytes - offset : band_bytes;
+        size_t got = n;
+        if (is_compressed) {
+            got = rle_stream_read(&stream, bands[slot], n);
+        } else {
+            memcpy(bands[slot], img->data + offset, n);
+        }
+        if (got != n) {
+            ESP_LOGE(TAG, "Stream image truncated at %zu of %zu bytes", offset + got, total_bytes);
+            ok = false;
             break;
         }
         
-        offset += chunk_pixels;
-        remaining_pixels -= chunk_pixels;
+        spi_transaction_t *t = &trans[slot];
+        memset(t, 0, sizeof(*t));
+        t->length = n * 8;  // Length in bits
+        t->tx_buffer = bands[slot];
+        t->user = (void *)&TRANS_DATA;  // Not an LVGL flush
+        esp_err_t ret = spi_device_queue_trans(spi_handle, t, portMAX_DELAY);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "SPI queue error: %s", esp_err_to_name(ret));
+            ok = false;
+            break;
+        }
+        in_flight++;
+        offset += n;
+        slot = (slot + 1) % STREAM_BANDS;
     }
     
-    lv_disp_flush_ready(disp_drv);
+    while (in_flight > 0) {
+        spi_transaction_t *done = NULL;
+        spi_device_get_trans_result(spi_handle, &done, portMAX_DELAY);
+        in_flight--;
+    }
+    for (int i = 0; i < STREAM_BANDS; i++) {
+        heap_caps_free(bands[i]);
+    }
+    return ok;
 }
@@ -10,36 +10,37 @@
  * LVGL Touch Driver Implementation
  * Direct SPI communication with XPT2046 using dedicated SPI bus
  * Touch screen uses separate SPI pins: GPIO25(SCLK), GPIO32(MOSI), GPIO39(MISO)
+ * Backend: SPI3 (VSPI) host with DMA (default) or bit-banged GPIO (TOUCH_USE_SPI_HOST)
  */
 
 // Project headers
 #include "config.h"
 #include "display/lvgl_touch.h"
+#include "display/board_profile.h"
 #include "system/esp_idf_compat.h"  // For gpio_isr_handler_t
+#include "system/app_events.h"
+#include "system/perf_monitor.h"
 
 // System/Standard library headers
 // ESP-IDF framework headers
 #include <driver/gpio.h>
+#include <driver/spi_master.h>
+#include <hal/gpio_ll.h>
+#include <esp_attr.h>
 #include <esp_log.h>
 #include <esp_timer.h>
 #include <esp_rom_sys.h>
+#include <nvs.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
+#include <string.h>
 #define TAG "touch"
 
-// GPIO level constants
-#define HIGH 1
-#define LOW 0
-
-// Arduino map() function compatibility
-static inline long map(long x, long in_min, long in_max, long out_min, long out_max) {
-    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
-}
-
 // Touch screen uses its own SPI bus (separate from LCD SPI)
 // LCD SPI: GPIO14(SCLK), GPIO13(MOSI), GPIO12(MISO)
 // Touch SPI: GPIO25(SCLK), GPIO32(MOSI), GPIO39(MISO)
-// We'll use VSPI for LCD (default) and create a custom SPI for touch
+// LCD runs on SPI2 (HSPI); touch uses SPI3 (VSPI) routed through the GPIO matrix,
+// or bit-banged GPIO when TOUCH_USE_SPI_HOST is 0
 
 // XPT2046 command bytes
 #define XPT2046_CMD_X     0x90  // Read X position (DIN = 0b10010000)
@@ -47,13 +48,24 @@ static inline long map(long x, long in_min, long in_max, long out_min, long out_
 #define XPT2046_CMD_Z1    0xB0  // Read Z1 position (DIN = 0b10110000)
 #define XPT2046_CMD_Z2    0xC0  // Read Z2 position (DIN = 0b11000000)
 
-// Touch calibration values - map raw XPT2046 coordinates (0-4095) to display pixels
-#define TOUCH_X_MIN   100
-#define TOUCH_X_MAX   4000
-#define TOUCH_Y_MIN   100
-#define TOUCH_Y_MAX   4000
 #define TOUCH_PRESSURE_THRESHOLD 50  // Pressure threshold for touch detection
 
+// Calibration storage
+#define TOUCH_NVS_NAMESPACE "touch"
+#define TOUCH_NVS_KEY_CAL "cal"
+#define TOUCH_CAL_SHIFT 16  // Affine coefficients are Q16 fixed-point
+
+// Affine calibration: display = (a*raw_x + b*raw_y + c) >> 16, (d*raw_x + e*raw_y + f) >> 16
+typedef struct {
+    int32_t a, b, c;
+    int32_t d, e, f;
+} touch_cal_t;
+
+static touch_cal_t touch_cal;
+
+// LVGL input device driver (read timer is paused while the panel is idle)
+static lv_indev_drv_t touch_indev_drv;
+
 // Touch state
 static bool touch_pressed = false;
 static int16_t touch_x = 0;
@@ -61,29 +73,156 @@ static int16_t touch_y = 0;
 
 // IRQ pin monitoring
 static volatile bool irq_triggered = false;
-static volatile uint64_t last_irq_time = 0;
+static volatile uint32_t last_irq_us = 0;  // Low 32 bits of esp_timer (wraps safely)
 static int last_irq_state = -1;
-static const uint64_t IRQ_DEBOUNCE_MS = 50;  // Debounce time: ignore interrupts within 50ms
+static const uint32_t IRQ_DEBOUNCE_US = 50000;  // Debounce time: ignore interrupts within 50ms
 
-// IRQ interrupt handler
-void IRAM_ATTR irq_handler(void* arg) {
-    uint64_t now = esp_timer_get_time() / 1000ULL;
+// IRQ interrupt handler (registered directly with the GPIO ISR service)
+static void IRAM_ATTR irq_handler(void* arg) {
+    (void)arg;
+    uint32_t now_us = (uint32_t)esp_timer_get_time();
     // Debounce: only set flag if enough time has passed since last interrupt
-    if (now - last_irq_time > IRQ_DEBOUNCE_MS) {
+    if (now_us - last_irq_us > IRQ_DEBOUNCE_US) {
         irq_triggered = true;
-        last_irq_time = now;
+        last_irq_us = now_us;
+        app_events_post_from_isr(APP_EVENT_TOUCH);
     }
 }
 
-// Wrapper function that matches voidFuncPtr signature (void (*)(void))
-// This is called by gpio_isr_handler_wrapper
-static void IRAM_ATTR irq_handler_wrapper_void(void) {
-    irq_handler(NULL);
+// One filtered pressure + position sample
+typedef struct {
+    uint16_t z1;
+    uint16_t z2;
+    uint16_t x;
+    uint16_t y;
+    bool stable;  // X/Y bursts agreed within TOUCH_MAX_SPREAD
+} xpt2046_sample_t;
+
+// Conversions in one burst: Z1, Z2, then TOUCH_OVERSAMPLE each of X and Y
+#define XPT2046_SAMPLE_CONVERSIONS (2 + 2 * TOUCH_OVERSAMPLE)
+
+#if TOUCH_USE_SPI_HOST
+
+#define XPT2046_SAMPLE_BYTES (1 + 2 * XPT2046_SAMPLE_CONVERSIONS)
+
+static spi_device_handle_t touch_spi = NULL;
+DMA_ATTR static uint8_t touch_tx[XPT2046_SAMPLE_BYTES];
+DMA_ATTR static uint8_t touch_rx[XPT2046_SAMPLE_BYTES];
+
+/**
+ * Initialize touch SPI bus on SPI3 (VSPI), routed to the TOUCH_* pins via the GPIO matrix
+ */
+static bool xpt2046_bus_init() {
+    spi_bus_config_t bus_cfg = {};
+    bus_cfg.mosi_io_num = BOARD.touch_mosi;
+    bus_cfg.miso_io_num = BOARD.touch_miso;
+    bus_cfg.sclk_io_num = BOARD.touch_sclk;
+    bus_cfg.quadwp_io_num = -1;
+    bus_cfg.quadhd_io_num = -1;
+    bus_cfg.max_transfer_sz = XPT2046_SAMPLE_BYTES;
+    
+    esp_err_t ret = spi_bus_initialize(SPI3_HOST, &bus_cfg, SPI_DMA_CH_AUTO);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "[Touch] SPI3 bus init failed: %s", esp_err_to_name(ret));
+        return false;
+    }
+    
+    spi_device_interface_config_t dev_cfg = {};
+    dev_cfg.clock_speed_hz = TOUCH_SPI_CLOCK_HZ;
+    dev_cfg.mode = 0;
+    dev_cfg.spics_io_num = BOARD.touch_cs;
+    dev_cfg.queue_size = 1;
+    
+    ret = spi_bus_add_device(SPI3_HOST, &dev_cfg, &touch_spi);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "[Touch] SPI3 device add failed: %s", esp_err_to_name(ret));
+        touch_spi = NULL;
+        return false;
+    }
+    
+    ESP_LOGI(TAG, "[Touch] SPI3 host: SCLK=GPIO%d, MOSI=GPIO%d, MISO=GPIO%d, CS=GPIO%d, %d Hz",
+             BOARD.touch_sclk, BOARD.touch_mosi, BOARD.touch_miso, BOARD.touch_cs, TOUCH_SPI_CLOCK_HZ);
+    return true;
+}
+
+/**
+ * Run a sequence of conversions in one DMA transaction
+ * Uses the XPT2046 16-clocks-per-conversion mode: the next command byte is sent
+ * while the low bits of the previous result are clocked out.
+ * Each 12-bit result is framed as [0 D11..D0 000] across two bytes.
+ */
+static void xpt2046_read_sequence(const uint8_t *commands, uint16_t *results, size_t count) {
+    memset(touch_tx, 0, sizeof(touch_tx));
+    for (size_t i = 0; i < count; i++) {
+        touch_tx[2 * i] = commands[i];
+    }
+    
+    spi_transaction_t t = {};
+    t.length = (1 + 2 * count) * 8;
+    t.tx_buffer = touch_tx;
+    t.rx_buffer = touch_rx;
+    
+    if (touch_spi == NULL || spi_device_transmit(touch_spi, &t) != ESP_OK) {
+        memset(results, 0, count * sizeof(uint16_t));
+        return;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        results[i] = (uint16_t)(((touch_rx[2 * i + 1] << 8) | touch_rx[2 * i + 2]) >> 3);
+    }
+}
+
+#else
+
+/**
+ * Initialize bit-banged touch SPI pins (separate SPI bus: GPIO25, GPIO32, GPIO39)
+ */
+static bool xpt2046_bus_init() {
+    // Configure CS pin
+    gpio_config_t cs_conf = {};
+    cs_conf.pin_bit_mask = (1ULL << BOARD.touch_cs);
+    cs_conf.mode = GPIO_MODE_OUTPUT;
+    cs_conf.pull_up_en = GPIO_PULLUP_DISABLE;
+    cs_conf.pull_down_en = GPIO_PULLDOWN_DISABLE;
+    cs_conf.intr_type = GPIO_INTR_DISABLE;
+    gpio_config(&cs_conf);
+    gpio_set_level((gpio_num_t)BOARD.touch_cs, 1);
+    ESP_LOGI(TAG, "[Touch] CS pin configured: GPIO%d", BOARD.touch_cs);
+    
+    gpio_config_t sclk_conf = {};
+    sclk_conf.pin_bit_mask = (1ULL << BOARD.touch_sclk);
+    sclk_conf.mode = GPIO_MODE_OUTPUT;
+    sclk_conf.pull_up_en = GPIO_PULLUP_DISABLE;
+    sclk_conf.pull_down_en = GPIO_PULLDOWN_DISABLE;
+    sclk_conf.intr_type = GPIO_INTR_DISABLE;
+    gpio_config(&sclk_conf);
+    
+    gpio_config_t mosi_conf = {};
+    mosi_conf.pin_bit_mask = (1ULL << BOARD.touch_mosi);
+    mosi_conf.mode = GPIO_MODE_OUTPUT;
+    mosi_conf.pull_up_en = GPIO_PULLUP_DISABLE;
+    mosi_conf.pull_down_en = GPIO_PULLDOWN_DISABLE;
+    mosi_conf.intr_type = GPIO_INTR_DISABLE;
+    gpio_config(&mosi_conf);
+    
+    gpio_config_t miso_conf = {};
+    miso_conf.pin_bit_mask = (1ULL << BOARD.touch_miso);
+    miso_conf.mode = GPIO_MODE_INPUT;
+    miso_conf.pull_up_en = GPIO_PULLUP_DISABLE;
+    miso_conf.pull_down_en = GPIO_PULLDOWN_DISABLE;
+    miso_conf.intr_type = GPIO_INTR_DISABLE;
+    gpio_config(&miso_conf);
+    
+    gpio_set_level((gpio_num_t)BOARD.touch_sclk, 1);  // Idle high for SPI mode 0
+    ESP_LOGI(TAG, "[Touch] SPI pins configured: SCLK=GPIO%d, MOSI=GPIO%d, MISO=GPIO%d", 
+              BOARD.touch_sclk, BOARD.touch_mosi, BOARD.touch_miso);
+    return true;
 }
 
 /**
  * Read a single coordinate from XPT2046 via SPI
  * Returns 12-bit value (0-4095)
+ * The pins are board profile constants, so each clock edge is one GPIO register store
  * Uses touch screen's dedicated SPI bus: GPIO25(SCLK), GPIO32(MOSI), GPIO39(MISO)
  */
 static uint16_t xpt2046_read(uint8_t command) {
@@ -91,16 +230,16 @@ static uint16_t xpt2046_read(uint8_t command) {
     
     // Touch screen uses its own SPI bus with custom pins
     // Bit-bang SPI for touch screen (since it uses different pins than LCD SPI)
-    gpio_set_level((gpio_num_t)TOUCH_CS, 0);
+    gpio_ll_set_level(&GPIO, (gpio_num_t)BOARD.touch_cs, 0);
     esp_rom_delay_us(1);
     
     // Send command byte (MSB first, SPI mode 0: CPOL=0, CPHA=0)
     uint8_t cmd = command;
     for (int i = 7; i >= 0; i--) {
-        gpio_set_level((gpio_num_t)TOUCH_SCLK, 0);
-        gpio_set_level((gpio_num_t)TOUCH_MOSI, (cmd >> i) & 0x01);
+        gpio_ll_set_level(&GPIO, (gpio_num_t)BOARD.touch_sclk, 0);
+        gpio_ll_set_level(&GPIO, (gpio_num_t)BOARD.touch_mosi, (cmd >> i) & 0x01);
         esp_rom_delay_us(1);
-        gpio_set_level((gpio_num_t)TOUCH_SCLK, 1);
+        gpio_ll_set_level(&GPIO, (gpio_num_t)BOARD.touch_sclk, 1);
         esp_rom_delay_us(1);
     }
     
@@ -110,10 +249,10 @@ static uint16_t xpt2046_read(uint8_t command) {
     
     // Read high byte
     for (int i = 7; i >= 0; i--) {
-        gpio_set_level((gpio_num_t)TOUCH_SCLK, 0);
+        gpio_ll_set_level(&GPIO, (gpio_num_t)BOARD.touch_sclk, 0);
         esp_rom_delay_us(1);
-        gpio_set_level((gpio_num_t)TOUCH_SCLK, 1);
-        if (gpio_get_level((gpio_num_t)TOUCH_MISO)) {
+        gpio_ll_set_level(&GPIO, (gpio_num_t)BOARD.touch_sclk, 1);
+        if (gpio_ll_get_level(&GPIO, (gpio_num_t)BOARD.touch_miso)) {
             high_byte |= (1 << i);
         }
         esp_rom_delay_us(1);
@@ -121,16 +260,16 @@ static uint16_t xpt2046_read(uint8_t command) {
     
     // Read low byte
     for (int i = 7; i >= 0; i--) {
-        gpio_set_level((gpio_num_t)TOUCH_SCLK, 0);
+        gpio_ll_set_level(&GPIO, (gpio_num_t)BOARD.touch_sclk, 0);
         esp_rom_delay_us(1);
-        gpio_set_level((gpio_num_t)TOUCH_SCLK, 1);
-        if (gpio_get_level((gpio_num_t)TOUCH_MISO)) {
+        gpio_ll_set_level(&GPIO, (gpio_num_t)BOARD.touch_sclk, 1);
+        if (gpio_ll_get_level(&GPIO, (gpio_num_t)BOARD.touch_miso)) {
             low_byte |= (1 << i);
         }
         esp_rom_delay_us(1);
     }
     
-    gpio_set_level((gpio_num_t)TOUCH_CS, 1);
+    gpio_ll_set_level(&GPIO, (gpio_num_t)BOARD.touch_cs, 1);
     
     // Combine bytes: XPT2046 returns 12-bit data
     data = ((high_byte << 8) | low_byte) >> 4;
@@ -139,117 +278,209 @@ static uint16_t xpt2046_read(uint8_t command) {
 }
 
 /**
- * Check if touch is pressed by reading pressure (Z1 and Z2)
+ * Run a sequence of conversions (one bit-banged 24-clock read each)
+ */
+static void xpt2046_read_sequence(const uint8_t *commands, uint16_t *results, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        results[i] = xpt2046_read(commands[i]);
+    }
+}
+
+#endif
+
+/**
+ * Reduce a burst of conversions to one value
+ * Sorts in place, then averages the middle half (trimmed mean); with fewer than
+ * 4 values this is the median. Returns the spread of the values kept.
  */
-static bool xpt2046_is_pressed() {
-    uint16_t z1 = xpt2046_read(XPT2046_CMD_Z1);
-    uint16_t z2 = xpt2046_read(XPT2046_CMD_Z2);
+static uint16_t touch_filter(uint16_t *values, size_t count, uint16_t *spread) {
+    // Insertion sort - count is at most 15
+    for (size_t i = 1; i < count; i++) {
+        uint16_t v = values[i];
+        size_t j = i;
+        while (j > 0 && values[j - 1] > v) {
+            values[j] = values[j - 1];
+            j--;
+        }
+        values[j] = v;
+    }
     
-    uint16_t pressure = 0;
-    if (z1 > 0 && z2 < 4095) {
-        pressure = z1 + (4095 - z2);
+    size_t trim = (count >= 4) ? count / 4 : (count - 1) / 2;
+    size_t lo = trim;
+    size_t hi = count - trim;  // Exclusive
+    uint32_t sum = 0;
+    for (size_t i = lo; i < hi; i++) {
+        sum += values[i];
     }
+    *spread = values[hi - 1] - values[lo];
+    return (uint16_t)((sum + (hi - lo) / 2) / (hi - lo));
+}
+
+/**
+ * Read pressure and an oversampled position in one burst
+ * Ends with a PD=00 command so PENIRQ is re-enabled afterwards
+ */
+static void xpt2046_read_sample(xpt2046_sample_t *sample) {
+    uint8_t commands[XPT2046_SAMPLE_CONVERSIONS];
+    uint16_t results[XPT2046_SAMPLE_CONVERSIONS];
+    commands[0] = XPT2046_CMD_Z1;
+    commands[1] = XPT2046_CMD_Z2;
+    for (size_t i = 0; i < TOUCH_OVERSAMPLE; i++) {
+        commands[2 + i] = XPT2046_CMD_X;
+        commands[2 + TOUCH_OVERSAMPLE + i] = XPT2046_CMD_Y;
+    }
+    xpt2046_read_sequence(commands, results, XPT2046_SAMPLE_CONVERSIONS);
+    
+    uint16_t spread_x = 0;
+    uint16_t spread_y = 0;
+    sample->z1 = results[0];
+    sample->z2 = results[1];
+    sample->x = touch_filter(&results[2], TOUCH_OVERSAMPLE, &spread_x);
+    sample->y = touch_filter(&results[2 + TOUCH_OVERSAMPLE], TOUCH_OVERSAMPLE, &spread_y);
+    sample->stable = (spread_x <= TOUCH_MAX_SPREAD) && (spread_y <= TOUCH_MAX_SPREAD);
+}
+
+// Pressure estimate from Z1/Z2 (0 if no contact)
+static uint16_t xpt2046_pressure(const xpt2046_sample_t *sample) {
+    if (sample->z1 > 0 && sample->z2 < 4095) {
+        return sample->z1 + (4095 - sample->z2);
+    }
+    return 0;
+}
+
+/**
+ * Check if touch is pressed from the sample's pressure (Z1 and Z2)
+ */
+static bool xpt2046_is_pressed(const xpt2046_sample_t *sample) {
+    uint16_t pressure = xpt2046_pressure(sample);
     
     bool pressed = (pressure > TOUCH_PRESSURE_THRESHOLD) && 
-                   (z1 > 50) && (z1 < 4000) && 
-                   (z2 > 50) && (z2 < 4000);
+                   (sample->z1 > 50) && (sample->z1 < 4000) && 
+                   (sample->z2 > 50) && (sample->z2 < 4000);
     
     return pressed;
 }
 
 /**
- * Read touch coordinates and convert to display coordinates
+ * Solve the affine matrix mapping three raw points onto three display points
+ * Returns false if the raw points are collinear
+ */
+static bool touch_cal_solve(const touch_point_t display[3], const touch_point_t raw[3], touch_cal_t *cal) {
+    const double x0 = raw[0].x, y0 = raw[0].y;
+    const double x1 = raw[1].x, y1 = raw[1].y;
+    const double x2 = raw[2].x, y2 = raw[2].y;
+    const double det = (x0 - x2) * (y1 - y2) - (x1 - x2) * (y0 - y2);
+    if (det > -1.0 && det < 1.0) {
+        return false;
+    }
+    
+    const double scale = (double)(1 << TOUCH_CAL_SHIFT) / det;
+    int32_t *row[2][3] = {{&cal->a, &cal->b, &cal->c}, {&cal->d, &cal->e, &cal->f}};
+    for (int k = 0; k < 2; k++) {
+        const double d0 = k ? display[0].y : display[0].x;
+        const double d1 = k ? display[1].y : display[1].x;
+        const double d2 = k ? display[2].y : display[2].x;
+        *row[k][0] = (int32_t)(((d0 - d2) * (y1 - y2) - (d1 - d2) * (y0 - y2)) * scale);
+        *row[k][1] = (int32_t)(((x0 - x2) * (d1 - d2) - (d0 - d2) * (x1 - x2)) * scale);
+        *row[k][2] = (int32_t)((y0 * (x2 * d1 - x1 * d2) + y1 * (x0 * d2 - x2 * d0) + y2 * (x1 * d0 - x0 * d1)) * scale);
+    }
+    return true;
+}
+
+// Q16 gain and offset taking raw [lo, hi] onto display [from, to]
+static constexpr int32_t cal_gain(int32_t lo, int32_t hi, int32_t from, int32_t to) {
+    return (int32_t)((int64_t)(to - from) * (1 << TOUCH_CAL_SHIFT) / (hi - lo));
+}
+
+static constexpr int32_t cal_offset(int32_t lo, int32_t hi, int32_t from, int32_t to) {
+    return (int32_t)((int64_t)from * (1 << TOUCH_CAL_SHIFT) - (int64_t)cal_gain(lo, hi, from, to) * lo);
+}
+
+/**
+ * Default calibration: the board's raw touch range across the panel for its rotation
+ * Portrait reads the raw axes swapped; rotations 2 and 3 run both display axes backwards
  */
-static void xpt2046_read_coords(int16_t *x, int16_t *y) {
-    uint16_t raw_x = xpt2046_read(XPT2046_CMD_X);
-    uint16_t raw_y = xpt2046_read(XPT2046_CMD_Y);
-    
-    int16_t display_x, display_y;
-    
-    // Map raw coordinates to display coordinates based on rotation
-    switch (DISPLAY_ROTATION) {
-        case 0: // Portrait
-            display_x = map(raw_y, TOUCH_Y_MIN, TOUCH_Y_MAX, 0, DISPLAY_WIDTH);
-            display_y = map(raw_x, TOUCH_X_MIN, TOUCH_X_MAX, 0, DISPLAY_HEIGHT);
-            break;
-        case 1: // Landscape (USB right)
-            display_x = map(raw_x, TOUCH_X_MIN, TOUCH_X_MAX, 0, DISPLAY_WIDTH);
-            display_y = map(raw_y, TOUCH_Y_MIN, TOUCH_Y_MAX, 0, DISPLAY_HEIGHT);
-            break;
-        case 2: // Portrait inverted
-            display_x = map(raw_y, TOUCH_Y_MIN, TOUCH_Y_MAX, DISPLAY_WIDTH, 0);
-            display_y = map(raw_x, TOUCH_X_MIN, TOUCH_X_MAX, DISPLAY_HEIGHT, 0);
-            break;
-        case 3: // Landscape (USB left)
-            display_x = map(raw_x, TOUCH_X_MIN, TOUCH_X_MAX, DISPLAY_WIDTH, 0);
-            display_y = map(raw_y, TOUCH_Y_MIN, TOUCH_Y_MAX, DISPLAY_HEIGHT, 0);
-            break;
-        default:
-            display_x = map(raw_x, TOUCH_X_MIN, TOUCH_X_MAX, 0, DISPLAY_WIDTH);
-            display_y = map(raw_y, TOUCH_Y_MIN, TOUCH_Y_MAX, 0, DISPLAY_HEIGHT);
-            break;
+static constexpr touch_cal_t touch_cal_default(const board_profile_t& b) {
+    const bool swap = (b.rotation == 0 || b.rotation == 2);
+    const bool flip = (b.rotation == 2 || b.rotation == 3);
+    const int32_t x_lo = swap ? b.touch_y_min : b.touch_x_min;  // Raw axis feeding display x
+    const int32_t x_hi = swap ? b.touch_y_max : b.touch_x_max;
+    const int32_t y_lo = swap ? b.touch_x_min : b.touch_y_min;  // Raw axis feeding display y
+    const int32_t y_hi = swap ? b.touch_x_max : b.touch_y_max;
+    const int32_t x_from = flip ? b.width : 0;
+    const int32_t y_from = flip ? b.height : 0;
+    const int32_t x_to = flip ? 0 : b.width;
+    const int32_t y_to = flip ? 0 : b.height;
+    const int32_t gx = cal_gain(x_lo, x_hi, x_from, x_to);
+    const int32_t gy = cal_gain(y_lo, y_hi, y_from, y_to);
+    return touch_cal_t{
+        swap ? 0 : gx, swap ? gx : 0, cal_offset(x_lo, x_hi, x_from, x_to),
+        swap ? gy : 0, swap ? 0 : gy, cal_offset(y_lo, y_hi, y_from, y_to),
+    };
+}
+
+static constexpr touch_cal_t TOUCH_CAL_DEFAULT = touch_cal_default(BOARD);
+
+static void touch_cal_set_default() {
+    touch_cal = TOUCH_CAL_DEFAULT;
+}
+
+static void touch_cal_load() {
+    touch_cal_set_default();
+    
+    nvs_handle_t handle;
+    if (nvs_open(TOUCH_NVS_NAMESPACE, NVS_READONLY, &handle) != ESP_OK) {
+        ESP_LOGI(TAG, "[Touch] No stored calibration - using defaults");
+        return;
+    }
+    touch_cal_t stored;
+    size_t size = sizeof(stored);
+    esp_err_t err = nvs_get_blob(handle, TOUCH_NVS_KEY_CAL, &stored, &size);
+    nvs_close(handle);
+    if (err == ESP_OK && size == sizeof(stored)) {
+        touch_cal = stored;
+        ESP_LOGI(TAG, "[Touch] Loaded 3-point calibration from NVS");
+    } else {
+        ESP_LOGI(TAG, "[Touch] No stored calibration - using defaults");
     }
+}
+
+/**
+ * Convert a filtered raw sample to display coordinates
+ */
+static void xpt2046_read_coords(const xpt2046_sample_t *sample, int16_t *x, int16_t *y) {
+    const int64_t raw_x = sample->x;
+    const int64_t raw_y = sample->y;
+    
+    int32_t display_x = (int32_t)((touch_cal.a * raw_x + touch_cal.b * raw_y + touch_cal.c) >> TOUCH_CAL_SHIFT);
+    int32_t display_y = (int32_t)((touch_cal.d * raw_x + touch_cal.e * raw_y + touch_cal.f) >> TOUCH_CAL_SHIFT);
     
     // Clamp to display bounds
     if (display_x < 0) display_x = 0;
-    if (display_x >= DISPLAY_WIDTH) display_x = DISPLAY_WIDTH - 1;
+    if (display_x >= BOARD.width) display_x = BOARD.width - 1;
     if (display_y < 0) display_y = 0;
-    if (display_y >= DISPLAY_HEIGHT) display_y = DISPLAY_HEIGHT - 1;
+    if (display_y >= BOARD.height) display_y = BOARD.height - 1;
     
-    *x = display_x;
-    *y = display_y;
+    *x = (int16_t)display_x;
+    *y = (int16_t)display_y;
 }
 
 void lvgl_touch_init() {
     ESP_LOGI(TAG, "[Touch] Initializing touch controller...");
     
-    // Configure CS pin
-    gpio_config_t cs_conf = {};
-    cs_conf.pin_bit_mask = (1ULL << TOUCH_CS);
-    cs_conf.mode = GPIO_MODE_OUTPUT;
-    cs_conf.pull_up_en = GPIO_PULLUP_DISABLE;
-    cs_conf.pull_down_en = GPIO_PULLDOWN_DISABLE;
-    cs_conf.intr_type = GPIO_INTR_DISABLE;
-    gpio_config(&cs_conf);
-    gpio_set_level((gpio_num_t)TOUCH_CS, 1);
-    ESP_LOGI(TAG, "[Touch] CS pin configured: GPIO%d", TOUCH_CS);
-    
-    // Initialize touch SPI pins (separate SPI bus: GPIO25, GPIO32, GPIO39)
-    gpio_config_t sclk_conf = {};
-    sclk_conf.pin_bit_mask = (1ULL << TOUCH_SCLK);
-    sclk_conf.mode = GPIO_MODE_OUTPUT;
-    sclk_conf.pull_up_en = GPIO_PULLUP_DISABLE;
-    sclk_conf.pull_down_en = GPIO_PULLDOWN_DISABLE;
-    sclk_conf.intr_type = GPIO_INTR_DISABLE;
-    gpio_config(&sclk_conf);
-    
-    gpio_config_t mosi_conf = {};
-    mosi_conf.pin_bit_mask = (1ULL << TOUCH_MOSI);
-    mosi_conf.mode = GPIO_MODE_OUTPUT;
-    mosi_conf.pull_up_en = GPIO_PULLUP_DISABLE;
-    mosi_conf.pull_down_en = GPIO_PULLDOWN_DISABLE;
-    mosi_conf.intr_type = GPIO_INTR_DISABLE;
-    gpio_config(&mosi_conf);
-    
-    gpio_config_t miso_conf = {};
-    miso_conf.pin_bit_mask = (1ULL << TOUCH_MISO);
-    miso_conf.mode = GPIO_MODE_INPUT;
-    miso_conf.pull_up_en = GPIO_PULLUP_DISABLE;
-    miso_conf.pull_down_en = GPIO_PULLDOWN_DISABLE;
-    miso_conf.intr_type = GPIO_INTR_DISABLE;
-    gpio_config(&miso_conf);
+    if (!xpt2046_bus_init()) {
+        ESP_LOGE(TAG, "[Touch] ERROR: Touch bus unavailable - touch input disabled");
+    }
     
-    gpio_set_level((gpio_num_t)TOUCH_SCLK, 1);  // Idle high for SPI mode 0
-    ESP_LOGI(TAG, "[Touch] SPI pins configured: SCLK=GPIO%d, MOSI=GPIO%d, MISO=GPIO%d", 
-              TOUCH_SCLK, TOUCH_MOSI, TOUCH_MISO);
+    touch_cal_load();
     
     // Configure IRQ pin
-    if (TOUCH_IRQ >= 0) {
+    if (BOARD.touch_irq >= 0) {
         // Check if pin is input-only (GPIO34, GPIO35, GPIO36, GPIO39 on ESP32)
-        bool is_input_only = (TOUCH_IRQ == 34 || TOUCH_IRQ == 35 || TOUCH_IRQ == 36 || TOUCH_IRQ == 39);
+        constexpr bool is_input_only = board_pin_input_only(BOARD.touch_irq);
         
         gpio_config_t irq_conf = {};
-        irq_conf.pin_bit_mask = (1ULL << TOUCH_IRQ);
+        irq_conf.pin_bit_mask = (1ULL << BOARD.touch_irq);
         irq_conf.mode = GPIO_MODE_INPUT;
         if (is_input_only) {
             irq_conf.pull_up_en = GPIO_PULLUP_DISABLE;
@@ -261,24 +492,13 @@ void lvgl_touch_init() {
         irq_conf.intr_type = GPIO_INTR_NEGEDGE;  // FALLING edge
         gpio_config(&irq_conf);
         
-        last_irq_state = gpio_get_level((gpio_num_t)TOUCH_IRQ);
+        last_irq_state = gpio_get_level((gpio_num_t)BOARD.touch_irq);
         
-        // Store handler in gpio_isr_handlers for the wrapper to call
-        extern gpio_isr_handler_t gpio_isr_handlers[];
-        extern void IRAM_ATTR gpio_isr_handler_wrapper(void* arg);
-        
-        // Store the wrapper in gpio_isr_handlers so gpio_isr_handler_wrapper can call it
-        if (TOUCH_IRQ < GPIO_NUM_MAX) {
-            gpio_isr_handlers[TOUCH_IRQ].pin = (gpio_num_t)TOUCH_IRQ;
-            gpio_isr_handlers[TOUCH_IRQ].func = irq_handler_wrapper_void;
-            gpio_isr_handlers[TOUCH_IRQ].type = GPIO_INTR_NEGEDGE;
-        }
-        
-        // Add ISR handler - use the wrapper function
-        gpio_isr_handler_add((gpio_num_t)TOUCH_IRQ, gpio_isr_handler_wrapper, (void*)(intptr_t)TOUCH_IRQ);
+        // The GPIO ISR service calls irq_handler directly
+        gpio_isr_handler_add((gpio_num_t)BOARD.touch_irq, irq_handler, NULL);
         
         ESP_LOGI(TAG, "[Touch] IRQ pin configured: GPIO%d (initial state: %s, FALLING edge)", 
-                  TOUCH_IRQ, last_irq_state == 0 ? "LOW (pressed)" : "HIGH (not pressed)");
+                  BOARD.touch_irq, last_irq_state == 0 ? "LOW (pressed)" : "HIGH (not pressed)");
     } else {
         ESP_LOGW(TAG, "[Touch] WARNING: No IRQ pin configured!");
     }
@@ -286,18 +506,15 @@ void lvgl_touch_init() {
     vTaskDelay(pdMS_TO_TICKS(10));
     
     // Test touch controller by reading initial values
-    uint16_t test_x = xpt2046_read(XPT2046_CMD_X);
-    uint16_t test_y = xpt2046_read(XPT2046_CMD_Y);
-    uint16_t test_z1 = xpt2046_read(XPT2046_CMD_Z1);
-    uint16_t test_z2 = xpt2046_read(XPT2046_CMD_Z2);
-    ESP_LOGI(TAG, "[Touch] Initial read test: X=%d Y=%d Z1=%d Z2=%d", test_x, test_y, test_z1, test_z2);
+    xpt2046_sample_t test = {};
+    xpt2046_read_sample(&test);
+    ESP_LOGI(TAG, "[Touch] Initial read test: X=%d Y=%d Z1=%d Z2=%d", test.x, test.y, test.z1, test.z2);
     
     // Register LVGL touch input device
-    static lv_indev_drv_t indev_drv;
-    lv_indev_drv_init(&indev_drv);
-    indev_drv.type = LV_INDEV_TYPE_POINTER;
-    indev_drv.read_cb = lvgl_touch_read;
-    lv_indev_t *indev = lv_indev_drv_register(&indev_drv);
+    lv_indev_drv_init(&touch_indev_drv);
+    touch_indev_drv.type = LV_INDEV_TYPE_POINTER;
+    touch_indev_drv.read_cb = lvgl_touch_read;
+    lv_indev_t *indev = lv_indev_drv_register(&touch_indev_drv);
     
     if (indev != NULL) {
         ESP_LOGI(TAG, "[Touch] Touch controller initialized and registered with LVGL");
@@ -306,7 +523,7 @@ void lvgl_touch_init() {
     }
 }
 
-void lvgl_touch_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data) {
+static void touch_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data) {
     static bool last_pressed = false;
     static uint64_t last_log_time = 0;
     static unsigned long touch_count = 0;
@@ -316,8 +533,8 @@ void lvgl_touch_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data) {
     bool pressure_pressed = false;
     
     // Check IRQ pin
-    if (TOUCH_IRQ >= 0) {
-        int irq_state = gpio_get_level((gpio_num_t)TOUCH_IRQ);
+    if (BOARD.touch_irq >= 0) {
+        int irq_state = gpio_ll_get_level(&GPIO, (gpio_num_t)BOARD.touch_irq);
         irq_pressed = (irq_state == 0);
         
         // Update IRQ state (don't log state changes - too noisy, especially during BLE activity)
@@ -325,17 +542,32 @@ void lvgl_touch_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data) {
             last_irq_state = irq_state;
         }
         
-        // Clear interrupt flag - only process if pressure also indicates a press
-        // This filters out electrical noise from BLE radio activity
-        if (irq_triggered) {
-            irq_triggered = false;
-            // Don't log IRQ triggers - they're too noisy, especially during BLE provisioning
-            // Only process if we also have pressure reading indicating actual touch
+        // PENIRQ idle and no falling edge since the last read: nobody is touching
+        // the panel, so report released without touching the SPI bus
+        bool irq_seen = irq_triggered;
+        irq_triggered = false;
+        if (!irq_pressed && !irq_seen) {
+            if (last_pressed) {
+                ESP_LOGI(TAG, "[Touch] Released");
+            }
+            data->point.x = touch_x;
+            data->point.y = touch_y;
+            data->state = LV_INDEV_STATE_RELEASED;
+            touch_pressed = false;
+            last_pressed = false;
+            
+            // Stop polling until the next PENIRQ edge (lvgl_touch_wake)
+            if (indev_drv->read_timer != NULL) {
+                lv_timer_pause(indev_drv->read_timer);
+            }
+            return;
         }
     }
     
-    // Check pressure
-    pressure_pressed = xpt2046_is_pressed();
+    // Pressure and position in one pass
+    xpt2046_sample_t sample;
+    xpt2046_read_sample(&sample);
+    pressure_pressed = xpt2046_is_pressed(&sample);
     
     // Determine if touch is pressed
     // Require BOTH IRQ and pressure for more reliable detection (reduces false positives from BLE noise)
@@ -343,23 +575,26 @@ void lvgl_touch_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data) {
     pressed = irq_pressed && pressure_pressed;
     
     // Fallback: if pressure is very strong, accept it even without IRQ (for reliability)
+    // e.g. IRQ edge seen but the line read high, or no IRQ pin configured
     if (!pressed && pressure_pressed) {
-        // Check if pressure is very strong (definitely a real touch)
-        uint16_t z1 = xpt2046_read(XPT2046_CMD_Z1);
-        uint16_t z2 = xpt2046_read(XPT2046_CMD_Z2);
-        uint16_t pressure = 0;
-        if (z1 > 0 && z2 < 4095) {
-            pressure = z1 + (4095 - z2);
-        }
         // If pressure is very strong (>200), accept it as real touch even without IRQ
-        if (pressure > 200) {
+        if (xpt2046_pressure(&sample) > 200) {
             pressed = true;
         }
     }
     
+    // Bursts disagreed (finger landing, lifting or noise): hold the previous
+    // report instead of emitting a jittery point or a spurious press/release
+    if (pressed && !sample.stable) {
+        data->point.x = touch_x;
+        data->point.y = touch_y;
+        data->state = last_pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+        return;
+    }
+    
     if (pressed) {
         int16_t x, y;
-        xpt2046_read_coords(&x, &y);
+        xpt2046_read_coords(&sample, &x, &y);
         
         data->point.x = x;
         data->point.y = y;
@@ -392,6 +627,19 @@ void lvgl_touch_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data) {
     last_pressed = pressed;
 }
 
+void lvgl_touch_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data) {
+    uint32_t start = perf_monitor_begin();
+    touch_read(indev_drv, data);
+    perf_monitor_end_us(PERF_INPUT_US, start);
+}
+
+void lvgl_touch_wake() {
+    if (touch_indev_drv.read_timer != NULL) {
+        lv_timer_resume(touch_indev_drv.read_timer);
+        lv_timer_ready(touch_indev_drv.read_timer);
+    }
+}
+
 void update_touch_state(int16_t x, int16_t y, bool pressed) {
     touch_x = x;
     touch_y = y;
@@ -403,3 +651,61 @@ bool get_touch_state(int16_t *x, int16_t *y) {
     if (y) *y = touch_y;
     return touch_pressed;
 }
+
+bool lvgl_touch_read_raw(touch_point_t *raw) {
+    if (BOARD.touch_irq >= 0 && gpio_ll_get_level(&GPIO, (gpio_num_t)BOARD.touch_irq) != 0) {
+        return false;
+    }
+    
+    xpt2046_sample_t sample;
+    xpt2046_read_sample(&sample);
+    if (!xpt2046_is_pressed(&sample) || !sample.stable) {
+        return false;
+    }
+    
+    raw->x = (int16_t)sample.x;
+    raw->y = (int16_t)sample.y;
+    return true;
+}
+
+bool lvgl_touch_set_calibration(const touch_point_t display[3], const touch_point_t raw[3]) {
+    touch_cal_t cal;
+    if (!touch_cal_solve(display, raw, &cal)) {
+        ESP_LOGE(TAG, "[Touch] Calibration failed: raw points are collinear");
+        return false;
+    }
+    touch_cal = cal;
+    
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open(TOUCH_NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "[Touch] Failed to open NVS: %s", esp_err_to_name(err));
+        return false;
+    }
+    err = nvs_set_blob(handle, TOUCH_NVS_KEY_CAL, &cal, sizeof(cal));
+    if (err == ESP_OK) {
+        err = nvs_commit(handle);
+    }
+    nvs_close(handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "[Touch] Failed to save calibration: %s", esp_err_to_name(err));
+        return false;
+    }
+    
+    ESP_LOGI(TAG, "[Touch] Calibration saved: x = (%ld*rx + %ld*ry + %ld) >> %d, y = (%ld*rx + %ld*ry + %ld) >> %d",
+             (long)cal.a, (long)cal.b, (long)cal.c, TOUCH_CAL_SHIFT,
+             (long)cal.d, (long)cal.e, (long)cal.f, TOUCH_CAL_SHIFT);
+    return true;
+}
+
+void lvgl_touch_reset_calibration() {
+    touch_cal_set_default();
+    
+    nvs_handle_t handle;
+    if (nvs_open(TOUCH_NVS_NAMESPACE, NVS_READWRITE, &handle) == ESP_OK) {
+        nvs_erase_key(handle, TOUCH_NVS_KEY_CAL);
+        nvs_commit(handle);
+        nvs_close(handle);
+    }
+    ESP_LOGI(TAG, "[Touch] Calibration reset to defaults");
+}
@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Flow Calibration Implementation
+ * 
+ * The calibration pour is an ordinary pour session at zero price, so the
+ * valve, screens and pour log behave as for a paid pour; the flow meter
+ * counts the pulses and flowing time separately from the session's volume.
+ */
+
+// Project headers
+#include "config.h"
+#include "flow/flow_calibration.h"
+#include "flow/flow_meter.h"
+#include "flow/k_factor.h"
+#include "flow/pour_session.h"
+#include "system/config_store.h"
+
+// System/Standard library headers
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+// ESP-IDF framework headers
+#include <esp_log.h>
+#include <esp_timer.h>
+#define TAG "flow_cal"
+
+#define CAL_DEFAULT_MAX_ML 1000
+#define CAL_MAX_ML 100000  // Same limit as a paid command
+
+static bool tap_pouring(uint8_t tap) {
+    pour_session_info_t info;
+    pour_session_get(tap, &info);
+    return info.state >= POUR_SESSION_ARMED && info.state <= POUR_SESSION_SETTLED;
+}
+
+// Add a point from the captured pour, returns an error string or NULL
+static const char* finish(uint8_t tap, int ml, JsonDocument& doc) {
+    if (ml <= 0 || ml > CAL_MAX_ML) {
+        return "invalid ml";
+    }
+    if (tap_pouring(tap)) {
+        return "still pouring";  // Wait for the flow to stop before measuring
+    }
+    uint64_t pulses = 0;
+    uint64_t flow_ms = 0;
+    if (!flow_meter_calibration_end(tap, &pulses, &flow_ms)) {
+        return "not started";
+    }
+    doc["pulses"] = pulses;
+    doc["flow_ms"] = flow_ms;
+    if (pulses < FLOW_CALIBRATION_MIN_PULSES || flow_ms == 0) {
+        return "pour too short";
+    }
+    
+    uint32_t freq_dhz = k_factor_freq_dhz(pulses, flow_ms);
+    uint32_t k = k_factor_from_volume(pulses, (uint32_t)ml);
+    doc["freq_hz"] = (float)freq_dhz / 10.0f;
+    doc["k"] = k;
+    
+    k_factor_table_t table;
+    flow_meter_get_k_table(tap, &table);
+    if (!k_factor_insert(&table, freq_dhz, k)) {
+        return "K out of range";
+    }
+    flow_meter_set_k_table(tap, &table);
+    config_store_set_k_factor(tap, &table);
+    ESP_LOGI(TAG, "[Calibration] Tap %u: %" PRIu64 " pulses for %d ml at %" PRIu32 ".%" PRIu32 " Hz -> K %" PRIu32,
+             (unsigned)tap, pulses, ml, freq_dhz / 10, freq_dhz % 10, k);
+    return NULL;
+}
+
+size_t flow_calibration_command(JsonObjectConst cmd, char* reply, size_t size) {
+    const char* action = cmd["action"] | "";
+    int tap = cmd["tap"] | 0;
+    
+    JsonDocument doc;
+    doc["action"] = action;
+    doc["tap"] = tap;
+    const char* error = NULL;
+    
+    if (tap < 0 || tap >= FLOW_TAP_COUNT) {
+        error = "invalid tap";
+    } else if (strcmp(action, "start") == 0) {
+        int max_ml = cmd["max_ml"] | CAL_DEFAULT_MAX_ML;
+        if (max_ml <= 0 || max_ml > CAL_MAX_ML) {
+            error = "invalid max_ml";
+        } else if (tap_pouring((uint8_t)tap)) {
+            error = "tap busy";
+        } else {
+            char id[32];
+            snprintf(id, sizeof(id), "calibration-%" PRId64, (int64_t)(esp_timer_get_time() / 1000000LL));
+            flow_meter_calibration_begin((uint8_t)tap);
+            pour_session_start((uint8_t)tap, id, 0.0f, max_ml, NULL);
+            ESP_LOGI(TAG, "[Calibration] Tap %d: calibration pour started (max %d ml)", tap, max_ml);
+        }
+    } else if (strcmp(action, "finish") == 0) {
+        error = finish((uint8_t)tap, cmd["ml"] | 0, doc);
+    } else if (strcmp(action, "cancel") == 0) {
+        uint64_t pulses;
+        uint64_t flow_ms;
+        pour_session_stop((uint8_t)tap);
+        flow_meter_calibration_end((uint8_t)tap, &pulses, &flow_ms);
+    } else if (strcmp(action, "clear") == 0) {
+        k_factor_table_t table = {};
+        flow_meter_set_k_table((uint8_t)tap, &table);
+        config_store_set_k_factor((uint8_t)tap, &table);
+        ESP_LOGI(TAG, "[Calibration] Tap %d: curve cleared, flat calibration", tap);
+    } else if (strcmp(action, "get") != 0) {
+        error = "unknown action";
+    }
+    
+    doc["ok"] = (error == NULL);
+    if (error != NULL) {
+        doc["error"] = error;
+        ESP_LOGW(TAG, "[Calibration] Tap %d %s: %s", tap, action, error);
+    }
+    if (tap >= 0 && tap < FLOW_TAP_COUNT) {
+        k_factor_table_t table;
+        flow_meter_get_k_table((uint8_t)tap, &table);
+        JsonArray curve = doc["curve"].to<JsonArray>();
+        for (uint8_t i = 0; i < table.count; i++) {
+            JsonObject point = curve.add<JsonObject>();
+            point["hz"] = (float)table.points[i].freq_dhz / 10.0f;
+            point["k"] = table.points[i].pulses_per_liter;
+        }
+    }
+    if (measureJson(doc) >= size) {
+        return 0;
+    }
+    return serializeJson(doc, reply, size);
+}
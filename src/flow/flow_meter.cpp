@@ -10,66 +10,513 @@
  * Flow Meter Implementation
  * 
  * YF-S201 Hall Effect Flow Sensor reading and calculations
+ * 
+ * Two pulse counting backends (selected in menuconfig):
+ * - PCNT: hardware pulse counter with glitch filter, interrupts only on overflow
+ * - ISR: GPIO interrupt per pulse with 10ms software debounce, registered
+ *   straight with the GPIO ISR service with the tap's meter as its argument
+ * 
+ * Rate and volume are computed by a dedicated sampling task at a fixed period
+ * and published through a seqlock, so readers never block and never see a
+ * half-written {pulses, rate, volume, timestamp} set.
+ * 
+ * A small ring of pulse timestamps gives a fast (~100ms) rate estimate and an
+ * EWMA-smoothed rate alongside the 1 second window rate.
+ * 
+ * Every tap is one flow_meter_t instance (own counter, PCNT unit or GPIO ISR,
+ * pulse ring, rate estimator, cut-off and calibration). The sampling task
+ * steps all of them in turn, so extra taps cost no extra task.
+ * 
+ * With a K-factor curve (flow/k_factor.h) each sampling step looks up K at
+ * the fast-rate frequency and adds that step's pulses to the volume at that
+ * K, in integer nano-litres; without one, volume is pulses / K as before.
+ * 
+ * An edge hook (pulse trace capture) sees every raw edge: from the pulse
+ * interrupt with the ISR backend, from a GPIO interrupt added next to the
+ * counter with PCNT, only while the hook is set.
+ * 
+ * Every sampling step also feeds the tap's new pulses, debounce rejects and
+ * fast rate to the flow analytics (flow/flow_stats.h).
  */
 
 // Project headers
 #include "config.h"
 #include "flow/flow_meter.h"
+#include "flow/flow_rate.h"
+#include "flow/flow_stats.h"
+#include "flow/k_factor.h"
+#include "flow/pour_math.h"
+#include "system/app_events.h"
+#include "system/config_store.h"
+#include "system/perf_monitor.h"
+#include "system/power_manager.h"
+#include "utils/log_with_time.h"
 
 // System/Standard library headers
+#include <atomic>
+
 // ESP-IDF framework headers
 #include <driver/gpio.h>
 #include <esp_log.h>
 #include <esp_timer.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
+#include <freertos/semphr.h>
 #include <freertos/portmacro.h>
+#if FLOW_METER_USE_PCNT
+#include <driver/pulse_cnt.h>
+#endif
 #define TAG "flow_meter"
 
 // Flow meter constants
-#define PULSES_PER_LITER 450        // YF-S201 outputs 450 pulses per liter
-#define PULSES_PER_LPM 7.5          // 450 pulses/L / 60 seconds = 7.5 pulses per L/min per Hz
 #define CALCULATION_INTERVAL_MS 1000  // Calculate flow rate every 1 second
+#define PCNT_HIGH_LIMIT 10000       // Hardware counter wraps (and interrupts) every 10000 pulses (~22L)
+#define FAST_WINDOW_US ((uint32_t)FLOW_RATE_FAST_WINDOW_MS * 1000U)
+#define STOP_TIMEOUT_US ((uint32_t)FLOW_RATE_STOP_TIMEOUT_MS * 1000U)
+#define DEBOUNCE_US 10000U          // ISR backend: ignore edges closer than 10ms (electrical noise)
+#if FLOW_METER_USE_PCNT
+// PCNT has no per-pulse interrupt - ring entries are stamped at sample time
+#define STAMP_RESOLUTION_US ((uint32_t)FLOW_SAMPLING_PERIOD_MS * 1000U)
+#else
+#define STAMP_RESOLUTION_US 0U
+#endif
+
+// One tap's meter
+typedef struct {
+    uint8_t tap;
+    int pin;
+    uint32_t pulses_per_liter;             // Calibration (K-factor), written under sample_mutex
+    k_factor_table_t k_table;              // K-factor curve (count 0 = flat pulses_per_liter), under sample_mutex
+    uint64_t volume_nl;                    // Volume along the curve since last reset (under sample_mutex)
+    
+    // Calibration pour capture (under sample_mutex)
+    bool cal_active;
+    uint64_t cal_pulses;                   // Pulses since flow_meter_calibration_begin()
+    uint64_t cal_flow_us;                  // Time with flow in that period
+    
+#if FLOW_METER_USE_PCNT
+    volatile uint64_t pulse_count;         // Overflow accumulator (interrupt-safe)
+#else
+    volatile uint32_t pulse_count;         // Pulses since reset, aligned 32-bit so readers need no lock
+#endif
+    uint64_t last_pulse_count;             // Pulse count at last calculation
+    uint64_t last_calculation_time;        // Last time we calculated flow rate
+    float current_flow_rate_lpm;           // Current flow rate in L/min
+    volatile uint32_t last_pulse_us;       // Time of last pulse (low 32 bits of esp_timer, wraps safely)
+    volatile uint32_t noise_edges;         // ISR backend: edges dropped by the debounce (wraps)
+    uint32_t last_noise_edges;             // noise_edges at the previous sampling step
+    float flow_rate_fast_lpm;              // Instantaneous rate from pulse timestamps
+    float pulse_rate_fast_hz;              // Pulse frequency behind flow_rate_fast_lpm
+    float flow_rate_smoothed_lpm;          // EWMA of the fast rate
+    uint64_t last_sample_time_us;          // Previous sampling step (for EWMA weight)
+    
+    // Pulse timestamp ring (protected by mux, see flow/flow_rate.h)
+    pulse_stamp_t pulse_ring[FLOW_PULSE_RING_SIZE];
+    uint32_t pulse_ring_head;              // Total entries written; slot = head & FLOW_PULSE_RING_MASK
+    
+    // Lock for pulse_count, the ring and the cut-off - shared by the ISR and tasks
+    portMUX_TYPE mux;
+    
+    // Cut-off hook: callback fires from the counting path once pulse_count reaches cutoff_pulses
+    uint64_t cutoff_pulses;                // 0 = disarmed (protected by mux)
+    flow_meter_cutoff_cb_t cutoff_cb;
+    
+    volatile flow_meter_edge_cb_t edge_cb; // Raw edge hook, NULL when not tracing
+    
+    // Published snapshot (seqlock: odd sequence = write in progress)
+    flow_meter_snapshot_t snapshot;
+    std::atomic<uint32_t> snapshot_seq;
+
+#if FLOW_METER_USE_PCNT
+    pcnt_unit_handle_t pcnt_unit;
+    pcnt_channel_handle_t pcnt_chan;
+    uint64_t last_read_count;              // Last read_pulse_count() result (under sample_mutex)
+    int cutoff_watch_point;                // Hardware watch point currently armed for the cut-off (0 = none)
+#endif
+} flow_meter_t;
+
+static flow_meter_t meters[FLOW_TAP_COUNT];
+
+static const int tap_pins[4] = {FLOW_METER_PIN, FLOW_METER_PIN_2, FLOW_METER_PIN_3, FLOW_METER_PIN_4};
+static_assert(FLOW_TAP_COUNT >= 1 && FLOW_TAP_COUNT <= 4, "FLOW_TAP_COUNT must be 1 to 4");
+
+static flow_meter_sample_cb_t sample_cb = NULL;
+
+// Serialises snapshot writers (sampling step, volume reset, calibration) across all taps
+static SemaphoreHandle_t sample_mutex = NULL;
+static TaskHandle_t sampling_task_handle = NULL;
+
+static inline flow_meter_t* meter_for(uint8_t tap) {
+    return tap < FLOW_TAP_COUNT ? &meters[tap] : NULL;
+}
+
+// Disarm and return the cut-off callback if the count has reached it (caller holds m->mux)
+static inline flow_meter_cutoff_cb_t IRAM_ATTR take_cutoff(flow_meter_t* m, uint64_t count) {
+    if (m->cutoff_pulses == 0 || count < m->cutoff_pulses) {
+        return NULL;
+    }
+    m->cutoff_pulses = 0;
+    return m->cutoff_cb;
+}
+
+// Run the cut-off callback and record how long after the limit pulse it ran (pulse_us: low 32 bits of esp_timer)
+static inline void IRAM_ATTR fire_cutoff(flow_meter_t* m, flow_meter_cutoff_cb_t cb, uint64_t count, uint32_t pulse_us) {
+    cb(m->tap, count);
+    perf_monitor_record(PERF_CUTOFF_US, (uint32_t)esp_timer_get_time() - pulse_us);
+}
+
+// Record a pulse timestamp (caller holds m->mux)
+static inline void IRAM_ATTR pulse_ring_push(flow_meter_t* m, uint32_t time_us, uint32_t count) {
+    m->pulse_ring[m->pulse_ring_head & FLOW_PULSE_RING_MASK].time_us = time_us;
+    m->pulse_ring[m->pulse_ring_head & FLOW_PULSE_RING_MASK].count = count;
+    m->pulse_ring_head++;
+}
+
+#if FLOW_METER_USE_PCNT
+// PCNT watch point callback - the only interrupt in PCNT mode
+// - Limit watch point (once per PCNT_HIGH_LIMIT pulses): hardware counter resets to 0, fold it into pulse_count
+// - Cut-off watch point: fire the cut-off callback with the exact count
+static bool IRAM_ATTR flow_meter_pcnt_on_reach(pcnt_unit_handle_t unit, const pcnt_watch_event_data_t* edata, void* user_ctx) {
+    (void)unit;
+    flow_meter_t* m = (flow_meter_t*)user_ctx;
+    uint32_t now_us = (uint32_t)esp_timer_get_time();
+    flow_meter_cutoff_cb_t cb = NULL;
+    uint64_t count;
+    portENTER_CRITICAL_ISR(&m->mux);
+    if (edata->watch_point_value == PCNT_HIGH_LIMIT) {
+        m->pulse_count += edata->watch_point_value;
+        count = m->pulse_count;
+    } else {
+        count = m->pulse_count + (uint64_t)edata->watch_point_value;
+    }
+    cb = take_cutoff(m, count);
+    portEXIT_CRITICAL_ISR(&m->mux);
+    if (cb != NULL) {
+        fire_cutoff(m, cb, count, now_us);
+    }
+    return false;  // No task woken
+}
+
+// Read total pulses = overflow accumulator + live hardware count (caller holds sample_mutex)
+// Retry if an overflow lands between the two reads. The hardware clears itself at the
+// limit before the watch point interrupt (possibly on the other core) folds it into
+// pulse_count, so a total below the last one means that fold is still pending
+static uint64_t read_pulse_count(flow_meter_t* m) {
+    uint64_t base_before;
+    uint64_t base_after;
+    int hw_count = 0;
+    do {
+        portENTER_CRITICAL(&m->mux);
+        base_before = m->pulse_count;
+        portEXIT_CRITICAL(&m->mux);
+        pcnt_unit_get_count(m->pcnt_unit, &hw_count);
+        portENTER_CRITICAL(&m->mux);
+        base_after = m->pulse_count;
+        portEXIT_CRITICAL(&m->mux);
+    } while (base_before != base_after);
+    uint64_t count = base_after + (uint64_t)hw_count;
+    if (count < m->last_read_count) {
+        count += PCNT_HIGH_LIMIT;
+    }
+    m->last_read_count = count;
+    return count;
+}
+
+static bool flow_meter_pcnt_init(flow_meter_t* m, bool is_input_only) {
+    pcnt_unit_config_t unit_config = {};
+    unit_config.high_limit = PCNT_HIGH_LIMIT;
+    unit_config.low_limit = -1;  // Driver requires a negative low limit; we only count up
+    esp_err_t ret = pcnt_new_unit(&unit_config, &m->pcnt_unit);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "[Flow Meter] Tap %d: failed to create PCNT unit: %s", m->tap, esp_err_to_name(ret));
+        m->pcnt_unit = NULL;
+        return false;
+    }
+    
+    if (FLOW_METER_GLITCH_FILTER_NS > 0) {
+        pcnt_glitch_filter_config_t filter_config = {};
+        filter_config.max_glitch_ns = FLOW_METER_GLITCH_FILTER_NS;
+        ret = pcnt_unit_set_glitch_filter(m->pcnt_unit, &filter_config);
+        if (ret != ESP_OK) {
+            ESP_LOGW(TAG, "[Flow Meter] Glitch filter not set (%d ns): %s", FLOW_METER_GLITCH_FILTER_NS, esp_err_to_name(ret));
+        }
+    }
+    
+    pcnt_chan_config_t chan_config = {};
+    chan_config.edge_gpio_num = m->pin;
+    chan_config.level_gpio_num = -1;
+    ret = pcnt_new_channel(m->pcnt_unit, &chan_config, &m->pcnt_chan);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "[Flow Meter] Tap %d: failed to create PCNT channel: %s", m->tap, esp_err_to_name(ret));
+        return false;
+    }
+    // Count RISING edges only (same as the ISR backend)
+    pcnt_channel_set_edge_action(m->pcnt_chan, PCNT_CHANNEL_EDGE_ACTION_INCREASE, PCNT_CHANNEL_EDGE_ACTION_HOLD);
+    
+    // PCNT driver routes the pin itself - re-apply our pull configuration afterwards
+    gpio_set_pull_mode((gpio_num_t)m->pin, is_input_only ? GPIO_FLOATING : GPIO_PULLUP_ONLY);
+    
+    pcnt_unit_add_watch_point(m->pcnt_unit, PCNT_HIGH_LIMIT);
+    pcnt_event_callbacks_t cbs = {};
+    cbs.on_reach = flow_meter_pcnt_on_reach;
+    pcnt_unit_register_event_callbacks(m->pcnt_unit, &cbs, m);
+    
+    pcnt_unit_enable(m->pcnt_unit);
+    pcnt_unit_clear_count(m->pcnt_unit);
+    ret = pcnt_unit_start(m->pcnt_unit);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "[Flow Meter] Tap %d: failed to start PCNT unit: %s", m->tap, esp_err_to_name(ret));
+        return false;
+    }
+    return true;
+}
 
-// Flow meter variables
-static volatile uint64_t pulse_count = 0;  // Total pulse count (interrupt-safe)
-static uint64_t last_pulse_count = 0;     // Pulse count at last calculation
-static uint64_t last_calculation_time = 0; // Last time we calculated flow rate
-static float current_flow_rate_lpm = 0.0;      // Current flow rate in L/min
-static float total_volume_liters = 0.0;        // Total volume in liters
-static volatile uint64_t last_pulse_time = 0;       // Time of last pulse (for debouncing)
+// Place the hardware watch point for the cut-off relative to the current overflow base
+// Called from task context with sample_mutex held; re-run after every overflow
+static void pcnt_arm_cutoff(flow_meter_t* m) {
+    if (m->pcnt_unit == NULL) {
+        return;
+    }
+    portENTER_CRITICAL(&m->mux);
+    uint64_t target = m->cutoff_pulses;
+    uint64_t base = m->pulse_count;
+    portEXIT_CRITICAL(&m->mux);
+    
+    int wanted = 0;
+    if (target > base && target - base < PCNT_HIGH_LIMIT) {
+        wanted = (int)(target - base);
+    }
+    if (wanted == m->cutoff_watch_point) {
+        return;
+    }
+    if (m->cutoff_watch_point != 0) {
+        pcnt_unit_remove_watch_point(m->pcnt_unit, m->cutoff_watch_point);
+        m->cutoff_watch_point = 0;
+    }
+    if (wanted != 0 && pcnt_unit_add_watch_point(m->pcnt_unit, wanted) == ESP_OK) {
+        m->cutoff_watch_point = wanted;
+    }
+}
+#else
+// Single aligned 32-bit load - atomic against the ISR's locked increment
+static uint64_t read_pulse_count(flow_meter_t* m) {
+    return m->pulse_count;
+}
+#endif
 
-// Interrupt service routine - called on each pulse from flow meter
-void IRAM_ATTR flow_meter_isr(void* arg) {
-    uint64_t current_time = esp_timer_get_time() / 1000ULL;
+#if !FLOW_METER_USE_PCNT
+// Interrupt service routine - called on each pulse, arg is the tap's meter
+// 32-bit time and count only: no 64-bit divide or read-modify-write per edge
+static void IRAM_ATTR flow_meter_isr(void* arg) {
+    flow_meter_t* m = (flow_meter_t*)arg;
+    uint32_t now_us = (uint32_t)esp_timer_get_time();
+    flow_meter_edge_cb_t edge_cb = m->edge_cb;
+    if (edge_cb != NULL) {
+        edge_cb(m->tap, now_us);
+    }
     
     // Debounce: ignore pulses that come too quickly (< 10ms apart)
     // This prevents false readings from electrical noise
-    uint64_t last_pulse = last_pulse_time;
-    if (current_time - last_pulse > 10) {
-        // Use atomic increment to avoid volatile increment warning
-        uint64_t temp = pulse_count;
-        temp++;
-        pulse_count = temp;
-        last_pulse_time = current_time;
+    if (now_us - m->last_pulse_us <= DEBOUNCE_US) {
+        m->noise_edges = m->noise_edges + 1;  // Only this ISR writes it
+        return;
+    }
+    m->last_pulse_us = now_us;
+    portENTER_CRITICAL_ISR(&m->mux);
+    uint32_t count = m->pulse_count + 1;
+    m->pulse_count = count;
+    pulse_ring_push(m, now_us, count);
+    flow_meter_cutoff_cb_t cb = take_cutoff(m, count);
+    portEXIT_CRITICAL_ISR(&m->mux);
+    if (cb != NULL) {
+        fire_cutoff(m, cb, count, now_us);
     }
 }
+#endif
 
-// Wrapper function that matches voidFuncPtr signature (void (*)(void))
-// This is called by gpio_isr_handler_wrapper
-static void IRAM_ATTR flow_meter_isr_wrapper_void(void) {
-    flow_meter_isr(NULL);
+#if FLOW_METER_USE_PCNT
+// Edge interrupt for the edge hook only - PCNT keeps counting on its own
+static void IRAM_ATTR flow_meter_edge_isr(void* arg) {
+    flow_meter_t* m = (flow_meter_t*)arg;
+    flow_meter_edge_cb_t edge_cb = m->edge_cb;
+    if (edge_cb != NULL) {
+        edge_cb(m->tap, (uint32_t)esp_timer_get_time());
+    }
 }
+#endif
 
-void flow_meter_init() {
-    ESP_LOGI(TAG, "=== Initializing Flow Meter ===");
+// Publish a new snapshot (caller must hold sample_mutex - single writer)
+static void publish_snapshot(flow_meter_t* m, uint64_t pulses, float rate_lpm, uint64_t timestamp_ms) {
+    m->snapshot_seq.fetch_add(1, std::memory_order_relaxed);  // Odd: write in progress
+    std::atomic_thread_fence(std::memory_order_release);
+    m->snapshot.pulses = pulses;
+    m->snapshot.flow_rate_lpm = rate_lpm;
+    m->snapshot.volume_ul = m->k_table.count > 0 ? m->volume_nl / 1000ULL
+                                                 : pour_pulses_to_ul_k(pulses, m->pulses_per_liter);
+    m->snapshot.total_volume_liters = (float)m->snapshot.volume_ul / 1000000.0f;
+    m->snapshot.timestamp_ms = timestamp_ms;
+    m->snapshot.flow_rate_fast_lpm = m->flow_rate_fast_lpm;
+    m->snapshot.pulse_rate_fast_hz = m->pulse_rate_fast_hz;
+    m->snapshot.flow_rate_smoothed_lpm = m->flow_rate_smoothed_lpm;
+    std::atomic_thread_fence(std::memory_order_release);
+    m->snapshot_seq.fetch_add(1, std::memory_order_relaxed);  // Even: stable
+}
+
+// Estimate pulse frequency from the timestamp ring
+// Uses the newest pulses spanning at least FAST_WINDOW_US, ignoring gaps longer than the stop timeout
+static float estimate_fast_rate_hz(flow_meter_t* m, uint32_t now_us) {
+    portENTER_CRITICAL(&m->mux);
+    flow_rate_span_t span = flow_rate_select_span(m->pulse_ring, m->pulse_ring_head, FAST_WINDOW_US, STOP_TIMEOUT_US);
+    portEXIT_CRITICAL(&m->mux);
+    return flow_rate_span_hz(&span, now_us, STOP_TIMEOUT_US, STAMP_RESOLUTION_US);
+}
+
+// One sampling step for one tap - reads the counter, updates the 1s rate window, publishes
+// Returns true if something a reader would see has changed
+static bool flow_meter_sample(flow_meter_t* m) {
+    xSemaphoreTake(sample_mutex, portMAX_DELAY);
+    
+    // Read under the writer lock so a concurrent reset cannot be overwritten by a stale count
+    uint64_t current_time_us = esp_timer_get_time();
+    uint64_t current_time = current_time_us / 1000ULL;
+    uint64_t current_pulse_count = read_pulse_count(m);
+    uint64_t new_pulses = current_pulse_count > m->snapshot.pulses ? current_pulse_count - m->snapshot.pulses : 0;
+
+#if FLOW_METER_USE_PCNT
+    // No per-pulse interrupt in PCNT mode - track activity from the count instead
+    if (current_pulse_count != m->snapshot.pulses) {
+        m->last_pulse_us = (uint32_t)current_time_us;
+        portENTER_CRITICAL(&m->mux);
+        pulse_ring_push(m, (uint32_t)current_time_us, (uint32_t)current_pulse_count);
+        portEXIT_CRITICAL(&m->mux);
+    }
+    // Overflow moves the base - keep the cut-off watch point in the current window
+    pcnt_arm_cutoff(m);
+#endif
+
+    // Backstop for the cut-off (e.g. target already passed when it was armed)
+    portENTER_CRITICAL(&m->mux);
+    flow_meter_cutoff_cb_t pending_cb = take_cutoff(m, current_pulse_count);
+    portEXIT_CRITICAL(&m->mux);
+    if (pending_cb != NULL) {
+#if FLOW_METER_USE_PCNT
+        // The limit pulse came some time after the previous step (an upper bound on the lag)
+        fire_cutoff(m, pending_cb, current_pulse_count, (uint32_t)m->last_sample_time_us);
+#else
+        fire_cutoff(m, pending_cb, current_pulse_count, m->last_pulse_us);
+#endif
+    }
+    
+    // K for this step from the fast-rate frequency (the flat calibration without a curve)
+    float fast_hz = estimate_fast_rate_hz(m, (uint32_t)current_time_us);
+    uint32_t k = k_factor_lookup(&m->k_table, (uint32_t)(fast_hz * 10.0f + 0.5f), m->pulses_per_liter);
+    if (m->k_table.count > 0) {
+        m->volume_nl += k_factor_volume_nl(new_pulses, k);
+    }
+    if (m->cal_active) {
+        m->cal_pulses += new_pulses;
+        if (fast_hz > 0.0f) {
+            m->cal_flow_us += current_time_us - m->last_sample_time_us;
+        }
+    }
+    
+    // Fast rate from pulse timestamps, plus EWMA weighted by the actual sample spacing
+    // Pulses per L/min: frequency (Hz) = rate (L/min) * K / 60
+    m->pulse_rate_fast_hz = fast_hz;
+    m->flow_rate_fast_lpm = fast_hz * 60.0f / (float)k;
+    float dt_ms = (float)(current_time_us - m->last_sample_time_us) / 1000.0f;
+    float alpha = dt_ms / ((float)FLOW_RATE_EWMA_TAU_MS + dt_ms);
+    m->flow_rate_smoothed_lpm += alpha * (m->flow_rate_fast_lpm - m->flow_rate_smoothed_lpm);
+    if (m->flow_rate_fast_lpm == 0.0f && m->flow_rate_smoothed_lpm < 0.01f) {
+        m->flow_rate_smoothed_lpm = 0.0f;
+    }
+    m->last_sample_time_us = current_time_us;
+    
+    // Calculate flow rate every second
+    uint64_t elapsed_ms = current_time - m->last_calculation_time;
+    if (elapsed_ms >= CALCULATION_INTERVAL_MS) {
+        // Calculate pulses in the last window
+        uint64_t pulses_in_interval = current_pulse_count - m->last_pulse_count;
+        
+        // Calculate flow rate: Frequency (Hz) = pulses per second
+        // Flow Rate (L/min) = Frequency (Hz) / (K / 60), 7.5 for the YF-S201
+        // Use the measured window length so a late sample does not skew the rate
+        float frequency_hz = (float)pulses_in_interval * 1000.0f / (float)elapsed_ms;
+        uint32_t window_k = k_factor_lookup(&m->k_table, k_factor_freq_dhz(pulses_in_interval, elapsed_ms),
+                                            m->pulses_per_liter);
+        m->current_flow_rate_lpm = frequency_hz * 60.0f / (float)window_k;
+        
+        // Update for next calculation
+        m->last_pulse_count = current_pulse_count;
+        m->last_calculation_time = current_time;
+        
+        // Debug output (can be removed or made conditional)
+        if (m->current_flow_rate_lpm > 0.1) {  // Only print if there's significant flow
+            ESP_LOGI_HOT(TAG, "Tap %d flow: %.2f L/min, Total: %.3f L, Pulses: %llu", m->tap,
+                     m->current_flow_rate_lpm, (float)current_pulse_count / (float)m->pulses_per_liter,
+                     (unsigned long long)current_pulse_count);
+        }
+    }
     
+    // No pulse within the stop timeout - flow has stopped, don't wait for the next 1s window
+    if ((uint32_t)current_time_us - m->last_pulse_us > STOP_TIMEOUT_US && m->current_flow_rate_lpm > 0) {
+        m->current_flow_rate_lpm = 0.0;
+    }
+    
+    // Only wake the main loop when something a reader would see has changed
+    bool pulses_changed = current_pulse_count != m->snapshot.pulses;
+    bool changed = pulses_changed ||
+                   m->current_flow_rate_lpm != m->snapshot.flow_rate_lpm ||
+                   m->flow_rate_fast_lpm != m->snapshot.flow_rate_fast_lpm ||
+                   m->pulse_rate_fast_hz != m->snapshot.pulse_rate_fast_hz ||
+                   m->flow_rate_smoothed_lpm != m->snapshot.flow_rate_smoothed_lpm;
+    
+    publish_snapshot(m, current_pulse_count, m->current_flow_rate_lpm, current_time);
+    
+    xSemaphoreGive(sample_mutex);
+    
+    uint32_t noise_edges = m->noise_edges;
+    flow_stats_sample(m->tap, (uint32_t)new_pulses, noise_edges - m->last_noise_edges, m->flow_rate_fast_lpm,
+                      (uint32_t)(dt_ms + 0.5f));
+    m->last_noise_edges = noise_edges;
+    
+    flow_meter_sample_cb_t cb = sample_cb;
+    if (pulses_changed && cb != NULL) {
+        cb(m->tap, current_pulse_count, current_time);
+    }
+    return changed;
+}
+
+// Step every tap, one event for the lot
+static void flow_meter_sample_all() {
+    bool changed = false;
+    for (int tap = 0; tap < FLOW_TAP_COUNT; tap++) {
+        changed |= flow_meter_sample(&meters[tap]);
+    }
+    if (changed) {
+        app_events_post(APP_EVENT_FLOW);
+    }
+}
+
+// Flow sampling task - runs at a fixed period independent of the UI/MQTT loop
+static void flow_sampling_task(void* arg) {
+    (void)arg;
+    TickType_t last_wake = xTaskGetTickCount();
+    const TickType_t period = pdMS_TO_TICKS(FLOW_SAMPLING_PERIOD_MS) > 0 ? pdMS_TO_TICKS(FLOW_SAMPLING_PERIOD_MS) : 1;
+    while (true) {
+        flow_meter_sample_all();
+        vTaskDelayUntil(&last_wake, period);
+    }
+}
+
+// Configure one tap's pin and counting backend, returns true if it is counting
+static bool flow_meter_init_tap(flow_meter_t* m) {
     // Configure flow meter pin as input with pull-up
     // Check if pin is input-only (GPIO34, GPIO35, GPIO36, GPIO39 on ESP32)
-    bool is_input_only = (FLOW_METER_PIN == 34 || FLOW_METER_PIN == 35 || FLOW_METER_PIN == 36 || FLOW_METER_PIN == 39);
+    bool is_input_only = (m->pin == 34 || m->pin == 35 || m->pin == 36 || m->pin == 39);
     
     gpio_config_t io_conf = {};
-    io_conf.pin_bit_mask = (1ULL << FLOW_METER_PIN);
+    io_conf.pin_bit_mask = (1ULL << m->pin);
     io_conf.mode = GPIO_MODE_INPUT;
     if (is_input_only) {
         io_conf.pull_up_en = GPIO_PULLUP_DISABLE;
@@ -78,98 +525,323 @@ void flow_meter_init() {
         io_conf.pull_up_en = GPIO_PULLUP_ENABLE;
         io_conf.pull_down_en = GPIO_PULLDOWN_DISABLE;
     }
-    io_conf.intr_type = GPIO_INTR_POSEDGE;  // RISING edge
+#if FLOW_METER_USE_PCNT
+    io_conf.intr_type = GPIO_INTR_DISABLE;  // Counted by PCNT, no GPIO interrupt
     gpio_config(&io_conf);
     
-    // Store handler in gpio_isr_handlers for the wrapper to call
-    extern gpio_isr_handler_t gpio_isr_handlers[];
-    extern void IRAM_ATTR gpio_isr_handler_wrapper(void* arg);
-    
-    // Store the wrapper in gpio_isr_handlers so gpio_isr_handler_wrapper can call it
-    if (FLOW_METER_PIN < GPIO_NUM_MAX) {
-        gpio_isr_handlers[FLOW_METER_PIN].pin = (gpio_num_t)FLOW_METER_PIN;
-        gpio_isr_handlers[FLOW_METER_PIN].func = flow_meter_isr_wrapper_void;
-        gpio_isr_handlers[FLOW_METER_PIN].type = GPIO_INTR_POSEDGE;
+    if (!flow_meter_pcnt_init(m, is_input_only)) {
+        ESP_LOGE(TAG, "[Flow Meter] Tap %d: PCNT backend failed - flow will not be measured", m->tap);
+        return false;
     }
+    ESP_LOGI(TAG, "Tap %d flow meter on pin %d (PCNT, glitch filter %d ns)", m->tap, m->pin, FLOW_METER_GLITCH_FILTER_NS);
+    return true;
+#else
+    io_conf.intr_type = GPIO_INTR_POSEDGE;  // RISING edge
+    gpio_config(&io_conf);
     
-    // Add ISR handler - use the wrapper function
-    gpio_isr_handler_add((gpio_num_t)FLOW_METER_PIN, gpio_isr_handler_wrapper, (void*)(intptr_t)FLOW_METER_PIN);
-    
-    // Initialize variables
-    pulse_count = 0;
-    last_pulse_count = 0;
-    last_calculation_time = esp_timer_get_time() / 1000ULL;
-    current_flow_rate_lpm = 0.0;
-    total_volume_liters = 0.0;
-    
-    ESP_LOGI(TAG, "Flow meter initialized on pin %d", FLOW_METER_PIN);
-    ESP_LOGI(TAG, "Flow meter ready - waiting for flow...");
+    // The GPIO ISR service calls flow_meter_isr with this tap's meter
+    esp_err_t ret = gpio_isr_handler_add((gpio_num_t)m->pin, flow_meter_isr, m);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "[Flow Meter] Tap %d: failed to add GPIO ISR: %s", m->tap, esp_err_to_name(ret));
+        return false;
+    }
+    ESP_LOGI(TAG, "Tap %d flow meter on pin %d (GPIO interrupt)", m->tap, m->pin);
+    return true;
+#endif
 }
 
-void flow_meter_update() {
-    uint64_t current_time = esp_timer_get_time() / 1000ULL;
+void flow_meter_init() {
+    ESP_LOGI(TAG, "=== Initializing Flow Meter (%d tap%s) ===", FLOW_TAP_COUNT, FLOW_TAP_COUNT > 1 ? "s" : "");
     
-    // Calculate flow rate every second
-    if (current_time - last_calculation_time >= CALCULATION_INTERVAL_MS) {
-        // Disable interrupts briefly to safely read pulse_count
-        portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
-        portENTER_CRITICAL(&mux);
-        uint64_t current_pulse_count = pulse_count;
-        portEXIT_CRITICAL(&mux);
+    sample_mutex = xSemaphoreCreateMutex();
+    uint64_t now_us = esp_timer_get_time();
+    bool counting = false;
+    for (int tap = 0; tap < FLOW_TAP_COUNT; tap++) {
+        flow_meter_t* m = &meters[tap];
         
-        // Calculate pulses in the last second
-        uint64_t pulses_in_interval = current_pulse_count - last_pulse_count;
+        // Initialize variables (before the counting backend can interrupt)
+        portMUX_INITIALIZE(&m->mux);
+        m->tap = (uint8_t)tap;
+        m->pin = tap_pins[tap];
+        m->pulses_per_liter = POUR_PULSES_PER_LITER;
+        config_store_get_k_factor((uint8_t)tap, &m->k_table);
+        m->volume_nl = 0;
+        m->pulse_count = 0;
+        m->last_pulse_count = 0;
+        m->last_sample_time_us = now_us;
+        m->last_calculation_time = now_us / 1000ULL;
+        m->current_flow_rate_lpm = 0.0;
+        m->flow_rate_fast_lpm = 0.0;
+        m->pulse_rate_fast_hz = 0.0;
+        m->flow_rate_smoothed_lpm = 0.0;
         
-        // Calculate flow rate: Frequency (Hz) = pulses per second
-        // Flow Rate (L/min) = Frequency (Hz) / 7.5
-        float frequency_hz = (float)pulses_in_interval;  // Pulses per second
-        current_flow_rate_lpm = frequency_hz / PULSES_PER_LPM;
+        counting |= flow_meter_init_tap(m);
         
-        // Update total volume: add volume that flowed in this interval
-        // Volume (L) = pulses / pulses_per_liter
-        float volume_in_interval = (float)pulses_in_interval / PULSES_PER_LITER;
-        total_volume_liters += volume_in_interval;
-        
-        // Update for next calculation
-        last_pulse_count = current_pulse_count;
-        last_calculation_time = current_time;
-        
-        // Debug output (can be removed or made conditional)
-        if (current_flow_rate_lpm > 0.1) {  // Only print if there's significant flow
-            ESP_LOGI(TAG, "Flow: %.2f L/min, Total: %.3f L, Pulses: %llu",
-                     current_flow_rate_lpm, total_volume_liters, (unsigned long long)current_pulse_count);
+        xSemaphoreTake(sample_mutex, portMAX_DELAY);
+        publish_snapshot(m, 0, 0.0f, m->last_calculation_time);
+        xSemaphoreGive(sample_mutex);
+        if (m->k_table.count > 0) {
+            ESP_LOGI(TAG, "Tap %d K-factor curve: %u points", tap, (unsigned)m->k_table.count);
         }
     }
     
-    // If no pulses for 2 seconds, assume flow has stopped
-    uint64_t last_pulse = last_pulse_time;
-    if (current_time - last_pulse > 2000 && current_flow_rate_lpm > 0) {
-        current_flow_rate_lpm = 0.0;
+    // Idle and leak pulses must be counted too, not only those during a pour
+    power_manager_hold(POWER_HOLD_FLOW, counting);
+
+#if FLOW_SAMPLING_TASK_ENABLED
+    BaseType_t ret = xTaskCreatePinnedToCore(
+        flow_sampling_task,
+        "flow_sample",
+        FLOW_SAMPLING_TASK_STACK_SIZE,
+        NULL,
+        FLOW_SAMPLING_TASK_PRIORITY,
+        &sampling_task_handle,
+        FLOW_SAMPLING_TASK_CORE
+    );
+    if (ret != pdPASS) {
+        sampling_task_handle = NULL;
+        ESP_LOGE(TAG, "[Flow Meter] Failed to create sampling task - falling back to flow_meter_update()");
+    } else {
+        ESP_LOGI(TAG, "Flow sampling task started (core %d, %d ms period)", FLOW_SAMPLING_TASK_CORE, FLOW_SAMPLING_PERIOD_MS);
     }
+#endif
+    ESP_LOGI(TAG, "Flow meter ready - waiting for flow...");
 }
 
-float flow_meter_get_flow_rate_lpm() {
-    return current_flow_rate_lpm;
+void flow_meter_update() {
+    // Sampling task owns the calculation when it is running
+    if (sampling_task_handle != NULL || sample_mutex == NULL) {
+        return;
+    }
+    flow_meter_sample_all();
 }
 
-float flow_meter_get_total_volume_liters() {
-    return total_volume_liters;
+void flow_meter_get_snapshot(uint8_t tap, flow_meter_snapshot_t* out) {
+    if (out == NULL) {
+        return;
+    }
+    flow_meter_t* m = meter_for(tap);
+    if (m == NULL) {
+        *out = flow_meter_snapshot_t();
+        return;
+    }
+    uint32_t seq_before;
+    uint32_t seq_after;
+    do {
+        seq_before = m->snapshot_seq.load(std::memory_order_acquire);
+        *out = m->snapshot;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        seq_after = m->snapshot_seq.load(std::memory_order_relaxed);
+    } while ((seq_before & 1) || seq_before != seq_after);
+    out->sequence = seq_before >> 1;
 }
 
-void flow_meter_reset_volume() {
-    portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
-    portENTER_CRITICAL(&mux);
-    pulse_count = 0;
-    portEXIT_CRITICAL(&mux);
-    last_pulse_count = 0;
-    total_volume_liters = 0.0;
-    ESP_LOGI(TAG, "Volume counter reset");
+float flow_meter_get_flow_rate_lpm(uint8_t tap) {
+    flow_meter_snapshot_t snap;
+    flow_meter_get_snapshot(tap, &snap);
+    return snap.flow_rate_lpm;
 }
 
-uint64_t flow_meter_get_pulse_count() {
-    portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
-    portENTER_CRITICAL(&mux);
-    uint64_t count = pulse_count;
-    portEXIT_CRITICAL(&mux);
-    return count;
+float flow_meter_get_flow_rate_fast(uint8_t tap) {
+    flow_meter_snapshot_t snap;
+    flow_meter_get_snapshot(tap, &snap);
+    return snap.flow_rate_fast_lpm;
+}
+
+float flow_meter_get_pulse_rate_fast(uint8_t tap) {
+    flow_meter_snapshot_t snap;
+    flow_meter_get_snapshot(tap, &snap);
+    return snap.pulse_rate_fast_hz;
+}
+
+float flow_meter_get_flow_rate_smoothed(uint8_t tap) {
+    flow_meter_snapshot_t snap;
+    flow_meter_get_snapshot(tap, &snap);
+    return snap.flow_rate_smoothed_lpm;
+}
+
+uint64_t flow_meter_get_total_volume_ul(uint8_t tap) {
+    flow_meter_snapshot_t snap;
+    flow_meter_get_snapshot(tap, &snap);
+    return snap.volume_ul;
+}
+
+float flow_meter_get_total_volume_liters(uint8_t tap) {
+    flow_meter_snapshot_t snap;
+    flow_meter_get_snapshot(tap, &snap);
+    return snap.total_volume_liters;
+}
+
+void flow_meter_reset_volume(uint8_t tap) {
+    flow_meter_t* m = meter_for(tap);
+    if (sample_mutex == NULL || m == NULL) {
+        return;
+    }
+    // Hold the writer lock so the sampling task cannot publish a stale count after the reset
+    xSemaphoreTake(sample_mutex, portMAX_DELAY);
+#if FLOW_METER_USE_PCNT
+    if (m->pcnt_unit) {
+        pcnt_unit_clear_count(m->pcnt_unit);
+    }
+#endif
+    portENTER_CRITICAL(&m->mux);
+    m->pulse_count = 0;
+    m->pulse_ring_head = 0;  // Old stamps refer to the previous count base
+    m->cutoff_pulses = 0;    // Any armed cut-off referred to the old count
+    portEXIT_CRITICAL(&m->mux);
+#if FLOW_METER_USE_PCNT
+    m->last_read_count = 0;
+    pcnt_arm_cutoff(m);
+#endif
+    m->last_pulse_count = 0;
+    m->volume_nl = 0;
+    publish_snapshot(m, 0, m->current_flow_rate_lpm, esp_timer_get_time() / 1000ULL);
+    xSemaphoreGive(sample_mutex);
+    ESP_LOGI(TAG, "Tap %d volume counter reset", tap);
+}
+
+uint64_t flow_meter_get_pulse_count(uint8_t tap) {
+    flow_meter_snapshot_t snap;
+    flow_meter_get_snapshot(tap, &snap);
+    return snap.pulses;
+}
+
+void flow_meter_set_calibration(uint8_t tap, uint32_t pulses_per_liter) {
+    flow_meter_t* m = meter_for(tap);
+    if (sample_mutex == NULL || m == NULL || pulses_per_liter == 0) {
+        return;
+    }
+    xSemaphoreTake(sample_mutex, portMAX_DELAY);
+    m->pulses_per_liter = pulses_per_liter;
+    xSemaphoreGive(sample_mutex);
+    ESP_LOGI(TAG, "Tap %d calibration: %u pulses/L", tap, (unsigned)pulses_per_liter);
+}
+
+uint32_t flow_meter_get_calibration(uint8_t tap) {
+    flow_meter_t* m = meter_for(tap);
+    return (m != NULL && m->pulses_per_liter != 0) ? m->pulses_per_liter : POUR_PULSES_PER_LITER;
+}
+
+void flow_meter_set_k_table(uint8_t tap, const k_factor_table_t* table) {
+    flow_meter_t* m = meter_for(tap);
+    if (sample_mutex == NULL || m == NULL || !k_factor_valid(table)) {
+        return;
+    }
+    xSemaphoreTake(sample_mutex, portMAX_DELAY);
+    m->k_table = *table;
+    m->volume_nl = m->snapshot.volume_ul * 1000ULL;  // Carry on from the volume shown so far
+    xSemaphoreGive(sample_mutex);
+    ESP_LOGI(TAG, "Tap %d K-factor curve: %u points", tap, (unsigned)table->count);
+}
+
+void flow_meter_get_k_table(uint8_t tap, k_factor_table_t* out) {
+    flow_meter_t* m = meter_for(tap);
+    if (sample_mutex == NULL || m == NULL) {
+        *out = k_factor_table_t();
+        return;
+    }
+    xSemaphoreTake(sample_mutex, portMAX_DELAY);
+    *out = m->k_table;
+    xSemaphoreGive(sample_mutex);
+}
+
+// Smallest and largest K the tap can apply (both the flat calibration without a curve)
+static void k_range(uint8_t tap, uint32_t* min_k, uint32_t* max_k) {
+    k_factor_table_t table;
+    flow_meter_get_k_table(tap, &table);
+    k_factor_range(&table, flow_meter_get_calibration(tap), min_k, max_k);
+}
+
+uint64_t flow_meter_ml_to_pulses(uint8_t tap, uint32_t ml) {
+    // Smallest K on the curve: the pour never goes over ml at any flow rate
+    uint32_t min_k;
+    uint32_t max_k;
+    k_range(tap, &min_k, &max_k);
+    return pour_ml_to_pulses_k(ml, min_k);
+}
+
+uint64_t flow_meter_pulses_to_ul(uint8_t tap, uint64_t pulses) {
+    // Largest K on the curve: a volume rebuilt from a bare count never bills more than was poured
+    uint32_t min_k;
+    uint32_t max_k;
+    k_range(tap, &min_k, &max_k);
+    return pour_pulses_to_ul_k(pulses, max_k);
+}
+
+void flow_meter_calibration_begin(uint8_t tap) {
+    flow_meter_t* m = meter_for(tap);
+    if (sample_mutex == NULL || m == NULL) {
+        return;
+    }
+    xSemaphoreTake(sample_mutex, portMAX_DELAY);
+    m->cal_active = true;
+    m->cal_pulses = 0;
+    m->cal_flow_us = 0;
+    xSemaphoreGive(sample_mutex);
+}
+
+bool flow_meter_calibration_end(uint8_t tap, uint64_t* pulses, uint64_t* flow_ms) {
+    flow_meter_t* m = meter_for(tap);
+    if (sample_mutex == NULL || m == NULL) {
+        return false;
+    }
+    xSemaphoreTake(sample_mutex, portMAX_DELAY);
+    bool was_active = m->cal_active;
+    m->cal_active = false;
+    *pulses = m->cal_pulses;
+    *flow_ms = m->cal_flow_us / 1000ULL;
+    xSemaphoreGive(sample_mutex);
+    return was_active;
+}
+
+void flow_meter_set_sample_callback(flow_meter_sample_cb_t callback) {
+    sample_cb = callback;
+}
+
+void flow_meter_set_cutoff(uint8_t tap, uint64_t pulses, flow_meter_cutoff_cb_t callback) {
+    flow_meter_t* m = meter_for(tap);
+    if (sample_mutex == NULL || m == NULL) {
+        return;
+    }
+    xSemaphoreTake(sample_mutex, portMAX_DELAY);
+    portENTER_CRITICAL(&m->mux);
+    m->cutoff_cb = callback;
+    m->cutoff_pulses = (callback != NULL) ? pulses : 0;
+    portEXIT_CRITICAL(&m->mux);
+#if FLOW_METER_USE_PCNT
+    pcnt_arm_cutoff(m);
+#endif
+    // Already past the threshold - no pulse edge will trigger it, fire now
+    uint64_t count = read_pulse_count(m);
+    portENTER_CRITICAL(&m->mux);
+    flow_meter_cutoff_cb_t cb = take_cutoff(m, count);
+    portEXIT_CRITICAL(&m->mux);
+    xSemaphoreGive(sample_mutex);
+    if (cb != NULL) {
+        cb(tap, count);
+    }
+}
+
+void flow_meter_set_edge_hook(uint8_t tap, flow_meter_edge_cb_t callback) {
+    flow_meter_t* m = meter_for(tap);
+    if (m == NULL) {
+        return;
+    }
+#if FLOW_METER_USE_PCNT
+    bool was_set = m->edge_cb != NULL;
+    m->edge_cb = callback;
+    if (callback != NULL && !was_set) {
+        gpio_set_intr_type((gpio_num_t)m->pin, GPIO_INTR_POSEDGE);
+        esp_err_t ret = gpio_isr_handler_add((gpio_num_t)m->pin, flow_meter_edge_isr, m);
+        if (ret != ESP_OK) {
+            m->edge_cb = NULL;
+            ESP_LOGE(TAG, "[Flow Meter] Tap %d: failed to add edge interrupt: %s", tap, esp_err_to_name(ret));
+        }
+    } else if (callback == NULL && was_set) {
+        gpio_isr_handler_remove((gpio_num_t)m->pin);
+        gpio_set_intr_type((gpio_num_t)m->pin, GPIO_INTR_DISABLE);
+    }
+#else
+    m->edge_cb = callback;  // Picked up by the next pulse interrupt
+#endif
 }
@@ -0,0 +1,202 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Flow Analytics Implementation
+ * 
+ * Two window buffers: the sampling task adds to the active one under
+ * stats_mux, and a due window is closed by switching buffers, so encoding
+ * and publishing run on the main loop without the lock. The closed buffer is
+ * cleared after it has been published, before it can become active again.
+ */
+
+// Project headers
+#include "config.h"
+#include "flow/flow_stats.h"
+
+#if FLOW_STATS_ENABLED
+
+#include "flow/flow_histogram.h"
+#include "mqtt/mqtt_manager.h"
+#include "utils/wire_utils.h"
+
+// System/Standard library headers
+#include <string.h>
+
+// ESP-IDF framework headers
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#define TAG "flow_stats"
+
+#define FLOW_STATS_VERSION 1
+#define WINDOW_HEADER_SIZE (1 + 1 + 2 + 4 + 4 + 1)
+#define TAP_RECORD_MAX (1 + 6 * 10 + 2 * FLOW_HIST_ENCODED_MAX)
+
+// One tap's totals for a window
+typedef struct {
+    uint64_t pulses;
+    uint64_t flow_ms;
+    uint32_t pours;
+    uint32_t idle_pulses;
+    uint32_t anomalies;
+    uint32_t noise_edges;
+    flow_hist_t rate_mlpm;
+    flow_hist_t pour_ms;
+} flow_stats_tap_t;
+
+typedef struct {
+    flow_stats_tap_t taps[FLOW_TAP_COUNT];
+} flow_stats_window_t;
+
+static portMUX_TYPE stats_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// Window buffers - windows[active] is written under stats_mux, the other belongs to the main loop
+static flow_stats_window_t windows[2];
+static uint8_t active = 0;
+
+// Per-tap state (stats_mux)
+static bool pour_open[FLOW_TAP_COUNT];
+static uint64_t pour_start_ms[FLOW_TAP_COUNT];
+static uint64_t last_idle_ms[FLOW_TAP_COUNT];    // Last idle pulse, 0 = none yet
+static uint32_t anomaly_total[FLOW_TAP_COUNT];   // Since boot, for the log
+
+static volatile bool idle_screen = false;
+
+// Main loop only
+static uint32_t anomaly_logged[FLOW_TAP_COUNT];
+static uint64_t window_start_ms = 0;
+static int64_t window_start_epoch = 0;
+static uint16_t window_seq = 0;
+static uint8_t message[WINDOW_HEADER_SIZE + FLOW_TAP_COUNT * TAP_RECORD_MAX];
+
+static uint64_t now_ms() {
+    return (uint64_t)(esp_timer_get_time() / 1000LL);
+}
+
+void flow_stats_sample(uint8_t tap, uint32_t pulses, uint32_t noise_edges, float rate_lpm, uint32_t step_ms) {
+    if (tap >= FLOW_TAP_COUNT || (pulses == 0 && noise_edges == 0 && rate_lpm <= 0.0f)) {
+        return;
+    }
+    uint32_t rate_mlpm = rate_lpm > 0.0f ? (uint32_t)(rate_lpm * 1000.0f + 0.5f) : 0;
+    uint64_t now = pulses > 0 ? now_ms() : 0;
+    
+    portENTER_CRITICAL(&stats_mux);
+    flow_stats_tap_t* t = &windows[active].taps[tap];
+    t->pulses += pulses;
+    t->noise_edges += noise_edges;
+    if (rate_mlpm > 0) {
+        t->flow_ms += step_ms;
+        flow_hist_add(&t->rate_mlpm, rate_mlpm);
+    }
+    if (pulses > 0 && idle_screen && !pour_open[tap]) {
+        t->idle_pulses += pulses;
+        if (last_idle_ms[tap] == 0 || now - last_idle_ms[tap] > FLOW_STATS_ANOMALY_GAP_MS) {
+            t->anomalies++;
+            anomaly_total[tap]++;
+        }
+        last_idle_ms[tap] = now;
+    }
+    portEXIT_CRITICAL(&stats_mux);
+}
+
+void flow_stats_pour_begin(uint8_t tap) {
+    if (tap >= FLOW_TAP_COUNT) {
+        return;
+    }
+    uint64_t now = now_ms();
+    portENTER_CRITICAL(&stats_mux);
+    pour_open[tap] = true;
+    pour_start_ms[tap] = now;
+    portEXIT_CRITICAL(&stats_mux);
+}
+
+void flow_stats_pour_end(uint8_t tap) {
+    if (tap >= FLOW_TAP_COUNT) {
+        return;
+    }
+    uint64_t now = now_ms();
+    portENTER_CRITICAL(&stats_mux);
+    if (pour_open[tap]) {
+        pour_open[tap] = false;
+        flow_stats_tap_t* t = &windows[active].taps[tap];
+        t->pours++;
+        flow_hist_add(&t->pour_ms, (uint32_t)(now - pour_start_ms[tap]));
+    }
+    portEXIT_CRITICAL(&stats_mux);
+}
+
+void flow_stats_set_idle_screen(bool idle) {
+    idle_screen = idle;
+}
+
+static size_t encode_window(const flow_stats_window_t* w, uint32_t length_ms) {
+    uint8_t* b = message;
+    *b++ = FLOW_STATS_VERSION;
+    *b++ = FLOW_HIST_SUB_BUCKETS;
+    put_le16(b, window_seq);
+    put_le32(b + 2, (uint32_t)window_start_epoch);
+    put_le32(b + 6, length_ms);
+    b += 10;
+    *b++ = FLOW_TAP_COUNT;
+    for (uint8_t tap = 0; tap < FLOW_TAP_COUNT; tap++) {
+        const flow_stats_tap_t* t = &w->taps[tap];
+        *b++ = tap;
+        b += flow_hist_put_varint(b, t->pulses);
+        b += flow_hist_put_varint(b, t->flow_ms);
+        b += flow_hist_put_varint(b, t->pours);
+        b += flow_hist_put_varint(b, t->idle_pulses);
+        b += flow_hist_put_varint(b, t->anomalies);
+        b += flow_hist_put_varint(b, t->noise_edges);
+        b += flow_hist_encode(&t->rate_mlpm, b);
+        b += flow_hist_encode(&t->pour_ms, b);
+    }
+    return (size_t)(b - message);
+}
+
+void flow_stats_loop() {
+    uint64_t now = now_ms();
+    if (window_start_ms == 0) {
+        window_start_ms = now ? now : 1;
+        window_start_epoch = wall_clock_now();
+    }
+    
+    for (uint8_t tap = 0; tap < FLOW_TAP_COUNT; tap++) {
+        portENTER_CRITICAL(&stats_mux);
+        uint32_t total = anomaly_total[tap];
+        portEXIT_CRITICAL(&stats_mux);
+        if (total != anomaly_logged[tap]) {
+            anomaly_logged[tap] = total;
+            ESP_LOGW(TAG, "[Flow Stats] Tap %u: flow with no pour open (anomaly %u since boot)",
+                     (unsigned)tap, (unsigned)total);
+        }
+    }
+    
+    // Held open while offline - the window length tells the backend how long it covered
+    if (now - window_start_ms < (uint64_t)FLOW_STATS_WINDOW_SEC * 1000ULL || !mqtt_client_is_connected()) {
+        return;
+    }
+    
+    portENTER_CRITICAL(&stats_mux);
+    uint8_t closed = active;
+    active ^= 1;
+    portEXIT_CRITICAL(&stats_mux);
+    
+    size_t len = encode_window(&windows[closed], (uint32_t)(now - window_start_ms));
+    
+    // QoS 0 - one lost window is a gap in the usage data, not a billing error
+    if (mqtt_client_publish_telemetry_data("flow_stats", message, len, 0) < 0) {
+        ESP_LOGW(TAG, "[Flow Stats] Window %u not published", (unsigned)window_seq);
+    }
+    memset(&windows[closed], 0, sizeof(windows[closed]));
+    window_seq++;
+    window_start_ms = now;
+    window_start_epoch = wall_clock_now();
+}
+
+#endif // FLOW_STATS_ENABLED
@@ -0,0 +1,149 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Pour Checkpoint Implementation
+ * 
+ * One checkpoint per tap. RTC_NOINIT memory holds junk after a power-on, so a
+ * checkpoint is only trusted when its magic and CRC match. The CRC covers the whole record and
+ * is recomputed (ROM routine, a few microseconds) under the same lock as the
+ * pulse update, so a reset can never leave a half-written record that passes.
+ */
+
+// Project headers
+#include "config.h"
+#include "flow/pour_checkpoint.h"
+#include "flow/flow_meter.h"
+#include "flow/pour_log.h"
+#include "flow/pour_math.h"
+#include "flow/pour_telemetry.h"
+#include "utils/wire_utils.h"
+
+// System/Standard library headers
+#include <cstddef>
+#include <inttypes.h>
+#include <string.h>
+
+// ESP-IDF framework headers
+#include <esp_attr.h>
+#include <esp_log.h>
+#include <esp_rom_crc.h>
+#include <esp_system.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#define TAG "pour_ckpt"
+
+#define CHECKPOINT_MAGIC 0x32504B43UL  // "CKP2" (per-tap layout)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t active;             // 1 while the valve may be open
+    uint32_t tap;
+    char id[POUR_LOG_ID_MAX + 1];
+    int64_t price_micro_per_ml;
+    uint64_t max_pulses;
+    int64_t start_epoch;         // Unix time (s), 0 if unknown
+    uint64_t pulses;             // Pulses since the pour started, updated every sample
+    uint32_t elapsed_ms;         // Time of the last update since the pour started
+    uint32_t crc;                // CRC32 of everything above
+} pour_checkpoint_t;
+
+static RTC_NOINIT_ATTR pour_checkpoint_t checkpoints[FLOW_TAP_COUNT];
+
+static portMUX_TYPE checkpoint_mux = portMUX_INITIALIZER_UNLOCKED;
+static uint64_t start_ms[FLOW_TAP_COUNT];  // esp_timer time each pour started (this boot only)
+
+static uint32_t checkpoint_crc(const pour_checkpoint_t* checkpoint) {
+    return esp_rom_crc32_le(0, (const uint8_t*)checkpoint, offsetof(pour_checkpoint_t, crc));
+}
+
+static bool checkpoint_valid(const pour_checkpoint_t* checkpoint) {
+    return checkpoint->magic == CHECKPOINT_MAGIC && checkpoint->crc == checkpoint_crc(checkpoint);
+}
+
+// Flow sample - keep the tap's pulse count current (sampling task)
+static void on_flow_sample(uint8_t tap, uint64_t pulses, uint64_t timestamp_ms) {
+    if (tap >= FLOW_TAP_COUNT) {
+        return;
+    }
+    pour_checkpoint_t* checkpoint = &checkpoints[tap];
+    portENTER_CRITICAL(&checkpoint_mux);
+    if (checkpoint->active) {
+        checkpoint->pulses = pulses;
+        checkpoint->elapsed_ms = (uint32_t)(timestamp_ms - start_ms[tap]);
+        checkpoint->crc = checkpoint_crc(checkpoint);
+    }
+    portEXIT_CRITICAL(&checkpoint_mux);
+}
+
+void pour_checkpoint_begin(uint8_t tap, const char* unique_id, int64_t price_micro_per_ml, uint64_t max_pulses) {
+    if (tap >= FLOW_TAP_COUNT) {
+        return;
+    }
+    int64_t now = wall_clock_now();
+    pour_checkpoint_t* checkpoint = &checkpoints[tap];
+    
+    portENTER_CRITICAL(&checkpoint_mux);
+    memset(checkpoint, 0, sizeof(*checkpoint));
+    checkpoint->magic = CHECKPOINT_MAGIC;
+    checkpoint->active = 1;
+    checkpoint->tap = tap;
+    strncpy(checkpoint->id, unique_id != NULL ? unique_id : "", sizeof(checkpoint->id) - 1);
+    checkpoint->price_micro_per_ml = price_micro_per_ml;
+    checkpoint->max_pulses = max_pulses;
+    checkpoint->start_epoch = now;
+    start_ms[tap] = (uint64_t)(esp_timer_get_time() / 1000LL);
+    checkpoint->crc = checkpoint_crc(checkpoint);
+    portEXIT_CRITICAL(&checkpoint_mux);
+    
+    flow_meter_set_sample_callback(on_flow_sample);
+}
+
+void pour_checkpoint_end(uint8_t tap) {
+    if (tap >= FLOW_TAP_COUNT) {
+        return;
+    }
+    pour_checkpoint_t* checkpoint = &checkpoints[tap];
+    portENTER_CRITICAL(&checkpoint_mux);
+    checkpoint->active = 0;
+    checkpoint->crc = checkpoint_crc(checkpoint);
+    portEXIT_CRITICAL(&checkpoint_mux);
+}
+
+bool pour_checkpoint_recover() {
+    bool recovered = false;
+    for (uint8_t tap = 0; tap < FLOW_TAP_COUNT; tap++) {
+        pour_checkpoint_t* checkpoint = &checkpoints[tap];
+        if (!checkpoint_valid(checkpoint) || !checkpoint->active || checkpoint->tap != tap) {
+            continue;
+        }
+        checkpoint->id[sizeof(checkpoint->id) - 1] = '\0';
+        
+        pour_record_t record = {};
+        memcpy(record.id, checkpoint->id, sizeof(record.id));
+        record.tap = tap;
+        record.complete = checkpoint->pulses >= checkpoint->max_pulses;
+        record.interrupted = true;
+        record.pulses = checkpoint->pulses;
+        record.volume_ul = flow_meter_pulses_to_ul(tap, checkpoint->pulses);
+        record.cost_minor = pour_cost_minor_units(record.volume_ul, checkpoint->price_micro_per_ml);
+        record.start_epoch = checkpoint->start_epoch;
+        record.end_epoch = checkpoint->start_epoch != 0 ? checkpoint->start_epoch + checkpoint->elapsed_ms / 1000 : 0;
+        record.duration_ms = checkpoint->elapsed_ms;
+        
+        ESP_LOGW(TAG, "[Pour Checkpoint] Tap %u pour %s interrupted by reset (reason %d): %" PRIu64 " ul after %" PRIu32 " ms",
+                 (unsigned)tap, record.id, (int)esp_reset_reason(), record.volume_ul, record.duration_ms);
+        
+        // Report before closing - a reset in between repeats the report (the backend
+        // de-duplicates on id) instead of losing it
+        pour_telemetry_report(&record);
+        pour_checkpoint_end(tap);
+        recovered = true;
+    }
+    return recovered;
+}
@@ -0,0 +1,271 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Pour Controller Implementation
+ * 
+ * Predictive valve cut-off for max_ml enforcement
+ * 
+ * start/stop and the periodic update share each tap's pour state, so they
+ * run under ctrl_mutex whichever task calls them; the cut-off callback only
+ * touches the valve and the close fields, under valve_mux.
+ */
+
+// Project headers
+#include "config.h"
+#include "flow/pour_controller.h"
+#include "flow/flow_meter.h"
+#include "flow/pour_math.h"
+#include "system/config_store.h"
+#include "system/perf_monitor.h"
+
+// System/Standard library headers
+#include <inttypes.h>
+
+// ESP-IDF framework headers
+#include <driver/gpio.h>
+#include <hal/gpio_ll.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#define TAG "pour_ctrl"
+
+#define STOP_LATENCY_MAX_US 1000000U   // Clamp learned latency to 1s
+#define LEARN_MIN_RATE_MHZ 1000U       // Only learn from pours above 1 Hz (~0.13 L/min)
+#define LEARN_WEIGHT_SHIFT 2           // EWMA weight 1/4 per pour
+#define SETTLE_TIMEOUT_US 3000000ULL   // Give up waiting for flow to stop after 3s
+#define CUTOFF_REARM_PULSES 1          // Re-arm the cut-off when the prediction moves by this much
+
+#define VALVE_LEVEL_OPEN (POUR_VALVE_ACTIVE_HIGH ? 1 : 0)
+#define VALVE_LEVEL_CLOSED (POUR_VALVE_ACTIVE_HIGH ? 0 : 1)
+
+// One tap's valve and cut-off
+typedef struct {
+    int valve_pin;
+    volatile pour_ctrl_state_t state;
+    uint64_t target_pulses;
+    uint64_t armed_cutoff;
+    uint32_t stop_latency_us;
+    
+    // Written by the cut-off callback (ISR context)
+    volatile uint64_t close_pulses;
+    volatile uint64_t close_time_us;
+    volatile uint32_t close_rate_mhz;
+    
+    // Latest flow rate in milli-Hz (integer so the ISR can copy it without the FPU)
+    volatile uint32_t current_rate_mhz;
+} pour_tap_t;
+
+static portMUX_TYPE valve_mux = portMUX_INITIALIZER_UNLOCKED;
+static SemaphoreHandle_t ctrl_mutex = NULL;  // start/stop/update against each other
+static pour_tap_t taps[FLOW_TAP_COUNT];
+static const int valve_pins[4] = {POUR_VALVE_PIN, POUR_VALVE_PIN_2, POUR_VALVE_PIN_3, POUR_VALVE_PIN_4};
+
+static inline pour_tap_t* tap_for(uint8_t tap) {
+    return tap < FLOW_TAP_COUNT ? &taps[tap] : NULL;
+}
+
+// Set valve output - register write, safe from ISR
+static inline void IRAM_ATTR valve_set(pour_tap_t* t, bool open) {
+#if POUR_VALVE_ENABLED
+    gpio_ll_set_level(&GPIO, (gpio_num_t)t->valve_pin, open ? VALVE_LEVEL_OPEN : VALVE_LEVEL_CLOSED);
+#endif
+}
+
+// Cut-off reached - called from the flow meter counting path (ISR or sampling task)
+static void IRAM_ATTR pour_controller_on_cutoff(uint8_t tap, uint64_t pulses) {
+    if (tap >= FLOW_TAP_COUNT) {
+        return;
+    }
+    pour_tap_t* t = &taps[tap];
+    portENTER_CRITICAL_SAFE(&valve_mux);
+    valve_set(t, false);
+    t->close_pulses = pulses;
+    t->close_time_us = esp_timer_get_time();
+    t->close_rate_mhz = t->current_rate_mhz;
+    t->state = POUR_VALVE_ENABLED ? POUR_CTRL_SETTLING : POUR_CTRL_DONE;
+    portEXIT_CRITICAL_SAFE(&valve_mux);
+}
+
+// Predicted pulses that will still flow after the valve is told to close
+static uint64_t predicted_overshoot_pulses(const pour_tap_t* t) {
+    // mHz * us / 1e9 = pulses
+    return ((uint64_t)t->current_rate_mhz * t->stop_latency_us + 500000000ULL) / 1000000000ULL;
+}
+
+static void arm_cutoff(uint8_t tap, bool force) {
+    pour_tap_t* t = &taps[tap];
+    uint64_t overshoot = POUR_VALVE_ENABLED ? predicted_overshoot_pulses(t) : 0;
+    uint64_t cutoff = t->target_pulses > overshoot ? t->target_pulses - overshoot : 1;
+    uint64_t delta = cutoff > t->armed_cutoff ? cutoff - t->armed_cutoff : t->armed_cutoff - cutoff;
+    if (!force && delta < CUTOFF_REARM_PULSES) {
+        return;
+    }
+    t->armed_cutoff = cutoff;
+    flow_meter_set_cutoff(tap, cutoff, pour_controller_on_cutoff);
+}
+
+// Learn stop latency from the pulses counted after the valve closed
+static void learn_stop_latency(uint8_t tap, uint64_t final_pulses) {
+    pour_tap_t* t = &taps[tap];
+    uint64_t overshoot = final_pulses > t->close_pulses ? final_pulses - t->close_pulses : 0;
+    uint32_t rate_mhz = t->close_rate_mhz;
+    if (rate_mhz < LEARN_MIN_RATE_MHZ) {
+        ESP_LOGI(TAG, "[Pour Controller] Tap %u: overshoot %" PRIu64 " pulses (rate too low to learn)", (unsigned)tap, overshoot);
+        return;
+    }
+    
+    uint64_t measured_us = overshoot * 1000000000ULL / rate_mhz;
+    if (measured_us > STOP_LATENCY_MAX_US) {
+        measured_us = STOP_LATENCY_MAX_US;
+    }
+    perf_monitor_record(PERF_STOP_US, (uint32_t)measured_us);
+    int64_t error = (int64_t)measured_us - (int64_t)t->stop_latency_us;
+    t->stop_latency_us = (uint32_t)((int64_t)t->stop_latency_us + error / (1 << LEARN_WEIGHT_SHIFT));
+    
+    ESP_LOGI(TAG, "[Pour Controller] Tap %u: overshoot %" PRIu64 " pulses at %" PRIu32 " mHz -> measured %" PRIu64 " us, learned %" PRIu32 " us",
+             (unsigned)tap, overshoot, rate_mhz, measured_us, t->stop_latency_us);
+    config_store_set_stop_latency_us(tap, t->stop_latency_us);  // Written once pours settle
+}
+
+void pour_controller_init() {
+    ESP_LOGI(TAG, "=== Initializing Pour Controller ===");
+    ctrl_mutex = xSemaphoreCreateMutex();
+
+    for (uint8_t tap = 0; tap < FLOW_TAP_COUNT; tap++) {
+        pour_tap_t* t = &taps[tap];
+        t->valve_pin = valve_pins[tap];
+        t->stop_latency_us = POUR_STOP_LATENCY_DEFAULT_MS * 1000U;
+        t->state = POUR_CTRL_IDLE;
+
+#if POUR_VALVE_ENABLED
+        gpio_config_t io_conf = {};
+        io_conf.pin_bit_mask = (1ULL << t->valve_pin);
+        io_conf.mode = GPIO_MODE_OUTPUT;
+        io_conf.pull_up_en = GPIO_PULLUP_DISABLE;
+        io_conf.pull_down_en = GPIO_PULLDOWN_DISABLE;
+        io_conf.intr_type = GPIO_INTR_DISABLE;
+        gpio_set_level((gpio_num_t)t->valve_pin, VALVE_LEVEL_CLOSED);
+        gpio_config(&io_conf);
+        gpio_set_level((gpio_num_t)t->valve_pin, VALVE_LEVEL_CLOSED);
+        ESP_LOGI(TAG, "[Pour Controller] Tap %u valve on pin %d (active %s)", (unsigned)tap, t->valve_pin,
+                 POUR_VALVE_ACTIVE_HIGH ? "high" : "low");
+#endif
+
+        uint32_t saved = config_store_get_stop_latency_us(tap);
+        if (saved > 0 && saved <= STOP_LATENCY_MAX_US) {
+            t->stop_latency_us = saved;
+        }
+        ESP_LOGI(TAG, "[Pour Controller] Tap %u stop latency: %" PRIu32 " us", (unsigned)tap, t->stop_latency_us);
+    }
+#if !POUR_VALVE_ENABLED
+    ESP_LOGI(TAG, "[Pour Controller] No valve configured - cut-off only ends the pour");
+#endif
+}
+
+void pour_controller_start(uint8_t tap, uint64_t pulses) {
+    pour_tap_t* t = tap_for(tap);
+    if (t == NULL || ctrl_mutex == NULL) {
+        ESP_LOGE(TAG, "[Pour Controller] No tap %u", (unsigned)tap);
+        return;
+    }
+    xSemaphoreTake(ctrl_mutex, portMAX_DELAY);
+    t->target_pulses = pulses;
+    t->armed_cutoff = 0;
+    t->close_pulses = 0;
+    t->close_time_us = 0;
+    t->current_rate_mhz = 0;
+    
+    t->state = POUR_CTRL_OPEN;
+    arm_cutoff(tap, true);
+    
+    // Cut-off may have fired while arming (target of 0 or already reached)
+    portENTER_CRITICAL(&valve_mux);
+    if (t->state == POUR_CTRL_OPEN) {
+        valve_set(t, true);
+    }
+    portEXIT_CRITICAL(&valve_mux);
+    xSemaphoreGive(ctrl_mutex);
+    ESP_LOGI(TAG, "[Pour Controller] Tap %u pour started: target %" PRIu64 " pulses", (unsigned)tap, t->target_pulses);
+}
+
+void pour_controller_stop(uint8_t tap) {
+    pour_tap_t* t = tap_for(tap);
+    if (t == NULL || ctrl_mutex == NULL) {
+        return;
+    }
+    xSemaphoreTake(ctrl_mutex, portMAX_DELAY);
+    flow_meter_set_cutoff(tap, 0, NULL);
+    valve_set(t, false);
+    bool was_active = t->state == POUR_CTRL_OPEN || t->state == POUR_CTRL_SETTLING;
+    t->state = POUR_CTRL_IDLE;
+    xSemaphoreGive(ctrl_mutex);
+    if (was_active) {
+        ESP_LOGI(TAG, "[Pour Controller] Tap %u pour stopped", (unsigned)tap);
+    }
+}
+
+void pour_controller_update() {
+    if (ctrl_mutex == NULL) {
+        return;
+    }
+    xSemaphoreTake(ctrl_mutex, portMAX_DELAY);
+    for (uint8_t tap = 0; tap < FLOW_TAP_COUNT; tap++) {
+        pour_tap_t* t = &taps[tap];
+        switch (t->state) {
+            case POUR_CTRL_OPEN: {
+                // Track the pulse rate and slide the cut-off earlier by the predicted overshoot
+                // (taken as sampled - the L/min rate uses the curve K, not the flat calibration)
+                float rate_hz = flow_meter_get_pulse_rate_fast(tap);
+                t->current_rate_mhz = (uint32_t)(rate_hz * 1000.0f);
+                arm_cutoff(tap, false);
+                break;
+            }
+            
+            case POUR_CTRL_SETTLING: {
+                // Wait for the valve to actually stop the flow, then learn from the overshoot
+                uint64_t since_close = (uint64_t)esp_timer_get_time() - t->close_time_us;
+                bool stopped = flow_meter_get_flow_rate_fast(tap) == 0.0f;
+                if (stopped || since_close > SETTLE_TIMEOUT_US) {
+                    learn_stop_latency(tap, flow_meter_get_pulse_count(tap));
+                    t->state = POUR_CTRL_DONE;
+                }
+                break;
+            }
+            
+            case POUR_CTRL_IDLE:
+            case POUR_CTRL_DONE:
+                break;
+        }
+    }
+    xSemaphoreGive(ctrl_mutex);
+}
+
+pour_ctrl_state_t pour_controller_get_state(uint8_t tap) {
+    pour_tap_t* t = tap_for(tap);
+    return t != NULL ? t->state : POUR_CTRL_IDLE;
+}
+
+bool pour_controller_any_active() {
+    for (uint8_t tap = 0; tap < FLOW_TAP_COUNT; tap++) {
+        if (taps[tap].state == POUR_CTRL_OPEN || taps[tap].state == POUR_CTRL_SETTLING) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool pour_controller_is_complete(uint8_t tap) {
+    return pour_controller_get_state(tap) == POUR_CTRL_DONE;
+}
+
+uint32_t pour_controller_get_stop_latency_us(uint8_t tap) {
+    pour_tap_t* t = tap_for(tap);
+    return t != NULL ? t->stop_latency_us : 0;
+}
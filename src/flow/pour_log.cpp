@@ -0,0 +1,368 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Pour Log Implementation
+ * 
+ * Each slot carries a sequence number and a CRC over its body, so the ring is
+ * recovered at boot by scanning the headers: the highest valid sequence is
+ * the newest record. The ack word is written as all-ones and cleared to zero
+ * once the broker has the record - NOR flash can clear bits without an
+ * erase, so acknowledging costs no wear.
+ */
+
+// Project headers
+#include "config.h"
+#include "flow/pour_log.h"
+#include "mqtt/mqtt_manager.h"
+
+// System/Standard library headers
+#include <ArduinoJson.h>
+#include <cstddef>
+#include <string.h>
+
+// ESP-IDF framework headers
+#include <esp_log.h>
+#include <esp_partition.h>
+#include <esp_rom_crc.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#define TAG "pour_log"
+
+#define POUR_LOG_PARTITION "pourlog"
+#define POUR_LOG_MAGIC 0x474F4C50UL        // "PLOG"
+#define POUR_LOG_SLOT_SIZE 256
+#define POUR_LOG_SECTOR_SIZE 4096
+#define POUR_LOG_SLOTS_PER_SECTOR (POUR_LOG_SECTOR_SIZE / POUR_LOG_SLOT_SIZE)
+#define POUR_LOG_BATCH 8                   // Records per published message
+#define POUR_LOG_PAYLOAD_SIZE 3072         // Fits a full batch with 128 character ids
+#define POUR_LOG_ACK_TIMEOUT_MS 10000      // Wait this long for the PUBACK before retrying
+#define POUR_LOG_RETRY_MS 5000             // Idle/retry poll while disconnected
+#define DRAIN_TASK_STACK 6144
+#define DRAIN_TASK_PRIORITY 3              // Below the main loop (5)
+
+// Flash layout of one slot
+typedef struct {
+    uint32_t magic;
+    uint32_t ack;            // 0xFFFFFFFF until acknowledged, then 0
+    uint32_t seq;
+    uint32_t crc;            // CRC32 of body
+    struct {
+        uint64_t pulses;
+        uint64_t volume_ul;
+        int64_t cost_minor;
+        int64_t start_epoch;
+        int64_t end_epoch;
+        uint32_t duration_ms;
+        uint8_t complete;
+        uint8_t id_len;
+        uint8_t interrupted;
+        uint8_t tap;               // 0 in records written before multi-tap support
+        char id[POUR_LOG_ID_MAX];  // Not NUL-terminated
+    } body;
+    uint8_t padding[POUR_LOG_SLOT_SIZE - 16 - 176];
+} pour_slot_t;
+
+static_assert(sizeof(pour_slot_t) == POUR_LOG_SLOT_SIZE, "pour_slot_t must fill one slot");
+
+static const esp_partition_t* partition = NULL;
+static uint32_t slot_count = 0;
+static uint32_t head = 0;             // Next slot to write
+static uint32_t next_seq = 1;
+static volatile uint32_t pending = 0; // Records not yet acknowledged
+static SemaphoreHandle_t log_mutex = NULL;
+static TaskHandle_t drain_task = NULL;
+static QueueHandle_t ack_queue = NULL;
+
+static uint32_t slot_crc(const pour_slot_t* slot) {
+    return esp_rom_crc32_le(0, (const uint8_t*)&slot->body, sizeof(slot->body));
+}
+
+static bool read_slot(uint32_t index, pour_slot_t* slot) {
+    return esp_partition_read(partition, (size_t)index * POUR_LOG_SLOT_SIZE, slot, sizeof(*slot)) == ESP_OK;
+}
+
+static bool slot_valid(const pour_slot_t* slot) {
+    return slot->magic == POUR_LOG_MAGIC && slot->crc == slot_crc(slot) && slot->body.id_len <= POUR_LOG_ID_MAX;
+}
+
+static void slot_to_record(const pour_slot_t* slot, pour_record_t* record) {
+    memcpy(record->id, slot->body.id, slot->body.id_len);
+    record->id[slot->body.id_len] = '\0';
+    record->complete = slot->body.complete != 0;
+    record->interrupted = slot->body.interrupted != 0;
+    record->tap = slot->body.tap;
+    record->pulses = slot->body.pulses;
+    record->volume_ul = slot->body.volume_ul;
+    record->cost_minor = slot->body.cost_minor;
+    record->start_epoch = slot->body.start_epoch;
+    record->end_epoch = slot->body.end_epoch;
+    record->duration_ms = slot->body.duration_ms;
+    record->seq = slot->seq;
+}
+
+// Erase the sector that starts at head, dropping whatever was still unacknowledged in it
+static bool erase_head_sector() {
+    uint32_t lost = 0;
+    pour_slot_t slot;
+    for (uint32_t i = head; i < head + POUR_LOG_SLOTS_PER_SECTOR; i++) {
+        if (read_slot(i, &slot) && slot_valid(&slot) && slot.ack != 0) {
+            lost++;
+        }
+    }
+    if (lost > 0) {
+        ESP_LOGW(TAG, "[Pour Log] Log full - dropping %u unsent records", (unsigned)lost);
+        pending = pending > lost ? pending - lost : 0;
+    }
+    
+    esp_err_t err = esp_partition_erase_range(partition, (size_t)head * POUR_LOG_SLOT_SIZE, POUR_LOG_SECTOR_SIZE);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "[Pour Log] Failed to erase sector: %s", esp_err_to_name(err));
+        return false;
+    }
+    return true;
+}
+
+// Collect the oldest unacknowledged records (ring order from head), returns count
+static size_t collect_batch(pour_record_t* records, uint32_t* slots, size_t max) {
+    size_t count = 0;
+    pour_slot_t slot;
+    for (uint32_t n = 0; n < slot_count && count < max; n++) {
+        uint32_t index = (head + n) % slot_count;
+        if (read_slot(index, &slot) && slot_valid(&slot) && slot.ack != 0) {
+            slot_to_record(&slot, &records[count]);
+            slots[count] = index;
+            count++;
+        }
+    }
+    return count;
+}
+
+// Clear the ack word of each slot that still holds the record that was sent
+static void mark_acked(const pour_record_t* records, const uint32_t* slots, size_t count) {
+    const uint32_t acked = 0;
+    pour_slot_t slot;
+    for (size_t i = 0; i < count; i++) {
+        // The sector may have been erased and reused while the batch was in flight
+        if (!read_slot(slots[i], &slot) || slot.seq != records[i].seq || !slot_valid(&slot)) {
+            continue;
+        }
+        size_t offset = (size_t)slots[i] * POUR_LOG_SLOT_SIZE + offsetof(pour_slot_t, ack);
+        if (esp_partition_write(partition, offset, &acked, sizeof(acked)) == ESP_OK && pending > 0) {
+            pending--;
+        }
+    }
+}
+
+static void on_published(int msg_id) {
+    xQueueSend(ack_queue, &msg_id, 0);
+}
+
+// Wait for the PUBACK of msg_id
+static bool wait_for_ack(int msg_id) {
+    TickType_t start = xTaskGetTickCount();
+    TickType_t timeout = pdMS_TO_TICKS(POUR_LOG_ACK_TIMEOUT_MS);
+    int acked_id;
+    while (xTaskGetTickCount() - start < timeout) {
+        if (xQueueReceive(ack_queue, &acked_id, timeout - (xTaskGetTickCount() - start)) == pdTRUE &&
+            acked_id == msg_id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void pour_log_drain_task(void* arg) {
+    (void)arg;
+    static pour_record_t records[POUR_LOG_BATCH];
+    static uint32_t slots[POUR_LOG_BATCH];
+    static char payload[POUR_LOG_PAYLOAD_SIZE];
+    
+    for (;;) {
+        if (pending == 0 || !mqtt_client_is_connected()) {
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(POUR_LOG_RETRY_MS));
+            continue;
+        }
+        
+        xSemaphoreTake(log_mutex, portMAX_DELAY);
+        size_t count = collect_batch(records, slots, POUR_LOG_BATCH);
+        if (count == 0) {
+            pending = 0;  // Count drifted (records lost to a torn write) - nothing left to send
+        }
+        xSemaphoreGive(log_mutex);
+        if (count == 0) {
+            continue;
+        }
+        
+        size_t len = pour_log_format_json(records, count, payload, sizeof(payload));
+        if (len == 0) {
+            ESP_LOGE(TAG, "[Pour Log] Batch of %d records does not fit in %d bytes", (int)count, (int)sizeof(payload));
+            vTaskDelay(pdMS_TO_TICKS(POUR_LOG_RETRY_MS));
+            continue;
+        }
+        
+        xQueueReset(ack_queue);
+        int msg_id = mqtt_client_publish_telemetry_data("pour_summary", payload, len, 1);
+        if (msg_id <= 0 || !wait_for_ack(msg_id)) {
+            // The backend de-duplicates on id, so a batch that was delivered but not acked is harmless to resend
+            ESP_LOGW(TAG, "[Pour Log] %d records not acknowledged - retrying", (int)count);
+            vTaskDelay(pdMS_TO_TICKS(POUR_LOG_RETRY_MS));
+            continue;
+        }
+        
+        xSemaphoreTake(log_mutex, portMAX_DELAY);
+        mark_acked(records, slots, count);
+        xSemaphoreGive(log_mutex);
+        ESP_LOGI(TAG, "[Pour Log] Sent %d records, %u pending", (int)count, (unsigned)pending);
+    }
+}
+
+bool pour_log_init() {
+    partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, POUR_LOG_PARTITION);
+    if (partition == NULL) {
+        ESP_LOGW(TAG, "[Pour Log] No '%s' partition - pour records are not persisted", POUR_LOG_PARTITION);
+        return false;
+    }
+    slot_count = (partition->size / POUR_LOG_SECTOR_SIZE) * POUR_LOG_SLOTS_PER_SECTOR;
+    if (slot_count < 2 * POUR_LOG_SLOTS_PER_SECTOR) {
+        ESP_LOGE(TAG, "[Pour Log] Partition too small (%u bytes)", (unsigned)partition->size);
+        partition = NULL;
+        return false;
+    }
+    
+    // Newest record is the one with the highest sequence number
+    uint32_t newest_seq = 0;
+    bool found = false;
+    pour_slot_t slot;
+    pending = 0;
+    for (uint32_t i = 0; i < slot_count; i++) {
+        if (!read_slot(i, &slot) || !slot_valid(&slot)) {
+            continue;
+        }
+        if (!found || (int32_t)(slot.seq - newest_seq) > 0) {
+            newest_seq = slot.seq;
+            head = (i + 1) % slot_count;
+            found = true;
+        }
+        if (slot.ack != 0) {
+            pending++;
+        }
+    }
+    next_seq = found ? newest_seq + 1 : 1;
+    
+    log_mutex = xSemaphoreCreateMutex();
+    ack_queue = xQueueCreate(8, sizeof(int));
+    if (log_mutex == NULL || ack_queue == NULL) {
+        ESP_LOGE(TAG, "[Pour Log] Failed to create mutex/queue");
+        partition = NULL;
+        return false;
+    }
+    mqtt_client_set_published_callback(on_published);
+    
+    BaseType_t ok = xTaskCreatePinnedToCore(pour_log_drain_task, "pour_log", DRAIN_TASK_STACK, NULL,
+                                            DRAIN_TASK_PRIORITY, &drain_task, BACKGROUND_TASK_CORE);
+    if (ok != pdPASS) {
+        ESP_LOGE(TAG, "[Pour Log] Failed to create drain task");
+    }
+    
+    ESP_LOGI(TAG, "[Pour Log] %u slots, next seq %u, %u records pending",
+             (unsigned)slot_count, (unsigned)next_seq, (unsigned)pending);
+    return true;
+}
+
+bool pour_log_append(pour_record_t* record) {
+    if (partition == NULL) {
+        return false;
+    }
+    
+    pour_slot_t slot;
+    memset(&slot, 0xFF, sizeof(slot));
+    memset(&slot.body, 0, sizeof(slot.body));
+    size_t id_len = strnlen(record->id, POUR_LOG_ID_MAX);
+    memcpy(slot.body.id, record->id, id_len);
+    slot.body.id_len = (uint8_t)id_len;
+    slot.body.complete = record->complete ? 1 : 0;
+    slot.body.interrupted = record->interrupted ? 1 : 0;
+    slot.body.tap = record->tap;
+    slot.body.pulses = record->pulses;
+    slot.body.volume_ul = record->volume_ul;
+    slot.body.cost_minor = record->cost_minor;
+    slot.body.start_epoch = record->start_epoch;
+    slot.body.end_epoch = record->end_epoch;
+    slot.body.duration_ms = record->duration_ms;
+    
+    xSemaphoreTake(log_mutex, portMAX_DELAY);
+    
+    // A slot that is not blank is left over from a torn write - move on to a fresh sector
+    uint32_t magic = 0;
+    if (head % POUR_LOG_SLOTS_PER_SECTOR != 0 &&
+        (esp_partition_read(partition, (size_t)head * POUR_LOG_SLOT_SIZE, &magic, sizeof(magic)) != ESP_OK ||
+         magic != 0xFFFFFFFFUL)) {
+        head = ((head / POUR_LOG_SLOTS_PER_SECTOR + 1) * POUR_LOG_SLOTS_PER_SECTOR) % slot_count;
+    }
+    bool ok = head % POUR_LOG_SLOTS_PER_SECTOR != 0 || erase_head_sector();
+    if (ok) {
+        slot.magic = POUR_LOG_MAGIC;
+        slot.seq = next_seq;
+        slot.crc = slot_crc(&slot);
+        esp_err_t err = esp_partition_write(partition, (size_t)head * POUR_LOG_SLOT_SIZE, &slot, sizeof(slot));
+        ok = err == ESP_OK;
+        if (ok) {
+            record->seq = next_seq++;
+            head = (head + 1) % slot_count;
+            pending++;
+        } else {
+            ESP_LOGE(TAG, "[Pour Log] Failed to write record: %s", esp_err_to_name(err));
+        }
+    }
+    
+    xSemaphoreGive(log_mutex);
+    
+    if (ok) {
+        ESP_LOGI(TAG, "[Pour Log] Stored pour %s as seq %u", record->id, (unsigned)record->seq);
+        if (drain_task != NULL) {
+            xTaskNotifyGive(drain_task);
+        }
+    }
+    return ok;
+}
+
+uint32_t pour_log_pending_count() {
+    return pending;
+}
+
+size_t pour_log_format_json(const pour_record_t* records, size_t count, char* buf, size_t size) {
+    JsonDocument doc;
+    JsonArray pours = doc["pours"].to<JsonArray>();
+    for (size_t i = 0; i < count; i++) {
+        const pour_record_t* r = &records[i];
+        JsonObject pour = pours.add<JsonObject>();
+        pour["id"] = r->id;
+        pour["seq"] = r->seq;
+        pour["complete"] = r->complete;
+        if (r->interrupted) {
+            pour["interrupted"] = true;
+        }
+        if (FLOW_TAP_COUNT > 1) {
+            pour["tap"] = r->tap;
+        }
+        pour["pulses"] = r->pulses;
+        pour["volume_ul"] = r->volume_ul;
+        pour["ml"] = r->volume_ul / 1000;
+        pour["cost_minor"] = r->cost_minor;
+        pour["start"] = r->start_epoch;
+        pour["end"] = r->end_epoch;
+        pour["duration_ms"] = r->duration_ms;
+    }
+    if (doc.overflowed() || measureJson(doc) >= size) {
+        return 0;
+    }
+    return serializeJson(doc, buf, size);
+}
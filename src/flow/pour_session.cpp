@@ -0,0 +1,321 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Pour Session Engine Implementation
+ * 
+ * Requests (start/stop) are handed over under request_mux like the telemetry
+ * requests; the session itself is only written by the main loop, and the copy
+ * the renderers read is published under info_mux.
+ */
+
+// Project headers
+#include "config.h"
+#include "flow/pour_session.h"
+#include "flow/flow_meter.h"
+#include "flow/flow_stats.h"
+#include "flow/pour_checkpoint.h"
+#include "flow/pour_controller.h"
+#include "flow/pour_math.h"
+#include "flow/pour_telemetry.h"
+#include "system/app_events.h"
+#include "system/config_store.h"
+#include "utils/log_with_time.h"
+
+// System/Standard library headers
+#include <inttypes.h>
+#include <string.h>
+
+// ESP-IDF framework headers
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#define TAG "pour_session"
+
+#define SESSION_SETTLE_TIMEOUT_US 3000000LL  // Bill a cancelled pour after 3s even if pulses trickle on
+
+typedef struct {
+    // Requests, under request_mux
+    bool start_pending;
+    bool stop_pending;
+    char start_id[POUR_LOG_ID_MAX + 1];
+    char start_currency[POUR_SESSION_CURRENCY_SIZE];
+    float start_cost_per_ml;
+    int start_max_ml;
+    
+    // Main loop only
+    pour_session_info_t info;
+    uint64_t max_pulses;
+    uint32_t meter_sequence;   // Flow meter sample last accumulated
+    int64_t stop_time_us;      // Cancel time, 0 for a cut-off stop
+} pour_tap_session_t;
+
+static portMUX_TYPE request_mux = portMUX_INITIALIZER_UNLOCKED;
+static portMUX_TYPE info_mux = portMUX_INITIALIZER_UNLOCKED;
+static pour_tap_session_t sessions[FLOW_TAP_COUNT];
+static pour_session_info_t published[FLOW_TAP_COUNT];
+static pour_session_listener_t listener = NULL;
+
+static void copy_string(char* dst, size_t size, const char* src) {
+    strncpy(dst, src != NULL ? src : "", size - 1);
+    dst[size - 1] = '\0';
+}
+
+const char* pour_session_state_name(pour_session_state_t state) {
+    switch (state) {
+        case POUR_SESSION_IDLE:     return "idle";
+        case POUR_SESSION_ARMED:    return "armed";
+        case POUR_SESSION_POURING:  return "pouring";
+        case POUR_SESSION_STOPPING: return "stopping";
+        case POUR_SESSION_SETTLED:  return "settled";
+        case POUR_SESSION_REPORTED: return "reported";
+        default:                    return "?";
+    }
+}
+
+static bool is_active(pour_session_state_t state) {
+    return state >= POUR_SESSION_ARMED && state <= POUR_SESSION_SETTLED;
+}
+
+// Make the main loop's copy visible to the renderers
+static void publish(uint8_t tap) {
+    pour_tap_session_t* s = &sessions[tap];
+    s->info.sequence++;
+    portENTER_CRITICAL(&info_mux);
+    published[tap] = s->info;
+    portEXIT_CRITICAL(&info_mux);
+    app_events_post(APP_EVENT_POUR);
+}
+
+static void set_state(uint8_t tap, pour_session_state_t state) {
+    pour_tap_session_t* s = &sessions[tap];
+    ESP_LOGI_HOT(TAG, "[Pour Session] Tap %u: %s -> %s", (unsigned)tap,
+                 pour_session_state_name(s->info.state), pour_session_state_name(state));
+    s->info.state = state;
+    publish(tap);
+    if (listener != NULL) {
+        listener(tap, state);
+    }
+}
+
+// Volume and cost from the latest flow sample, returns true if they changed
+static bool accumulate(uint8_t tap) {
+    pour_tap_session_t* s = &sessions[tap];
+    flow_meter_snapshot_t snap;
+    flow_meter_get_snapshot(tap, &snap);
+    if (snap.sequence == s->meter_sequence) {
+        return false;
+    }
+    s->meter_sequence = snap.sequence;
+    s->info.volume_ul = snap.volume_ul;
+    s->info.cost_minor = pour_cost_minor_units(snap.volume_ul, s->info.price_micro_per_ml);
+    s->info.flow_rate_lpm = snap.flow_rate_lpm;
+    return true;
+}
+
+// Final volume and cost, then hand the pour over
+static void settle_and_report(uint8_t tap) {
+    pour_tap_session_t* s = &sessions[tap];
+    accumulate(tap);
+    s->info.complete = pour_controller_is_complete(tap);
+    set_state(tap, POUR_SESSION_SETTLED);
+    
+    pour_telemetry_end(tap, s->info.complete);
+    flow_stats_pour_end(tap);
+    pour_checkpoint_end(tap);
+    pour_controller_stop(tap);
+    ESP_LOGI(TAG, "[Pour Session] Tap %u pour %s %s: %" PRIu64 " ul, %" PRId64 " minor units",
+             (unsigned)tap, s->info.id, s->info.complete ? "complete" : "stopped early",
+             s->info.volume_ul, s->info.cost_minor);
+    set_state(tap, POUR_SESSION_REPORTED);
+}
+
+static void begin(uint8_t tap, const char* id, float cost_per_ml, int max_ml, const char* currency) {
+    pour_tap_session_t* s = &sessions[tap];
+    
+    // The new pour replaces one still running on this tap
+    if (is_active(s->info.state)) {
+        ESP_LOGW(TAG, "[Pour Session] Tap %u pour %s replaced before it finished", (unsigned)tap, s->info.id);
+        pour_controller_stop(tap);
+        settle_and_report(tap);
+    }
+    
+    flow_meter_reset_volume(tap);
+    copy_string(s->info.id, sizeof(s->info.id), id);
+    if (currency != NULL && currency[0] != '\0') {
+        copy_string(s->info.currency, sizeof(s->info.currency), currency);
+    } else {
+        config_store_get_currency(s->info.currency, sizeof(s->info.currency));  // Device default
+    }
+    s->info.price_micro_per_ml = pour_price_from_float(cost_per_ml);
+    s->info.max_ml = max_ml > 0 ? (uint32_t)max_ml : 0;
+    s->info.volume_ul = 0;
+    s->info.cost_minor = 0;
+    s->info.flow_rate_lpm = 0.0f;
+    s->info.complete = false;
+    s->max_pulses = flow_meter_ml_to_pulses(tap, s->info.max_ml);
+    s->stop_time_us = 0;
+    flow_meter_snapshot_t snap;
+    flow_meter_get_snapshot(tap, &snap);
+    s->meter_sequence = snap.sequence;
+    
+    // Checkpoint to RTC memory first so a reset once the valve is open is billed
+    pour_checkpoint_begin(tap, s->info.id, s->info.price_micro_per_ml, s->max_pulses);
+    
+    flow_stats_pour_begin(tap);  // Before the valve opens, so the first pulses are not idle flow
+    
+    // Open valve - closes itself at the predicted cut-off for max_pulses
+    pour_controller_start(tap, s->max_pulses);
+    pour_telemetry_begin(tap, s->info.id, s->info.price_micro_per_ml);
+    
+    ESP_LOGI_HOT(TAG, "[Pour Session] Tap %u pour %s: %s%" PRId64 " micro per ml, max %" PRIu32 " ml (%" PRIu64 " pulses)",
+                 (unsigned)tap, s->info.id, s->info.currency, s->info.price_micro_per_ml, s->info.max_ml,
+                 s->max_pulses);
+    set_state(tap, POUR_SESSION_ARMED);
+}
+
+static void cancel(uint8_t tap) {
+    pour_tap_session_t* s = &sessions[tap];
+    if (s->info.state != POUR_SESSION_ARMED && s->info.state != POUR_SESSION_POURING) {
+        return;
+    }
+    pour_controller_stop(tap);
+    s->stop_time_us = esp_timer_get_time();
+    set_state(tap, POUR_SESSION_STOPPING);
+}
+
+static void session_update(uint8_t tap) {
+    pour_tap_session_t* s = &sessions[tap];
+    
+    bool do_start = false;
+    bool do_stop = false;
+    char id[POUR_LOG_ID_MAX + 1];
+    char currency[POUR_SESSION_CURRENCY_SIZE];
+    float cost_per_ml = 0.0f;
+    int max_ml = 0;
+    portENTER_CRITICAL(&request_mux);
+    if (s->start_pending) {
+        do_start = true;
+        s->start_pending = false;
+        memcpy(id, s->start_id, sizeof(id));
+        memcpy(currency, s->start_currency, sizeof(currency));
+        cost_per_ml = s->start_cost_per_ml;
+        max_ml = s->start_max_ml;
+    }
+    if (s->stop_pending) {
+        do_stop = true;
+        s->stop_pending = false;
+    }
+    portEXIT_CRITICAL(&request_mux);
+    
+    if (do_start) {
+        begin(tap, id, cost_per_ml, max_ml, currency);
+    }
+    if (do_stop) {
+        cancel(tap);
+    }
+    if (!is_active(s->info.state)) {
+        return;
+    }
+    
+    bool changed = accumulate(tap);
+    pour_ctrl_state_t valve = pour_controller_get_state(tap);
+    switch (s->info.state) {
+        case POUR_SESSION_ARMED:
+        case POUR_SESSION_POURING:
+            if (s->info.state == POUR_SESSION_ARMED && s->info.volume_ul > 0) {
+                set_state(tap, POUR_SESSION_POURING);
+                changed = false;
+            }
+            // Valve closed itself at the cut-off (limit enforced in the counting path)
+            if (valve == POUR_CTRL_SETTLING || valve == POUR_CTRL_DONE) {
+                set_state(tap, POUR_SESSION_STOPPING);
+                changed = false;
+            }
+            break;
+        
+        case POUR_SESSION_STOPPING: {
+            bool settled;
+            if (s->stop_time_us == 0) {
+                settled = (valve == POUR_CTRL_DONE);  // Controller waited for the flow to stop
+            } else {
+                settled = flow_meter_get_flow_rate_fast(tap) == 0.0f ||
+                          esp_timer_get_time() - s->stop_time_us > SESSION_SETTLE_TIMEOUT_US;
+            }
+            if (settled) {
+                settle_and_report(tap);
+                changed = false;
+            }
+            break;
+        }
+        
+        default:
+            break;
+    }
+    if (changed) {
+        publish(tap);
+    }
+}
+
+void pour_session_set_listener(pour_session_listener_t callback) {
+    listener = callback;
+}
+
+bool pour_session_start(uint8_t tap, const char* unique_id, float cost_per_ml, int max_ml, const char* currency) {
+    if (tap >= FLOW_TAP_COUNT) {
+        ESP_LOGE(TAG, "[Pour Session] No tap %u", (unsigned)tap);
+        return false;
+    }
+    pour_tap_session_t* s = &sessions[tap];
+    portENTER_CRITICAL(&request_mux);
+    copy_string(s->start_id, sizeof(s->start_id), unique_id);
+    copy_string(s->start_currency, sizeof(s->start_currency), currency);
+    s->start_cost_per_ml = cost_per_ml;
+    s->start_max_ml = max_ml;
+    s->start_pending = true;
+    s->stop_pending = false;  // A cancel queued before this start is for the previous pour
+    portEXIT_CRITICAL(&request_mux);
+    app_events_post(APP_EVENT_POUR_REQUEST);
+    return true;
+}
+
+void pour_session_stop(uint8_t tap) {
+    if (tap >= FLOW_TAP_COUNT) {
+        return;
+    }
+    portENTER_CRITICAL(&request_mux);
+    sessions[tap].stop_pending = true;
+    portEXIT_CRITICAL(&request_mux);
+    app_events_post(APP_EVENT_POUR_REQUEST);
+}
+
+void pour_session_update() {
+    for (uint8_t tap = 0; tap < FLOW_TAP_COUNT; tap++) {
+        session_update(tap);
+    }
+}
+
+bool pour_session_get(uint8_t tap, pour_session_info_t* info) {
+    if (tap >= FLOW_TAP_COUNT) {
+        return false;
+    }
+    portENTER_CRITICAL(&info_mux);
+    *info = published[tap];
+    portEXIT_CRITICAL(&info_mux);
+    return true;
+}
+
+bool pour_session_any_active() {
+    bool active = false;
+    portENTER_CRITICAL(&info_mux);
+    for (uint8_t tap = 0; tap < FLOW_TAP_COUNT; tap++) {
+        active = active || is_active(published[tap].state);
+    }
+    portEXIT_CRITICAL(&info_mux);
+    return active;
+}
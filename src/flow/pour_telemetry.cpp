@@ -0,0 +1,317 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Pour Telemetry Implementation
+ * 
+ * begin/end come from the pour session engine and only hand over a request;
+ * sampling, batching and publishing all happen in pour_telemetry_loop(), so
+ * a slow publish never holds up a state change.
+ */
+
+// Project headers
+#include "config.h"
+#include "flow/pour_telemetry.h"
+
+#if POUR_TELEMETRY_ENABLED
+
+#include "flow/flow_meter.h"
+#include "flow/pour_log.h"
+#include "flow/pour_math.h"
+#include "mqtt/mqtt_manager.h"
+#include "system/perf_monitor.h"
+#include "utils/wire_utils.h"
+
+// System/Standard library headers
+#include <string.h>
+
+// ESP-IDF framework headers
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#define TAG "pour_telem"
+
+#define POUR_ID_MAX POUR_LOG_ID_MAX
+#define POUR_BATCH_SAMPLES ((POUR_TELEMETRY_BATCH_SEC * 1000) / POUR_TELEMETRY_SAMPLE_MS)
+#define POUR_BATCH_HEADER_MAX (2 + POUR_ID_MAX + 2 + 2 + 4 + 4 + 2)
+#define POUR_SAMPLE_MAX 7  // 5 byte varint + u16 rate
+#define POUR_SUMMARY_SIZE 512
+#define POUR_BATCH_VERSION 1
+
+// One tap's pour: requests from begin/end (consumed by the loop) and the pour being sampled
+typedef struct {
+    // Requests, under request_mux
+    bool begin_pending;
+    bool end_pending;
+    bool end_after_begin;  // Both pending for the same (very short) pour
+    char begin_id[POUR_ID_MAX + 1];
+    int64_t begin_price;
+    uint64_t begin_ms;
+    int64_t begin_epoch;
+    bool end_complete;
+    flow_meter_snapshot_t end_snapshot;
+    
+    // Pour being sampled (main task only)
+    bool active;
+    char pour_id[POUR_ID_MAX + 1];
+    int64_t price_micro_per_ml;
+    uint64_t start_ms;
+    int64_t start_epoch;
+    uint64_t last_sample_ms;
+    uint64_t last_volume_ul;
+    uint16_t batch_seq;
+    uint32_t total_samples;
+    
+    // Batch under construction
+    uint8_t batch[POUR_BATCH_HEADER_MAX + POUR_BATCH_SAMPLES * POUR_SAMPLE_MAX];
+    size_t batch_len;
+    size_t batch_count_pos;
+    uint16_t batch_samples;
+} pour_session_t;
+
+static portMUX_TYPE request_mux = portMUX_INITIALIZER_UNLOCKED;
+static pour_session_t sessions[FLOW_TAP_COUNT];
+
+// Summary waiting for the broker when the pour log is not available (retried until published)
+static char summary[POUR_SUMMARY_SIZE];
+static bool summary_pending = false;
+
+#if PERF_MONITOR_ENABLED
+// End-to-end latency report on telemetry/latency after each pour
+static bool latency_pending = false;
+#endif
+
+static uint64_t now_ms() {
+    return (uint64_t)(esp_timer_get_time() / 1000LL);
+}
+
+static void batch_open(pour_session_t* p, uint64_t sample_ms) {
+    size_t id_len = strlen(p->pour_id);
+    uint8_t* b = p->batch;
+    *b++ = POUR_BATCH_VERSION;
+    *b++ = (uint8_t)id_len;
+    memcpy(b, p->pour_id, id_len);
+    b += id_len;
+    put_le16(b, p->batch_seq);
+    put_le16(b + 2, POUR_TELEMETRY_SAMPLE_MS);
+    put_le32(b + 4, (uint32_t)(sample_ms - p->start_ms));
+    put_le32(b + 8, (uint32_t)p->last_volume_ul);
+    b += 12;
+    p->batch_count_pos = (size_t)(b - p->batch);
+    p->batch_len = p->batch_count_pos + 2;
+    p->batch_samples = 0;
+}
+
+static void batch_flush(pour_session_t* p) {
+    if (p->batch_samples == 0) {
+        return;
+    }
+    put_le16(p->batch + p->batch_count_pos, p->batch_samples);
+    
+    // QoS 0 - a lost batch only leaves a gap, the summary carries the totals
+    mqtt_client_publish_telemetry_data("pour", p->batch, p->batch_len, 0);
+    p->batch_seq++;
+    p->batch_samples = 0;
+}
+
+static void add_sample(pour_session_t* p, const flow_meter_snapshot_t* snap) {
+    if (p->batch_samples == 0) {
+        batch_open(p, snap->timestamp_ms);
+    }
+    
+    uint32_t delta = (uint32_t)(snap->volume_ul - p->last_volume_ul);
+    p->last_volume_ul = snap->volume_ul;
+    do {
+        uint8_t bits = delta & 0x7F;
+        delta >>= 7;
+        p->batch[p->batch_len++] = delta ? (bits | 0x80) : bits;
+    } while (delta);
+    
+    float rate_mlpm = snap->flow_rate_smoothed_lpm * 1000.0f;
+    uint16_t rate = rate_mlpm <= 0.0f ? 0 : rate_mlpm >= 65535.0f ? 65535 : (uint16_t)(rate_mlpm + 0.5f);
+    put_le16(p->batch + p->batch_len, rate);
+    p->batch_len += 2;
+    
+    p->batch_samples++;
+    p->total_samples++;
+    if (p->batch_samples >= POUR_BATCH_SAMPLES) {
+        batch_flush(p);
+    }
+}
+
+static void start_pour(pour_session_t* p, const char* id, int64_t price, uint64_t begin_time_ms, int64_t begin_time_epoch) {
+    memcpy(p->pour_id, id, sizeof(p->pour_id));
+    p->price_micro_per_ml = price;
+    p->active = true;
+    p->start_ms = begin_time_ms;
+    p->start_epoch = begin_time_epoch;
+    p->last_sample_ms = 0;
+    p->last_volume_ul = 0;
+    p->batch_seq = 0;
+    p->batch_samples = 0;
+    p->total_samples = 0;
+    ESP_LOGI(TAG, "[Pour Telemetry] Sampling pour %s every %d ms", p->pour_id, POUR_TELEMETRY_SAMPLE_MS);
+}
+
+static void finish_pour(uint8_t tap, bool complete, const flow_meter_snapshot_t* snap) {
+    pour_session_t* p = &sessions[tap];
+    if (!p->active) {
+        return;
+    }
+    p->active = false;
+    
+    // Final volume as the last sample, then whatever is left of the batch
+    add_sample(p, snap);
+    batch_flush(p);
+    
+    ESP_LOGI(TAG, "[Pour Telemetry] Pour %s ended: %u samples in %u batches",
+             p->pour_id, (unsigned)p->total_samples, (unsigned)p->batch_seq);
+    
+    pour_record_t record = {};
+    memcpy(record.id, p->pour_id, sizeof(record.id));
+    record.tap = tap;
+    record.complete = complete;
+    record.pulses = snap->pulses;
+    record.volume_ul = snap->volume_ul;
+    record.cost_minor = pour_cost_minor_units(snap->volume_ul, p->price_micro_per_ml);
+    record.start_epoch = p->start_epoch;
+    record.end_epoch = wall_clock_now();
+    record.duration_ms = snap->timestamp_ms > p->start_ms ? (uint32_t)(snap->timestamp_ms - p->start_ms) : 0;
+    
+    pour_telemetry_report(&record);
+#if PERF_MONITOR_ENABLED
+    latency_pending = true;
+#endif
+}
+
+void pour_telemetry_report(pour_record_t* record) {
+    // The pour log publishes it (and keeps it across reboots until acknowledged)
+    if (pour_log_append(record)) {
+        return;
+    }
+    if (pour_log_format_json(record, 1, summary, sizeof(summary)) == 0) {
+        ESP_LOGW(TAG, "[Pour Telemetry] Summary does not fit in %d bytes", (int)sizeof(summary));
+        return;
+    }
+    if (summary_pending) {
+        ESP_LOGW(TAG, "[Pour Telemetry] Previous summary was never published - replaced");
+    }
+    summary_pending = true;
+}
+
+void pour_telemetry_begin(uint8_t tap, const char* unique_id, int64_t price) {
+    if (tap >= FLOW_TAP_COUNT) {
+        return;
+    }
+    pour_session_t* p = &sessions[tap];
+    portENTER_CRITICAL(&request_mux);
+    strncpy(p->begin_id, unique_id != NULL ? unique_id : "", sizeof(p->begin_id) - 1);
+    p->begin_id[sizeof(p->begin_id) - 1] = '\0';
+    p->begin_price = price;
+    p->begin_ms = now_ms();
+    p->begin_epoch = wall_clock_now();
+    p->begin_pending = true;
+    portEXIT_CRITICAL(&request_mux);
+}
+
+void pour_telemetry_end(uint8_t tap, bool complete) {
+    if (tap >= FLOW_TAP_COUNT) {
+        return;
+    }
+    // Take the final values now - the next pour resets the flow meter
+    flow_meter_snapshot_t snap;
+    flow_meter_get_snapshot(tap, &snap);
+    
+    pour_session_t* p = &sessions[tap];
+    portENTER_CRITICAL(&request_mux);
+    p->end_complete = complete;
+    p->end_snapshot = snap;
+    p->end_after_begin = p->begin_pending;
+    p->end_pending = true;
+    portEXIT_CRITICAL(&request_mux);
+}
+
+// Apply one tap's requests and take its sample
+static void session_loop(uint8_t tap) {
+    pour_session_t* p = &sessions[tap];
+    bool do_begin = false;
+    bool do_end = false;
+    bool end_last = false;
+    bool complete = false;
+    char id[POUR_ID_MAX + 1];
+    int64_t price = 0;
+    uint64_t begin_time_ms = 0;
+    int64_t begin_time_epoch = 0;
+    flow_meter_snapshot_t final_snap;
+    
+    portENTER_CRITICAL(&request_mux);
+    if (p->begin_pending) {
+        do_begin = true;
+        p->begin_pending = false;
+        memcpy(id, p->begin_id, sizeof(id));
+        price = p->begin_price;
+        begin_time_ms = p->begin_ms;
+        begin_time_epoch = p->begin_epoch;
+    }
+    if (p->end_pending) {
+        do_end = true;
+        p->end_pending = false;
+        end_last = p->end_after_begin;
+        complete = p->end_complete;
+        final_snap = p->end_snapshot;
+    }
+    portEXIT_CRITICAL(&request_mux);
+    
+    // Apply in the order they were made (a short pour can queue both begin and end)
+    if (do_end && !end_last) {
+        finish_pour(tap, complete, &final_snap);
+    }
+    if (do_begin) {
+        // A new pour means the previous one is over, even if its end was lost
+        if (p->active) {
+            flow_meter_snapshot_t snap;
+            flow_meter_get_snapshot(tap, &snap);
+            finish_pour(tap, false, &snap);
+        }
+        start_pour(p, id, price, begin_time_ms, begin_time_epoch);
+    }
+    if (do_end && end_last) {
+        finish_pour(tap, complete, &final_snap);
+    }
+    
+    if (p->active) {
+        flow_meter_snapshot_t snap;
+        flow_meter_get_snapshot(tap, &snap);
+        if (p->last_sample_ms == 0 || snap.timestamp_ms - p->last_sample_ms >= POUR_TELEMETRY_SAMPLE_MS) {
+            p->last_sample_ms = snap.timestamp_ms ? snap.timestamp_ms : 1;
+            add_sample(p, &snap);
+        }
+    }
+}
+
+void pour_telemetry_loop() {
+    for (uint8_t tap = 0; tap < FLOW_TAP_COUNT; tap++) {
+        session_loop(tap);
+    }
+    
+    if (summary_pending && mqtt_client_is_connected()) {
+        summary_pending = mqtt_client_publish_telemetry_data("pour_summary", summary, strlen(summary), 1) < 0;
+    }
+#if PERF_MONITOR_ENABLED
+    if (latency_pending && mqtt_client_is_connected()) {
+        // QoS 0 - the histograms are cumulative, the next pour's report covers a lost one
+        static char report[768];
+        if (perf_monitor_format_latency_json(report, sizeof(report)) > 0) {
+            mqtt_client_publish_telemetry("latency", report);
+        }
+        latency_pending = false;
+    }
+#endif
+}
+
+#endif // POUR_TELEMETRY_ENABLED
@@ -0,0 +1,198 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Pulse Recorder Implementation
+ * 
+ * The flow meter's edge hook appends to the trace under a spinlock from the
+ * edge interrupt. Data bytes never change once written, so a dump copies the
+ * header under the lock and then streams the data without it, even while
+ * recording carries on.
+ */
+
+// Project headers
+#include "config.h"
+#include "flow/pulse_recorder.h"
+
+#if PULSE_TRACE_ENABLED
+
+#include "flow/flow_meter.h"
+#include "flow/pulse_trace.h"
+#include "mqtt/mqtt_manager.h"
+
+// System/Standard library headers
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+// ESP-IDF framework headers
+#include <esp_attr.h>
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+#include <freertos/FreeRTOS.h>
+#define TAG "pulse_trace"
+
+#define DUMP_LINE_BYTES 32
+
+static portMUX_TYPE trace_mux = portMUX_INITIALIZER_UNLOCKED;
+static uint8_t* buffer = NULL;
+static pulse_trace_t trace;                  // trace_mux
+static volatile int recording_tap = -1;      // -1 = not recording
+
+// Edge hook: ISR context on the flow meter's edge interrupt
+static void IRAM_ATTR on_edge(uint8_t tap, uint32_t time_us) {
+    portENTER_CRITICAL_ISR(&trace_mux);
+    if ((int)tap == recording_tap) {
+        pulse_trace_append(&trace, time_us);
+    }
+    portEXIT_CRITICAL_ISR(&trace_mux);
+}
+
+static pulse_trace_header_t header_copy() {
+    portENTER_CRITICAL(&trace_mux);
+    pulse_trace_header_t header = trace.header;
+    portEXIT_CRITICAL(&trace_mux);
+    return header;
+}
+
+bool pulse_recorder_init() {
+    if (buffer != NULL) {
+        return true;
+    }
+    buffer = (uint8_t*)heap_caps_malloc(PULSE_TRACE_BUFFER_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (buffer == NULL) {
+        ESP_LOGE(TAG, "[Pulse Trace] No memory for the %d byte buffer", PULSE_TRACE_BUFFER_SIZE);
+        return false;
+    }
+    pulse_trace_init(&trace, buffer, PULSE_TRACE_BUFFER_SIZE, 0, 0, 0);
+    return true;
+}
+
+bool pulse_recorder_start(uint8_t tap) {
+    if (buffer == NULL || tap >= FLOW_TAP_COUNT) {
+        return false;
+    }
+    pulse_recorder_stop();
+    
+    portENTER_CRITICAL(&trace_mux);
+    pulse_trace_init(&trace, buffer, PULSE_TRACE_BUFFER_SIZE, tap,
+                     FLOW_METER_USE_PCNT ? PULSE_TRACE_FLAG_PCNT : 0, flow_meter_get_calibration(tap));
+    recording_tap = tap;
+    portEXIT_CRITICAL(&trace_mux);
+    
+    flow_meter_set_edge_hook(tap, on_edge);
+    ESP_LOGI(TAG, "[Pulse Trace] Recording tap %u (%d byte buffer)", (unsigned)tap, PULSE_TRACE_BUFFER_SIZE);
+    return true;
+}
+
+void pulse_recorder_stop() {
+    int tap = recording_tap;
+    if (tap < 0) {
+        return;
+    }
+    flow_meter_set_edge_hook((uint8_t)tap, NULL);
+    recording_tap = -1;
+    pulse_trace_header_t header = header_copy();
+    ESP_LOGI(TAG, "[Pulse Trace] Tap %d stopped: %" PRIu32 " edges, %" PRIu32 " bytes%s", tap,
+             header.count, header.data_len, (header.flags & PULSE_TRACE_FLAG_TRUNCATED) ? " (truncated)" : "");
+}
+
+// Feed the trace image to out: the header, then the data in pieces of up to max bytes
+static void emit_image(size_t max, void (*out)(const uint8_t* data, size_t len, uint32_t offset, uint32_t total)) {
+    pulse_trace_header_t header = header_copy();
+    uint32_t total = (uint32_t)sizeof(header) + header.data_len;
+    out((const uint8_t*)&header, sizeof(header), 0, total);
+    for (uint32_t pos = 0; pos < header.data_len; pos += (uint32_t)max) {
+        size_t len = header.data_len - pos < max ? header.data_len - pos : max;
+        out(buffer + pos, len, (uint32_t)sizeof(header) + pos, total);
+    }
+}
+
+static bool publish_failed = false;
+
+// MQTT task only (commands)
+static void publish_chunk(const uint8_t* data, size_t len, uint32_t offset, uint32_t total) {
+    static uint8_t message[8 + PULSE_TRACE_CHUNK_SIZE];
+    memcpy(message, &offset, 4);
+    memcpy(message + 4, &total, 4);
+    memcpy(message + 8, data, len);
+    if (mqtt_client_publish_telemetry_data("trace", message, 8 + len, 1) < 0) {
+        publish_failed = true;
+    }
+}
+
+static void print_line(const uint8_t* data, size_t len, uint32_t offset, uint32_t total) {
+    (void)total;
+    char line[16 + DUMP_LINE_BYTES * 2];
+    int n = snprintf(line, sizeof(line), "trace %06" PRIx32 " ", offset);
+    for (size_t i = 0; i < len; i++) {
+        n += snprintf(line + n, sizeof(line) - n, "%02x", data[i]);
+    }
+    printf("%s\n", line);
+}
+
+size_t pulse_recorder_command(JsonObjectConst cmd, char* reply, size_t size) {
+    const char* action = cmd["action"] | "";
+    const char* error = NULL;
+    
+    if (buffer == NULL) {
+        error = "no buffer";
+    } else if (strcmp(action, "start") == 0) {
+        int tap = cmd["tap"] | 0;
+        if (tap < 0 || tap >= FLOW_TAP_COUNT) {
+            error = "invalid tap";
+        } else {
+            pulse_recorder_start((uint8_t)tap);
+        }
+    } else if (strcmp(action, "stop") == 0) {
+        pulse_recorder_stop();
+    } else if (strcmp(action, "dump") == 0) {
+        publish_failed = false;
+        emit_image(PULSE_TRACE_CHUNK_SIZE, publish_chunk);
+        if (publish_failed) {
+            error = "publish failed";
+        }
+    } else if (strcmp(action, "status") != 0) {
+        error = "unknown action";
+    }
+    
+    pulse_trace_header_t header = header_copy();
+    JsonDocument doc;
+    doc["action"] = action;
+    doc["ok"] = (error == NULL);
+    if (error != NULL) {
+        doc["error"] = error;
+        ESP_LOGW(TAG, "[Pulse Trace] %s: %s", action, error);
+    }
+    doc["tap"] = header.tap;
+    doc["recording"] = recording_tap >= 0;
+    doc["edges"] = header.count;
+    doc["bytes"] = (uint32_t)sizeof(header) + header.data_len;
+    doc["truncated"] = (header.flags & PULSE_TRACE_FLAG_TRUNCATED) != 0;
+    if (measureJson(doc) >= size) {
+        return 0;
+    }
+    return serializeJson(doc, reply, size);
+}
+
+void pulse_recorder_log_status() {
+    pulse_trace_header_t header = header_copy();
+    ESP_LOGI(TAG, "[Pulse Trace] Tap %u %s: %" PRIu32 " edges, %" PRIu32 " of %d bytes%s", (unsigned)header.tap,
+             recording_tap >= 0 ? "recording" : "stopped", header.count, header.data_len, PULSE_TRACE_BUFFER_SIZE,
+             (header.flags & PULSE_TRACE_FLAG_TRUNCATED) ? " (truncated)" : "");
+}
+
+void pulse_recorder_print_dump() {
+    if (buffer == NULL) {
+        return;
+    }
+    emit_image(DUMP_LINE_BYTES, print_line);
+    fflush(stdout);
+}
+
+#endif // PULSE_TRACE_ENABLED
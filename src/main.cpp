@@ -29,6 +29,7 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <nvs_flash.h>
+#include <stdlib.h>
 #include <time.h>
 #if ENABLE_WATCHDOG
 #include <esp_task_wdt.h>
@@ -42,15 +43,40 @@
 // Project headers (continued)
 #include "system/esp_idf_compat.h"
 #include "system/esp_system_compat.h"
+#include "system/app_events.h"
+#include "system/boot.h"
+#include "system/boot_profile.h"
+#include "system/config_store.h"
+#include "system/health_monitor.h"
+#include "system/log_ring.h"
+#include "system/log_sink.h"
+#include "system/ota_update.h"
+#include "system/perf_monitor.h"
+#include "system/power_manager.h"
+#include "system/serial_console.h"
+#include "flow/flow_calibration.h"
 #include "flow/flow_meter.h"
+#include "flow/pour_checkpoint.h"
+#include "flow/pour_controller.h"
+#include "flow/pour_log.h"
+#include "flow/pour_math.h"
+#include "flow/pour_session.h"
+#include "flow/pour_telemetry.h"
+#include "flow/flow_stats.h"
+#include "flow/pulse_recorder.h"
+#include "display/display_power.h"
 #include "display/lvgl_display.h"
 #include "display/lvgl_touch.h"
 #include "mqtt/mqtt_manager.h"
+#include "mqtt/seen_id_cache.h"
 #include "ui/splashscreen.h"
+#include "utils/asset_store.h"
+#include "utils/lv_pool.h"
 #include "wifi/wifi_manager.h"
 
 // Include screen manager for UI
 #include "ui/screen_manager.h"
+#include "ui/ui_task.h"
 
 // LVGL tick timer
 // hw_timer_t is defined in esp_idf_compat.h
@@ -63,6 +89,115 @@ static unsigned long last_error_time = 0;
 
 // Screen state is now managed by screen_manager
 
+#if PERF_MONITOR_ENABLED
+// Publish the profiler report on prefix/chip_id/telemetry/perf
+static void publish_perf_report() {
+    static char report[1536];
+    if (perf_monitor_format_json(report, sizeof(report)) == 0) {
+        ESP_LOGW(TAG_MAIN, "[Perf] Report does not fit in %d bytes", (int)sizeof(report));
+        return;
+    }
+    if (mqtt_client_is_connected()) {
+        mqtt_client_publish_telemetry("perf", report);
+    }
+}
+
+// Serial command: "perf" prints the report, "perf reset" clears it
+static void console_perf(const char* args) {
+    if (strcmp(args, "reset") == 0) {
+        perf_monitor_reset();
+        ESP_LOGI(TAG_MAIN, "[Perf] Histograms reset");
+        return;
+    }
+    perf_monitor_log_report();
+}
+#endif
+
+#if LVGL_POOL_ENABLED
+// Serial command: "lvmem" prints the LVGL pool usage
+static void console_lvmem(const char* args) {
+    (void)args;
+    lv_pool_log_report();
+}
+#endif
+
+#if HEALTH_MONITOR_ENABLED
+// Serial command: "health" prints heap and stack headroom
+static void console_health(const char* args) {
+    (void)args;
+    health_monitor_log_report();
+}
+#endif
+
+#if LOG_RING_ENABLED
+// One rendered chunk of the log ring on prefix/chip_id/telemetry/logs
+static void publish_log_chunk(const char* text, size_t len, int index, bool last, void* ctx) {
+    (void)len;
+    (void)ctx;
+    JsonDocument doc;
+    doc["chunk"] = index;
+    doc["last"] = last;
+    doc["text"] = text;  // NUL-terminated at len
+    size_t size = measureJson(doc) + 1;
+    char* payload = (char*)malloc(size);
+    if (payload == NULL) {
+        return;
+    }
+    serializeJson(doc, payload, size);
+    mqtt_client_publish_telemetry("logs", payload);
+    free(payload);
+}
+
+// Logs command: prefix/chip_id/commands/logs, {"clear":true} empties the ring afterwards
+static void on_logs_command(JsonObjectConst cmd) {
+    int records = log_ring_render(publish_log_chunk, NULL);
+    ESP_LOGI(TAG_MAIN, "[Log Ring] Sent %d records", records);
+    if (cmd["clear"] | false) {
+        log_ring_clear();
+    }
+}
+
+static void print_log_chunk(const char* text, size_t len, int index, bool last, void* ctx) {
+    (void)index;
+    (void)last;
+    (void)ctx;
+    fwrite(text, 1, len, stdout);
+}
+
+// Serial command: "logs" prints the log ring, "logs clear" empties it
+static void console_logs(const char* args) {
+    if (strcmp(args, "clear") == 0) {
+        log_ring_clear();
+        return;
+    }
+    log_ring_render(print_log_chunk, NULL);
+    fflush(stdout);
+}
+#endif
+
+#if PULSE_TRACE_ENABLED
+// Serial command: "trace start <tap>", "trace stop", "trace dump", "trace" for the status
+static void console_trace(const char* args) {
+    if (strncmp(args, "start", 5) == 0) {
+        pulse_recorder_start((uint8_t)atoi(args + 5));
+    } else if (strcmp(args, "stop") == 0) {
+        pulse_recorder_stop();
+    } else if (strcmp(args, "dump") == 0) {
+        pulse_recorder_print_dump();
+        return;
+    }
+    pulse_recorder_log_status();
+}
+#endif
+
+#if BOOT_PROFILE_ENABLED
+// Serial command: "boot" prints this boot's phase timings
+static void console_boot(const char* args) {
+    (void)args;
+    boot_profile_log_report();
+}
+#endif
+
 // LVGL tick handler (called by timer)
 // ESP-IDF: Timer callback runs in task context (not ISR), so use portENTER_CRITICAL
 void lvgl_tick_handler(void* arg) {
@@ -71,83 +206,167 @@ void lvgl_tick_handler(void* arg) {
     portEXIT_CRITICAL(&lvgl_timer_mux);
 }
 
-// MQTT message handler for screen switching and commands
-void on_mqtt_message(char* topic, byte* payload, unsigned int length) {
-    // Null-terminate the payload
-    char message[512] = {0};
-    if (length < sizeof(message)) {
-        memcpy(message, payload, length);
-        message[length] = '\0';
-    } else {
-        memcpy(message, payload, sizeof(message) - 1);
+// MQTT parse errors count towards the error reset (the dispatcher has logged the error)
+static void on_mqtt_parse_error(const char* error) {
+    (void)error;
+    consecutive_errors++;
+    last_error_time = millis();
+}
+
+// Pour session state changes (main loop): the screens follow the session
+static void on_pour_session_state(uint8_t tap, pour_session_state_t state) {
+    if (state == POUR_SESSION_ARMED) {
+        ui_task_show_pouring(tap);
+    } else if (state == POUR_SESSION_REPORTED) {
+        pour_session_info_t info;
+        pour_session_get(tap, &info);
+        if (info.complete) {
+            // Integer accounting, converted for display only
+            ui_task_show_finished(tap, (float)info.volume_ul / 1000.0f,
+                                  (float)info.cost_minor / (float)POUR_MINOR_PER_MAJOR, info.currency);
+        }
+    }
+}
+
+// IDs of accepted paid commands (only touched on the esp-mqtt task)
+static seen_id_cache_t paid_ids;
+
+// "paid" command: prefix/chip_id/commands/paid
+// Expected format: {"id":"unique_id","cost_per_ml":0.005,"max_ml":500,"currency":"GBP","tap":0}
+// "tap" is optional (0-based, default 0) and selects the flow meter and valve
+static void on_paid_command(JsonObjectConst cmd) {
+    // Validate JSON structure and extract fields with bounds checking
+    const char* unique_id = cmd["id"] | "";
+    float cost_per_ml = cmd["cost_per_ml"] | 0.0;
+    int max_ml = cmd["max_ml"] | 0;
+    const char* currency = cmd["currency"] | "";  // Optional: Standard ISO code "GBP" or "USD"
+    int tap = cmd["tap"] | 0;
+    
+    // Validate fields with reasonable bounds
+    bool valid = true;
+    if (strlen(unique_id) == 0 || strlen(unique_id) > 128) {
+        ESP_LOGW(TAG_MQTT, "[MQTT] Invalid unique_id: empty or too long");
+        valid = false;
+    }
+    if (cost_per_ml <= 0.0 || cost_per_ml > 1000.0) {
+        ESP_LOGW(TAG_MQTT, "[MQTT] Invalid cost_per_ml: %.4f (must be 0 < cost <= 1000)", cost_per_ml);
+        valid = false;
+    }
+    if (max_ml <= 0 || max_ml > 100000) {
+        ESP_LOGW(TAG_MQTT, "[MQTT] Invalid max_ml: %d (must be 0 < max <= 100000)", max_ml);
+        valid = false;
+    }
+    if (strlen(currency) > 0 && strcmp(currency, "GBP") != 0 && strcmp(currency, "USD") != 0) {
+        ESP_LOGW(TAG_MQTT, "[MQTT] Invalid currency: %s (must be GBP or USD)", currency);
+        valid = false;
+    }
+    if (tap < 0 || tap >= FLOW_TAP_COUNT) {
+        ESP_LOGW(TAG_MQTT, "[MQTT] Invalid tap: %d (must be 0 <= tap < %d)", tap, FLOW_TAP_COUNT);
+        valid = false;
     }
     
-    ESP_LOGI(TAG_MQTT, "[MQTT] Received message on topic: %s", topic);
-    ESP_LOGI(TAG_MQTT, "[MQTT] Payload: %s", message);
-    
-    // Check if this is the "paid" command topic
-    if (strstr(topic, "/commands/paid") != NULL) {
-        // Parse JSON payload for "paid" command
-        // Expected format: {"id":"unique_id","cost_per_ml":0.005,"max_ml":500,"currency":"GBP"}
-        JsonDocument doc;
-        DeserializationError error = deserializeJson(doc, message);
+    if (valid && strlen(unique_id) > 0 && cost_per_ml > 0 && max_ml > 0) {
+        // Reset error counter on successful parse
+        consecutive_errors = 0;
         
-        if (error) {
-            ESP_LOGE(TAG_MQTT, "[MQTT] JSON parse error: %s", error.c_str());
-            consecutive_errors++;
-            last_error_time = millis();
+        // A QoS 1 redelivery of a pour already started: esp-mqtt has acked it, nothing else to do
+        if (seen_id_check_and_add(&paid_ids, unique_id)) {
+            ESP_LOGW(TAG_MQTT, "[MQTT] Duplicate paid command ignored, ID: %s", unique_id);
             return;
         }
-        
-        // Validate JSON structure and extract fields with bounds checking
-        const char* unique_id = doc["id"] | "";
-        float cost_per_ml = doc["cost_per_ml"] | 0.0;
-        int max_ml = doc["max_ml"] | 0;
-        const char* currency = doc["currency"] | "";  // Optional: Standard ISO code "GBP" or "USD"
-        
-        // Validate fields with reasonable bounds
-        bool valid = true;
-        if (strlen(unique_id) == 0 || strlen(unique_id) > 128) {
-            ESP_LOGW(TAG_MQTT, "[MQTT] Invalid unique_id: empty or too long");
-            valid = false;
-        }
-        if (cost_per_ml <= 0.0 || cost_per_ml > 1000.0) {
-            ESP_LOGW(TAG_MQTT, "[MQTT] Invalid cost_per_ml: %.4f (must be 0 < cost <= 1000)", cost_per_ml);
-            valid = false;
-        }
-        if (max_ml <= 0 || max_ml > 100000) {
-            ESP_LOGW(TAG_MQTT, "[MQTT] Invalid max_ml: %d (must be 0 < max <= 100000)", max_ml);
-            valid = false;
-        }
-        if (strlen(currency) > 0 && strcmp(currency, "GBP") != 0 && strcmp(currency, "USD") != 0) {
-            ESP_LOGW(TAG_MQTT, "[MQTT] Invalid currency: %s (must be GBP or USD)", currency);
-            valid = false;
+        perf_monitor_mark(PERF_MARK_PAID);
+        ESP_LOGI(TAG_MQTT, "[MQTT] Paid command received:");
+        ESP_LOGI(TAG_MQTT, "  ID: %s", unique_id);
+        ESP_LOGI(TAG_MQTT, "  Cost per ml: %.4f", cost_per_ml);
+        ESP_LOGI(TAG_MQTT, "  Max ml: %d", max_ml);
+        ESP_LOGI(TAG_MQTT, "  Tap: %d", tap);
+        if (strlen(currency) > 0) {
+            ESP_LOGI(TAG_MQTT, "  Currency: %s", currency);
         }
         
-        if (valid && strlen(unique_id) > 0 && cost_per_ml > 0 && max_ml > 0) {
-            // Reset error counter on successful parse
-            consecutive_errors = 0;
-            ESP_LOGI(TAG_MQTT, "[MQTT] Paid command received:");
-            ESP_LOGI(TAG_MQTT, "  ID: %s", unique_id);
-            ESP_LOGI(TAG_MQTT, "  Cost per ml: %.4f", cost_per_ml);
-            ESP_LOGI(TAG_MQTT, "  Max ml: %d", max_ml);
-            if (strlen(currency) > 0) {
-                ESP_LOGI(TAG_MQTT, "  Currency: %s", currency);
-            }
-            
-            // Start pouring with these parameters using screen manager
-            screen_manager_show_pouring(unique_id, cost_per_ml, max_ml, currency);
-        } else {
-            ESP_LOGW(TAG_MQTT, "[MQTT] Invalid paid command - validation failed");
-            consecutive_errors++;
-            last_error_time = millis();
+        // Start pouring with these parameters (applied on the main loop)
+        pour_session_start((uint8_t)tap, unique_id, cost_per_ml, max_ml, currency);
+    } else {
+        ESP_LOGW(TAG_MQTT, "[MQTT] Invalid paid command - validation failed");
+        consecutive_errors++;
+        last_error_time = millis();
+    }
+}
+
+// General commands: prefix/chip_id/commands
+// Note: Most commands are now handled by screen_manager
+// Legacy commands can be added here if needed
+static void on_general_command(JsonObjectConst cmd) {
+    #if PERF_MONITOR_ENABLED
+    // {"cmd":"perf"} publishes the profiler report, "reset":true clears it afterwards
+    if (strcmp(cmd["cmd"] | "", "perf") == 0) {
+        publish_perf_report();
+        if (cmd["reset"] | false) {
+            perf_monitor_reset();
         }
-        return;
     }
-    
-    // Handle other commands on the general commands topic
-    // Note: Most commands are now handled by screen_manager
-    // Legacy commands can be added here if needed
+    #endif
+
+    // {"cmd":"touch_cal"} runs the 3-point touch calibration on screen, "reset":true restores the default
+    if (strcmp(cmd["cmd"] | "", "touch_cal") == 0) {
+        ui_task_touch_calibration(cmd["reset"] | false);
+    }
+}
+
+// Config command: prefix/chip_id/commands/config, e.g. {"currency":"EUR "}; {} only reports
+static void on_config_command(JsonObjectConst cmd) {
+    int changed = config_store_apply_json(cmd);
+    if (changed < 0) {
+        ESP_LOGW(TAG_MAIN, "[Config] Invalid config command - nothing applied");
+    } else if (changed > 0) {
+        ESP_LOGI(TAG_MAIN, "[Config] %d setting(s) updated remotely", changed);
+    }
+    char report[256];
+    if (config_store_format_json(report, sizeof(report)) > 0) {
+        mqtt_client_publish_telemetry("config", report);
+    }
+}
+
+// Calibration pour commands: prefix/chip_id/commands/calibrate
+static void on_calibrate_command(JsonObjectConst cmd) {
+    char reply[512];
+    if (flow_calibration_command(cmd, reply, sizeof(reply)) > 0) {
+        mqtt_client_publish_telemetry("calibration", reply);
+    }
+}
+
+// Firmware update commands: prefix/chip_id/commands/ota
+static void on_ota_command(JsonObjectConst cmd) {
+    char reply[320];
+    if (ota_update_command(cmd, reply, sizeof(reply)) > 0) {
+        mqtt_client_publish_telemetry("ota", reply);
+    }
+}
+
+#if PULSE_TRACE_ENABLED
+// Pulse trace capture commands: prefix/chip_id/commands/trace
+static void on_trace_command(JsonObjectConst cmd) {
+    char reply[192];
+    if (pulse_recorder_command(cmd, reply, sizeof(reply)) > 0) {
+        mqtt_client_publish_telemetry("trace_status", reply);
+    }
+}
+#endif
+
+// Serial command: "config" prints the settings
+static void console_config(const char* args) {
+    (void)args;
+    char report[256];
+    if (config_store_format_json(report, sizeof(report)) > 0) {
+        ESP_LOGI(TAG_MAIN, "[Config] %s", report);
+    }
+}
+
+// Mark a boot stage ready and show it on the splashscreen
+static void boot_splash_step(uint32_t stage, const char* status) {
+    boot_mark_ready(stage);
+    splashscreen_set_progress(boot_get_progress());
+    splashscreen_set_status(status);
 }
 
 // ets_printf is declared in esp_rom_sys.h, no need for forward declaration
@@ -177,16 +396,22 @@ extern "C" void app_main() {
         ret = nvs_flash_init();
     }
     ESP_ERROR_CHECK(ret);
+    boot_profile_mark(BOOT_PHASE_NVS);
     
     // Initialize serial communication (UART for ESP-IDF)
-    // Serial logging is handled by ESP_LOG
+    // Serial logging is handled by ESP_LOG, queued through the async sink
+    log_sink_init();
+    log_ring_init();  // Recent lines kept in RTC memory across soft resets
+    config_store_init();  // Persisted settings, before anything reads them
     
     // Initialize GPIO ISR service early (before touch/flow meter use it)
     // Temporarily suppress ESP-IDF error logging to avoid "already installed" errors
     // (ESP-IDF logs errors internally before returning error codes)
     esp_log_level_set("gpio", ESP_LOG_WARN);
     
-    esp_err_t gpio_isr_ret = gpio_install_isr_service(0);
+    // IRAM: every GPIO handler (flow pulses, touch, valve cut-off) lives in IRAM, so
+    // edges are still counted while flash is busy (e.g. a settings save)
+    esp_err_t gpio_isr_ret = gpio_install_isr_service(ESP_INTR_FLAG_IRAM);
     
     // Restore normal log level
     esp_log_level_set("gpio", ESP_LOG_ERROR);
@@ -222,11 +447,64 @@ extern "C" void app_main() {
     // Don't add app_main to watchdog - it will exit quickly
     // The main loop task will be added after it's created
     #endif
-    
+
+    // Event group must exist before any producer (flow task, WiFi, MQTT, touch) starts
+    app_events_init();
+    
+    // Profiler and serial console ("perf" command)
+    perf_monitor_init();
+    serial_console_init();
+    serial_console_register("config", console_config);
+    #if PERF_MONITOR_ENABLED
+    serial_console_register("perf", console_perf);
+    #endif
+    #if BOOT_PROFILE_ENABLED
+    serial_console_register("boot", console_boot);
+    #endif
+    #if LVGL_POOL_ENABLED
+    serial_console_register("lvmem", console_lvmem);
+    #endif
+    #if HEALTH_MONITOR_ENABLED
+    serial_console_register("health", console_health);
+    #endif
+    #if LOG_RING_ENABLED
+    serial_console_register("logs", console_logs);
+    #endif
+    #if PULSE_TRACE_ENABLED
+    serial_console_register("trace", console_trace);
+    #endif
+
     // Initialize error tracking
     consecutive_errors = 0;
     last_error_time = 0;
     
+    // Get chip ID for MQTT using SOC UID (unique chip identifier)
+    char chip_id[17] = {0};  // 16 hex chars + null terminator for 64-bit SOC UID
+    if (get_soc_uid_string(chip_id, sizeof(chip_id))) {
+        ESP_LOGI(TAG_MAIN, "[Setup] SOC UID: %s", chip_id);
+    } else {
+        ESP_LOGE(TAG_MAIN, "[Setup] Failed to get SOC UID");
+        chip_id[0] = '\0';  // Ensure it's empty on failure
+    }
+    
+    // Bring WiFi, NTP and MQTT up in the background while the UI boots
+    // (the QR screen does not need the network; header icons follow APP_EVENT_NETWORK)
+    mqtt_client_on_command(MQTT_SUFFIX_PAID, on_paid_command);
+    mqtt_client_on_command(MQTT_SUFFIX_COMMANDS, on_general_command);
+    mqtt_client_on_command(MQTT_SUFFIX_CONFIG, on_config_command);
+    mqtt_client_on_command(MQTT_SUFFIX_CALIBRATE, on_calibrate_command);
+    #if OTA_UPDATES_ENABLED
+    mqtt_client_on_command(MQTT_SUFFIX_OTA, on_ota_command);
+    #endif
+    #if LOG_RING_ENABLED
+    mqtt_client_on_command(MQTT_SUFFIX_LOGS, on_logs_command);
+    #endif
+    #if PULSE_TRACE_ENABLED
+    mqtt_client_on_command(MQTT_SUFFIX_TRACE, on_trace_command);
+    #endif
+    mqtt_client_set_parse_error_callback(on_mqtt_parse_error);
+    boot_start_network(chip_id);
+    
     // Log startup info with date/time if available
     time_t now = 0;
     struct tm timeinfo;
@@ -260,17 +538,25 @@ extern "C" void app_main() {
     
     // Initialize backlight early so we can see the display
     ESP_LOGI(TAG_MAIN, "[DEBUG] About to initialize backlight...");
+    power_manager_init();  // Before anything takes a power hold
+    #if DISPLAY_POWER_ENABLED
+    display_power_init();
+    #else
     pinMode(TFT_BL, OUTPUT);
     digitalWrite(TFT_BL, HIGH);
+    #endif
     ESP_LOGI(TAG_MAIN, "[DEBUG] Backlight initialized");
     
     // Initialize LVGL
     ESP_LOGI(TAG_MAIN, "[DEBUG] About to initialize LVGL...");
+    lv_pool_init();  // Arena must exist before LVGL's first allocation
     lv_init();
+    boot_profile_mark(BOOT_PHASE_LVGL);
     ESP_LOGI(TAG_MAIN, "LVGL initialized");
     
     // Initialize display driver
     lvgl_display_init();
+    boot_profile_mark(BOOT_PHASE_DISPLAY);
     
     // Set up LVGL tick timer (1ms)
     // ESP-IDF: Use esp_timer for 1ms periodic timer
@@ -287,40 +573,32 @@ extern "C" void app_main() {
         lvgl_timer->callback = NULL;  // Not used with esp_timer
     }
     
+    // Map the branding images before the first screen uses them
+    asset_store_init();
+    
     // Show splashscreen early (must be after display and timer are ready)
+    // Progress follows the stages as they actually complete - no fixed delays
     splashscreen_init();
-    splashscreen_set_progress(10);
-    splashscreen_set_status("Starting up...");
-    delay(200);
+    boot_splash_step(BOOT_READY_DISPLAY, "Starting up...");
     
-    // Initialize touch driver (30%)
+    // Initialize touch driver
     lvgl_touch_init();
-    splashscreen_set_progress(30);
-    splashscreen_set_status("Touch initialized");
-    delay(150);
-    
-    // System information gathering (40%)
-    splashscreen_set_progress(40);
-    splashscreen_set_status("System ready");
-    delay(150);
+    boot_profile_mark(BOOT_PHASE_TOUCH);
+    boot_splash_step(BOOT_READY_TOUCH, "Touch initialized");
     
-    // Initialize flow meter (50%)
+    // Initialize flow meter
     flow_meter_init();
-    splashscreen_set_progress(50);
-    splashscreen_set_status("Flow meter ready");
-    delay(200);
-    
-    // Prepare main UI (70%)
-    splashscreen_set_progress(70);
-    splashscreen_set_status("Loading PrecisionPour...");
-    delay(200);
-    
-    // Set progress to 90% BEFORE initializing UI (UI init will clear screen)
-    ESP_LOGI(TAG_MAIN, "[Setup] Setting progress to 90%...");
-    splashscreen_set_progress(90);
+    pulse_recorder_init();  // Trace buffer for "trace start"
+    pour_controller_init();
+    pour_session_set_listener(on_pour_session_state);
+    pour_log_init();
+    pour_checkpoint_recover();  // Bill a pour cut short by a reset
+    health_monitor_init();  // Heap/stack watermarks, published once MQTT is up
+    ota_update_init();  // A freshly updated image is confirmed once it proves healthy
+    boot_splash_step(BOOT_READY_FLOW, "Flow meter ready");
+    
+    // UI init will clear the screen
     splashscreen_set_status("Loading UI...");
-    ESP_LOGI(TAG_MAIN, "[Setup] Progress set to 90%");
-    delay(200);
     
     // Set background to pure black (RGB 0,0,0) BEFORE removing splashscreen
     lv_obj_set_style_bg_color(lv_scr_act(), lv_color_hex(0x000000), 0);
@@ -347,98 +625,44 @@ extern "C" void app_main() {
     screen_manager_show_qr_code();  // Show QR code screen after splash
     ESP_LOGI(TAG_MAIN, "[Setup] Screen manager initialized - DONE");
     
+    // Hand LVGL over to the UI task - no lv_* calls from this task after this point
+    if (!ui_task_start()) {
+        ESP_LOGE(TAG_MAIN, "[Setup] UI task failed to start - display will not update");
+    }
+    boot_mark_ready(BOOT_READY_UI);
+    
     // Finalize (100% - just for logging, splashscreen is already gone)
     ESP_LOGI(TAG_MAIN, "[Setup] Setup sequence complete!");
     ESP_LOGI(TAG_MAIN, "========================================");
     ESP_LOGI(TAG_MAIN, "SETUP COMPLETE!");
     ESP_LOGI(TAG_MAIN, "========================================");
     
-    // Initialize WiFi connection
-    ESP_LOGI(TAG_MAIN, "[Setup] Initializing WiFi...");
-    bool wifi_init_ok = wifi_manager_init();
-    if (!wifi_init_ok) {
-        ESP_LOGW(TAG_MAIN, "[Setup] WiFi initialization failed, will retry in loop");
-    }
-    
-    // Wait for WiFi to actually connect and get IP address
-    // WiFi connection happens asynchronously via events, so we need to wait
-    ESP_LOGI(TAG_MAIN, "[Setup] Waiting for WiFi connection and IP assignment...");
-    unsigned long wifi_wait_start = millis();
-    const unsigned long wifi_wait_timeout = 30000;  // 30 second timeout
-    bool wifi_connected = false;
-    bool ip_assigned = false;
-    
-    while ((millis() - wifi_wait_start) < wifi_wait_timeout) {
-        if (wifi_manager_is_connected()) {
-            wifi_connected = true;
-            String ip = wifi_manager_get_ip();
-            if (!ip.empty() && ip != "Not connected") {
-                ip_assigned = true;
-                ESP_LOGI(TAG_MAIN, "[Setup] WiFi connected with IP: %s", ip.c_str());
-                break;
-            }
-        }
-        vTaskDelay(pdMS_TO_TICKS(500));  // Check every 500ms
-    }
-    
-    if (!wifi_connected || !ip_assigned) {
-        ESP_LOGW(TAG_MAIN, "[Setup] WiFi not connected or IP not assigned yet, MQTT will initialize in main loop");
-    } else {
-        // Wait additional time for DNS to be ready after IP assignment
-        ESP_LOGI(TAG_MAIN, "[Setup] Waiting for DNS to be ready...");
-        vTaskDelay(pdMS_TO_TICKS(3000));  // 3 second delay for DNS to be ready
-    }
-    
-    // Get chip ID for MQTT using SOC UID (unique chip identifier)
-    char chip_id[17] = {0};  // 16 hex chars + null terminator for 64-bit SOC UID
-    if (get_soc_uid_string(chip_id, sizeof(chip_id))) {
-        ESP_LOGI(TAG_MAIN, "[Setup] SOC UID: %s", chip_id);
-    } else {
-        ESP_LOGE(TAG_MAIN, "[Setup] Failed to get SOC UID");
-        chip_id[0] = '\0';  // Ensure it's empty on failure
-    }
-    
-    // Initialize MQTT client (only if WiFi is connected, IP assigned, and chip ID available)
-    if (wifi_connected && ip_assigned && strlen(chip_id) > 0) {
-        ESP_LOGI(TAG_MAIN, "[Setup] Initializing MQTT...");
-    // Set MQTT message callback for screen switching
-    mqtt_client_set_callback(on_mqtt_message);
-        bool mqtt_ok = mqtt_client_init(chip_id);
-        if (mqtt_ok) {
-            ESP_LOGI(TAG_MAIN, "[Setup] MQTT initialized successfully");
-        } else {
-            ESP_LOGW(TAG_MAIN, "[Setup] MQTT initialization failed, will retry in loop");
-        }
-    } else {
-        if (!wifi_connected) {
-            ESP_LOGI(TAG_MAIN, "[Setup] Skipping MQTT initialization (WiFi not connected yet)");
-        } else if (!ip_assigned) {
-            ESP_LOGI(TAG_MAIN, "[Setup] Skipping MQTT initialization (IP address not assigned yet)");
-        } else {
-            ESP_LOGW(TAG_MAIN, "[Setup] Skipping MQTT initialization (chip ID unavailable)");
-        }
-    }
     ESP_LOGI(TAG_MAIN, "Running in PRODUCTION MODE");
     ESP_LOGI(TAG_MAIN, "Free heap after setup: %d bytes", ESP.getFreeHeap());
 
 // Forward declaration for ESP-IDF
-void loop_body();
+uint32_t loop_body();
 
     // ESP-IDF: Create main loop task instead of using loop()
     TaskHandle_t main_loop_task_handle = NULL;
-    xTaskCreate([](void* param) {
+    xTaskCreatePinnedToCore([](void* param) {
         #if ENABLE_WATCHDOG
         // Add this task to the watchdog (must be done from within the task)
         esp_task_wdt_add(NULL);
         ESP_LOGI(TAG_MAIN, "[Main Loop] Task added to watchdog");
         #endif
         while (1) {
-            loop_body();
-            // Small delay to prevent CPU spinning, but short enough for watchdog
-            vTaskDelay(pdMS_TO_TICKS(10));  // Increased from 5ms to 10ms for stability
+            uint32_t wait_ms = loop_body();
+            // Sleep until the network changes, a flow sample or pour request arrives, or the next deadline
+            uint32_t events = app_events_wait(APP_EVENT_NETWORK | APP_EVENT_MQTT | APP_EVENT_FLOW |
+                                              APP_EVENT_POUR_REQUEST, wait_ms);
+            if (events & APP_EVENT_NETWORK) {
+                ui_task_refresh_icons();
+            }
         }
-    }, "main_loop", 8192, NULL, 5, &main_loop_task_handle);
-    
+    }, "main_loop", MAIN_LOOP_TASK_STACK_SIZE, NULL, MAIN_LOOP_TASK_PRIORITY, &main_loop_task_handle,
+       MAIN_LOOP_TASK_CORE);
+
     #if ENABLE_WATCHDOG
     // Wait a bit for the task to start and register itself
     vTaskDelay(pdMS_TO_TICKS(100));
@@ -447,52 +671,54 @@ void loop_body();
 }
 
 // Main loop body (extracted for ESP-IDF task)
-void loop_body() {
+// Returns how long the loop may sleep (ms) if no event arrives
+uint32_t loop_body() {
     // Feed watchdog timer at the start of each loop iteration (defensive)
     #if ENABLE_WATCHDOG
     esp_task_wdt_reset();
     #endif
+
+    uint32_t loop_start = perf_monitor_begin();
     
-    // Handle LVGL tasks (should be called every few milliseconds)
-    lv_timer_handler();
-    
-    // Feed watchdog after LVGL (in case LVGL operations take time)
-    #if ENABLE_WATCHDOG
-    esp_task_wdt_reset();
-    #endif
-    
-    // WiFi connection maintenance
-    wifi_manager_loop();
-    
-    // Feed watchdog after WiFi operations (in case they take time)
-    #if ENABLE_WATCHDOG
-    esp_task_wdt_reset();
-    #endif
+    // Serial commands
+    serial_console_poll();
     
-    // MQTT connection maintenance (only if WiFi is connected)
-    if (wifi_manager_is_connected()) {
-        mqtt_client_loop();
+    // MQTT maintenance (once the boot network task has initialized it)
+    // WiFi reconnection and NTP run on the WiFi manager task and never block here
+    if (boot_network_started()) {
+        // MQTT connection maintenance (only if WiFi is connected)
+        if (wifi_manager_is_connected()) {
+            mqtt_client_loop();
+        }
     }
     
     // Feed watchdog after MQTT operations
     #if ENABLE_WATCHDOG
     esp_task_wdt_reset();
     #endif
-    
-    // Update flow meter (calculates flow rate and volume)
+
+    // Update flow meter (only does work when the flow sampling task is disabled)
     flow_meter_update();
     
-    // Update screen manager (handles all screen updates and transitions)
-    screen_manager_update();
+    // Update valve cut-off prediction and stop latency learning
+    pour_controller_update();
+    
+    // Apply pour requests, accumulate volume and cost, advance each tap's session
+    pour_session_update();
     
-    // Touch controller is handled by LVGL touch driver
-    // No need for continuous monitoring here
+    // Sample the pour and publish telemetry batches / the final summary
+    pour_telemetry_loop();
+    
+    // Publish the flow analytics window when due
+    flow_stats_loop();
+    
+    // LVGL, screens and touch are handled by the UI task
     
     // Feed watchdog timer at the end of loop
     #if ENABLE_WATCHDOG
     esp_task_wdt_reset();
     #endif
-    
+
     // Check for persistent errors and reset if necessary
     if (consecutive_errors >= MAX_CONSECUTIVE_ERRORS) {
         unsigned long time_since_error = millis() - last_error_time;
@@ -517,4 +743,40 @@ void loop_body() {
         consecutive_errors = 0;
         ESP_LOGI(TAG_MAIN, "[Error] Error counter reset (60s without errors)");
     }
+    
+    // Save the boot phase timings once complete and publish them after connecting
+    boot_profile_loop();
+    
+    // Write changed settings back once they have settled
+    uint32_t config_wait_ms = config_store_loop();
+    
+    // Confirm or roll back a new image, restart into a downloaded one (never mid-pour)
+    ota_update_loop(pour_session_any_active() || pour_controller_any_active());
+
+    #if PERF_MONITOR_ENABLED && PERF_REPORT_INTERVAL_SEC > 0
+    static unsigned long last_perf_report = 0;
+    if (millis() - last_perf_report >= PERF_REPORT_INTERVAL_SEC * 1000UL) {
+        last_perf_report = millis();
+        perf_monitor_log_report();
+        publish_perf_report();
+    }
+    #endif
+
+    perf_monitor_end_us(PERF_LOOP_US, loop_start);
+    
+    uint32_t wait_ms = MAIN_LOOP_IDLE_MS;
+    if (config_wait_ms < wait_ms) {
+        wait_ms = config_wait_ms;
+    }
+    #if FLOW_SAMPLING_TASK_ENABLED
+    // Track the flow rate at sampling cadence while a pour is running
+    bool pour_active = pour_session_any_active() || pour_controller_any_active();
+    #else
+    // No sampling task - flow_meter_update() must be polled
+    bool pour_active = true;
+    #endif
+    if (pour_active && wait_ms > FLOW_SAMPLING_PERIOD_MS) {
+        wait_ms = FLOW_SAMPLING_PERIOD_MS;
+    }
+    return wait_ms;
 }
@@ -17,10 +17,12 @@
 #include "mqtt/mqtt_manager.h"
 #include "mqtt/mqtt_connection.h"
 #include "mqtt/mqtt_messages.h"
+#include "utils/log_with_time.h"
 
 // System/Standard library headers
 #include <esp_log.h>
 #include <mqtt_client.h>  // ESP-IDF MQTT client component
+#include <cstdio>
 #include <cstring>
 #define TAG "mqtt"
 
@@ -55,7 +57,7 @@ bool mqtt_client_publish(const char* topic, const char* payload) {
     int msg_id = esp_mqtt_client_publish(handle, topic, payload, 0, 1, 0);
     if (msg_id >= 0) {
         mqtt_messages_mark_activity();
-        ESP_LOGI(TAG, "[MQTT] Published to %s: %s (msg_id: %d)", topic, payload, msg_id);
+        ESP_LOGI_HOT(TAG, "[MQTT] Published to %s: %s (msg_id: %d)", topic, payload, msg_id);
         return true;
     } else {
         ESP_LOGE(TAG, "[MQTT] Failed to publish to %s", topic);
@@ -63,6 +65,59 @@ bool mqtt_client_publish(const char* topic, const char* payload) {
     }
 }
 
+int mqtt_client_publish_data(const char* topic, const void* data, size_t len, int qos) {
+    if (!mqtt_connection_is_connected()) {
+        ESP_LOGW(TAG, "[MQTT] Cannot publish - not connected");
+        return -1;
+    }
+    
+    esp_mqtt_client_handle_t handle = (esp_mqtt_client_handle_t)mqtt_connection_get_handle();
+    if (handle == NULL) {
+        ESP_LOGE(TAG, "[MQTT] Client handle is NULL");
+        return -1;
+    }
+    
+    int msg_id = esp_mqtt_client_publish(handle, topic, (const char*)data, (int)len, qos, 0);
+    if (msg_id >= 0) {
+        mqtt_messages_mark_activity();
+        ESP_LOGI_HOT(TAG, "[MQTT] Published %d bytes to %s (qos %d, msg_id: %d)", (int)len, topic, qos, msg_id);
+    } else {
+        ESP_LOGE(TAG, "[MQTT] Failed to publish to %s", topic);
+    }
+    return msg_id;
+}
+
+// Build prefix/chip_id/telemetry/<name>
+static bool telemetry_topic(char* topic, size_t size, const char* name) {
+    const char* device_topic = mqtt_connection_get_device_topic();
+    if (strlen(device_topic) == 0) {
+        ESP_LOGW(TAG, "[MQTT] Cannot publish telemetry - not initialized");
+        return false;
+    }
+    snprintf(topic, size, "%s/telemetry/%s", device_topic, name);
+    return true;
+}
+
+bool mqtt_client_publish_telemetry(const char* name, const char* payload) {
+    char topic[128];
+    if (!telemetry_topic(topic, sizeof(topic), name)) {
+        return false;
+    }
+    return mqtt_client_publish(topic, payload);
+}
+
+int mqtt_client_publish_telemetry_data(const char* name, const void* data, size_t len, int qos) {
+    char topic[128];
+    if (!telemetry_topic(topic, sizeof(topic), name)) {
+        return -1;
+    }
+    return mqtt_client_publish_data(topic, data, len, qos);
+}
+
+void mqtt_client_set_published_callback(void (*callback)(int msg_id)) {
+    mqtt_messages_set_published_callback(callback);
+}
+
 bool mqtt_client_subscribe(const char* topic) {
     if (!mqtt_connection_is_connected()) {
         ESP_LOGW(TAG, "[MQTT] Cannot subscribe - not connected");
@@ -91,6 +146,10 @@ bool mqtt_client_has_activity() {
     return mqtt_messages_has_activity();
 }
 
-void mqtt_client_set_callback(void (*callback)(char* topic, byte* payload, unsigned int length)) {
-    mqtt_messages_set_callback(callback);
+bool mqtt_client_on_command(const char* suffix, mqtt_command_handler_t handler) {
+    return mqtt_dispatch_register(suffix, handler);
+}
+
+void mqtt_client_set_parse_error_callback(void (*callback)(const char* error)) {
+    mqtt_dispatch_set_error_handler(callback);
 }
@@ -5,17 +5,28 @@
  * MQTT Connection Management Implementation
  * 
  * Handles MQTT client initialization, connection, and reconnection
+ * 
+ * Connection is a small state machine: IDLE -> CONNECTING -> CONNECTED, and
+ * BACKOFF after a failure. IP_EVENT_STA_GOT_IP triggers an attempt at once;
+ * failures retry with jittered exponential backoff from MQTT_RECONNECT_DELAY
+ * up to MQTT_RECONNECT_MAX_DELAY (esp-mqtt's own fixed-delay reconnect is off,
+ * so each attempt stops and restarts the client).
  */
 
 #include "config.h"
 #include "mqtt/mqtt_connection.h"
+#include "mqtt/mqtt_dispatch.h"
 #include "wifi/wifi_manager.h"
 #include "mqtt/mqtt_messages.h"
+#include "mqtt/mqtt_tls.h"
 
 // System/Standard library headers
+#include <esp_event.h>
 #include <esp_log.h>
 #include <esp_netif.h>
+#include <esp_random.h>
 #include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
 #include <mqtt_client.h>  // ESP-IDF MQTT client component
 #include <cstring>
 #include <string.h>
@@ -27,11 +38,74 @@ static esp_mqtt_client_handle_t mqtt_client_handle = NULL;
 static char mqtt_client_id[64] = {0};
 static char mqtt_subscribe_topic[128] = {0};
 static char mqtt_paid_topic[128] = {0};  // Topic for "paid" command
+static char mqtt_device_topic[96] = {0};  // Device topic base: prefix/chip_id
 static char mqtt_uri[256] = {0};  // MQTT broker URI (must persist for connection)
-static uint64_t last_reconnect_attempt = 0;
-static uint64_t last_ip_change = 0;  // Track when IP address changed (for DNS readiness)
-static bool mqtt_connected = false;
-static bool mqtt_connecting = false;  // Track if we're in the process of connecting
+
+// Connection state machine
+typedef enum {
+    MQTT_CONN_IDLE,        // Not started (no IP yet)
+    MQTT_CONN_CONNECTING,  // Client started, waiting for CONNECTED or an error
+    MQTT_CONN_CONNECTED,
+    MQTT_CONN_BACKOFF      // Waiting until next_attempt_ms
+} mqtt_conn_state_t;
+
+static volatile mqtt_conn_state_t conn_state = MQTT_CONN_IDLE;
+static volatile bool ip_ready = false;  // Set by IP_EVENT_STA_GOT_IP, consumed by the loop
+static bool client_started = false;
+static uint32_t failed_attempts = 0;
+static uint64_t next_attempt_ms = 0;
+static portMUX_TYPE state_mux = portMUX_INITIALIZER_UNLOCKED;  // Loop (main task) vs event handler (esp-mqtt task)
+
+
+// Jittered exponential backoff: base * 2^n, capped, +/- 25%
+static void schedule_retry() {
+    uint32_t delay_ms = MQTT_RECONNECT_DELAY;
+    for (uint32_t i = 0; i < failed_attempts && delay_ms < MQTT_RECONNECT_MAX_DELAY; i++) {
+        delay_ms *= 2;
+    }
+    if (delay_ms > MQTT_RECONNECT_MAX_DELAY) {
+        delay_ms = MQTT_RECONNECT_MAX_DELAY;
+    }
+    uint32_t jitter = delay_ms / 4;
+    delay_ms = delay_ms - jitter + (jitter > 0 ? esp_random() % (2 * jitter + 1) : 0);
+    
+    portENTER_CRITICAL(&state_mux);
+    failed_attempts++;
+    next_attempt_ms = esp_timer_get_time() / 1000ULL + delay_ms;
+    conn_state = MQTT_CONN_BACKOFF;
+    portEXIT_CRITICAL(&state_mux);
+    ESP_LOGI(TAG, "[MQTT] Retrying in %u ms", (unsigned)delay_ms);
+}
+
+// Start (first time) or restart the client - esp-mqtt resolves the broker in its own task
+// With auto-reconnect off, esp-mqtt's task exits after the first disconnect or failed
+// connect, so esp_mqtt_client_reconnect() would fail from then on: every retry stops
+// the client (a no-op once its task has exited) and starts it again
+static void start_attempt() {
+    if (mqtt_client_handle == NULL) {
+        return;
+    }
+    if (client_started) {
+        esp_mqtt_client_stop(mqtt_client_handle);
+        client_started = false;
+    }
+    conn_state = MQTT_CONN_CONNECTING;
+    esp_err_t err = esp_mqtt_client_start(mqtt_client_handle);
+    if (err == ESP_OK) {
+        client_started = true;
+        ESP_LOGI(TAG, "[MQTT] Connecting (attempt %d)...", (int)failed_attempts + 1);
+    } else {
+        ESP_LOGE(TAG, "[MQTT] Failed to start connection: %s", esp_err_to_name(err));
+        schedule_retry();
+    }
+}
+
+// New address - the broker is (re)reachable, so try straight away with a fresh backoff
+static void on_got_ip(void* arg, esp_event_base_t event_base, int32_t event_id, void* event_data) {
+    ip_event_got_ip_t* event = (ip_event_got_ip_t*)event_data;
+    ESP_LOGI(TAG, "[MQTT] New IP address: " IPSTR, IP2STR(&event->ip_info.ip));
+    ip_ready = true;
+}
 
 bool mqtt_connection_init(const char* chip_id) {
     ESP_LOGI(TAG, "=== Initializing MQTT Client ===");
@@ -40,12 +114,15 @@ bool mqtt_connection_init(const char* chip_id) {
     snprintf(mqtt_client_id, sizeof(mqtt_client_id), "%s_%s", MQTT_CLIENT_ID_PREFIX, chip_id);
     ESP_LOGI(TAG, "[MQTT] Client ID: %s", mqtt_client_id);
     
+    // Build device topic base: prefix/chip_id
+    snprintf(mqtt_device_topic, sizeof(mqtt_device_topic), "%s/%s", MQTT_TOPIC_PREFIX, chip_id);
+    
     // Build subscribe topic: prefix/chip_id/commands
-    snprintf(mqtt_subscribe_topic, sizeof(mqtt_subscribe_topic), "%s/%s/commands", MQTT_TOPIC_PREFIX, chip_id);
+    snprintf(mqtt_subscribe_topic, sizeof(mqtt_subscribe_topic), "%s" MQTT_SUFFIX_COMMANDS, mqtt_device_topic);
     ESP_LOGI(TAG, "[MQTT] Subscribe topic: %s", mqtt_subscribe_topic);
     
     // Build paid command topic: prefix/chip_id/commands/paid
-    snprintf(mqtt_paid_topic, sizeof(mqtt_paid_topic), "%s/%s/commands/paid", MQTT_TOPIC_PREFIX, chip_id);
+    snprintf(mqtt_paid_topic, sizeof(mqtt_paid_topic), "%s" MQTT_SUFFIX_PAID, mqtt_device_topic);
     ESP_LOGI(TAG, "[MQTT] Paid topic: %s", mqtt_paid_topic);
     
     // ESP-IDF: Configure and create MQTT client
@@ -63,7 +140,7 @@ bool mqtt_connection_init(const char* chip_id) {
         mqtt_server = MQTT_SERVER;  // Fallback to secrets.h
         ESP_LOGI(TAG, "[MQTT] Using secrets.h server: %s", mqtt_server);
     #endif
-    
+
     // Validate mqtt_server is not NULL or empty
     if (mqtt_server == NULL || strlen(mqtt_server) == 0) {
         ESP_LOGE(TAG, "[MQTT] ERROR: MQTT server hostname is NULL or empty!");
@@ -71,9 +148,9 @@ bool mqtt_connection_init(const char* chip_id) {
     }
     
     // Build URI with mqtt:// scheme (required by ESP-IDF MQTT client)
-    // Format: mqtt://hostname:port
+    // Format: mqtt://hostname:port (mqtts:// with TLS)
     // Store in static variable so it persists for connection
-    int uri_len = snprintf(mqtt_uri, sizeof(mqtt_uri), "mqtt://%s:%d", mqtt_server, MQTT_PORT);
+    int uri_len = snprintf(mqtt_uri, sizeof(mqtt_uri), "%s://%s:%d", MQTT_USE_TLS ? "mqtts" : "mqtt", mqtt_server, MQTT_PORT);
     if (uri_len < 0 || uri_len >= (int)sizeof(mqtt_uri)) {
         ESP_LOGE(TAG, "[MQTT] ERROR: Failed to build URI or URI too long!");
         return false;
@@ -82,10 +159,20 @@ bool mqtt_connection_init(const char* chip_id) {
     ESP_LOGI(TAG, "[MQTT] Connecting to: %s", mqtt_uri);
     
     esp_mqtt_client_config_t mqtt_cfg = {};
+#if MQTT_USE_TLS
+    // Own TLS transport so the session survives reconnects (esp-mqtt's drops it)
+    mqtt_cfg.broker.address.hostname = mqtt_server;
+    mqtt_cfg.broker.address.port = MQTT_PORT;
+    mqtt_cfg.network.transport = mqtt_tls_transport_create(mqtt_server, MQTT_PORT);
+    if (mqtt_cfg.network.transport == NULL) {
+        return false;
+    }
+#else
     mqtt_cfg.broker.address.uri = mqtt_uri;  // Use URI with scheme (required)
+#endif
     mqtt_cfg.credentials.client_id = mqtt_client_id;
     mqtt_cfg.session.keepalive = MQTT_KEEPALIVE;
-    mqtt_cfg.network.reconnect_timeout_ms = MQTT_RECONNECT_DELAY;
+    mqtt_cfg.network.disable_auto_reconnect = true;  // Retries are paced by the backoff below
     mqtt_cfg.network.timeout_ms = 5000;  // 5 second socket timeout
     
     mqtt_client_handle = esp_mqtt_client_init(&mqtt_cfg);
@@ -97,134 +184,37 @@ bool mqtt_connection_init(const char* chip_id) {
     // Initialize message handling (register event handlers)
     mqtt_messages_init(mqtt_client_handle);
     
-    // Try to connect
-    last_reconnect_attempt = 0;  // Force immediate connection attempt
-    return mqtt_connection_reconnect(chip_id);
-}
-
-bool mqtt_connection_reconnect(const char* chip_id) {
-    // Verify WiFi is connected before attempting MQTT connection
-    if (!wifi_manager_is_connected()) {
-        ESP_LOGW(TAG, "[MQTT] WiFi not connected, skipping MQTT connection");
-        mqtt_connected = false;
-        mqtt_connecting = false;
-        return false;
-    }
-    
-    // ESP-IDF: Check if we have an IP address
-    String ip = wifi_manager_get_ip();
-    if (ip.empty() || ip == std::string("Not connected")) {
-        ESP_LOGW(TAG, "[MQTT] No IP address assigned, waiting for DHCP...");
-        mqtt_connected = false;
-        mqtt_connecting = false;
-        last_ip_change = 0;  // Reset IP change time when disconnected
-        return false;
-    }
-    
-    // Check if IP address has changed (new connection)
-    static String last_ip_str = "";
-    uint64_t now = esp_timer_get_time() / 1000ULL;
-    if (ip != last_ip_str) {
-        // IP address changed - reset the timer
-        last_ip_str = ip;
-        last_ip_change = now;
-        ESP_LOGI(TAG, "[MQTT] New IP address: %s, waiting for DNS to be ready...", ip.c_str());
-        mqtt_connected = false;
-        mqtt_connecting = false;
-        return false;
-    }
-    
-    // Wait a bit for DNS to be ready after WiFi connection
-    // DNS resolution can fail if we try to connect too quickly after getting IP
-    if (last_ip_change == 0) {
-        // First time getting IP - record the time
-        last_ip_change = now;
-        ESP_LOGI(TAG, "[MQTT] IP address obtained, waiting for DNS to be ready...");
-        mqtt_connected = false;
-        mqtt_connecting = false;
-        return false;
-    }
-    
-    uint64_t time_since_ip = now - last_ip_change;
-    if (time_since_ip < 3000) {
-        // Wait at least 3 seconds after IP assignment for DNS to be ready
-        ESP_LOGI(TAG, "[MQTT] Waiting for DNS to be ready... (%llu ms since IP)", (unsigned long long)time_since_ip);
-        mqtt_connected = false;
-        mqtt_connecting = false;
-        return false;
-    }
+    // Connect on every new address, no polling
+    esp_event_handler_instance_register(IP_EVENT, IP_EVENT_STA_GOT_IP, on_got_ip, NULL, NULL);
     
-    // Start MQTT client (will connect automatically)
-    if (mqtt_client_handle != NULL) {
-        // Check if already connected - if so, don't try to start again
-        if (mqtt_connected) {
-            ESP_LOGI(TAG, "[MQTT] Already connected, skipping start");
-            return true;
-        }
-        
-        // Check if we're already in the process of connecting
-        if (mqtt_connecting) {
-            ESP_LOGI(TAG, "[MQTT] Connection already in progress, skipping start");
-            return true;
-        }
-        
-        ESP_LOGI(TAG, "[MQTT] Attempting to connect...");
-        ESP_LOGI(TAG, "[MQTT] WiFi IP: %s", ip.c_str());
-        
-        // Mark as connecting to prevent multiple simultaneous attempts
-        mqtt_connecting = true;
-        
-        // Try to start the client
-        esp_err_t err = esp_mqtt_client_start(mqtt_client_handle);
-        if (err == ESP_OK) {
-            ESP_LOGI(TAG, "[MQTT] Connection initiated");
-            return true;
-        } else if (err == ESP_ERR_INVALID_STATE || err == ESP_FAIL) {
-            // Client is already started (ESP_ERR_INVALID_STATE) or in a state where
-            // start fails but it's already running (ESP_FAIL with "Client has started" message)
-            // This is not an error - the client will connect automatically
-            // Keep mqtt_connecting = true since connection is in progress
-            ESP_LOGI(TAG, "[MQTT] Client already started (err=%s), connection in progress...", esp_err_to_name(err));
-            return true;
-        } else {
-            ESP_LOGE(TAG, "[MQTT] Failed to start client: %s", esp_err_to_name(err));
-            mqtt_connected = false;
-            mqtt_connecting = false;  // Reset connecting flag on error
-            return false;
-        }
-    } else {
-        ESP_LOGE(TAG, "[MQTT] Client not initialized");
-        mqtt_connected = false;
-        mqtt_connecting = false;
-        return false;
+    // WiFi may already be up (boot brings the network up before MQTT)
+    if (wifi_manager_is_connected()) {
+        start_attempt();
     }
+    return true;
 }
 
 bool mqtt_connection_is_connected() {
-    // ESP-IDF: Check connection status
-    // mqtt_connected is updated by event handler
-    return mqtt_connected;
+    // Updated by the event handler
+    return conn_state == MQTT_CONN_CONNECTED;
 }
 
 void mqtt_connection_loop() {
-    // ESP-IDF: MQTT client runs in background, no loop needed
-    // But we check connection and reconnect if needed
-    // Don't try to reconnect if we're already connected or in the process of connecting
-    if (!mqtt_connection_is_connected() && !mqtt_connection_is_connecting()) {
-        uint64_t now = esp_timer_get_time() / 1000ULL;
-        if (now - last_reconnect_attempt >= MQTT_RECONNECT_DELAY) {
-            last_reconnect_attempt = now;
-            
-            // Get chip ID from client ID (extract after prefix_)
-            const char* chip_id = strstr(mqtt_client_id, "_");
-            if (chip_id != NULL) {
-                chip_id++;  // Skip the underscore
-                // Only attempt reconnect if we have a valid chip ID
-                if (strlen(chip_id) > 0) {
-                    mqtt_connection_reconnect(chip_id);
-                }
-            }
-        }
+    portENTER_CRITICAL(&state_mux);
+    bool new_ip = ip_ready;
+    ip_ready = false;
+    if (new_ip) {
+        failed_attempts = 0;
+    }
+    mqtt_conn_state_t state = conn_state;
+    uint64_t due_ms = next_attempt_ms;
+    portEXIT_CRITICAL(&state_mux);
+    
+    if (state == MQTT_CONN_CONNECTED || state == MQTT_CONN_CONNECTING) {
+        return;
+    }
+    if (new_ip || (state == MQTT_CONN_BACKOFF && esp_timer_get_time() / 1000ULL >= due_ms)) {
+        start_attempt();
     }
 }
 
@@ -240,16 +230,19 @@ const char* mqtt_connection_get_paid_topic() {
     return mqtt_paid_topic;
 }
 
-// Internal function to update connection state (called by mqtt_messages)
-void mqtt_connection_set_connected(bool connected) {
-    mqtt_connected = connected;
+const char* mqtt_connection_get_device_topic() {
+    return mqtt_device_topic;
 }
 
-void mqtt_connection_set_connecting(bool connecting) {
-    mqtt_connecting = connecting;
+// Connection state updates (called by mqtt_messages from the esp-mqtt task)
+void mqtt_connection_on_connected() {
+    conn_state = MQTT_CONN_CONNECTED;
+    failed_attempts = 0;
 }
 
-// Get connecting state (for use by mqtt_client_loop)
-bool mqtt_connection_is_connecting() {
-    return mqtt_connecting;
+void mqtt_connection_on_disconnected() {
+    // ERROR and DISCONNECTED often arrive together - back off once per attempt
+    if (conn_state == MQTT_CONN_CONNECTED || conn_state == MQTT_CONN_CONNECTING) {
+        schedule_retry();
+    }
 }
@@ -0,0 +1,258 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * MQTT Command Dispatch Implementation
+ * 
+ * ArduinoJson 7 has no zero-copy mode, so strings are still copied - but into
+ * a bump pool that is reset after every message instead of the heap.
+ * 
+ * Messages that fit in one esp-mqtt event are parsed in place with a small
+ * static pool. Larger ones arrive as fragments (current_data_offset /
+ * total_data_len) and are copied into one arena allocated on first use:
+ * MQTT_MAX_MESSAGE_SIZE for the payload plus twice that for its JSON pool.
+ */
+
+#include "config.h"
+#include "mqtt/mqtt_dispatch.h"
+#include "mqtt/mqtt_connection.h"
+#include "utils/log_with_time.h"
+
+// System/Standard library headers
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+#include <cstring>
+#include <string.h>
+#define TAG "mqtt_msg"
+
+#define MQTT_MAX_HANDLERS 8
+#define MQTT_JSON_POOL_SIZE 4096  // Fits any unfragmented message (esp-mqtt buffer default 1 KB)
+#define MQTT_ARENA_JSON_SIZE (MQTT_MAX_MESSAGE_SIZE * 2)  // Slots plus copied strings
+
+typedef struct {
+    uint32_t hash;
+    size_t len;
+    const char* suffix;
+    mqtt_command_handler_t handler;
+} topic_handler_t;
+
+static topic_handler_t handlers[MQTT_MAX_HANDLERS];
+static int handler_count = 0;
+static void (*error_handler)(const char* error) = NULL;
+
+// Bump allocator over a fixed buffer - deallocate is a no-op, reset() frees everything
+class MessagePool : public ArduinoJson::Allocator {
+public:
+    MessagePool(uint8_t* buf, size_t capacity) : buf(buf), capacity(capacity) {}
+    
+    void* allocate(size_t size) override {
+        size_t total = header_size + align(size);
+        if (used + total > capacity) {
+            return NULL;
+        }
+        uint8_t* block = buf + used;
+        *(size_t*)block = size;
+        last = used;
+        used += total;
+        return block + header_size;
+    }
+    
+    void deallocate(void* ptr) override {
+        (void)ptr;
+    }
+    
+    void* reallocate(void* ptr, size_t new_size) override {
+        if (ptr == NULL) {
+            return allocate(new_size);
+        }
+        uint8_t* block = (uint8_t*)ptr - header_size;
+        size_t old_size = *(size_t*)block;
+        
+        // Last block grows or shrinks in place
+        if ((size_t)(block - buf) == last && last + header_size + align(new_size) <= capacity) {
+            *(size_t*)block = new_size;
+            used = last + header_size + align(new_size);
+            return ptr;
+        }
+        if (new_size <= old_size) {
+            *(size_t*)block = new_size;
+            return ptr;
+        }
+        void* moved = allocate(new_size);
+        if (moved != NULL) {
+            memcpy(moved, ptr, old_size);
+        }
+        return moved;
+    }
+    
+    void reset() {
+        used = 0;
+        last = 0;
+    }
+
+private:
+    static const size_t header_size = 8;  // Keeps blocks 8-byte aligned
+    
+    static size_t align(size_t size) {
+        return (size + 7) & ~(size_t)7;
+    }
+    
+    uint8_t* buf;
+    size_t capacity;
+    size_t used = 0;
+    size_t last = 0;
+};
+
+// Only the esp-mqtt task dispatches, so one pool of each kind is enough
+alignas(8) static uint8_t message_pool_buf[MQTT_JSON_POOL_SIZE];
+static MessagePool message_pool(message_pool_buf, sizeof(message_pool_buf));
+
+// Reassembly state (payload and JSON pool share one arena)
+static uint8_t* arena = NULL;
+static MessagePool* arena_pool = NULL;
+static const topic_handler_t* pending = NULL;  // Handler for the message being reassembled
+static size_t pending_total = 0;
+static size_t pending_received = 0;
+
+static uint32_t fnv1a(const char* data, size_t len) {
+    uint32_t hash = 2166136261UL;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (uint8_t)data[i];
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+bool mqtt_dispatch_register(const char* suffix, mqtt_command_handler_t handler) {
+    if (handler_count >= MQTT_MAX_HANDLERS) {
+        ESP_LOGE(TAG, "[MQTT] Handler table full, cannot register %s", suffix);
+        return false;
+    }
+    size_t len = strlen(suffix);
+    handlers[handler_count].hash = fnv1a(suffix, len);
+    handlers[handler_count].len = len;
+    handlers[handler_count].suffix = suffix;
+    handlers[handler_count].handler = handler;
+    handler_count++;
+    return true;
+}
+
+void mqtt_dispatch_set_error_handler(void (*handler)(const char* error)) {
+    error_handler = handler;
+}
+
+// Look up the handler for a full topic, NULL (logged) if there is none
+static const topic_handler_t* find_handler(const char* topic, size_t topic_len) {
+    // Strip <prefix>/<chip_id> and look up the suffix
+    const char* device_topic = mqtt_connection_get_device_topic();
+    size_t device_len = strlen(device_topic);
+    if (device_len == 0 || topic_len <= device_len || memcmp(topic, device_topic, device_len) != 0) {
+        ESP_LOGW(TAG, "[MQTT] Message outside the device topic - ignored");
+        return NULL;
+    }
+    const char* suffix = topic + device_len;
+    size_t suffix_len = topic_len - device_len;
+    uint32_t hash = fnv1a(suffix, suffix_len);
+    
+    for (int i = 0; i < handler_count; i++) {
+        if (handlers[i].hash == hash && handlers[i].len == suffix_len &&
+            memcmp(handlers[i].suffix, suffix, suffix_len) == 0) {
+            return &handlers[i];
+        }
+    }
+    ESP_LOGW(TAG, "[MQTT] No handler for %.*s", (int)suffix_len, suffix);
+    return NULL;
+}
+
+static void parse_and_dispatch(const topic_handler_t* entry, const char* data, size_t data_len, MessagePool* pool) {
+    {
+        JsonDocument doc(pool);
+        DeserializationError error = deserializeJson(doc, data, data_len);
+        if (!error && !doc.is<JsonObjectConst>()) {
+            error = DeserializationError::InvalidInput;
+        }
+        if (error) {
+            ESP_LOGE(TAG, "[MQTT] JSON parse error: %s", error.c_str());
+            if (error_handler != NULL) {
+                error_handler(error.c_str());
+            }
+        } else {
+            entry->handler(doc.as<JsonObjectConst>());
+        }
+    }
+    pool->reset();
+}
+
+static bool alloc_arena() {
+    if (arena != NULL) {
+        return true;
+    }
+    size_t size = MQTT_MAX_MESSAGE_SIZE + MQTT_ARENA_JSON_SIZE;
+#ifdef BOARD_HAS_PSRAM
+    arena = (uint8_t*)heap_caps_aligned_alloc(8, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#endif
+    if (arena == NULL) {
+        arena = (uint8_t*)heap_caps_aligned_alloc(8, size, MALLOC_CAP_8BIT);
+    }
+    if (arena == NULL) {
+        ESP_LOGE(TAG, "[MQTT] Failed to allocate %d byte reassembly buffer", (int)size);
+        return false;
+    }
+    static MessagePool pool(arena + MQTT_MAX_MESSAGE_SIZE, MQTT_ARENA_JSON_SIZE);
+    arena_pool = &pool;
+    return true;
+}
+
+void mqtt_dispatch_message(const char* topic, size_t topic_len, const char* data, size_t data_len) {
+    ESP_LOGI_HOT(TAG, "Message received on topic: %.*s", (int)topic_len, topic);
+    ESP_LOGI_HOT(TAG, "Message: %.*s", (int)data_len, data);
+    
+    const topic_handler_t* entry = find_handler(topic, topic_len);
+    if (entry != NULL) {
+        // Parse straight from the event buffer into the static pool
+        parse_and_dispatch(entry, data, data_len, &message_pool);
+    }
+}
+
+void mqtt_dispatch_fragment(const char* topic, size_t topic_len, const char* data, size_t data_len,
+                            size_t offset, size_t total) {
+    if (offset == 0) {
+        pending = NULL;
+        if (data_len == total) {
+            mqtt_dispatch_message(topic, topic_len, data, data_len);
+            return;
+        }
+        
+        // First fragment carries the topic - resolve the handler now so it needn't be kept
+        ESP_LOGI_HOT(TAG, "Fragmented message on topic: %.*s (%d bytes)", (int)topic_len, topic, (int)total);
+        if (total > MQTT_MAX_MESSAGE_SIZE) {
+            ESP_LOGW(TAG, "[MQTT] Message of %d bytes exceeds %d - dropped", (int)total, MQTT_MAX_MESSAGE_SIZE);
+            return;
+        }
+        const topic_handler_t* entry = find_handler(topic, topic_len);
+        if (entry == NULL || !alloc_arena()) {
+            return;
+        }
+        pending = entry;
+        pending_total = total;
+        pending_received = 0;
+    }
+    
+    if (pending == NULL) {
+        return;  // Rest of a dropped message
+    }
+    if (offset != pending_received || total != pending_total || offset + data_len > pending_total) {
+        ESP_LOGW(TAG, "[MQTT] Fragment at %d does not continue the message at %d - dropped",
+                 (int)offset, (int)pending_received);
+        pending = NULL;
+        return;
+    }
+    
+    memcpy(arena + offset, data, data_len);
+    pending_received += data_len;
+    if (pending_received == pending_total) {
+        const topic_handler_t* entry = pending;
+        pending = NULL;
+        parse_and_dispatch(entry, (const char*)arena, pending_total, arena_pool);
+    }
+}
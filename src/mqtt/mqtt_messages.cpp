@@ -9,12 +9,19 @@
 
 #include "config.h"
 #include "mqtt/mqtt_messages.h"
+#include "mqtt/mqtt_dispatch.h"
 #include "mqtt/mqtt_connection.h"
+#include "system/app_events.h"
+#include "system/boot.h"
+#include "system/boot_profile.h"
+#include "system/perf_monitor.h"
+#include "utils/log_with_time.h"
 
 // System/Standard library headers
 #include <esp_log.h>
 #include <esp_timer.h>
 #include <mqtt_client.h>  // ESP-IDF MQTT client component
+#include <cstdio>
 #include <cstring>
 #include <string.h>
 #define TAG "mqtt_msg"
@@ -23,8 +30,8 @@
 static uint64_t last_activity_time = 0;
 static const uint64_t ACTIVITY_TIMEOUT_MS = 500;  // Show activity for 500ms after last TX/RX
 
-// MQTT callback function (can be set by user)
-static void (*user_callback)(char* topic, byte* payload, unsigned int length) = NULL;
+// Publish acknowledgement callback
+static void (*published_callback)(int msg_id) = NULL;
 
 // Include mqtt_connection.h for state updates
 #include "mqtt/mqtt_connection.h"
@@ -37,9 +44,11 @@ static void mqtt_event_handler(void *handler_args, esp_event_base_t base, int32_
     switch ((esp_mqtt_event_id_t)event_id) {
         case MQTT_EVENT_CONNECTED: {
             ESP_LOGI(TAG, "MQTT Connected");
-            mqtt_connection_set_connected(true);
-            mqtt_connection_set_connecting(false);  // No longer connecting
+            mqtt_connection_on_connected();
             mqtt_messages_mark_activity();
+            app_events_post(APP_EVENT_NETWORK);
+            boot_mark_ready(BOOT_READY_MQTT);
+            boot_profile_mark(BOOT_PHASE_MQTT);
             
             // Subscribe to device-specific command topics
             const char* subscribe_topic = mqtt_connection_get_subscribe_topic();
@@ -48,15 +57,46 @@ static void mqtt_event_handler(void *handler_args, esp_event_base_t base, int32_
                 ESP_LOGI(TAG, "Subscribed to topic: %s (msg_id: %d)", subscribe_topic, msg_id);
             }
             
-            // Subscribe to paid command topic
+            // Subscribe to paid command topic (QoS 1: redeliveries are dropped by ID)
             const char* paid_topic = mqtt_connection_get_paid_topic();
             if (strlen(paid_topic) > 0) {
-                int msg_id = esp_mqtt_client_subscribe(client, paid_topic, 0);
+                int msg_id = esp_mqtt_client_subscribe(client, paid_topic, 1);
                 ESP_LOGI(TAG, "Subscribed to paid topic: %s (msg_id: %d)", paid_topic, msg_id);
             }
+            
+            // Subscribe to the remote settings topic
+            char config_topic[128];
+            snprintf(config_topic, sizeof(config_topic), "%s" MQTT_SUFFIX_CONFIG, mqtt_connection_get_device_topic());
+            esp_mqtt_client_subscribe(client, config_topic, 0);
+            
+            // Subscribe to the flow sensor calibration topic
+            char calibrate_topic[128];
+            snprintf(calibrate_topic, sizeof(calibrate_topic), "%s" MQTT_SUFFIX_CALIBRATE, mqtt_connection_get_device_topic());
+            esp_mqtt_client_subscribe(client, calibrate_topic, 0);
+            
+            #if OTA_UPDATES_ENABLED
+            // Subscribe to the firmware update topic
+            char ota_topic[128];
+            snprintf(ota_topic, sizeof(ota_topic), "%s" MQTT_SUFFIX_OTA, mqtt_connection_get_device_topic());
+            esp_mqtt_client_subscribe(client, ota_topic, 0);
+            #endif
+            
+            #if PULSE_TRACE_ENABLED
+            // Subscribe to the pulse trace capture topic
+            char trace_topic[128];
+            snprintf(trace_topic, sizeof(trace_topic), "%s" MQTT_SUFFIX_TRACE, mqtt_connection_get_device_topic());
+            esp_mqtt_client_subscribe(client, trace_topic, 0);
+            #endif
+            
+            #if LOG_RING_ENABLED
+            // Subscribe to the log retrieval topic
+            char logs_topic[128];
+            snprintf(logs_topic, sizeof(logs_topic), "%s" MQTT_SUFFIX_LOGS, mqtt_connection_get_device_topic());
+            esp_mqtt_client_subscribe(client, logs_topic, 0);
+            #endif
             break;
         }
-            
+        
         case MQTT_EVENT_DISCONNECTED:
             // Only log as warning if we were previously connected
             // If we were never connected, this is expected during initial connection attempts
@@ -65,58 +105,46 @@ static void mqtt_event_handler(void *handler_args, esp_event_base_t base, int32_
             } else {
                 ESP_LOGI(TAG, "MQTT Disconnected (not yet connected)");
             }
-            mqtt_connection_set_connected(false);
-            mqtt_connection_set_connecting(false);  // No longer connecting
+            mqtt_connection_on_disconnected();
+            app_events_post(APP_EVENT_NETWORK);
             break;
-            
+        
         case MQTT_EVENT_SUBSCRIBED:
             ESP_LOGI(TAG, "MQTT subscribed, msg_id=%d", event->msg_id);
             mqtt_messages_mark_activity();
+            boot_profile_mark(BOOT_PHASE_SUBSCRIBED);
             break;
-            
+        
         case MQTT_EVENT_UNSUBSCRIBED:
             ESP_LOGI(TAG, "MQTT unsubscribed, msg_id=%d", event->msg_id);
             break;
-            
+        
         case MQTT_EVENT_PUBLISHED:
-            ESP_LOGI(TAG, "MQTT published, msg_id=%d", event->msg_id);
+            ESP_LOGI_HOT(TAG, "MQTT published, msg_id=%d", event->msg_id);
             mqtt_messages_mark_activity();
+            if (published_callback != NULL) {
+                published_callback(event->msg_id);
+            }
             break;
-            
+        
         case MQTT_EVENT_DATA: {
-            ESP_LOGI(TAG, "MQTT message received");
-            mqtt_messages_mark_activity();
-            
-            // Extract topic
-            char topic[128] = {0};
-            int topic_len = event->topic_len;
-            if (topic_len > 0 && topic_len < sizeof(topic)) {
-                memcpy(topic, event->topic, topic_len);
-                topic[topic_len] = '\0';
-            }
-            
-            // Extract payload
-            char message[512] = {0};
-            int data_len = event->data_len;
-            if (data_len > 0 && data_len < sizeof(message)) {
-                memcpy(message, event->data, data_len);
-                message[data_len] = '\0';
+            if (event->current_data_offset == 0) {
+                perf_monitor_mark(PERF_MARK_MQTT_RX);  // Start of the paid command latency chain
             }
+            ESP_LOGI_HOT(TAG, "MQTT message received");
+            mqtt_messages_mark_activity();
             
-            ESP_LOGI(TAG, "Message received on topic: %s", topic);
-            ESP_LOGI(TAG, "Message: %s", message);
-            
-            // Call user callback if set
-            if (user_callback != NULL) {
-                user_callback(topic, (byte*)event->data, event->data_len);
-            }
+            // Parse in place, or reassemble if esp-mqtt split the message across events
+            mqtt_dispatch_fragment(event->topic, event->topic_len, event->data, event->data_len,
+                                   event->current_data_offset, event->total_data_len);
+            app_events_post(APP_EVENT_MQTT);
             break;
         }
         
         case MQTT_EVENT_ERROR: {
             ESP_LOGE(TAG, "MQTT error");
-            mqtt_connection_set_connected(false);
-            mqtt_connection_set_connecting(false);  // No longer connecting on error
+            mqtt_connection_on_disconnected();
+            app_events_post(APP_EVENT_NETWORK);
             
             // Log error details if available
             if (event->error_handle) {
@@ -126,7 +154,7 @@ static void mqtt_event_handler(void *handler_args, esp_event_base_t base, int32_
             }
             break;
         }
-            
+        
         default:
             break;
     }
@@ -140,8 +168,8 @@ void mqtt_messages_init(void* client_handle) {
     }
 }
 
-void mqtt_messages_set_callback(void (*callback)(char* topic, byte* payload, unsigned int length)) {
-    user_callback = callback;
+void mqtt_messages_set_published_callback(void (*callback)(int msg_id)) {
+    published_callback = callback;
 }
 
 void mqtt_messages_mark_activity() {
@@ -0,0 +1,273 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * MQTT TLS Transport Implementation
+ * 
+ * esp-mqtt's built-in SSL transport creates a fresh esp-tls context per
+ * connection and never hands back the negotiated session, so this is a small
+ * custom esp_transport over esp-tls that keeps it:
+ * - After each handshake (and again at close, for TLS 1.3 tickets that arrive
+ *   after the handshake) the session is copied out with esp_tls_get_client_session()
+ * - The next connect passes it as esp_tls_cfg_t.client_session; a broker that
+ *   no longer accepts it simply answers with a full handshake
+ * - The session is serialized into RTC_NOINIT memory with a CRC and the broker
+ *   address, and restored at boot if both still match
+ */
+
+#include "config.h"
+#include "mqtt/mqtt_tls.h"
+
+#if MQTT_USE_TLS
+
+// System/Standard library headers
+#include <esp_attr.h>
+#include <esp_crt_bundle.h>
+#include <esp_log.h>
+#include <esp_rom_crc.h>
+#include <esp_timer.h>
+#include <esp_tls.h>
+#include <esp_transport.h>
+#include <mbedtls/ssl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/select.h>
+#define TAG "mqtt_tls"
+
+#define TLS_SESSION_MAGIC 0x53534C54UL  // "TLSS"
+#define TLS_SESSION_MAX 1024            // Serialized session incl. ticket (typically 200-600 bytes)
+
+// Serialized session that survives soft resets
+typedef struct {
+    uint32_t magic;
+    uint32_t broker_crc;   // CRC32 of "host:port" - a different broker never gets the ticket
+    uint32_t len;
+    uint32_t crc;          // CRC32 of data[0..len)
+    uint8_t data[TLS_SESSION_MAX];
+} rtc_tls_session_t;
+
+static RTC_NOINIT_ATTR rtc_tls_session_t rtc_session;
+
+static esp_tls_t* tls = NULL;
+static esp_tls_client_session_t* session = NULL;  // Offered on the next connect
+static uint32_t broker_crc = 0;
+
+// Identifies the broker a stored session belongs to
+static uint32_t broker_hash(const char* host, int port) {
+    char buf[160];
+    int len = snprintf(buf, sizeof(buf), "%s:%d", host, port);
+    if (len < 0) {
+        return 0;
+    }
+    return esp_rom_crc32_le(0, (const uint8_t*)buf, (uint32_t)(len < (int)sizeof(buf) ? len : sizeof(buf) - 1));
+}
+
+#ifdef CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS
+
+// esp_tls_client_session_t is an opaque wrapper around a single mbedtls_ssl_session
+// (esp-tls internals), which is what mbedtls serializes
+static void rtc_store_session() {
+    size_t len = 0;
+    rtc_session.magic = 0;  // Invalid while being rewritten
+    if (mbedtls_ssl_session_save((const mbedtls_ssl_session*)session, rtc_session.data,
+                                 sizeof(rtc_session.data), &len) != 0) {
+        ESP_LOGW(TAG, "[MQTT TLS] Session too large to keep across resets");
+        return;
+    }
+    rtc_session.broker_crc = broker_crc;
+    rtc_session.len = (uint32_t)len;
+    rtc_session.crc = esp_rom_crc32_le(0, rtc_session.data, rtc_session.len);
+    rtc_session.magic = TLS_SESSION_MAGIC;
+}
+
+static void rtc_load_session() {
+    if (rtc_session.magic != TLS_SESSION_MAGIC || rtc_session.broker_crc != broker_crc ||
+        rtc_session.len > sizeof(rtc_session.data) ||
+        rtc_session.crc != esp_rom_crc32_le(0, rtc_session.data, rtc_session.len)) {
+        return;
+    }
+    
+    mbedtls_ssl_session* restored = (mbedtls_ssl_session*)calloc(1, sizeof(mbedtls_ssl_session));
+    if (restored == NULL) {
+        return;
+    }
+    mbedtls_ssl_session_init(restored);
+    // Fails with a version/config mismatch after an OTA to a differently built mbedtls
+    if (mbedtls_ssl_session_load(restored, rtc_session.data, rtc_session.len) != 0) {
+        esp_tls_free_client_session((esp_tls_client_session_t*)restored);
+        rtc_session.magic = 0;
+        return;
+    }
+    session = (esp_tls_client_session_t*)restored;
+    ESP_LOGI(TAG, "[MQTT TLS] Restored TLS session from before reset (%u bytes)", (unsigned)rtc_session.len);
+}
+
+// Keep the session of the current connection for the next one
+static void capture_session() {
+    esp_tls_client_session_t* fresh = esp_tls_get_client_session(tls);
+    if (fresh == NULL) {
+        return;
+    }
+    if (session != NULL) {
+        esp_tls_free_client_session(session);
+    }
+    session = fresh;
+    rtc_store_session();
+}
+
+static void drop_session() {
+    if (session != NULL) {
+        esp_tls_free_client_session(session);
+        session = NULL;
+    }
+    rtc_session.magic = 0;
+}
+
+#else
+
+static void rtc_load_session() {}
+static void capture_session() {}
+static void drop_session() {}
+
+#endif // CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS
+
+// Wait until the socket is readable/writable: >0 ready, 0 timeout, <0 error
+static int tls_poll(int timeout_ms, bool for_write) {
+    int fd = -1;
+    if (tls == NULL || esp_tls_get_conn_sockfd(tls, &fd) != ESP_OK || fd < 0) {
+        return -1;
+    }
+    
+    fd_set ready_set;
+    fd_set error_set;
+    FD_ZERO(&ready_set);
+    FD_ZERO(&error_set);
+    FD_SET(fd, &ready_set);
+    FD_SET(fd, &error_set);
+    struct timeval timeout = { timeout_ms / 1000, (timeout_ms % 1000) * 1000 };
+    
+    int ret = select(fd + 1, for_write ? NULL : &ready_set, for_write ? &ready_set : NULL, &error_set,
+                     timeout_ms < 0 ? NULL : &timeout);
+    if (ret > 0 && FD_ISSET(fd, &error_set)) {
+        return -1;
+    }
+    return ret;
+}
+
+static int tls_connect(esp_transport_handle_t t, const char* host, int port, int timeout_ms) {
+    tls = esp_tls_init();
+    if (tls == NULL) {
+        return ERR_TCP_TRANSPORT_NO_MEM;
+    }
+    
+    // TCP keep-alive notices a dead path before the MQTT keepalive does
+    tls_keep_alive_cfg_t keep_alive = {};
+    keep_alive.keep_alive_enable = true;
+    keep_alive.keep_alive_idle = 30;
+    keep_alive.keep_alive_interval = 5;
+    keep_alive.keep_alive_count = 3;
+    
+    esp_tls_cfg_t cfg = {};
+    cfg.crt_bundle_attach = esp_crt_bundle_attach;
+    cfg.timeout_ms = timeout_ms;
+    cfg.keep_alive_cfg = &keep_alive;
+#ifdef CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS
+    cfg.client_session = session;
+#endif
+
+    bool resuming = session != NULL;
+    int64_t start_us = esp_timer_get_time();
+    if (esp_tls_conn_new_sync(host, strlen(host), port, &cfg, tls) != 1) {
+        ESP_LOGE(TAG, "[MQTT TLS] Handshake with %s:%d failed", host, port);
+        esp_tls_conn_destroy(tls);
+        tls = NULL;
+        // Start the next attempt clean in case the stored session is the problem
+        drop_session();
+        return ERR_TCP_TRANSPORT_CONNECTION_FAILED;
+    }
+    
+    ESP_LOGI(TAG, "[MQTT TLS] Connected in %lld ms (%s)",
+             (long long)((esp_timer_get_time() - start_us) / 1000), resuming ? "session offered" : "full handshake");
+    capture_session();
+    return 0;
+}
+
+static int tls_read(esp_transport_handle_t t, char* buffer, int len, int timeout_ms) {
+    if (tls == NULL) {
+        return ERR_TCP_TRANSPORT_CONNECTION_FAILED;
+    }
+    // Records already decrypted by mbedtls do not show up on the socket
+    if (esp_tls_get_bytes_avail(tls) <= 0) {
+        int ready = tls_poll(timeout_ms, false);
+        if (ready <= 0) {
+            return ready == 0 ? ERR_TCP_TRANSPORT_CONNECTION_TIMEOUT : ERR_TCP_TRANSPORT_CONNECTION_FAILED;
+        }
+    }
+    
+    ssize_t ret = esp_tls_conn_read(tls, buffer, len);
+    if (ret == ESP_TLS_ERR_SSL_WANT_READ || ret == ESP_TLS_ERR_SSL_WANT_WRITE) {
+        return ERR_TCP_TRANSPORT_CONNECTION_TIMEOUT;
+    }
+    if (ret == 0) {
+        return ERR_TCP_TRANSPORT_CONNECTION_CLOSED_BY_FIN;
+    }
+    return ret < 0 ? ERR_TCP_TRANSPORT_CONNECTION_FAILED : (int)ret;
+}
+
+static int tls_write(esp_transport_handle_t t, const char* buffer, int len, int timeout_ms) {
+    if (tls == NULL) {
+        return ERR_TCP_TRANSPORT_CONNECTION_FAILED;
+    }
+    int ready = tls_poll(timeout_ms, true);
+    if (ready <= 0) {
+        return ready == 0 ? ERR_TCP_TRANSPORT_CONNECTION_TIMEOUT : ERR_TCP_TRANSPORT_CONNECTION_FAILED;
+    }
+    
+    ssize_t ret = esp_tls_conn_write(tls, buffer, len);
+    if (ret == ESP_TLS_ERR_SSL_WANT_READ || ret == ESP_TLS_ERR_SSL_WANT_WRITE) {
+        return ERR_TCP_TRANSPORT_CONNECTION_TIMEOUT;
+    }
+    return ret < 0 ? ERR_TCP_TRANSPORT_CONNECTION_FAILED : (int)ret;
+}
+
+static int tls_poll_read(esp_transport_handle_t t, int timeout_ms) {
+    if (tls != NULL && esp_tls_get_bytes_avail(tls) > 0) {
+        return 1;
+    }
+    return tls_poll(timeout_ms, false);
+}
+
+static int tls_poll_write(esp_transport_handle_t t, int timeout_ms) {
+    return tls_poll(timeout_ms, true);
+}
+
+static int tls_close(esp_transport_handle_t t) {
+    if (tls == NULL) {
+        return 0;
+    }
+    // TLS 1.3 brokers send the ticket after the handshake - pick it up before tearing down
+    capture_session();
+    esp_tls_conn_destroy(tls);
+    tls = NULL;
+    return 0;
+}
+
+static int tls_destroy(esp_transport_handle_t t) {
+    return tls_close(t);
+}
+
+esp_transport_handle_t mqtt_tls_transport_create(const char* host, int port) {
+    esp_transport_handle_t t = esp_transport_init();
+    if (t == NULL) {
+        ESP_LOGE(TAG, "[MQTT TLS] Failed to allocate transport");
+        return NULL;
+    }
+    esp_transport_set_func(t, tls_connect, tls_read, tls_write, tls_close, tls_poll_read, tls_poll_write, tls_destroy);
+    esp_transport_set_default_port(t, port);
+    
+    broker_crc = broker_hash(host, port);
+    rtc_load_session();
+    return t;
+}
+
+#endif // MQTT_USE_TLS
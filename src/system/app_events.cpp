@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Application Events Implementation
+ */
+
+// Project headers
+#include "system/app_events.h"
+
+// ESP-IDF framework headers
+#include <esp_attr.h>
+#include <esp_log.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+#include <freertos/task.h>
+#define TAG "app_events"
+
+static EventGroupHandle_t app_event_group = NULL;
+
+void app_events_init() {
+    if (app_event_group != NULL) {
+        return;
+    }
+    app_event_group = xEventGroupCreate();
+    if (app_event_group == NULL) {
+        ESP_LOGE(TAG, "[App Events] Failed to create event group");
+    }
+}
+
+void app_events_post(uint32_t events) {
+    if (app_event_group != NULL) {
+        xEventGroupSetBits(app_event_group, (EventBits_t)events);
+    }
+}
+
+void IRAM_ATTR app_events_post_from_isr(uint32_t events) {
+    if (app_event_group == NULL) {
+        return;
+    }
+    BaseType_t higher_priority_woken = pdFALSE;
+    if (xEventGroupSetBitsFromISR(app_event_group, (EventBits_t)events, &higher_priority_woken) == pdPASS &&
+        higher_priority_woken == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+uint32_t app_events_wait(uint32_t events, uint32_t timeout_ms) {
+    if (app_event_group == NULL) {
+        vTaskDelay(pdMS_TO_TICKS(timeout_ms));
+        return 0;
+    }
+    TickType_t ticks = pdMS_TO_TICKS(timeout_ms);
+    if (ticks == 0 && timeout_ms > 0) {
+        ticks = 1;
+    }
+    EventBits_t bits = xEventGroupWaitBits(app_event_group, (EventBits_t)events, pdTRUE, pdFALSE, ticks);
+    return (uint32_t)bits & events;
+}
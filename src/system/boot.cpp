@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Boot Orchestrator Implementation
+ */
+
+// Project headers
+#include "config.h"
+#include "system/boot.h"
+#include "mqtt/mqtt_manager.h"
+#include "wifi/wifi_manager.h"
+
+// System/Standard library headers
+#include <inttypes.h>
+#include <string.h>
+
+// ESP-IDF framework headers
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#define TAG "boot"
+
+static portMUX_TYPE boot_mux = portMUX_INITIALIZER_UNLOCKED;
+static volatile uint32_t ready_stages = 0;
+static volatile bool network_started = false;
+static char boot_chip_id[17] = {0};
+
+static const char* stage_name(uint32_t stage) {
+    switch (stage) {
+        case BOOT_READY_DISPLAY: return "display";
+        case BOOT_READY_TOUCH:   return "touch";
+        case BOOT_READY_FLOW:    return "flow";
+        case BOOT_READY_UI:      return "UI";
+        case BOOT_READY_WIFI:    return "WiFi";
+        case BOOT_READY_NTP:     return "NTP";
+        case BOOT_READY_MQTT:    return "MQTT";
+        default:                 return "?";
+    }
+}
+
+// WiFi blocks until connected or its timeout, MQTT follows straight after
+static void boot_network_bringup() {
+    ESP_LOGI(TAG, "[Boot] Network bring-up started");
+    if (!wifi_manager_init()) {
+        ESP_LOGW(TAG, "[Boot] WiFi not connected yet, reconnection continues in the WiFi task");
+    }
+    wifi_manager_start_task();
+    
+    if (strlen(boot_chip_id) > 0) {
+        if (!mqtt_client_init(boot_chip_id)) {
+            ESP_LOGW(TAG, "[Boot] MQTT not connected yet, will retry in the main loop");
+        }
+    } else {
+        ESP_LOGE(TAG, "[Boot] No chip ID - MQTT disabled");
+    }
+    
+    network_started = true;
+    ESP_LOGI(TAG, "[Boot] Network bring-up handed over to the main loop");
+}
+
+static void boot_network_task(void* param) {
+    (void)param;
+    boot_network_bringup();
+    vTaskDelete(NULL);
+}
+
+void boot_start_network(const char* chip_id) {
+    strncpy(boot_chip_id, chip_id ? chip_id : "", sizeof(boot_chip_id) - 1);
+    
+    BaseType_t ok = xTaskCreatePinnedToCore(boot_network_task, "boot_net", NETWORK_TASK_STACK_SIZE, NULL,
+                                            NETWORK_TASK_PRIORITY, NULL, NETWORK_TASK_CORE);
+    if (ok != pdPASS) {
+        ESP_LOGE(TAG, "[Boot] Failed to create network task - starting network inline");
+        boot_network_bringup();
+    }
+}
+
+bool boot_network_started() {
+    return network_started;
+}
+
+void boot_mark_ready(uint32_t stages) {
+    portENTER_CRITICAL(&boot_mux);
+    uint32_t new_stages = stages & ~ready_stages;
+    ready_stages |= stages;
+    uint32_t all = ready_stages;
+    portEXIT_CRITICAL(&boot_mux);
+    
+    if (new_stages == 0) {
+        return;
+    }
+    uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000ULL);
+    for (uint32_t stage = 1; stage <= new_stages; stage <<= 1) {
+        if (new_stages & stage) {
+            ESP_LOGI(TAG, "[Boot] %s ready at %" PRIu32 " ms", stage_name(stage), now_ms);
+        }
+    }
+    if ((all & BOOT_READY_ALL) == BOOT_READY_ALL && (new_stages & BOOT_READY_ALL) != 0) {
+        ESP_LOGI(TAG, "[Boot] All subsystems ready in %" PRIu32 " ms", now_ms);
+    }
+}
+
+uint32_t boot_get_ready() {
+    return ready_stages;
+}
+
+uint8_t boot_get_progress() {
+    // Display, touch and flow take the bar to 90%, the UI handover completes it
+    uint32_t ready = ready_stages;
+    uint8_t percent = 0;
+    if (ready & BOOT_READY_DISPLAY) {
+        percent += 30;
+    }
+    if (ready & BOOT_READY_TOUCH) {
+        percent += 20;
+    }
+    if (ready & BOOT_READY_FLOW) {
+        percent += 40;
+    }
+    if (ready & BOOT_READY_UI) {
+        percent += 10;
+    }
+    return percent;
+}
@@ -0,0 +1,210 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Boot Profiler Implementation
+ * 
+ * History is kept newest first in one NVS blob. RTC memory would not survive
+ * the power loss we are trying to diagnose, so only NVS is used.
+ */
+
+// Project headers
+#include "config.h"
+#include "system/boot_profile.h"
+
+#if BOOT_PROFILE_ENABLED
+
+#include "mqtt/mqtt_manager.h"
+
+// System/Standard library headers
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+// ESP-IDF framework headers
+#include <esp_log.h>
+#include <esp_system.h>
+#include <esp_timer.h>
+#include <nvs.h>
+#define TAG "boot_prof"
+
+#define BOOT_NVS_NAMESPACE "boot_prof"
+#define BOOT_NVS_KEY_HISTORY "history"
+
+#define BOOT_PROFILE_TIMEOUT_MS 120000U  // Save an incomplete boot after 2 minutes
+#define BOOT_REPORT_SIZE 1536
+
+typedef struct {
+    uint32_t ms[BOOT_PHASE_COUNT];  // Time each phase was reached (0 = not reached)
+    uint32_t reset_reason;          // esp_reset_reason_t
+} boot_record_t;
+
+typedef struct {
+    uint32_t count;
+    boot_record_t records[BOOT_PROFILE_HISTORY];  // Newest first
+} boot_history_t;
+
+static const char* phase_names[BOOT_PHASE_COUNT] = {
+    "nvs", "lvgl", "display", "first_flush", "touch", "wifi", "ip", "mqtt", "subscribed"
+};
+
+static boot_record_t current = {};
+static boot_history_t history = {};
+static bool saved = false;
+static bool published = false;
+
+static const char* reset_reason_name(uint32_t reason) {
+    switch ((esp_reset_reason_t)reason) {
+        case ESP_RST_POWERON:   return "poweron";
+        case ESP_RST_EXT:       return "ext";
+        case ESP_RST_SW:        return "sw";
+        case ESP_RST_PANIC:     return "panic";
+        case ESP_RST_INT_WDT:   return "int_wdt";
+        case ESP_RST_TASK_WDT:  return "task_wdt";
+        case ESP_RST_WDT:       return "wdt";
+        case ESP_RST_DEEPSLEEP: return "deepsleep";
+        case ESP_RST_BROWNOUT:  return "brownout";
+        case ESP_RST_SDIO:      return "sdio";
+        default:                return "unknown";
+    }
+}
+
+// Prepend this boot to the stored history and write it back
+static void save_history() {
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open(BOOT_NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "[Boot Profile] Failed to open NVS: %s", esp_err_to_name(err));
+        return;
+    }
+    
+    // A blob of a different size was written with another history length - start over
+    size_t size = sizeof(history);
+    if (nvs_get_blob(handle, BOOT_NVS_KEY_HISTORY, &history, &size) != ESP_OK || size != sizeof(history) ||
+        history.count > BOOT_PROFILE_HISTORY) {
+        memset(&history, 0, sizeof(history));
+    }
+    
+    memmove(&history.records[1], &history.records[0], sizeof(boot_record_t) * (BOOT_PROFILE_HISTORY - 1));
+    history.records[0] = current;
+    if (history.count < BOOT_PROFILE_HISTORY) {
+        history.count++;
+    }
+    
+    err = nvs_set_blob(handle, BOOT_NVS_KEY_HISTORY, &history, sizeof(history));
+    if (err == ESP_OK) {
+        err = nvs_commit(handle);
+    }
+    nvs_close(handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "[Boot Profile] Failed to save history: %s", esp_err_to_name(err));
+    }
+}
+
+static int format_record(char* buf, size_t size, const boot_record_t* record, bool first) {
+    int len = snprintf(buf, size, "%s{\"reset\":\"%s\",\"ms\":[", first ? "" : ",",
+                       reset_reason_name(record->reset_reason));
+    if (len < 0 || (size_t)len >= size) {
+        return -1;
+    }
+    for (uint32_t i = 0; i < BOOT_PHASE_COUNT; i++) {
+        int n = snprintf(buf + len, size - len, "%s%" PRIu32, i ? "," : "", record->ms[i]);
+        if (n < 0 || (size_t)n >= size - len) {
+            return -1;
+        }
+        len += n;
+    }
+    int n = snprintf(buf + len, size - len, "]}");
+    if (n < 0 || (size_t)n >= size - len) {
+        return -1;
+    }
+    return len + n;
+}
+
+void boot_profile_mark(boot_phase_t phase) {
+    if (phase >= BOOT_PHASE_COUNT || current.ms[phase] != 0) {
+        return;
+    }
+    uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000ULL);
+    current.ms[phase] = now_ms ? now_ms : 1;
+    current.reset_reason = (uint32_t)esp_reset_reason();
+}
+
+void boot_profile_loop() {
+    if (!saved) {
+        uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000ULL);
+        if (current.ms[BOOT_PHASE_SUBSCRIBED] == 0 && now_ms < BOOT_PROFILE_TIMEOUT_MS) {
+            return;
+        }
+        save_history();
+        saved = true;
+        boot_profile_log_report();
+    }
+    
+    if (!published && mqtt_client_is_connected()) {
+        static char report[BOOT_REPORT_SIZE];
+        if (boot_profile_format_json(report, sizeof(report)) == 0) {
+            ESP_LOGW(TAG, "[Boot Profile] Report does not fit in %d bytes", (int)sizeof(report));
+            published = true;
+            return;
+        }
+        published = mqtt_client_publish_telemetry("boot", report);
+    }
+}
+
+size_t boot_profile_format_json(char* buf, size_t size) {
+    int len = snprintf(buf, size, "{\"phases\":[");
+    if (len < 0 || (size_t)len >= size) {
+        return 0;
+    }
+    for (uint32_t i = 0; i < BOOT_PHASE_COUNT; i++) {
+        int n = snprintf(buf + len, size - len, "%s\"%s\"", i ? "," : "", phase_names[i]);
+        if (n < 0 || (size_t)n >= size - len) {
+            return 0;
+        }
+        len += n;
+    }
+    int n = snprintf(buf + len, size - len, "],\"boots\":[");
+    if (n < 0 || (size_t)n >= size - len) {
+        return 0;
+    }
+    len += n;
+    
+    // This boot first (it may have reached more phases since it was saved), then the older ones
+    n = format_record(buf + len, size - len, &current, true);
+    if (n < 0) {
+        return 0;
+    }
+    len += n;
+    for (uint32_t i = saved ? 1 : 0; i < history.count; i++) {
+        n = format_record(buf + len, size - len, &history.records[i], false);
+        if (n < 0) {
+            return 0;
+        }
+        len += n;
+    }
+    
+    n = snprintf(buf + len, size - len, "]}");
+    if (n < 0 || (size_t)n >= size - len) {
+        return 0;
+    }
+    return (size_t)(len + n);
+}
+
+void boot_profile_log_report() {
+    ESP_LOGI(TAG, "[Boot Profile] Reset reason: %s", reset_reason_name((uint32_t)esp_reset_reason()));
+    for (uint32_t i = 0; i < BOOT_PHASE_COUNT; i++) {
+        if (current.ms[i] != 0) {
+            ESP_LOGI(TAG, "[Boot Profile] %-12s %6" PRIu32 " ms", phase_names[i], current.ms[i]);
+        } else {
+            ESP_LOGI(TAG, "[Boot Profile] %-12s      -", phase_names[i]);
+        }
+    }
+}
+
+#endif // BOOT_PROFILE_ENABLED
@@ -0,0 +1,371 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Config Store Implementation
+ * 
+ * One versioned blob in the "config" namespace. The RAM copy is guarded by a
+ * spinlock; a flush copies it out under the lock and writes it after, so
+ * readers never wait for flash.
+ */
+
+// Project headers
+#include "config.h"
+#include "system/config_store.h"
+
+// System/Standard library headers
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+// ESP-IDF framework headers
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <nvs.h>
+#define TAG "config"
+
+#define CONFIG_NVS_NAMESPACE "config"
+#define CONFIG_NVS_KEY "settings"
+#define CONFIG_VERSION 2  // 2: K-factor curves appended
+
+// Keys written before the store existed, imported once
+#define LEGACY_WIFI_NAMESPACE "wifi"
+#define LEGACY_POUR_NAMESPACE "pour"
+#define LEGACY_KEY_LATENCY "stop_lat_us"
+
+#define FINISHED_TIMEOUT_MIN_SEC 1
+#define FINISHED_TIMEOUT_MAX_SEC 300
+
+static_assert(FLOW_TAP_COUNT <= CONFIG_MAX_TAPS, "config store keeps at most CONFIG_MAX_TAPS stop latencies");
+
+typedef struct {
+    uint16_t version;
+    uint16_t size;
+    device_config_t config;
+} stored_config_t;
+
+static portMUX_TYPE config_mux = portMUX_INITIALIZER_UNLOCKED;
+static device_config_t settings;
+static bool dirty = false;
+static int64_t changed_us = 0;
+
+static void copy_string(char* dst, size_t size, const char* src) {
+    strncpy(dst, src, size - 1);
+    dst[size - 1] = '\0';
+}
+
+static void set_defaults(device_config_t* c) {
+    memset(c, 0, sizeof(*c));
+    copy_string(c->currency_symbol, sizeof(c->currency_symbol), CURRENCY_SYMBOL);
+    c->finished_timeout_sec = FINISHED_SCREEN_TIMEOUT_SEC;
+}
+
+// Credentials saved by provisioning and latencies learned by the pour controller
+static void import_legacy(device_config_t* c) {
+    nvs_handle_t handle;
+    if (nvs_open(LEGACY_WIFI_NAMESPACE, NVS_READONLY, &handle) == ESP_OK) {
+        bool use_saved = false;
+        size_t size = sizeof(use_saved);
+        if (nvs_get_blob(handle, "use_saved", &use_saved, &size) == ESP_OK && use_saved) {
+            size = sizeof(c->wifi_ssid);
+            if (nvs_get_str(handle, "ssid", c->wifi_ssid, &size) == ESP_OK && strlen(c->wifi_ssid) > 0) {
+                size = sizeof(c->wifi_password);
+                if (nvs_get_str(handle, "password", c->wifi_password, &size) != ESP_OK) {
+                    c->wifi_password[0] = '\0';
+                }
+                c->wifi_use_saved = true;
+                ESP_LOGI(TAG, "[Config] Imported saved WiFi credentials for: %s", c->wifi_ssid);
+            } else {
+                c->wifi_ssid[0] = '\0';
+            }
+        }
+        nvs_close(handle);
+    }
+    
+    if (nvs_open(LEGACY_POUR_NAMESPACE, NVS_READONLY, &handle) == ESP_OK) {
+        for (uint8_t tap = 0; tap < FLOW_TAP_COUNT; tap++) {
+            char key[16];
+            if (tap == 0) {
+                snprintf(key, sizeof(key), "%s", LEGACY_KEY_LATENCY);
+            } else {
+                snprintf(key, sizeof(key), "%s%u", LEGACY_KEY_LATENCY, (unsigned)tap);
+            }
+            uint32_t latency = 0;
+            if (nvs_get_u32(handle, key, &latency) == ESP_OK) {
+                c->stop_latency_us[tap] = latency;
+            }
+        }
+        nvs_close(handle);
+    }
+}
+
+static bool write_blob(const device_config_t* c) {
+    static stored_config_t stored;  // Only written from the flushing task
+    stored.version = CONFIG_VERSION;
+    stored.size = sizeof(stored.config);
+    stored.config = *c;
+    
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open(CONFIG_NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (err == ESP_OK) {
+        err = nvs_set_blob(handle, CONFIG_NVS_KEY, &stored, sizeof(stored));
+        if (err == ESP_OK) {
+            err = nvs_commit(handle);
+        }
+        nvs_close(handle);
+    }
+    memset(stored.config.wifi_password, 0, sizeof(stored.config.wifi_password));
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "[Config] Failed to save settings: %s", esp_err_to_name(err));
+        return false;
+    }
+    return true;
+}
+
+static void mark_dirty() {
+    dirty = true;
+    changed_us = esp_timer_get_time();
+}
+
+void config_store_init() {
+    static stored_config_t stored;
+    bool loaded = false;
+    
+    nvs_handle_t handle;
+    if (nvs_open(CONFIG_NVS_NAMESPACE, NVS_READONLY, &handle) == ESP_OK) {
+        // An older blob is shorter: only the fields it knew about are read back
+        size_t size = sizeof(stored);
+        loaded = nvs_get_blob(handle, CONFIG_NVS_KEY, &stored, &size) == ESP_OK &&
+                 size >= offsetof(stored_config_t, config) && stored.version >= 1 &&
+                 stored.version <= CONFIG_VERSION && stored.size <= sizeof(stored.config) &&
+                 size == offsetof(stored_config_t, config) + stored.size;
+        nvs_close(handle);
+    }
+    
+    device_config_t c;
+    if (loaded) {
+        set_defaults(&c);
+        memcpy(&c, &stored.config, stored.size);
+        c.wifi_ssid[sizeof(c.wifi_ssid) - 1] = '\0';
+        c.wifi_password[sizeof(c.wifi_password) - 1] = '\0';
+        c.currency_symbol[sizeof(c.currency_symbol) - 1] = '\0';
+        for (uint8_t tap = 0; tap < CONFIG_MAX_TAPS; tap++) {
+            if (!k_factor_valid(&c.k_factor[tap])) {
+                c.k_factor[tap].count = 0;
+            }
+        }
+    } else {
+        ESP_LOGI(TAG, "[Config] No stored settings, starting from defaults");
+        set_defaults(&c);
+        import_legacy(&c);
+    }
+    uint16_t stored_version = loaded ? stored.version : 0;
+    memset(&stored, 0, sizeof(stored));
+    
+    portENTER_CRITICAL(&config_mux);
+    settings = c;
+    portEXIT_CRITICAL(&config_mux);
+    memset(c.wifi_password, 0, sizeof(c.wifi_password));
+    
+    if (!loaded || stored_version != CONFIG_VERSION) {
+        write_blob(&settings);  // So the next boot skips the import / reads the current layout
+    }
+    ESP_LOGI(TAG, "[Config] Loaded: currency '%s', finished timeout %us, saved WiFi %s",
+             settings.currency_symbol, (unsigned)settings.finished_timeout_sec,
+             settings.wifi_use_saved ? "yes" : "no");
+}
+
+void config_store_get(device_config_t* out) {
+    portENTER_CRITICAL(&config_mux);
+    *out = settings;
+    portEXIT_CRITICAL(&config_mux);
+}
+
+bool config_store_get_wifi(char* ssid, size_t ssid_size, char* password, size_t password_size) {
+    portENTER_CRITICAL(&config_mux);
+    bool saved = settings.wifi_use_saved && settings.wifi_ssid[0] != '\0';
+    if (saved) {
+        copy_string(ssid, ssid_size, settings.wifi_ssid);
+        copy_string(password, password_size, settings.wifi_password);
+    }
+    portEXIT_CRITICAL(&config_mux);
+    return saved;
+}
+
+void config_store_get_currency(char* buf, size_t size) {
+    portENTER_CRITICAL(&config_mux);
+    copy_string(buf, size, settings.currency_symbol);
+    portEXIT_CRITICAL(&config_mux);
+}
+
+uint16_t config_store_get_finished_timeout_sec() {
+    return settings.finished_timeout_sec;
+}
+
+uint32_t config_store_get_stop_latency_us(uint8_t tap) {
+    return tap < FLOW_TAP_COUNT ? settings.stop_latency_us[tap] : 0;
+}
+
+void config_store_get_k_factor(uint8_t tap, k_factor_table_t* out) {
+    portENTER_CRITICAL(&config_mux);
+    if (tap < FLOW_TAP_COUNT) {
+        *out = settings.k_factor[tap];
+    } else {
+        memset(out, 0, sizeof(*out));
+    }
+    portEXIT_CRITICAL(&config_mux);
+}
+
+void config_store_set_wifi(const char* ssid, const char* password) {
+    portENTER_CRITICAL(&config_mux);
+    copy_string(settings.wifi_ssid, sizeof(settings.wifi_ssid), ssid);
+    copy_string(settings.wifi_password, sizeof(settings.wifi_password), password);
+    settings.wifi_use_saved = ssid[0] != '\0';
+    mark_dirty();
+    portEXIT_CRITICAL(&config_mux);
+}
+
+void config_store_set_currency(const char* symbol) {
+    portENTER_CRITICAL(&config_mux);
+    if (strncmp(settings.currency_symbol, symbol, sizeof(settings.currency_symbol) - 1) != 0) {
+        copy_string(settings.currency_symbol, sizeof(settings.currency_symbol), symbol);
+        mark_dirty();
+    }
+    portEXIT_CRITICAL(&config_mux);
+}
+
+void config_store_set_finished_timeout_sec(uint16_t sec) {
+    portENTER_CRITICAL(&config_mux);
+    if (settings.finished_timeout_sec != sec) {
+        settings.finished_timeout_sec = sec;
+        mark_dirty();
+    }
+    portEXIT_CRITICAL(&config_mux);
+}
+
+void config_store_set_k_factor(uint8_t tap, const k_factor_table_t* table) {
+    if (tap >= FLOW_TAP_COUNT || !k_factor_valid(table)) {
+        return;
+    }
+    portENTER_CRITICAL(&config_mux);
+    if (memcmp(&settings.k_factor[tap], table, sizeof(*table)) != 0) {
+        settings.k_factor[tap] = *table;
+        mark_dirty();
+    }
+    portEXIT_CRITICAL(&config_mux);
+}
+
+void config_store_set_stop_latency_us(uint8_t tap, uint32_t us) {
+    if (tap >= FLOW_TAP_COUNT) {
+        return;
+    }
+    portENTER_CRITICAL(&config_mux);
+    if (settings.stop_latency_us[tap] != us) {
+        settings.stop_latency_us[tap] = us;
+        mark_dirty();
+    }
+    portEXIT_CRITICAL(&config_mux);
+}
+
+int config_store_apply_json(JsonObjectConst update) {
+    // Validate everything first so a bad field applies nothing
+    JsonVariantConst currency = update["currency"];
+    JsonVariantConst timeout = update["finished_timeout_sec"];
+    JsonVariantConst ssid = update["wifi_ssid"];
+    JsonVariantConst password = update["wifi_password"];
+    
+    if (!currency.isNull() && (!currency.is<const char*>() ||
+                               strlen(currency.as<const char*>()) >= CONFIG_CURRENCY_SIZE)) {
+        return -1;
+    }
+    if (!timeout.isNull() && (!timeout.is<int>() || timeout.as<int>() < FINISHED_TIMEOUT_MIN_SEC ||
+                              timeout.as<int>() > FINISHED_TIMEOUT_MAX_SEC)) {
+        return -1;
+    }
+    if (!ssid.isNull() && (!ssid.is<const char*>() || strlen(ssid.as<const char*>()) >= CONFIG_SSID_SIZE)) {
+        return -1;
+    }
+    if (!password.isNull() && (ssid.isNull() || !password.is<const char*>() ||
+                               strlen(password.as<const char*>()) >= CONFIG_PASSWORD_SIZE)) {
+        return -1;  // A password only makes sense with its SSID
+    }
+    
+    int changed = 0;
+    if (!currency.isNull()) {
+        config_store_set_currency(currency.as<const char*>());
+        changed++;
+    }
+    if (!timeout.isNull()) {
+        config_store_set_finished_timeout_sec((uint16_t)timeout.as<int>());
+        changed++;
+    }
+    if (!ssid.isNull()) {
+        // Takes effect on the next reconnect
+        config_store_set_wifi(ssid.as<const char*>(), password | "");
+        changed++;
+    }
+    return changed;
+}
+
+size_t config_store_format_json(char* buf, size_t size) {
+    device_config_t c;
+    config_store_get(&c);
+    memset(c.wifi_password, 0, sizeof(c.wifi_password));
+    
+    JsonDocument doc;
+    doc["currency"] = (const char*)c.currency_symbol;
+    doc["finished_timeout_sec"] = c.finished_timeout_sec;
+    doc["wifi_ssid"] = c.wifi_use_saved ? (const char*)c.wifi_ssid : "";
+    JsonArray latency = doc["stop_latency_us"].to<JsonArray>();
+    for (uint8_t tap = 0; tap < FLOW_TAP_COUNT; tap++) {
+        latency.add(c.stop_latency_us[tap]);
+    }
+    if (measureJson(doc) >= size) {
+        return 0;
+    }
+    return serializeJson(doc, buf, size);
+}
+
+void config_store_flush() {
+    device_config_t c;
+    portENTER_CRITICAL(&config_mux);
+    bool pending = dirty;
+    dirty = false;
+    c = settings;
+    portEXIT_CRITICAL(&config_mux);
+    
+    if (pending) {
+        if (write_blob(&c)) {
+            ESP_LOGI(TAG, "[Config] Settings saved");
+        } else {
+            portENTER_CRITICAL(&config_mux);
+            mark_dirty();  // Retry after another settle period
+            portEXIT_CRITICAL(&config_mux);
+        }
+    }
+    memset(c.wifi_password, 0, sizeof(c.wifi_password));
+}
+
+uint32_t config_store_loop() {
+    portENTER_CRITICAL(&config_mux);
+    bool pending = dirty;
+    int64_t since_us = esp_timer_get_time() - changed_us;
+    portEXIT_CRITICAL(&config_mux);
+    
+    if (!pending) {
+        return UINT32_MAX;
+    }
+    int64_t wait_us = (int64_t)CONFIG_STORE_SAVE_DELAY_MS * 1000 - since_us;
+    if (wait_us > 0) {
+        return (uint32_t)((wait_us + 999) / 1000);
+    }
+    config_store_flush();
+    return UINT32_MAX;
+}
@@ -3,6 +3,10 @@
  * All rights reserved.
  * 
  * ESP-IDF GPIO ISR Wrapper Implementation
+ * 
+ * Table and trampoline for the Arduino-style attachInterrupt() in
+ * esp_idf_compat.h only. Firmware ISRs (flow meter, touch) register with
+ * gpio_isr_handler_add() and their own context pointer instead.
  */
 
 #ifdef ESP_PLATFORM
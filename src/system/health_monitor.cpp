@@ -0,0 +1,439 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Health Monitor Implementation
+ * 
+ * The task list comes from uxTaskGetSystemState() (needs the FreeRTOS trace
+ * facility, selected by CONFIG_HEALTH_MONITOR). The last published value of
+ * each figure is kept so a report only carries what moved; tasks are matched
+ * by handle, so a task created later shows up in the next report.
+ * 
+ * CPU usage is each task's run time counter (also selected by
+ * CONFIG_HEALTH_MONITOR) since the previous sample, as a percentage of one
+ * core; a core's load is 100 minus its idle task's share. The periodic
+ * report and the serial command keep separate baselines.
+ */
+
+// Project headers
+#include "config.h"
+#include "system/health_monitor.h"
+
+#if HEALTH_MONITOR_ENABLED
+
+#include "mqtt/mqtt_manager.h"
+
+// System/Standard library headers
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+// ESP-IDF framework headers
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#define TAG "health"
+
+#define HEALTH_TASK_STACK 4096
+#define HEALTH_TASK_PRIORITY 1   // Below everything that matters
+#define HEALTH_MAX_TASKS 32
+#define HEALTH_REPORT_SIZE 2048
+#define HEALTH_CPU_DELTA_PCT 2   // CPU share change before it is re-sent
+#define HEALTH_CPU_UNKNOWN 0xFF
+
+#if defined(CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS) && defined(CONFIG_FREERTOS_VTASKLIST_INCLUDE_COREID)
+#define HEALTH_CPU_STATS 1
+#else
+#define HEALTH_CPU_STATS 0
+#endif
+
+typedef struct {
+    const char* name;
+    uint32_t caps;
+} heap_region_t;
+
+static const heap_region_t regions[] = {
+    { "dram",  MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT },
+    { "iram",  MALLOC_CAP_EXEC },      // 32-bit only IRAM left over after code
+    { "psram", MALLOC_CAP_SPIRAM },
+    { "dma",   MALLOC_CAP_DMA },
+};
+#define REGION_COUNT (sizeof(regions) / sizeof(regions[0]))
+
+typedef struct {
+    size_t free_bytes;
+    size_t min_free;
+    size_t largest;
+} heap_sample_t;
+
+typedef struct {
+    TaskHandle_t handle;
+    char name[configMAX_TASK_NAME_LEN];
+    uint32_t stack_free;   // High-water mark in bytes
+    int8_t core;           // Pinned core, -1 for either
+    uint8_t cpu_pct;       // Share of one core since the previous sample, HEALTH_CPU_UNKNOWN on the first
+} task_sample_t;
+
+typedef struct {
+    heap_sample_t heap[REGION_COUNT];
+    task_sample_t tasks[HEALTH_MAX_TASKS];
+    uint32_t task_count;
+    uint8_t core_load[portNUM_PROCESSORS];  // Percent, HEALTH_CPU_UNKNOWN on the first sample
+    TaskStatus_t status[HEALTH_MAX_TASKS];  // Scratch for uxTaskGetSystemState()
+} health_sample_t;
+
+// Run time counters at the previous sample
+typedef struct {
+    TaskHandle_t handles[HEALTH_MAX_TASKS];
+    uint32_t run_time[HEALTH_MAX_TASKS];
+    uint32_t count;
+    uint32_t total;        // 0 before the first sample
+} cpu_baseline_t;
+
+// What a report included, so only that becomes the new baseline
+typedef struct {
+    bool heap[REGION_COUNT];
+    bool cpu[HEALTH_MAX_TASKS];    // Per entry of the sample's tasks
+    bool load;
+} health_sent_t;
+
+// Last published values (monitor task only)
+static heap_sample_t reported_heap[REGION_COUNT];
+static task_sample_t reported_tasks[HEALTH_MAX_TASKS];
+static uint32_t reported_task_count = 0;
+static uint8_t reported_load[portNUM_PROCESSORS];
+static cpu_baseline_t report_baseline;
+static uint32_t reports_since_full = 0;
+static bool was_connected = false;
+
+static TaskHandle_t monitor_task = NULL;
+
+#if HEALTH_CPU_STATS
+// Run time since the baseline as a share of one core; counters are 32-bit, so deltas wrap safely
+static uint8_t cpu_share(const cpu_baseline_t* base, TaskHandle_t handle, uint32_t run_time, uint32_t total) {
+    uint32_t elapsed = total - base->total;
+    if (base->total == 0 || elapsed == 0) {
+        return HEALTH_CPU_UNKNOWN;
+    }
+    for (uint32_t i = 0; i < base->count; i++) {
+        if (base->handles[i] == handle) {
+            uint64_t pct = (uint64_t)(run_time - base->run_time[i]) * 100 / elapsed;
+            return pct > 100 ? 100 : (uint8_t)pct;
+        }
+    }
+    return HEALTH_CPU_UNKNOWN;  // Created since the baseline
+}
+#endif
+
+static void sample(health_sample_t* s, cpu_baseline_t* base) {
+    for (size_t i = 0; i < REGION_COUNT; i++) {
+        s->heap[i].free_bytes = heap_caps_get_free_size(regions[i].caps);
+        s->heap[i].min_free = heap_caps_get_minimum_free_size(regions[i].caps);
+        s->heap[i].largest = heap_caps_get_largest_free_block(regions[i].caps);
+    }
+    
+    TaskStatus_t* status = s->status;
+    uint32_t total_run_time = 0;  // configRUN_TIME_COUNTER_TYPE is 32-bit by default
+    UBaseType_t count = uxTaskGetSystemState(status, HEALTH_MAX_TASKS, &total_run_time);
+    s->task_count = 0;
+    for (UBaseType_t i = 0; i < count; i++) {
+        task_sample_t* t = &s->tasks[s->task_count++];
+        t->handle = status[i].xHandle;
+        strncpy(t->name, status[i].pcTaskName, sizeof(t->name) - 1);
+        t->name[sizeof(t->name) - 1] = '\0';
+        t->stack_free = (uint32_t)status[i].usStackHighWaterMark;  // ESP-IDF stacks are counted in bytes
+#if HEALTH_CPU_STATS
+        t->core = status[i].xCoreID < portNUM_PROCESSORS ? (int8_t)status[i].xCoreID : -1;
+        t->cpu_pct = cpu_share(base, t->handle, (uint32_t)status[i].ulRunTimeCounter, total_run_time);
+#else
+        t->core = -1;
+        t->cpu_pct = HEALTH_CPU_UNKNOWN;
+#endif
+    }
+    
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+        s->core_load[core] = HEALTH_CPU_UNKNOWN;
+#if HEALTH_CPU_STATS
+        TaskHandle_t idle = xTaskGetIdleTaskHandleForCore(core);
+        for (uint32_t i = 0; i < s->task_count; i++) {
+            if (s->tasks[i].handle == idle && s->tasks[i].cpu_pct != HEALTH_CPU_UNKNOWN) {
+                s->core_load[core] = 100 - s->tasks[i].cpu_pct;
+            }
+        }
+#endif
+    }
+    
+#if HEALTH_CPU_STATS
+    // This sample is the next one's baseline
+    base->count = 0;
+    for (UBaseType_t i = 0; i < count; i++) {
+        base->handles[base->count] = status[i].xHandle;
+        base->run_time[base->count++] = (uint32_t)status[i].ulRunTimeCounter;
+    }
+    base->total = total_run_time != 0 ? total_run_time : 1;
+#else
+    (void)base;
+#endif
+}
+
+static bool cpu_changed(uint8_t now, uint8_t last) {
+    if (now == HEALTH_CPU_UNKNOWN) {
+        return false;
+    }
+    return last == HEALTH_CPU_UNKNOWN || (now > last ? now - last : last - now) >= HEALTH_CPU_DELTA_PCT;
+}
+
+static uint32_t dram_fragmentation(const health_sample_t* s) {
+    const heap_sample_t* dram = &s->heap[0];
+    return dram->free_bytes > 0 ? (uint32_t)(100 - dram->largest * 100 / dram->free_bytes) : 0;
+}
+
+// snprintf onto the end of buf, false once it no longer fits
+static bool append(char* buf, size_t size, size_t* len, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buf + *len, size - *len, fmt, args);
+    va_end(args);
+    if (n < 0 || (size_t)n >= size - *len) {
+        return false;
+    }
+    *len += (size_t)n;
+    return true;
+}
+
+static bool heap_changed(const heap_sample_t* now, const heap_sample_t* last) {
+    size_t delta = HEALTH_MONITOR_DELTA_BYTES;
+    return (now->free_bytes > last->free_bytes ? now->free_bytes - last->free_bytes : last->free_bytes - now->free_bytes) >= delta ||
+           (now->largest > last->largest ? now->largest - last->largest : last->largest - now->largest) >= delta ||
+           (last->min_free > now->min_free && last->min_free - now->min_free >= delta);  // Minimum only falls
+}
+
+static const task_sample_t* find_reported(TaskHandle_t handle) {
+    for (uint32_t i = 0; i < reported_task_count; i++) {
+        if (reported_tasks[i].handle == handle) {
+            return &reported_tasks[i];
+        }
+    }
+    return NULL;
+}
+
+// Format the report - everything when full, otherwise only what changed.
+// sent records the heap regions, CPU shares and core loads included.
+// Returns the length, 0 if nothing changed or it did not fit.
+static size_t format_report(const health_sample_t* s, bool full, health_sent_t* sent, char* buf, size_t size) {
+    size_t len = 0;
+    bool any = full;
+    if (!append(buf, size, &len, "{\"up\":%" PRIu32 "%s", (uint32_t)(esp_timer_get_time() / 1000000LL),
+                full ? ",\"full\":1" : "")) {
+        return 0;
+    }
+    
+    bool open = false;
+    for (size_t i = 0; i < REGION_COUNT; i++) {
+        const heap_sample_t* h = &s->heap[i];
+        sent->heap[i] = false;
+        if (heap_caps_get_total_size(regions[i].caps) == 0 || (!full && !heap_changed(h, &reported_heap[i]))) {
+            continue;  // No such memory on this board, or nothing worth sending
+        }
+        if (!append(buf, size, &len, "%s\"%s\":[%u,%u,%u]", open ? "," : ",\"heap\":{", regions[i].name,
+                    (unsigned)h->free_bytes, (unsigned)h->min_free, (unsigned)h->largest)) {
+            return 0;
+        }
+        sent->heap[i] = true;
+        open = true;
+    }
+    if (open) {
+        if (!append(buf, size, &len, "},\"frag\":%" PRIu32, dram_fragmentation(s))) {
+            return 0;
+        }
+        any = true;
+    }
+    
+    open = false;
+    for (uint32_t i = 0; i < s->task_count; i++) {
+        const task_sample_t* t = &s->tasks[i];
+        const task_sample_t* last = full ? NULL : find_reported(t->handle);
+        if (!full && last != NULL && last->stack_free == t->stack_free) {
+            continue;
+        }
+        if (!append(buf, size, &len, "%s\"%s\":%" PRIu32, open ? "," : ",\"stk\":{", t->name, t->stack_free)) {
+            return 0;
+        }
+        open = true;
+    }
+    if (open) {
+        if (!append(buf, size, &len, "}")) {
+            return 0;
+        }
+        any = true;
+    }
+    
+    // Core affinity only changes when tasks come and go, so it is only in full snapshots
+    open = false;
+    for (uint32_t i = 0; full && i < s->task_count; i++) {
+        if (!append(buf, size, &len, "%s\"%s\":%d", open ? "," : ",\"core\":{", s->tasks[i].name,
+                    (int)s->tasks[i].core)) {
+            return 0;
+        }
+        open = true;
+    }
+    if (open && !append(buf, size, &len, "}")) {
+        return 0;
+    }
+    
+    open = false;
+    for (uint32_t i = 0; i < s->task_count; i++) {
+        const task_sample_t* t = &s->tasks[i];
+        const task_sample_t* last = full ? NULL : find_reported(t->handle);
+        sent->cpu[i] = false;
+        if (t->cpu_pct == HEALTH_CPU_UNKNOWN ||
+            (!full && !cpu_changed(t->cpu_pct, last != NULL ? last->cpu_pct : HEALTH_CPU_UNKNOWN))) {
+            continue;
+        }
+        if (!append(buf, size, &len, "%s\"%s\":%u", open ? "," : ",\"cpu\":{", t->name, (unsigned)t->cpu_pct)) {
+            return 0;
+        }
+        sent->cpu[i] = true;
+        open = true;
+    }
+    sent->load = false;
+    bool load_moved = false;
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+        load_moved = load_moved || cpu_changed(s->core_load[core], reported_load[core]);
+    }
+    if (open || (s->core_load[0] != HEALTH_CPU_UNKNOWN && (full || load_moved))) {
+        if (open && !append(buf, size, &len, "}")) {
+            return 0;
+        }
+        for (int core = 0; core < portNUM_PROCESSORS; core++) {
+            if (!append(buf, size, &len, "%s%u", core == 0 ? ",\"load\":[" : ",", (unsigned)s->core_load[core])) {
+                return 0;
+            }
+        }
+        if (!append(buf, size, &len, "]")) {
+            return 0;
+        }
+        sent->load = true;
+        any = true;
+    }
+    
+    if (!any || !append(buf, size, &len, "}")) {
+        return 0;
+    }
+    return len;
+}
+
+// Only what was sent becomes the new baseline, so slow drift still adds up to a report
+static void remember(const health_sample_t* s, const health_sent_t* sent) {
+    for (size_t i = 0; i < REGION_COUNT; i++) {
+        if (sent->heap[i]) {
+            reported_heap[i] = s->heap[i];
+        }
+    }
+    
+    // Stack sizes are sent whenever they differ, CPU shares only once they have moved far enough
+    static task_sample_t tasks[HEALTH_MAX_TASKS];
+    for (uint32_t i = 0; i < s->task_count; i++) {
+        tasks[i] = s->tasks[i];
+        if (!sent->cpu[i]) {
+            const task_sample_t* last = find_reported(s->tasks[i].handle);
+            tasks[i].cpu_pct = last != NULL ? last->cpu_pct : HEALTH_CPU_UNKNOWN;
+        }
+    }
+    memcpy(reported_tasks, tasks, sizeof(reported_tasks[0]) * s->task_count);
+    reported_task_count = s->task_count;
+    if (sent->load) {
+        memcpy(reported_load, s->core_load, sizeof(reported_load));
+    }
+}
+
+static void health_monitor_task(void* arg) {
+    static health_sample_t s;
+    static char report[HEALTH_REPORT_SIZE];
+    TickType_t last_wake = xTaskGetTickCount();
+    
+    while (true) {
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(HEALTH_MONITOR_INTERVAL_SEC * 1000UL));
+        
+        bool connected = mqtt_client_is_connected();
+        sample(&s, &report_baseline);  // Also while offline, so the CPU baseline stays one interval old
+        if (!connected) {
+            was_connected = false;  // Resend everything after the next connect
+            continue;
+        }
+        
+        bool full = !was_connected || reports_since_full >= HEALTH_MONITOR_FULL_EVERY;
+        health_sent_t sent;
+        size_t len = format_report(&s, full, &sent, report, sizeof(report));
+        if (len == 0) {
+            continue;  // Nothing moved
+        }
+        if (mqtt_client_publish_telemetry("health", report)) {
+            was_connected = true;
+            reports_since_full = full ? 0 : reports_since_full + 1;
+            remember(&s, &sent);
+        }
+    }
+}
+
+bool health_monitor_init() {
+    if (monitor_task != NULL) {
+        return true;
+    }
+    BaseType_t ok = xTaskCreatePinnedToCore(health_monitor_task, "health", HEALTH_TASK_STACK, NULL,
+                                            HEALTH_TASK_PRIORITY, &monitor_task, BACKGROUND_TASK_CORE);
+    if (ok != pdPASS) {
+        ESP_LOGE(TAG, "[Health] Failed to create monitor task");
+        return false;
+    }
+    ESP_LOGI(TAG, "[Health] Sampling every %d s", HEALTH_MONITOR_INTERVAL_SEC);
+    return true;
+}
+
+size_t health_monitor_format_json(char* buf, size_t size) {
+    static health_sample_t s;
+    static cpu_baseline_t base;
+    health_sent_t sent;
+    sample(&s, &base);
+    return format_report(&s, true, &sent, buf, size);
+}
+
+void health_monitor_log_report() {
+    static health_sample_t s;
+    static cpu_baseline_t base;
+    sample(&s, &base);
+    
+    ESP_LOGI(TAG, "[Health] %-8s %8s %8s %8s", "heap", "free", "min", "largest");
+    for (size_t i = 0; i < REGION_COUNT; i++) {
+        if (heap_caps_get_total_size(regions[i].caps) == 0) {
+            continue;
+        }
+        ESP_LOGI(TAG, "[Health] %-8s %8u %8u %8u", regions[i].name,
+                 (unsigned)s.heap[i].free_bytes, (unsigned)s.heap[i].min_free, (unsigned)s.heap[i].largest);
+    }
+    ESP_LOGI(TAG, "[Health] DRAM fragmentation %" PRIu32 "%%", dram_fragmentation(&s));
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+        if (s.core_load[core] != HEALTH_CPU_UNKNOWN) {
+            ESP_LOGI(TAG, "[Health] Core %d load %u%%", core, (unsigned)s.core_load[core]);
+        }
+    }
+    ESP_LOGI(TAG, "[Health] %-16s %10s %4s %4s", "task", "stack free", "core", "cpu");
+    for (uint32_t i = 0; i < s.task_count; i++) {
+        const task_sample_t* t = &s.tasks[i];
+        char cpu[8] = "-";  // First call has no baseline yet
+        if (t->cpu_pct != HEALTH_CPU_UNKNOWN) {
+            snprintf(cpu, sizeof(cpu), "%u%%", (unsigned)t->cpu_pct);
+        }
+        ESP_LOGI(TAG, "[Health] %-16s %10" PRIu32 " %4d %4s", t->name, t->stack_free, (int)t->core, cpu);
+    }
+}
+
+#endif // HEALTH_MONITOR_ENABLED
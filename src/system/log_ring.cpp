@@ -0,0 +1,585 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Binary Log Ring Implementation
+ * 
+ * Record: log_record_t header, then one packed value per conversion in the
+ * format (and per '*' width/precision): int/long/long long/double/pointer as
+ * their native bytes, strings as a length byte plus up to LOG_RING_MAX_STR
+ * characters. The same format scan drives packing and rendering, so nothing
+ * describing the arguments needs to be stored.
+ * 
+ * The ring is a byte FIFO (tail offset + used bytes) in RTC slow memory;
+ * writing a record first evicts whole records from the tail.
+ */
+
+// Project headers
+#include "config.h"
+#include "system/log_ring.h"
+
+#if LOG_RING_ENABLED
+
+// System/Standard library headers
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// ESP-IDF framework headers
+#include <esp_app_desc.h>
+#include <esp_attr.h>
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+#include <esp_memory_utils.h>
+#include <esp_system.h>
+#include <freertos/FreeRTOS.h>
+#define TAG "log_ring"
+
+#define LOG_RING_MAGIC 0x474F4C52UL    // "RLOG"
+#define LOG_RING_MAX_ARGS 96           // Packed argument bytes per record
+#define LOG_RING_MAX_STR 32            // Characters kept per string argument
+#define LOG_RING_LINE_MAX 256          // Rendered line, longer ones are cut
+#define LOG_RING_SPEC_MAX 24           // One rendered conversion spec
+
+typedef struct {
+    uint16_t len;        // Whole record including this header
+    uint16_t boot;       // Low bits of the boot number that wrote it
+    uintptr_t format;    // Address of the format string
+} log_record_t;
+
+typedef struct {
+    uint32_t magic;
+    uint8_t elf_sha[8];  // Firmware the format addresses belong to
+    uint32_t boot;       // Soft resets since the ring was created
+    uint32_t tail;       // Offset of the oldest record in data
+    uint32_t used;       // Bytes of records from tail (wrapping)
+    uint8_t data[LOG_RING_SIZE];
+} log_ring_store_t;
+
+typedef enum {
+    ARG_PERCENT,         // "%%", no argument
+    ARG_INT,
+    ARG_LONG,
+    ARG_LLONG,
+    ARG_DOUBLE,
+    ARG_PTR,
+    ARG_STR,
+    ARG_BAD,             // Not representable (%n, %Lf, ...) - stop here
+} arg_kind_t;
+
+typedef struct {
+    const char* start;   // The '%'
+    const char* end;     // One past the conversion character
+    arg_kind_t kind;
+    bool star_width;
+    bool star_prec;
+    int precision;       // Literal precision, -1 if none
+} conversion_t;
+
+static RTC_NOINIT_ATTR log_ring_store_t store;
+
+static portMUX_TYPE ring_mux = portMUX_INITIALIZER_UNLOCKED;
+static vprintf_like_t next_vprintf = NULL;
+static bool recording = false;
+
+// Find the next conversion at or after p, false at the end of the format
+static bool next_conversion(const char* p, conversion_t* conv) {
+    const char* s = strchr(p, '%');
+    if (s == NULL) {
+        return false;
+    }
+    conv->start = s++;
+    conv->kind = ARG_BAD;
+    conv->star_width = false;
+    conv->star_prec = false;
+    conv->precision = -1;
+    
+    if (*s == '%') {
+        conv->kind = ARG_PERCENT;
+        conv->end = s + 1;
+        return true;
+    }
+    while (*s != '\0' && strchr("-+ #0", *s) != NULL) {
+        s++;
+    }
+    if (*s == '*') {
+        conv->star_width = true;
+        s++;
+    }
+    while (isdigit((unsigned char)*s)) {
+        s++;
+    }
+    if (*s == '.') {
+        s++;
+        if (*s == '*') {
+            conv->star_prec = true;
+            s++;
+        } else {
+            conv->precision = 0;
+            while (isdigit((unsigned char)*s)) {
+                conv->precision = conv->precision * 10 + (*s - '0');
+                s++;
+            }
+        }
+    }
+    
+    int longs = 0;
+    bool long_double = false;
+    while (*s != '\0' && strchr("hlzjtL", *s) != NULL) {
+        if (*s == 'l') {
+            longs++;
+        } else if (*s == 'j') {
+            longs = 2;
+        } else if (*s == 'z' || *s == 't') {
+            longs = 1;   // size_t / ptrdiff_t are long-sized here
+        } else if (*s == 'L') {
+            long_double = true;
+        }
+        s++;
+    }
+    
+    switch (*s) {
+        case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'c':
+            conv->kind = longs >= 2 ? ARG_LLONG : (longs == 1 ? ARG_LONG : ARG_INT);
+            break;
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+            conv->kind = long_double ? ARG_BAD : ARG_DOUBLE;
+            break;
+        case 's':
+            conv->kind = ARG_STR;
+            break;
+        case 'p':
+            conv->kind = ARG_PTR;
+            break;
+        default:
+            break;
+    }
+    conv->end = (*s != '\0') ? s + 1 : s;
+    return true;
+}
+
+static bool put(uint8_t* out, size_t cap, size_t* used, const void* value, size_t len) {
+    if (*used + len > cap) {
+        return false;
+    }
+    memcpy(out + *used, value, len);
+    *used += len;
+    return true;
+}
+
+static bool take(const uint8_t** args, const uint8_t* end, void* value, size_t len) {
+    if ((size_t)(end - *args) < len) {
+        return false;
+    }
+    memcpy(value, *args, len);
+    *args += len;
+    return true;
+}
+
+// Pack the arguments of format into out, returns the bytes used
+static size_t pack_args(const char* format, va_list args, uint8_t* out, size_t cap) {
+    size_t used = 0;
+    conversion_t conv;
+    const char* p = format;
+    
+    while (next_conversion(p, &conv)) {
+        p = conv.end;
+        if (conv.kind == ARG_BAD) {
+            break;
+        }
+        int precision = conv.precision;
+        if (conv.star_width) {
+            int width = va_arg(args, int);
+            if (!put(out, cap, &used, &width, sizeof(width))) {
+                break;
+            }
+        }
+        if (conv.star_prec) {
+            precision = va_arg(args, int);
+            if (!put(out, cap, &used, &precision, sizeof(precision))) {
+                break;
+            }
+        }
+        
+        bool ok = true;
+        switch (conv.kind) {
+            case ARG_PERCENT:
+                break;
+            case ARG_INT: {
+                int value = va_arg(args, int);
+                ok = put(out, cap, &used, &value, sizeof(value));
+                break;
+            }
+            case ARG_LONG: {
+                long value = va_arg(args, long);
+                ok = put(out, cap, &used, &value, sizeof(value));
+                break;
+            }
+            case ARG_LLONG: {
+                long long value = va_arg(args, long long);
+                ok = put(out, cap, &used, &value, sizeof(value));
+                break;
+            }
+            case ARG_DOUBLE: {
+                double value = va_arg(args, double);
+                ok = put(out, cap, &used, &value, sizeof(value));
+                break;
+            }
+            case ARG_PTR: {
+                void* value = va_arg(args, void*);
+                ok = put(out, cap, &used, &value, sizeof(value));
+                break;
+            }
+            case ARG_STR: {
+                const char* value = va_arg(args, const char*);
+                if (value == NULL) {
+                    value = "(null)";
+                }
+                size_t limit = (precision >= 0 && precision < LOG_RING_MAX_STR) ? (size_t)precision : LOG_RING_MAX_STR;
+                uint8_t len = (uint8_t)strnlen(value, limit);
+                ok = put(out, cap, &used, &len, 1) && put(out, cap, &used, value, len);
+                break;
+            }
+            case ARG_BAD:
+                break;
+        }
+        if (!ok) {
+            break;
+        }
+    }
+    return used;
+}
+
+// Append text to out (size includes the terminator)
+static size_t append(char* out, size_t size, size_t len, const char* text, size_t text_len) {
+    if (len + 1 >= size) {
+        return len;
+    }
+    if (text_len > size - 1 - len) {
+        text_len = size - 1 - len;
+    }
+    memcpy(out + len, text, text_len);
+    len += text_len;
+    out[len] = '\0';
+    return len;
+}
+
+// Render one record into out, returns the length
+static size_t render_record(const char* format, const uint8_t* args, size_t args_len, char* out, size_t size) {
+    const uint8_t* end = args + args_len;
+    size_t len = 0;
+    conversion_t conv;
+    const char* p = format;
+    bool complete = true;
+    out[0] = '\0';
+    
+    while (next_conversion(p, &conv)) {
+        len = append(out, size, len, p, conv.start - p);
+        if (conv.kind == ARG_PERCENT) {
+            len = append(out, size, len, "%", 1);
+            p = conv.end;
+            continue;
+        }
+        if (conv.kind == ARG_BAD) {
+            complete = false;
+            break;
+        }
+        
+        // Rebuild the spec with any '*' replaced by the packed value
+        char spec[LOG_RING_SPEC_MAX];
+        size_t spec_len = 0;
+        bool ok = true;
+        for (const char* s = conv.start; s < conv.end && spec_len < sizeof(spec) - 12; s++) {
+            if (*s == '*') {
+                int value = 0;
+                ok = take(&args, end, &value, sizeof(value));
+                spec_len += snprintf(spec + spec_len, sizeof(spec) - spec_len, "%d", value);
+            } else {
+                spec[spec_len++] = *s;
+            }
+        }
+        spec[spec_len] = '\0';
+        
+        char* dst = out + len;
+        size_t room = size - len;
+        int written = 0;
+        switch (conv.kind) {
+            case ARG_INT: {
+                int value;
+                ok = ok && take(&args, end, &value, sizeof(value));
+                written = ok ? snprintf(dst, room, spec, value) : 0;
+                break;
+            }
+            case ARG_LONG: {
+                long value;
+                ok = ok && take(&args, end, &value, sizeof(value));
+                written = ok ? snprintf(dst, room, spec, value) : 0;
+                break;
+            }
+            case ARG_LLONG: {
+                long long value;
+                ok = ok && take(&args, end, &value, sizeof(value));
+                written = ok ? snprintf(dst, room, spec, value) : 0;
+                break;
+            }
+            case ARG_DOUBLE: {
+                double value;
+                ok = ok && take(&args, end, &value, sizeof(value));
+                written = ok ? snprintf(dst, room, spec, value) : 0;
+                break;
+            }
+            case ARG_PTR: {
+                void* value;
+                ok = ok && take(&args, end, &value, sizeof(value));
+                written = ok ? snprintf(dst, room, spec, value) : 0;
+                break;
+            }
+            case ARG_STR: {
+                char value[LOG_RING_MAX_STR + 1];
+                uint8_t value_len = 0;
+                ok = ok && take(&args, end, &value_len, 1) && value_len <= LOG_RING_MAX_STR &&
+                     take(&args, end, value, value_len);
+                if (ok) {
+                    value[value_len] = '\0';
+                    written = snprintf(dst, room, spec, value);
+                }
+                break;
+            }
+            default:
+                break;
+        }
+        if (!ok) {
+            complete = false;   // Arguments were cut when recording
+            break;
+        }
+        if (written > 0) {
+            len += ((size_t)written < room) ? (size_t)written : room - 1;
+        }
+        p = conv.end;
+    }
+    if (complete) {
+        len = append(out, size, len, p, strlen(p));
+    }
+    if (len == 0 || out[len - 1] != '\n') {
+        len = append(out, size, len, "\n", 1);
+    }
+    return len;
+}
+
+// Copy len bytes starting at ring offset (wrapping) - at most two pieces
+static void ring_copy_out(uint32_t offset, void* dst, size_t len) {
+    offset %= LOG_RING_SIZE;
+    size_t first = (len < LOG_RING_SIZE - offset) ? len : LOG_RING_SIZE - offset;
+    memcpy(dst, store.data + offset, first);
+    memcpy((uint8_t*)dst + first, store.data, len - first);
+}
+
+static void ring_copy_in(uint32_t offset, const void* src, size_t len) {
+    offset %= LOG_RING_SIZE;
+    size_t first = (len < LOG_RING_SIZE - offset) ? len : LOG_RING_SIZE - offset;
+    memcpy(store.data + offset, src, first);
+    memcpy(store.data, (const uint8_t*)src + first, len - first);
+}
+
+static bool format_address_valid(uintptr_t format) {
+    const void* ptr = (const void*)format;
+    return esp_ptr_in_drom(ptr) || esp_ptr_in_dram(ptr);
+}
+
+// Check every record in a ring left by the previous boot
+static bool ring_valid() {
+    if (store.tail >= LOG_RING_SIZE || store.used > LOG_RING_SIZE) {
+        return false;
+    }
+    uint32_t walked = 0;
+    while (walked < store.used) {
+        log_record_t header;
+        if (store.used - walked < sizeof(header)) {
+            return false;
+        }
+        ring_copy_out(store.tail + walked, &header, sizeof(header));
+        if (header.len < sizeof(header) || header.len > sizeof(header) + LOG_RING_MAX_ARGS ||
+            !format_address_valid(header.format)) {
+            return false;
+        }
+        walked += header.len;
+    }
+    return walked == store.used;
+}
+
+static void ring_reset() {
+    store.tail = 0;
+    store.used = 0;
+}
+
+// E/W/I/D/V as the ESP-IDF log formats start with, 0 if unknown
+static int level_rank(int letter) {
+    switch (letter) {
+        case 'E': return 1;
+        case 'W': return 2;
+        case 'I': return 3;
+        case 'D': return 4;
+        case 'V': return 5;
+        default: return 0;
+    }
+}
+
+// Level of a log line: LOG_FORMAT puts the letter first, after the color escape ("\033[0;32mI (%lu) %s: ")
+static int format_level(const char* format, va_list args) {
+    const char* p = format;
+    if (p[0] == '\033' && p[1] == '[') {
+        p += 2;
+        while (*p != '\0' && *p != 'm') {
+            p++;
+        }
+        if (*p == 'm') {
+            p++;
+        }
+    }
+    if (level_rank(p[0]) != 0 && p[1] == ' ' && p[2] == '(') {
+        return level_rank(p[0]);
+    }
+    
+    // Formats that pass the letter as an argument ("%c (%lu) %s: ")
+    conversion_t conv;
+    if (next_conversion(format, &conv) && conv.kind == ARG_INT && conv.end[-1] == 'c' &&
+        !conv.star_width && !conv.star_prec) {
+        va_list peek;
+        va_copy(peek, args);
+        int letter = va_arg(peek, int);
+        va_end(peek);
+        return level_rank(letter);
+    }
+    return 0;
+}
+
+static void record(const char* format, va_list args) {
+    // Filter on the level before packing anything
+    if (format_level(format, args) > LOG_RING_LEVEL) {
+        return;
+    }
+    
+    uint8_t buf[sizeof(log_record_t) + LOG_RING_MAX_ARGS];
+    log_record_t header;
+    header.len = (uint16_t)(sizeof(header) + pack_args(format, args, buf + sizeof(header), LOG_RING_MAX_ARGS));
+    header.format = (uintptr_t)format;
+    
+    portENTER_CRITICAL(&ring_mux);
+    header.boot = (uint16_t)store.boot;
+    memcpy(buf, &header, sizeof(header));
+    while (store.used + header.len > LOG_RING_SIZE) {
+        log_record_t oldest;
+        ring_copy_out(store.tail, &oldest, sizeof(oldest));
+        store.tail = (store.tail + oldest.len) % LOG_RING_SIZE;
+        store.used -= oldest.len;
+    }
+    ring_copy_in(store.tail + store.used, buf, header.len);
+    store.used += header.len;
+    portEXIT_CRITICAL(&ring_mux);
+}
+
+static int log_ring_vprintf(const char* format, va_list args) {
+    if (recording) {
+        va_list copy;
+        va_copy(copy, args);
+        record(format, copy);
+        va_end(copy);
+    }
+    return next_vprintf != NULL ? next_vprintf(format, args) : vprintf(format, args);
+}
+
+void log_ring_init() {
+    if (recording) {
+        return;
+    }
+    const esp_app_desc_t* app = esp_app_get_description();
+    bool keep = esp_reset_reason() != ESP_RST_POWERON && store.magic == LOG_RING_MAGIC &&
+                memcmp(store.elf_sha, app->app_elf_sha256, sizeof(store.elf_sha)) == 0 && ring_valid();
+    if (keep) {
+        store.boot++;
+    } else {
+        store.magic = LOG_RING_MAGIC;
+        memcpy(store.elf_sha, app->app_elf_sha256, sizeof(store.elf_sha));
+        store.boot = 0;
+        ring_reset();
+    }
+    
+    next_vprintf = esp_log_set_vprintf(log_ring_vprintf);
+    recording = true;
+    ESP_LOGI(TAG, "[Log Ring] %d byte ring in RTC memory, %u bytes kept from earlier boots",
+             LOG_RING_SIZE, (unsigned)(keep ? store.used : 0));
+}
+
+int log_ring_render(log_ring_chunk_cb_t cb, void* ctx) {
+    uint8_t* snapshot = (uint8_t*)heap_caps_malloc(LOG_RING_SIZE, MALLOC_CAP_8BIT);
+    char* chunk = (char*)heap_caps_malloc(LOG_RING_CHUNK_SIZE + 1, MALLOC_CAP_8BIT);
+    if (snapshot == NULL || chunk == NULL) {
+        heap_caps_free(snapshot);
+        heap_caps_free(chunk);
+        ESP_LOGE(TAG, "[Log Ring] No memory to render the ring");
+        cb("", 0, 0, true, ctx);
+        return 0;
+    }
+    
+    // Copy out first so logging is never held up by rendering
+    portENTER_CRITICAL(&ring_mux);
+    uint32_t used = store.used;
+    uint16_t boot = (uint16_t)store.boot;
+    ring_copy_out(store.tail, snapshot, used);
+    portEXIT_CRITICAL(&ring_mux);
+    
+    int records = 0;
+    int index = 0;
+    size_t chunk_len = 0;
+    int last_boot = -1;
+    char line[LOG_RING_LINE_MAX];
+    uint32_t offset = 0;
+    while (offset + sizeof(log_record_t) <= used) {
+        log_record_t header;
+        memcpy(&header, snapshot + offset, sizeof(header));
+        if (header.len < sizeof(header) || offset + header.len > used) {
+            break;
+        }
+        
+        size_t line_len = 0;
+        if (header.boot != last_boot && header.boot != boot) {
+            line_len = snprintf(line, sizeof(line), "--- boot -%u ---\n", (unsigned)(uint16_t)(boot - header.boot));
+        } else if (header.boot != last_boot) {
+            line_len = snprintf(line, sizeof(line), "--- this boot ---\n");
+        }
+        last_boot = header.boot;
+        line_len += render_record((const char*)header.format, snapshot + offset + sizeof(header),
+                                  header.len - sizeof(header), line + line_len, sizeof(line) - line_len);
+        
+        if (chunk_len + line_len > LOG_RING_CHUNK_SIZE) {
+            cb(chunk, chunk_len, index++, false, ctx);
+            chunk_len = 0;
+        }
+        memcpy(chunk + chunk_len, line, line_len);
+        chunk_len += line_len;
+        chunk[chunk_len] = '\0';
+        offset += header.len;
+        records++;
+    }
+    chunk[chunk_len] = '\0';
+    cb(chunk, chunk_len, index, true, ctx);
+    
+    heap_caps_free(snapshot);
+    heap_caps_free(chunk);
+    return records;
+}
+
+void log_ring_clear() {
+    portENTER_CRITICAL(&ring_mux);
+    ring_reset();
+    portEXIT_CRITICAL(&ring_mux);
+}
+
+#endif // LOG_RING_ENABLED
@@ -0,0 +1,246 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Asynchronous Log Sink Implementation
+ * 
+ * Records are a log_record_t header (wall clock second) followed by the
+ * formatted, NUL-terminated line, stored whole (no split) in a FreeRTOS byte
+ * ring. A producer measures the line, acquires exactly that much space with
+ * a zero timeout and formats straight into it, so a log call needs no line
+ * buffer on the caller's stack and never waits for the 115200 baud UART.
+ * 
+ * The panic handler is wrapped (-Wl,--wrap=esp_panic_handler, see
+ * src/CMakeLists.txt) to print the completed records through the ROM before
+ * the panic report. ring_users counts calls inside the ring API; with the
+ * other core stalled, zero means no ring lock can be held, otherwise the
+ * queue is skipped rather than risk spinning on a lock forever.
+ */
+
+// Project headers
+#include "config.h"
+#include "system/log_sink.h"
+
+// System/Standard library headers
+#include <atomic>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// ESP-IDF framework headers
+#include <freertos/FreeRTOS.h>
+
+#define LOG_TIME_VALID_EPOCH 1609459200   // 2021-01-01: anything earlier is time since boot
+
+static portMUX_TYPE time_mux = portMUX_INITIALIZER_UNLOCKED;
+static time_t cached_second = 0;
+static char cached_time[LOG_TIME_PREFIX_SIZE];
+
+/**
+ * Format sec into the cache if it is a new second, copy it into buf
+ */
+static bool time_prefix_for(time_t sec, char* buf, size_t size) {
+    if (sec < LOG_TIME_VALID_EPOCH || size < LOG_TIME_PREFIX_SIZE) {
+        if (size > 0) {
+            buf[0] = '\0';
+        }
+        return false;
+    }
+    
+    bool fresh;
+    taskENTER_CRITICAL(&time_mux);
+    fresh = (sec == cached_second);
+    if (fresh) {
+        memcpy(buf, cached_time, LOG_TIME_PREFIX_SIZE);
+    }
+    taskEXIT_CRITICAL(&time_mux);
+    if (fresh) {
+        return true;
+    }
+    
+    // Format outside the critical section, then publish for the next caller
+    struct tm timeinfo;
+    localtime_r(&sec, &timeinfo);
+    strftime(buf, LOG_TIME_PREFIX_SIZE, "%Y-%m-%d %H:%M:%S", &timeinfo);
+    taskENTER_CRITICAL(&time_mux);
+    if (sec > cached_second) {
+        memcpy(cached_time, buf, LOG_TIME_PREFIX_SIZE);
+        cached_second = sec;
+    }
+    taskEXIT_CRITICAL(&time_mux);
+    return true;
+}
+
+bool log_time_prefix(char* buf, size_t size) {
+    return time_prefix_for(time(NULL), buf, size);
+}
+
+#if LOG_SINK_ENABLED
+
+// ESP-IDF framework headers
+#include <esp_attr.h>
+#include <esp_log.h>
+#include <esp_rom_sys.h>
+#include <esp_system.h>
+#include <freertos/ringbuf.h>
+#include <freertos/task.h>
+#define TAG "log_sink"
+
+#define LOG_SINK_LINE_MAX 256      // Longer lines are truncated
+#define LOG_SINK_STACK 3072
+#define LOG_SINK_PRIORITY 1        // Below everything but idle
+
+typedef struct {
+    uint32_t second;               // Wall clock at the log call
+} log_record_t;
+
+static RingbufHandle_t ring = NULL;
+static TaskHandle_t drain_task = NULL;
+static std::atomic<uint32_t> dropped(0);
+static std::atomic<int> ring_users(0);   // Calls inside the ring API (panic drain guard)
+static uint32_t dropped_reported = 0;
+
+static void write_record(const log_record_t* record, const char* text, size_t len) {
+    char stamp[LOG_TIME_PREFIX_SIZE];
+    if (time_prefix_for((time_t)record->second, stamp, sizeof(stamp))) {
+        fputc('[', stdout);
+        fputs(stamp, stdout);
+        fputs("] ", stdout);
+    }
+    fwrite(text, 1, len, stdout);
+}
+
+/**
+ * Write out queued records, waiting up to wait for the first one
+ */
+static void drain(TickType_t wait) {
+    size_t size;
+    uint8_t* item;
+    while (true) {
+        // Wait outside the ring API so a blocked drain task never holds off the panic drain
+        if (wait != 0) {
+            ulTaskNotifyTake(pdTRUE, wait);
+        }
+        ring_users.fetch_add(1);
+        item = (uint8_t*)xRingbufferReceive(ring, &size, 0);
+        ring_users.fetch_sub(1);
+        if (item == NULL) {
+            break;
+        }
+        write_record((const log_record_t*)item, (const char*)item + sizeof(log_record_t),
+                     size - sizeof(log_record_t) - 1);
+        ring_users.fetch_add(1);
+        vRingbufferReturnItem(ring, item);
+        ring_users.fetch_sub(1);
+        wait = 0;
+    }
+    fflush(stdout);
+    
+    uint32_t lost = dropped.load();
+    if (lost != dropped_reported) {
+        printf("W [log] %u lines dropped (ring full)\n", (unsigned)(lost - dropped_reported));
+        dropped_reported = lost;
+    }
+}
+
+static void log_sink_task(void* param) {
+    while (true) {
+        drain(portMAX_DELAY);
+    }
+}
+
+static int log_sink_vprintf(const char* format, va_list args) {
+    va_list measure;
+    va_copy(measure, args);
+    int len = vsnprintf(NULL, 0, format, measure);
+    va_end(measure);
+    if (len < 0) {
+        return len;
+    }
+    if (len >= LOG_SINK_LINE_MAX) {
+        len = LOG_SINK_LINE_MAX - 1;
+    }
+    
+    void* item = NULL;
+    ring_users.fetch_add(1);
+    BaseType_t acquired = xRingbufferSendAcquire(ring, &item, sizeof(log_record_t) + len + 1, 0);
+    ring_users.fetch_sub(1);
+    if (acquired != pdTRUE || item == NULL) {
+        dropped.fetch_add(1);
+        return len;
+    }
+    
+    log_record_t* header = (log_record_t*)item;
+    char* text = (char*)item + sizeof(log_record_t);
+    header->second = (uint32_t)time(NULL);
+    if (vsnprintf(text, len + 1, format, args) > len && len > 0) {
+        text[len - 1] = '\n';   // Keep the line break of a truncated line
+    }
+    
+    ring_users.fetch_add(1);
+    xRingbufferSendComplete(ring, item);
+    ring_users.fetch_sub(1);
+    if (drain_task != NULL) {
+        xTaskNotifyGive(drain_task);
+    }
+    return len;
+}
+
+extern "C" void __real_esp_panic_handler(void* info);
+
+/**
+ * Print the queued lines through the ROM, then hand over to the panic handler
+ * 
+ * Records are written without the time prefix (no localtime in a panic).
+ */
+extern "C" IRAM_ATTR void __wrap_esp_panic_handler(void* info) {
+    if (ring != NULL && ring_users.load() == 0) {
+        size_t size;
+        void* item;
+        while ((item = xRingbufferReceiveFromISR(ring, &size)) != NULL) {
+            esp_rom_printf("%s", (const char*)item + sizeof(log_record_t));
+            vRingbufferReturnItemFromISR(ring, item, NULL);
+        }
+    }
+    __real_esp_panic_handler(info);
+}
+
+void log_sink_init() {
+    if (ring != NULL) {
+        return;
+    }
+    ring = xRingbufferCreate(LOG_SINK_BUFFER_SIZE, RINGBUF_TYPE_NOSPLIT);
+    if (ring == NULL) {
+        ESP_LOGE(TAG, "[Log Sink] Failed to allocate %d byte ring - logging stays synchronous",
+                 LOG_SINK_BUFFER_SIZE);
+        return;
+    }
+    if (xTaskCreatePinnedToCore(log_sink_task, "log_sink", LOG_SINK_STACK, NULL, LOG_SINK_PRIORITY,
+                                &drain_task, BACKGROUND_TASK_CORE) != pdPASS) {
+        vRingbufferDelete(ring);
+        ring = NULL;
+        ESP_LOGE(TAG, "[Log Sink] Failed to create drain task - logging stays synchronous");
+        return;
+    }
+    esp_register_shutdown_handler(log_sink_flush);   // esp_restart() - a panic drains in the wrapper above
+    esp_log_set_vprintf(log_sink_vprintf);
+    ESP_LOGI(TAG, "[Log Sink] Logging through a %d byte ring", LOG_SINK_BUFFER_SIZE);
+}
+
+void log_sink_flush() {
+    if (ring != NULL) {
+        drain(0);
+    }
+}
+
+uint32_t log_sink_dropped() {
+    return dropped.load();
+}
+
+#endif // LOG_SINK_ENABLED
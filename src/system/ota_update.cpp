@@ -0,0 +1,495 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * OTA Update Implementation
+ * 
+ * One download task at a time, created by the start command and deleted when
+ * it is done. It reads the image in OTA_CHUNK_SIZE pieces, inflates them
+ * with the ROM copy of miniz (32 KB circular dictionary) when the image is
+ * zlib-compressed, and hands each piece to esp_ota_write() with sequential
+ * writes, so sectors are erased as they are reached instead of the whole
+ * slot up front.
+ * 
+ * The main loop reports whether a tap is pouring; the task checks that flag
+ * before and between chunks. Confirming, rolling back and restarting are
+ * left to the main loop, which knows that no pour is in progress.
+ */
+
+// Project headers
+#include "config.h"
+#include "system/ota_update.h"
+
+#if OTA_UPDATES_ENABLED
+
+#include "mqtt/mqtt_manager.h"
+#include "system/config_store.h"
+
+// System/Standard library headers
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+// ESP-IDF framework headers
+#include <esp_app_desc.h>
+#include <esp_crt_bundle.h>
+#include <esp_heap_caps.h>
+#include <esp_http_client.h>
+#include <esp_log.h>
+#include <esp_ota_ops.h>
+#include <esp_system.h>
+#include <esp_timer.h>
+#include <esp32/rom/miniz.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <mbedtls/sha256.h>
+#define TAG "ota"
+
+#define OTA_TASK_STACK 8192      // TLS handshake
+#define OTA_TASK_PRIORITY 3      // Below WiFi and MQTT
+#define OTA_CHUNK_SIZE 4096
+#define OTA_HTTP_TIMEOUT_MS 15000
+#define OTA_MAX_ATTEMPTS 3       // Network failures before giving up (pour interruptions do not count)
+#define OTA_RETRY_DELAY_MS 10000
+#define OTA_IDLE_POLL_MS 1000    // Pour check while waiting
+#define OTA_PROGRESS_BYTES (256 * 1024)
+#define OTA_URL_SIZE 256
+#define OTA_ERROR_SIZE 48
+#define OTA_REPORT_SIZE 320
+
+typedef enum {
+    OTA_IDLE,
+    OTA_WAITING,       // For idle taps
+    OTA_DOWNLOADING,
+    OTA_READY,         // Slot written and bootable, restart pending
+    OTA_FAILED,
+} ota_state_t;
+
+// Download task only
+typedef struct {
+    char url[OTA_URL_SIZE];
+    uint8_t sha256[32];
+    bool zlib;
+} ota_request_t;
+
+// Working memory of one download attempt (heap, PSRAM when available)
+typedef struct {
+    esp_ota_handle_t handle;
+    mbedtls_sha256_context sha;
+    uint32_t written;
+    uint32_t next_progress;
+    tinfl_decompressor inflator;
+    size_t dict_ofs;
+    bool inflate_done;
+    uint8_t dict[TINFL_LZ_DICT_SIZE];
+    uint8_t chunk[OTA_CHUNK_SIZE];
+} ota_stream_t;
+
+static portMUX_TYPE ota_mux = portMUX_INITIALIZER_UNLOCKED;
+static ota_state_t state = OTA_IDLE;       // ota_mux
+static uint32_t written = 0;               // ota_mux
+static char error[OTA_ERROR_SIZE] = "";    // ota_mux
+static volatile bool task_running = false; // Set by start, cleared by the task
+
+static ota_request_t request;
+static volatile bool cancel_requested = false;
+static volatile bool pour_busy = true;     // Until the main loop first reports
+
+static volatile bool pending_verify = false;  // Running a new image not yet confirmed
+
+// Main loop only
+static bool connected_seen = false;
+
+static const char* state_name(ota_state_t s) {
+    switch (s) {
+        case OTA_IDLE:        return "idle";
+        case OTA_WAITING:     return "waiting";
+        case OTA_DOWNLOADING: return "downloading";
+        case OTA_READY:       return "ready";
+        case OTA_FAILED:      return "failed";
+        default:              return "?";
+    }
+}
+
+static void set_state(ota_state_t s, uint32_t bytes, const char* err) {
+    portENTER_CRITICAL(&ota_mux);
+    state = s;
+    written = bytes;
+    strncpy(error, err != NULL ? err : "", sizeof(error) - 1);
+    error[sizeof(error) - 1] = '\0';
+    portEXIT_CRITICAL(&ota_mux);
+}
+
+static size_t format_status(JsonDocument& doc, char* reply, size_t size) {
+    portENTER_CRITICAL(&ota_mux);
+    ota_state_t s = state;
+    uint32_t bytes = written;
+    char err[OTA_ERROR_SIZE];
+    memcpy(err, error, sizeof(err));
+    portEXIT_CRITICAL(&ota_mux);
+    
+    doc["state"] = state_name(s);
+    doc["written"] = bytes;
+    if (err[0] != '\0' && doc["error"].isNull()) {
+        doc["error"] = err;
+    }
+    const esp_partition_t* running = esp_ota_get_running_partition();
+    doc["running"] = running != NULL ? running->label : "";
+    doc["version"] = esp_app_get_description()->version;
+    if (pending_verify) {
+        doc["pending_verify"] = true;
+    }
+    if (measureJson(doc) >= size) {
+        return 0;
+    }
+    return serializeJson(doc, reply, size);
+}
+
+static void publish_status() {
+    JsonDocument doc;
+    char report[OTA_REPORT_SIZE];
+    if (format_status(doc, report, sizeof(report)) > 0) {
+        mqtt_client_publish_telemetry("ota", report);
+    }
+}
+
+static bool parse_sha256(const char* hex, uint8_t* out) {
+    if (strlen(hex) != 64) {
+        return false;
+    }
+    for (int i = 0; i < 64; i++) {
+        char c = hex[i];
+        int nibble = (c >= '0' && c <= '9') ? c - '0' :
+                     (c >= 'a' && c <= 'f') ? c - 'a' + 10 :
+                     (c >= 'A' && c <= 'F') ? c - 'A' + 10 : -1;
+        if (nibble < 0) {
+            return false;
+        }
+        out[i / 2] = (i % 2 == 0) ? (uint8_t)(nibble << 4) : (uint8_t)(out[i / 2] | nibble);
+    }
+    return true;
+}
+
+// Uncompressed image bytes: hash and write to the slot
+static const char* write_image(ota_stream_t* s, const uint8_t* data, size_t len) {
+    mbedtls_sha256_update(&s->sha, data, len);
+    esp_err_t err = esp_ota_write(s->handle, data, len);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "[OTA] Write failed at %" PRIu32 ": %s", s->written, esp_err_to_name(err));
+        return err == ESP_ERR_OTA_VALIDATE_FAILED ? "not a firmware image" : "flash write failed";
+    }
+    s->written += len;
+    if (s->written >= s->next_progress) {
+        s->next_progress += OTA_PROGRESS_BYTES;
+        set_state(OTA_DOWNLOADING, s->written, NULL);
+        publish_status();
+    }
+    return NULL;
+}
+
+// Compressed bytes as they arrive; output wraps around the dictionary
+static const char* inflate_chunk(ota_stream_t* s, const uint8_t* in, size_t len) {
+    while (!s->inflate_done) {
+        size_t in_bytes = len;
+        size_t out_bytes = TINFL_LZ_DICT_SIZE - s->dict_ofs;
+        tinfl_status status = tinfl_decompress(&s->inflator, in, &in_bytes, s->dict, s->dict + s->dict_ofs,
+                                               &out_bytes, TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_HAS_MORE_INPUT);
+        in += in_bytes;
+        len -= in_bytes;
+        if (out_bytes > 0) {
+            const char* err = write_image(s, s->dict + s->dict_ofs, out_bytes);
+            if (err != NULL) {
+                return err;
+            }
+            s->dict_ofs = (s->dict_ofs + out_bytes) & (TINFL_LZ_DICT_SIZE - 1);
+        }
+        if (status == TINFL_STATUS_DONE) {
+            s->inflate_done = true;
+        } else if (status < TINFL_STATUS_DONE) {
+            return "bad zlib stream";
+        } else if (status == TINFL_STATUS_NEEDS_MORE_INPUT && len == 0) {
+            break;  // Otherwise more output is pending for the same input
+        }
+    }
+    return NULL;
+}
+
+// Stream the image from the open connection into the slot
+static const char* transfer(esp_http_client_handle_t http, ota_stream_t* s, bool* interrupted) {
+    while (true) {
+        if (cancel_requested) {
+            return "cancelled";
+        }
+        if (pour_busy) {
+            *interrupted = true;
+            return "pour started";
+        }
+        int len = esp_http_client_read(http, (char*)s->chunk, OTA_CHUNK_SIZE);
+        if (len < 0) {
+            return "read failed";
+        }
+        if (len == 0) {
+            if (!esp_http_client_is_complete_data_received(http)) {
+                return "connection closed";
+            }
+            break;
+        }
+        const char* err = request.zlib ? inflate_chunk(s, s->chunk, (size_t)len)
+                                       : write_image(s, s->chunk, (size_t)len);
+        if (err != NULL) {
+            return err;
+        }
+    }
+    if (request.zlib && !s->inflate_done) {
+        return "truncated zlib stream";
+    }
+    
+    uint8_t digest[32];
+    mbedtls_sha256_finish(&s->sha, digest);
+    if (memcmp(digest, request.sha256, sizeof(digest)) != 0) {
+        return "sha256 mismatch";
+    }
+    return NULL;
+}
+
+// One attempt: connect, write the inactive slot, verify and make it bootable
+static const char* download(bool* interrupted) {
+    const esp_partition_t* slot = esp_ota_get_next_update_partition(NULL);
+    if (slot == NULL) {
+        return "no ota slot";
+    }
+    
+    ota_stream_t* s = (ota_stream_t*)heap_caps_malloc(sizeof(ota_stream_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (s == NULL) {
+        s = (ota_stream_t*)heap_caps_malloc(sizeof(ota_stream_t), MALLOC_CAP_8BIT);
+    }
+    if (s == NULL) {
+        return "out of memory";
+    }
+    memset(s, 0, offsetof(ota_stream_t, dict));
+    tinfl_init(&s->inflator);
+    mbedtls_sha256_init(&s->sha);
+    mbedtls_sha256_starts(&s->sha, 0);
+    s->next_progress = OTA_PROGRESS_BYTES;
+    
+    esp_http_client_config_t cfg = {};
+    cfg.url = request.url;
+    cfg.crt_bundle_attach = esp_crt_bundle_attach;
+    cfg.timeout_ms = OTA_HTTP_TIMEOUT_MS;
+    cfg.buffer_size = OTA_CHUNK_SIZE;
+    esp_http_client_handle_t http = esp_http_client_init(&cfg);
+    
+    const char* err = NULL;
+    bool ota_open = false;
+    if (http == NULL) {
+        err = "http init failed";
+    } else if (esp_http_client_open(http, 0) != ESP_OK) {
+        err = "connect failed";
+    } else {
+        int64_t length = esp_http_client_fetch_headers(http);
+        int status = esp_http_client_get_status_code(http);
+        if (status != 200) {
+            ESP_LOGE(TAG, "[OTA] HTTP status %d", status);
+            err = "http error";
+        } else if (esp_ota_begin(slot, OTA_WITH_SEQUENTIAL_WRITES, &s->handle) != ESP_OK) {
+            err = "ota begin failed";
+        } else {
+            ota_open = true;
+            ESP_LOGI(TAG, "[OTA] Writing %s (%" PRId64 " bytes%s)", slot->label, length,
+                     request.zlib ? " compressed" : "");
+            err = transfer(http, s, interrupted);
+        }
+    }
+    
+    if (ota_open) {
+        if (err != NULL) {
+            esp_ota_abort(s->handle);
+        } else if (esp_ota_end(s->handle) != ESP_OK) {
+            err = "image invalid";
+        } else if (esp_ota_set_boot_partition(slot) != ESP_OK) {
+            err = "set boot failed";
+        } else {
+            ESP_LOGI(TAG, "[OTA] %s written and verified, %" PRIu32 " bytes", slot->label, s->written);
+        }
+    }
+    if (http != NULL) {
+        esp_http_client_close(http);
+        esp_http_client_cleanup(http);
+    }
+    uint32_t total = s->written;
+    mbedtls_sha256_free(&s->sha);
+    heap_caps_free(s);
+    if (err == NULL) {
+        set_state(OTA_READY, total, NULL);
+    }
+    return err;
+}
+
+static void ota_download_task(void* arg) {
+    (void)arg;
+    const char* err = NULL;
+    int attempts = 0;
+    
+    while (true) {
+        set_state(OTA_WAITING, 0, NULL);
+        while (pour_busy && !cancel_requested) {
+            vTaskDelay(pdMS_TO_TICKS(OTA_IDLE_POLL_MS));
+        }
+        if (cancel_requested) {
+            err = "cancelled";
+            break;
+        }
+        set_state(OTA_DOWNLOADING, 0, NULL);
+        publish_status();
+        
+        bool interrupted = false;
+        err = download(&interrupted);
+        if (err == NULL) {
+            break;
+        }
+        if (interrupted) {
+            ESP_LOGI(TAG, "[OTA] Pour started, download restarts once the taps are idle");
+            continue;
+        }
+        if (++attempts >= OTA_MAX_ATTEMPTS || cancel_requested) {
+            break;
+        }
+        ESP_LOGW(TAG, "[OTA] Attempt %d failed (%s), retrying", attempts, err);
+        vTaskDelay(pdMS_TO_TICKS(OTA_RETRY_DELAY_MS));
+    }
+    
+    if (err != NULL) {
+        ESP_LOGE(TAG, "[OTA] Update failed: %s", err);
+        set_state(OTA_FAILED, 0, err);
+    } else {
+        ESP_LOGI(TAG, "[OTA] Update ready, restarting once the taps are idle");
+    }
+    publish_status();
+    
+    task_running = false;
+    vTaskDelete(NULL);
+}
+
+static const char* start(JsonObjectConst cmd) {
+    const char* url = cmd["url"] | "";
+    const char* encoding = cmd["encoding"] | "raw";
+    
+    if (strncmp(url, "https://", 8) != 0 && !(OTA_ALLOW_HTTP && strncmp(url, "http://", 7) == 0)) {
+        return "invalid url";
+    }
+    if (strlen(url) >= OTA_URL_SIZE) {
+        return "url too long";
+    }
+    if (strcmp(encoding, "raw") != 0 && strcmp(encoding, "zlib") != 0) {
+        return "unsupported encoding";
+    }
+    if (pending_verify) {
+        return "running image not confirmed";
+    }
+    
+    portENTER_CRITICAL(&ota_mux);
+    bool ready = state == OTA_READY;
+    portEXIT_CRITICAL(&ota_mux);
+    if (task_running || ready) {
+        return "update in progress";
+    }
+    
+    uint8_t sha256[32];
+    if (!parse_sha256(cmd["sha256"] | "", sha256)) {
+        return "invalid sha256";
+    }
+    strcpy(request.url, url);
+    memcpy(request.sha256, sha256, sizeof(sha256));
+    request.zlib = strcmp(encoding, "zlib") == 0;
+    cancel_requested = false;
+    set_state(OTA_WAITING, 0, NULL);
+    
+    task_running = true;  // Commands arrive on the MQTT task only, so no second start can race this
+    BaseType_t ok = xTaskCreatePinnedToCore(ota_download_task, "ota", OTA_TASK_STACK, NULL,
+                                            OTA_TASK_PRIORITY, NULL, NETWORK_TASK_CORE);
+    if (ok != pdPASS) {
+        task_running = false;
+        set_state(OTA_IDLE, 0, NULL);
+        return "task create failed";
+    }
+    ESP_LOGI(TAG, "[OTA] Update requested (%s)", encoding);
+    return NULL;
+}
+
+bool ota_update_init() {
+    const esp_partition_t* running = esp_ota_get_running_partition();
+    esp_ota_img_states_t img_state;
+    if (running != NULL && esp_ota_get_state_partition(running, &img_state) == ESP_OK &&
+        img_state == ESP_OTA_IMG_PENDING_VERIFY) {
+        pending_verify = true;
+    }
+    ESP_LOGI(TAG, "[OTA] Running %s, version %s%s", running != NULL ? running->label : "?",
+             esp_app_get_description()->version, pending_verify ? " (new, pending verify)" : "");
+    return true;
+}
+
+size_t ota_update_command(JsonObjectConst cmd, char* reply, size_t size) {
+    const char* action = cmd["action"] | "";
+    const char* err = NULL;
+    
+    if (strcmp(action, "start") == 0) {
+        err = start(cmd);
+    } else if (strcmp(action, "cancel") == 0) {
+        if (task_running) {
+            cancel_requested = true;
+        } else {
+            err = "no download";
+        }
+    } else if (strcmp(action, "status") != 0) {
+        err = "unknown action";
+    }
+    if (err != NULL) {
+        ESP_LOGW(TAG, "[OTA] %s: %s", action, err);
+    }
+    
+    JsonDocument doc;
+    doc["action"] = action;
+    doc["ok"] = (err == NULL);
+    if (err != NULL) {
+        doc["error"] = err;
+    }
+    return format_status(doc, reply, size);
+}
+
+void ota_update_loop(bool pour_active) {
+    pour_busy = pour_active;
+    uint32_t uptime_sec = (uint32_t)(esp_timer_get_time() / 1000000LL);
+    
+    if (pending_verify) {
+        connected_seen = connected_seen || mqtt_client_is_connected();
+        if (connected_seen && uptime_sec >= OTA_HEALTHY_SEC) {
+            if (esp_ota_mark_app_valid_cancel_rollback() == ESP_OK) {
+                pending_verify = false;
+                ESP_LOGI(TAG, "[OTA] New image healthy, rollback cancelled");
+                publish_status();
+            }
+        } else if (uptime_sec >= OTA_ROLLBACK_TIMEOUT_SEC && !pour_active) {
+            ESP_LOGE(TAG, "[OTA] New image not healthy after %d s, rolling back", OTA_ROLLBACK_TIMEOUT_SEC);
+            config_store_flush();
+            esp_ota_mark_app_invalid_rollback_and_reboot();
+        }
+    }
+    
+    portENTER_CRITICAL(&ota_mux);
+    bool ready = state == OTA_READY;
+    portEXIT_CRITICAL(&ota_mux);
+    if (ready && !pour_active) {
+        ESP_LOGI(TAG, "[OTA] Restarting into the new image");
+        config_store_flush();
+        vTaskDelay(pdMS_TO_TICKS(500));  // Let the status and log lines go out
+        esp_restart();
+    }
+}
+
+#endif // OTA_UPDATES_ENABLED
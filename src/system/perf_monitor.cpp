@@ -0,0 +1,235 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Performance Monitor Implementation
+ * 
+ * Bucket i counts values in [2^(i-1), 2^i), bucket 0 counts zero.
+ * Percentiles are reported as the upper bound of the bucket they fall in,
+ * capped at the observed maximum.
+ * 
+ * The paid command chain keeps the arrival time of the last MQTT message;
+ * an accepted paid command starts a chain from it, and the chain advances
+ * only in mark order so a screen change or flush that no paid command
+ * caused is not counted.
+ */
+
+// Project headers
+#include "config.h"
+#include "system/perf_monitor.h"
+
+#if PERF_MONITOR_ENABLED
+
+// System/Standard library headers
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+// ESP-IDF framework headers
+#include <esp_attr.h>
+#include <esp_app_desc.h>
+#include <esp_cpu.h>
+#include <esp_log.h>
+#include <esp_rom_sys.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#define TAG "perf"
+
+#define PERF_BUCKETS 24   // Up to 2^23 (8.4 s / 8 MB)
+#define CHAIN_TIMEOUT_US 10000000LL  // A screen change this long after a paid command is not its result
+
+typedef struct {
+    uint32_t count;
+    uint64_t sum;
+    uint32_t min;
+    uint32_t max;
+    uint32_t buckets[PERF_BUCKETS];
+} perf_histogram_t;
+
+static const char* const metric_names[PERF_METRIC_COUNT] = {
+    "render_us",
+    "flush_us",
+    "flush_bytes",
+    "frame_px",
+    "input_us",
+    "loop_us",
+    "paid_parse_us",
+    "paid_screen_us",
+    "paid_pixel_us",
+    "cutoff_us",
+    "stop_us",
+};
+static_assert(sizeof(metric_names) / sizeof(metric_names[0]) == PERF_METRIC_COUNT, "metric_names out of step");
+
+static portMUX_TYPE perf_mux = portMUX_INITIALIZER_UNLOCKED;
+static perf_histogram_t histograms[PERF_METRIC_COUNT];
+
+// Paid command chain (perf_mux)
+static int64_t rx_us = 0;                            // Last MQTT arrival
+static int64_t chain_start_us = 0;                   // Arrival of the paid command being followed
+static perf_mark_t chain_stage = PERF_MARK_MQTT_RX;  // Last mark reached, MQTT_RX = no chain
+
+static inline uint32_t IRAM_ATTR bucket_for(uint32_t value) {
+    uint32_t bucket = value == 0 ? 0 : 32 - (uint32_t)__builtin_clz(value);
+    return bucket < PERF_BUCKETS ? bucket : PERF_BUCKETS - 1;
+}
+
+// Upper bound of a bucket, capped at the observed maximum
+static uint32_t bucket_upper(uint32_t bucket, uint32_t max) {
+    uint32_t upper = bucket == 0 ? 0 : (uint32_t)((1ULL << bucket) - 1);
+    return upper < max ? upper : max;
+}
+
+static uint32_t percentile(const perf_histogram_t* h, uint32_t pct) {
+    if (h->count == 0) {
+        return 0;
+    }
+    uint32_t rank = (uint32_t)(((uint64_t)h->count * pct + 99) / 100);
+    uint32_t seen = 0;
+    for (uint32_t i = 0; i < PERF_BUCKETS; i++) {
+        seen += h->buckets[i];
+        if (seen >= rank) {
+            return bucket_upper(i, h->max);
+        }
+    }
+    return h->max;
+}
+
+// Consistent copy of all histograms - formatting runs outside the critical section
+static void snapshot(perf_histogram_t* out) {
+    portENTER_CRITICAL(&perf_mux);
+    memcpy(out, histograms, sizeof(histograms));
+    portEXIT_CRITICAL(&perf_mux);
+}
+
+void perf_monitor_init() {
+    perf_monitor_reset();
+    ESP_LOGI(TAG, "[Perf] Frame timing profiler enabled (%" PRIu32 " cycles/us)", (uint32_t)esp_rom_get_cpu_ticks_per_us());
+}
+
+uint32_t perf_monitor_begin() {
+    return esp_cpu_get_cycle_count();
+}
+
+void perf_monitor_end_us(perf_metric_t metric, uint32_t start_cycles) {
+    uint32_t cycles = esp_cpu_get_cycle_count() - start_cycles;
+    perf_monitor_record(metric, cycles / esp_rom_get_cpu_ticks_per_us());
+}
+
+void IRAM_ATTR perf_monitor_record(perf_metric_t metric, uint32_t value) {
+    if ((unsigned)metric >= PERF_METRIC_COUNT) {
+        return;
+    }
+    perf_histogram_t* h = &histograms[metric];
+    portENTER_CRITICAL_SAFE(&perf_mux);
+    if (h->count == 0 || value < h->min) {
+        h->min = value;
+    }
+    if (value > h->max) {
+        h->max = value;
+    }
+    h->count++;
+    h->sum += value;
+    h->buckets[bucket_for(value)]++;
+    portEXIT_CRITICAL_SAFE(&perf_mux);
+}
+
+// If/else rather than a switch: a jump table would live in flash, and this is ISR-safe
+void IRAM_ATTR perf_monitor_mark(perf_mark_t mark) {
+    int64_t now = esp_timer_get_time();
+    perf_metric_t metric = PERF_METRIC_COUNT;
+    int64_t start = 0;
+    portENTER_CRITICAL_SAFE(&perf_mux);
+    if (mark == PERF_MARK_MQTT_RX) {
+        rx_us = now;
+    } else if (mark == PERF_MARK_PAID && rx_us != 0) {
+        chain_start_us = rx_us;
+        chain_stage = PERF_MARK_PAID;
+        metric = PERF_PAID_PARSE_US;
+    } else if (mark == PERF_MARK_SCREEN && chain_stage == PERF_MARK_PAID) {
+        chain_stage = PERF_MARK_SCREEN;
+        metric = PERF_PAID_SCREEN_US;
+    } else if (mark == PERF_MARK_FLUSH && chain_stage == PERF_MARK_SCREEN) {
+        chain_stage = PERF_MARK_MQTT_RX;  // Chain complete
+        metric = PERF_PAID_PIXEL_US;
+    }
+    start = chain_start_us;
+    if (metric != PERF_METRIC_COUNT && now - start > CHAIN_TIMEOUT_US) {
+        chain_stage = PERF_MARK_MQTT_RX;  // Stale: the chain was never completed
+        metric = PERF_METRIC_COUNT;
+    }
+    portEXIT_CRITICAL_SAFE(&perf_mux);
+    if (metric != PERF_METRIC_COUNT) {
+        perf_monitor_record(metric, (uint32_t)(now - start));
+    }
+}
+
+void perf_monitor_reset() {
+    portENTER_CRITICAL(&perf_mux);
+    memset(histograms, 0, sizeof(histograms));
+    portEXIT_CRITICAL(&perf_mux);
+}
+
+// JSON object of metrics [first, last) after an optional leading member, returns the length or 0 if it did not fit
+static size_t format_metrics(char* buf, size_t size, const char* lead, uint32_t first, uint32_t last) {
+    static perf_histogram_t snap[PERF_METRIC_COUNT];
+    snapshot(snap);
+    
+    size_t len = 0;
+    int n = snprintf(buf, size, "{%s", lead);
+    if (n < 0 || (size_t)n >= size) {
+        return 0;
+    }
+    len = (size_t)n;
+    
+    for (uint32_t i = first; i < last; i++) {
+        const perf_histogram_t* h = &snap[i];
+        uint32_t mean = h->count ? (uint32_t)(h->sum / h->count) : 0;
+        n = snprintf(buf + len, size - len,
+                     "%s\"%s\":{\"n\":%" PRIu32 ",\"mean\":%" PRIu32 ",\"min\":%" PRIu32 ",\"max\":%" PRIu32
+                     ",\"p50\":%" PRIu32 ",\"p90\":%" PRIu32 ",\"p99\":%" PRIu32 "}",
+                     (i > first || lead[0] != '\0') ? "," : "", metric_names[i], h->count, mean, h->min, h->max,
+                     percentile(h, 50), percentile(h, 90), percentile(h, 99));
+        if (n < 0 || (size_t)n >= size - len) {
+            return 0;
+        }
+        len += (size_t)n;
+    }
+    
+    n = snprintf(buf + len, size - len, "}");
+    if (n < 0 || (size_t)n >= size - len) {
+        return 0;
+    }
+    return len + (size_t)n;
+}
+
+size_t perf_monitor_format_json(char* buf, size_t size) {
+    return format_metrics(buf, size, "", 0, PERF_METRIC_COUNT);
+}
+
+size_t perf_monitor_format_latency_json(char* buf, size_t size) {
+    char lead[48];
+    snprintf(lead, sizeof(lead), "\"version\":\"%.31s\"", esp_app_get_description()->version);
+    return format_metrics(buf, size, lead, PERF_LATENCY_FIRST, PERF_METRIC_COUNT);
+}
+
+void perf_monitor_log_report() {
+    static perf_histogram_t snap[PERF_METRIC_COUNT];
+    snapshot(snap);
+    
+    ESP_LOGI(TAG, "[Perf] %-14s %8s %8s %8s %8s %8s %8s %8s", "metric", "n", "mean", "min", "p50", "p90", "p99", "max");
+    for (uint32_t i = 0; i < PERF_METRIC_COUNT; i++) {
+        const perf_histogram_t* h = &snap[i];
+        uint32_t mean = h->count ? (uint32_t)(h->sum / h->count) : 0;
+        ESP_LOGI(TAG, "[Perf] %-14s %8" PRIu32 " %8" PRIu32 " %8" PRIu32 " %8" PRIu32 " %8" PRIu32 " %8" PRIu32 " %8" PRIu32,
+                 metric_names[i], h->count, mean, h->min,
+                 percentile(h, 50), percentile(h, 90), percentile(h, 99), h->max);
+    }
+}
+
+#endif // PERF_MONITOR_ENABLED
@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Power Management Implementation
+ * 
+ * Needs CONFIG_PM_ENABLE (and CONFIG_FREERTOS_USE_TICKLESS_IDLE for light
+ * sleep), both selected by CONFIG_POWER_MANAGEMENT. Light sleep is woken by
+ * the FreeRTOS tick deadline (the UI task and main loop wait at most
+ * MAIN_LOOP_IDLE_MS), by the WiFi modem for beacons and by UART0 input.
+ */
+
+// Project headers
+#include "config.h"
+#include "system/power_manager.h"
+
+#if POWER_MANAGEMENT_ENABLED
+
+// ESP-IDF framework headers
+#include <driver/uart.h>
+#include <esp_log.h>
+#include <esp_pm.h>
+#include <esp_sleep.h>
+#include <freertos/FreeRTOS.h>
+#define TAG "power"
+
+// A PINGRESP sits in the AP until the next listen interval: keep that well
+// inside the keepalive so a sleeping radio never looks like a dead link
+// N beacons of 102.4 ms (N * 1024 in 0.1 ms) within a tenth of the keepalive (s * 1000 in 0.1 ms)
+static_assert(POWER_WIFI_LISTEN_INTERVAL * 1024 <= MQTT_KEEPALIVE * 1000,
+              "POWER_WIFI_LISTEN_INTERVAL too long for MQTT_KEEPALIVE");
+
+#define UART_WAKE_THRESHOLD 3   // RX edges; the waking characters are lost
+
+static esp_pm_lock_handle_t locks[POWER_HOLD_COUNT] = {};
+static bool held_state[POWER_HOLD_COUNT] = {};
+static portMUX_TYPE hold_mux = portMUX_INITIALIZER_UNLOCKED;
+
+void power_manager_init() {
+    esp_pm_config_t pm_config = {};
+    pm_config.max_freq_mhz = POWER_MAX_CPU_MHZ;
+    pm_config.min_freq_mhz = POWER_MIN_CPU_MHZ;
+    pm_config.light_sleep_enable = POWER_LIGHT_SLEEP_ENABLED;
+    esp_err_t err = esp_pm_configure(&pm_config);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "[Power] esp_pm_configure failed: %s", esp_err_to_name(err));
+        return;
+    }
+    
+    esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "pour", &locks[POWER_HOLD_POUR]);
+    esp_pm_lock_create(ESP_PM_APB_FREQ_MAX, 0, "display", &locks[POWER_HOLD_DISPLAY]);
+    esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "flow", &locks[POWER_HOLD_FLOW]);
+
+    #if POWER_LIGHT_SLEEP_ENABLED
+    // Keep the serial console usable while light sleeping
+    uart_set_wakeup_threshold(UART_NUM_0, UART_WAKE_THRESHOLD);
+    esp_sleep_enable_uart_wakeup(UART_NUM_0);
+    #endif
+
+    ESP_LOGI(TAG, "[Power] DFS %d-%d MHz, light sleep %s, WiFi listen interval %d",
+             POWER_MIN_CPU_MHZ, POWER_MAX_CPU_MHZ, POWER_LIGHT_SLEEP_ENABLED ? "on" : "off",
+             POWER_WIFI_LISTEN_INTERVAL);
+}
+
+void power_manager_hold(power_hold_t hold, bool held) {
+    if (hold >= POWER_HOLD_COUNT || locks[hold] == NULL) {
+        return;
+    }
+    bool changed;
+    taskENTER_CRITICAL(&hold_mux);
+    changed = (held_state[hold] != held);
+    held_state[hold] = held;
+    taskEXIT_CRITICAL(&hold_mux);
+    if (!changed) {
+        return;
+    }
+    if (held) {
+        esp_pm_lock_acquire(locks[hold]);
+    } else {
+        esp_pm_lock_release(locks[hold]);
+    }
+}
+
+#endif // POWER_MANAGEMENT_ENABLED
@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Serial Console Implementation
+ */
+
+// Project headers
+#include "system/serial_console.h"
+
+// System/Standard library headers
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+// ESP-IDF framework headers
+#include <esp_log.h>
+#define TAG "console"
+
+#define CONSOLE_MAX_COMMANDS 8
+#define CONSOLE_LINE_SIZE 64
+
+typedef struct {
+    const char* name;
+    serial_console_handler_t handler;
+} console_command_t;
+
+static console_command_t commands[CONSOLE_MAX_COMMANDS];
+static int command_count = 0;
+static char line[CONSOLE_LINE_SIZE];
+static size_t line_len = 0;
+
+static void dispatch(char* text) {
+    // Trim leading spaces and split "<name> <args>"
+    while (*text == ' ') {
+        text++;
+    }
+    if (*text == '\0') {
+        return;
+    }
+    char* args = strchr(text, ' ');
+    if (args != NULL) {
+        *args++ = '\0';
+        while (*args == ' ') {
+            args++;
+        }
+    } else {
+        args = text + strlen(text);
+    }
+    
+    for (int i = 0; i < command_count; i++) {
+        if (strcmp(commands[i].name, text) == 0) {
+            commands[i].handler(args);
+            return;
+        }
+    }
+    ESP_LOGW(TAG, "[Console] Unknown command: %s", text);
+}
+
+void serial_console_init() {
+    int flags = fcntl(fileno(stdin), F_GETFL, 0);
+    if (flags < 0 || fcntl(fileno(stdin), F_SETFL, flags | O_NONBLOCK) < 0) {
+        ESP_LOGW(TAG, "[Console] Could not make stdin non-blocking - console disabled");
+        return;
+    }
+    ESP_LOGI(TAG, "[Console] Serial console ready");
+}
+
+bool serial_console_register(const char* name, serial_console_handler_t handler) {
+    if (command_count >= CONSOLE_MAX_COMMANDS) {
+        ESP_LOGE(TAG, "[Console] Command table full, cannot register: %s", name);
+        return false;
+    }
+    commands[command_count].name = name;
+    commands[command_count].handler = handler;
+    command_count++;
+    return true;
+}
+
+void serial_console_poll() {
+    int c;
+    while ((c = fgetc(stdin)) != EOF) {
+        if (c == '\r' || c == '\n') {
+            line[line_len] = '\0';
+            line_len = 0;
+            dispatch(line);
+        } else if (line_len < sizeof(line) - 1) {
+            line[line_len++] = (char)c;
+        }
+    }
+    // EOF here means "no data yet" on a non-blocking stream
+    clearerr(stdin);
+}
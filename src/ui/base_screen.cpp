@@ -29,8 +29,9 @@
 #include <freertos/task.h>
 #define TAG "base_screen"
 
-// Static content area container
-static lv_obj_t* content_area = NULL;
+// Screen that was active before the first base screen was loaded (splash)
+static lv_obj_t* boot_screen = NULL;
+static bool shared_layer_created = false;
 
 // WiFi update throttling
 static uint64_t last_wifi_rssi_update = 0;
@@ -38,50 +39,70 @@ static const uint64_t WIFI_RSSI_UPDATE_INTERVAL_MS = 10000;  // Update every 10
 static int cached_rssi = 0;
 static bool cached_wifi_connected = false;
 
-lv_obj_t* base_screen_create(lv_obj_t* parent) {
-    if (parent == NULL) {
-        ESP_LOGE(TAG, "[Base Screen] ERROR: Parent object is NULL!");
-        return NULL;
+// Shared layer sits above every screen - let touches fall through to the screen below
+static void make_click_through(lv_obj_t* obj) {
+    if (obj == NULL) {
+        return;
+    }
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+    uint32_t count = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < count; i++) {
+        make_click_through(lv_obj_get_child(obj, (int32_t)i));
+    }
+}
+
+bool base_screen_init() {
+    if (shared_layer_created) {
+        return true;
     }
     
-    ESP_LOGI(TAG, "[Base Screen] Creating base screen layout...");
+    ESP_LOGI(TAG, "[Base Screen] Creating shared layer (logo, WiFi icon, data icon)...");
+    lv_obj_t* layer = lv_layer_top();
+    boot_screen = lv_scr_act();
     
-    // Set background color (pure black)
-    lv_obj_set_style_bg_color(parent, lv_color_hex(0x000000), 0);
-    lv_obj_set_style_bg_opa(parent, LV_OPA_COVER, 0);
+    // Create shared logo (top center)
+    lv_obj_t* logo_obj = ui_logo_create(layer);
+    if (logo_obj == NULL) {
+        ESP_LOGE(TAG, "[Base Screen] ERROR: Failed to create logo!");
+        return false;
+    }
+    make_click_through(lv_obj_get_parent(logo_obj));
     
-    // Clear screen - this deletes all children, so shared components will be recreated
-    lv_obj_clean(parent);
-    lv_obj_set_style_bg_color(parent, lv_color_hex(0x000000), 0);
-    lv_obj_set_style_bg_opa(parent, LV_OPA_COVER, 0);
+    // Create shared WiFi icon (bottom left)
+    if (ui_wifi_icon_create(layer) == NULL) {
+        ESP_LOGE(TAG, "[Base Screen] ERROR: Failed to create WiFi icon!");
+        return false;
+    }
+    make_click_through(ui_wifi_icon_get_container());
     
-    // Wait for LVGL to finish processing the cleanup
-    // Process multiple times to ensure all deletions are fully processed
-    // This prevents "modifying dirty areas in render" errors
-    for (int i = 0; i < 5; i++) {
-        lv_timer_handler();
-        vTaskDelay(pdMS_TO_TICKS(5));
+    // Create shared data icon (bottom right)
+    if (ui_data_icon_create(layer) == NULL) {
+        ESP_LOGE(TAG, "[Base Screen] ERROR: Failed to create data icon!");
+        return false;
     }
+    make_click_through(ui_data_icon_get_container());
     
-    // Create shared logo (top center) - create first so it's behind other elements
-    if (ui_logo_create(parent) == NULL) {
-        ESP_LOGE(TAG, "[Base Screen] ERROR: Failed to create logo!");
+    shared_layer_created = true;
+    ESP_LOGI(TAG, "[Base Screen] Shared layer created");
+    return true;
+}
+
+lv_obj_t* base_screen_create(lv_obj_t* screen) {
+    if (screen == NULL) {
+        ESP_LOGE(TAG, "[Base Screen] ERROR: Screen object is NULL!");
         return NULL;
     }
-    
-    // Force logo container to be behind other elements (lower z-order)
-    // The logo is created first, so it's already behind, but we ensure it explicitly
-    lv_obj_t* logo_obj = ui_logo_get_object();
-    if (logo_obj != NULL) {
-        // Get the parent container and move it to background
-        lv_obj_t* logo_parent = lv_obj_get_parent(logo_obj);
-        if (logo_parent != NULL) {
-            lv_obj_move_background(logo_parent);
-        }
+    if (!base_screen_init()) {
+        return NULL;
     }
     
+    // Set background color (pure black)
+    lv_obj_set_style_bg_color(screen, lv_color_hex(0x000000), 0);
+    lv_obj_set_style_bg_opa(screen, LV_OPA_COVER, 0);
+    lv_obj_clear_flag(screen, LV_OBJ_FLAG_SCROLLABLE);
+    
     // Create content area (middle section, below logo)
-    content_area = lv_obj_create(parent);
+    lv_obj_t* content_area = lv_obj_create(screen);
     if (content_area == NULL) {
         ESP_LOGE(TAG, "[Base Screen] ERROR: Failed to create content area!");
         return NULL;
@@ -97,31 +118,20 @@ lv_obj_t* base_screen_create(lv_obj_t* parent) {
     lv_obj_set_style_pad_all(content_area, 0, 0);
     lv_obj_clear_flag(content_area, LV_OBJ_FLAG_SCROLLABLE);  // Disable scrolling
     
-    // Create shared WiFi icon (bottom left)
-    if (ui_wifi_icon_create(parent) == NULL) {
-        ESP_LOGE(TAG, "[Base Screen] ERROR: Failed to create WiFi icon!");
-        return NULL;
-    }
-    
-    // Create shared data icon (bottom right)
-    if (ui_data_icon_create(parent) == NULL) {
-        ESP_LOGE(TAG, "[Base Screen] ERROR: Failed to create data icon!");
-        return NULL;
-    }
-    
-    // Process all pending LVGL operations after creating all objects
-    // Process multiple times to ensure all creations are fully processed
-    for (int i = 0; i < 3; i++) {
-        lv_timer_handler();
-        vTaskDelay(pdMS_TO_TICKS(5));
-    }
-    
-    ESP_LOGI(TAG, "[Base Screen] Base screen layout created successfully");
     return content_area;
 }
 
-lv_obj_t* base_screen_get_content_area() {
-    return content_area;
+void base_screen_load(lv_obj_t* screen) {
+    if (screen == NULL || screen == lv_scr_act()) {
+        return;
+    }
+    if (boot_screen != NULL && lv_scr_act() == boot_screen) {
+        // Leaving the splash screen for good - free it
+        lv_scr_load_anim(screen, LV_SCR_LOAD_ANIM_NONE, 0, 0, true);
+        boot_screen = NULL;
+        return;
+    }
+    lv_scr_load(screen);
 }
 
 void base_screen_update() {
@@ -142,19 +152,21 @@ void base_screen_update() {
     // Update WiFi icon
     ui_wifi_icon_update(cached_wifi_connected, cached_rssi, should_flash);
     
-    // Update data icon - use WiFi RX/TX bytes activity (actual TCP/IP traffic)
-    bool wifi_active = wifi_manager_has_activity();
-    ui_data_icon_update(mqtt_connected, wifi_active);
+    // Update data icon - TCP/IP activity or MQTT messages in either direction
+    // Both icons compare against what they last drew, so unchanged state costs nothing
+    bool data_active = wifi_manager_has_activity() || mqtt_client_has_activity();
+    ui_data_icon_update(mqtt_connected, data_active);
+}
+
+void base_screen_refresh_network() {
+    // Force the next update to re-read WiFi state instead of the cached value
+    last_wifi_rssi_update = 0;
+    base_screen_update();
 }
 
 void base_screen_cleanup() {
-    // Note: We don't delete shared components (logo, WiFi icon, data icon)
-    // They persist across screen transitions
-    
-    // Only clean up the content area
-    if (content_area != NULL) {
-        lv_obj_del(content_area);
-        content_area = NULL;
-        ESP_LOGI(TAG, "[Base Screen] Content area cleaned up");
-    }
+    // Screens own their content areas; only the shared layer is deleted here
+    lv_obj_clean(lv_layer_top());
+    shared_layer_created = false;
+    ESP_LOGI(TAG, "[Base Screen] Shared layer cleaned up");
 }
@@ -18,6 +18,7 @@
 #include "ui/finished_screen.h"
 #include "ui/base_screen.h"
 #include "ui/screen_manager.h"
+#include "system/config_store.h"
 
 // System/Standard library headers
 #include <lvgl.h>
@@ -35,6 +36,7 @@
 #define COLOR_GOLDEN lv_color_hex(0xFFD700) // Golden yellow
 
 // UI objects
+static lv_obj_t* finished_scr = NULL;  // Built once, switched in with lv_scr_load()
 static lv_obj_t* message_label = NULL;
 static lv_obj_t* volume_label = NULL;
 static lv_obj_t* volume_value = NULL;
@@ -42,8 +44,15 @@ static lv_obj_t* cost_label = NULL;
 static lv_obj_t* cost_value = NULL;
 static lv_obj_t* timeout_label = NULL;
 
-// Timeout configuration - use configurable value from KConfig
-#define FINISHED_SCREEN_TIMEOUT_MS (FINISHED_SCREEN_TIMEOUT_SEC * 1000)
+// Label text buffers (lv_label_set_text_static - no allocation on show/update)
+static char volume_text[32] = "0 ml";
+static char cost_text[32] = "";
+static char timeout_text[64] = "Returning to payment...";
+static char default_currency[CONFIG_CURRENCY_SIZE] = "";
+static unsigned long shown_remaining = (unsigned long)-1;
+
+// Timeout from the config store (FINISHED_SCREEN_TIMEOUT_SEC unless changed), read on show
+static unsigned long finished_timeout_ms = FINISHED_SCREEN_TIMEOUT_SEC * 1000UL;
 
 // State
 static uint64_t finished_screen_start_time = 0;
@@ -52,7 +61,10 @@ static bool finished_screen_active = false;
 // Forward declaration for touch event handler
 static void finished_screen_touch_cb(lv_event_t *e);
 
-void finished_screen_init(float final_volume_ml, float final_cost, const char* currency) {
+void finished_screen_init() {
+    if (finished_scr != NULL) {
+        return;  // Already built
+    }
     ESP_LOGI(TAG, "=== Initializing Finished Screen ===");
     
     // Log debug option status
@@ -65,8 +77,13 @@ void finished_screen_init(float final_volume_ml, float final_cost, const char* c
     ESP_LOGI(TAG, "[Finished Screen] DEBUG_FINISHED_TAP_TO_QR is NOT defined");
     #endif
     
-    // Create base screen layout (logo, WiFi icon, data icon)
-    lv_obj_t* content_area = base_screen_create(lv_scr_act());
+    // Create the screen and its base layout (logo, WiFi icon, data icon are shared)
+    finished_scr = lv_obj_create(NULL);
+    if (finished_scr == NULL) {
+        ESP_LOGE(TAG, "[Finished Screen] ERROR: Failed to create screen!");
+        return;
+    }
+    lv_obj_t* content_area = base_screen_create(finished_scr);
     if (content_area == NULL) {
         ESP_LOGE(TAG, "[Finished Screen] ERROR: Failed to create base screen!");
         return;
@@ -93,9 +110,7 @@ void finished_screen_init(float final_volume_ml, float final_cost, const char* c
     
     volume_value = lv_label_create(content_area);
     if (volume_value != NULL) {
-        char volume_str[32];
-        snprintf(volume_str, sizeof(volume_str), "%.0f ml", final_volume_ml);
-        lv_label_set_text(volume_value, volume_str);
+        lv_label_set_text_static(volume_value, volume_text);
         lv_obj_set_style_text_color(volume_value, COLOR_GOLDEN, 0);
         lv_obj_set_style_text_font(volume_value, &lv_font_montserrat_14, 0);
         lv_obj_align(volume_value, LV_ALIGN_CENTER, 0, -10);
@@ -112,10 +127,7 @@ void finished_screen_init(float final_volume_ml, float final_cost, const char* c
     
     cost_value = lv_label_create(content_area);
     if (cost_value != NULL) {
-        char cost_str[32];
-        const char* symbol = (currency != NULL && strlen(currency) > 0) ? currency : CURRENCY_SYMBOL;
-        snprintf(cost_str, sizeof(cost_str), "%s%.2f", symbol, final_cost);
-        lv_label_set_text(cost_value, cost_str);
+        lv_label_set_text_static(cost_value, cost_text);
         lv_obj_set_style_text_color(cost_value, COLOR_GOLDEN, 0);
         lv_obj_set_style_text_font(cost_value, &lv_font_montserrat_14, 0);
         lv_obj_align(cost_value, LV_ALIGN_CENTER, 0, 40);
@@ -124,7 +136,7 @@ void finished_screen_init(float final_volume_ml, float final_cost, const char* c
     // Create timeout countdown label (optional, can be removed if not needed)
     timeout_label = lv_label_create(content_area);
     if (timeout_label != NULL) {
-        lv_label_set_text(timeout_label, "Returning to payment...");
+        lv_label_set_text_static(timeout_label, timeout_text);
         lv_obj_set_style_text_color(timeout_label, lv_color_hex(0x808080), 0);  // Gray
         lv_obj_set_style_text_font(timeout_label, &lv_font_montserrat_14, 0);
         lv_obj_set_style_text_align(timeout_label, LV_TEXT_ALIGN_CENTER, 0);
@@ -134,22 +146,42 @@ void finished_screen_init(float final_volume_ml, float final_cost, const char* c
     // Add touch event handler for debug mode (tap to QR code)
     #ifdef DEBUG_FINISHED_TAP_TO_QR
     if (DEBUG_FINISHED_TAP_TO_QR) {
-        lv_obj_add_event_cb(lv_scr_act(), finished_screen_touch_cb, LV_EVENT_CLICKED, NULL);
+        lv_obj_add_event_cb(finished_scr, finished_screen_touch_cb, LV_EVENT_CLICKED, NULL);
     }
     #endif
     
+    ESP_LOGI(TAG, "[Finished Screen] Finished Screen initialized");
+}
+
+void finished_screen_show(float final_volume_ml, float final_cost, const char* currency) {
+    finished_screen_init();
+    
+    // Fill the static label buffers and tell LVGL they changed
+    config_store_get_currency(default_currency, sizeof(default_currency));
+    const char* symbol = (currency != NULL && strlen(currency) > 0) ? currency : default_currency;
+    finished_timeout_ms = config_store_get_finished_timeout_sec() * 1000UL;
+    snprintf(volume_text, sizeof(volume_text), "%.0f ml", final_volume_ml);
+    snprintf(cost_text, sizeof(cost_text), "%s%.2f", symbol, final_cost);
+    snprintf(timeout_text, sizeof(timeout_text), "Returning to payment...");
+    shown_remaining = (unsigned long)-1;  // Force the first countdown update
+    if (volume_value != NULL) {
+        lv_label_set_text_static(volume_value, volume_text);
+    }
+    if (cost_value != NULL) {
+        lv_label_set_text_static(cost_value, cost_text);
+    }
+    if (timeout_label != NULL) {
+        lv_label_set_text_static(timeout_label, timeout_text);
+    }
+    
     // Record start time for timeout
     finished_screen_start_time = esp_timer_get_time() / 1000ULL;
     finished_screen_active = true;
+    base_screen_load(finished_scr);
     
-    // Force refresh
-    lv_timer_handler();
-    vTaskDelay(pdMS_TO_TICKS(10));
-    lv_timer_handler();
-    
-    ESP_LOGI(TAG, "[Finished Screen] Finished Screen initialized");
+    ESP_LOGI(TAG, "[Finished Screen] Finished Screen shown");
     ESP_LOGI(TAG, "  Final Volume: %.0f ml", final_volume_ml);
-    ESP_LOGI(TAG, "  Final Cost: %s%.2f", (currency != NULL ? currency : CURRENCY_SYMBOL), final_cost);
+    ESP_LOGI(TAG, "  Final Cost: %s%.2f", symbol, final_cost);
 }
 
 bool finished_screen_update() {
@@ -164,64 +196,46 @@ bool finished_screen_update() {
     uint64_t now = esp_timer_get_time() / 1000ULL;
     uint64_t elapsed = now - finished_screen_start_time;
     
-    if (elapsed >= FINISHED_SCREEN_TIMEOUT_MS) {
+    if (elapsed >= finished_timeout_ms) {
         ESP_LOGI(TAG, "[Finished Screen] Timeout elapsed, ready to return to QR code screen");
         finished_screen_active = false;
         return true;  // Signal that we should transition to QR code screen
     }
     
-    // Update timeout countdown (optional)
-    if (timeout_label != NULL) {
-        unsigned long remaining = (FINISHED_SCREEN_TIMEOUT_MS - elapsed) / 1000;
-        char timeout_str[64];
+    // Update timeout countdown (only when the second changes)
+    unsigned long remaining = (finished_timeout_ms - elapsed) / 1000;
+    if (timeout_label != NULL && remaining != shown_remaining) {
         if (remaining > 0) {
-            snprintf(timeout_str, sizeof(timeout_str), "Returning in %lu...", remaining);
+            snprintf(timeout_text, sizeof(timeout_text), "Returning in %lu...", remaining);
         } else {
-            snprintf(timeout_str, sizeof(timeout_str), "Returning...");
+            snprintf(timeout_text, sizeof(timeout_text), "Returning...");
         }
-        lv_label_set_text(timeout_label, timeout_str);
+        lv_label_set_text_static(timeout_label, timeout_text);
+        shown_remaining = remaining;
     }
     
     return false;  // Timeout not yet elapsed
 }
 
+void finished_screen_hide() {
+    finished_screen_active = false;
+}
+
 void finished_screen_cleanup() {
     // Set inactive first to prevent updates during cleanup
     finished_screen_active = false;
     
-    // Clean up labels
-    if (message_label != NULL) {
-        lv_obj_del(message_label);
-        message_label = NULL;
-    }
-    
-    if (volume_label != NULL) {
-        lv_obj_del(volume_label);
-        volume_label = NULL;
+    // Deleting the screen deletes all labels and the content area with it
+    if (finished_scr != NULL) {
+        lv_obj_del(finished_scr);
+        finished_scr = NULL;
     }
-    
-    if (volume_value != NULL) {
-        lv_obj_del(volume_value);
-        volume_value = NULL;
-    }
-    
-    if (cost_label != NULL) {
-        lv_obj_del(cost_label);
-        cost_label = NULL;
-    }
-    
-    if (cost_value != NULL) {
-        lv_obj_del(cost_value);
-        cost_value = NULL;
-    }
-    
-    if (timeout_label != NULL) {
-        lv_obj_del(timeout_label);
-        timeout_label = NULL;
-    }
-    
-    // Clean up base screen (content area only, shared components persist)
-    base_screen_cleanup();
+    message_label = NULL;
+    volume_label = NULL;
+    volume_value = NULL;
+    cost_label = NULL;
+    cost_value = NULL;
+    timeout_label = NULL;
     
     ESP_LOGI(TAG, "[Finished Screen] Finished Screen cleaned up");
 }
@@ -233,7 +247,7 @@ void finished_screen_cleanup() {
 static void finished_screen_touch_cb(lv_event_t *e) {
     lv_event_code_t code = lv_event_get_code(e);
     
-    if (code == LV_EVENT_CLICKED) {
+    if (code == LV_EVENT_CLICKED && finished_screen_active) {
         ESP_LOGI(TAG, "[Finished Screen] Debug: Screen tapped - transitioning to QR code screen");
         
         // Transition to QR code screen
@@ -10,7 +10,7 @@
  * Pouring Screen Implementation
  * 
  * Displays flow rate, volume, and cost during active pouring
- * Uses base_screen for standard layout
+ * Uses base_screen for standard layout; all values come from the pour session
  */
 
 // Project headers
@@ -18,11 +18,13 @@
 #include "ui/pouring_screen.h"
 #include "ui/base_screen.h"
 #include "ui/screen_manager.h"
-#include "flow/flow_meter.h"
+#include "flow/pour_math.h"
+#include "flow/pour_session.h"
 
 // System/Standard library headers
 #include <lvgl.h>
 #include <string.h>
+#include <inttypes.h>
 
 // ESP-IDF framework headers
 #include <esp_log.h>
@@ -37,6 +39,7 @@
 #define COLOR_GOLDEN lv_color_hex(0xFFD700) // Golden yellow
 
 // UI objects
+static lv_obj_t* pouring_scr = NULL;  // Built once, switched in with lv_scr_load()
 static lv_obj_t* flow_rate_label = NULL;
 static lv_obj_t* flow_rate_value = NULL;
 static lv_obj_t* volume_label = NULL;
@@ -46,12 +49,8 @@ static lv_obj_t* cost_per_unit_value = NULL;
 static lv_obj_t* total_cost_label = NULL;
 static lv_obj_t* total_cost_value = NULL;
 
-// Pouring parameters (from MQTT "paid" command)
-static char pour_unique_id[64] = {0};
-static float cost_per_ml = 0.0;
-static int max_ml = 0;
-static bool pour_active = false;
-static char currency_symbol[8] = {0};
+// Tap whose pour session is shown
+static uint8_t pour_tap = 0;
 
 // Callback function to switch back to QR code screen
 static void (*screen_switch_callback)(void) = NULL;
@@ -59,10 +58,48 @@ static void (*screen_switch_callback)(void) = NULL;
 // Screen active state
 static bool pouring_screen_active = false;
 
+// Last rendered label text (lv_label_set_text_static - LVGL keeps pointers to these)
+static char flow_rate_text[32] = "0.00 mL/min";
+static char volume_text[32] = "0 ml";
+static char cost_per_unit_text[32] = "";
+static char total_cost_text[32] = "";
+
+// Pour session update the labels were last rendered from
+static uint32_t rendered_sequence = 0;
+static bool render_forced = true;
+
 // Forward declaration
 static void pouring_screen_touch_cb(lv_event_t *e);
 
+// Format minor units as "<symbol>major.minor" without floating point
+static void format_money(char* buf, size_t size, const char* symbol, int64_t minor_units) {
+    const char* sign = minor_units < 0 ? "-" : "";
+    int64_t magnitude = minor_units < 0 ? -minor_units : minor_units;
+    snprintf(buf, size, "%s%s%" PRId64 ".%02" PRId64, symbol, sign,
+             (int64_t)(magnitude / POUR_MINOR_PER_MAJOR), (int64_t)(magnitude % POUR_MINOR_PER_MAJOR));
+}
+
+// Format micro-unit price per ml with 4 decimal places
+static void format_price(char* buf, size_t size, const char* symbol, int64_t price_micro) {
+    int64_t rounded = (price_micro + 50) / 100;  // 1e-4 units
+    snprintf(buf, size, "%s%" PRId64 ".%04" PRId64, symbol, rounded / 10000, rounded % 10000);
+}
+
+// Point a label at its static buffer only when the displayed string changes
+// (each set invalidates the label area and costs a redraw + SPI flush)
+static void set_label_if_changed(lv_obj_t* label, char* shown, size_t size, const char* text) {
+    if (label == NULL || strncmp(shown, text, size) == 0) {
+        return;
+    }
+    strncpy(shown, text, size - 1);
+    shown[size - 1] = '\0';
+    lv_label_set_text_static(label, shown);
+}
+
 void pouring_screen_init() {
+    if (pouring_scr != NULL) {
+        return;  // Already built
+    }
     ESP_LOGI(TAG, "=== Initializing Pouring Screen ===");
     
     // Log debug option status
@@ -74,11 +111,14 @@ void pouring_screen_init() {
     #else
     ESP_LOGI(TAG, "[Pouring Screen] DEBUG_POURING_TAP_TO_FINISHED is NOT defined");
     #endif
-    
-    pouring_screen_active = true;
-    
-    // Create base screen layout (logo, WiFi icon, data icon)
-    lv_obj_t* content_area = base_screen_create(lv_scr_act());
+
+    // Create the screen and its base layout (logo, WiFi icon, data icon are shared)
+    pouring_scr = lv_obj_create(NULL);
+    if (pouring_scr == NULL) {
+        ESP_LOGE(TAG, "[Pouring Screen] ERROR: Failed to create screen!");
+        return;
+    }
+    lv_obj_t* content_area = base_screen_create(pouring_scr);
     if (content_area == NULL) {
         ESP_LOGE(TAG, "[Pouring Screen] ERROR: Failed to create base screen!");
         return;
@@ -96,7 +136,7 @@ void pouring_screen_init() {
     
     flow_rate_value = lv_label_create(content_area);
     if (flow_rate_value != NULL) {
-        lv_label_set_text(flow_rate_value, "0.00 mL/min");
+        lv_label_set_text_static(flow_rate_value, flow_rate_text);
         lv_obj_set_style_text_color(flow_rate_value, COLOR_GOLDEN, 0);
         lv_obj_set_style_text_font(flow_rate_value, &lv_font_montserrat_14, 0);
         lv_obj_align(flow_rate_value, LV_ALIGN_TOP_LEFT, 10, 30);
@@ -113,7 +153,7 @@ void pouring_screen_init() {
     
     volume_value = lv_label_create(content_area);
     if (volume_value != NULL) {
-        lv_label_set_text(volume_value, "0 ml");
+        lv_label_set_text_static(volume_value, volume_text);
         lv_obj_set_style_text_color(volume_value, COLOR_GOLDEN, 0);
         lv_obj_set_style_text_font(volume_value, &lv_font_montserrat_14, 0);
         lv_obj_align(volume_value, LV_ALIGN_TOP_LEFT, 10, 80);
@@ -130,10 +170,8 @@ void pouring_screen_init() {
     
     cost_per_unit_value = lv_label_create(content_area);
     if (cost_per_unit_value != NULL) {
-        char init_str[32];
-        const char* symbol = (strlen(currency_symbol) > 0) ? currency_symbol : CURRENCY_SYMBOL;
-        snprintf(init_str, sizeof(init_str), "%s0.0000", symbol);
-        lv_label_set_text(cost_per_unit_value, init_str);
+        snprintf(cost_per_unit_text, sizeof(cost_per_unit_text), "%s0.0000", CURRENCY_SYMBOL);
+        lv_label_set_text_static(cost_per_unit_value, cost_per_unit_text);
         lv_obj_set_style_text_color(cost_per_unit_value, COLOR_GOLDEN, 0);
         lv_obj_set_style_text_font(cost_per_unit_value, &lv_font_montserrat_14, 0);
         lv_obj_align(cost_per_unit_value, LV_ALIGN_TOP_RIGHT, -10, 30);
@@ -150,29 +188,40 @@ void pouring_screen_init() {
     
     total_cost_value = lv_label_create(content_area);
     if (total_cost_value != NULL) {
-        char init_str[32];
-        const char* symbol = (strlen(currency_symbol) > 0) ? currency_symbol : CURRENCY_SYMBOL;
-        snprintf(init_str, sizeof(init_str), "%s0.00", symbol);
-        lv_label_set_text(total_cost_value, init_str);
+        snprintf(total_cost_text, sizeof(total_cost_text), "%s0.00", CURRENCY_SYMBOL);
+        lv_label_set_text_static(total_cost_value, total_cost_text);
         lv_obj_set_style_text_color(total_cost_value, COLOR_GOLDEN, 0);
         lv_obj_set_style_text_font(total_cost_value, &lv_font_montserrat_14, 0);
         lv_obj_align(total_cost_value, LV_ALIGN_TOP_RIGHT, -10, 80);
     }
     
     // Add touch event handler to screen - tap anywhere to return to QR code screen
-    lv_obj_add_event_cb(lv_scr_act(), pouring_screen_touch_cb, LV_EVENT_CLICKED, NULL);
-    
-    // Force refresh
-    lv_timer_handler();
-    vTaskDelay(pdMS_TO_TICKS(10));
-    lv_timer_handler();
+    lv_obj_add_event_cb(pouring_scr, pouring_screen_touch_cb, LV_EVENT_CLICKED, NULL);
     
     ESP_LOGI(TAG, "[Pouring Screen] Pouring Screen initialized");
 }
 
+void pouring_screen_show(uint8_t tap) {
+    pouring_screen_init();
+    pour_tap = tap < FLOW_TAP_COUNT ? tap : 0;
+    pouring_screen_active = true;
+    
+    // Fill the labels for the new pour before the screen is shown
+    render_forced = true;
+    pouring_screen_update();
+    base_screen_load(pouring_scr);
+}
+
+void pouring_screen_hide() {
+    pouring_screen_active = false;
+}
+
 // Touch event callback for pouring screen - switch back to QR code screen on tap
 // Or transition to finished screen if debug option is enabled
 static void pouring_screen_touch_cb(lv_event_t *e) {
+    if (!pouring_screen_active) {
+        return;
+    }
     lv_event_code_t code = lv_event_get_code(e);
     
     if (code == LV_EVENT_CLICKED) {
@@ -181,33 +230,26 @@ static void pouring_screen_touch_cb(lv_event_t *e) {
             // Debug mode: transition to finished screen with current values
             ESP_LOGI(TAG, "[Pouring Screen] Debug: Screen tapped - transitioning to finished screen");
             
-            // Get current volume and cost
-            float volume_liters = flow_meter_get_total_volume_liters();
-            float volume_ml = volume_liters * 1000.0;  // Convert to ml
-            
-            // Calculate total cost
-            float total_cost = 0.0;
-            if (pour_active && cost_per_ml > 0.0) {
-                total_cost = volume_ml * cost_per_ml;
-            } else {
-                // Use test values if no pour is active
-                total_cost = volume_ml * 0.005f;  // Default £0.005 per ml
-            }
-            
-            // Get currency symbol
-            const char* currency = (strlen(currency_symbol) > 0) ? currency_symbol : CURRENCY_SYMBOL;
+            // Current volume and cost (display edge); the session bills the same once settled
+            pour_session_info_t info;
+            pour_session_get(pour_tap, &info);
+            float volume_ml = (float)info.volume_ul / 1000.0f;
+            float total_cost = (float)info.cost_minor / (float)POUR_MINOR_PER_MAJOR;
+            const char* currency = (strlen(info.currency) > 0) ? info.currency : CURRENCY_SYMBOL;
             
             ESP_LOGI(TAG, "[Pouring Screen] Debug: Transitioning with volume=%.2f ml, cost=%.2f, currency=%s",
                      volume_ml, total_cost, currency);
             
-            // Transition to finished screen
+            // Stop the pour and transition to finished screen
+            pour_session_stop(pour_tap);
             screen_manager_show_finished(volume_ml, total_cost, currency);
             return;
         }
         #endif
-        
-        // Normal mode: switch back to QR code screen
-        ESP_LOGI(TAG, "[Pouring Screen] Screen tapped - switching to QR code screen");
+
+        // Normal mode: cancel the pour (billed for what was poured) and switch back to QR code screen
+        ESP_LOGI(TAG, "[Pouring Screen] Screen tapped - stopping pour, switching to QR code screen");
+        pour_session_stop(pour_tap);
         
         // Call the callback to switch back to QR code screen
         if (screen_switch_callback != NULL) {
@@ -227,167 +269,70 @@ void pouring_screen_update() {
     // Update base screen (WiFi and data icons)
     base_screen_update();
     
-    // Update flow rate display (convert L/min to mL/min)
-    if (flow_rate_value != NULL) {
-        float flow_rate_lpm = flow_meter_get_flow_rate_lpm();
-        float flow_rate_mlpm = flow_rate_lpm * 1000.0;  // Convert liters to milliliters
-        char flow_str[32];
-        snprintf(flow_str, sizeof(flow_str), "%.2f mL/min", flow_rate_mlpm);
-        lv_label_set_text(flow_rate_value, flow_str);
-    }
+    // One consistent copy of the session for all labels
+    pour_session_info_t info;
+    pour_session_get(pour_tap, &info);
     
-    // Update volume display (convert liters to milliliters)
-    if (volume_value != NULL) {
-        float volume_liters = flow_meter_get_total_volume_liters();
-        float volume_ml = volume_liters * 1000.0;  // Convert liters to milliliters
-        char volume_str[32];
-        snprintf(volume_str, sizeof(volume_str), "%.0f ml", volume_ml);
-        lv_label_set_text(volume_value, volume_str);
+    // Nothing to redraw until the session publishes a change
+    if (!render_forced && info.sequence == rendered_sequence) {
+        return;
     }
+    bool price_changed = render_forced;
+    rendered_sequence = info.sequence;
+    render_forced = false;
     
-    // Update cost per ml display
-    if (cost_per_unit_value != NULL && pour_active) {
-        char cost_str[32];
-        const char* symbol = (strlen(currency_symbol) > 0) ? currency_symbol : CURRENCY_SYMBOL;
-        snprintf(cost_str, sizeof(cost_str), "%s%.4f", symbol, cost_per_ml);
-        lv_label_set_text(cost_per_unit_value, cost_str);
-    }
+    char text[32];
+    const char* symbol = (strlen(info.currency) > 0) ? info.currency : CURRENCY_SYMBOL;
     
-    // Update total cost display (using cost per ml)
-    if (total_cost_value != NULL && pour_active) {
-        float volume_liters = flow_meter_get_total_volume_liters();
-        float volume_ml = volume_liters * 1000.0;  // Convert to ml
-        float total_cost = volume_ml * cost_per_ml;  // Cost = ml * cost_per_ml
-        char cost_str[32];
-        const char* symbol = (strlen(currency_symbol) > 0) ? currency_symbol : CURRENCY_SYMBOL;
-        snprintf(cost_str, sizeof(cost_str), "%s%.2f", symbol, total_cost);
-        lv_label_set_text(total_cost_value, cost_str);
-        
-        // Check if max ml reached
-        if (volume_ml >= max_ml) {
-            ESP_LOGW(TAG, "[Pouring Screen] Maximum volume reached!");
-        }
-    }
-}
-
-void pouring_screen_reset() {
-    pour_active = false;
-    cost_per_ml = 0.0;
-    max_ml = 0;
-    pour_unique_id[0] = '\0';
-    currency_symbol[0] = '\0';
+    // Update flow rate display (convert L/min to mL/min)
+    float flow_rate_mlpm = info.flow_rate_lpm * 1000.0f;  // Convert liters to milliliters
+    snprintf(text, sizeof(text), "%.2f mL/min", flow_rate_mlpm);
+    set_label_if_changed(flow_rate_value, flow_rate_text, sizeof(flow_rate_text), text);
     
-    // Reset flow meter volume
-    flow_meter_reset_volume();
+    // Update volume display (micro-litres to whole millilitres)
+    snprintf(text, sizeof(text), "%" PRIu64 " ml", (uint64_t)(info.volume_ul / 1000));
+    set_label_if_changed(volume_value, volume_text, sizeof(volume_text), text);
     
-    ESP_LOGI(TAG, "[Pouring Screen] Pouring screen reset");
-}
-
-void pouring_screen_set_params(const char* unique_id, float cost_per_ml_param, int max_ml_param, const char* currency) {
-    // Store parameters
-    if (unique_id != NULL) {
-        strncpy(pour_unique_id, unique_id, sizeof(pour_unique_id) - 1);
-        pour_unique_id[sizeof(pour_unique_id) - 1] = '\0';
-    }
-    cost_per_ml = cost_per_ml_param;
-    max_ml = max_ml_param;
-    if (currency != NULL) {
-        strncpy(currency_symbol, currency, sizeof(currency_symbol) - 1);
-        currency_symbol[sizeof(currency_symbol) - 1] = '\0';
-    } else {
-        currency_symbol[0] = '\0';
+    if (info.state == POUR_SESSION_IDLE) {
+        return;
     }
     
-    pour_active = true;
-    
-    ESP_LOGI(TAG, "[Pouring Screen] Updated pour parameters:");
-    ESP_LOGI(TAG, "  ID: %s", pour_unique_id);
-    ESP_LOGI(TAG, "  Cost per ml: %s%.4f", currency_symbol, cost_per_ml);
-    ESP_LOGI(TAG, "  Max ml: %d", max_ml);
-    ESP_LOGI(TAG, "  Currency: %s", currency_symbol);
-}
-
-void pouring_screen_start_pour(const char* unique_id, float cost_per_ml_param, int max_ml_param, const char* currency) {
-    // Reset flow meter first
-    flow_meter_reset_volume();
-    
-    // Set parameters
-    pouring_screen_set_params(unique_id, cost_per_ml_param, max_ml_param, currency);
-    
-    ESP_LOGI(TAG, "[Pouring Screen] Starting pour:");
-    ESP_LOGI(TAG, "  ID: %s", pour_unique_id);
-    ESP_LOGI(TAG, "  Cost per ml: %s%.4f", currency_symbol, cost_per_ml);
-    ESP_LOGI(TAG, "  Max ml: %d", max_ml);
-    ESP_LOGI(TAG, "  Currency: %s", currency_symbol);
-}
-
-bool pouring_screen_is_max_reached() {
-    if (!pour_active) {
-        return false;
+    // Cost per ml is fixed for the whole pour - only render it when the screen is shown
+    if (price_changed) {
+        format_price(text, sizeof(text), symbol, info.price_micro_per_ml);
+        set_label_if_changed(cost_per_unit_value, cost_per_unit_text, sizeof(cost_per_unit_text), text);
     }
     
-    float volume_liters = flow_meter_get_total_volume_liters();
-    float volume_ml = volume_liters * 1000.0;
-    return volume_ml >= max_ml;
+    // Total cost as accumulated by the session
+    format_money(text, sizeof(text), symbol, info.cost_minor);
+    set_label_if_changed(total_cost_value, total_cost_text, sizeof(total_cost_text), text);
 }
 
 void pouring_screen_set_switch_callback(void (*callback)(void)) {
     screen_switch_callback = callback;
 }
 
-float pouring_screen_get_cost_per_ml() {
-    return cost_per_ml;
+uint8_t pouring_screen_get_tap() {
+    return pour_tap;
 }
 
 void pouring_screen_cleanup() {
     // Set inactive first to prevent updates during cleanup
     pouring_screen_active = false;
     
-    // Clean up labels
-    if (flow_rate_label != NULL) {
-        lv_obj_del(flow_rate_label);
-        flow_rate_label = NULL;
-    }
-    
-    if (flow_rate_value != NULL) {
-        lv_obj_del(flow_rate_value);
-        flow_rate_value = NULL;
-    }
-    
-    if (volume_label != NULL) {
-        lv_obj_del(volume_label);
-        volume_label = NULL;
-    }
-    
-    if (volume_value != NULL) {
-        lv_obj_del(volume_value);
-        volume_value = NULL;
-    }
-    
-    if (cost_per_unit_label != NULL) {
-        lv_obj_del(cost_per_unit_label);
-        cost_per_unit_label = NULL;
-    }
-    
-    if (cost_per_unit_value != NULL) {
-        lv_obj_del(cost_per_unit_value);
-        cost_per_unit_value = NULL;
-    }
-    
-    if (total_cost_label != NULL) {
-        lv_obj_del(total_cost_label);
-        total_cost_label = NULL;
-    }
-    
-    if (total_cost_value != NULL) {
-        lv_obj_del(total_cost_value);
-        total_cost_value = NULL;
+    // Deleting the screen deletes all labels and the content area with it
+    if (pouring_scr != NULL) {
+        lv_obj_del(pouring_scr);
+        pouring_scr = NULL;
     }
-    
-    // Clean up base screen (content area only, shared components persist)
-    base_screen_cleanup();
-    
-    pouring_screen_active = false;
+    flow_rate_label = NULL;
+    flow_rate_value = NULL;
+    volume_label = NULL;
+    volume_value = NULL;
+    cost_per_unit_label = NULL;
+    cost_per_unit_value = NULL;
+    total_cost_label = NULL;
+    total_cost_value = NULL;
     
     ESP_LOGI(TAG, "[Pouring Screen] Pouring Screen cleaned up");
 }
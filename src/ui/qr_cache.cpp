@@ -0,0 +1,243 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * QR Code Render Cache Implementation
+ * 
+ * Two module bitmaps: the current one and the one being prepared. The
+ * background encoder only ever writes the prepared slot, and the UI task only
+ * takes it once it is marked ready, so the two never touch the same buffer.
+ * Uses the qrcodegen copy bundled with LVGL (LV_USE_QRCODE).
+ */
+
+// Project headers
+#include "config.h"
+#include "ui/qr_cache.h"
+
+#if LV_USE_QRCODE
+
+// System/Standard library headers
+#include <lvgl.h>
+#include <src/extra/libs/qrcode/qrcodegen.h>
+#include <string.h>
+
+// ESP-IDF framework headers
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#define TAG "qr_cache"
+
+#define QR_MODULES_SIZE qrcodegen_BUFFER_LEN_FOR_VERSION(QR_CACHE_MAX_VERSION)
+#define QR_ENCODE_STACK 3072
+#define QR_ENCODE_PRIORITY 1   // Only ever ahead of time, never on the input path
+
+typedef enum {
+    QR_SLOT_EMPTY = 0,
+    QR_SLOT_ENCODING,
+    QR_SLOT_READY,
+} qr_slot_state_t;
+
+typedef struct {
+    char url[QR_CACHE_URL_SIZE];
+    uint8_t modules[QR_MODULES_SIZE];   // qrcodegen output: size byte + packed modules
+    volatile qr_slot_state_t state;
+} qr_slot_t;
+
+static qr_slot_t* slots = NULL;        // [0], [1] in PSRAM when available
+static qr_slot_t* current = NULL;
+static qr_slot_t* next = NULL;
+
+static char requested_url[QR_CACHE_URL_SIZE];
+static bool requested = false;
+static portMUX_TYPE qr_mux = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t encode_task = NULL;
+
+static lv_img_dsc_t image;
+static uint8_t* image_data = NULL;
+static int image_size = 0;
+
+static void* alloc_buffer(size_t size) {
+#ifdef BOARD_HAS_PSRAM
+    void* data = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (data != NULL) {
+        return data;
+    }
+#endif
+    return heap_caps_malloc(size, MALLOC_CAP_8BIT);
+}
+
+static bool encode(const char* url, uint8_t* modules, uint8_t* temp) {
+    return qrcodegen_encodeText(url, temp, modules, qrcodegen_Ecc_MEDIUM, qrcodegen_VERSION_MIN,
+                                QR_CACHE_MAX_VERSION, qrcodegen_Mask_AUTO, true);
+}
+
+/**
+ * Expand modules into the image: dark modules are palette index 1, each one
+ * scale x scale pixels, centred with the remainder as light margin (as
+ * lv_qrcode does). Builds one pixel row per module row and copies it down.
+ */
+static void blit(const uint8_t* modules) {
+    const int qr_size = qrcodegen_getSize(modules);
+    const int scale = image_size / qr_size > 0 ? image_size / qr_size : 1;
+    const int margin = (image_size - qr_size * scale) / 2;
+    const size_t stride = ((size_t)image_size + 7) / 8;
+    uint8_t* pixels = image_data + 4 * 2;  // After the 2-entry palette
+    
+    memset(pixels, 0, stride * image_size);
+    for (int my = 0; my < qr_size; my++) {
+        int y0 = margin + my * scale;
+        if (y0 >= image_size) {
+            break;
+        }
+        uint8_t* row = pixels + stride * y0;
+        for (int mx = 0; mx < qr_size; mx++) {
+            if (!qrcodegen_getModule(modules, mx, my)) {
+                continue;
+            }
+            int x0 = margin + mx * scale;
+            for (int x = x0; x < x0 + scale && x < image_size; x++) {
+                row[x >> 3] |= (uint8_t)(0x80 >> (x & 7));
+            }
+        }
+        for (int y = y0 + 1; y < y0 + scale && y < image_size; y++) {
+            memcpy(pixels + stride * y, row, stride);
+        }
+    }
+    
+    // LVGL caches decoded images by source, the pixels just changed under it
+    lv_img_cache_invalidate_src(&image);
+}
+
+static void qr_encode_task(void* arg) {
+    static uint8_t temp[QR_MODULES_SIZE];   // UI task encodes with its own
+    
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        
+        qr_slot_t* slot = NULL;
+        taskENTER_CRITICAL(&qr_mux);
+        if (requested) {
+            requested = false;
+            slot = next;
+            slot->state = QR_SLOT_ENCODING;
+            strcpy(slot->url, requested_url);
+        }
+        taskEXIT_CRITICAL(&qr_mux);
+        if (slot == NULL) {
+            continue;
+        }
+        
+        bool ok = encode(slot->url, slot->modules, temp);
+        
+        taskENTER_CRITICAL(&qr_mux);
+        // A newer request arrived meanwhile: leave it to the next pass
+        slot->state = ok && !requested ? QR_SLOT_READY : QR_SLOT_EMPTY;
+        taskEXIT_CRITICAL(&qr_mux);
+        if (!ok) {
+            ESP_LOGE(TAG, "[QR Cache] URL too long to encode: %s", slot->url);
+        }
+    }
+}
+
+bool qr_cache_init(int size_px) {
+    if (slots != NULL) {
+        return true;
+    }
+    image_size = size_px;
+    slots = (qr_slot_t*)alloc_buffer(sizeof(qr_slot_t) * 2);
+    image_data = (uint8_t*)alloc_buffer(LV_IMG_BUF_SIZE_INDEXED_1BIT(size_px, size_px));
+    if (slots == NULL || image_data == NULL) {
+        ESP_LOGE(TAG, "[QR Cache] Failed to allocate buffers");
+        heap_caps_free(slots);
+        heap_caps_free(image_data);
+        slots = NULL;
+        image_data = NULL;
+        return false;
+    }
+    memset(slots, 0, sizeof(qr_slot_t) * 2);
+    current = &slots[0];
+    next = &slots[1];
+    
+    memset(&image, 0, sizeof(image));
+    image.header.cf = LV_IMG_CF_INDEXED_1BIT;
+    image.header.w = size_px;
+    image.header.h = size_px;
+    image.data_size = LV_IMG_BUF_SIZE_INDEXED_1BIT(size_px, size_px);
+    image.data = image_data;
+    lv_img_buf_set_palette(&image, 0, lv_color_hex(0xFFFFFF));
+    lv_img_buf_set_palette(&image, 1, lv_color_hex(0x000000));
+    memset(image_data + 4 * 2, 0, image.data_size - 4 * 2);
+    
+    ESP_LOGI(TAG, "[QR Cache] %dx%d image, %u bytes", size_px, size_px, (unsigned)image.data_size);
+    return true;
+}
+
+bool qr_cache_set_url(const char* url) {
+    static uint8_t temp[QR_MODULES_SIZE];
+    if (current == NULL || strlen(url) >= QR_CACHE_URL_SIZE) {
+        return false;
+    }
+    if (!encode(url, current->modules, temp)) {
+        ESP_LOGE(TAG, "[QR Cache] URL too long to encode: %s", url);
+        return false;
+    }
+    strcpy(current->url, url);
+    current->state = QR_SLOT_READY;
+    blit(current->modules);
+    return true;
+}
+
+bool qr_cache_prepare_next(const char* url) {
+    if (next == NULL || strlen(url) >= QR_CACHE_URL_SIZE) {
+        return false;
+    }
+    if (encode_task == NULL &&
+        xTaskCreatePinnedToCore(qr_encode_task, "qr_encode", QR_ENCODE_STACK, NULL, QR_ENCODE_PRIORITY,
+                                &encode_task, BACKGROUND_TASK_CORE) != pdPASS) {
+        ESP_LOGE(TAG, "[QR Cache] Failed to create encode task");
+        encode_task = NULL;
+        return false;
+    }
+    taskENTER_CRITICAL(&qr_mux);
+    strcpy(requested_url, url);
+    requested = true;
+    taskEXIT_CRITICAL(&qr_mux);
+    xTaskNotifyGive(encode_task);
+    return true;
+}
+
+bool qr_cache_swap_next() {
+    if (next == NULL) {
+        return false;
+    }
+    bool swapped = false;
+    taskENTER_CRITICAL(&qr_mux);
+    if (next->state == QR_SLOT_READY) {
+        qr_slot_t* old = current;
+        current = next;
+        next = old;
+        next->state = QR_SLOT_EMPTY;
+        swapped = true;
+    }
+    taskEXIT_CRITICAL(&qr_mux);
+    if (swapped) {
+        blit(current->modules);
+    }
+    return swapped;
+}
+
+const lv_img_dsc_t* qr_cache_get_image() {
+    return image_data != NULL ? &image : NULL;
+}
+
+const char* qr_cache_get_url() {
+    return current != NULL ? current->url : "";
+}
+
+#endif // LV_USE_QRCODE
@@ -9,17 +9,22 @@
 /**
  * QR Code Screen Implementation
  * 
- * Displays QR code for payment using base_screen layout
+ * Displays QR code for payment using base_screen layout. The code is drawn
+ * from qr_cache as a plain image, so showing the screen never re-encodes it.
+ * With QR_SESSION_NONCE_ENABLED each session's URL carries a fresh nonce,
+ * encoded in the background while the previous pour runs.
  */
 
 // Project headers
 #include "config.h"
 #include "ui/qr_code_screen.h"
-#include "ui/ui_logo.h"
 #include "ui/base_screen.h"
 #include "ui/screen_manager.h"
+#include "ui/qr_cache.h"
+#include "flow/pour_session.h"
 
 // System/Standard library headers
+#include <inttypes.h>
 #include <lvgl.h>
 #include <string.h>
 
@@ -27,6 +32,7 @@
 #include <esp_chip_info.h>
 #include <esp_log.h>
 #include <esp_mac.h>
+#include <esp_random.h>
 #include <esp_system.h>
 #define TAG "qr_screen"
 
@@ -35,6 +41,7 @@
 #include <freertos/task.h>
 
 // UI objects
+static lv_obj_t* qr_screen = NULL;     // Built once, switched in with lv_scr_load()
 static lv_obj_t* qr_code = NULL;
 static lv_obj_t* label_qr_text = NULL;
 static lv_obj_t* content_area = NULL;  // Store content area for event handling
@@ -44,7 +51,8 @@ static bool qr_screen_active = false;
 #define QR_CODE_BASE_URL "https://precisionpour.co.uk/pay"
 
 // Buffer for QR code URL
-static char qr_code_url[128] = {0};
+static char qr_code_url[QR_CACHE_URL_SIZE] = {0};
+static char chip_id[32] = {0};
 
 // Forward declaration for touch event handler
 static void qr_code_touch_event_handler(lv_event_t *e);
@@ -78,7 +86,21 @@ static void get_chip_id_string(char *buffer, size_t buffer_size) {
     }
 }
 
+/**
+ * Build the payment URL for a new session
+ */
+static void build_qr_url(char *buffer, size_t buffer_size) {
+    #if QR_SESSION_NONCE_ENABLED
+    snprintf(buffer, buffer_size, "%s?id=%s&s=%08" PRIX32, QR_CODE_BASE_URL, chip_id, esp_random());
+    #else
+    snprintf(buffer, buffer_size, "%s?id=%s", QR_CODE_BASE_URL, chip_id);
+    #endif
+}
+
 void qr_code_screen_init() {
+    if (qr_screen != NULL) {
+        return;  // Already built
+    }
     ESP_LOGI(TAG, "=== Initializing QR Code Screen ===");
     
     // Log debug option status
@@ -88,21 +110,23 @@ void qr_code_screen_init() {
     ESP_LOGI(TAG, "[QR Screen] DEBUG_QR_TAP_TO_POUR is NOT defined");
     #endif
     
-    qr_screen_active = true;
-    
-    // Create base screen layout (logo, WiFi icon, data icon)
-    content_area = base_screen_create(lv_scr_act());
+    // Create the screen and its base layout (logo, WiFi icon, data icon are shared)
+    qr_screen = lv_obj_create(NULL);
+    if (qr_screen == NULL) {
+        ESP_LOGE(TAG, "[QR Screen] ERROR: Failed to create screen!");
+        return;
+    }
+    content_area = base_screen_create(qr_screen);
     if (content_area == NULL) {
         ESP_LOGE(TAG, "[QR Screen] ERROR: Failed to create base screen!");
         return;
     }
     
     // Read ESP32 unique chip ID (MAC address)
-    char chip_id[32] = {0};
     get_chip_id_string(chip_id, sizeof(chip_id));
     
     // Build QR code URL with device ID
-    snprintf(qr_code_url, sizeof(qr_code_url), "%s?id=%s", QR_CODE_BASE_URL, chip_id);
+    build_qr_url(qr_code_url, sizeof(qr_code_url));
     ESP_LOGI(TAG, "[QR Screen] QR Code URL: %s", qr_code_url);
     
     // Create QR code in the content area
@@ -127,10 +151,12 @@ void qr_code_screen_init() {
         ESP_LOGI(TAG, "[QR Screen] QR code size: %d (content area: %dx%d, available height: %d)", 
                  qr_size, content_width, content_height, content_height);
         
-        qr_code = lv_qrcode_create(content_area, qr_size, lv_color_hex(0x000000), lv_color_hex(0xFFFFFF));
+        // Encode once into the cache and show it as an indexed 1bpp image
+        if (qr_cache_init(qr_size) && qr_cache_set_url(qr_code_url)) {
+            qr_code = lv_img_create(content_area);
+        }
         if (qr_code != NULL) {
-            // Update QR code with URL
-            lv_qrcode_update(qr_code, qr_code_url, strlen(qr_code_url));
+            lv_img_set_src(qr_code, qr_cache_get_image());
             
             // Position QR code at the top of the content area (minimal margin)
             // Content area starts at y=75, with 5px gap from logo (which ends at y=80)
@@ -154,24 +180,13 @@ void qr_code_screen_init() {
                 lv_obj_add_event_cb(content_area, qr_code_touch_event_handler, LV_EVENT_PRESSED, NULL);
                 lv_obj_add_event_cb(content_area, qr_code_touch_event_handler, LV_EVENT_CLICKED, NULL);
                 
-                // Also add handler to logo container (catches touches in logo area above content area)
-                lv_obj_t* logo_obj = ui_logo_get_object();
-                if (logo_obj != NULL) {
-                    lv_obj_t* logo_container = lv_obj_get_parent(logo_obj);
-                    if (logo_container != NULL) {
-                        lv_obj_add_flag(logo_container, LV_OBJ_FLAG_CLICKABLE);
-                        lv_obj_add_event_cb(logo_container, qr_code_touch_event_handler, LV_EVENT_PRESSED, NULL);
-                        ESP_LOGI(TAG, "[QR Screen] Debug: Added handler to logo container");
-                    }
-                }
-                
                 // Also add handler to screen itself as ultimate fallback
-                // Make screen clickable to ensure it receives touch events
-                lv_obj_add_flag(lv_scr_act(), LV_OBJ_FLAG_CLICKABLE);
-                lv_obj_add_event_cb(lv_scr_act(), qr_code_touch_event_handler, LV_EVENT_PRESSED, NULL);
-                lv_obj_add_event_cb(lv_scr_act(), qr_code_touch_event_handler, LV_EVENT_CLICKED, NULL);
+                // The shared logo layer is click-through, so logo-area touches land here too
+                lv_obj_add_flag(qr_screen, LV_OBJ_FLAG_CLICKABLE);
+                lv_obj_add_event_cb(qr_screen, qr_code_touch_event_handler, LV_EVENT_PRESSED, NULL);
+                lv_obj_add_event_cb(qr_screen, qr_code_touch_event_handler, LV_EVENT_CLICKED, NULL);
                 
-                ESP_LOGI(TAG, "[QR Screen] Debug mode: QR code tap to pour enabled (on QR code, content area, logo, and screen)");
+                ESP_LOGI(TAG, "[QR Screen] Debug mode: QR code tap to pour enabled (on QR code, content area and screen)");
                 ESP_LOGI(TAG, "[QR Screen] Debug: QR code bounds: x=100-220, y=70-190 (120x120), center=(160,130)");
             }
             #endif
@@ -205,19 +220,47 @@ void qr_code_screen_init() {
         }
     }
     
-    // Force refresh
-    lv_timer_handler();
-    vTaskDelay(pdMS_TO_TICKS(10));
-    lv_timer_handler();
-    
     ESP_LOGI(TAG, "[QR Screen] QR Code Screen initialized");
 }
 
+void qr_code_screen_prepare_next() {
+    #if QR_SESSION_NONCE_ENABLED && LV_USE_QRCODE
+    char next_url[QR_CACHE_URL_SIZE];
+    build_qr_url(next_url, sizeof(next_url));
+    qr_cache_prepare_next(next_url);
+    #endif
+}
+
+// Show the prepared session code once the background encode has finished
+static void qr_code_swap_next() {
+    #if LV_USE_QRCODE
+    if (qr_code != NULL && qr_cache_swap_next()) {
+        strncpy(qr_code_url, qr_cache_get_url(), sizeof(qr_code_url) - 1);
+        lv_obj_invalidate(qr_code);
+        ESP_LOGI(TAG, "[QR Screen] QR Code URL: %s", qr_code_url);
+    }
+    #endif
+}
+
+void qr_code_screen_show() {
+    qr_code_screen_init();
+    qr_code_swap_next();
+    qr_screen_active = true;
+    base_screen_load(qr_screen);
+}
+
+void qr_code_screen_hide() {
+    qr_screen_active = false;
+}
+
 /**
  * Touch event handler for QR code (debug mode only)
  * Transitions to pouring screen with test parameters when QR code is tapped
  */
 static void qr_code_touch_event_handler(lv_event_t *e) {
+    if (!qr_screen_active) {
+        return;  // Screen is built but not showing
+    }
     lv_event_code_t code = lv_event_get_code(e);
     lv_obj_t* target = lv_event_get_target(e);
     
@@ -268,57 +311,25 @@ static void qr_code_touch_event_handler(lv_event_t *e) {
         if (in_qr_region) {
             ESP_LOGI(TAG, "[QR Screen] Debug: Touch in QR code region (x=%d-%d, y=%d-%d), accepting regardless of target",
                      qr_x1 - margin, qr_x2 + margin, qr_y1 - margin, qr_y2 + margin);
-            // Accept this touch and transition to pouring screen
+            // Accept this touch and start a test pour (the session shows the pouring screen)
             const char* test_unique_id = "debug_tap_order_001";
             float test_cost_per_ml = 0.005f;
             int test_max_ml = 500;
             const char* test_currency = CURRENCY_SYMBOL;
-            screen_manager_show_pouring(test_unique_id, test_cost_per_ml, test_max_ml, test_currency);
+            pour_session_start(0, test_unique_id, test_cost_per_ml, test_max_ml, test_currency);
             return;
         }
     }
     
     // Process the touch event based on target object
     {
-        // Check if the click was on the QR code, content area, logo, or screen
+        // Check if the click was on the QR code, content area, or screen
         // If clicked on content area, check if it's within QR code bounds
         bool is_qr_code_click = (target == qr_code);
         bool is_content_area_click = (target == content_area);
         
-        // Check if it's the logo container
-        lv_obj_t* logo_obj = ui_logo_get_object();
-        lv_obj_t* logo_container = (logo_obj != NULL) ? lv_obj_get_parent(logo_obj) : NULL;
-        bool is_logo_click = (logo_container != NULL && target == logo_container);
-        
         if (is_qr_code_click) {
             ESP_LOGI(TAG, "[QR Screen] Debug: QR code directly clicked");
-        } else if (is_logo_click) {
-            // Logo area clicked - for debug mode, accept if it's in the QR code region
-            lv_point_t point;
-            lv_indev_t* indev = lv_indev_get_act();
-            if (indev != NULL) {
-                lv_indev_get_point(indev, &point);
-                
-                // Check if touch is in QR code region (with margin)
-                int qr_size = 120;
-                int qr_center_x = DISPLAY_WIDTH / 2;
-                int qr_x1 = qr_center_x - qr_size / 2;
-                int qr_x2 = qr_center_x + qr_size / 2;
-                int qr_y1 = BASE_SCREEN_CONTENT_Y;
-                int margin = 30;
-                
-                if (point.x >= (qr_x1 - margin) && point.x <= (qr_x2 + margin) && 
-                    point.y >= (qr_y1 - margin)) {
-                    ESP_LOGI(TAG, "[QR Screen] Debug: Logo area clicked in QR code region, accepting");
-                    is_qr_code_click = true;
-                } else {
-                    ESP_LOGI(TAG, "[QR Screen] Debug: Logo area clicked outside QR code region, ignoring");
-                    return;
-                }
-            } else {
-                // Can't determine, accept logo clicks for debug mode
-                is_qr_code_click = true;
-            }
         } else if (is_content_area_click && qr_code != NULL) {
             // Get touch point
             lv_point_t point;
@@ -367,7 +378,7 @@ static void qr_code_touch_event_handler(lv_event_t *e) {
         } else {
             // Check if it's a screen-level touch (fallback for touches outside content area)
             // This handles touches on logo, screen background, or other non-clickable objects
-            if (target == lv_scr_act()) {
+            if (target == qr_screen) {
                 // Get touch point to check if it's in QR code area
                 lv_point_t point;
                 lv_indev_t* indev = lv_indev_get_act();
@@ -420,13 +431,13 @@ static void qr_code_touch_event_handler(lv_event_t *e) {
         if (is_qr_code_click) {
             ESP_LOGI(TAG, "[QR Screen] Debug: QR code tapped, transitioning to pouring screen");
             
-            // Transition to pouring screen with test parameters
+            // Start a test pour (the session shows the pouring screen)
             const char* test_unique_id = "debug_tap_order_001";
             float test_cost_per_ml = 0.005f;  // £0.005 per ml = £5.00 per liter
             int test_max_ml = 500;  // 500ml max pour
             const char* test_currency = CURRENCY_SYMBOL;
             
-            screen_manager_show_pouring(test_unique_id, test_cost_per_ml, test_max_ml, test_currency);
+            pour_session_start(0, test_unique_id, test_cost_per_ml, test_max_ml, test_currency);
         }
     }
 }
@@ -440,29 +451,21 @@ void qr_code_screen_update() {
     // Update base screen (WiFi and data icons)
     base_screen_update();
     
-    // QR code is static and doesn't need updating
-    // If you need dynamic QR codes, call lv_qrcode_update() here with new data
+    // Pour was shorter than the background encode: pick the new code up now
+    qr_code_swap_next();
 }
 
 void qr_code_screen_cleanup() {
     // Set inactive first to prevent updates during cleanup
     qr_screen_active = false;
     
-    // Clean up QR code
-    if (qr_code != NULL) {
-        lv_obj_del(qr_code);
-        qr_code = NULL;
-    }
-    
-    if (label_qr_text != NULL) {
-        lv_obj_del(label_qr_text);
-        label_qr_text = NULL;
+    // Deleting the screen deletes the QR code, label and content area with it
+    if (qr_screen != NULL) {
+        lv_obj_del(qr_screen);
+        qr_screen = NULL;
     }
-    
-    // Clean up base screen (content area only, shared components persist)
-    base_screen_cleanup();
-    
-    // Reset content area reference
+    qr_code = NULL;
+    label_qr_text = NULL;
     content_area = NULL;
     
     ESP_LOGI(TAG, "[QR Screen] QR Code Screen cleaned up");
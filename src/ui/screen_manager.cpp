@@ -18,10 +18,14 @@
 #include "ui/qr_code_screen.h"
 #include "ui/pouring_screen.h"
 #include "ui/finished_screen.h"
-#include "flow/flow_meter.h"
+#include "ui/touch_cal_screen.h"
+#include "ui/base_screen.h"
+#include "flow/flow_stats.h"
+#include "system/perf_monitor.h"
 
 // System/Standard library headers
 #include <lvgl.h>
+#include <string.h>
 
 // ESP-IDF framework headers
 #include <esp_log.h>
@@ -40,9 +44,37 @@ static char pouring_currency[8] = {0};
 // Forward declaration for callback
 static void pouring_screen_switch_callback();
 
+// Mark the current screen inactive before another one is loaded
+static void screen_manager_hide_current() {
+    switch (current_state) {
+        case SCREEN_QR_CODE:
+            qr_code_screen_hide();
+            break;
+        case SCREEN_POURING:
+            pouring_screen_hide();
+            break;
+        case SCREEN_FINISHED:
+            finished_screen_hide();
+            break;
+        case SCREEN_TOUCH_CAL:
+            touch_cal_screen_hide();
+            break;
+        default:
+            break;
+    }
+}
+
 void screen_manager_init() {
     ESP_LOGI(TAG, "[Screen Manager] Initializing screen manager...");
     current_state = SCREEN_SPLASH;
+    
+    // Build every screen once - transitions only switch with lv_scr_load()
+    base_screen_init();
+    qr_code_screen_init();
+    pouring_screen_init();
+    pouring_screen_set_switch_callback(pouring_screen_switch_callback);
+    finished_screen_init();
+    
     ESP_LOGI(TAG, "[Screen Manager] Screen manager initialized (state: SPLASH)");
 }
 
@@ -57,67 +89,26 @@ void screen_manager_show_qr_code() {
     }
     
     ESP_LOGI(TAG, "[Screen Manager] Transitioning to QR code screen...");
-    
-    // Clean up previous screen
-    switch (current_state) {
-        case SCREEN_POURING:
-            pouring_screen_cleanup();
-            break;
-        case SCREEN_FINISHED:
-            finished_screen_cleanup();
-            break;
-        default:
-            break;
-    }
-    
-    // Give LVGL time to process deletions before creating new objects
-    // Process multiple times to ensure all pending operations are flushed
-    for (int i = 0; i < 5; i++) {
-        lv_timer_handler();
-        vTaskDelay(pdMS_TO_TICKS(5));
-    }
-    
-    // Initialize QR code screen
-    qr_code_screen_init();
+    screen_manager_hide_current();
+    qr_code_screen_show();
     current_state = SCREEN_QR_CODE;
+    flow_stats_set_idle_screen(true);  // Flow from here on with no pour open is an anomaly
     
     ESP_LOGI(TAG, "[Screen Manager] Now on QR code screen");
 }
 
-void screen_manager_show_pouring(const char* unique_id, float cost_per_ml, int max_ml, const char* currency) {
-    ESP_LOGI(TAG, "[Screen Manager] Transitioning to pouring screen...");
-    
-    // Store currency for finished screen
-    if (currency != NULL) {
-        strncpy(pouring_currency, currency, sizeof(pouring_currency) - 1);
-        pouring_currency[sizeof(pouring_currency) - 1] = '\0';
-    } else {
-        pouring_currency[0] = '\0';
-    }
-    
-    // Clean up previous screen
-    if (current_state == SCREEN_QR_CODE) {
-        qr_code_screen_cleanup();
-    } else if (current_state == SCREEN_FINISHED) {
-        finished_screen_cleanup();
-    }
-    
-    // Give LVGL time to process deletions before creating new objects
-    // Process multiple times to ensure all pending operations are flushed
-    for (int i = 0; i < 5; i++) {
-        lv_timer_handler();
-        vTaskDelay(pdMS_TO_TICKS(5));
-    }
-    
-    // Initialize pouring screen
-    pouring_screen_init();
+void screen_manager_show_pouring(uint8_t tap) {
+    ESP_LOGI(TAG, "[Screen Manager] Transitioning to pouring screen (tap %u)...", (unsigned)tap);
     
-    // Set switch callback
-    pouring_screen_set_switch_callback(pouring_screen_switch_callback);
-    
-    // Start pour with parameters
-    pouring_screen_start_pour(unique_id, cost_per_ml, max_ml, currency);
+    // Hide previous screen, then show the session's current values
+    screen_manager_hide_current();
+    pouring_screen_show(tap);
     current_state = SCREEN_POURING;
+    flow_stats_set_idle_screen(false);
+    
+    // Next customer's QR code is encoded while this pour runs
+    qr_code_screen_prepare_next();
+    perf_monitor_mark(PERF_MARK_SCREEN);
     
     ESP_LOGI(TAG, "[Screen Manager] Now on pouring screen");
 }
@@ -135,25 +126,25 @@ void screen_manager_show_finished(float final_volume_ml, float final_cost, const
         pouring_currency[0] = '\0';
     }
     
-    // Clean up pouring screen
-    if (current_state == SCREEN_POURING) {
-        pouring_screen_cleanup();
-    }
-    
-    // Give LVGL time to process deletions before creating new objects
-    // Process multiple times to ensure all pending operations are flushed
-    for (int i = 0; i < 5; i++) {
-        lv_timer_handler();
-        vTaskDelay(pdMS_TO_TICKS(5));
-    }
-    
-    // Initialize finished screen
-    finished_screen_init(final_volume_ml, final_cost, currency);
+    screen_manager_hide_current();
+    finished_screen_show(final_volume_ml, final_cost, currency);
     current_state = SCREEN_FINISHED;
+    flow_stats_set_idle_screen(false);
     
     ESP_LOGI(TAG, "[Screen Manager] Now on finished screen");
 }
 
+void screen_manager_show_touch_cal() {
+    ESP_LOGI(TAG, "[Screen Manager] Transitioning to touch calibration screen...");
+    
+    screen_manager_hide_current();
+    touch_cal_screen_show();
+    current_state = SCREEN_TOUCH_CAL;
+    flow_stats_set_idle_screen(false);
+    
+    ESP_LOGI(TAG, "[Screen Manager] Now on touch calibration screen");
+}
+
 void screen_manager_update() {
     // Only update if we're not in transition (splash screen transitions are handled separately)
     if (current_state == SCREEN_SPLASH) {
@@ -166,26 +157,8 @@ void screen_manager_update() {
             break;
             
         case SCREEN_POURING:
+            // The finished screen is requested by the pour session once it reports
             pouring_screen_update();
-            
-            // Check if pouring is complete (max volume reached)
-            if (pouring_screen_is_max_reached()) {
-                // Get final values
-                float volume_liters = flow_meter_get_total_volume_liters();
-                float volume_ml = volume_liters * 1000.0;
-                
-                // Calculate final cost
-                float cost_per_ml = pouring_screen_get_cost_per_ml();
-                float final_cost = volume_ml * cost_per_ml;
-                
-                // Get currency symbol (we'll need to add a getter or store it)
-                // For now, use the stored currency
-                const char* currency = (strlen(pouring_currency) > 0) ? pouring_currency : CURRENCY_SYMBOL;
-                
-                // Transition to finished screen
-                ESP_LOGI(TAG, "[Screen Manager] Pouring complete, transitioning to finished screen");
-                screen_manager_show_finished(volume_ml, final_cost, currency);
-            }
             break;
             
         case SCREEN_FINISHED:
@@ -197,6 +170,12 @@ void screen_manager_update() {
             }
             break;
             
+        case SCREEN_TOUCH_CAL:
+            if (touch_cal_screen_update()) {
+                screen_manager_show_qr_code();
+            }
+            break;
+            
         case SCREEN_SPLASH:
             // Splash screen is handled separately in main.cpp
             break;
@@ -204,20 +183,15 @@ void screen_manager_update() {
 }
 
 void screen_manager_cleanup() {
-    // Clean up current screen
-    switch (current_state) {
-        case SCREEN_QR_CODE:
-            qr_code_screen_cleanup();
-            break;
-        case SCREEN_POURING:
-            pouring_screen_cleanup();
-            break;
-        case SCREEN_FINISHED:
-            finished_screen_cleanup();
-            break;
-        default:
-            break;
-    }
+    screen_manager_hide_current();
+    
+    // Delete all cached screens and the shared layer
+    // (the caller must have loaded another screen first)
+    qr_code_screen_cleanup();
+    pouring_screen_cleanup();
+    finished_screen_cleanup();
+    touch_cal_screen_cleanup();
+    base_screen_cleanup();
     
     current_state = SCREEN_SPLASH;
     ESP_LOGI(TAG, "[Screen Manager] Screen manager cleaned up");
@@ -25,15 +25,21 @@
 #define TAG "splashscreen"
 
 #if !TEST_MODE
-    // Include the Precision Pour logo image (used for both splashscreen and main page)
-    #include "images/precision_pour_logo.h"
-    #include "utils/rle_decompress.h"
+    // The splash image comes from the asset bundle, falling back to the logo (used for both splashscreen and main page)
+    #include "ui/ui_logo.h"
+    #include "utils/asset_store.h"
+    #include "utils/image_cache.h"
+    #include "display/lvgl_display.h"
 #endif
 
 static lv_obj_t *splashscreen_img = NULL;
 static lv_obj_t *progress_bar = NULL;
 static lv_obj_t *status_label = NULL;
 static bool splashscreen_active = false;
+static const lv_img_dsc_t *splashscreen_logo = NULL;
+#if !TEST_MODE
+static asset_image_t splash_image = {};  // Source image, dsc NULL if there is none
+#endif
 
 // Progress bar dimensions (positioned at bottom of screen to match image design)
 #define PROGRESS_BAR_HEIGHT 6
@@ -72,56 +78,80 @@ void splashscreen_init() {
         lv_obj_set_style_bg_opa(lv_scr_act(), LV_OPA_COVER, 0);
         lv_timer_handler();
         vTaskDelay(pdMS_TO_TICKS(5));
-        
-        // Create image object
-        splashscreen_img = lv_img_create(lv_scr_act());
-        
-        // Load the embedded Precision Pour logo image
-        ESP_LOGI(TAG, "[Splashscreen] Setting logo image source...");
-        ESP_LOGI(TAG, "[Splashscreen] Logo pointer: %p, data pointer: %p, data_size: %d",
-                 &precision_pour_logo, precision_pour_logo.data, precision_pour_logo.data_size);
-        
-        if (precision_pour_logo.data == NULL) {
-            ESP_LOGI(TAG, "[Splashscreen] ERROR: Logo image data is NULL!");
-        } else {
-            ESP_LOGI(TAG, "[Splashscreen] Logo image data is valid, decompressing if needed...");
-            // Get decompressed image (handles RLE compression if enabled)
-            const lv_img_dsc_t* logo_img = rle_get_image(
-                &precision_pour_logo,
-                PRECISION_POUR_LOGO_IS_COMPRESSED,
-                PRECISION_POUR_LOGO_IS_COMPRESSED ? PRECISION_POUR_LOGO_UNCOMPRESSED_SIZE : precision_pour_logo.data_size
-            );
+
+        if (!asset_store_get_image(ASSET_NAME_SPLASH, &splash_image) && !ui_logo_get_image(&splash_image)) {
+            splash_image.dsc = NULL;
+            ESP_LOGW(TAG, "[Splashscreen] No splash or logo image (asset partition empty)");
+        }
+        const lv_img_dsc_t *splash_src = splash_image.dsc;
+
+        #if SPLASH_STREAM_ENABLED
+        // Paint the black background now, then stream the logo straight to the
+        // panel in bands - nothing above invalidates the logo area afterwards
+        lv_refr_now(NULL);
+        bool streamed = splash_src != NULL && lvgl_display_stream_image(
+            splash_src,
+            splash_image.is_compressed,
+            (DISPLAY_WIDTH - splash_src->header.w) / 2,
+            (DISPLAY_HEIGHT - splash_src->header.h) / 2
+        );
+        if (streamed) {
+            ESP_LOGI(TAG, "[Splashscreen] Logo streamed to panel (%dx%d)",
+                     splash_src->header.w, splash_src->header.h);
+        } else if (splash_src != NULL) {
+            ESP_LOGW(TAG, "[Splashscreen] Logo streaming failed, falling back to LVGL image");
+        }
+        #else
+        bool streamed = false;
+        #endif
+
+        if (!streamed && splash_src != NULL) {
+            // Create image object
+            splashscreen_img = lv_img_create(lv_scr_act());
             
-            if (logo_img == NULL) {
-                ESP_LOGE(TAG, "[Splashscreen] ERROR: Failed to get logo image!");
+            // Load the Precision Pour logo image
+            ESP_LOGI(TAG, "[Splashscreen] Setting logo image source...");
+            ESP_LOGI(TAG, "[Splashscreen] Logo pointer: %p, data pointer: %p, data_size: %d",
+                     splash_src, splash_src->data, splash_src->data_size);
+            
+            if (splash_src->data == NULL) {
+                ESP_LOGI(TAG, "[Splashscreen] ERROR: Logo image data is NULL!");
             } else {
-                lv_img_set_src(splashscreen_img, logo_img);
+                ESP_LOGI(TAG, "[Splashscreen] Logo image data is valid, decompressing if needed...");
+                // Get decoded image from the cache (the main UI logo reuses the same decode)
+                splashscreen_logo = image_cache_acquire(splash_src, splash_image.is_compressed, splash_image.raw_size);
+                
+                if (splashscreen_logo == NULL) {
+                    ESP_LOGE(TAG, "[Splashscreen] ERROR: Failed to get logo image!");
+                } else {
+                    lv_img_set_src(splashscreen_img, splashscreen_logo);
+                }
             }
+            
+            // Center the logo on the screen (logo is 280x80, display is 320x240)
+            lv_obj_align(splashscreen_img, LV_ALIGN_CENTER, 0, 0);
+            
+            // Remove any padding
+            lv_obj_set_style_pad_all(splashscreen_img, 0, 0);
+            
+            // Force refresh
+            lv_obj_invalidate(splashscreen_img);
+            lv_refr_now(NULL);
+            
+            ESP_LOGI(TAG, "[Splashscreen] Image source set, processing LVGL...");
+            for (int i = 0; i < 10; i++) {
+                lv_timer_handler();
+                vTaskDelay(pdMS_TO_TICKS(5));
+            }
+            
+            ESP_LOGI(TAG, "[Splashscreen] Precision Pour logo should be visible");
+            ESP_LOGI(TAG, "[Splashscreen] Logo data pointer: %p, size: %d bytes", 
+                     splash_src->data, splash_src->data_size);
         }
         
-        // Center the logo on the screen (logo is 280x80, display is 320x240)
-        lv_obj_align(splashscreen_img, LV_ALIGN_CENTER, 0, 0);
-        
-        // Remove any padding
-        lv_obj_set_style_pad_all(splashscreen_img, 0, 0);
-        
-        // Force refresh
-        lv_obj_invalidate(splashscreen_img);
-        lv_refr_now(NULL);
-        
-        ESP_LOGI(TAG, "[Splashscreen] Image source set, processing LVGL...");
-        for (int i = 0; i < 10; i++) {
-            lv_timer_handler();
-            vTaskDelay(pdMS_TO_TICKS(5));
-        }
-        
-        ESP_LOGI(TAG, "[Splashscreen] Precision Pour logo should be visible");
-        ESP_LOGI(TAG, "[Splashscreen] Logo data pointer: %p, size: %d bytes", 
-                 precision_pour_logo.data, precision_pour_logo.data_size);
-        
         // The image already contains the branding, so we just add the progress bar overlay
     #endif
-    
+
     // Create progress bar at the bottom
     // Position it below the logo, centered horizontally
     progress_bar = lv_bar_create(lv_scr_act());
@@ -149,7 +179,7 @@ void splashscreen_init() {
     // Status label above progress bar
     // Note: The Precision Pour image already has "INITIALIZING SENSORS..." text,
     // so this label can be hidden or used for additional status updates
-    status_label = lv_label_create(splashscreen_img);
+    status_label = lv_label_create(splashscreen_img != NULL ? splashscreen_img : lv_scr_act());
     lv_label_set_text(status_label, "");
     lv_obj_set_style_text_font(status_label, &lv_font_montserrat_14, 0);
     lv_obj_set_style_text_color(status_label, lv_color_hex(0xFFFFFF), 0);
@@ -167,13 +197,13 @@ void splashscreen_init() {
         lv_timer_handler();
         vTaskDelay(pdMS_TO_TICKS(5));
     }
-    
+
     #if TEST_MODE
         ESP_LOGI(TAG, "Splashscreen displayed (test mode - simple)");
     #else
         ESP_LOGI(TAG, "Splashscreen displayed (production mode - Precision Pour image)");
         ESP_LOGI(TAG, "Image pointer: %p, Size: %dx%d", 
-                 &precision_pour_logo, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+                 splash_image.dsc, DISPLAY_WIDTH, DISPLAY_HEIGHT);
     #endif
 }
 
@@ -208,7 +238,7 @@ void splashscreen_set_status(const char *text) {
             lv_label_set_text(status_label, text);
             lv_obj_align(status_label, LV_ALIGN_BOTTOM_MID, 0, PROGRESS_BAR_Y_OFFSET - 18);
         #endif
-        
+
         // Process LVGL to update display
         lv_timer_handler();
         
@@ -240,7 +270,14 @@ void splashscreen_remove() {
         lv_obj_del(splashscreen_img);
         splashscreen_img = NULL;
     }
-    
+
+    #if !TEST_MODE
+    if (splashscreen_logo != NULL) {
+        image_cache_release(splash_image.dsc);
+        splashscreen_logo = NULL;
+    }
+    #endif
+
     splashscreen_active = false;
     
     // Process LVGL to update display
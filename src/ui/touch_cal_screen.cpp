@@ -0,0 +1,238 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Touch Calibration Screen Implementation
+ * 
+ * Targets sit 10% in from three corners, so the raw points are far apart and
+ * never collinear. A target only counts once the finger is lifted again, so
+ * one long press cannot complete two targets.
+ */
+
+// Project headers
+#include "config.h"
+#include "ui/touch_cal_screen.h"
+#include "ui/base_screen.h"
+#include "display/lvgl_touch.h"
+
+// System/Standard library headers
+#include <lvgl.h>
+#include <stdio.h>
+
+// ESP-IDF framework headers
+#include <esp_log.h>
+#include <esp_timer.h>
+#define TAG "touch_cal"
+
+#define CROSSHAIR_SIZE 21
+#define CROSSHAIR_WIDTH 3
+
+// Colors
+#define COLOR_TEXT lv_color_hex(0xFFFFFF) // White
+#define COLOR_GOLDEN lv_color_hex(0xFFD700) // Golden yellow
+
+typedef enum {
+    CAL_TOUCH,      // Waiting for samples on the current target
+    CAL_RELEASE,    // Target done, waiting for the finger to lift
+    CAL_RESULT      // Showing the outcome
+} cal_phase_t;
+
+// UI objects
+static lv_obj_t* cal_scr = NULL;
+static lv_obj_t* cross_h = NULL;
+static lv_obj_t* cross_v = NULL;
+static lv_obj_t* message_label = NULL;
+static char message_text[64] = "";
+
+// Run state
+static bool cal_active = false;
+static cal_phase_t phase = CAL_TOUCH;
+static uint8_t target = 0;
+static uint8_t samples = 0;
+static int32_t sum_x = 0;
+static int32_t sum_y = 0;
+static uint64_t phase_start_ms = 0;
+static touch_point_t display_points[3];
+static touch_point_t raw_points[3];
+
+static uint64_t now_ms() {
+    return (uint64_t)(esp_timer_get_time() / 1000ULL);
+}
+
+static void set_message(const char* text) {
+    snprintf(message_text, sizeof(message_text), "%s", text);
+    if (message_label != NULL) {
+        lv_label_set_text_static(message_label, message_text);
+    }
+}
+
+static lv_obj_t* create_bar(lv_obj_t* parent, lv_coord_t w, lv_coord_t h) {
+    lv_obj_t* bar = lv_obj_create(parent);
+    if (bar != NULL) {
+        lv_obj_remove_style_all(bar);
+        lv_obj_set_size(bar, w, h);
+        lv_obj_set_style_bg_color(bar, COLOR_GOLDEN, 0);
+        lv_obj_set_style_bg_opa(bar, LV_OPA_COVER, 0);
+        lv_obj_clear_flag(bar, LV_OBJ_FLAG_CLICKABLE);
+    }
+    return bar;
+}
+
+static void build() {
+    if (cal_scr != NULL) {
+        return;
+    }
+    cal_scr = lv_obj_create(NULL);
+    if (cal_scr == NULL) {
+        ESP_LOGE(TAG, "[Touch Cal] ERROR: Failed to create screen!");
+        return;
+    }
+    lv_obj_set_style_bg_color(cal_scr, lv_color_hex(0x000000), 0);
+    lv_obj_clear_flag(cal_scr, LV_OBJ_FLAG_SCROLLABLE);
+    
+    cross_h = create_bar(cal_scr, CROSSHAIR_SIZE, CROSSHAIR_WIDTH);
+    cross_v = create_bar(cal_scr, CROSSHAIR_WIDTH, CROSSHAIR_SIZE);
+    
+    message_label = lv_label_create(cal_scr);
+    if (message_label != NULL) {
+        lv_label_set_text_static(message_label, message_text);
+        lv_obj_set_style_text_color(message_label, COLOR_TEXT, 0);
+        lv_obj_set_style_text_font(message_label, &lv_font_montserrat_14, 0);
+        lv_obj_set_style_text_align(message_label, LV_TEXT_ALIGN_CENTER, 0);
+        lv_obj_align(message_label, LV_ALIGN_CENTER, 0, 0);
+    }
+    
+    // Corners 10% in: top left, top right, bottom left
+    const int16_t left = DISPLAY_WIDTH / 10;
+    const int16_t right = DISPLAY_WIDTH - DISPLAY_WIDTH / 10;
+    const int16_t top = DISPLAY_HEIGHT / 10;
+    const int16_t bottom = DISPLAY_HEIGHT - DISPLAY_HEIGHT / 10;
+    display_points[0] = {left, top};
+    display_points[1] = {right, top};
+    display_points[2] = {left, bottom};
+}
+
+static void show_target() {
+    const touch_point_t* p = &display_points[target];
+    if (cross_h != NULL) {
+        lv_obj_clear_flag(cross_h, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_set_pos(cross_h, p->x - CROSSHAIR_SIZE / 2, p->y - CROSSHAIR_WIDTH / 2);
+    }
+    if (cross_v != NULL) {
+        lv_obj_clear_flag(cross_v, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_set_pos(cross_v, p->x - CROSSHAIR_WIDTH / 2, p->y - CROSSHAIR_SIZE / 2);
+    }
+    char text[48];
+    snprintf(text, sizeof(text), "Touch and hold the target (%u/3)", (unsigned)(target + 1));
+    set_message(text);
+    samples = 0;
+    sum_x = 0;
+    sum_y = 0;
+    phase = CAL_TOUCH;
+    phase_start_ms = now_ms();
+}
+
+static void show_result(bool ok) {
+    if (cross_h != NULL) {
+        lv_obj_add_flag(cross_h, LV_OBJ_FLAG_HIDDEN);
+    }
+    if (cross_v != NULL) {
+        lv_obj_add_flag(cross_v, LV_OBJ_FLAG_HIDDEN);
+    }
+    set_message(ok ? "Touch calibration saved" : "Touch calibration failed");
+    phase = CAL_RESULT;
+    phase_start_ms = now_ms();
+}
+
+void touch_cal_screen_show() {
+    build();
+    if (cal_scr == NULL) {
+        return;
+    }
+    target = 0;
+    show_target();
+    cal_active = true;
+    base_screen_load(cal_scr);
+    ESP_LOGI(TAG, "[Touch Cal] Calibration started");
+}
+
+void touch_cal_screen_hide() {
+    if (cal_active && phase != CAL_RESULT) {
+        ESP_LOGW(TAG, "[Touch Cal] Calibration abandoned - previous calibration kept");
+    }
+    cal_active = false;
+}
+
+bool touch_cal_screen_update() {
+    if (!cal_active) {
+        return false;
+    }
+    uint64_t elapsed = now_ms() - phase_start_ms;
+    
+    if (phase == CAL_RESULT) {
+        if (elapsed >= TOUCH_CAL_SCREEN_RESULT_MS) {
+            cal_active = false;
+            return true;
+        }
+        return false;
+    }
+    if (elapsed >= TOUCH_CAL_SCREEN_TIMEOUT_MS) {
+        ESP_LOGW(TAG, "[Touch Cal] No touch on target %u - calibration unchanged", (unsigned)(target + 1));
+        cal_active = false;
+        return true;
+    }
+    
+    touch_point_t raw;
+    bool pressed = lvgl_touch_read_raw(&raw);
+    if (phase == CAL_RELEASE) {
+        if (!pressed) {
+            show_target();
+        }
+        return false;
+    }
+    if (!pressed) {
+        // Lifted early - start the target over
+        samples = 0;
+        sum_x = 0;
+        sum_y = 0;
+        return false;
+    }
+    
+    sum_x += raw.x;
+    sum_y += raw.y;
+    if (++samples < TOUCH_CAL_SCREEN_SAMPLES) {
+        return false;
+    }
+    raw_points[target].x = (int16_t)(sum_x / TOUCH_CAL_SCREEN_SAMPLES);
+    raw_points[target].y = (int16_t)(sum_y / TOUCH_CAL_SCREEN_SAMPLES);
+    ESP_LOGI(TAG, "[Touch Cal] Target %u: display (%d, %d) raw (%d, %d)", (unsigned)(target + 1),
+             display_points[target].x, display_points[target].y, raw_points[target].x, raw_points[target].y);
+    
+    if (++target < 3) {
+        set_message("Release");
+        phase = CAL_RELEASE;
+        return false;
+    }
+    show_result(lvgl_touch_set_calibration(display_points, raw_points));
+    return false;
+}
+
+void touch_cal_screen_cleanup() {
+    cal_active = false;
+    
+    // Deleting the screen deletes the crosshair and label with it
+    if (cal_scr != NULL) {
+        lv_obj_del(cal_scr);
+        cal_scr = NULL;
+    }
+    cross_h = NULL;
+    cross_v = NULL;
+    message_label = NULL;
+    
+    ESP_LOGI(TAG, "[Touch Cal] Touch calibration screen cleaned up");
+}
@@ -8,6 +8,11 @@
 
 /**
  * Shared Data Icon Component Implementation
+ * 
+ * The icon is one canvas, redrawn only when its state (disconnected, idle,
+ * active) changes. While active an lv_timer flashes it by hiding and showing
+ * the canvas, and drops it back to idle once activity stops, so the icon
+ * costs nothing between state changes.
  */
 
 // Project headers
@@ -19,40 +24,97 @@
 
 // ESP-IDF framework headers
 #include <esp_log.h>
-#include <esp_timer.h>
 #define TAG "ui_data"
 
+#define DATA_ICON_SIZE 20
+
+typedef enum {
+    DATA_ICON_NONE = 0,       // Not drawn yet
+    DATA_ICON_DISCONNECTED,   // Red
+    DATA_ICON_IDLE,           // Gray, reduced opacity
+    DATA_ICON_ACTIVE,         // Green, flashing
+} data_icon_state_t;
+
 // Static data icon objects (shared across all screens)
-static lv_obj_t* data_container = NULL;
-static lv_obj_t* data_spark1 = NULL;
-static lv_obj_t* data_spark2 = NULL;
-static lv_obj_t* data_spark3 = NULL;
+static lv_obj_t* data_canvas = NULL;
+static uint8_t data_canvas_buf[LV_CANVAS_BUF_SIZE_TRUE_COLOR_ALPHA(DATA_ICON_SIZE, DATA_ICON_SIZE)];
+static lv_timer_t* data_flash_timer = NULL;
 
 // Data icon state
-static bool data_active = false;
-static uint64_t last_activity_time = 0;
-static const uint64_t ACTIVITY_TIMEOUT_MS = 500;  // Show activity for 500ms after last activity
+static data_icon_state_t drawn_state = DATA_ICON_NONE;
+static bool data_connected = false;
+static uint32_t last_activity_tick = 0;
+static const uint32_t ACTIVITY_TIMEOUT_MS = 500;  // Show activity for 500ms after last activity
+static const uint32_t FLASH_INTERVAL_MS = 200;    // Flash every 200ms (5 times per second)
 
-// Flash animation state (for TCP/IP activity indication)
-static bool flash_state = false;  // Current flash state (true = visible, false = hidden)
-static uint64_t last_flash_toggle = 0;
-static const uint64_t FLASH_INTERVAL_MS = 200;  // Flash every 200ms (5 times per second)
+static void draw_state(data_icon_state_t state) {
+    if (data_canvas == NULL || state == drawn_state) {
+        return;
+    }
+    drawn_state = state;
+    
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.radius = 1;
+    dsc.border_width = 0;
+    switch (state) {
+        case DATA_ICON_ACTIVE:
+            dsc.bg_color = lv_color_hex(0x00FF00);  // Green when active
+            dsc.bg_opa = LV_OPA_COVER;
+            break;
+        case DATA_ICON_IDLE:
+            dsc.bg_color = lv_color_hex(0x808080);  // Gray when connected but idle
+            dsc.bg_opa = LV_OPA_60;
+            break;
+        default:
+            dsc.bg_color = lv_color_hex(0xFF0000);  // Red when disconnected
+            dsc.bg_opa = LV_OPA_COVER;
+            break;
+    }
+    
+    // Spark/pulse elements (zigzag pattern like electric pulse): small, main, small
+    lv_canvas_fill_bg(data_canvas, lv_color_hex(0x000000), LV_OPA_TRANSP);
+    lv_canvas_draw_rect(data_canvas, 4, 7, 2, 6, &dsc);
+    lv_canvas_draw_rect(data_canvas, 8, 5, 3, 10, &dsc);
+    lv_canvas_draw_rect(data_canvas, 14, 7, 2, 6, &dsc);
+    
+    // Flash only while active
+    if (state == DATA_ICON_ACTIVE) {
+        lv_timer_reset(data_flash_timer);
+        lv_timer_resume(data_flash_timer);
+    } else {
+        lv_timer_pause(data_flash_timer);
+        lv_obj_clear_flag(data_canvas, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+static void data_flash_timer_cb(lv_timer_t* timer) {
+    if (data_canvas == NULL) {
+        return;
+    }
+    if (lv_tick_elaps(last_activity_tick) > ACTIVITY_TIMEOUT_MS) {
+        draw_state(data_connected ? DATA_ICON_IDLE : DATA_ICON_DISCONNECTED);  // Activity stopped
+        return;
+    }
+    if (lv_obj_has_flag(data_canvas, LV_OBJ_FLAG_HIDDEN)) {
+        lv_obj_clear_flag(data_canvas, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_add_flag(data_canvas, LV_OBJ_FLAG_HIDDEN);
+    }
+}
 
 lv_obj_t* ui_data_icon_create(lv_obj_t* parent) {
     // Check if data icon exists and is still valid (has a valid parent)
-    if (data_container != NULL) {
-        lv_obj_t* current_parent = lv_obj_get_parent(data_container);
+    if (data_canvas != NULL) {
+        lv_obj_t* current_parent = lv_obj_get_parent(data_canvas);
         // Check if parent exists and matches the expected parent
         if (current_parent != NULL && current_parent == parent) {
             ESP_LOGI(TAG, "[Data Icon] Data icon already exists and is valid, returning existing container");
-            return data_container;
+            return data_canvas;
         }
         // Data icon was deleted (parent cleaned), reset state
         ESP_LOGW(TAG, "[Data Icon] Data icon exists but parent changed, resetting state");
-        data_container = NULL;
-        data_spark1 = NULL;
-        data_spark2 = NULL;
-        data_spark3 = NULL;
+        data_canvas = NULL;
     }
     
     if (parent == NULL) {
@@ -62,153 +124,71 @@ lv_obj_t* ui_data_icon_create(lv_obj_t* parent) {
     
     ESP_LOGI(TAG, "[Data Icon] Creating shared data icon component...");
     
-    // Create container for communication icon (20x20 pixels)
-    data_container = lv_obj_create(parent);
-    if (data_container == NULL) {
-        ESP_LOGE(TAG, "[Data Icon] ERROR: Failed to create data container!");
+    // One 20x20 canvas holds the sparks for the current state
+    data_canvas = lv_canvas_create(parent);
+    if (data_canvas == NULL) {
+        ESP_LOGE(TAG, "[Data Icon] ERROR: Failed to create data canvas!");
         return NULL;
     }
+    lv_canvas_set_buffer(data_canvas, data_canvas_buf, DATA_ICON_SIZE, DATA_ICON_SIZE, LV_IMG_CF_TRUE_COLOR_ALPHA);
+    lv_obj_align(data_canvas, LV_ALIGN_BOTTOM_RIGHT, -5, -5);
     
-    lv_obj_set_size(data_container, 20, 20);
-    lv_obj_align(data_container, LV_ALIGN_BOTTOM_RIGHT, -5, -5);
-    lv_obj_set_style_bg_opa(data_container, LV_OPA_TRANSP, 0);  // Transparent background
-    lv_obj_set_style_border_width(data_container, 0, 0);
-    lv_obj_set_style_pad_all(data_container, 0, 0);
-    lv_obj_clear_flag(data_container, LV_OBJ_FLAG_SCROLLABLE);
-    
-    // Create spark/pulse elements (zigzag pattern like electric pulse)
-    // Spark 1 (left, small)
-    data_spark1 = lv_obj_create(data_container);
-    lv_obj_set_size(data_spark1, 2, 6);
-    lv_obj_set_style_bg_opa(data_spark1, LV_OPA_COVER, 0);
-    lv_obj_set_style_bg_color(data_spark1, lv_color_hex(0x808080), 0);  // Gray initially (no activity)
-    lv_obj_set_style_border_width(data_spark1, 0, 0);
-    lv_obj_set_style_radius(data_spark1, 1, 0);
-    lv_obj_align(data_spark1, LV_ALIGN_LEFT_MID, 4, 0);
-    
-    // Spark 2 (center, medium) - main pulse
-    data_spark2 = lv_obj_create(data_container);
-    lv_obj_set_size(data_spark2, 3, 10);
-    lv_obj_set_style_bg_opa(data_spark2, LV_OPA_COVER, 0);
-    lv_obj_set_style_bg_color(data_spark2, lv_color_hex(0x808080), 0);  // Gray initially (no activity)
-    lv_obj_set_style_border_width(data_spark2, 0, 0);
-    lv_obj_set_style_radius(data_spark2, 1, 0);
-    lv_obj_align(data_spark2, LV_ALIGN_CENTER, 0, 0);
-    
-    // Spark 3 (right, small)
-    data_spark3 = lv_obj_create(data_container);
-    lv_obj_set_size(data_spark3, 2, 6);
-    lv_obj_set_style_bg_opa(data_spark3, LV_OPA_COVER, 0);
-    lv_obj_set_style_bg_color(data_spark3, lv_color_hex(0x808080), 0);  // Gray initially (no activity)
-    lv_obj_set_style_border_width(data_spark3, 0, 0);
-    lv_obj_set_style_radius(data_spark3, 1, 0);
-    lv_obj_align(data_spark3, LV_ALIGN_RIGHT_MID, -4, 0);
+    if (data_flash_timer == NULL) {
+        data_flash_timer = lv_timer_create(data_flash_timer_cb, FLASH_INTERVAL_MS, NULL);
+        lv_timer_pause(data_flash_timer);
+    }
     
-    // Don't call lv_timer_handler() during object creation to avoid dirty area errors
-    // The main loop will handle LVGL updates
+    // Red until the first update
+    drawn_state = DATA_ICON_NONE;
+    data_connected = false;
+    draw_state(DATA_ICON_DISCONNECTED);
     
     ESP_LOGI(TAG, "[Data Icon] Shared data icon component created successfully");
-    return data_container;
+    return data_canvas;
 }
 
 lv_obj_t* ui_data_icon_get_container() {
-    return data_container;
+    return data_canvas;
 }
 
 void ui_data_icon_set_active(bool active) {
-    data_active = active;
     if (active) {
-        last_activity_time = esp_timer_get_time() / 1000ULL;
+        last_activity_tick = lv_tick_get();
+    }
+    if (data_connected && active) {
+        draw_state(DATA_ICON_ACTIVE);
     }
 }
 
 void ui_data_icon_update(bool connected, bool active) {
-    if (data_container == NULL || data_spark1 == NULL || 
-        data_spark2 == NULL || data_spark3 == NULL) {
+    if (data_canvas == NULL) {
         return;  // Icon not created yet
     }
     
     // Check if container is still valid (has a valid parent)
-    lv_obj_t* parent = lv_obj_get_parent(data_container);
+    lv_obj_t* parent = lv_obj_get_parent(data_canvas);
     if (parent == NULL) {
         // Icon was deleted, reset state
         ESP_LOGW(TAG, "[Data Icon] Icon was deleted, resetting state");
-        data_container = NULL;
-        data_spark1 = NULL;
-        data_spark2 = NULL;
-        data_spark3 = NULL;
+        data_canvas = NULL;
         return;
     }
     
-    uint64_t now = esp_timer_get_time() / 1000ULL;
-    
-    // Update activity state
-    if (active) {
-        data_active = true;
-        last_activity_time = now;
-    } else {
-        // Check if activity timeout has passed
-        if (now - last_activity_time > ACTIVITY_TIMEOUT_MS) {
-            data_active = false;
-            flash_state = false;  // Reset flash state when activity stops
-        }
-    }
-    
-    // Flash animation when there's TCP/IP activity
-    if (data_active && connected) {
-        // Toggle flash state at regular intervals
-        if (now - last_flash_toggle >= FLASH_INTERVAL_MS) {
-            flash_state = !flash_state;
-            last_flash_toggle = now;
-        }
-    } else {
-        // No flashing when inactive or disconnected
-        flash_state = true;  // Always visible when not flashing
+    data_connected = connected;
+    if (!connected) {
+        draw_state(DATA_ICON_DISCONNECTED);
+    } else if (active) {
+        ui_data_icon_set_active(true);
+    } else if (drawn_state != DATA_ICON_ACTIVE) {
+        draw_state(DATA_ICON_IDLE);  // While active the flash timer handles the timeout
     }
-    
-    // Determine color based on connection and activity
-    lv_color_t icon_color;
-    if (connected) {
-        if (data_active) {
-            icon_color = lv_color_hex(0x00FF00);  // Green when active
-        } else {
-            icon_color = lv_color_hex(0x808080);  // Gray when connected but idle
-        }
-    } else {
-        icon_color = lv_color_hex(0xFF0000);  // Red when disconnected
-    }
-    
-    // Update spark colors
-    lv_obj_set_style_bg_color(data_spark1, icon_color, 0);
-    lv_obj_set_style_bg_color(data_spark2, icon_color, 0);
-    lv_obj_set_style_bg_color(data_spark3, icon_color, 0);
-    
-    // Set opacity based on flash state (flash on/off when active)
-    lv_opa_t opacity;
-    if (data_active && connected) {
-        // Flash animation: toggle between visible and hidden
-        opacity = flash_state ? LV_OPA_COVER : LV_OPA_TRANSP;
-    } else if (connected) {
-        // Connected but idle: show at reduced opacity
-        opacity = LV_OPA_60;
-    } else {
-        // Disconnected: show at full opacity (red)
-        opacity = LV_OPA_COVER;
-    }
-    
-    lv_obj_set_style_opa(data_spark1, opacity, 0);
-    lv_obj_set_style_opa(data_spark2, opacity, 0);
-    lv_obj_set_style_opa(data_spark3, opacity, 0);
-    
-    // Invalidate to trigger redraw
-    lv_obj_invalidate(data_container);
 }
 
 void ui_data_icon_cleanup() {
     // Note: We don't delete the data icon here because it's shared
     // The icon should persist across screen transitions
     // Only cleanup if we're completely shutting down the UI
-    if (data_container != NULL) {
+    if (data_canvas != NULL) {
         ESP_LOGI(TAG, "[Data Icon] Data icon cleanup called (icon persists for reuse)");
         // Icon will be cleaned up when parent screen is deleted
     }
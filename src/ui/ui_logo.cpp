@@ -13,8 +13,10 @@
 // Project headers
 #include "config.h"
 #include "ui/ui_logo.h"
+#include "utils/image_cache.h"
+#if ASSET_BUILTIN_LOGO_ENABLED
 #include "images/precision_pour_logo.h"
-#include "utils/rle_decompress.h"
+#endif
 
 // System/Standard library headers
 #include <lvgl.h>
@@ -26,6 +28,21 @@
 // Static logo object (shared across all screens)
 static lv_obj_t* logo_obj = NULL;
 static lv_obj_t* logo_container = NULL;
+static const lv_img_dsc_t* logo_img = NULL;  // Decoded once, held for the life of the UI
+
+bool ui_logo_get_image(asset_image_t* out) {
+    if (asset_store_get_image(ASSET_NAME_LOGO, out)) {
+        return true;
+    }
+#if ASSET_BUILTIN_LOGO_ENABLED
+    out->dsc = &precision_pour_logo;
+    out->is_compressed = PRECISION_POUR_LOGO_IS_COMPRESSED;
+    out->raw_size = PRECISION_POUR_LOGO_IS_COMPRESSED ? PRECISION_POUR_LOGO_UNCOMPRESSED_SIZE : precision_pour_logo.data_size;
+    return true;
+#else
+    return false;
+#endif
+}
 
 lv_obj_t* ui_logo_create(lv_obj_t* parent) {
     // Check if logo exists and is still valid (has a valid parent)
@@ -74,12 +91,11 @@ lv_obj_t* ui_logo_create(lv_obj_t* parent) {
         return NULL;
     }
     
-    // Get decompressed image (handles RLE compression if enabled)
-    const lv_img_dsc_t* logo_img = rle_get_image(
-        &precision_pour_logo,
-        PRECISION_POUR_LOGO_IS_COMPRESSED,
-        PRECISION_POUR_LOGO_IS_COMPRESSED ? PRECISION_POUR_LOGO_UNCOMPRESSED_SIZE : precision_pour_logo.data_size
-    );
+    // Get decoded image from the cache (handles RLE compression if enabled)
+    asset_image_t logo;
+    if (logo_img == NULL && ui_logo_get_image(&logo)) {
+        logo_img = image_cache_acquire(logo.dsc, logo.is_compressed, logo.raw_size);
+    }
     
     if (logo_img == NULL) {
         ESP_LOGE(TAG, "[Logo] ERROR: Failed to get logo image!");
@@ -0,0 +1,253 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * UI Task Implementation
+ * 
+ * Runs lv_timer_handler(), screen updates and queued UI commands on one
+ * pinned task. Wakes on queued commands, pour session changes, touch and
+ * LVGL's own timer deadlines.
+ */
+
+// Project headers
+#include "config.h"
+#include "ui/ui_task.h"
+#include "ui/screen_manager.h"
+#include "ui/base_screen.h"
+#include "ui/pouring_screen.h"
+#include "display/display_power.h"
+#include "display/lvgl_display.h"
+#include "display/lvgl_touch.h"
+#include "flow/pour_session.h"
+#include "system/app_events.h"
+#include "system/perf_monitor.h"
+#include "system/power_manager.h"
+
+// System/Standard library headers
+#include <lvgl.h>
+#include <string.h>
+
+// ESP-IDF framework headers
+#include <driver/gpio.h>
+#include <esp_log.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#if ENABLE_WATCHDOG
+#include <esp_task_wdt.h>
+#endif
+#define TAG "ui_task"
+
+// Give a full queue this long to drain before dropping a command
+#define UI_QUEUE_POST_TIMEOUT_MS 100
+
+// Events the UI task wakes on
+#define UI_TASK_EVENTS (APP_EVENT_UI | APP_EVENT_POUR | APP_EVENT_TOUCH)
+
+// Queued command (strings copied so the sender's buffers can go away)
+typedef struct {
+    ui_cmd_type_t type;
+    float cost;             // final cost (finished)
+    float volume_ml;        // final volume (finished)
+    uint8_t tap;            // tap shown (pouring) or finished (finished)
+    bool reset;             // restore the default calibration (touch calibration)
+    char currency[8];       // (finished)
+} ui_cmd_t;
+
+static QueueHandle_t ui_queue = NULL;
+static TaskHandle_t ui_task_handle = NULL;
+
+static void copy_string(char* dest, size_t size, const char* src) {
+    if (src == NULL) {
+        dest[0] = '\0';
+        return;
+    }
+    strncpy(dest, src, size - 1);
+    dest[size - 1] = '\0';
+}
+
+static bool ui_task_post(const ui_cmd_t* cmd) {
+    if (ui_queue == NULL) {
+        ESP_LOGW(TAG, "[UI Task] Command %d dropped - UI task not running", cmd->type);
+        return false;
+    }
+    if (xQueueSend(ui_queue, cmd, pdMS_TO_TICKS(UI_QUEUE_POST_TIMEOUT_MS)) != pdTRUE) {
+        ESP_LOGE(TAG, "[UI Task] Command %d dropped - queue full", cmd->type);
+        return false;
+    }
+    app_events_post(APP_EVENT_UI);
+    return true;
+}
+
+static void ui_task_handle_command(const ui_cmd_t* cmd) {
+    switch (cmd->type) {
+        case UI_CMD_SHOW_QR_CODE:
+            screen_manager_show_qr_code();
+            break;
+        case UI_CMD_SHOW_POURING:
+            screen_manager_show_pouring(cmd->tap);
+            break;
+        case UI_CMD_SHOW_FINISHED:
+            // A pour on a tap that is not on screen (or was cancelled from it) finishes silently
+            if (screen_manager_get_state() == SCREEN_POURING && pouring_screen_get_tap() == cmd->tap) {
+                screen_manager_show_finished(cmd->volume_ml, cmd->cost, cmd->currency);
+            }
+            break;
+        case UI_CMD_UPDATE:
+            // Screen updates run every iteration - waking is enough
+            break;
+        case UI_CMD_REFRESH_ICONS:
+            base_screen_refresh_network();
+            break;
+        case UI_CMD_TOUCH_CAL:
+            // Applied here so the calibration never changes under a touch read
+            if (cmd->reset) {
+                lvgl_touch_reset_calibration();
+            } else if (screen_manager_get_state() == SCREEN_POURING) {
+                ESP_LOGW(TAG, "[UI Task] Touch calibration refused - pour on screen");
+            } else {
+                screen_manager_show_touch_cal();
+            }
+            break;
+    }
+}
+
+static void ui_task(void* param) {
+    #if ENABLE_WATCHDOG
+    esp_task_wdt_add(NULL);
+    #endif
+    ESP_LOGI(TAG, "[UI Task] Running on core %d", xPortGetCoreID());
+    
+    while (1) {
+        #if ENABLE_WATCHDOG
+        esp_task_wdt_reset();
+        #endif
+
+        // Apply queued commands before rendering so a new screen is drawn this pass
+        ui_cmd_t cmd;
+        while (xQueueReceive(ui_queue, &cmd, 0) == pdTRUE) {
+            if (cmd.type != UI_CMD_UPDATE && cmd.type != UI_CMD_REFRESH_ICONS) {
+                display_power_activity();  // Screen change, e.g. a paid command
+            }
+            ui_task_handle_command(&cmd);
+            lvgl_display_boost();
+        }
+        
+        // Screen updates and transitions (pour progress, finished timeout, icons)
+        screen_manager_update();
+        
+        // Render - returns ms until the next LVGL timer is due. Nothing is
+        // rendered while the panel sleeps; invalidated areas wait for the wake.
+        uint32_t wait_ms = MAIN_LOOP_IDLE_MS;
+        bool pouring = (screen_manager_get_state() == SCREEN_POURING) || pour_session_any_active();
+        power_manager_hold(POWER_HOLD_POUR, pouring);  // Full speed for the pour
+        #if POWER_LIGHT_SLEEP_ENABLED
+        // Light sleep swallows the touch IRQ edge: a finger still down wakes the panel
+        if (display_power_is_asleep() && TOUCH_IRQ >= 0 && gpio_get_level((gpio_num_t)TOUCH_IRQ) == 0) {
+            display_power_activity();
+        }
+        #endif
+        if (display_power_update(pouring)) {
+            uint32_t render_start = perf_monitor_begin();
+            wait_ms = lv_timer_handler();
+            perf_monitor_end_us(PERF_RENDER_US, render_start);
+            
+            // Let the refresh timer sleep if nothing changed on screen
+            lvgl_display_pause_if_idle();
+        }
+        
+        if (wait_ms > MAIN_LOOP_IDLE_MS) {
+            wait_ms = MAIN_LOOP_IDLE_MS;
+        }
+        uint32_t events = app_events_wait(UI_TASK_EVENTS, wait_ms);
+        if ((events & APP_EVENT_TOUCH) && display_power_activity()) {
+            lvgl_touch_wake();  // A touch that wakes the display is not a press
+        }
+        if (events & (APP_EVENT_TOUCH | APP_EVENT_POUR)) {
+            lvgl_display_boost();  // Finger on the screen or a pour in progress
+        }
+    }
+}
+
+bool ui_task_start() {
+    if (ui_task_handle != NULL) {
+        return true;
+    }
+    
+    ui_queue = xQueueCreate(UI_QUEUE_LENGTH, sizeof(ui_cmd_t));
+    if (ui_queue == NULL) {
+        ESP_LOGE(TAG, "[UI Task] Failed to create command queue");
+        return false;
+    }
+    
+    BaseType_t ret = xTaskCreatePinnedToCore(
+        ui_task,
+        "ui",
+        UI_TASK_STACK_SIZE,
+        NULL,
+        UI_TASK_PRIORITY,
+        &ui_task_handle,
+        UI_TASK_CORE
+    );
+    if (ret != pdPASS) {
+        ui_task_handle = NULL;
+        vQueueDelete(ui_queue);
+        ui_queue = NULL;
+        ESP_LOGE(TAG, "[UI Task] Failed to create UI task");
+        return false;
+    }
+    
+    ESP_LOGI(TAG, "[UI Task] Started (core %d, priority %d, queue %d)", UI_TASK_CORE, UI_TASK_PRIORITY, UI_QUEUE_LENGTH);
+    return true;
+}
+
+bool ui_task_is_running() {
+    return ui_task_handle != NULL;
+}
+
+bool ui_task_show_qr_code() {
+    ui_cmd_t cmd = {};
+    cmd.type = UI_CMD_SHOW_QR_CODE;
+    return ui_task_post(&cmd);
+}
+
+bool ui_task_show_pouring(uint8_t tap) {
+    ui_cmd_t cmd = {};
+    cmd.type = UI_CMD_SHOW_POURING;
+    cmd.tap = tap;
+    return ui_task_post(&cmd);
+}
+
+bool ui_task_show_finished(uint8_t tap, float final_volume_ml, float final_cost, const char* currency) {
+    ui_cmd_t cmd = {};
+    cmd.type = UI_CMD_SHOW_FINISHED;
+    cmd.tap = tap;
+    cmd.volume_ml = final_volume_ml;
+    cmd.cost = final_cost;
+    copy_string(cmd.currency, sizeof(cmd.currency), currency);
+    return ui_task_post(&cmd);
+}
+
+bool ui_task_request_update() {
+    ui_cmd_t cmd = {};
+    cmd.type = UI_CMD_UPDATE;
+    return ui_task_post(&cmd);
+}
+
+bool ui_task_refresh_icons() {
+    ui_cmd_t cmd = {};
+    cmd.type = UI_CMD_REFRESH_ICONS;
+    return ui_task_post(&cmd);
+}
+
+bool ui_task_touch_calibration(bool reset) {
+    ui_cmd_t cmd = {};
+    cmd.type = UI_CMD_TOUCH_CAL;
+    cmd.reset = reset;
+    return ui_task_post(&cmd);
+}
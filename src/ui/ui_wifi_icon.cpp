@@ -8,6 +8,10 @@
 
 /**
  * Shared WiFi Icon Component Implementation
+ * 
+ * The icon is one canvas, redrawn only when the connection state or bar
+ * count changes. Flashing hides and shows the whole canvas from an lv_timer,
+ * so between state changes the icon costs no CPU and no panel traffic.
  */
 
 // Project headers
@@ -19,38 +23,71 @@
 
 // ESP-IDF framework headers
 #include <esp_log.h>
-#include <esp_timer.h>
 #define TAG "ui_wifi"
 
+#define WIFI_ICON_WIDTH 24
+#define WIFI_ICON_HEIGHT 20
+#define WIFI_BAR_COUNT 4
+
 // Static WiFi icon objects (shared across all screens)
-static lv_obj_t* wifi_container = NULL;
-static lv_obj_t* wifi_bar1 = NULL;
-static lv_obj_t* wifi_bar2 = NULL;
-static lv_obj_t* wifi_bar3 = NULL;
-static lv_obj_t* wifi_bar4 = NULL;
+static lv_obj_t* wifi_canvas = NULL;
+static uint8_t wifi_canvas_buf[LV_CANVAS_BUF_SIZE_TRUE_COLOR_ALPHA(WIFI_ICON_WIDTH, WIFI_ICON_HEIGHT)];
+static lv_timer_t* wifi_flash_timer = NULL;
 
-// WiFi icon state
+// WiFi icon state (-1 = not drawn yet)
+static int drawn_bars = -1;
+static bool drawn_connected = false;
 static bool wifi_flashing = false;
-static uint64_t last_wifi_flash_toggle = 0;
-static const uint64_t WIFI_FLASH_INTERVAL_MS = 2500;  // 2500ms on, 2500ms off = 5 second cycle
-static bool wifi_flash_state = false;  // Current flash state (true = visible, false = hidden)
+static const uint32_t WIFI_FLASH_INTERVAL_MS = 2500;  // 2500ms on, 2500ms off = 5 second cycle
+
+// Bar x offset and height, bottom aligned 1px above the canvas edge
+static const lv_coord_t bar_x[WIFI_BAR_COUNT] = { 5, 9, 13, 17 };
+static const lv_coord_t bar_h[WIFI_BAR_COUNT] = { 4, 7, 10, 13 };
+
+static void draw_icon(bool connected, int bars_to_show) {
+    // Green when connected, Red when disconnected
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.radius = 1;
+    dsc.border_width = 0;
+    dsc.bg_color = connected ? lv_color_hex(0x00FF00) : lv_color_hex(0xFF0000);
+    
+    lv_canvas_fill_bg(wifi_canvas, lv_color_hex(0x000000), LV_OPA_TRANSP);
+    for (int i = 0; i < WIFI_BAR_COUNT; i++) {
+        // Disconnected: all bars dimmed but visible. Connected: bars above the signal level dimmed
+        if (bars_to_show == 0) {
+            dsc.bg_opa = LV_OPA_40;
+        } else {
+            dsc.bg_opa = (i < bars_to_show) ? LV_OPA_COVER : LV_OPA_20;
+        }
+        lv_canvas_draw_rect(wifi_canvas, bar_x[i], WIFI_ICON_HEIGHT - 1 - bar_h[i], 3, bar_h[i], &dsc);
+    }
+    lv_obj_invalidate(wifi_canvas);
+}
+
+static void wifi_flash_timer_cb(lv_timer_t* timer) {
+    if (wifi_canvas == NULL) {
+        return;
+    }
+    if (lv_obj_has_flag(wifi_canvas, LV_OBJ_FLAG_HIDDEN)) {
+        lv_obj_clear_flag(wifi_canvas, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_add_flag(wifi_canvas, LV_OBJ_FLAG_HIDDEN);
+    }
+}
 
 lv_obj_t* ui_wifi_icon_create(lv_obj_t* parent) {
     // Check if WiFi icon exists and is still valid (has a valid parent)
-    if (wifi_container != NULL) {
-        lv_obj_t* current_parent = lv_obj_get_parent(wifi_container);
+    if (wifi_canvas != NULL) {
+        lv_obj_t* current_parent = lv_obj_get_parent(wifi_canvas);
         // Check if parent exists and matches the expected parent
         if (current_parent != NULL && current_parent == parent) {
             ESP_LOGI(TAG, "[WiFi Icon] WiFi icon already exists and is valid, returning existing container");
-            return wifi_container;
+            return wifi_canvas;
         }
         // WiFi icon was deleted (parent cleaned), reset state
         ESP_LOGW(TAG, "[WiFi Icon] WiFi icon exists but parent changed, resetting state");
-        wifi_container = NULL;
-        wifi_bar1 = NULL;
-        wifi_bar2 = NULL;
-        wifi_bar3 = NULL;
-        wifi_bar4 = NULL;
+        wifi_canvas = NULL;
     }
     
     if (parent == NULL) {
@@ -60,101 +97,65 @@ lv_obj_t* ui_wifi_icon_create(lv_obj_t* parent) {
     
     ESP_LOGI(TAG, "[WiFi Icon] Creating shared WiFi icon component...");
     
-    // Create container for WiFi icon (24x20 pixels to fit signal bars)
-    wifi_container = lv_obj_create(parent);
-    if (wifi_container == NULL) {
-        ESP_LOGE(TAG, "[WiFi Icon] ERROR: Failed to create WiFi container!");
+    // One 24x20 canvas holds the signal bars for the current state
+    wifi_canvas = lv_canvas_create(parent);
+    if (wifi_canvas == NULL) {
+        ESP_LOGE(TAG, "[WiFi Icon] ERROR: Failed to create WiFi canvas!");
         return NULL;
     }
+    lv_canvas_set_buffer(wifi_canvas, wifi_canvas_buf, WIFI_ICON_WIDTH, WIFI_ICON_HEIGHT, LV_IMG_CF_TRUE_COLOR_ALPHA);
+    lv_obj_align(wifi_canvas, LV_ALIGN_BOTTOM_LEFT, 5, -5);
     
-    lv_obj_set_size(wifi_container, 24, 20);
-    lv_obj_align(wifi_container, LV_ALIGN_BOTTOM_LEFT, 5, -5);
-    lv_obj_set_style_bg_opa(wifi_container, LV_OPA_TRANSP, 0);  // Transparent background
-    lv_obj_set_style_border_width(wifi_container, 0, 0);
-    lv_obj_set_style_pad_all(wifi_container, 0, 0);
-    lv_obj_clear_flag(wifi_container, LV_OBJ_FLAG_SCROLLABLE);
-    
-    // Create WiFi signal bars (4 bars of increasing height)
-    // Bar 1 (shortest) - 4px tall
-    wifi_bar1 = lv_obj_create(wifi_container);
-    lv_obj_set_size(wifi_bar1, 3, 4);
-    lv_obj_set_style_bg_opa(wifi_bar1, LV_OPA_COVER, 0);
-    lv_obj_set_style_bg_color(wifi_bar1, lv_color_hex(0xFF0000), 0);  // Red initially
-    lv_obj_set_style_border_width(wifi_bar1, 0, 0);
-    lv_obj_set_style_radius(wifi_bar1, 1, 0);
-    lv_obj_align(wifi_bar1, LV_ALIGN_BOTTOM_LEFT, 5, -1);
-    
-    // Bar 2 - 7px tall
-    wifi_bar2 = lv_obj_create(wifi_container);
-    lv_obj_set_size(wifi_bar2, 3, 7);
-    lv_obj_set_style_bg_opa(wifi_bar2, LV_OPA_COVER, 0);
-    lv_obj_set_style_bg_color(wifi_bar2, lv_color_hex(0xFF0000), 0);  // Red initially
-    lv_obj_set_style_border_width(wifi_bar2, 0, 0);
-    lv_obj_set_style_radius(wifi_bar2, 1, 0);
-    lv_obj_align(wifi_bar2, LV_ALIGN_BOTTOM_LEFT, 9, -1);
-    
-    // Bar 3 - 10px tall
-    wifi_bar3 = lv_obj_create(wifi_container);
-    lv_obj_set_size(wifi_bar3, 3, 10);
-    lv_obj_set_style_bg_opa(wifi_bar3, LV_OPA_COVER, 0);
-    lv_obj_set_style_bg_color(wifi_bar3, lv_color_hex(0xFF0000), 0);  // Red initially
-    lv_obj_set_style_border_width(wifi_bar3, 0, 0);
-    lv_obj_set_style_radius(wifi_bar3, 1, 0);
-    lv_obj_align(wifi_bar3, LV_ALIGN_BOTTOM_LEFT, 13, -1);
-    
-    // Bar 4 (tallest) - 13px tall
-    wifi_bar4 = lv_obj_create(wifi_container);
-    lv_obj_set_size(wifi_bar4, 3, 13);
-    lv_obj_set_style_bg_opa(wifi_bar4, LV_OPA_COVER, 0);
-    lv_obj_set_style_bg_color(wifi_bar4, lv_color_hex(0xFF0000), 0);  // Red initially
-    lv_obj_set_style_border_width(wifi_bar4, 0, 0);
-    lv_obj_set_style_radius(wifi_bar4, 1, 0);
-    lv_obj_align(wifi_bar4, LV_ALIGN_BOTTOM_LEFT, 17, -1);
+    // Red and dimmed until the first update
+    drawn_bars = 0;
+    drawn_connected = false;
+    draw_icon(false, 0);
     
-    // Don't call lv_timer_handler() during object creation to avoid dirty area errors
-    // The main loop will handle LVGL updates
+    if (wifi_flash_timer == NULL) {
+        wifi_flash_timer = lv_timer_create(wifi_flash_timer_cb, WIFI_FLASH_INTERVAL_MS, NULL);
+        lv_timer_pause(wifi_flash_timer);
+    }
+    wifi_flashing = false;
     
     ESP_LOGI(TAG, "[WiFi Icon] Shared WiFi icon component created successfully");
-    return wifi_container;
+    return wifi_canvas;
 }
 
 lv_obj_t* ui_wifi_icon_get_container() {
-    return wifi_container;
+    return wifi_canvas;
 }
 
 void ui_wifi_icon_set_flashing(bool flashing) {
+    if (flashing == wifi_flashing || wifi_flash_timer == NULL) {
+        return;
+    }
     wifi_flashing = flashing;
-    if (!flashing) {
-        // Reset flash state when disabling
-        wifi_flash_state = true;
-        last_wifi_flash_toggle = 0;
+    if (flashing) {
+        lv_timer_reset(wifi_flash_timer);
+        lv_timer_resume(wifi_flash_timer);
+    } else {
+        lv_timer_pause(wifi_flash_timer);
+        if (wifi_canvas != NULL) {
+            lv_obj_clear_flag(wifi_canvas, LV_OBJ_FLAG_HIDDEN);  // Always visible when not flashing
+        }
     }
 }
 
 void ui_wifi_icon_update(bool connected, int rssi, bool flashing) {
-    if (wifi_container == NULL || wifi_bar1 == NULL || wifi_bar2 == NULL || 
-        wifi_bar3 == NULL || wifi_bar4 == NULL) {
+    if (wifi_canvas == NULL) {
         return;  // Icon not created yet
     }
     
     // Check if container is still valid (has a valid parent)
-    lv_obj_t* parent = lv_obj_get_parent(wifi_container);
+    lv_obj_t* parent = lv_obj_get_parent(wifi_canvas);
     if (parent == NULL) {
         // Icon was deleted, reset state
         ESP_LOGW(TAG, "[WiFi Icon] Icon was deleted, resetting state");
-        wifi_container = NULL;
-        wifi_bar1 = NULL;
-        wifi_bar2 = NULL;
-        wifi_bar3 = NULL;
-        wifi_bar4 = NULL;
+        wifi_canvas = NULL;
         return;
     }
     
-    // Update flashing state
-    wifi_flashing = flashing;
-    
-    // Determine color: Green when connected, Red when disconnected
-    lv_color_t icon_color = connected ? lv_color_hex(0x00FF00) : lv_color_hex(0xFF0000);
+    ui_wifi_icon_set_flashing(flashing);
     
     // Determine number of bars to show based on signal strength
     // RSSI ranges: Excellent: >-50, Good: -50 to -60, Fair: -60 to -70, Weak: -70 to -80, Very Weak: <-80
@@ -166,71 +167,25 @@ void ui_wifi_icon_update(bool connected, int rssi, bool flashing) {
             bars_to_show = 3;  // Good signal - show 3 bars
         } else if (rssi > -70) {
             bars_to_show = 2;  // Fair signal - show 2 bars
-        } else if (rssi > -80) {
-            bars_to_show = 1;  // Weak signal - show 1 bar
         } else {
-            bars_to_show = 1;  // Very weak, but show at least 1 bar
+            bars_to_show = 1;  // Weak or very weak, but show at least 1 bar
         }
-    } else {
-        bars_to_show = 0;  // No bars when disconnected (but still show them dimmed)
     }
     
-    // Update bar colors
-    lv_obj_set_style_bg_color(wifi_bar1, icon_color, 0);
-    lv_obj_set_style_bg_color(wifi_bar2, icon_color, 0);
-    lv_obj_set_style_bg_color(wifi_bar3, icon_color, 0);
-    lv_obj_set_style_bg_color(wifi_bar4, icon_color, 0);
-    
-    // Handle flashing animation
-    uint64_t now = esp_timer_get_time() / 1000ULL;
-    lv_opa_t base_opacity = LV_OPA_COVER;
-    
-    if (wifi_flashing) {
-        // Toggle flash state every 2500ms (5 second cycle: 2.5s on, 2.5s off)
-        if (now - last_wifi_flash_toggle >= WIFI_FLASH_INTERVAL_MS) {
-            wifi_flash_state = !wifi_flash_state;
-            last_wifi_flash_toggle = now;
-        }
-        // Use flash state to control visibility (true = visible, false = hidden)
-        base_opacity = wifi_flash_state ? LV_OPA_COVER : LV_OPA_TRANSP;
-    } else {
-        // Reset flash state when not flashing
-        wifi_flash_state = true;
-        last_wifi_flash_toggle = 0;
-    }
-    
-    // Show/hide bars based on signal strength and flash state
-    // When disconnected (bars_to_show = 0), show all bars at 40% opacity so they're still visible
-    // When connected, show bars based on signal strength
-    if (bars_to_show == 0) {
-        // Disconnected - show all bars dimmed but visible
-        lv_opa_t disconnected_opacity = wifi_flashing ? base_opacity : (lv_opa_t)LV_OPA_40;
-        lv_obj_set_style_opa(wifi_bar1, disconnected_opacity, 0);
-        lv_obj_set_style_opa(wifi_bar2, disconnected_opacity, 0);
-        lv_obj_set_style_opa(wifi_bar3, disconnected_opacity, 0);
-        lv_obj_set_style_opa(wifi_bar4, disconnected_opacity, 0);
-    } else {
-        // Connected - show bars based on signal strength, with flash effect if needed
-        lv_opa_t bar1_opacity = (bars_to_show >= 1) ? base_opacity : (base_opacity * LV_OPA_20 / LV_OPA_COVER);
-        lv_opa_t bar2_opacity = (bars_to_show >= 2) ? base_opacity : (base_opacity * LV_OPA_20 / LV_OPA_COVER);
-        lv_opa_t bar3_opacity = (bars_to_show >= 3) ? base_opacity : (base_opacity * LV_OPA_20 / LV_OPA_COVER);
-        lv_opa_t bar4_opacity = (bars_to_show >= 4) ? base_opacity : (base_opacity * LV_OPA_20 / LV_OPA_COVER);
-        
-        lv_obj_set_style_opa(wifi_bar1, bar1_opacity, 0);
-        lv_obj_set_style_opa(wifi_bar2, bar2_opacity, 0);
-        lv_obj_set_style_opa(wifi_bar3, bar3_opacity, 0);
-        lv_obj_set_style_opa(wifi_bar4, bar4_opacity, 0);
+    // Redraw only when what the icon shows has changed
+    if (bars_to_show == drawn_bars && connected == drawn_connected) {
+        return;
     }
-    
-    // Invalidate to trigger redraw
-    lv_obj_invalidate(wifi_container);
+    drawn_bars = bars_to_show;
+    drawn_connected = connected;
+    draw_icon(connected, bars_to_show);
 }
 
 void ui_wifi_icon_cleanup() {
     // Note: We don't delete the WiFi icon here because it's shared
     // The icon should persist across screen transitions
     // Only cleanup if we're completely shutting down the UI
-    if (wifi_container != NULL) {
+    if (wifi_canvas != NULL) {
         ESP_LOGI(TAG, "[WiFi Icon] WiFi icon cleanup called (icon persists for reuse)");
         // Icon will be cleaned up when parent screen is deleted
     }
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Asset Store Implementation
+ * 
+ * Only the bundle itself is mapped (rounded up to MMU pages by
+ * esp_partition_mmap), not the whole partition. The mapping is never released.
+ */
+
+// Project headers
+#include "config.h"
+#include "utils/asset_store.h"
+
+#if ASSET_PARTITION_ENABLED
+
+#include "utils/asset_bundle.h"
+
+// System/Standard library headers
+#include <inttypes.h>
+#include <string.h>
+
+// ESP-IDF framework headers
+#include <esp_log.h>
+#include <esp_partition.h>
+#define TAG "assets"
+
+#define ASSET_PARTITION_NAME "assets"
+#define ASSET_PARTITION_SUBTYPE ((esp_partition_subtype_t)0x41)
+
+static const uint8_t* bundle = NULL;
+static lv_img_dsc_t descriptors[ASSET_BUNDLE_MAX_ENTRIES];  // Indexed like the bundle's entries
+
+bool asset_store_init() {
+    if (bundle != NULL) {
+        return true;
+    }
+    const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ASSET_PARTITION_SUBTYPE,
+                                                                ASSET_PARTITION_NAME);
+    if (partition == NULL) {
+        ESP_LOGW(TAG, "[Assets] No \"%s\" partition - using built-in images", ASSET_PARTITION_NAME);
+        return false;
+    }
+    
+    // Size the mapping from the header
+    asset_bundle_header_t header;
+    if (esp_partition_read(partition, 0, &header, sizeof(header)) != ESP_OK ||
+        header.magic != ASSET_BUNDLE_MAGIC || header.size > partition->size || header.size < sizeof(header)) {
+        ESP_LOGW(TAG, "[Assets] No asset bundle in the partition - using built-in images");
+        return false;
+    }
+    const void* mapped = NULL;
+    esp_partition_mmap_handle_t handle;
+    esp_err_t err = esp_partition_mmap(partition, 0, header.size, ESP_PARTITION_MMAP_DATA, &mapped, &handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "[Assets] Failed to map %" PRIu32 " bytes: %s", header.size, esp_err_to_name(err));
+        return false;
+    }
+    if (!asset_bundle_valid((const uint8_t*)mapped, header.size)) {
+        ESP_LOGE(TAG, "[Assets] Asset bundle is corrupt - using built-in images");
+        esp_partition_munmap(handle);
+        return false;
+    }
+    
+    const asset_entry_t* entries = asset_bundle_entries((const uint8_t*)mapped);
+    for (uint16_t i = 0; i < header.count; i++) {
+        const asset_entry_t* e = &entries[i];
+        lv_img_dsc_t* dsc = &descriptors[i];
+        memset(dsc, 0, sizeof(*dsc));
+        dsc->header.cf = e->cf;
+        dsc->header.w = e->width;
+        dsc->header.h = e->height;
+        dsc->data_size = e->size;
+        dsc->data = (const uint8_t*)mapped + e->offset;
+    }
+    bundle = (const uint8_t*)mapped;
+    ESP_LOGI(TAG, "[Assets] %u assets, %" PRIu32 " bytes mapped from flash", (unsigned)header.count, header.size);
+    return true;
+}
+
+bool asset_store_get_image(const char* name, asset_image_t* out) {
+    if (bundle == NULL) {
+        return false;
+    }
+    const asset_entry_t* e = asset_bundle_find(bundle, name);
+    if (e == NULL) {
+        return false;
+    }
+    // Pixels must already be in the byte order LVGL renders in
+    if (e->cf == LV_IMG_CF_TRUE_COLOR && ((e->flags & ASSET_FLAG_SWAP16) != 0) != (LV_COLOR_16_SWAP != 0)) {
+        ESP_LOGE(TAG, "[Assets] \"%s\" byte order does not match LV_COLOR_16_SWAP - rebuild the bundle", name);
+        return false;
+    }
+    out->dsc = &descriptors[e - asset_bundle_entries(bundle)];
+    out->is_compressed = (e->flags & ASSET_FLAG_RLE) != 0;
+    out->raw_size = e->raw_size;
+    return true;
+}
+
+#endif // ASSET_PARTITION_ENABLED
@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * Decoded Image Cache Implementation
+ */
+
+// Project headers
+#include "config.h"
+#include "utils/image_cache.h"
+#include "utils/rle_decompress.h"
+
+// System/Standard library headers
+#include <inttypes.h>
+#include <string.h>
+
+// ESP-IDF framework headers
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+#include <lvgl.h>
+#define TAG "img_cache"
+
+#define IMAGE_CACHE_ENTRIES 8
+#define IMAGE_CACHE_BUDGET_BYTES ((size_t)IMAGE_CACHE_BUDGET_KB * 1024U)
+
+typedef struct {
+    const lv_img_dsc_t* src;   // Key: compressed source descriptor (NULL = free slot)
+    lv_img_dsc_t dsc;          // Stable decoded descriptor handed to LVGL
+    uint8_t* data;
+    size_t size;
+    uint32_t refs;             // Users holding this image
+    uint32_t last_used;        // LRU stamp
+} image_cache_entry_t;
+
+static image_cache_entry_t entries[IMAGE_CACHE_ENTRIES];
+static size_t used_bytes = 0;
+static uint32_t use_clock = 0;
+
+static uint8_t* alloc_image(size_t size) {
+#ifdef BOARD_HAS_PSRAM
+    uint8_t* data = (uint8_t*)heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (data != NULL) {
+        return data;
+    }
+#endif
+    return (uint8_t*)heap_caps_malloc(size, MALLOC_CAP_8BIT);
+}
+
+static void free_entry(image_cache_entry_t* entry) {
+    // Drop LVGL's decoder cache entry before the pixels go away
+    lv_img_cache_invalidate_src(&entry->dsc);
+    heap_caps_free(entry->data);
+    used_bytes -= entry->size;
+    memset(entry, 0, sizeof(*entry));
+}
+
+static image_cache_entry_t* find_entry(const lv_img_dsc_t* src) {
+    for (int i = 0; i < IMAGE_CACHE_ENTRIES; i++) {
+        if (entries[i].src == src) {
+            return &entries[i];
+        }
+    }
+    return NULL;
+}
+
+// Least recently used image that nobody holds
+static image_cache_entry_t* find_victim() {
+    image_cache_entry_t* victim = NULL;
+    for (int i = 0; i < IMAGE_CACHE_ENTRIES; i++) {
+        image_cache_entry_t* entry = &entries[i];
+        if (entry->src != NULL && entry->refs == 0 &&
+            (victim == NULL || (int32_t)(entry->last_used - victim->last_used) < 0)) {
+            victim = entry;
+        }
+    }
+    return victim;
+}
+
+// Evict until size fits in the budget and a slot is free
+static image_cache_entry_t* make_room(size_t size) {
+    for (;;) {
+        image_cache_entry_t* slot = find_entry(NULL);
+        if (slot != NULL && used_bytes + size <= IMAGE_CACHE_BUDGET_BYTES) {
+            return slot;
+        }
+        image_cache_entry_t* victim = find_victim();
+        if (victim == NULL) {
+            // Everything cached is on screen - go over budget rather than fail to draw
+            if (slot != NULL) {
+                ESP_LOGW(TAG, "[Image Cache] Over budget: %zu + %zu > %zu bytes", used_bytes, size, IMAGE_CACHE_BUDGET_BYTES);
+            }
+            return slot;
+        }
+        ESP_LOGI(TAG, "[Image Cache] Evicting %p (%zu bytes)", victim->src, victim->size);
+        free_entry(victim);
+    }
+}
+
+const lv_img_dsc_t* image_cache_acquire(const lv_img_dsc_t* src, int is_compressed, size_t uncompressed_size) {
+    if (src == NULL || src->data == NULL) {
+        ESP_LOGE(TAG, "[Image Cache] Invalid image: NULL pointer");
+        return NULL;
+    }
+    if (!is_compressed) {
+        return src;
+    }
+    
+    image_cache_entry_t* entry = find_entry(src);
+    if (entry != NULL) {
+        entry->refs++;
+        entry->last_used = ++use_clock;
+        return &entry->dsc;
+    }
+    
+    entry = make_room(uncompressed_size);
+    if (entry == NULL) {
+        ESP_LOGE(TAG, "[Image Cache] No free slot (%d images in use)", IMAGE_CACHE_ENTRIES);
+        return NULL;
+    }
+    
+    uint8_t* data = alloc_image(uncompressed_size);
+    if (data == NULL) {
+        ESP_LOGE(TAG, "[Image Cache] Failed to allocate %zu bytes", uncompressed_size);
+        return NULL;
+    }
+    if (rle_decompress(src->data, src->data_size, data, uncompressed_size) != 0) {
+        ESP_LOGE(TAG, "[Image Cache] Failed to decompress image %p", src);
+        heap_caps_free(data);
+        return NULL;
+    }
+    
+    entry->src = src;
+    entry->data = data;
+    entry->size = uncompressed_size;
+    entry->refs = 1;
+    entry->last_used = ++use_clock;
+    entry->dsc.header.cf = src->header.cf;
+    entry->dsc.header.w = src->header.w;
+    entry->dsc.header.h = src->header.h;
+    entry->dsc.header.always_zero = 0;
+    entry->dsc.header.reserved = 0;
+    entry->dsc.data_size = uncompressed_size;
+    entry->dsc.data = data;
+    used_bytes += uncompressed_size;
+    
+    ESP_LOGI(TAG, "[Image Cache] Decoded %p: %" PRIu32 " -> %zu bytes (%zu/%zu bytes used)",
+             src, src->data_size, uncompressed_size, used_bytes, IMAGE_CACHE_BUDGET_BYTES);
+    return &entry->dsc;
+}
+
+void image_cache_release(const lv_img_dsc_t* src) {
+    image_cache_entry_t* entry = src != NULL ? find_entry(src) : NULL;
+    if (entry != NULL && entry->refs > 0) {
+        entry->refs--;
+    }
+}
+
+void image_cache_flush(void) {
+    for (int i = 0; i < IMAGE_CACHE_ENTRIES; i++) {
+        if (entries[i].src != NULL && entries[i].refs == 0) {
+            free_entry(&entries[i]);
+        }
+    }
+}
+
+size_t image_cache_get_used_bytes(void) {
+    return used_bytes;
+}
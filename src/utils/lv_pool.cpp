@@ -0,0 +1,249 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Proprietary and confidential software.
+ * See LICENSE file for full license terms.
+ */
+
+/**
+ * LVGL Pool Allocator Implementation
+ * 
+ * The arena is one contiguous block with the classes laid out smallest first,
+ * so a pointer's class is found by comparing it against the region ends and
+ * free blocks are linked through their own first word. There is no per-block
+ * header, so a 12-byte allocation costs 16 bytes instead of 12 plus heap overhead.
+ */
+
+// Project headers
+#include "config.h"
+#include "utils/lv_pool.h"
+
+// System/Standard library headers
+#include <inttypes.h>
+#include <string.h>
+
+// ESP-IDF framework headers
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+#include <freertos/FreeRTOS.h>
+#define TAG "lv_pool"
+
+static const uint16_t class_sizes[LV_POOL_CLASS_COUNT] = { 16, 32, 64, 128, 256, 512 };
+
+typedef struct free_block {
+    struct free_block* next;
+} free_block_t;
+
+typedef struct {
+    uint8_t* start;
+    uint8_t* end;
+    free_block_t* free_list;
+    uint16_t blocks;
+    uint16_t in_use;
+    uint16_t high_water;
+} pool_class_t;
+
+static pool_class_t classes[LV_POOL_CLASS_COUNT];
+static uint8_t* arena_start = NULL;
+static uint8_t* arena_end = NULL;
+
+static uint32_t borrowed = 0;
+static uint32_t heap_allocs = 0;
+static uint32_t heap_live = 0;
+static uint32_t heap_high_water = 0;
+
+static portMUX_TYPE pool_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// Class a pool pointer belongs to, -1 for heap blocks
+static inline int class_of(const void* ptr) {
+    const uint8_t* p = (const uint8_t*)ptr;
+    if (p < arena_start || p >= arena_end) {
+        return -1;
+    }
+    for (int i = 0; i < LV_POOL_CLASS_COUNT; i++) {
+        if (p < classes[i].end) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void* heap_alloc(size_t size) {
+    void* ptr = NULL;
+#ifdef BOARD_HAS_PSRAM
+    if (LVGL_POOL_PSRAM_MIN_BYTES > 0 && size >= LVGL_POOL_PSRAM_MIN_BYTES) {
+        ptr = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+#endif
+    if (ptr == NULL) {
+        ptr = heap_caps_malloc(size, MALLOC_CAP_8BIT);
+    }
+    if (ptr != NULL) {
+        portENTER_CRITICAL(&pool_mux);
+        heap_allocs++;
+        heap_live++;
+        if (heap_live > heap_high_water) {
+            heap_high_water = heap_live;
+        }
+        portEXIT_CRITICAL(&pool_mux);
+    }
+    return ptr;
+}
+
+int lv_pool_init(void) {
+#if LVGL_POOL_ENABLED
+    if (arena_start != NULL) {
+        return 0;
+    }
+    
+    // Equal bytes per class: many small blocks, few large ones
+    size_t class_bytes = (size_t)LVGL_POOL_KB * 1024U / LV_POOL_CLASS_COUNT;
+    size_t total = 0;
+    uint16_t counts[LV_POOL_CLASS_COUNT];
+    for (int i = 0; i < LV_POOL_CLASS_COUNT; i++) {
+        counts[i] = (uint16_t)(class_bytes / class_sizes[i]);
+        total += (size_t)counts[i] * class_sizes[i];
+    }
+    
+    // Internal RAM: LVGL walks these objects on every render
+    arena_start = (uint8_t*)heap_caps_aligned_alloc(8, total, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (arena_start == NULL) {
+        ESP_LOGE(TAG, "[LVGL Pool] Failed to allocate %u byte arena, using the heap", (unsigned)total);
+        return -1;
+    }
+    arena_end = arena_start + total;
+    
+    uint8_t* p = arena_start;
+    for (int i = 0; i < LV_POOL_CLASS_COUNT; i++) {
+        pool_class_t* c = &classes[i];
+        c->start = p;
+        c->blocks = counts[i];
+        c->free_list = NULL;
+        // Thread the free list back to front so the first allocations come from the start
+        for (int b = counts[i] - 1; b >= 0; b--) {
+            free_block_t* block = (free_block_t*)(p + (size_t)b * class_sizes[i]);
+            block->next = c->free_list;
+            c->free_list = block;
+        }
+        p += (size_t)counts[i] * class_sizes[i];
+        c->end = p;
+    }
+    
+    ESP_LOGI(TAG, "[LVGL Pool] %u byte arena, %u x16 .. %u x512 blocks",
+             (unsigned)total, (unsigned)counts[0], (unsigned)counts[LV_POOL_CLASS_COUNT - 1]);
+#endif
+    return 0;
+}
+
+void* lv_pool_alloc(size_t size) {
+    if (arena_start != NULL && size <= class_sizes[LV_POOL_CLASS_COUNT - 1]) {
+        int first = 0;
+        while (class_sizes[first] < size) {
+            first++;
+        }
+        
+        portENTER_CRITICAL(&pool_mux);
+        for (int i = first; i < LV_POOL_CLASS_COUNT; i++) {
+            pool_class_t* c = &classes[i];
+            free_block_t* block = c->free_list;
+            if (block != NULL) {
+                c->free_list = block->next;
+                c->in_use++;
+                if (c->in_use > c->high_water) {
+                    c->high_water = c->in_use;
+                }
+                if (i != first) {
+                    borrowed++;
+                }
+                portEXIT_CRITICAL(&pool_mux);
+                return block;
+            }
+        }
+        portEXIT_CRITICAL(&pool_mux);
+    }
+    return heap_alloc(size);
+}
+
+void lv_pool_free(void* ptr) {
+    if (ptr == NULL) {
+        return;
+    }
+    
+    int cls = class_of(ptr);
+    if (cls < 0) {
+        heap_caps_free(ptr);
+        portENTER_CRITICAL(&pool_mux);
+        heap_live--;
+        portEXIT_CRITICAL(&pool_mux);
+        return;
+    }
+    
+    pool_class_t* c = &classes[cls];
+    free_block_t* block = (free_block_t*)ptr;
+    portENTER_CRITICAL(&pool_mux);
+    block->next = c->free_list;
+    c->free_list = block;
+    c->in_use--;
+    portEXIT_CRITICAL(&pool_mux);
+}
+
+void* lv_pool_realloc(void* ptr, size_t size) {
+    if (ptr == NULL) {
+        return lv_pool_alloc(size);
+    }
+    
+    int cls = class_of(ptr);
+    if (cls < 0) {
+        // Heap blocks stay on the heap (their old size is not known here)
+        return heap_caps_realloc(ptr, size, MALLOC_CAP_8BIT);
+    }
+    if (size <= class_sizes[cls]) {
+        return ptr;  // Still fits (label text edits usually do)
+    }
+    
+    void* grown = lv_pool_alloc(size);
+    if (grown != NULL) {
+        memcpy(grown, ptr, class_sizes[cls]);
+        lv_pool_free(ptr);
+    }
+    return grown;
+}
+
+void lv_pool_get_stats(lv_pool_stats_t* stats) {
+    memset(stats, 0, sizeof(*stats));
+    
+    portENTER_CRITICAL(&pool_mux);
+    for (int i = 0; i < LV_POOL_CLASS_COUNT; i++) {
+        stats->classes[i].block_size = class_sizes[i];
+        stats->classes[i].blocks = classes[i].blocks;
+        stats->classes[i].in_use = classes[i].in_use;
+        stats->classes[i].high_water = classes[i].high_water;
+    }
+    stats->borrowed = borrowed;
+    stats->heap_allocs = heap_allocs;
+    stats->heap_live = heap_live;
+    stats->heap_high_water = heap_high_water;
+    portEXIT_CRITICAL(&pool_mux);
+    
+    stats->internal_free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    stats->internal_largest_block = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    stats->fragmentation_pct = stats->internal_free > 0
+        ? (uint32_t)(100 - stats->internal_largest_block * 100 / stats->internal_free) : 0;
+}
+
+void lv_pool_log_report(void) {
+    static lv_pool_stats_t stats;
+    lv_pool_get_stats(&stats);
+    
+    ESP_LOGI(TAG, "[LVGL Pool] %6s %6s %6s %6s", "size", "blocks", "used", "peak");
+    for (int i = 0; i < LV_POOL_CLASS_COUNT; i++) {
+        const lv_pool_class_stats_t* c = &stats.classes[i];
+        ESP_LOGI(TAG, "[LVGL Pool] %6u %6u %6u %6u",
+                 (unsigned)c->block_size, (unsigned)c->blocks, (unsigned)c->in_use, (unsigned)c->high_water);
+    }
+    ESP_LOGI(TAG, "[LVGL Pool] Borrowed %" PRIu32 ", heap allocs %" PRIu32 ", heap live %" PRIu32 " (peak %" PRIu32 ")",
+             stats.borrowed, stats.heap_allocs, stats.heap_live, stats.heap_high_water);
+    ESP_LOGI(TAG, "[LVGL Pool] Internal heap %u free, largest block %u (%" PRIu32 "%% fragmented)",
+             (unsigned)stats.internal_free, (unsigned)stats.internal_largest_block, stats.fragmentation_pct);
+}
@@ -3,6 +3,8 @@
  */
 
 #include "utils/rle_decompress.h"
+#include "utils/image_cache.h"
+#include "utils/rle_decode.h"
 #include "esp_log.h"
 #include <string.h>
 #include <stdlib.h>
@@ -17,53 +19,16 @@ int rle_decompress(const uint8_t* compressed_data, size_t compressed_size,
         return -1;
     }
     
-    size_t output_pos = 0;
     size_t input_pos = 0;
+    long written = rle_decode(compressed_data, compressed_size, output_buffer, output_size, &input_pos);
     
-    while (input_pos < compressed_size && output_pos < output_size) {
-        if (compressed_data[input_pos] == 0xFF) {
-            if (input_pos + 1 < compressed_size && compressed_data[input_pos + 1] == 0x00) {
-                // Escaped literal 0xFF
-                if (output_pos >= output_size) {
-                    ESP_LOGE(TAG, "Output buffer overflow (escaped 0xFF)");
-                    return -1;
-                }
-                output_buffer[output_pos++] = 0xFF;
-                input_pos += 2;
-            } else if (input_pos + 2 < compressed_size) {
-                // RLE sequence: 0xFF, count, value
-                uint8_t count = compressed_data[input_pos + 1];
-                uint8_t value = compressed_data[input_pos + 2];
-                
-                if (output_pos + count > output_size) {
-                    ESP_LOGE(TAG, "Output buffer overflow (RLE run: %d bytes)", count);
-                    return -1;
-                }
-                
-                // Write the run
-                memset(&output_buffer[output_pos], value, count);
-                output_pos += count;
-                input_pos += 3;
-            } else {
-                // Malformed, treat as literal
-                if (output_pos >= output_size) {
-                    ESP_LOGE(TAG, "Output buffer overflow (malformed)");
-                    return -1;
-                }
-                output_buffer[output_pos++] = compressed_data[input_pos++];
-            }
-        } else {
-            // Literal byte
-            if (output_pos >= output_size) {
-                ESP_LOGE(TAG, "Output buffer overflow (literal)");
-                return -1;
-            }
-            output_buffer[output_pos++] = compressed_data[input_pos++];
-        }
+    if (written < 0) {
+        ESP_LOGE(TAG, "Output buffer overflow (RLE run at input offset %zu)", input_pos);
+        return -1;
     }
     
-    if (output_pos != output_size) {
-        ESP_LOGE(TAG, "Decompression size mismatch: expected %zu, got %zu", output_size, output_pos);
+    if ((size_t)written != output_size) {
+        ESP_LOGE(TAG, "Decompression size mismatch: expected %zu, got %ld", output_size, written);
         return -1;
     }
     
@@ -75,66 +40,8 @@ int rle_decompress(const uint8_t* compressed_data, size_t compressed_size,
 }
 
 const lv_img_dsc_t* rle_decompress_image(const lv_img_dsc_t* compressed_img, size_t uncompressed_size) {
-    if (compressed_img == NULL) {
-        ESP_LOGE(TAG, "Invalid compressed image: NULL pointer");
-        return NULL;
-    }
-    
-    if (compressed_img->data == NULL) {
-        ESP_LOGE(TAG, "Invalid compressed image: NULL data pointer");
-        return NULL;
-    }
-    
-    // Allocate buffer dynamically based on actual image size
-    // This avoids wasting RAM for large static buffers
-    // For the logo (259x40), this is only 20,720 bytes instead of 153,600 bytes
-    static uint8_t* decompressed_buffer = NULL;
-    static size_t buffer_size = 0;
-    static lv_img_dsc_t decompressed_img;
-    
-    // Reallocate buffer if needed (grow only, never shrink to avoid fragmentation)
-    if (decompressed_buffer == NULL || buffer_size < uncompressed_size) {
-        if (decompressed_buffer != NULL) {
-            free(decompressed_buffer);
-        }
-        decompressed_buffer = (uint8_t*)malloc(uncompressed_size);
-        if (decompressed_buffer == NULL) {
-            ESP_LOGE(TAG, "Failed to allocate %zu bytes for decompressed image", uncompressed_size);
-            return NULL;
-        }
-        buffer_size = uncompressed_size;
-        ESP_LOGI(TAG, "Allocated %zu bytes (%.1f KB) for decompressed image buffer", 
-                 uncompressed_size, uncompressed_size / 1024.0);
-    }
-    
-    // Decompress the data
-    int result = rle_decompress(
-        compressed_img->data,
-        compressed_img->data_size,
-        decompressed_buffer,
-        uncompressed_size
-    );
-    
-    if (result != 0) {
-        ESP_LOGE(TAG, "Failed to decompress image data");
-        return NULL;
-    }
-    
-    // Create decompressed image descriptor
-    decompressed_img.header.cf = compressed_img->header.cf;
-    decompressed_img.header.w = compressed_img->header.w;
-    decompressed_img.header.h = compressed_img->header.h;
-    decompressed_img.header.always_zero = 0;
-    decompressed_img.header.reserved = 0;
-    decompressed_img.data_size = uncompressed_size;
-    decompressed_img.data = decompressed_buffer;
-    
-    ESP_LOGI(TAG, "Decompressed image: %zu bytes -> %zu bytes (%.1f%% reduction, %.1f KB RAM)",
-             compressed_img->data_size, uncompressed_size,
-             (1.0 - (float)compressed_img->data_size / uncompressed_size) * 100.0,
-             uncompressed_size / 1024.0);
-    
-    return &decompressed_img;
+    // Decoded once into the image cache, each image in its own buffer
+    return image_cache_acquire(compressed_img, 1, uncompressed_size);
 }
 
 // Structure to hold streaming decompression state
@@ -221,21 +128,7 @@ static int rle_stream_decompress_to(rle_stream_ctx_t* ctx, uint8_t* output_buffe
 }
 
 const lv_img_dsc_t* rle_get_image(const lv_img_dsc_t* img, int is_compressed, size_t uncompressed_size) {
-    if (img == NULL) {
-        ESP_LOGE(TAG, "Invalid image: NULL pointer");
-        return NULL;
-    }
-    
-    if (is_compressed) {
-        // Decompress the full image
-        // Note: True line-by-line decompression would require a custom LVGL decoder
-        // which is more complex. For the logo (20KB), full decompression is acceptable.
-        // The buffer is allocated dynamically and only uses the exact size needed.
-        return rle_decompress_image(img, uncompressed_size);
-    } else {
-        // Image is not compressed, return as-is
-        return img;
-    }
+    return image_cache_acquire(img, is_compressed, uncompressed_size);
 }
 
 int rle_decompress_region(const uint8_t* compressed_data, size_t compressed_size,
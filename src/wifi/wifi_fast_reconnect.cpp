@@ -0,0 +1,265 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * WiFi Fast Reconnect Implementation
+ * 
+ * The lease age is known from esp_timer for leases obtained during this boot,
+ * and from the wall clock for leases restored from NVS. After a power cycle
+ * the clock is not set until NTP syncs, so only the BSSID/channel pin is used
+ * on the first connect.
+ */
+
+#include "config.h"
+#include "wifi/wifi_fast_reconnect.h"
+#include "utils/wire_utils.h"
+
+#if WIFI_FAST_RECONNECT_ENABLED
+
+// System/Standard library headers
+#include <cstddef>
+#include <cstring>
+#include <time.h>
+
+// ESP-IDF framework headers
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <nvs.h>
+#define TAG "wifi_fast"
+
+#define FAST_NVS_NAMESPACE "wifi_fast"
+#define FAST_NVS_KEY_CACHE "cache"
+
+#define FAST_MAX_ATTEMPTS 3                // Pinned reconnects before falling back to a scan
+
+typedef struct {
+    char ssid[33];
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint32_t ip;              // esp_ip4_addr_t.addr (network byte order)
+    uint32_t netmask;
+    uint32_t gw;
+    uint32_t dns;
+    int64_t obtained_epoch;   // Wall clock (s) when the lease was obtained, 0 if unknown
+} fast_cache_t;
+
+static esp_netif_t* sta_netif = NULL;
+static fast_cache_t cache = {};
+static bool cache_valid = false;
+static int64_t lease_obtained_ms = -1;  // esp_timer time of a lease obtained this boot
+static bool lease_in_use = false;
+static uint8_t fast_attempts = 0;
+
+static int64_t now_ms() {
+    return esp_timer_get_time() / 1000LL;
+}
+
+// Lease age in seconds, -1 if unknown
+static int64_t lease_age_sec() {
+    if (lease_obtained_ms >= 0) {
+        return (now_ms() - lease_obtained_ms) / 1000LL;
+    }
+    int64_t now = wall_clock_now();
+    if (cache.obtained_epoch > 0 && now > 0) {
+        return now - cache.obtained_epoch;
+    }
+    return -1;
+}
+
+static bool lease_valid() {
+    if (WIFI_LEASE_REUSE_SEC == 0 || !cache_valid || cache.ip == 0) {
+        return false;
+    }
+    int64_t age = lease_age_sec();
+    return age >= 0 && age < WIFI_LEASE_REUSE_SEC;
+}
+
+static void save_cache() {
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open(FAST_NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "[WiFi Fast] Failed to open NVS: %s", esp_err_to_name(err));
+        return;
+    }
+    err = nvs_set_blob(handle, FAST_NVS_KEY_CACHE, &cache, sizeof(cache));
+    if (err == ESP_OK) {
+        err = nvs_commit(handle);
+    }
+    nvs_close(handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "[WiFi Fast] Failed to save cache: %s", esp_err_to_name(err));
+    }
+}
+
+// Give the address back to DHCP
+static void release_lease() {
+    if (!lease_in_use) {
+        return;
+    }
+    lease_in_use = false;
+    esp_err_t err = esp_netif_dhcpc_start(sta_netif);
+    if (err != ESP_OK && err != ESP_ERR_ESP_NETIF_DHCP_ALREADY_STARTED) {
+        ESP_LOGE(TAG, "[WiFi Fast] Failed to restart DHCP: %s", esp_err_to_name(err));
+    }
+}
+
+// Drop the BSSID/channel pin and the lease until the next successful connect
+static void forget_ap() {
+    fast_attempts = FAST_MAX_ATTEMPTS + 1;
+    release_lease();
+    
+    wifi_config_t config = {};
+    if (esp_wifi_get_config(WIFI_IF_STA, &config) == ESP_OK && config.sta.bssid_set) {
+        config.sta.bssid_set = false;
+        config.sta.channel = 0;
+        esp_wifi_set_config(WIFI_IF_STA, &config);
+    }
+}
+
+void wifi_fast_init(esp_netif_t* netif) {
+    sta_netif = netif;
+    
+    nvs_handle_t handle;
+    if (nvs_open(FAST_NVS_NAMESPACE, NVS_READONLY, &handle) != ESP_OK) {
+        return;  // Nothing cached yet
+    }
+    size_t size = sizeof(cache);
+    cache_valid = nvs_get_blob(handle, FAST_NVS_KEY_CACHE, &cache, &size) == ESP_OK && size == sizeof(cache) &&
+                  cache.channel != 0;
+    nvs_close(handle);
+    
+    if (cache_valid) {
+        cache.ssid[sizeof(cache.ssid) - 1] = '\0';
+        ESP_LOGI(TAG, "[WiFi Fast] Cached AP %02X:%02X:%02X:%02X:%02X:%02X on channel %d for '%s'",
+                 cache.bssid[0], cache.bssid[1], cache.bssid[2], cache.bssid[3], cache.bssid[4], cache.bssid[5],
+                 cache.channel, cache.ssid);
+    } else {
+        memset(&cache, 0, sizeof(cache));
+    }
+}
+
+void wifi_fast_apply_config(wifi_config_t* config) {
+    if (!cache_valid || fast_attempts > FAST_MAX_ATTEMPTS ||
+        strncmp((const char*)config->sta.ssid, cache.ssid, sizeof(config->sta.ssid)) != 0) {
+        config->sta.bssid_set = false;
+        config->sta.channel = 0;
+        return;
+    }
+    config->sta.bssid_set = true;
+    memcpy(config->sta.bssid, cache.bssid, sizeof(cache.bssid));
+    config->sta.channel = cache.channel;
+}
+
+bool wifi_fast_apply_lease() {
+    if (lease_in_use) {
+        return true;
+    }
+    if (!lease_valid() || fast_attempts > FAST_MAX_ATTEMPTS) {
+        return false;
+    }
+    
+    esp_err_t err = esp_netif_dhcpc_stop(sta_netif);
+    if (err != ESP_OK && err != ESP_ERR_ESP_NETIF_DHCP_ALREADY_STOPPED) {
+        ESP_LOGW(TAG, "[WiFi Fast] Could not stop DHCP: %s", esp_err_to_name(err));
+        return false;
+    }
+    
+    esp_netif_ip_info_t ip_info = {};
+    ip_info.ip.addr = cache.ip;
+    ip_info.netmask.addr = cache.netmask;
+    ip_info.gw.addr = cache.gw;
+    err = esp_netif_set_ip_info(sta_netif, &ip_info);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "[WiFi Fast] Could not apply cached lease: %s", esp_err_to_name(err));
+        esp_netif_dhcpc_start(sta_netif);
+        return false;
+    }
+    if (cache.dns != 0) {
+        esp_netif_dns_info_t dns = {};
+        dns.ip.type = ESP_IPADDR_TYPE_V4;
+        dns.ip.u_addr.ip4.addr = cache.dns;
+        esp_netif_set_dns_info(sta_netif, ESP_NETIF_DNS_MAIN, &dns);
+    }
+    
+    lease_in_use = true;
+    ESP_LOGI(TAG, "[WiFi Fast] Reusing cached lease " IPSTR " (%lld s old)", IP2STR(&ip_info.ip),
+             (long long)lease_age_sec());
+    return true;
+}
+
+void wifi_fast_on_got_ip() {
+    fast_attempts = 0;
+    if (lease_in_use) {
+        return;  // Static address from the cache - nothing new to remember
+    }
+    
+    wifi_ap_record_t ap_info;
+    esp_netif_ip_info_t ip_info;
+    if (esp_wifi_sta_get_ap_info(&ap_info) != ESP_OK || esp_netif_get_ip_info(sta_netif, &ip_info) != ESP_OK) {
+        return;
+    }
+    esp_netif_dns_info_t dns = {};
+    esp_netif_get_dns_info(sta_netif, ESP_NETIF_DNS_MAIN, &dns);
+    
+    fast_cache_t fresh = {};
+    strncpy(fresh.ssid, (const char*)ap_info.ssid, sizeof(fresh.ssid) - 1);
+    memcpy(fresh.bssid, ap_info.bssid, sizeof(fresh.bssid));
+    fresh.channel = ap_info.primary;
+    fresh.ip = ip_info.ip.addr;
+    fresh.netmask = ip_info.netmask.addr;
+    fresh.gw = ip_info.gw.addr;
+    fresh.dns = dns.ip.type == ESP_IPADDR_TYPE_V4 ? dns.ip.u_addr.ip4.addr : 0;
+    fresh.obtained_epoch = wall_clock_now();
+    lease_obtained_ms = now_ms();
+    
+    // Only write flash when the AP or the lease changed
+    bool changed = !cache_valid || memcmp(&fresh, &cache, offsetof(fast_cache_t, obtained_epoch)) != 0 ||
+                   (cache.obtained_epoch == 0 && fresh.obtained_epoch != 0);
+    cache = fresh;
+    cache_valid = true;
+    if (changed) {
+        save_cache();
+    }
+}
+
+void wifi_fast_on_time_sync() {
+    if (!cache_valid || cache.obtained_epoch != 0 || lease_obtained_ms < 0) {
+        return;
+    }
+    cache.obtained_epoch = (int64_t)time(NULL) - (now_ms() - lease_obtained_ms) / 1000LL;
+    save_cache();
+}
+
+bool wifi_fast_on_disconnect(uint16_t reason) {
+    if (!cache_valid || reason == WIFI_REASON_ASSOC_LEAVE) {
+        return false;  // Nothing cached, or our own esp_wifi_disconnect()
+    }
+    if (fast_attempts > FAST_MAX_ATTEMPTS) {
+        return false;  // Already fell back to the scan path
+    }
+    if (reason == WIFI_REASON_NO_AP_FOUND || ++fast_attempts > FAST_MAX_ATTEMPTS) {
+        ESP_LOGW(TAG, "[WiFi Fast] Cached AP not reachable (reason %d) - falling back to scan and DHCP", reason);
+        forget_ap();
+        return false;
+    }
+    
+    wifi_config_t config = {};
+    if (esp_wifi_get_config(WIFI_IF_STA, &config) != ESP_OK) {
+        return false;
+    }
+    wifi_fast_apply_config(&config);
+    esp_wifi_set_config(WIFI_IF_STA, &config);
+    wifi_fast_apply_lease();
+    
+    ESP_LOGI(TAG, "[WiFi Fast] Reconnecting to cached AP (attempt %d/%d)", fast_attempts, FAST_MAX_ATTEMPTS);
+    return esp_wifi_connect() == ESP_OK;
+}
+
+void wifi_fast_loop() {
+    if (lease_in_use && !lease_valid()) {
+        ESP_LOGI(TAG, "[WiFi Fast] Cached lease expired - handing back to DHCP");
+        release_lease();
+    }
+}
+
+#endif // WIFI_FAST_RECONNECT_ENABLED
@@ -14,6 +14,7 @@
 #include "wifi/wifi_manager.h"
 
 // System/Standard library headers
+#include <esp_heap_caps.h>
 #include <esp_log.h>
 #include <esp_mac.h>
 #include <esp_system.h>
@@ -130,6 +131,51 @@ static uint16_t improv_capabilities_handle = 0;
 static uint8_t improv_status = IMPROV_STATUS_STOPPED;
 static uint8_t improv_error = IMPROV_ERROR_NONE;
 
+// BLE lifecycle: brought up only for provisioning. Once its memory has been
+// released (BTDM, ~60 KB of internal RAM) BLE cannot come back this boot.
+static bool ble_running = false;
+static bool ble_memory_released = false;
+
+// Credentials received over BLE, acted on by wifi_improv_loop(): BLE cannot be
+// torn down from inside its own GATT callback
+static char pending_ssid[33];
+static char pending_password[65];
+static volatile bool credentials_pending = false;
+
+// Stop the service and shut down Bluedroid and the controller (memory kept)
+static void ble_teardown() {
+    if (!ble_running) {
+        return;
+    }
+    if (improv_service_handle != 0) {
+        esp_ble_gatts_stop_service(improv_service_handle);
+        esp_ble_gatts_delete_service(improv_service_handle);
+        improv_service_handle = 0;
+    }
+    esp_bluedroid_disable();
+    esp_bluedroid_deinit();
+    esp_bt_controller_disable();
+    esp_bt_controller_deinit();
+    improv_gatts_if = 0xFF;  // ESP_GATT_IF_NONE
+    ble_running = false;
+    vTaskDelay(pdMS_TO_TICKS(200));
+}
+
+// Bring WiFi back up in STA mode (provisioning deinitialized it for BLE)
+static void wifi_restore() {
+    wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
+    esp_wifi_init(&cfg);
+    esp_wifi_set_mode(WIFI_MODE_STA);
+    esp_wifi_start();
+    vTaskDelay(pdMS_TO_TICKS(100));
+}
+
+// Undo a partial start so the device is left on WiFi
+static void provisioning_start_failed() {
+    ble_teardown();
+    wifi_restore();
+}
+
 // GATT event handler
 static void gatts_profile_event_handler(esp_gatts_cb_event_t event,
                                         esp_gatt_if_t gatts_if,
@@ -210,49 +256,25 @@ static void handle_improv_rpc(const uint8_t* data, uint16_t len) {
                 break;
             }
             
+            if (credentials_pending) {
+                break;  // Already acting on a previous set
+            }
+            
             // Extract SSID and password
-            char ssid[33] = {0};
-            char password[65] = {0};
-            memcpy(ssid, &data[2], ssid_len);
-            memcpy(password, &data[3 + ssid_len], password_len);
+            memset(pending_ssid, 0, sizeof(pending_ssid));
+            memset(pending_password, 0, sizeof(pending_password));
+            memcpy(pending_ssid, &data[2], ssid_len);
+            memcpy(pending_password, &data[3 + ssid_len], password_len);
             
-            ESP_LOGI(TAG, "[Improv WiFi BLE] Received credentials for: %s", ssid);
+            ESP_LOGI(TAG, "[Improv WiFi BLE] Received credentials for: %s", pending_ssid);
             
             improv_status = IMPROV_STATUS_PROVISIONING;
             improv_error = IMPROV_ERROR_NONE;
             update_status_characteristic();
             update_error_characteristic();
             
-            // Deinitialize BLE first before re-enabling WiFi
-            esp_ble_gatts_stop_service(improv_service_handle);
-            esp_ble_gatts_delete_service(improv_service_handle);
-            esp_bluedroid_disable();
-            esp_bluedroid_deinit();
-            esp_bt_controller_disable();
-            esp_bt_controller_deinit();
-            vTaskDelay(pdMS_TO_TICKS(200));
-            
-            // Re-enable WiFi
-            esp_wifi_start();
-            vTaskDelay(pdMS_TO_TICKS(100));
-            
-            // Try to connect with new credentials
-            if (wifi_manager_connect(cstr_to_string(ssid), cstr_to_string(password))) {
-                // Save credentials for future use
-                wifi_credentials_save(cstr_to_string(ssid), cstr_to_string(password));
-                improv_provisioning_active = false;
-                ESP_LOGI(TAG, "[Improv WiFi BLE] Provisioning successful!");
-                ESP_LOGI(TAG, "[Improv WiFi BLE] Credentials saved, restarting device...");
-                vTaskDelay(pdMS_TO_TICKS(1000));
-                esp_restart();
-            } else {
-                ESP_LOGE(TAG, "[Improv WiFi BLE] Failed to connect with provided credentials");
-                improv_error = IMPROV_ERROR_UNABLE_TO_CONNECT;
-                // Note: BLE is already deinitialized, so we can't send error response
-                // Restart BLE provisioning
-                vTaskDelay(pdMS_TO_TICKS(1000));
-                wifi_improv_start_provisioning();
-            }
+            // BLE is torn down and WiFi connected from wifi_improv_loop()
+            credentials_pending = true;
             break;
         }
         
@@ -494,6 +516,10 @@ void wifi_improv_start_provisioning() {
     if (improv_provisioning_active) {
         return;  // Already provisioning
     }
+    if (ble_memory_released) {
+        ESP_LOGW(TAG, "[Improv WiFi BLE] BLE memory already released - provisioning unavailable until reboot");
+        return;
+    }
     
     // Include BLE headers HERE (at function scope) to avoid static init issues
     // This ensures BLE headers are only included when we actually need BLE
@@ -524,24 +550,29 @@ void wifi_improv_start_provisioning() {
     esp_err_t ret = esp_bt_controller_init(&bt_cfg);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "[Improv WiFi BLE] Failed to initialize BLE controller: %s", esp_err_to_name(ret));
+        wifi_restore();
         return;
     }
+    ble_running = true;
     
     ret = esp_bt_controller_enable(ESP_BT_MODE_BLE);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "[Improv WiFi BLE] Failed to enable BLE controller: %s", esp_err_to_name(ret));
+        provisioning_start_failed();
         return;
     }
     
     ret = esp_bluedroid_init();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "[Improv WiFi BLE] Failed to initialize bluedroid: %s", esp_err_to_name(ret));
+        provisioning_start_failed();
         return;
     }
     
     ret = esp_bluedroid_enable();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "[Improv WiFi BLE] Failed to enable bluedroid: %s", esp_err_to_name(ret));
+        provisioning_start_failed();
         return;
     }
     
@@ -561,12 +592,14 @@ void wifi_improv_start_provisioning() {
     ret = esp_ble_gatts_register_callback(gatts_profile_event_handler);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "[Improv WiFi BLE] Failed to register GATT callback: %s", esp_err_to_name(ret));
+        provisioning_start_failed();
         return;
     }
     
     ret = esp_ble_gap_register_callback(gap_event_handler);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "[Improv WiFi BLE] Failed to register GAP callback: %s", esp_err_to_name(ret));
+        provisioning_start_failed();
         return;
     }
     
@@ -574,6 +607,7 @@ void wifi_improv_start_provisioning() {
     ret = esp_ble_gatts_app_register(0);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "[Improv WiFi BLE] Failed to register GATT app: %s", esp_err_to_name(ret));
+        provisioning_start_failed();
         return;
     }
     
@@ -596,8 +630,59 @@ bool wifi_improv_is_provisioning() {
     return improv_provisioning_active;
 }
 
+void wifi_improv_release_memory() {
+    #if USE_IMPROV_WIFI && IMPROV_RELEASE_BLE_MEMORY_ENABLED
+    if (ble_memory_released || improv_provisioning_active) {
+        return;
+    }
+    ble_teardown();
+    
+    size_t free_before = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    esp_err_t ret = esp_bt_mem_release(ESP_BT_MODE_BTDM);
+    ble_memory_released = true;
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "[Improv WiFi BLE] Failed to release BLE memory: %s", esp_err_to_name(ret));
+        return;
+    }
+    size_t free_after = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    ESP_LOGI(TAG, "[Improv WiFi BLE] Released BLE controller and host memory: %u bytes reclaimed (%u bytes internal free)",
+             (unsigned)(free_after - free_before), (unsigned)free_after);
+    #endif
+}
+
 void wifi_improv_loop() {
     #if USE_IMPROV_WIFI
+    if (credentials_pending) {
+        // Deinitialize BLE first before re-enabling WiFi
+        ble_teardown();
+        wifi_restore();
+        
+        // Try to connect with new credentials
+        bool connected = wifi_manager_connect(cstr_to_string(pending_ssid), cstr_to_string(pending_password));
+        if (connected) {
+            // Save credentials for future use
+            wifi_credentials_save(cstr_to_string(pending_ssid), cstr_to_string(pending_password));
+        }
+        memset(pending_password, 0, sizeof(pending_password));
+        if (connected) {
+            improv_provisioning_active = false;
+            ESP_LOGI(TAG, "[Improv WiFi BLE] Provisioning successful!");
+            ESP_LOGI(TAG, "[Improv WiFi BLE] Credentials saved, restarting device...");
+            vTaskDelay(pdMS_TO_TICKS(1000));
+            esp_restart();
+        } else {
+            ESP_LOGE(TAG, "[Improv WiFi BLE] Failed to connect with provided credentials");
+            improv_error = IMPROV_ERROR_UNABLE_TO_CONNECT;
+            // Note: BLE is already deinitialized, so we can't send error response
+            // Restart BLE provisioning
+            improv_provisioning_active = false;
+            credentials_pending = false;
+            vTaskDelay(pdMS_TO_TICKS(1000));
+            wifi_improv_start_provisioning();
+        }
+        return;
+    }
+    
     // Handle Improv WiFi BLE provisioning if active
     if (improv_provisioning_active) {
         // Check for timeout
@@ -608,20 +693,22 @@ void wifi_improv_loop() {
         
         uint64_t now = esp_timer_get_time() / 1000ULL;
         if (now - provisioning_start > IMPROV_WIFI_TIMEOUT_MS) {
-            ESP_LOGW(TAG, "[Improv WiFi BLE] Provisioning timeout - restarting device");
             improv_provisioning_active = false;
             provisioning_start = 0;
             
             // Deinitialize BLE
-            esp_bluedroid_disable();
-            esp_bluedroid_deinit();
-            esp_bt_controller_disable();
-            esp_bt_controller_deinit();
-            vTaskDelay(pdMS_TO_TICKS(200));
+            ble_teardown();
             
-            ESP_LOGI(TAG, "[Improv WiFi BLE] Restarting device after timeout...");
+            #if IMPROV_RELEASE_BLE_MEMORY_ENABLED
+            // Give the memory back and carry on with the stored credentials
+            ESP_LOGW(TAG, "[Improv WiFi BLE] Provisioning timeout - resuming WiFi without BLE");
+            wifi_restore();
+            wifi_improv_release_memory();
+            #else
+            ESP_LOGW(TAG, "[Improv WiFi BLE] Provisioning timeout - restarting device");
             vTaskDelay(pdMS_TO_TICKS(1000));
             esp_restart();
+            #endif
         }
     }
     #endif
@@ -11,14 +11,22 @@
  * 
  * Handles WiFi connection and automatic reconnection
  * Supports Improv WiFi BLE provisioning for credential setup
+ * 
+ * After bring-up, reconnection, SNTP start and Improv provisioning run on
+ * their own low-priority task, woken by the WiFi/IP event handler. Connection
+ * state, IP and RSSI are cached so the getters never touch the WiFi driver.
  */
 
 // Project headers
 #include "config.h"
 #include "wifi/wifi_manager.h"
 #include "wifi/wifi_credentials.h"
+#include "wifi/wifi_fast_reconnect.h"
 #include "wifi/wifi_improv.h"
 #include "system/esp_system_compat.h"
+#include "system/app_events.h"
+#include "system/boot.h"
+#include "system/boot_profile.h"
 
 // System/Standard library headers
 // ESP-IDF framework headers
@@ -29,10 +37,9 @@
 #include <esp_system.h>
 #include <esp_wifi.h>
 #include <esp_sntp.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 #include <nvs_flash.h>
-#if ENABLE_WATCHDOG
-#include <esp_task_wdt.h>
-#endif
 #include <time.h>
 #include <sys/time.h>  // For struct timeval
 #include <cstring>
@@ -46,9 +53,23 @@
 // Third-party library headers (if enabled)
 // Note: Improv WiFi now uses ESP-IDF native BLE APIs (no Arduino libraries)
 
-static bool wifi_connected = false;
+#define WIFI_POLL_MS          2000  // RSSI refresh and lease check while connected
+#define WIFI_PROVISION_POLL_MS 100  // Improv credentials are picked up from the task
+
+// Task notification bits set by the event handler
+#define WIFI_NOTIFY_GOT_IP        (1UL << 0)
+#define WIFI_NOTIFY_DISCONNECTED  (1UL << 1)
+
+// Written by the event handler and the WiFi task, read from any task
+static volatile bool wifi_connected = false;
+static volatile int wifi_rssi = -100;
+static portMUX_TYPE ip_mux = portMUX_INITIALIZER_UNLOCKED;
+static char wifi_ip[16] = "Not connected";
+
 static unsigned long last_reconnect_attempt = 0;
+static unsigned long disconnected_since = 0;
 static esp_netif_t* sta_netif = NULL;
+static TaskHandle_t wifi_task = NULL;
 
 // WiFi activity tracking (TCP/IP traffic)
 static unsigned long last_activity_time = 0;
@@ -56,6 +77,7 @@ static const unsigned long ACTIVITY_TIMEOUT_MS = 500;  // Activity visible for 5
 
 // NTP time synchronization
 static bool ntp_initialized = false;
+static bool ntp_sync_needed = false;  // Connected since the last (re)start of SNTP
 
 // NTP sync notification callback - called when time synchronization completes
 static void ntp_sync_time_cb(struct timeval *tv) {
@@ -71,11 +93,15 @@ static void ntp_sync_time_cb(struct timeval *tv) {
              timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday,
              timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
     ESP_LOGI(TAG, "[NTP] Date/time will now appear in log messages");
+    boot_mark_ready(BOOT_READY_NTP);
+    wifi_fast_on_time_sync();
 }
 
 static void initialize_ntp(void) {
     if (ntp_initialized) {
-        return;  // Already initialized
+        // New connection: poll the servers now rather than at the next interval
+        esp_sntp_restart();
+        return;
     }
     
     ESP_LOGI(TAG, "[NTP] Initializing NTP time synchronization...");
@@ -100,34 +126,9 @@ static void initialize_ntp(void) {
     esp_sntp_init();
     
     ntp_initialized = true;
-    ESP_LOGI(TAG, "[NTP] NTP initialized, waiting for time sync...");
-    
-    // Wait for time to be set (with timeout)
-    int retry = 0;
-    const int retry_count = 10;
-    while (esp_sntp_get_sync_status() == SNTP_SYNC_STATUS_RESET && retry < retry_count) {
-        ESP_LOGI(TAG, "[NTP] Waiting for time sync... (%d/%d)", retry + 1, retry_count);
-        delay(1000);
-        retry++;
-    }
     
-    if (esp_sntp_get_sync_status() == SNTP_SYNC_STATUS_COMPLETED) {
-        // Sync completed during initial wait - callback will also be called
-        // but we log here too for immediate feedback
-        time_t now = 0;
-        struct tm timeinfo;
-        memset(&timeinfo, 0, sizeof(struct tm));
-        time(&now);
-        localtime_r(&now, &timeinfo);
-        ESP_LOGI(TAG, "[NTP] Time synchronized: %04d-%02d-%02d %02d:%02d:%02d",
-                 timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday,
-                 timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
-    } else {
-        // Sync not completed yet - callback will log when it completes
-        // Don't log as warning since this is expected behavior
-        ESP_LOGI(TAG, "[NTP] Time synchronization in progress (will sync in background)");
-        ESP_LOGI(TAG, "[NTP] A log message will appear when sync completes");
-    }
+    // Don't wait for the sync here - ntp_sync_time_cb logs completion
+    ESP_LOGI(TAG, "[NTP] NTP initialized, time will sync in the background");
 }
 
 // IP event callback to track TCP/IP activity
@@ -140,6 +141,19 @@ static void ip_event_activity_handler(void* arg, esp_event_base_t event_base,
     }
 }
 
+static void notify_wifi_task(uint32_t bits) {
+    if (wifi_task != NULL) {
+        xTaskNotify(wifi_task, bits, eSetBits);
+    }
+}
+
+static void set_cached_ip(const char* ip) {
+    portENTER_CRITICAL(&ip_mux);
+    strncpy(wifi_ip, ip, sizeof(wifi_ip) - 1);
+    wifi_ip[sizeof(wifi_ip) - 1] = '\0';
+    portEXIT_CRITICAL(&ip_mux);
+}
+
 // WiFi event handler
 static void wifi_event_handler(void* arg, esp_event_base_t event_base,
                                 int32_t event_id, void* event_data) {
@@ -151,14 +165,25 @@ static void wifi_event_handler(void* arg, esp_event_base_t event_base,
             case WIFI_EVENT_STA_CONNECTED: {
                 wifi_event_sta_connected_t* event = (wifi_event_sta_connected_t*)event_data;
                 ESP_LOGI(TAG, "Connected to AP SSID: %s, channel: %d", event->ssid, event->channel);
+                app_events_post(APP_EVENT_NETWORK);
+                boot_profile_mark(BOOT_PHASE_WIFI);
                 break;
             }
             case WIFI_EVENT_STA_DISCONNECTED: {
                 wifi_event_sta_disconnected_t* event = (wifi_event_sta_disconnected_t*)event_data;
                 ESP_LOGW(TAG, "Disconnected from AP, reason: %d", event->reason);
+                if (wifi_connected) {
+                    disconnected_since = millis();
+                }
                 wifi_connected = false;
-                // Reset NTP initialization flag on disconnect
-                ntp_initialized = false;
+                wifi_rssi = -100;
+                set_cached_ip("Not connected");
+                // Retry the cached AP right away - hold off the scan path in the WiFi task
+                if (!wifi_improv_is_provisioning() && wifi_fast_on_disconnect(event->reason)) {
+                    last_reconnect_attempt = millis();
+                }
+                app_events_post(APP_EVENT_NETWORK);
+                notify_wifi_task(WIFI_NOTIFY_DISCONNECTED);
                 break;
             }
             default:
@@ -168,21 +193,18 @@ static void wifi_event_handler(void* arg, esp_event_base_t event_base,
         if (event_id == IP_EVENT_STA_GOT_IP) {
             ip_event_got_ip_t* event = (ip_event_got_ip_t*)event_data;
             ESP_LOGI(TAG, "Got IP: " IPSTR, IP2STR(&event->ip_info.ip));
+            char ip_str[16];
+            snprintf(ip_str, sizeof(ip_str), IPSTR, IP2STR(&event->ip_info.ip));
+            set_cached_ip(ip_str);
             wifi_connected = true;
+            app_events_post(APP_EVENT_NETWORK);
+            boot_mark_ready(BOOT_READY_WIFI);
+            boot_profile_mark(BOOT_PHASE_IP);
+            wifi_fast_on_got_ip();
             
-            // Initialize NTP time synchronization when WiFi connects
-            initialize_ntp();
-            
-            // Log current date/time after NTP sync (if available)
-            time_t now = 0;
-            struct tm timeinfo;
-        memset(&timeinfo, 0, sizeof(struct tm));
-            time(&now);
-            if (now > 0 && localtime_r(&now, &timeinfo) != NULL) {
-                ESP_LOGI(TAG, "Current date/time: %04d-%02d-%02d %02d:%02d:%02d",
-                         timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday,
-                         timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
-            }
+            // NTP is started from the WiFi task (or by the wait in connect_to_wifi)
+            ntp_sync_needed = true;
+            notify_wifi_task(WIFI_NOTIFY_GOT_IP);
         }
     }
 }
@@ -190,6 +212,25 @@ static void wifi_event_handler(void* arg, esp_event_base_t event_base,
 // Forward declarations
 static bool connect_to_wifi(const String& ssid, const String& password);
 
+static void start_ntp_if_needed() {
+    if (!ntp_sync_needed || !wifi_connected) {
+        return;
+    }
+    ntp_sync_needed = false;
+    initialize_ntp();
+    
+    // Log current date/time (only valid if the clock was already set)
+    time_t now = 0;
+    struct tm timeinfo;
+    memset(&timeinfo, 0, sizeof(struct tm));
+    time(&now);
+    if (now > 0 && localtime_r(&now, &timeinfo) != NULL) {
+        ESP_LOGI(TAG, "Current date/time: %04d-%02d-%02d %02d:%02d:%02d",
+                 timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday,
+                 timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
+    }
+}
+
 /**
  * Connect to WiFi network (public function for use by wifi_improv)
  */
@@ -210,6 +251,12 @@ static bool connect_to_wifi(const String& ssid, const String& password) {
     wifi_config.sta.threshold.authmode = WIFI_AUTH_WPA2_PSK;
     wifi_config.sta.pmf_cfg.capable = true;
     wifi_config.sta.pmf_cfg.required = false;
+    #if POWER_MANAGEMENT_ENABLED
+    wifi_config.sta.listen_interval = POWER_WIFI_LISTEN_INTERVAL;  // Used by WIFI_PS_MAX_MODEM
+    #endif
+    
+    // Go straight to the last AP (no scan) if it is cached for this SSID
+    wifi_fast_apply_config(&wifi_config);
     
     esp_err_t err = esp_wifi_set_config(WIFI_IF_STA, &wifi_config);
     if (err != ESP_OK) {
@@ -217,6 +264,9 @@ static bool connect_to_wifi(const String& ssid, const String& password) {
         return false;
     }
     
+    // Skip DHCP if the cached lease is still valid
+    wifi_fast_apply_lease();
+    
     err = esp_wifi_connect();
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "[WiFi] Failed to start WiFi connection: %s", esp_err_to_name(err));
@@ -255,8 +305,10 @@ static bool connect_to_wifi(const String& ssid, const String& password) {
         
         wifi_ap_record_t ap_info;
         if (esp_wifi_sta_get_ap_info(&ap_info) == ESP_OK) {
+            wifi_rssi = ap_info.rssi;
             ESP_LOGI(TAG, "[WiFi] Signal strength (RSSI): %d dBm", ap_info.rssi);
         }
+        start_ntp_if_needed();
         return true;
     } else {
         wifi_connected = false;
@@ -277,7 +329,7 @@ bool wifi_manager_init() {
         return false;  // Not connected yet, provisioning in progress
     }
     #endif
-    
+
     // Set WiFi component log level to WARN to reduce verbose output
     // (INFO level can produce empty log lines in some ESP-IDF versions)
     esp_log_level_set("wifi", ESP_LOG_WARN);
@@ -291,6 +343,7 @@ bool wifi_manager_init() {
         ESP_LOGE(TAG, "Failed to create WiFi station netif");
         return false;
     }
+    wifi_fast_init(sta_netif);
     
     wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
     ESP_ERROR_CHECK(esp_wifi_init(&cfg));
@@ -337,9 +390,14 @@ bool wifi_manager_init() {
     
     ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA));
     
-    // Set WiFi power save mode based on BLE configuration
+    // Set WiFi power save mode based on power management and BLE configuration
     // When BLE is enabled, WiFi modem sleep must be enabled for coexistence
-    #if USE_IMPROV_WIFI
+    #if POWER_MANAGEMENT_ENABLED
+    // Modem sleep, waking every POWER_WIFI_LISTEN_INTERVAL beacons (0 = every DTIM)
+    ESP_ERROR_CHECK(esp_wifi_set_ps(POWER_WIFI_LISTEN_INTERVAL > 0 ? WIFI_PS_MAX_MODEM : WIFI_PS_MIN_MODEM));
+    ESP_LOGI(TAG, "[WiFi] Power save mode set to %s (power management)",
+             POWER_WIFI_LISTEN_INTERVAL > 0 ? "MAX_MODEM" : "MIN_MODEM");
+    #elif USE_IMPROV_WIFI
     // Enable WiFi modem sleep when BLE is enabled (required for coexistence)
     ESP_ERROR_CHECK(esp_wifi_set_ps(WIFI_PS_MIN_MODEM));
     ESP_LOGI(TAG, "[WiFi] Power save mode set to MIN_MODEM (required for BLE coexistence)");
@@ -348,7 +406,7 @@ bool wifi_manager_init() {
     ESP_ERROR_CHECK(esp_wifi_set_ps(WIFI_PS_NONE));
     ESP_LOGI(TAG, "[WiFi] Power save disabled (no BLE)");
     #endif
-    
+
     ESP_ERROR_CHECK(esp_wifi_start());
     
     String ssid, password;
@@ -400,9 +458,10 @@ bool wifi_manager_init() {
     #else
     ESP_LOGW(TAG, "[WiFi] Connection failed - Improv WiFi disabled, will retry...");
     last_reconnect_attempt = millis();
+    disconnected_since = last_reconnect_attempt;
     return false;
     #endif
-    
+
     return false;
 }
 
@@ -415,94 +474,129 @@ bool wifi_manager_is_provisioning() {
 }
 
 bool wifi_manager_is_connected() {
-    // ESP-IDF: Check WiFi status via event system
-    // wifi_connected is updated by event handler
+    // Updated by the event handler
     return wifi_connected;
 }
 
-void wifi_manager_loop() {
-    #if ENABLE_WATCHDOG
-    // Feed watchdog at start of WiFi loop (defensive)
-    esp_task_wdt_reset();
+static void load_credentials(String& ssid, String& password) {
+    // Try saved credentials first
+    if (USE_SAVED_CREDENTIALS && wifi_credentials_load(ssid, password)) {
+        ESP_LOGI(TAG, "[WiFi] Reconnecting to SSID: '%s' (from saved credentials)", ssid.c_str());
+        return;
+    }
+    // Use credentials from KConfig (ESP-IDF) or secrets.h
+    // ESP-IDF: Use KConfig values if set, otherwise fallback to secrets.h
+    #ifdef CONFIG_WIFI_SSID
+        if (strlen(CONFIG_WIFI_SSID) > 0) {
+            ssid = String(CONFIG_WIFI_SSID);
+            password = String(CONFIG_WIFI_PASSWORD);
+        } else {
+            // Fallback to secrets.h if KConfig values are empty
+            ssid = String(WIFI_SSID);  // From secrets.h
+            password = String(WIFI_PASSWORD);  // From secrets.h
+        }
+    #else
+        // CONFIG_WIFI_SSID not defined, use secrets.h
+        ssid = String(WIFI_SSID);
+        password = String(WIFI_PASSWORD);
     #endif
+    ESP_LOGI(TAG, "[WiFi] Reconnecting to SSID: '%s'", ssid.c_str());
+}
+
+static void reconnect() {
+    ESP_LOGI(TAG, "[WiFi] Attempting reconnection...");
+    String ssid, password;
+    load_credentials(ssid, password);
+    
+    esp_wifi_disconnect();
+    vTaskDelay(pdMS_TO_TICKS(100));
+    
+    // Blocks this task only, until connected or the connect timeout
+    if (connect_to_wifi(ssid, password)) {
+        ESP_LOGI(TAG, "[WiFi] Reconnected!");
+        return;
+    }
+    ESP_LOGW(TAG, "[WiFi] Reconnection failed, will try again...");
     
+    // If reconnection keeps failing and Improv WiFi is enabled, start provisioning
+    #if USE_IMPROV_WIFI
+    if (!wifi_improv_is_provisioning() && (millis() - disconnected_since) > 60000) {
+        // Only start provisioning after 1 minute of failed reconnections
+        ESP_LOGI(TAG, "[WiFi] Starting Improv WiFi provisioning after failed reconnection...");
+        wifi_manager_start_provisioning();
+    }
+    #endif
+}
+
+/**
+ * One pass of connection management
+ * @return How long the task may sleep (ms) if no event arrives
+ */
+static uint32_t wifi_manager_loop() {
     // Handle Improv WiFi BLE provisioning if active
     wifi_improv_loop();
     
     // Don't try to reconnect while provisioning
     if (wifi_improv_is_provisioning()) {
-        return;
+        return WIFI_PROVISION_POLL_MS;
     }
     
-    // Check connection status
-    if (!wifi_manager_is_connected()) {
-        // Try to reconnect if enough time has passed
-        unsigned long now = millis();
-        if (now - last_reconnect_attempt >= WIFI_RECONNECT_DELAY) {
-            last_reconnect_attempt = now;
-            ESP_LOGI(TAG, "[WiFi] Attempting reconnection...");
-            
-            String ssid, password;
-            
-            // Try saved credentials first
-            if (USE_SAVED_CREDENTIALS && wifi_credentials_load(ssid, password)) {
-                ESP_LOGI(TAG, "[WiFi] Reconnecting to SSID: '%s' (from saved credentials)", ssid.c_str());
-            } else {
-                // Use credentials from KConfig (ESP-IDF) or secrets.h
-                // ESP-IDF: Use KConfig values if set, otherwise fallback to secrets.h
-                #ifdef CONFIG_WIFI_SSID
-                    if (strlen(CONFIG_WIFI_SSID) > 0) {
-                        ssid = String(CONFIG_WIFI_SSID);
-                        password = String(CONFIG_WIFI_PASSWORD);
-                    } else {
-                        // Fallback to secrets.h if KConfig values are empty
-                        ssid = String(WIFI_SSID);  // From secrets.h
-                        password = String(WIFI_PASSWORD);  // From secrets.h
-                    }
-                #else
-                    // CONFIG_WIFI_SSID not defined, use secrets.h
-                    ssid = String(WIFI_SSID);
-                    password = String(WIFI_PASSWORD);
-                #endif
-                ESP_LOGI(TAG, "[WiFi] Reconnecting to SSID: '%s'", ssid.c_str());
-            }
-            
-            esp_wifi_disconnect();
-            delay(100);
-            
-            // Try to reconnect
-            if (connect_to_wifi(ssid, password)) {
-                ESP_LOGI(TAG, "[WiFi] Reconnected!");
-                esp_netif_ip_info_t ip_info;
-                if (esp_netif_get_ip_info(sta_netif, &ip_info) == ESP_OK) {
-                    ESP_LOGI(TAG, "[WiFi] IP address: " IPSTR, IP2STR(&ip_info.ip));
-                }
-            } else {
-                ESP_LOGW(TAG, "[WiFi] Reconnection failed, will try again...");
-                
-                // If reconnection fails and Improv WiFi is enabled, start provisioning
-                #if USE_IMPROV_WIFI
-                if (!wifi_improv_is_provisioning() && (now - last_reconnect_attempt) > 60000) {
-                    // Only start provisioning after 1 minute of failed reconnections
-                    ESP_LOGI(TAG, "[WiFi] Starting Improv WiFi provisioning after failed reconnection...");
-                    wifi_manager_start_provisioning();
-                }
-                #endif
-            }
+    if (wifi_manager_is_connected()) {
+        start_ntp_if_needed();
+        
+        // Hand a reused lease back to DHCP once it gets too old
+        wifi_fast_loop();
+        wifi_improv_release_memory();  // Connected without BLE: it is no longer needed
+        
+        wifi_ap_record_t ap_info;
+        if (esp_wifi_sta_get_ap_info(&ap_info) == ESP_OK) {
+            wifi_rssi = ap_info.rssi;
         }
+        return WIFI_POLL_MS;
     }
+    
+    // Try to reconnect if enough time has passed
+    unsigned long now = millis();
+    unsigned long since = now - last_reconnect_attempt;
+    if (since < WIFI_RECONNECT_DELAY) {
+        return (uint32_t)(WIFI_RECONNECT_DELAY - since);
+    }
+    last_reconnect_attempt = now;
+    reconnect();
+    return wifi_manager_is_connected() ? WIFI_POLL_MS : WIFI_RECONNECT_DELAY;
 }
 
-String wifi_manager_get_ip() {
-    if (wifi_manager_is_connected()) {
-        esp_netif_ip_info_t ip_info;
-        if (esp_netif_get_ip_info(sta_netif, &ip_info) == ESP_OK) {
-            char ip_str[16];
-            snprintf(ip_str, sizeof(ip_str), IPSTR, IP2STR(&ip_info.ip));
-            return String(ip_str);
-        }
+static void wifi_manager_task(void* arg) {
+    uint32_t wait_ms = 0;
+    while (true) {
+        uint32_t bits = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &bits, pdMS_TO_TICKS(wait_ms));
+        wait_ms = wifi_manager_loop();
     }
-    return String("Not connected");
+}
+
+bool wifi_manager_start_task() {
+    if (wifi_task != NULL) {
+        return true;
+    }
+    BaseType_t ok = xTaskCreatePinnedToCore(wifi_manager_task, "wifi_mgr", NETWORK_TASK_STACK_SIZE, NULL,
+                                            NETWORK_TASK_PRIORITY, &wifi_task, NETWORK_TASK_CORE);
+    if (ok != pdPASS) {
+        ESP_LOGE(TAG, "[WiFi] Failed to create WiFi task");
+        wifi_task = NULL;
+        return false;
+    }
+    return true;
+}
+
+void wifi_manager_get_ip(char* buf, size_t size) {
+    if (size == 0) {
+        return;
+    }
+    portENTER_CRITICAL(&ip_mux);
+    strncpy(buf, wifi_ip, size - 1);
+    portEXIT_CRITICAL(&ip_mux);
+    buf[size - 1] = '\0';
 }
 
 String wifi_manager_get_mac_address() {
@@ -517,13 +611,8 @@ String wifi_manager_get_mac_address() {
 }
 
 int wifi_manager_get_rssi() {
-    if (wifi_manager_is_connected()) {
-        wifi_ap_record_t ap_info;
-        if (esp_wifi_sta_get_ap_info(&ap_info) == ESP_OK) {
-            return ap_info.rssi;
-        }
-    }
-    return -100;  // Return very weak signal when not connected
+    // Refreshed by the WiFi task, very weak signal when not connected
+    return wifi_connected ? wifi_rssi : -100;
 }
 
 bool wifi_manager_has_activity() {
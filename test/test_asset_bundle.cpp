@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Unit tests for the asset bundle format
+ */
+
+#include <unity.h>
+#include <Arduino.h>
+
+#include "utils/asset_bundle.h"
+
+#define BUNDLE_SIZE 256
+
+static uint32_t bundle_words[BUNDLE_SIZE / 4];  // Word aligned like mapped flash
+static uint8_t* const bundle = (uint8_t*)bundle_words;
+
+// Two entries as tools/build_asset_bundle.py lays them out
+static size_t build_bundle() {
+    memset(bundle_words, 0, sizeof(bundle_words));
+    asset_bundle_header_t* header = (asset_bundle_header_t*)bundle;
+    asset_entry_t* entries = (asset_entry_t*)(bundle + sizeof(*header));
+    uint32_t offset = sizeof(*header) + 2 * sizeof(asset_entry_t);
+    
+    strcpy(entries[0].name, "logo");
+    entries[0].offset = offset;
+    entries[0].size = 8;
+    entries[0].raw_size = 8;
+    entries[0].width = 2;
+    entries[0].height = 2;
+    entries[0].cf = 4;
+    entries[0].flags = ASSET_FLAG_SWAP16;
+    memset(bundle + offset, 0xAB, 8);
+    
+    strcpy(entries[1].name, "splash");
+    entries[1].offset = offset + 8;
+    entries[1].size = 3;
+    entries[1].raw_size = 40;
+    entries[1].width = 4;
+    entries[1].height = 5;
+    entries[1].cf = 4;
+    entries[1].flags = ASSET_FLAG_RLE | ASSET_FLAG_SWAP16;
+    
+    header->magic = ASSET_BUNDLE_MAGIC;
+    header->version = ASSET_BUNDLE_VERSION;
+    header->count = 2;
+    header->size = offset + 11;
+    header->index_crc = asset_bundle_crc32((const uint8_t*)entries, 2 * sizeof(asset_entry_t));
+    return header->size;
+}
+
+static void reseal() {
+    asset_bundle_header_t* header = (asset_bundle_header_t*)bundle;
+    header->index_crc = asset_bundle_crc32(bundle + sizeof(*header), header->count * sizeof(asset_entry_t));
+}
+
+void test_asset_bundle_layout() {
+    // The Python builder packs these with "<IHHII" and "<16sIIIHHBBH"
+    TEST_ASSERT_EQUAL(16, sizeof(asset_bundle_header_t));
+    TEST_ASSERT_EQUAL(36, sizeof(asset_entry_t));
+    
+    // Same CRC-32 as zlib.crc32(b"123456789")
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926UL, asset_bundle_crc32((const uint8_t*)"123456789", 9));
+}
+
+void test_asset_bundle_find() {
+    size_t size = build_bundle();
+    TEST_ASSERT_TRUE(asset_bundle_valid(bundle, BUNDLE_SIZE));
+    TEST_ASSERT_TRUE(asset_bundle_valid(bundle, size));
+    
+    const asset_entry_t* logo = asset_bundle_find(bundle, "logo");
+    TEST_ASSERT_NOT_NULL(logo);
+    TEST_ASSERT_EQUAL(2, logo->width);
+    TEST_ASSERT_EQUAL_HEX8(0xAB, bundle[logo->offset]);
+    
+    const asset_entry_t* splash = asset_bundle_find(bundle, "splash");
+    TEST_ASSERT_NOT_NULL(splash);
+    TEST_ASSERT_EQUAL(40, splash->raw_size);
+    
+    TEST_ASSERT_NULL(asset_bundle_find(bundle, "log"));
+    TEST_ASSERT_NULL(asset_bundle_find(bundle, "missing"));
+}
+
+void test_asset_bundle_rejects_damage() {
+    size_t size = build_bundle();
+    asset_bundle_header_t* header = (asset_bundle_header_t*)bundle;
+    asset_entry_t* entries = (asset_entry_t*)(bundle + sizeof(*header));
+    
+    // Truncated partition, erased flash, wrong version
+    TEST_ASSERT_FALSE(asset_bundle_valid(bundle, size - 1));
+    TEST_ASSERT_FALSE(asset_bundle_valid(bundle, 8));
+    memset(bundle_words, 0xFF, sizeof(bundle_words));
+    TEST_ASSERT_FALSE(asset_bundle_valid(bundle, BUNDLE_SIZE));
+    build_bundle();
+    header->version = ASSET_BUNDLE_VERSION + 1;
+    TEST_ASSERT_FALSE(asset_bundle_valid(bundle, BUNDLE_SIZE));
+    
+    // Index changed without its CRC
+    build_bundle();
+    entries[1].size = 4;
+    TEST_ASSERT_FALSE(asset_bundle_valid(bundle, BUNDLE_SIZE));
+    
+    // Data past the end of the bundle
+    build_bundle();
+    entries[1].size = 4;
+    reseal();
+    TEST_ASSERT_FALSE(asset_bundle_valid(bundle, BUNDLE_SIZE));
+    
+    // Unaligned data, unterminated name, uncompressed size mismatch
+    build_bundle();
+    entries[0].offset += 1;
+    reseal();
+    TEST_ASSERT_FALSE(asset_bundle_valid(bundle, BUNDLE_SIZE));
+    build_bundle();
+    memset(entries[0].name, 'x', ASSET_NAME_SIZE);
+    reseal();
+    TEST_ASSERT_FALSE(asset_bundle_valid(bundle, BUNDLE_SIZE));
+    build_bundle();
+    entries[0].raw_size = 16;
+    reseal();
+    TEST_ASSERT_FALSE(asset_bundle_valid(bundle, BUNDLE_SIZE));
+    
+    // Too many entries for the declared size
+    build_bundle();
+    header->count = ASSET_BUNDLE_MAX_ENTRIES;
+    TEST_ASSERT_FALSE(asset_bundle_valid(bundle, BUNDLE_SIZE));
+}
+
+void setup() {
+    // Wait for serial monitor to connect (for native testing)
+    delay(2000);
+    
+    UNITY_BEGIN();
+    
+    RUN_TEST(test_asset_bundle_layout);
+    RUN_TEST(test_asset_bundle_find);
+    RUN_TEST(test_asset_bundle_rejects_damage);
+    
+    UNITY_END();
+}
+
+void loop() {
+    // Empty - tests run once in setup()
+}
@@ -0,0 +1,17 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Host shim: ESP-IDF logging compiled out for benchmarks
+ */
+
+#ifndef BENCH_SHIM_ESP_LOG_H
+#define BENCH_SHIM_ESP_LOG_H
+
+#define ESP_LOGE(tag, fmt, ...) do { (void)(tag); } while (0)
+#define ESP_LOGW(tag, fmt, ...) do { (void)(tag); } while (0)
+#define ESP_LOGI(tag, fmt, ...) do { (void)(tag); } while (0)
+#define ESP_LOGD(tag, fmt, ...) do { (void)(tag); } while (0)
+#define ESP_LOGV(tag, fmt, ...) do { (void)(tag); } while (0)
+
+#endif // BENCH_SHIM_ESP_LOG_H
@@ -0,0 +1,31 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Host shim: just the LVGL image descriptor, so the image headers in
+ * include/images can be used as benchmark input
+ */
+
+#ifndef BENCH_SHIM_LVGL_H
+#define BENCH_SHIM_LVGL_H
+
+#include <stdint.h>
+#include "lv_conf.h"
+
+#define LV_IMG_CF_TRUE_COLOR 4
+
+typedef struct {
+    uint32_t cf : 5;
+    uint32_t always_zero : 3;
+    uint32_t reserved : 2;
+    uint32_t w : 11;
+    uint32_t h : 11;
+} lv_img_header_t;
+
+typedef struct {
+    lv_img_header_t header;
+    uint32_t data_size;
+    const uint8_t* data;
+} lv_img_dsc_t;
+
+#endif // BENCH_SHIM_LVGL_H
@@ -0,0 +1,13 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Host shim: placeholder credentials (config.h always includes secrets.h)
+ */
+
+#ifndef SECRETS_H
+#define SECRETS_H
+#define WIFI_SSID "bench"
+#define WIFI_PASSWORD "bench"
+#define MQTT_SERVER "localhost"
+#endif // SECRETS_H
@@ -0,0 +1,305 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Host benchmarks for the hot-path modules
+ * 
+ * Runs the production code on the build machine (PlatformIO "native" env)
+ * against the shims in shims/:
+ * - rle_decode / rle_stream_read on the real logo data
+ * - pixel_swap_rgb565, the flush byte swap for LV_COLOR_16_SWAP 0
+ * - paid command parsing through mqtt_dispatch (src/mqtt/mqtt_dispatch.cpp)
+ * - flow_rate_select_span + flow_rate_span_hz from the sampling task
+ * 
+ * Every benchmark checks its output before timing it. Results are printed
+ * as one JSON object per line and, if BENCH_OUTPUT is set, written to that
+ * file for scripts/bench_compare.py:
+ *   {"bench":"rle_decode/precision_pour_logo","ns_per_op":1234.5,"ns_min":1200.1,"ops":4096,"bytes":20720}
+ * 
+ *   pio test -e native -v
+ */
+
+#include <unity.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "config.h"
+#include "display/pixel_swap.h"
+#include "flow/flow_rate.h"
+#include "flow/pour_math.h"
+#include "mqtt/mqtt_dispatch.h"
+#include "utils/rle_decode.h"
+#include "images/precision_pour_logo.h"
+
+#define BENCH_ROUNDS 7          // Median of this many timed rounds
+#define BENCH_ROUND_NS 50000000 // Each round runs for at least 50 ms
+#define DEVICE_TOPIC "precisionpour/0011223344556677"
+
+static FILE* output = NULL;
+static volatile uint32_t sink = 0;  // Keeps results observable so loops are not optimised away
+
+// mqtt_dispatch strips the device topic through mqtt_connection
+const char* mqtt_connection_get_device_topic() {
+    return DEVICE_TOPIC;
+}
+
+static uint64_t now_ns() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static int compare_double(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+/**
+ * Time fn: calibrate a batch size to ~BENCH_ROUND_NS, then report the median
+ * and minimum ns per call over BENCH_ROUNDS rounds
+ */
+static void bench(const char* name, size_t bytes_per_op, void (*fn)(void)) {
+    uint64_t ops = 1;
+    while (true) {
+        uint64_t start = now_ns();
+        for (uint64_t i = 0; i < ops; i++) {
+            fn();
+        }
+        if (now_ns() - start >= BENCH_ROUND_NS / 4 || ops >= (1ULL << 30)) {
+            break;
+        }
+        ops *= 2;
+    }
+    ops *= 4;
+    
+    double per_op[BENCH_ROUNDS];
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        uint64_t start = now_ns();
+        for (uint64_t i = 0; i < ops; i++) {
+            fn();
+        }
+        per_op[r] = (double)(now_ns() - start) / (double)ops;
+    }
+    qsort(per_op, BENCH_ROUNDS, sizeof(per_op[0]), compare_double);
+    
+    char line[256];
+    snprintf(line, sizeof(line),
+             "{\"bench\":\"%s\",\"ns_per_op\":%.1f,\"ns_min\":%.1f,\"ops\":%llu,\"bytes\":%zu}",
+             name, per_op[BENCH_ROUNDS / 2], per_op[0], (unsigned long long)ops, bytes_per_op);
+    printf("%s\n", line);
+    if (output != NULL) {
+        fprintf(output, "%s\n", line);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// RLE decode
+// ---------------------------------------------------------------------------
+
+static uint8_t* rle_out = NULL;
+
+static void run_rle_decode() {
+    sink += (uint32_t)rle_decode(precision_pour_logo.data, precision_pour_logo.data_size,
+                                 rle_out, PRECISION_POUR_LOGO_UNCOMPRESSED_SIZE, NULL);
+}
+
+// Splash streaming: 4 scanlines per band
+static void run_rle_stream() {
+    const size_t band = precision_pour_logo.header.w * 2 * 4;
+    rle_stream_t stream;
+    rle_stream_init(&stream, precision_pour_logo.data, precision_pour_logo.data_size);
+    size_t n;
+    while ((n = rle_stream_read(&stream, rle_out, band)) > 0) {
+        sink += (uint32_t)n;
+    }
+}
+
+void test_bench_rle_decode(void) {
+    const size_t size = PRECISION_POUR_LOGO_UNCOMPRESSED_SIZE;
+    rle_out = (uint8_t*)malloc(size);
+    TEST_ASSERT_NOT_NULL(rle_out);
+    TEST_ASSERT_EQUAL(size, rle_decode(precision_pour_logo.data, precision_pour_logo.data_size, rle_out, size, NULL));
+    
+    bench("rle_decode/precision_pour_logo", size, run_rle_decode);
+    bench("rle_stream_read/precision_pour_logo", size, run_rle_stream);
+    free(rle_out);
+    rle_out = NULL;
+}
+
+// ---------------------------------------------------------------------------
+// Flush byte swap
+// ---------------------------------------------------------------------------
+
+#define SWAP_PIXELS (DISPLAY_WIDTH * 40)  // One 40-line draw buffer
+
+static uint16_t swap_src[SWAP_PIXELS + 1];
+static uint16_t swap_dst[SWAP_PIXELS + 1];
+
+static void run_swap_aligned() {
+    pixel_swap_rgb565(swap_dst, swap_src, SWAP_PIXELS);
+    sink += swap_dst[0];
+}
+
+// Partial-area flushes can start on an odd pixel
+static void run_swap_unaligned() {
+    pixel_swap_rgb565(swap_dst + 1, swap_src + 1, SWAP_PIXELS - 1);
+    sink += swap_dst[1];
+}
+
+void test_bench_pixel_swap(void) {
+    for (size_t i = 0; i < SWAP_PIXELS + 1; i++) {
+        swap_src[i] = (uint16_t)(i * 2654435761U);
+    }
+    pixel_swap_rgb565(swap_dst, swap_src, SWAP_PIXELS);
+    for (size_t i = 0; i < SWAP_PIXELS; i++) {
+        TEST_ASSERT_EQUAL_HEX16((uint16_t)((swap_src[i] << 8) | (swap_src[i] >> 8)), swap_dst[i]);
+    }
+    
+    bench("pixel_swap/aligned", SWAP_PIXELS * 2, run_swap_aligned);
+    bench("pixel_swap/unaligned", (SWAP_PIXELS - 1) * 2, run_swap_unaligned);
+}
+
+// ---------------------------------------------------------------------------
+// Paid command parsing
+// ---------------------------------------------------------------------------
+
+static const char paid_topic[] = DEVICE_TOPIC MQTT_SUFFIX_PAID;
+static const char paid_payload[] =
+    "{\"id\":\"3f6c1e2a-9b7d-4c1e-8f5a-2d9e7b6a1c40\",\"cost_per_ml\":0.005,\"max_ml\":500,\"currency\":\"GBP\"}";
+static char large_payload[MQTT_MAX_MESSAGE_SIZE];
+static size_t large_len = 0;
+
+static struct {
+    uint32_t calls;
+    int64_t price_micro_per_ml;
+    int max_ml;
+    size_t id_len;
+} paid_seen;
+
+// Same field extraction as on_paid_command() in main.cpp
+static void on_paid(JsonObjectConst cmd) {
+    const char* unique_id = cmd["id"] | "";
+    float cost_per_ml = cmd["cost_per_ml"] | 0.0;
+    const char* currency = cmd["currency"] | "";
+    paid_seen.calls++;
+    paid_seen.id_len = strlen(unique_id);
+    paid_seen.max_ml = cmd["max_ml"] | 0;
+    paid_seen.price_micro_per_ml = pour_price_from_float(cost_per_ml);
+    sink += (uint32_t)strlen(currency);
+}
+
+static void run_paid_parse() {
+    mqtt_dispatch_message(paid_topic, sizeof(paid_topic) - 1, paid_payload, sizeof(paid_payload) - 1);
+}
+
+// A message bigger than one esp-mqtt event, delivered as 1 KB fragments
+static void run_paid_fragmented() {
+    const size_t chunk = 1024;
+    for (size_t offset = 0; offset < large_len; offset += chunk) {
+        size_t n = large_len - offset < chunk ? large_len - offset : chunk;
+        mqtt_dispatch_fragment(paid_topic, sizeof(paid_topic) - 1, large_payload + offset, n, offset, large_len);
+    }
+}
+
+void test_bench_paid_command(void) {
+    static bool registered = false;
+    if (!registered) {
+        TEST_ASSERT_TRUE(mqtt_dispatch_register(MQTT_SUFFIX_PAID, on_paid));
+        registered = true;
+    }
+    
+    memset(&paid_seen, 0, sizeof(paid_seen));
+    run_paid_parse();
+    TEST_ASSERT_EQUAL_UINT32(1, paid_seen.calls);
+    TEST_ASSERT_EQUAL(500, paid_seen.max_ml);
+    TEST_ASSERT_EQUAL(5000, (int)paid_seen.price_micro_per_ml);
+    TEST_ASSERT_EQUAL(36, (int)paid_seen.id_len);
+    
+    // Same command padded with a long note field to ~3 fragments
+    large_len = (size_t)snprintf(large_payload, sizeof(large_payload),
+                                 "{\"id\":\"3f6c1e2a\",\"cost_per_ml\":0.005,\"max_ml\":500,\"note\":\"%0*d\"}", 3000, 0);
+    TEST_ASSERT_LESS_THAN(sizeof(large_payload), large_len);
+    memset(&paid_seen, 0, sizeof(paid_seen));
+    run_paid_fragmented();
+    TEST_ASSERT_EQUAL_UINT32(1, paid_seen.calls);
+    TEST_ASSERT_EQUAL(500, paid_seen.max_ml);
+    
+    bench("mqtt_dispatch/paid", sizeof(paid_payload) - 1, run_paid_parse);
+    bench("mqtt_dispatch/paid_fragmented", large_len, run_paid_fragmented);
+}
+
+// ---------------------------------------------------------------------------
+// Flow rate
+// ---------------------------------------------------------------------------
+
+#define FAST_WINDOW_US ((uint32_t)FLOW_RATE_FAST_WINDOW_MS * 1000U)
+#define STOP_TIMEOUT_US ((uint32_t)FLOW_RATE_STOP_TIMEOUT_MS * 1000U)
+#define PULSE_PERIOD_US 4444U  // 225 Hz = 30 L/min on a 450 pulse/L meter
+
+static pulse_stamp_t ring[FLOW_PULSE_RING_SIZE];
+static uint32_t ring_head = 0;
+static uint32_t rate_now_us = 0;
+
+static void push_pulse(uint32_t time_us) {
+    ring[ring_head & FLOW_PULSE_RING_MASK].time_us = time_us;
+    ring[ring_head & FLOW_PULSE_RING_MASK].count = ring_head + 1;
+    ring_head++;
+}
+
+// One sampling step at full flow (timestamps wrap past 2^32 regularly)
+static void run_flow_rate() {
+    rate_now_us += PULSE_PERIOD_US;
+    push_pulse(rate_now_us);
+    flow_rate_span_t span = flow_rate_select_span(ring, ring_head, FAST_WINDOW_US, STOP_TIMEOUT_US);
+    float hz = flow_rate_span_hz(&span, rate_now_us + 1000, STOP_TIMEOUT_US, 0);
+    sink += (uint32_t)hz;
+}
+
+void test_bench_flow_rate(void) {
+    ring_head = 0;
+    rate_now_us = 0xFFFF0000U;  // Cross the 32-bit wrap while checking
+    for (int i = 0; i < FLOW_PULSE_RING_SIZE * 2; i++) {
+        rate_now_us += PULSE_PERIOD_US;
+        push_pulse(rate_now_us);
+    }
+    flow_rate_span_t span = flow_rate_select_span(ring, ring_head, FAST_WINDOW_US, STOP_TIMEOUT_US);
+    TEST_ASSERT_TRUE(span.have_pair);
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 1000000.0f / PULSE_PERIOD_US,
+                             flow_rate_span_hz(&span, rate_now_us + 1000, STOP_TIMEOUT_US, 0));
+    
+    // Flow stopped: no rate once the stop timeout has passed
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, flow_rate_span_hz(&span, rate_now_us + STOP_TIMEOUT_US + 1, STOP_TIMEOUT_US, 0));
+    
+    bench("flow_rate/full_flow", 0, run_flow_rate);
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    const char* path = getenv("BENCH_OUTPUT");
+    if (path != NULL && path[0] != '\0') {
+        output = fopen(path, "w");
+    }
+    
+    UNITY_BEGIN();
+    
+    RUN_TEST(test_bench_rle_decode);
+    RUN_TEST(test_bench_pixel_swap);
+    RUN_TEST(test_bench_paid_command);
+    RUN_TEST(test_bench_flow_rate);
+    
+    int failures = UNITY_END();
+    if (output != NULL) {
+        fclose(output);
+    }
+    return failures;
+}
@@ -8,6 +8,10 @@
 #include <unity.h>
 #include <Arduino.h>
 
+#include "flow/flow_histogram.h"
+#include "flow/k_factor.h"
+#include "flow/pour_math.h"
+
 // Mock flow meter calculation functions for testing
 // These test the core calculation logic without hardware dependencies
 
@@ -117,6 +121,209 @@ void test_volume_edge_cases(void) {
     TEST_ASSERT_TRUE(volume < 0.01);
 }
 
+/**
+ * Test fixed-point volume from pulses
+ * 450 pulses = 1 liter = 1,000,000 ul
+ */
+void test_fixed_point_volume(void) {
+    TEST_ASSERT_EQUAL_UINT64(0, pour_pulses_to_ul(0));
+    TEST_ASSERT_EQUAL_UINT64(1000000, pour_pulses_to_ul(450));
+    TEST_ASSERT_EQUAL_UINT64(2222, pour_pulses_to_ul(1));  // 2.222 ml per pulse, rounded down
+    
+    // 500 ml needs 225 pulses, 1 ml still needs a whole pulse
+    TEST_ASSERT_EQUAL_UINT64(225, pour_ml_to_pulses(500));
+    TEST_ASSERT_EQUAL_UINT64(1, pour_ml_to_pulses(1));
+}
+
+/**
+ * Test volume with a per-tap calibration (K-factor)
+ */
+void test_calibrated_volume(void) {
+    // A sensor that reads 480 pulses per litre
+    TEST_ASSERT_EQUAL_UINT64(1000000, pour_pulses_to_ul_k(480, 480));
+    TEST_ASSERT_EQUAL_UINT64(240, pour_ml_to_pulses_k(500, 480));
+    
+    // The nominal helpers are the K = 450 case
+    TEST_ASSERT_EQUAL_UINT64(pour_pulses_to_ul(123), pour_pulses_to_ul_k(123, POUR_PULSES_PER_LITER));
+    TEST_ASSERT_EQUAL_UINT64(pour_ml_to_pulses(333), pour_ml_to_pulses_k(333, POUR_PULSES_PER_LITER));
+}
+
+/**
+ * Test fixed-point cost in minor currency units
+ */
+void test_fixed_point_cost(void) {
+    int64_t price = pour_price_from_float(0.005f);  // 0.005 per ml
+    TEST_ASSERT_EQUAL_INT64(5000, price);
+    
+    // 500 ml at 0.005/ml = 2.50
+    TEST_ASSERT_EQUAL_INT64(250, pour_cost_minor_units(500000, price));
+    
+    // 1 pulse (2.222 ml) at 0.005/ml = 0.0111 -> rounds to 1 minor unit
+    TEST_ASSERT_EQUAL_INT64(1, pour_cost_minor_units(pour_pulses_to_ul(1), price));
+}
+
+/**
+ * Test that volume and cost do not drift over a realistic pour
+ * 
+ * ~8000 sampling steps 5-15 ms apart (fixed-seed LCG), flow ramping up to
+ * ~60 Hz (8 L/min), held with jitter and tapering off, so most steps see 0
+ * or 1 pulses. Volume and cost are derived from the running pulse total at
+ * every step like the pour session does, and must match the exact integer
+ * result at every step: at 0.005/ml a pulse is 1/90 of a major unit, so the
+ * cost is round(pulses * 10 / 9) minor units. Folding each step's pulses
+ * into the volume with a carried remainder must land on the same value.
+ */
+void test_fixed_point_no_drift(void) {
+    const int steps = 8000;
+    int64_t price = pour_price_from_float(0.005f);
+    uint32_t seed = 12345;
+    uint64_t phase_mpulses = 0;  // Milli-pulses not yet counted
+    uint64_t pulses = 0;
+    uint64_t folded_ul = 0;
+    uint64_t folded_rem = 0;
+    int64_t last_cost = 0;
+    
+    for (int i = 0; i < steps; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        uint32_t dt_ms = 5 + (seed >> 16) % 11;
+        uint32_t rate_hz = 60;
+        if (i < 1000) {
+            rate_hz = 60 * i / 1000;
+        } else if (i >= steps - 1000) {
+            rate_hz = 60 * (steps - i) / 1000;
+        }
+        int32_t jitter = (int32_t)((seed >> 8) % 11) - 5;  // +-5 Hz
+        int32_t hz = (int32_t)rate_hz + jitter;
+        phase_mpulses += (uint64_t)(hz > 0 ? hz : 0) * dt_ms;
+        uint64_t delta = phase_mpulses / 1000;
+        phase_mpulses %= 1000;
+        pulses += delta;
+        
+        uint64_t volume_ul = pour_pulses_to_ul(pulses);
+        int64_t cost = pour_cost_minor_units(volume_ul, price);
+        TEST_ASSERT_EQUAL_INT64((int64_t)(pulses * 20 + 9) / 18, cost);
+        TEST_ASSERT_TRUE(cost >= last_cost);
+        last_cost = cost;
+        
+        folded_rem += delta * 1000000ULL;
+        folded_ul += folded_rem / POUR_PULSES_PER_LITER;
+        folded_rem %= POUR_PULSES_PER_LITER;
+        TEST_ASSERT_EQUAL_UINT64(volume_ul, folded_ul);
+    }
+    
+    // A long pour, not a handful of pulses
+    TEST_ASSERT_GREATER_THAN_UINT32(3000, (uint32_t)pulses);
+}
+
+/**
+ * Test K-factor curve lookup: clamped at the ends, interpolated between points
+ */
+void test_k_factor_lookup(void) {
+    k_factor_table_t table = {};
+    TEST_ASSERT_EQUAL_UINT32(450, k_factor_lookup(&table, 100, 450));  // Empty: flat calibration
+    
+    TEST_ASSERT_TRUE(k_factor_insert(&table, 600, 480));  // 60 Hz
+    TEST_ASSERT_TRUE(k_factor_insert(&table, 100, 420));  // 10 Hz, sorted in front
+    TEST_ASSERT_EQUAL_UINT8(2, table.count);
+    TEST_ASSERT_EQUAL_UINT16(100, table.points[0].freq_dhz);
+    TEST_ASSERT_TRUE(k_factor_valid(&table));
+    
+    TEST_ASSERT_EQUAL_UINT32(420, k_factor_lookup(&table, 0, 450));
+    TEST_ASSERT_EQUAL_UINT32(420, k_factor_lookup(&table, 100, 450));
+    TEST_ASSERT_EQUAL_UINT32(450, k_factor_lookup(&table, 350, 450));  // Midway
+    TEST_ASSERT_EQUAL_UINT32(480, k_factor_lookup(&table, 2000, 450));
+    
+    uint32_t min_k;
+    uint32_t max_k;
+    k_factor_range(&table, 450, &min_k, &max_k);
+    TEST_ASSERT_EQUAL_UINT32(420, min_k);
+    TEST_ASSERT_EQUAL_UINT32(480, max_k);
+}
+
+/**
+ * Test that re-calibrating near a point replaces it and a full table stays full
+ */
+void test_k_factor_insert(void) {
+    k_factor_table_t table = {};
+    TEST_ASSERT_TRUE(k_factor_insert(&table, 500, 450));
+    TEST_ASSERT_TRUE(k_factor_insert(&table, 520, 460));  // Within 10%: replaces
+    TEST_ASSERT_EQUAL_UINT8(1, table.count);
+    TEST_ASSERT_EQUAL_UINT16(460, table.points[0].pulses_per_liter);
+    
+    TEST_ASSERT_FALSE(k_factor_insert(&table, 300, 50));   // K out of range
+    TEST_ASSERT_FALSE(k_factor_insert(&table, 0, 450));    // No frequency
+    
+    for (uint32_t f = 100; table.count < K_FACTOR_MAX_POINTS; f += 200) {
+        TEST_ASSERT_TRUE(k_factor_insert(&table, f, 440));
+    }
+    TEST_ASSERT_TRUE(k_factor_insert(&table, 5000, 470));
+    TEST_ASSERT_EQUAL_UINT8(K_FACTOR_MAX_POINTS, table.count);
+    TEST_ASSERT_TRUE(k_factor_valid(&table));
+    TEST_ASSERT_EQUAL_UINT16(5000, table.points[K_FACTOR_MAX_POINTS - 1].freq_dhz);
+}
+
+/**
+ * Test a calibration pour measurement and volume along a curve
+ */
+void test_k_factor_measurement(void) {
+    // 470 pulses for 982 ml over 31.2 s of flow
+    TEST_ASSERT_EQUAL_UINT32(151, k_factor_freq_dhz(470, 31200));
+    TEST_ASSERT_EQUAL_UINT32(479, k_factor_from_volume(470, 982));
+    
+    // Summed per sample, the curve volume matches one conversion at constant K
+    uint64_t volume_nl = 0;
+    for (int i = 0; i < 480; i++) {
+        volume_nl += k_factor_volume_nl(1, 480);
+    }
+    TEST_ASSERT_UINT64_WITHIN(1000, 1000000000ULL, volume_nl);
+    TEST_ASSERT_EQUAL_UINT64(pour_pulses_to_ul_k(480, 480), k_factor_volume_nl(480, 480) / 1000ULL);
+}
+
+/**
+ * Test log bucket placement: every value lies in its bucket's bounds
+ */
+void test_flow_hist_buckets(void) {
+    TEST_ASSERT_EQUAL_UINT32(0, flow_hist_bucket(0));
+    TEST_ASSERT_EQUAL_UINT32(3, flow_hist_bucket(3));
+    TEST_ASSERT_EQUAL_UINT32(4, flow_hist_bucket(4));
+    TEST_ASSERT_EQUAL_UINT32(4, flow_hist_bucket(5));
+    TEST_ASSERT_EQUAL_UINT32(5, flow_hist_bucket(6));
+    TEST_ASSERT_EQUAL_UINT32(6, flow_hist_bucket(8));
+    
+    for (uint32_t value = 1; value < 1000000; value = value * 3 / 2 + 1) {
+        uint32_t bucket = flow_hist_bucket(value);
+        TEST_ASSERT_TRUE(flow_hist_bucket_lower(bucket) <= value);
+        TEST_ASSERT_TRUE(value < flow_hist_bucket_lower(bucket + 1));
+    }
+    
+    // Past the range: counted in the last bucket
+    TEST_ASSERT_EQUAL_UINT32(FLOW_HIST_BUCKETS - 1, flow_hist_bucket(0xFFFFFFFFU));
+}
+
+/**
+ * Test the sparse histogram encoding
+ */
+void test_flow_hist_encode(void) {
+    flow_hist_t h = {};
+    uint8_t out[FLOW_HIST_ENCODED_MAX];
+    TEST_ASSERT_EQUAL_UINT32(2, flow_hist_encode(&h, out));  // No buckets, zero sum
+    
+    for (int i = 0; i < 200; i++) {
+        flow_hist_add(&h, 6000);  // 6 L/min in mL/min
+    }
+    flow_hist_add(&h, 2);
+    TEST_ASSERT_EQUAL_UINT32(201, flow_hist_count(&h));
+    
+    size_t len = flow_hist_encode(&h, out);
+    TEST_ASSERT_EQUAL_UINT32(2, out[0]);
+    TEST_ASSERT_EQUAL_UINT32(2, out[1]);    // Bucket 2, count 1
+    TEST_ASSERT_EQUAL_UINT32(1, out[2]);
+    TEST_ASSERT_EQUAL_UINT32(flow_hist_bucket(6000), out[3]);
+    TEST_ASSERT_EQUAL_UINT32(0xC8, out[4]); // 200 as LEB128
+    TEST_ASSERT_EQUAL_UINT32(0x01, out[5]);
+    TEST_ASSERT_EQUAL_UINT32(9, len);       // ... then 1200002 in 3 bytes
+}
+
 void setup() {
     // Wait for serial monitor to connect (for native testing)
     delay(2000);
@@ -130,6 +337,15 @@ void setup() {
     RUN_TEST(test_volume_calculation);
     RUN_TEST(test_flow_rate_edge_cases);
     RUN_TEST(test_volume_edge_cases);
+    RUN_TEST(test_fixed_point_volume);
+    RUN_TEST(test_calibrated_volume);
+    RUN_TEST(test_fixed_point_cost);
+    RUN_TEST(test_fixed_point_no_drift);
+    RUN_TEST(test_k_factor_lookup);
+    RUN_TEST(test_k_factor_insert);
+    RUN_TEST(test_k_factor_measurement);
+    RUN_TEST(test_flow_hist_buckets);
+    RUN_TEST(test_flow_hist_encode);
     
     UNITY_END();
 }
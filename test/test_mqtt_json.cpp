@@ -9,6 +9,8 @@
 #include <Arduino.h>
 #include <ArduinoJson.h>
 
+#include "mqtt/seen_id_cache.h"
+
 /**
  * Validate MQTT "paid" command JSON payload
  * Returns true if valid, false otherwise
@@ -167,6 +169,49 @@ void test_valid_json_usd_currency(void) {
     TEST_ASSERT_EQUAL_STRING("USD", currency);
 }
 
+/**
+ * Test a redelivered paid command ID is recognised
+ */
+void test_seen_id_duplicate(void) {
+    static seen_id_cache_t cache;
+    seen_id_clear(&cache);
+    
+    TEST_ASSERT_FALSE(seen_id_check_and_add(&cache, "tx_12345"));
+    TEST_ASSERT_FALSE(seen_id_check_and_add(&cache, "tx_12346"));
+    TEST_ASSERT_TRUE(seen_id_check_and_add(&cache, "tx_12345"));
+    TEST_ASSERT_TRUE(seen_id_check_and_add(&cache, "tx_12346"));
+}
+
+/**
+ * Test the cache stays bounded and keeps the most recent IDs
+ */
+void test_seen_id_eviction(void) {
+    static seen_id_cache_t cache;
+    seen_id_clear(&cache);
+    char id[32];
+    
+    // Far more IDs than the cache holds
+    const int total = SEEN_ID_SETS * SEEN_ID_WAYS * 4;
+    for (int i = 0; i < total; i++) {
+        snprintf(id, sizeof(id), "pour-%d", i);
+        TEST_ASSERT_FALSE(seen_id_check_and_add(&cache, id));
+    }
+    
+    // The most recent SEEN_ID_WAYS are always kept, whichever sets they fall in
+    for (int i = total - 1; i >= total - SEEN_ID_WAYS; i--) {
+        snprintf(id, sizeof(id), "pour-%d", i);
+        TEST_ASSERT_TRUE(seen_id_check_and_add(&cache, id));
+    }
+    
+    // The first ones have been dropped
+    int remembered = 0;
+    for (int i = 0; i < 16; i++) {
+        snprintf(id, sizeof(id), "pour-%d", i);
+        remembered += seen_id_check_and_add(&cache, id) ? 1 : 0;
+    }
+    TEST_ASSERT_EQUAL_INT(0, remembered);
+}
+
 void setup() {
     // Wait for serial monitor to connect (for native testing)
     delay(2000);
@@ -181,6 +226,8 @@ void setup() {
     RUN_TEST(test_invalid_json_zero_max_ml);
     RUN_TEST(test_invalid_json_invalid_currency);
     RUN_TEST(test_valid_json_usd_currency);
+    RUN_TEST(test_seen_id_duplicate);
+    RUN_TEST(test_seen_id_eviction);
     
     UNITY_END();
 }
@@ -0,0 +1,233 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Unit tests and benchmark for RLE image decoding
+ */
+
+#include <unity.h>
+#include <Arduino.h>
+
+#include "utils/rle_decode.h"
+#include "images/precision_pour_logo.h"
+#include "images/test_logo.h"
+
+#define BENCH_ITERATIONS 50
+
+static uint8_t* encoded = NULL;
+static uint8_t* expected = NULL;
+static uint8_t* decoded = NULL;
+
+/**
+ * Reference decoder: the byte-at-a-time loop rle_decompress() used before
+ * the fast path, with its per-byte bounds checks (logging removed)
+ */
+int reference_decompress(const uint8_t* compressed_data, size_t compressed_size,
+                         uint8_t* output_buffer, size_t output_size) {
+    size_t output_pos = 0;
+    size_t input_pos = 0;
+    
+    while (input_pos < compressed_size && output_pos < output_size) {
+        if (compressed_data[input_pos] == 0xFF) {
+            if (input_pos + 1 < compressed_size && compressed_data[input_pos + 1] == 0x00) {
+                if (output_pos >= output_size) {
+                    return -1;
+                }
+                output_buffer[output_pos++] = 0xFF;
+                input_pos += 2;
+            } else if (input_pos + 2 < compressed_size) {
+                uint8_t count = compressed_data[input_pos + 1];
+                uint8_t value = compressed_data[input_pos + 2];
+                if (output_pos + count > output_size) {
+                    return -1;
+                }
+                memset(&output_buffer[output_pos], value, count);
+                output_pos += count;
+                input_pos += 3;
+            } else {
+                if (output_pos >= output_size) {
+                    return -1;
+                }
+                output_buffer[output_pos++] = compressed_data[input_pos++];
+            }
+        } else {
+            if (output_pos >= output_size) {
+                return -1;
+            }
+            output_buffer[output_pos++] = compressed_data[input_pos++];
+        }
+    }
+    
+    return output_pos == output_size ? 0 : -1;
+}
+
+/**
+ * Encoder for the format in rle_decompress.h: runs of 4+ bytes become
+ * 0xFF, count, value and a literal 0xFF becomes 0xFF 0x00
+ */
+size_t encode(const uint8_t* in, size_t in_size, uint8_t* out) {
+    size_t op = 0;
+    size_t ip = 0;
+    while (ip < in_size) {
+        size_t run = 1;
+        while (ip + run < in_size && in[ip + run] == in[ip] && run < 255) {
+            run++;
+        }
+        if (run >= 4) {
+            out[op++] = 0xFF;
+            out[op++] = (uint8_t)run;
+            out[op++] = in[ip];
+            ip += run;
+        } else if (in[ip] == 0xFF) {
+            out[op++] = 0xFF;
+            out[op++] = 0x00;
+            ip++;
+        } else {
+            out[op++] = in[ip++];
+        }
+    }
+    return op;
+}
+
+static uint32_t bench_reference(const uint8_t* in, size_t in_size, uint8_t* out, size_t out_size) {
+    uint32_t start = micros();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        reference_decompress(in, in_size, out, out_size);
+    }
+    return micros() - start;
+}
+
+static uint32_t bench_fast(const uint8_t* in, size_t in_size, uint8_t* out, size_t out_size) {
+    uint32_t start = micros();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        rle_decode(in, in_size, out, out_size, NULL);
+    }
+    return micros() - start;
+}
+
+static void report(const char* name, uint32_t reference_us, uint32_t fast_us) {
+    char msg[128];
+    snprintf(msg, sizeof(msg), "%s: reference %lu us, fast %lu us per decode",
+             name, (unsigned long)(reference_us / BENCH_ITERATIONS), (unsigned long)(fast_us / BENCH_ITERATIONS));
+    TEST_MESSAGE(msg);
+}
+
+void setUp(void) {
+    // Worst case encoding of test_logo (every byte a literal 0xFF) is 2x
+    encoded = (uint8_t*)malloc(test_logo.data_size * 2);
+    expected = (uint8_t*)malloc(test_logo.data_size);
+    decoded = (uint8_t*)malloc(test_logo.data_size);
+}
+
+void tearDown(void) {
+    free(encoded);
+    free(expected);
+    free(decoded);
+}
+
+/**
+ * Test fast decoder output matches the reference on the production logo
+ */
+void test_decode_precision_pour_logo(void) {
+    const size_t size = PRECISION_POUR_LOGO_UNCOMPRESSED_SIZE;
+    TEST_ASSERT_EQUAL(0, reference_decompress(precision_pour_logo.data, precision_pour_logo.data_size, expected, size));
+    
+    size_t used = 0;
+    long written = rle_decode(precision_pour_logo.data, precision_pour_logo.data_size, decoded, size, &used);
+    TEST_ASSERT_EQUAL(size, written);
+    TEST_ASSERT_EQUAL(precision_pour_logo.data_size, used);
+    TEST_ASSERT_EQUAL_MEMORY(expected, decoded, size);
+}
+
+/**
+ * Test round trip of the (uncompressed) test logo through the encoder
+ */
+void test_decode_test_logo(void) {
+    const size_t size = test_logo.data_size;
+    size_t encoded_size = encode(test_logo.data, size, encoded);
+    
+    long written = rle_decode(encoded, encoded_size, decoded, size, NULL);
+    TEST_ASSERT_EQUAL(size, written);
+    TEST_ASSERT_EQUAL_MEMORY(test_logo.data, decoded, size);
+}
+
+/**
+ * Test escaped 0xFF, runs, truncated marker and word-unaligned fills
+ */
+void test_decode_edge_cases(void) {
+    const uint8_t in[] = { 0x01, 0xFF, 0x00, 0xFF, 0x07, 0xAA, 0x02, 0xFF };
+    const uint8_t out_expected[] = { 0x01, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x02, 0xFF };
+    uint8_t out[sizeof(out_expected)] = {0};
+    
+    long written = rle_decode(in, sizeof(in), out, sizeof(out), NULL);
+    TEST_ASSERT_EQUAL(sizeof(out_expected), written);
+    TEST_ASSERT_EQUAL_MEMORY(out_expected, out, sizeof(out_expected));
+}
+
+/**
+ * Test a run longer than the output is rejected
+ */
+void test_decode_run_overflow(void) {
+    const uint8_t in[] = { 0xFF, 0x10, 0x55 };
+    uint8_t out[8];
+    TEST_ASSERT_EQUAL(-1, rle_decode(in, sizeof(in), out, sizeof(out), NULL));
+}
+
+/**
+ * Test band-by-band stream decoding matches a one-shot decode, including runs
+ * split across bands (4 scanlines of the logo is not a run boundary)
+ */
+void test_stream_decode_bands(void) {
+    const size_t size = PRECISION_POUR_LOGO_UNCOMPRESSED_SIZE;
+    const size_t band = precision_pour_logo.header.w * 2 * 4;
+    TEST_ASSERT_EQUAL(size, rle_decode(precision_pour_logo.data, precision_pour_logo.data_size, expected, size, NULL));
+    
+    rle_stream_t stream;
+    rle_stream_init(&stream, precision_pour_logo.data, precision_pour_logo.data_size);
+    for (size_t offset = 0; offset < size; offset += band) {
+        size_t n = size - offset < band ? size - offset : band;
+        TEST_ASSERT_EQUAL(n, rle_stream_read(&stream, decoded + offset, n));
+    }
+    TEST_ASSERT_EQUAL_MEMORY(expected, decoded, size);
+    
+    // Input exhausted: nothing more to read
+    TEST_ASSERT_EQUAL(0, rle_stream_read(&stream, decoded, band));
+}
+
+/**
+ * Benchmark: fast decoder against the byte-at-a-time decoder on both logos
+ * Timings are reported only - wall-clock comparisons would make the test flaky
+ */
+void test_benchmark_decode(void) {
+    const size_t logo_size = PRECISION_POUR_LOGO_UNCOMPRESSED_SIZE;
+    uint32_t ref_us = bench_reference(precision_pour_logo.data, precision_pour_logo.data_size, decoded, logo_size);
+    uint32_t fast_us = bench_fast(precision_pour_logo.data, precision_pour_logo.data_size, decoded, logo_size);
+    report("precision_pour_logo", ref_us, fast_us);
+    
+    const size_t test_size = test_logo.data_size;
+    size_t encoded_size = encode(test_logo.data, test_size, encoded);
+    ref_us = bench_reference(encoded, encoded_size, decoded, test_size);
+    fast_us = bench_fast(encoded, encoded_size, decoded, test_size);
+    report("test_logo", ref_us, fast_us);
+    TEST_ASSERT_EQUAL_MEMORY(test_logo.data, decoded, test_size);
+}
+
+void setup() {
+    // Wait for serial monitor to connect
+    delay(2000);
+    
+    UNITY_BEGIN();
+    
+    RUN_TEST(test_decode_precision_pour_logo);
+    RUN_TEST(test_decode_test_logo);
+    RUN_TEST(test_decode_edge_cases);
+    RUN_TEST(test_decode_run_overflow);
+    RUN_TEST(test_stream_decode_bands);
+    RUN_TEST(test_benchmark_decode);
+    
+    UNITY_END();
+}
+
+void loop() {
+    // Empty - tests run once in setup()
+}
@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Host shim: GPIO configuration is accepted and ignored; ISR handlers and
+ * output levels are kept per pin so the harness can raise edges and watch
+ * the valve
+ */
+
+#ifndef REPLAY_SHIM_GPIO_H
+#define REPLAY_SHIM_GPIO_H
+
+#include <stdint.h>
+#include "esp_err.h"
+
+#define SHIM_GPIO_PINS 40
+
+typedef int gpio_num_t;
+typedef void (*gpio_isr_t)(void* arg);
+
+typedef enum { GPIO_MODE_DISABLE, GPIO_MODE_INPUT, GPIO_MODE_OUTPUT } gpio_mode_t;
+typedef enum { GPIO_PULLUP_DISABLE, GPIO_PULLUP_ENABLE } gpio_pullup_t;
+typedef enum { GPIO_PULLDOWN_DISABLE, GPIO_PULLDOWN_ENABLE } gpio_pulldown_t;
+typedef enum { GPIO_INTR_DISABLE, GPIO_INTR_POSEDGE, GPIO_INTR_NEGEDGE, GPIO_INTR_ANYEDGE } gpio_int_type_t;
+typedef enum { GPIO_PULLUP_ONLY, GPIO_PULLDOWN_ONLY, GPIO_PULLUP_PULLDOWN, GPIO_FLOATING } gpio_pull_mode_t;
+
+typedef struct {
+    uint64_t pin_bit_mask;
+    gpio_mode_t mode;
+    gpio_pullup_t pull_up_en;
+    gpio_pulldown_t pull_down_en;
+    gpio_int_type_t intr_type;
+} gpio_config_t;
+
+// Output levels, shared with gpio_ll_set_level (hal/gpio_ll.h)
+typedef struct {
+    int level[SHIM_GPIO_PINS];
+} gpio_dev_t;
+
+inline gpio_dev_t GPIO = {};
+inline gpio_isr_t shim_gpio_isr[SHIM_GPIO_PINS] = {};
+inline void* shim_gpio_isr_arg[SHIM_GPIO_PINS] = {};
+
+static inline bool shim_gpio_valid(gpio_num_t pin) { return pin >= 0 && pin < SHIM_GPIO_PINS; }
+
+static inline esp_err_t gpio_config(const gpio_config_t* config) { (void)config; return ESP_OK; }
+static inline esp_err_t gpio_set_pull_mode(gpio_num_t pin, gpio_pull_mode_t mode) { (void)pin; (void)mode; return ESP_OK; }
+static inline esp_err_t gpio_set_intr_type(gpio_num_t pin, gpio_int_type_t type) { (void)pin; (void)type; return ESP_OK; }
+
+static inline esp_err_t gpio_set_level(gpio_num_t pin, uint32_t level) {
+    if (!shim_gpio_valid(pin)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    GPIO.level[pin] = (int)level;
+    return ESP_OK;
+}
+
+static inline esp_err_t gpio_isr_handler_add(gpio_num_t pin, gpio_isr_t handler, void* arg) {
+    if (!shim_gpio_valid(pin)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    shim_gpio_isr[pin] = handler;
+    shim_gpio_isr_arg[pin] = arg;
+    return ESP_OK;
+}
+
+static inline esp_err_t gpio_isr_handler_remove(gpio_num_t pin) {
+    if (!shim_gpio_valid(pin)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    shim_gpio_isr[pin] = NULL;
+    shim_gpio_isr_arg[pin] = NULL;
+    return ESP_OK;
+}
+
+#endif // REPLAY_SHIM_GPIO_H
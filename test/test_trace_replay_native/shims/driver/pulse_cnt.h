@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Host shim: a software PCNT unit. shim_pcnt_edge() counts one rising edge
+ * on a pin and fires on_reach for a watch point the way the hardware does,
+ * resetting the count to 0 at the high limit. The glitch filter is not
+ * modelled (it is 1 us, far below any recorded edge spacing).
+ */
+
+#ifndef REPLAY_SHIM_PULSE_CNT_H
+#define REPLAY_SHIM_PULSE_CNT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#define SHIM_PCNT_UNITS 8
+#define SHIM_PCNT_WATCH_POINTS 4
+
+typedef struct pcnt_unit_t* pcnt_unit_handle_t;
+typedef struct pcnt_unit_t* pcnt_channel_handle_t;  // One channel per unit, same object
+
+typedef struct {
+    int low_limit;
+    int high_limit;
+} pcnt_unit_config_t;
+
+typedef struct {
+    uint32_t max_glitch_ns;
+} pcnt_glitch_filter_config_t;
+
+typedef struct {
+    int edge_gpio_num;
+    int level_gpio_num;
+} pcnt_chan_config_t;
+
+typedef enum {
+    PCNT_CHANNEL_EDGE_ACTION_HOLD,
+    PCNT_CHANNEL_EDGE_ACTION_INCREASE,
+    PCNT_CHANNEL_EDGE_ACTION_DECREASE,
+} pcnt_channel_edge_action_t;
+
+typedef struct {
+    int watch_point_value;
+} pcnt_watch_event_data_t;
+
+typedef bool (*pcnt_watch_cb_t)(pcnt_unit_handle_t unit, const pcnt_watch_event_data_t* edata, void* user_ctx);
+
+typedef struct {
+    pcnt_watch_cb_t on_reach;
+} pcnt_event_callbacks_t;
+
+struct pcnt_unit_t {
+    int high_limit;
+    int pin;
+    int count;
+    bool running;
+    int watch[SHIM_PCNT_WATCH_POINTS];
+    int watch_count;
+    pcnt_watch_cb_t on_reach;
+    void* user_ctx;
+};
+
+inline pcnt_unit_t shim_pcnt_units[SHIM_PCNT_UNITS] = {};
+inline int shim_pcnt_unit_count = 0;
+
+static inline esp_err_t pcnt_new_unit(const pcnt_unit_config_t* config, pcnt_unit_handle_t* out) {
+    if (shim_pcnt_unit_count >= SHIM_PCNT_UNITS) {
+        return ESP_FAIL;
+    }
+    pcnt_unit_t* unit = &shim_pcnt_units[shim_pcnt_unit_count++];
+    *unit = pcnt_unit_t{};
+    unit->high_limit = config->high_limit;
+    unit->pin = -1;
+    *out = unit;
+    return ESP_OK;
+}
+
+static inline esp_err_t pcnt_unit_set_glitch_filter(pcnt_unit_handle_t unit, const pcnt_glitch_filter_config_t* config) {
+    (void)unit; (void)config;
+    return ESP_OK;
+}
+
+static inline esp_err_t pcnt_new_channel(pcnt_unit_handle_t unit, const pcnt_chan_config_t* config, pcnt_channel_handle_t* out) {
+    unit->pin = config->edge_gpio_num;
+    *out = unit;
+    return ESP_OK;
+}
+
+static inline esp_err_t pcnt_channel_set_edge_action(pcnt_channel_handle_t chan, pcnt_channel_edge_action_t pos,
+                                                     pcnt_channel_edge_action_t neg) {
+    (void)chan; (void)pos; (void)neg;
+    return ESP_OK;
+}
+
+static inline esp_err_t pcnt_unit_add_watch_point(pcnt_unit_handle_t unit, int value) {
+    if (unit->watch_count >= SHIM_PCNT_WATCH_POINTS || value > unit->high_limit) {
+        return ESP_FAIL;
+    }
+    for (int i = 0; i < unit->watch_count; i++) {
+        if (unit->watch[i] == value) {
+            return ESP_ERR_INVALID_STATE;
+        }
+    }
+    unit->watch[unit->watch_count++] = value;
+    return ESP_OK;
+}
+
+static inline esp_err_t pcnt_unit_remove_watch_point(pcnt_unit_handle_t unit, int value) {
+    for (int i = 0; i < unit->watch_count; i++) {
+        if (unit->watch[i] == value) {
+            unit->watch[i] = unit->watch[--unit->watch_count];
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_INVALID_STATE;
+}
+
+static inline esp_err_t pcnt_unit_register_event_callbacks(pcnt_unit_handle_t unit, const pcnt_event_callbacks_t* cbs,
+                                                           void* user_ctx) {
+    unit->on_reach = cbs->on_reach;
+    unit->user_ctx = user_ctx;
+    return ESP_OK;
+}
+
+static inline esp_err_t pcnt_unit_enable(pcnt_unit_handle_t unit) { (void)unit; return ESP_OK; }
+static inline esp_err_t pcnt_unit_start(pcnt_unit_handle_t unit) { unit->running = true; return ESP_OK; }
+static inline esp_err_t pcnt_unit_clear_count(pcnt_unit_handle_t unit) { unit->count = 0; return ESP_OK; }
+
+static inline esp_err_t pcnt_unit_get_count(pcnt_unit_handle_t unit, int* value) {
+    *value = unit->count;
+    return ESP_OK;
+}
+
+// Count a rising edge on pin (no-op if no running unit watches it)
+static inline void shim_pcnt_edge(int pin) {
+    for (int u = 0; u < shim_pcnt_unit_count; u++) {
+        pcnt_unit_t* unit = &shim_pcnt_units[u];
+        if (unit->pin != pin || !unit->running) {
+            continue;
+        }
+        unit->count++;
+        for (int i = 0; i < unit->watch_count; i++) {
+            if (unit->watch[i] == unit->count && unit->on_reach != NULL) {
+                pcnt_watch_event_data_t edata = {unit->count};
+                unit->on_reach(unit, &edata, unit->user_ctx);
+            }
+        }
+        if (unit->count >= unit->high_limit) {
+            unit->count = 0;
+        }
+    }
+}
+
+#endif // REPLAY_SHIM_PULSE_CNT_H
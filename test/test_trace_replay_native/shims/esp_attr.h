@@ -0,0 +1,14 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Host shim: placement attributes are no-ops
+ */
+
+#ifndef REPLAY_SHIM_ESP_ATTR_H
+#define REPLAY_SHIM_ESP_ATTR_H
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+#endif // REPLAY_SHIM_ESP_ATTR_H
@@ -0,0 +1,18 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Host shim: esp_timer reads the replay clock, which the harness moves to
+ * each edge and sampling step
+ */
+
+#ifndef REPLAY_SHIM_ESP_TIMER_H
+#define REPLAY_SHIM_ESP_TIMER_H
+
+#include <stdint.h>
+
+inline int64_t shim_time_us = 0;
+
+static inline int64_t esp_timer_get_time(void) { return shim_time_us; }
+
+#endif // REPLAY_SHIM_ESP_TIMER_H
@@ -0,0 +1,13 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Host shim: port macros live in FreeRTOS.h
+ */
+
+#ifndef REPLAY_SHIM_PORTMACRO_H
+#define REPLAY_SHIM_PORTMACRO_H
+
+#include "freertos/FreeRTOS.h"
+
+#endif // REPLAY_SHIM_PORTMACRO_H
@@ -0,0 +1,21 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Host shim: mutexes always succeed (single threaded replay)
+ */
+
+#ifndef REPLAY_SHIM_SEMPHR_H
+#define REPLAY_SHIM_SEMPHR_H
+
+#include "freertos/FreeRTOS.h"
+
+typedef void* SemaphoreHandle_t;
+
+inline int shim_mutex_storage = 0;
+
+static inline SemaphoreHandle_t xSemaphoreCreateMutex(void) { return &shim_mutex_storage; }
+static inline BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t wait) { (void)sem; (void)wait; return pdTRUE; }
+static inline BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) { (void)sem; return pdTRUE; }
+
+#endif // REPLAY_SHIM_SEMPHR_H
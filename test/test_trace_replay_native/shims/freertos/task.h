@@ -0,0 +1,30 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Host shim: no tasks - creation fails, so the flow meter falls back to
+ * being stepped through flow_meter_update() by the harness
+ */
+
+#ifndef REPLAY_SHIM_TASK_H
+#define REPLAY_SHIM_TASK_H
+
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+static inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack, void* arg,
+                                                 uint32_t priority, TaskHandle_t* handle, int core) {
+    (void)fn; (void)name; (void)stack; (void)arg; (void)priority; (void)core;
+    if (handle != NULL) {
+        *handle = NULL;
+    }
+    return pdFAIL;
+}
+
+static inline TickType_t xTaskGetTickCount(void) { return 0; }
+static inline void vTaskDelayUntil(TickType_t* last_wake, TickType_t period) { *last_wake += period; }
+
+#endif // REPLAY_SHIM_TASK_H
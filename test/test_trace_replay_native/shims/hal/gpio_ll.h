@@ -0,0 +1,20 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Host shim: register-level output writes land in the same level table as
+ * gpio_set_level
+ */
+
+#ifndef REPLAY_SHIM_GPIO_LL_H
+#define REPLAY_SHIM_GPIO_LL_H
+
+#include "driver/gpio.h"
+
+static inline void gpio_ll_set_level(gpio_dev_t* hw, gpio_num_t pin, uint32_t level) {
+    if (shim_gpio_valid(pin)) {
+        hw->level[pin] = (int)level;
+    }
+}
+
+#endif // REPLAY_SHIM_GPIO_LL_H
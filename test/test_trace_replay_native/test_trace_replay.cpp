@@ -0,0 +1,584 @@
+/**
+ * Copyright (c) 2026 Dynamic Devices Ltd
+ * All rights reserved.
+ * 
+ * Pulse trace replay
+ * 
+ * Replays flow meter edges (flow/pulse_trace.h) through the production flow
+ * meter and pour controller (src/flow/flow_meter.cpp, pour_controller.cpp)
+ * on the build machine, against the shims in shims/: esp_timer reads a
+ * replay clock, PCNT is counted in software and, with no sampling task,
+ * flow_meter_update() runs every FLOW_SAMPLING_PERIOD_MS of replay time.
+ * 
+ * For each trace:
+ * - rate accuracy: mean absolute error of the fast, smoothed and 1 s rates
+ *   against the rate over a RATE_REFERENCE_US window centred on each sample
+ * - volume error against edges / K
+ * - cut-off overshoot over REPLAY_POURS pours of POUR_FRACTION of the trace,
+ *   with the flow stopping VALVE_LATENCY_US after the valve is closed, and
+ *   the stop latency the controller learned from them, and the longest
+ *   time from the limit pulse to the cut-off callback (replay clock)
+ * - host CPU per sampling step and per edge (relative, not ESP32 timings)
+ * 
+ * The synthetic traces below always run. Recorded traces (tools/pulse_trace.py)
+ * are added with PULSE_TRACES=a.ptrace:b.ptrace. Results are printed as one
+ * JSON object per line and, if REPLAY_OUTPUT is set, written to that file:
+ *   {"trace":"ramp_steady","edges":1172,"mae_fast_lpm":0.41,...,"overshoot_last_ml":0.6,"stop_latency_us":142000,"cutoff_lag_us":0,...}
+ * 
+ *   pio test -e native_replay -v
+ *   PULSE_TRACES=bar1.ptrace REPLAY_OUTPUT=replay.jsonl pio test -e native_replay
+ */
+
+#include <unity.h>
+
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "config.h"
+#include "flow/flow_meter.h"
+#include "flow/flow_stats.h"
+#include "flow/pour_controller.h"
+#include "flow/pour_math.h"
+#include "flow/pulse_trace.h"
+#include "system/app_events.h"
+#include "system/config_store.h"
+#include "system/perf_monitor.h"
+
+#include <driver/gpio.h>
+#include <driver/pulse_cnt.h>
+#include <esp_timer.h>
+
+#define REPLAY_TAP 0
+#define SAMPLE_PERIOD_US ((uint64_t)FLOW_SAMPLING_PERIOD_MS * 1000ULL)
+#define RATE_REFERENCE_US 500000ULL  // Centred window for the reference rate
+#define VALVE_LATENCY_US 150000ULL   // Modelled valve: flow stops this long after the close
+#define REPLAY_POURS 8
+#define POUR_FRACTION 0.6            // Pour target as a share of the trace's edges
+#define SYNTH_K 450                  // K of the synthetic traces (YF-S201)
+#define VALVE_LEVEL_CLOSED (POUR_VALVE_ACTIVE_HIGH ? 0 : 1)
+
+static FILE* output = NULL;
+
+// ---------------------------------------------------------------------------
+// Firmware dependencies outside the replayed modules
+// ---------------------------------------------------------------------------
+
+void app_events_post(uint32_t events) {
+    (void)events;
+}
+
+// No curve: the flat calibration, set from each trace's header
+void config_store_get_k_factor(uint8_t tap, k_factor_table_t* out) {
+    (void)tap;
+    memset(out, 0, sizeof(*out));
+}
+
+// Nothing saved: every cut-off run learns from POUR_STOP_LATENCY_DEFAULT_MS
+uint32_t config_store_get_stop_latency_us(uint8_t tap) {
+    (void)tap;
+    return 0;
+}
+
+void config_store_set_stop_latency_us(uint8_t tap, uint32_t us) {
+    (void)tap;
+    (void)us;
+}
+
+void flow_stats_sample(uint8_t tap, uint32_t pulses, uint32_t noise_edges, float rate_lpm, uint32_t step_ms) {
+    (void)tap;
+    (void)pulses;
+    (void)noise_edges;
+    (void)rate_lpm;
+    (void)step_ms;
+}
+
+// Only the cut-off lag is kept
+static uint32_t cutoff_lag_max_us = 0;
+
+void perf_monitor_record(perf_metric_t metric, uint32_t value) {
+    if (metric == PERF_CUTOFF_US && value > cutoff_lag_max_us) {
+        cutoff_lag_max_us = value;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Replay clock
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    const std::vector<uint64_t>* edges;  // Edge times since start_us
+    uint64_t start_us;
+    uint32_t k;
+    double err_fast;
+    double err_smoothed;
+    double err_window;
+    uint32_t samples;
+} accuracy_t;
+
+static uint64_t next_sample_us = 0;
+static accuracy_t* accuracy = NULL;  // Scoring the samples when set
+static uint64_t sample_ns = 0;
+static uint64_t sample_steps = 0;
+static uint64_t edge_ns = 0;
+static uint64_t edges_raised = 0;
+
+static uint64_t now_ns() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static bool valve_closed() {
+    return GPIO.level[POUR_VALVE_PIN] == VALVE_LEVEL_CLOSED;
+}
+
+// Flow rate over the reference window centred on now, from the edges themselves
+static float reference_lpm(const accuracy_t* a, uint64_t now_us) {
+    int64_t rel = (int64_t)(now_us - a->start_us);
+    int64_t from = rel - (int64_t)(RATE_REFERENCE_US / 2);
+    int64_t to = rel + (int64_t)(RATE_REFERENCE_US / 2);
+    auto lo = std::lower_bound(a->edges->begin(), a->edges->end(), (uint64_t)std::max<int64_t>(from, 0));
+    auto hi = std::lower_bound(a->edges->begin(), a->edges->end(), (uint64_t)std::max<int64_t>(to, 0));
+    double hz = (double)(hi - lo) * 1000000.0 / (double)RATE_REFERENCE_US;
+    return (float)(hz * 60.0 / (double)a->k);
+}
+
+// One sampling task period: the flow meter, then the main loop's pour controller step
+static void sample_step() {
+    shim_time_us = (int64_t)next_sample_us;
+    uint64_t start = now_ns();
+    flow_meter_update();
+    sample_ns += now_ns() - start;
+    sample_steps++;
+    pour_controller_update();
+    
+    if (accuracy != NULL && next_sample_us >= accuracy->start_us) {
+        float ref = reference_lpm(accuracy, next_sample_us);
+        accuracy->err_fast += fabs(flow_meter_get_flow_rate_fast(REPLAY_TAP) - ref);
+        accuracy->err_smoothed += fabs(flow_meter_get_flow_rate_smoothed(REPLAY_TAP) - ref);
+        accuracy->err_window += fabs(flow_meter_get_flow_rate_lpm(REPLAY_TAP) - ref);
+        accuracy->samples++;
+    }
+    next_sample_us += SAMPLE_PERIOD_US;
+}
+
+// Run the sampling steps due up to time_us, then move the clock there
+static void advance_to(uint64_t time_us) {
+    while (next_sample_us <= time_us) {
+        sample_step();
+    }
+    shim_time_us = (int64_t)time_us;
+}
+
+static void idle(uint64_t us) {
+    advance_to((uint64_t)shim_time_us + us);
+}
+
+// A rising edge on the tap's pin, seen by PCNT and any GPIO interrupt as on the device
+static void raise_edge() {
+    uint64_t start = now_ns();
+    shim_pcnt_edge(FLOW_METER_PIN);
+    gpio_isr_t isr = shim_gpio_isr[FLOW_METER_PIN];
+    if (isr != NULL) {
+        isr(shim_gpio_isr_arg[FLOW_METER_PIN]);
+    }
+    edge_ns += now_ns() - start;
+    edges_raised++;
+}
+
+// ---------------------------------------------------------------------------
+// Traces
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    std::string name;
+    std::vector<uint8_t> image;
+    bool synthetic;
+} trace_input_t;
+
+// Image (header then data) of a recording
+static std::vector<uint8_t> trace_image(const pulse_trace_t* t) {
+    std::vector<uint8_t> image(sizeof(t->header) + t->header.data_len);
+    memcpy(image.data(), &t->header, sizeof(t->header));
+    memcpy(image.data() + sizeof(t->header), t->data, t->header.data_len);
+    return image;
+}
+
+static bool decode(const std::vector<uint8_t>& image, pulse_trace_header_t* header, std::vector<uint64_t>* edges) {
+    pulse_trace_reader_t reader;
+    if (!pulse_trace_reader_init(&reader, image.data(), image.size())) {
+        return false;
+    }
+    memcpy(header, image.data(), sizeof(*header));
+    edges->clear();
+    uint32_t time_us;
+    while (pulse_trace_next(&reader, &time_us)) {
+        edges->push_back(reader.elapsed_us);
+    }
+    return edges->size() == header->count;
+}
+
+static uint32_t lcg_state = 1;
+
+// Uniform in [-1, 1), deterministic across runs
+static double lcg_unit() {
+    lcg_state = lcg_state * 1664525U + 1013904223U;
+    return (double)(lcg_state >> 8) / (double)(1U << 23) - 1.0;
+}
+
+typedef double (*rate_profile_t)(double t_s);  // Pulse frequency (Hz) at t seconds
+
+// 0 -> 20 L/min in 1.5 s, 4 s steady, back to 0 in 1 s
+static double profile_ramp_steady(double t) {
+    const double full = 20.0 * SYNTH_K / 60.0;
+    if (t < 1.5) {
+        return full * t / 1.5;
+    }
+    if (t < 5.5) {
+        return full;
+    }
+    return t < 6.5 ? full * (6.5 - t) : 0.0;
+}
+
+// 10 L/min, closed for 1.5 s, 10 L/min again
+static double profile_stop_start(double t) {
+    return (t < 3.0 || (t >= 4.5 && t < 7.5)) ? 10.0 * SYNTH_K / 60.0 : 0.0;
+}
+
+// 8 L/min
+static double profile_steady(double t) {
+    return t < 5.0 ? 8.0 * SYNTH_K / 60.0 : 0.0;
+}
+
+// 0.4 L/min, 3 Hz: a slow drip close to the stop timeout
+static double profile_trickle(double t) {
+    return t < 8.0 ? 0.4 * SYNTH_K / 60.0 : 0.0;
+}
+
+/**
+ * Synthesise a trace from a rate profile
+ * @param jitter Edge time jitter as a share of the period
+ * @param bounce Share of edges followed by a contact bounce edge 300 us later
+ */
+static trace_input_t synthesise(const char* name, rate_profile_t profile, double seconds, double jitter, double bounce) {
+    static uint8_t data[64 * 1024];
+    pulse_trace_t t;
+    pulse_trace_init(&t, data, sizeof(data), REPLAY_TAP, PULSE_TRACE_FLAG_PCNT, SYNTH_K);
+    lcg_state = 12345;
+    
+    const uint32_t first_us = 0xFFFE0000U;  // Edge times wrap early in the trace
+    const double step_s = 0.0001;
+    double phase = 0.0;
+    for (double s = 0.0; s < seconds; s += step_s) {
+        double hz = profile(s);
+        phase += hz * step_s;
+        if (phase < 1.0) {
+            continue;
+        }
+        phase -= 1.0;
+        double at_us = s * 1e6 + lcg_unit() * jitter * 1e6 / hz;
+        uint32_t time_us = first_us + (uint32_t)std::max(at_us, 0.0);
+        if (t.header.count > 0 && (int32_t)(time_us - t.last_us) <= 0) {
+            time_us = t.last_us + 1;
+        }
+        pulse_trace_append(&t, time_us);
+        if (bounce > 0.0 && (lcg_unit() + 1.0) / 2.0 < bounce) {
+            pulse_trace_append(&t, time_us + 300);
+        }
+    }
+    trace_input_t input;
+    input.name = name;
+    input.image = trace_image(&t);
+    input.synthetic = true;
+    return input;
+}
+
+static bool read_file(const char* path, std::vector<uint8_t>* out) {
+    FILE* f = fopen(path, "rb");
+    if (f == NULL) {
+        return false;
+    }
+    uint8_t chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+        out->insert(out->end(), chunk, chunk + n);
+    }
+    fclose(f);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Replay
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    uint32_t edges;
+    double seconds;
+    double mae_fast_lpm;
+    double mae_smoothed_lpm;
+    double mae_window_lpm;
+    double volume_error_ml;
+    double overshoot_first_ml;
+    double overshoot_last_ml;
+    uint32_t stop_latency_us;
+    uint32_t cutoff_lag_us;      // Longest limit pulse to cut-off callback
+    double ns_per_sample;
+    double ns_per_edge;
+    bool rerecorded;             // Edge hook reproduced the trace exactly
+} replay_result_t;
+
+// Edge hook re-recording the replay
+static uint8_t rerecord_data[64 * 1024];
+static pulse_trace_t rerecord;
+
+static void on_edge(uint8_t tap, uint32_t time_us) {
+    if (tap == REPLAY_TAP) {
+        pulse_trace_append(&rerecord, time_us);
+    }
+}
+
+static void start_replay_from_rest(uint32_t k) {
+    idle(2000000);  // Rates from the previous run decay
+    flow_meter_set_calibration(REPLAY_TAP, k);
+    flow_meter_reset_volume(REPLAY_TAP);
+}
+
+// Whole trace, valve untouched: rate and volume accuracy, CPU cost, edge hook
+static void replay_accuracy(const pulse_trace_header_t& header, const std::vector<uint64_t>& edges,
+                            const std::vector<uint8_t>& image, replay_result_t* r) {
+    uint32_t k = header.pulses_per_liter > 0 ? header.pulses_per_liter : POUR_PULSES_PER_LITER;
+    start_replay_from_rest(k);
+    pulse_trace_init(&rerecord, rerecord_data, sizeof(rerecord_data), REPLAY_TAP, header.flags, k);
+    flow_meter_set_edge_hook(REPLAY_TAP, on_edge);
+    
+    accuracy_t a = {};
+    a.edges = &edges;
+    a.start_us = (uint64_t)shim_time_us + 1000;
+    a.k = k;
+    accuracy = &a;
+    sample_ns = sample_steps = edge_ns = edges_raised = 0;
+    for (uint64_t e : edges) {
+        advance_to(a.start_us + e);
+        raise_edge();
+    }
+    idle(RATE_REFERENCE_US + (uint64_t)FLOW_RATE_STOP_TIMEOUT_MS * 1000ULL);
+    accuracy = NULL;
+    flow_meter_set_edge_hook(REPLAY_TAP, NULL);
+    
+    r->edges = (uint32_t)edges.size();
+    r->seconds = edges.empty() ? 0.0 : (double)edges.back() / 1e6;
+    r->mae_fast_lpm = a.samples ? a.err_fast / a.samples : 0.0;
+    r->mae_smoothed_lpm = a.samples ? a.err_smoothed / a.samples : 0.0;
+    r->mae_window_lpm = a.samples ? a.err_window / a.samples : 0.0;
+    double expected_ul = (double)edges.size() * 1e6 / (double)k;
+    r->volume_error_ml = ((double)flow_meter_get_total_volume_ul(REPLAY_TAP) - expected_ul) / 1000.0;
+    r->ns_per_sample = sample_steps ? (double)sample_ns / (double)sample_steps : 0.0;
+    r->ns_per_edge = edges_raised ? (double)edge_ns / (double)edges_raised : 0.0;
+    
+    std::vector<uint8_t> copy = trace_image(&rerecord);
+    r->rerecorded = copy.size() == image.size() &&
+                    memcmp(copy.data() + sizeof(pulse_trace_header_t), image.data() + sizeof(pulse_trace_header_t),
+                           copy.size() - sizeof(pulse_trace_header_t)) == 0 &&
+                    rerecord.header.count == header.count;
+}
+
+// The same flow poured REPLAY_POURS times to a target: overshoot and stop latency learning
+static void replay_cutoff(const pulse_trace_header_t& header, const std::vector<uint64_t>& edges, replay_result_t* r) {
+    uint32_t k = header.pulses_per_liter > 0 ? header.pulses_per_liter : POUR_PULSES_PER_LITER;
+    uint64_t target = std::max<uint64_t>(1, (uint64_t)((double)edges.size() * POUR_FRACTION));
+    pour_controller_init();  // Back to the default stop latency
+    cutoff_lag_max_us = 0;
+    
+    for (int pour = 0; pour < REPLAY_POURS; pour++) {
+        start_replay_from_rest(k);
+        uint64_t start_us = (uint64_t)shim_time_us + 1000;
+        pour_controller_start(REPLAY_TAP, target);
+        
+        uint64_t closed_at = 0;
+        for (uint64_t e : edges) {
+            uint64_t at = start_us + e;
+            advance_to(at);
+            if (closed_at == 0 && valve_closed()) {
+                closed_at = next_sample_us - SAMPLE_PERIOD_US;  // Backstop closed it at the last step
+            }
+            if (closed_at != 0 && at > closed_at + VALVE_LATENCY_US) {
+                break;
+            }
+            raise_edge();
+            if (closed_at == 0 && valve_closed()) {
+                closed_at = at;  // Watch point closed it on this edge
+            }
+        }
+        for (int i = 0; i < 100 && pour_controller_get_state(REPLAY_TAP) != POUR_CTRL_DONE; i++) {
+            idle(SAMPLE_PERIOD_US);
+        }
+        
+        double overshoot_ml = ((double)flow_meter_get_pulse_count(REPLAY_TAP) - (double)target) * 1000.0 / (double)k;
+        if (pour == 0) {
+            r->overshoot_first_ml = overshoot_ml;
+        }
+        r->overshoot_last_ml = overshoot_ml;
+        pour_controller_stop(REPLAY_TAP);
+    }
+    r->stop_latency_us = pour_controller_get_stop_latency_us(REPLAY_TAP);
+    r->cutoff_lag_us = cutoff_lag_max_us;
+}
+
+static bool replay(const trace_input_t& input, replay_result_t* r) {
+    pulse_trace_header_t header;
+    std::vector<uint64_t> edges;
+    memset(r, 0, sizeof(*r));
+    if (!decode(input.image, &header, &edges) || edges.empty()) {
+        return false;
+    }
+    replay_accuracy(header, edges, input.image, r);
+    replay_cutoff(header, edges, r);
+    
+    char line[512];
+    snprintf(line, sizeof(line),
+             "{\"trace\":\"%s\",\"edges\":%u,\"seconds\":%.2f,\"mae_fast_lpm\":%.3f,\"mae_smoothed_lpm\":%.3f,"
+             "\"mae_1s_lpm\":%.3f,\"volume_error_ml\":%.2f,\"overshoot_first_ml\":%.2f,\"overshoot_last_ml\":%.2f,"
+             "\"stop_latency_us\":%u,\"cutoff_lag_us\":%u,\"ns_per_sample\":%.1f,\"ns_per_edge\":%.1f}",
+             input.name.c_str(), (unsigned)r->edges, r->seconds, r->mae_fast_lpm, r->mae_smoothed_lpm,
+             r->mae_window_lpm, r->volume_error_ml, r->overshoot_first_ml, r->overshoot_last_ml,
+             (unsigned)r->stop_latency_us, (unsigned)r->cutoff_lag_us, r->ns_per_sample, r->ns_per_edge);
+    printf("%s\n", line);
+    if (output != NULL) {
+        fprintf(output, "%s\n", line);
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Tests
+// ---------------------------------------------------------------------------
+
+void test_trace_codec(void) {
+    static uint8_t data[64];
+    pulse_trace_t t;
+    pulse_trace_init(&t, data, sizeof(data), 1, 0, 450);
+    const uint32_t times[] = {0xFFFFFF00U, 0xFFFFFF00U, 0x00000010U, 0x00000090U, 0x10000090U};
+    for (uint32_t time_us : times) {
+        TEST_ASSERT_TRUE(pulse_trace_append(&t, time_us));
+    }
+    // Deltas 0, 0, 0x110, 0x80, 2^28: 1 + 1 + 2 + 2 + 5 bytes
+    TEST_ASSERT_EQUAL(11, t.header.data_len);
+    
+    std::vector<uint8_t> image = trace_image(&t);
+    pulse_trace_reader_t reader;
+    TEST_ASSERT_TRUE(pulse_trace_reader_init(&reader, image.data(), image.size()));
+    uint32_t time_us;
+    for (uint32_t expected : times) {
+        TEST_ASSERT_TRUE(pulse_trace_next(&reader, &time_us));
+        TEST_ASSERT_EQUAL_HEX32(expected, time_us);
+    }
+    TEST_ASSERT_FALSE(pulse_trace_next(&reader, &time_us));
+    TEST_ASSERT_EQUAL(0x10000190ULL, reader.elapsed_us);
+    
+    // Cut short or not a trace
+    TEST_ASSERT_FALSE(pulse_trace_reader_init(&reader, image.data(), image.size() - 1));
+    image[0] ^= 0xFF;
+    TEST_ASSERT_FALSE(pulse_trace_reader_init(&reader, image.data(), image.size()));
+    
+    // A full buffer keeps what fitted and is marked truncated
+    pulse_trace_init(&t, data, 12, 0, 0, 450);
+    uint32_t added = 0;
+    for (uint32_t i = 0; i < 20; i++) {
+        added += pulse_trace_append(&t, i * 1000) ? 1 : 0;
+    }
+    TEST_ASSERT_EQUAL(t.header.count, added);
+    TEST_ASSERT_TRUE(t.header.flags & PULSE_TRACE_FLAG_TRUNCATED);
+    TEST_ASSERT_TRUE(t.header.data_len <= 12);
+}
+
+void test_replay_synthetic(void) {
+    const trace_input_t traces[] = {
+        synthesise("ramp_steady", profile_ramp_steady, 7.0, 0.03, 0.0),
+        synthesise("stop_start", profile_stop_start, 8.0, 0.02, 0.0),
+        synthesise("bounce", profile_steady, 5.5, 0.02, 0.15),
+        synthesise("trickle", profile_trickle, 8.5, 0.02, 0.0),
+    };
+    replay_result_t results[sizeof(traces) / sizeof(traces[0])];
+    for (size_t i = 0; i < sizeof(traces) / sizeof(traces[0]); i++) {
+        replay_result_t& r = results[i];
+        TEST_ASSERT_TRUE(replay(traces[i], &r));
+        TEST_ASSERT_TRUE(r.rerecorded);
+        // PCNT counts every edge: volume is exact across overflows and clock wraps
+        TEST_ASSERT_FLOAT_WITHIN(0.01, 0.0, r.volume_error_ml);
+        // Learning never makes the cut-off worse
+        TEST_ASSERT_TRUE(fabs(r.overshoot_last_ml) <= fabs(r.overshoot_first_ml) + 1000.0 / SYNTH_K);
+    }
+    
+    // Clean flow: the fast rate tracks within 1 L/min, the learned latency settles near the valve's
+    const replay_result_t& r = results[0];
+    TEST_ASSERT_TRUE(r.mae_fast_lpm < 1.0);
+    TEST_ASSERT_TRUE(r.mae_smoothed_lpm < r.mae_window_lpm);
+    TEST_ASSERT_UINT32_WITHIN(VALVE_LATENCY_US / 5, VALVE_LATENCY_US, r.stop_latency_us);
+    TEST_ASSERT_TRUE(fabs(r.overshoot_last_ml) < fabs(r.overshoot_first_ml));
+}
+
+void test_replay_recorded(void) {
+    const char* list = getenv("PULSE_TRACES");
+    if (list == NULL || list[0] == '\0') {
+        TEST_IGNORE_MESSAGE("PULSE_TRACES not set");
+        return;
+    }
+    std::string paths(list);
+    size_t pos = 0;
+    while (pos <= paths.size()) {
+        size_t end = paths.find(':', pos);
+        if (end == std::string::npos) {
+            end = paths.size();
+        }
+        std::string path = paths.substr(pos, end - pos);
+        pos = end + 1;
+        if (path.empty()) {
+            continue;
+        }
+        trace_input_t input;
+        input.name = path;
+        input.synthetic = false;
+        TEST_ASSERT_TRUE_MESSAGE(read_file(path.c_str(), &input.image), path.c_str());
+        replay_result_t r;
+        TEST_ASSERT_TRUE_MESSAGE(replay(input, &r), path.c_str());
+        TEST_ASSERT_TRUE(r.rerecorded);
+    }
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    const char* path = getenv("REPLAY_OUTPUT");
+    if (path != NULL && path[0] != '\0') {
+        output = fopen(path, "w");
+    }
+    
+    // 64-bit clock 2 s short of a 32-bit wrap, so the first trace crosses it
+    shim_time_us = (int64_t)(1ULL << 32) - 2000000;
+    next_sample_us = (uint64_t)shim_time_us;
+    flow_meter_init();
+    pour_controller_init();
+    
+    UNITY_BEGIN();
+    
+    RUN_TEST(test_trace_codec);
+    RUN_TEST(test_replay_synthetic);
+    RUN_TEST(test_replay_recorded);
+    
+    int failures = UNITY_END();
+    if (output != NULL) {
+        fclose(output);
+    }
+    return failures;
+}
@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Dynamic Devices Ltd
+# All rights reserved.
+#
+# Build the asset bundle written to the "assets" partition
+# (format: include/utils/asset_bundle.h)
+#
+# Each image is converted to RGB565 like convert_logo.py and RLE-compressed
+# when that makes it smaller. Flash the result with:
+#   parttool.py write_partition --partition-name assets --input assets.bin
+#
+
+from PIL import Image
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+# Reuse the pixel conversion from convert_logo.py
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from convert_logo import rle_compress, rgb565_bytes, trim_black_borders
+
+ASSET_BUNDLE_MAGIC = 0x42415050  # "PPAB"
+ASSET_BUNDLE_VERSION = 1
+ASSET_BUNDLE_MAX_ENTRIES = 32
+ASSET_NAME_SIZE = 16
+ASSET_FLAG_RLE = 0x01
+ASSET_FLAG_SWAP16 = 0x02
+LV_IMG_CF_TRUE_COLOR = 4         # LVGL 8 lv_img_cf_t
+PARTITION_SIZE = 0x40000         # config/partitions_ota.csv
+
+HEADER_FORMAT = "<IHHII"         # asset_bundle_header_t
+ENTRY_FORMAT = "<16sIIIHHBBH"    # asset_entry_t
+
+
+def convert_image(path, trim, use_rle, swap):
+    """
+    Convert one PNG to RGB565 bytes
+
+    Returns:
+        tuple: (data, raw_size, width, height, flags)
+    """
+    img = Image.open(path).convert('RGB')
+    if trim:
+        img = trim_black_borders(img)
+    width, height = img.size
+    pixels = img.load()
+
+    raw = []
+    for y in range(height):
+        for x in range(width):
+            r, g, b = pixels[x, y]
+            raw.extend(rgb565_bytes(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3), swap))
+
+    flags = ASSET_FLAG_SWAP16 if swap else 0
+    data = raw
+    if use_rle:
+        compressed = rle_compress(raw)
+        if len(compressed) < len(raw):
+            data = compressed
+            flags |= ASSET_FLAG_RLE
+    return bytes(data), len(raw), width, height, flags
+
+
+def build_bundle(images, trim, use_rle, swap):
+    """
+    Pack (name, path) pairs into a bundle
+
+    Returns:
+        bytes: The bundle
+    """
+    if len(images) > ASSET_BUNDLE_MAX_ENTRIES:
+        raise ValueError(f"At most {ASSET_BUNDLE_MAX_ENTRIES} assets per bundle")
+
+    header_size = struct.calcsize(HEADER_FORMAT)
+    index_size = struct.calcsize(ENTRY_FORMAT) * len(images)
+    offset = header_size + index_size
+
+    index = b""
+    blob = b""
+    for name, path in images:
+        encoded_name = name.encode("ascii")
+        if not encoded_name or len(encoded_name) >= ASSET_NAME_SIZE:
+            raise ValueError(f"Asset name must be 1-{ASSET_NAME_SIZE - 1} characters: {name}")
+        data, raw_size, width, height, flags = convert_image(path, trim, use_rle, swap)
+
+        padding = (-(offset + len(blob))) % 4
+        blob += b"\0" * padding
+        index += struct.pack(ENTRY_FORMAT, encoded_name, offset + len(blob), len(data), raw_size,
+                             width, height, LV_IMG_CF_TRUE_COLOR, flags, 0)
+        blob += data
+        print(f"  {name}: {width}x{height}, {len(data)} bytes"
+              f"{' (RLE, ' + str(raw_size) + ' decoded)' if flags & ASSET_FLAG_RLE else ''}")
+
+    size = offset + len(blob)
+    header = struct.pack(HEADER_FORMAT, ASSET_BUNDLE_MAGIC, ASSET_BUNDLE_VERSION, len(images), size,
+                         zlib.crc32(index) & 0xFFFFFFFF)
+    return header + index + blob
+
+
+def parse_image_arg(arg):
+    """NAME=PATH command line argument"""
+    name, sep, path = arg.partition("=")
+    if not sep:
+        raise argparse.ArgumentTypeError(f"Expected NAME=PATH, got {arg}")
+    return name, path
+
+
+def main():
+    """Main entry point"""
+    script_dir = os.path.dirname(os.path.abspath(__file__))
+    project_root = os.path.dirname(script_dir)
+    default_logo = os.path.join(project_root, "resources", "precision_pour_logo.png")
+
+    parser = argparse.ArgumentParser(
+        description='Build the asset bundle for the "assets" partition',
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog="""
+Examples:
+  %(prog)s                                     # Default Precision Pour logo
+  %(prog)s logo=venue_logo.png splash=venue.png
+  %(prog)s --output venue.bin --no-rle logo=venue_logo.png
+        """
+    )
+    parser.add_argument('images', nargs='*', type=parse_image_arg,
+                        help='Images as NAME=PATH ("logo" and "splash" are used by the UI)')
+    parser.add_argument('--output', type=str, default="assets.bin", help='Output file (default: assets.bin)')
+    parser.add_argument('--no-rle', action='store_true', help='Store pixels uncompressed (drawn straight from flash)')
+    parser.add_argument('--no-trim', action='store_true', help='Skip automatic black border trimming')
+    parser.add_argument('--no-swap', action='store_true',
+                        help='Emit native little-endian pixels (only for builds with LV_COLOR_16_SWAP 0)')
+    args = parser.parse_args()
+
+    images = args.images or [("logo", default_logo)]
+    for _, path in images:
+        if not os.path.exists(path):
+            print(f"Error: Image not found: {path}", file=sys.stderr)
+            sys.exit(1)
+
+    try:
+        bundle = build_bundle(images, not args.no_trim, not args.no_rle, not args.no_swap)
+    except ValueError as e:
+        print(f"Error: {e}", file=sys.stderr)
+        sys.exit(1)
+    if len(bundle) > PARTITION_SIZE:
+        print(f"Error: Bundle is {len(bundle)} bytes, the assets partition holds {PARTITION_SIZE}", file=sys.stderr)
+        sys.exit(1)
+
+    with open(args.output, "wb") as f:
+        f.write(bundle)
+    print(f"✓ Wrote {args.output}: {len(images)} assets, {len(bundle)} bytes")
+    print(f"  Flash with: parttool.py write_partition --partition-name assets --input {args.output}")
+
+
+if __name__ == "__main__":
+    main()
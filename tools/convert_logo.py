@@ -137,7 +137,32 @@ def rle_compress(data):
     return compressed
 
 
-def convert_to_lvgl_rgb565(input_path, output_path, var_name="precision_pour_logo", trim_borders=True, use_rle=False):
+def rgb565_bytes(rgb565, swap=True):
+    """
+    Serialize one RGB565 pixel in the byte order LVGL renders in
+    
+    Args:
+        rgb565: 16-bit RGB565 value
+        swap: True for LV_COLOR_16_SWAP 1 (MSB first, the ILI9341 wire order),
+              False for native little-endian
+    
+    Returns:
+        List of 2 bytes
+    """
+    if swap:
+        return [(rgb565 >> 8) & 0xFF, rgb565 & 0xFF]
+    return [rgb565 & 0xFF, (rgb565 >> 8) & 0xFF]
+
+
+def write_color_swap_guard(f, var_name, swap):
+    """Emit a compile-time check that the image byte order matches lv_conf.h"""
+    f.write(f"// Pixel byte order: LV_COLOR_16_SWAP {1 if swap else 0}\n")
+    f.write(f"#if LV_COLOR_16_SWAP != {1 if swap else 0}\n")
+    f.write(f"#error \"{var_name} byte order does not match LV_COLOR_16_SWAP - regenerate the image header\"\n")
+    f.write("#endif\n\n")
+
+
+def convert_to_lvgl_rgb565(input_path, output_path, var_name="precision_pour_logo", trim_borders=True, use_rle=False, swap=True):
     """
     Convert PNG logo image to LVGL RGB565 C array format
     
@@ -184,9 +209,8 @@ def convert_to_lvgl_rgb565(input_path, output_path, var_name="precision_pour_log
                 # G: 6 bits in position 10-5
                 # B: 5 bits in position 4-0
                 rgb565 = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
-                # Store as little-endian (2 bytes)
-                rgb565_data.append(rgb565 & 0xFF)  # Low byte
-                rgb565_data.append((rgb565 >> 8) & 0xFF)  # High byte
+                # Store in LVGL render byte order (MSB first with LV_COLOR_16_SWAP)
+                rgb565_data.extend(rgb565_bytes(rgb565, swap))
         
         # Apply RLE compression if requested
         original_size = len(rgb565_data)
@@ -209,13 +233,14 @@ def convert_to_lvgl_rgb565(input_path, output_path, var_name="precision_pour_log
             f.write("/**\n")
             f.write(f" * Precision Pour Logo\n")
             f.write(f" * Generated from: {os.path.basename(input_path)}\n")
-            f.write(f" * Format: RGB565, Size: {width}x{height}\n")
+            f.write(f" * Format: RGB565{' (byte-swapped)' if swap else ''}, Size: {width}x{height}\n")
             if is_compressed:
                 f.write(f" * Compression: RLE (compressed size: {len(rgb565_data)} bytes, original: {original_size} bytes)\n")
             f.write(" */\n\n")
             f.write(f"#ifndef {var_name.upper()}_H\n")
             f.write(f"#define {var_name.upper()}_H\n\n")
             f.write("#include <lvgl.h>\n\n")
+            write_color_swap_guard(f, var_name, swap)
             if is_compressed:
                 f.write("// RLE-compressed image data\n")
                 f.write("// Use rle_decompress_image() to decompress before use\n")
@@ -294,6 +319,7 @@ Examples:
   %(prog)s --rle               # Convert with RLE compression
   %(prog)s --no-trim           # Convert without border trimming
   %(prog)s --rle --no-trim     # RLE compression without trimming
+  %(prog)s --rle --no-swap     # Native byte order (for LV_COLOR_16_SWAP 0)
         """
     )
     parser.add_argument(
@@ -306,6 +332,11 @@ Examples:
         action='store_true',
         help='Skip automatic black border trimming'
     )
+    parser.add_argument(
+        '--no-swap',
+        action='store_true',
+        help='Emit native little-endian pixels (only for builds with LV_COLOR_16_SWAP 0)'
+    )
     parser.add_argument(
         '--input',
         type=str,
@@ -337,7 +368,8 @@ Examples:
         input_image, 
         output_header,
         trim_borders=not args.no_trim,
-        use_rle=args.rle
+        use_rle=args.rle,
+        swap=not args.no_swap
     )
 
 
@@ -10,8 +10,11 @@ from PIL import Image
 import os
 import sys
 
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from convert_logo import rgb565_bytes, write_color_swap_guard
 
-def convert_to_lvgl_rgb565(input_path, output_path, var_name="precision_pour_img"):
+
+def convert_to_lvgl_rgb565(input_path, output_path, var_name="precision_pour_img", swap=True):
     """
     Convert PNG image to LVGL RGB565 C array format
     
@@ -19,6 +22,7 @@ def convert_to_lvgl_rgb565(input_path, output_path, var_name="precision_pour_img
         input_path: Path to input PNG image
         output_path: Path to output C header file
         var_name: Variable name for the C array
+        swap: Emit MSB-first pixels to match LV_COLOR_16_SWAP 1
     
     Returns:
         tuple: (width, height) of the converted image
@@ -44,9 +48,8 @@ def convert_to_lvgl_rgb565(input_path, output_path, var_name="precision_pour_img
                 r, g, b = pixels[x, y]
                 # Convert RGB888 to RGB565
                 rgb565 = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
-                # Store as little-endian (2 bytes)
-                rgb565_data.append(rgb565 & 0xFF)  # Low byte
-                rgb565_data.append((rgb565 >> 8) & 0xFF)  # High byte
+                # Store in LVGL render byte order (MSB first with LV_COLOR_16_SWAP)
+                rgb565_data.extend(rgb565_bytes(rgb565, swap))
         
         # Generate C header file
         with open(output_path, 'w') as f:
@@ -58,6 +61,7 @@ def convert_to_lvgl_rgb565(input_path, output_path, var_name="precision_pour_img
             f.write(f"#ifndef {var_name.upper()}_H\n")
             f.write(f"#define {var_name.upper()}_H\n\n")
             f.write("#include <lvgl.h>\n\n")
+            write_color_swap_guard(f, var_name, swap)
             
             # Write image data array
             f.write(f"static const uint8_t {var_name}_data[] = {{\n")
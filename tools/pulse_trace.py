@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Dynamic Devices Ltd
+# All rights reserved.
+#
+# Save a pulse trace (format: include/flow/pulse_trace.h) for the host
+# replay harness (test/test_trace_replay_native)
+#
+# From a serial log of "trace dump":
+#   python3 tools/pulse_trace.py extract monitor.log bar1.ptrace
+# From the MQTT dump, each telemetry/trace message saved to its own file:
+#   python3 tools/pulse_trace.py join chunk_*.bin bar1.ptrace
+# Summary of a trace:
+#   python3 tools/pulse_trace.py info bar1.ptrace
+#
+
+import argparse
+import re
+import struct
+import sys
+
+PULSE_TRACE_MAGIC = 0x43525450   # "PTRC"
+PULSE_TRACE_VERSION = 1
+PULSE_TRACE_FLAG_TRUNCATED = 0x01
+PULSE_TRACE_FLAG_PCNT = 0x02
+HEADER_FORMAT = "<IBBBBIIII"     # pulse_trace_header_t
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+CHUNK_HEADER_FORMAT = "<II"      # offset, total
+
+LINE_RE = re.compile(r"trace ([0-9a-f]{6,8}) ([0-9a-f]+)\s*$")
+
+
+def assemble(pieces, total=None):
+    """
+    Place (offset, bytes) pieces into one image
+    @return The image, or None with a message if bytes are missing
+    """
+    if not pieces:
+        return None, "no trace data found"
+    size = total if total is not None else max(off + len(data) for off, data in pieces)
+    image = bytearray(size)
+    have = bytearray(size)
+    for off, data in pieces:
+        image[off:off + len(data)] = data
+        have[off:off + len(data)] = b"\x01" * len(data)
+    if 0 in have:
+        return None, "missing bytes at offset %d" % have.index(0)
+    return bytes(image), None
+
+
+def parse_header(image):
+    if len(image) < HEADER_SIZE:
+        return None
+    fields = struct.unpack_from(HEADER_FORMAT, image)
+    keys = ("magic", "version", "tap", "flags", "reserved", "pulses_per_liter", "count", "first_us", "data_len")
+    header = dict(zip(keys, fields))
+    if header["magic"] != PULSE_TRACE_MAGIC or header["version"] != PULSE_TRACE_VERSION:
+        return None
+    return header
+
+
+def edge_deltas(image, header):
+    """Decode the LEB128 deltas (us between edges, 0 for the first)"""
+    data = image[HEADER_SIZE:HEADER_SIZE + header["data_len"]]
+    deltas = []
+    value = 0
+    shift = 0
+    for b in data:
+        value |= (b & 0x7F) << shift
+        if b & 0x80:
+            shift += 7
+            continue
+        deltas.append(value)
+        value = 0
+        shift = 0
+    return deltas
+
+
+def cmd_extract(args):
+    pieces = []
+    with open(args.log, "r", errors="replace") as f:
+        for line in f:
+            m = LINE_RE.search(line)
+            if m:
+                pieces.append((int(m.group(1), 16), bytes.fromhex(m.group(2))))
+    image, error = assemble(pieces)
+    return write_trace(image, error, args.output)
+
+
+def cmd_join(args):
+    pieces = []
+    total = None
+    for path in args.chunks:
+        with open(path, "rb") as f:
+            message = f.read()
+        offset, total = struct.unpack_from(CHUNK_HEADER_FORMAT, message)
+        pieces.append((offset, message[8:]))
+    image, error = assemble(pieces, total)
+    return write_trace(image, error, args.output)
+
+
+def write_trace(image, error, path):
+    if error is None and parse_header(image) is None:
+        error = "not a pulse trace (bad magic or version)"
+    if error is not None:
+        print("error: %s" % error, file=sys.stderr)
+        return 1
+    with open(path, "wb") as f:
+        f.write(image)
+    print_info(image)
+    return 0
+
+
+def print_info(image):
+    header = parse_header(image)
+    deltas = edge_deltas(image, header)
+    duration_s = sum(deltas) / 1e6
+    flags = []
+    if header["flags"] & PULSE_TRACE_FLAG_PCNT:
+        flags.append("pcnt")
+    if header["flags"] & PULSE_TRACE_FLAG_TRUNCATED:
+        flags.append("truncated")
+    print("tap %d, K %d, %d edges over %.2f s, %d bytes%s" % (
+        header["tap"], header["pulses_per_liter"], header["count"], duration_s, len(image),
+        " (%s)" % ", ".join(flags) if flags else ""))
+    if header["pulses_per_liter"] > 0:
+        print("volume %.1f ml" % (header["count"] * 1000.0 / header["pulses_per_liter"]))
+    gaps = [d for d in deltas[1:] if d > 0]
+    if gaps:
+        print("edge spacing min %d us, max %d us" % (min(gaps), max(gaps)))
+
+
+def cmd_info(args):
+    with open(args.trace, "rb") as f:
+        image = f.read()
+    if parse_header(image) is None:
+        print("error: not a pulse trace", file=sys.stderr)
+        return 1
+    print_info(image)
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pulse trace files for the replay harness")
+    sub = parser.add_subparsers(dest="command", required=True)
+    p = sub.add_parser("extract", help="trace from the 'trace dump' lines of a serial log")
+    p.add_argument("log")
+    p.add_argument("output")
+    p.set_defaults(func=cmd_extract)
+    p = sub.add_parser("join", help="trace from telemetry/trace messages, one binary file each")
+    p.add_argument("chunks", nargs="+")
+    p.add_argument("output")
+    p.set_defaults(func=cmd_join)
+    p = sub.add_parser("info", help="summary of a trace")
+    p.add_argument("trace")
+    p.set_defaults(func=cmd_info)
+    args = parser.parse_args()
+    return args.func(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())